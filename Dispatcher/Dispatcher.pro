@@ -52,6 +52,7 @@ HEADERS += \
 	CDspVm.h \
 	CDspDispConnection.h \
 	CDspVmDirManager.h \
+	CDspVmDirIndex.h \
 	CDspVmDirHelper.h \
 	CDspVmDirHelper_p.h \
 	CDspVmManager.h \
@@ -91,6 +92,7 @@ HEADERS += \
 	CDspDBusHub.h \
 	CDspVmBrand.h \
 	CDspTaskTrace.h \
+	CDspTaskPool.h \
 	CDspTemplateFacade.h \
 	CDspTemplateScanner.h \
 	CDspTemplateStorage.h \
@@ -103,6 +105,7 @@ HEADERS += \
 	Stat/CDspStatCollectingThread.h \
 	Stat/CDspStatCollector.h \
 	Stat/CDspStatStorage.h \
+	Stat/CDspStatFilter.h \
 	Stat/CDspStatisticsGuard.h \
 	Stat/CDspSystemInfo.h \
 	\
@@ -166,7 +169,8 @@ HEADERS += \
 	\
 	Cache/Cache.h \
 	Cache/CacheImpl.h \
-	Cache/CacheImpl.cpp
+	Cache/CacheImpl.cpp \
+	Cache/CacheWatcher.h
 
 SOURCES += \
 	CDspInstrument.cpp \
@@ -189,6 +193,7 @@ SOURCES += \
 	CDspVm.cpp \
 	CDspDispConnection.cpp \
 	CDspVmDirManager.cpp \
+	CDspVmDirIndex.cpp \
 	CDspVmManager.cpp \
 	CDspVmMounter.cpp \
 	CDspVmGuestPersonality.cpp \
@@ -223,6 +228,7 @@ SOURCES += \
 	CDspDBusHub.cpp \
 	CDspVmBrand.cpp \
 	CDspTaskTrace.cpp \
+	CDspTaskPool.cpp \
 	CDspTemplateFacade.cpp \
 	CDspTemplateScanner.cpp \
 	CDspTemplateStorage.cpp \
@@ -234,6 +240,7 @@ SOURCES += \
 	Stat/CDspStatCollectingThread.cpp \
 	Stat/CDspStatCollector_common.cpp \
 	Stat/CDspStatStorage.cpp \
+	Stat/CDspStatFilter.cpp \
 	Stat/CDspStatisticsGuard.cpp \
 	\
 	Tasks/Mixin_CreateHddSupport.cpp \
@@ -280,6 +287,7 @@ SOURCES += \
 	\
 	Guards/Server_Sentry.cpp \
 	\
+	Cache/CacheWatcher.cpp \
 
 linux-* {
 	INCLUDEPATH *=
@@ -349,11 +357,15 @@ libvirt {
 		CDspLibvirtQObject_p.h \
 		CDspLibvirt.h \
 		CDspLibvirtExec.h \
+		CDspLibvirtRecord.h \
+		CDspLibvirtLoop.h \
 		CDspLibvirt_p.h
 
 	SOURCES += \
 		CDspLibvirt.cpp \
-		CDspLibvirtAgent.cpp
+		CDspLibvirtAgent.cpp \
+		CDspLibvirtRecord.cpp \
+		CDspLibvirtLoop.cpp
 
 	DEFINES += _LIBVIRT_=1
 }
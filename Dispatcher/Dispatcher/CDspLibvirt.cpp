@@ -24,6 +24,7 @@
 
 #include <QXmlQuery>
 #include <QHostAddress>
+#include <QtConcurrent/QtConcurrent>
 #include "CDspService.h"
 #include <QXmlResultItems>
 #include "Build/Current.ver"
@@ -458,13 +459,20 @@ namespace Breeding
 
 void Vm::operator()(Agent::Hub& hub_)
 {
+	quint64 t = PrlGetTimeMonotonic();
 	QList<Agent::Vm::Unit> a;
 	if (hub_.vms().all(a).isFailed())
 	{
 		WRITE_TRACE(DBG_FATAL, "Cannot list VMs");
 		return;
 	}
-	WRITE_TRACE(DBG_FATAL, "Got %d VMs", a.size());
+	// one call for the states of all the VMs instead of a call per VM
+	QHash<QString, VIRTUAL_MACHINE_STATE> z;
+	if (hub_.vms().getState(z).isFailed())
+		WRITE_TRACE(DBG_FATAL, "Cannot get the states of VMs");
+
+	quint64 l = PrlGetTimeMonotonic();
+	WRITE_TRACE(DBG_FATAL, "Got %d VMs with %d states", a.size(), z.size());
 
 	QHash<QString, Agent::Vm::Unit> b, c;
 	foreach (Agent::Vm::Unit m, a)
@@ -504,12 +512,52 @@ void Vm::operator()(Agent::Hub& hub_)
 	{
 		c[u].getState().undefine();
 	}
-	foreach (const QString& u, b.keys())
+	quint64 r = PrlGetTimeMonotonic();
+
+	// the XML of every VM is read and converted on the pool while the
+	// registry is updated here in the order of the VMs
+	QThreadPool p;
+	p.setMaxThreadCount(CONCURRENCY);
+	QStringList k = b.keys();
+	QList<Callback::Reactor::Domain> d;
+	QList<QFuture<Callback::Reactor::Domain::config_type> > f;
+	foreach (const QString& u, k)
+	{
+		Callback::Reactor::State x;
+		if (z.contains(u))
+			x = Callback::Reactor::State(z.value(u));
+		else
+			x.read(b[u]);
+
+		d << Callback::Reactor::Domain(b[u], x);
+		f << QtConcurrent::run(&p, boost::bind
+			(&Callback::Reactor::Domain::read, d.last()));
+	}
+	QList<QFuture<void> > g;
+	for (int i = 0; i < k.size(); ++i)
+	{
+		WRITE_TRACE(DBG_DEBUG, "update UUID %s", qPrintable(k[i]));
+		Registry::Access x = m_view->getHost().getRegistry().find(k[i]);
+		d[i].adopt(x, m_view->find(k[i]), f[i].result());
+		boost::optional<CVmConfiguration> y = x.getConfig();
+		if (y)
+			g << QtConcurrent::run(&p, boost::bind(&Vm::define, b[k[i]], y.get()));
+	}
+	quint64 v = PrlGetTimeMonotonic();
+	foreach (QFuture<void> x, g)
 	{
-		WRITE_TRACE(DBG_DEBUG, "update UUID %s", qPrintable(u));
-		Registry::Access a = m_view->getHost().getRegistry().find(u);
-		Callback::Reactor::Domain(b[u]).update(a, m_view->find(u));
+		x.waitForFinished();
 	}
+	quint64 e = PrlGetTimeMonotonic();
+	WRITE_TRACE(DBG_FATAL, "%d VMs are ready in %llu ms: list %llu ms, "
+		"registry %llu ms, convert %llu ms, define %llu ms", k.size(),
+		(e - t) / 1000, (l - t) / 1000, (r - l) / 1000, (v - r) / 1000,
+		(e - v) / 1000);
+}
+
+void Vm::define(Agent::Vm::Unit unit_, const CVmConfiguration& config_)
+{
+	unit_.setConfig(config_);
 }
 
 bool Vm::validate(const QString& uuid_)
@@ -874,6 +922,19 @@ void Mock::fire(const eventHandler_type& event_)
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hub
 
+Hub::Hub(): m_reported(PrlGetTimeMonotonic()), m_queue(QUEUE)
+{
+}
+
+Hub::~Hub()
+{
+	event_type* e = NULL;
+	while (m_queue.pop(e))
+		delete e;
+
+	report();
+}
+
 void Hub::add(int id_, virEventTimeoutCallback callback_)
 {
 	m_timeoutMap.insert(id_, new Timeout(callback_, id_));
@@ -943,6 +1004,43 @@ void Hub::remove(int id_)
 	m_sweeperMap.insert(id_, s);
 }
 
+void Hub::push(const Mock::eventHandler_type& event_)
+{
+	m_queue.push(new event_type(event_, PrlGetTimeMonotonic()));
+	// one queued drain serves every event pushed before it runs
+	if (m_drain.testAndSetOrdered(0, 1))
+		QMetaObject::invokeMethod(this, "drain", Qt::QueuedConnection);
+}
+
+void Hub::drain()
+{
+	m_drain.fetchAndStoreOrdered(0);
+	event_type* e = NULL;
+	while (m_queue.pop(e))
+	{
+		QScopedPointer<event_type> g(e);
+		m_wait.account(PrlGetTimeMonotonic() - e->second);
+		m_mock.fire(e->first);
+		m_react.account(PrlGetTimeMonotonic() - e->second);
+	}
+	if (PrlGetTimeMonotonic() - m_reported >= REPORT_PERIOD * Q_UINT64_C(1000000))
+		report();
+}
+
+void Hub::report()
+{
+	m_reported = PrlGetTimeMonotonic();
+	if (0 == m_react.getCount())
+		return;
+
+	WRITE_TRACE(DBG_INFO, "libvirt events wait for the model: %s",
+		qPrintable(m_wait.toString()));
+	WRITE_TRACE(DBG_INFO, "libvirt events reach the model state: %s",
+		qPrintable(m_react.toString()));
+	m_wait.reset();
+	m_react.reset();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Access
 
@@ -958,6 +1056,12 @@ void Access::setHub(const QSharedPointer<Hub>& hub_)
 
 int Access::add(int interval_, virEventTimeoutCallback callback_, void* opaque_, virFreeCallback free_)
 {
+	QSharedPointer<Native::Loop> n = m_loop.toStrongRef();
+	if (!n.isNull())
+	{
+		int output = m_generator.fetchAndAddOrdered(1);
+		return n->add(output, interval_, callback_, opaque_, free_) ? output : -1;
+	}
 	QSharedPointer<Hub> h = m_hub.toStrongRef();
 	if (h.isNull())
 		return -1;
@@ -972,6 +1076,12 @@ int Access::add(int interval_, virEventTimeoutCallback callback_, void* opaque_,
 
 int Access::add(int socket_, int events_, virEventHandleCallback callback_, void* opaque_, virFreeCallback free_)
 {
+	QSharedPointer<Native::Loop> n = m_loop.toStrongRef();
+	if (!n.isNull())
+	{
+		int output = m_generator.fetchAndAddOrdered(1);
+		return n->add(output, socket_, events_, callback_, opaque_, free_) ? output : -1;
+	}
 	QSharedPointer<Hub> h = m_hub.toStrongRef();
 	if (h.isNull())
 		return -1;
@@ -986,6 +1096,10 @@ int Access::add(int socket_, int events_, virEventHandleCallback callback_, void
 
 void Access::setEvents(int id_, int value_)
 {
+	QSharedPointer<Native::Loop> n = m_loop.toStrongRef();
+	if (!n.isNull())
+		return n->setEvents(id_, value_);
+
 	QSharedPointer<Hub> h = m_hub.toStrongRef();
 	if (h.isNull())
 		return;
@@ -995,6 +1109,10 @@ void Access::setEvents(int id_, int value_)
 
 void Access::setInterval(int id_, int value_)
 {
+	QSharedPointer<Native::Loop> n = m_loop.toStrongRef();
+	if (!n.isNull())
+		return n->setInterval(id_, value_);
+
 	QSharedPointer<Hub> h = m_hub.toStrongRef();
 	if (h.isNull())
 		return;
@@ -1015,6 +1133,10 @@ void Access::setOpaque(int id_, Transport::Visitor* value_)
 
 int Access::remove(int id_)
 {
+	QSharedPointer<Native::Loop> n = m_loop.toStrongRef();
+	if (!n.isNull())
+		return n->remove(id_);
+
 	QSharedPointer<Hub> h = m_hub.toStrongRef();
 	if (h.isNull())
 		return -1;
@@ -1023,6 +1145,13 @@ int Access::remove(int id_)
 	return 0;
 }
 
+void Access::defer(const Mock::eventHandler_type& event_)
+{
+	QSharedPointer<Hub> h = m_hub.toStrongRef();
+	if (!h.isNull())
+		h->push(event_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Sweeper
 
@@ -1437,6 +1566,119 @@ void error(void* opaque_, virErrorPtr value_)
 
 } // namespace Plain
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Hold
+
+template<class T>
+struct Hold
+{
+	typedef T type;
+
+	static type take(T value_)
+	{
+		return value_;
+	}
+	static T give(const type& value_)
+	{
+		return value_;
+	}
+};
+
+template<>
+struct Hold<virConnectPtr>
+{
+	typedef QSharedPointer<virConnect> type;
+
+	static type take(virConnectPtr value_)
+	{
+		if (NULL == value_ || 0 != virConnectRef(value_))
+			return type();
+
+		return type(value_, &virConnectClose);
+	}
+	static virConnectPtr give(const type& value_)
+	{
+		return value_.data();
+	}
+};
+
+template<>
+struct Hold<virDomainPtr>
+{
+	typedef QSharedPointer<virDomain> type;
+
+	static type take(virDomainPtr value_)
+	{
+		if (NULL == value_ || 0 != virDomainRef(value_))
+			return type();
+
+		return type(value_, &virDomainFree);
+	}
+	static virDomainPtr give(const type& value_)
+	{
+		return value_.data();
+	}
+};
+
+template<>
+struct Hold<virNetworkPtr>
+{
+	typedef QSharedPointer<virNetwork> type;
+
+	static type take(virNetworkPtr value_)
+	{
+		if (NULL == value_ || 0 != virNetworkRef(value_))
+			return type();
+
+		return type(value_, &virNetworkFree);
+	}
+	static virNetworkPtr give(const type& value_)
+	{
+		return value_.data();
+	}
+};
+
+template<>
+struct Hold<const char* >
+{
+	typedef QByteArray type;
+
+	static type take(const char* value_)
+	{
+		return type(value_);
+	}
+	static const char* give(const type& value_)
+	{
+		return value_.isNull() ? NULL : value_.constData();
+	}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Defer
+
+// with the native loop the libvirt events are dispatched on their own
+// thread, the callback is handed to the hub to run against the model there
+template<class... A>
+struct Defer
+{
+	template<int (*F)(A..., void* )>
+	static int react(A... args_, void* opaque_)
+	{
+		if (!g_access.isNative())
+			return F(args_..., opaque_);
+
+		g_access.defer(boost::bind(&play<F>, Hold<A>::take(args_)..., _1));
+		return 0;
+	}
+
+private:
+	template<int (*F)(A..., void* )>
+	static void play(const typename Hold<A>::type&... args_, Model::Coarse* model_)
+	{
+		F(Hold<A>::give(args_)..., model_);
+	}
+};
+
 namespace Reactor
 {
 ///////////////////////////////////////////////////////////////////////////////
@@ -1444,57 +1686,60 @@ namespace Reactor
 
 void Performance::operator()(Registry::Access& access_)
 {
+	QSharedPointer<Stat::Storage> s = access_.getStorage();
+	QSharedPointer<Registry::Columns> k = access_.getColumns();
+	if (s.isNull() || k.isNull())
+		return;
+
+	quint64 t = PrlGetTimeMonotonic();
 	Prl::Expected<Instrument::Agent::Vm::Stat::CounterList_type, Error::Simple>
 		c = m_source.getCpu();
 	if (c.isSucceed())
-		account(access_, c.value());
+		account(*s, k->cpu, c.value(), t);
 
-	account(access_, m_source.getMemory());
+	account(*s, k->memory, m_source.getMemory(), t);
 
-	boost::optional<CVmConfiguration> x = access_.getConfig();
-	if (x)
+	QSharedPointer<const Registry::Binding> b = access_.getBinding();
+	if (!b.isNull())
 	{
-		foreach (const CVmGenericNetworkAdapter* a, x->getVmHardwareList()->m_lstNetworkAdapters)
-		{
-			if (a->getEnabled() != PVE::DeviceEnabled ||
-				a->getConnected() != PVE::DeviceConnected)
-				continue;
-
-			Prl::Expected<Instrument::Agent::Vm::Stat::CounterList_type, Error::Simple>
-				s = m_source.getInterface(a);
-			if (s.isSucceed())
-				account(access_, s.value());
-		}
+		foreach (const Registry::Binding::device_type& d, b->interfaces)
+			account(*s, m_source.findInterface(d.first), d.second, t);
 
-		foreach (const CVmHardDisk* d, x->getVmHardwareList()->m_lstHardDisks)
-		{
-			if (d->getEnabled() != PVE::DeviceEnabled ||
-				d->getConnected() != PVE::DeviceConnected)
-				continue;
-
-			Prl::Expected<Instrument::Agent::Vm::Stat::CounterList_type, Error::Simple>
-				s = m_source.getDisk(d);
-			if (s.isSucceed())
-				account(access_, s.value());
-		}
+		foreach (const Registry::Binding::device_type& d, b->disks)
+			account(*s, m_source.findDisk(d.first), d.second, t);
 	}
 
 	Prl::Expected<Instrument::Agent::Vm::Stat::CounterList_type, Error::Simple>
 		vc = m_source.getVCpuList();
 	if (vc.isSucceed())
-		account(access_, vc.value());
+		account(*s, k->vcpu, vc.value(), t);
 }
 
-void Performance::account(Registry::Access& access_, const data_type& data_)
+void Performance::account(Stat::Storage& storage_, Stat::Column& column_,
+	const data_type& data_, quint64 time_)
 {
-	QSharedPointer<Stat::Storage> s = access_.getStorage();
-	if (s.isNull())
+	for (int i = 0; i < data_.size(); ++i)
+	{
+		boost::optional<Stat::counterId_type> x =
+			column_.find(storage_, i, data_.at(i).first);
+		if (x)
+			storage_.write(x.get(), data_.at(i).second, time_);
+	}
+}
+
+template<int N>
+void Performance::account(Stat::Storage& storage_,
+	const Instrument::Agent::Vm::Performance::Values<N>* values_,
+	const QVector<Registry::Binding::id_type>& ids_, quint64 time_)
+{
+	if (NULL == values_)
 		return;
 
-	foreach (const Instrument::Agent::Vm::Stat::Counter_type& c, data_)
+	quint64 v = 0;
+	for (int i = 0; i < qMin(N, ids_.size()); ++i)
 	{
-		s->addAbsolute(c.first);
-		s->write(c.first, c.second, PrlGetTimeMonotonic());
+		if (ids_[i] && values_->get(i, v))
+			storage_.write(ids_[i].get(), v, time_);
 	}
 }
 
@@ -1548,30 +1793,51 @@ void Device::operator()(Registry::Access& access_)
 ///////////////////////////////////////////////////////////////////////////////
 // struct Domain
 
-void Domain::updateConfig(Registry::Access& access_)
+Domain::config_type Domain::read() const
 {
-	m_state.read(m_agent);
 	CVmConfiguration c;
-	if (m_agent.getConfig(c).isFailed())
-		return;
+	State::agent_type a(m_agent);
+	if (a.getConfig(c).isFailed())
+		return boost::none;
 
 	CVmConfiguration runtime;
 	if ((m_state.getValue() == VMS_RUNNING || m_state.getValue() == VMS_PAUSED)
-		&& m_agent.getConfig(runtime, true).isSucceed())
+		&& a.getConfig(runtime, true).isSucceed())
 		Vm::Config::Repairer<Vm::Config::revise_types>::type::do_(c, runtime);
 
-	m_agent.completeConfig(c);
-	access_.updateConfig(c);
+	a.completeConfig(c);
+	return c;
+}
+
+void Domain::apply(Registry::Access& access_, const CVmConfiguration& config_)
+{
+	access_.updateConfig(config_);
 	CDspLockedPointer<CDspVmStateSender> x(CDspService::instance()->getVmStateSender());
 	if (x.isValid())
 		x->onVmConfigChanged(QString(), access_.getUuid());
 }
 
-void Domain::update(Registry::Access& access_, const entry_type& model_)
+void Domain::adopt(Registry::Access& access_, const entry_type& model_,
+	const config_type& config_)
 {
-	updateConfig(access_);
+	if (config_)
+		apply(access_, config_.get());
 	if (!model_.isNull())
 		model_->setState(m_state);
+}
+
+void Domain::updateConfig(Registry::Access& access_)
+{
+	m_state.read(m_agent);
+	config_type c = read();
+	if (c)
+		apply(access_, c.get());
+}
+
+void Domain::update(Registry::Access& access_, const entry_type& model_)
+{
+	m_state.read(m_agent);
+	adopt(access_, model_, read());
 	boost::optional<CVmConfiguration> config = access_.getConfig();
 	if (config)
 		m_agent.setConfig(config.get());
@@ -2078,55 +2344,55 @@ void Domains::setConnected(QSharedPointer<virConnect> libvirtd_)
 	m_eventState = virConnectDomainEventRegisterAny(libvirtd_.data(),
 							NULL,
 							VIR_DOMAIN_EVENT_ID_LIFECYCLE,
-							VIR_DOMAIN_EVENT_CALLBACK(&Callback::State::react),
+							VIR_DOMAIN_EVENT_CALLBACK((&Callback::Defer<virConnectPtr, virDomainPtr, int, int>::react<&Callback::State::react>)),
 							new Model::Coarse(v),
 							&Callback::Plain::delete_<Model::Coarse>);
 	m_eventReboot = virConnectDomainEventRegisterAny(libvirtd_.data(),
 							NULL,
 							VIR_DOMAIN_EVENT_ID_REBOOT,
-							VIR_DOMAIN_EVENT_CALLBACK(&Callback::Plain::reboot),
+							VIR_DOMAIN_EVENT_CALLBACK((&Callback::Defer<virConnectPtr, virDomainPtr>::react<&Callback::Plain::reboot>)),
 							new Model::Coarse(v),
 							&Callback::Plain::delete_<Model::Coarse>);
 	m_eventWakeUp = virConnectDomainEventRegisterAny(libvirtd_.data(),
 							NULL,
 							VIR_DOMAIN_EVENT_ID_PMWAKEUP,
-							VIR_DOMAIN_EVENT_CALLBACK(&Callback::Plain::wakeUp),
+							VIR_DOMAIN_EVENT_CALLBACK((&Callback::Defer<virConnectPtr, virDomainPtr, int>::react<&Callback::Plain::wakeUp>)),
 							new Model::Coarse(v),
 							&Callback::Plain::delete_<Model::Coarse>);
 	m_eventDeviceConnect = virConnectDomainEventRegisterAny(libvirtd_.data(),
 							NULL,
 							VIR_DOMAIN_EVENT_ID_DEVICE_ADDED,
-							VIR_DOMAIN_EVENT_CALLBACK(Callback::Plain::deviceConnect),
+							VIR_DOMAIN_EVENT_CALLBACK((&Callback::Defer<virConnectPtr, virDomainPtr, const char* >::react<&Callback::Plain::deviceConnect>)),
 							new Model::Coarse(v),
 							&Callback::Plain::delete_<Model::Coarse>);
 	m_eventDeviceDisconnect = virConnectDomainEventRegisterAny(libvirtd_.data(),
 							NULL,
 							VIR_DOMAIN_EVENT_ID_DEVICE_REMOVED,
-							VIR_DOMAIN_EVENT_CALLBACK(Callback::Plain::deviceDisconnect),
+							VIR_DOMAIN_EVENT_CALLBACK((&Callback::Defer<virConnectPtr, virDomainPtr, const char* >::react<&Callback::Plain::deviceDisconnect>)),
 							new Model::Coarse(v),
 							&Callback::Plain::delete_<Model::Coarse>);
 	m_eventTrayChange = virConnectDomainEventRegisterAny(libvirtd_.data(),
 							NULL,
 							VIR_DOMAIN_EVENT_ID_TRAY_CHANGE,
-							VIR_DOMAIN_EVENT_CALLBACK(Callback::Plain::trayChange),
+							VIR_DOMAIN_EVENT_CALLBACK((&Callback::Defer<virConnectPtr, virDomainPtr, const char* , int>::react<&Callback::Plain::trayChange>)),
 							new Model::Coarse(v),
 							&Callback::Plain::delete_<Model::Coarse>);
 	m_eventRtcChange = virConnectDomainEventRegisterAny(libvirtd_.data(),
 							NULL,
 							VIR_DOMAIN_EVENT_ID_RTC_CHANGE,
-							VIR_DOMAIN_EVENT_CALLBACK(Callback::Plain::rtcChange),
+							VIR_DOMAIN_EVENT_CALLBACK((&Callback::Defer<virConnectPtr, virDomainPtr, qint64>::react<&Callback::Plain::rtcChange>)),
 							new Model::Coarse(v),
 							&Callback::Plain::delete_<Model::Coarse>);
 	m_eventAgent = virConnectDomainEventRegisterAny(libvirtd_.data(),
 							NULL,
 							VIR_DOMAIN_EVENT_ID_AGENT_LIFECYCLE,
-							VIR_DOMAIN_EVENT_CALLBACK(&Callback::Plain::connectAgent),
+							VIR_DOMAIN_EVENT_CALLBACK((&Callback::Defer<virConnectPtr, virDomainPtr, int, int>::react<&Callback::Plain::connectAgent>)),
 							new Model::Coarse(v),
 							&Callback::Plain::delete_<Model::Coarse>);
 	m_eventNetworkLifecycle = virConnectNetworkEventRegisterAny(libvirtd_.data(),
 							NULL,
 							VIR_NETWORK_EVENT_ID_LIFECYCLE,
-							VIR_NETWORK_EVENT_CALLBACK(&Callback::Plain::networkLifecycle),
+							VIR_NETWORK_EVENT_CALLBACK((&Callback::Defer<virConnectPtr, virNetworkPtr, int, int>::react<&Callback::Plain::networkLifecycle>)),
 							new Model::Coarse(v),
 							&Callback::Plain::delete_<Model::Coarse>);
 	m_eventHardwareLifecycle = virConnectNodeDeviceEventRegisterAny(libvirtd_.data(),
@@ -2138,7 +2404,7 @@ void Domains::setConnected(QSharedPointer<virConnect> libvirtd_)
 	m_eventBJ = virConnectDomainEventRegisterAny(libvirtd_.data(),
 							NULL,
 							VIR_DOMAIN_EVENT_ID_BLOCK_JOB_2,
-							VIR_DOMAIN_EVENT_CALLBACK(Callback::Plain::blockjobCommit),
+							VIR_DOMAIN_EVENT_CALLBACK((&Callback::Defer<virConnectPtr, virDomainPtr, const char* , int, int>::react<&Callback::Plain::blockjobCommit>)),
 							new Model::Coarse(v),
 							&Callback::Plain::delete_<Model::Coarse>);
 
@@ -2477,6 +2743,16 @@ void Host::run()
 
 	QSharedPointer<Callback::Hub> h(new Callback::Hub());
 	Callback::g_access.setHub(h);
+	QSharedPointer<Callback::Native::Loop> n;
+	if (Callback::Native::Loop::isChosen())
+	{
+		n = QSharedPointer<Callback::Native::Loop>(new Callback::Native::Loop());
+		if (n->open())
+			Callback::g_access.setLoop(n);
+		else
+			n.clear();
+	}
+	WRITE_TRACE(DBG_INFO, "libvirt events run on the %s loop", n.isNull() ? "Qt" : "native");
 	virSetErrorFunc(NULL, &Callback::Plain::error);
 	virEventRegisterImpl(&Callback::Plain::addSocket,
 			&Callback::Plain::setSocket,
@@ -2487,6 +2763,8 @@ void Host::run()
 	exec();
 	a.setClosed();
 	B.getPool().waitForDone();
+	if (!n.isNull())
+		n->close();
 }
 
 namespace Instrument
@@ -41,6 +41,7 @@
 #include <boost/function.hpp>
 #include <boost/tuple/tuple.hpp>
 #include "CDspLibvirtQObject_p.h"
+#include "CDspLibvirtRecord.h"
 #include <boost/thread/future.hpp>
 #include <boost/signals2/signal.hpp>
 #include <prlxmlmodel/VtInfo/VtInfo.h>
@@ -221,17 +222,14 @@ struct Unit
 		getCpu() const;
 	Prl::Expected<Stat::CounterList_type, Error::Simple>
 		getVCpuList() const;
-	Prl::Expected<Stat::CounterList_type, Error::Simple>
-		getDisk(const CVmHardDisk& disk_) const;
+	const Values<Record::BLOCK_COUNT>* findDisk(const QString& name_) const;
 	Stat::CounterList_type getMemory() const;
-	Prl::Expected<Stat::CounterList_type, Error::Simple>
-		getInterface(const CVmGenericNetworkAdapter& iface_) const;
+	const Values<Record::NET_COUNT>* findInterface(const QString& name_) const;
 
 private:
-	bool getValue(const QString& name_, quint64& dst_) const;
-
 	pin_type m_pin;
 	const virDomainStatsRecord* m_record;
+	Record m_data;
 	QHash<QString, unsigned> m_ifaces;
 	QHash<QString, unsigned> m_disks;
 };
@@ -701,6 +699,7 @@ struct State: private Abstract
 	Result undefine();
 	Migration::Agent migrate(const QString& uri_);
 	Result getValue(VIRTUAL_MACHINE_STATE& dst_) const;
+	static VIRTUAL_MACHINE_STATE translate(int state_, int reason_);
 
 private:
 	Result start_(unsigned int flags_);
@@ -844,6 +843,7 @@ struct List
 	Unit at(const QString& uuid_) const;
 	Grub getGrub(const CVmConfiguration& image_);
 	Result all(QList<Unit>& dst_);
+	Result getState(QHash<QString, VIRTUAL_MACHINE_STATE>& dst_);
 	QList<Performance::Unit> getPerformance();
 
 private:
@@ -455,32 +455,30 @@ Result State::getValue(VIRTUAL_MACHINE_STATE& dst_) const
 	if (-1 == virDomainGetState(getDomain().data(), &s, &r, 0))
 		return Failure(PRL_ERR_VM_GET_STATUS_FAILED);
 
-	switch (s)
+	dst_ = translate(s, r);
+	return Result();
+}
+
+VIRTUAL_MACHINE_STATE State::translate(int state_, int reason_)
+{
+	switch (state_)
 	{
 	case VIR_DOMAIN_RUNNING:
-		dst_ = VMS_RUNNING;
-		break;
+		return VMS_RUNNING;
 	case VIR_DOMAIN_PAUSED:
 	case VIR_DOMAIN_PMSUSPENDED:
-		dst_ = VMS_PAUSED;
-		break;
+		return VMS_PAUSED;
 	case VIR_DOMAIN_CRASHED:
-		if (r == VIR_DOMAIN_CRASHED_PANICKED)
-		{
-			dst_ = VMS_PAUSED;
-			break;
-		}
+		if (reason_ == VIR_DOMAIN_CRASHED_PANICKED)
+			return VMS_PAUSED;
 	case VIR_DOMAIN_SHUTDOWN:
 		// is being shutdown, but not yet stopped
-		dst_ = VMS_RUNNING;
-		break;
+		return VMS_RUNNING;
 	case VIR_DOMAIN_SHUTOFF:
-		dst_ = VMS_STOPPED;
-		break;
+		return VMS_STOPPED;
 	default:
-		dst_ = VMS_UNKNOWN;
+		return VMS_UNKNOWN;
 	}
-	return Result();
 }
 
 Migration::Agent State::migrate(const QString &uri_)
@@ -691,24 +689,16 @@ Unit::Unit(const virDomainStatsRecordPtr record_, const pin_type& pin_):
 	if (NULL == record_)
 		return;
 
-	const char* s = NULL;
-
-	unsigned nets = 0;
-	virTypedParamsGetUInt(record_->params, record_->nparams, "net.count", &nets);
-	for(unsigned i = 0; i < nets; ++i)
+	m_data.decode(record_->params, record_->nparams);
+	for (int i = 0; i < m_data.net.size(); ++i)
 	{
-		QString t = QString("net.%1.name").arg(i);
-		if (1 == virTypedParamsGetString(record_->params, record_->nparams, qPrintable(t), &s))
-			m_ifaces[QString(s)] = i;
+		if (!m_data.net[i].name.isEmpty())
+			m_ifaces[m_data.net[i].name] = i;
 	}
-
-	unsigned disks = 0;
-	virTypedParamsGetUInt(record_->params, record_->nparams, "block.count", &disks);
-	for(unsigned i = 0; i < disks; ++i)
+	for (int i = 0; i < m_data.block.size(); ++i)
 	{
-		QString t = QString("block.%1.path").arg(i);
-		if (1 == virTypedParamsGetString(record_->params, record_->nparams, qPrintable(t), &s))
-			m_disks[QString(s)] = i;
+		if (!m_data.block[i].name.isEmpty())
+			m_disks[m_data.block[i].name] = i;
 	}
 }
 
@@ -723,7 +713,7 @@ Unit::getCpu() const
 {
 	quint64 s = 0;
 	Stat::CounterList_type r;
-	if (getValue("cpu.time", s))
+	if (m_data.cpu.get(Record::CPU_TIME, s))
 		r.append(Stat::Counter_type(::Stat::Name::Cpu::getName(), s / 1000));
 
 	return r;
@@ -734,108 +724,81 @@ Unit::getVCpuList() const
 {
 	Stat::CounterList_type r;
 
-	unsigned count = 0;
-	if (1 != virTypedParamsGetUInt(m_record->params, m_record->nparams, "vcpu.current", &count))
+	if (!m_data.vcpuCurrent)
 	{
 		WRITE_TRACE(DBG_DEBUG, "no vcpu statistics");
 		return r;
 	}
 
+	unsigned count = qMin<unsigned>(m_data.vcpuCurrent.get(), m_data.vcpu.size());
 	for (unsigned i = 0; i < count; i++)
 	{
 		quint64 time;
-		if (getValue(QString("vcpu.%1.time").arg(i), time))
+		if (m_data.vcpu[i].get(Record::VCPU_TIME, time))
 			r.append(Stat::Counter_type(::Stat::Name::VCpu::getName(i), time));
 	}
 	return r;
 }
 
-Prl::Expected<Stat::CounterList_type, Error::Simple>
-Unit::getDisk(const CVmHardDisk& disk_) const
+const Values<Record::BLOCK_COUNT>* Unit::findDisk(const QString& name_) const
 {
-	Stat::CounterList_type r;
-
-	if (!m_disks.contains(disk_.getSystemName()))
+	QHash<QString, unsigned>::const_iterator p = m_disks.constFind(name_);
+	if (m_disks.constEnd() == p)
 	{
-		WRITE_TRACE(DBG_DEBUG, "no statistics for %s", qPrintable(disk_.getSystemName()));
-		return r;
+		WRITE_TRACE(DBG_DEBUG, "no statistics for %s", qPrintable(name_));
+		return NULL;
 	}
 
-	unsigned n = m_disks[disk_.getSystemName()];
-	QString block = QString("block.%1.%2").arg(n);
-
-	quint64 value = 0;
-	if (getValue(block.arg("wr.reqs"), value))
-		r.append(Stat::Counter_type(::Stat::Name::Hdd::getWriteRequests(disk_), value));
-
-	if (getValue(block.arg("wr.bytes"), value))
-		r.append(Stat::Counter_type(::Stat::Name::Hdd::getWriteTotal(disk_), value));
-
-	if (getValue(block.arg("rd.reqs"), value))
-		r.append(Stat::Counter_type(::Stat::Name::Hdd::getReadRequests(disk_), value));
-
-	if (getValue(block.arg("rd.bytes"), value))
-		r.append(Stat::Counter_type(::Stat::Name::Hdd::getReadTotal(disk_), value));
-
-	if (getValue(block.arg("capacity"), value))
-		r.append(Stat::Counter_type(::Stat::Name::Hdd::getCapacity(disk_), value));
-
-	if (getValue(block.arg("allocation"), value))
-		r.append(Stat::Counter_type(::Stat::Name::Hdd::getAllocation(disk_), value));
-
-	if (getValue(block.arg("physical"), value))
-		r.append(Stat::Counter_type(::Stat::Name::Hdd::getPhysical(disk_), value));
-
-	return r;
+	return &m_data.block[p.value()].values;
 }
 
 Stat::CounterList_type Unit::getMemory() const
 {
 	quint64 v = 0;
 	Stat::CounterList_type output;
-	if (getValue("balloon.current", v = 0))
+	if (m_data.balloon.get(Record::BALLOON_CURRENT, v = 0))
 	{
 		output.append(Stat::Counter_type(
 			::Stat::Name::Memory::getBalloonActual(), v));
 	}
-	if (getValue("balloon.swap_in", v = 0))
+	if (m_data.balloon.get(Record::BALLOON_SWAP_IN, v = 0))
 	{
 		output.append(Stat::Counter_type(
 			::Stat::Name::Memory::getSwapIn(), v));
 	}
-	if (getValue("balloon.swap_out", v = 0))
+	if (m_data.balloon.get(Record::BALLOON_SWAP_OUT, v = 0))
 	{
 		output.append(Stat::Counter_type(
 			::Stat::Name::Memory::getSwapOut(), v));
 	}
-	if (getValue("balloon.minor_fault", v = 0))
+	if (m_data.balloon.get(Record::BALLOON_MINOR_FAULT, v = 0))
 	{
 		output.append(Stat::Counter_type(
 			::Stat::Name::Memory::getMinorFault(), v));
 	}
-	if (getValue("balloon.major_fault", v = 0))
+	if (m_data.balloon.get(Record::BALLOON_MAJOR_FAULT, v = 0))
 	{
 		output.append(Stat::Counter_type(
 			::Stat::Name::Memory::getMajorFault(), v));
 	}
 	quint64 total = 0;
-	if (getValue("balloon.maximum", total))
+	if (m_data.balloon.get(Record::BALLOON_MAXIMUM, total))
 	{
 		output.append(Stat::Counter_type(
 			::Stat::Name::Memory::getTotal(), total));
 	}
-	if (getValue("balloon.usable", v = 0))
+	if (m_data.balloon.get(Record::BALLOON_USABLE, v = 0))
 	{
 		output.append(Stat::Counter_type(
 			::Stat::Name::Memory::getAvailable(), v));
 	}
-	if (getValue("balloon.unused", v = 0))
+	if (m_data.balloon.get(Record::BALLOON_UNUSED, v = 0))
 	{
 		// new balloon: used = maximum - unused
 		output.append(Stat::Counter_type(
 			::Stat::Name::Memory::getUsed(), total - v));
 	}
-	else if (getValue("balloon.rss", v = 0))
+	else if (m_data.balloon.get(Record::BALLOON_RSS, v = 0))
 	{
 		// old balloon: used = rss
 		output.append(Stat::Counter_type(
@@ -844,39 +807,16 @@ Stat::CounterList_type Unit::getMemory() const
 	return output;
 }
 
-Prl::Expected<Stat::CounterList_type, Error::Simple>
-Unit::getInterface(const CVmGenericNetworkAdapter& iface_) const
+const Values<Record::NET_COUNT>* Unit::findInterface(const QString& name_) const
 {
-	Stat::CounterList_type r;
-
-	if (!m_ifaces.contains(iface_.getHostInterfaceName()))
+	QHash<QString, unsigned>::const_iterator p = m_ifaces.constFind(name_);
+	if (m_ifaces.constEnd() == p)
 	{
-		WRITE_TRACE(DBG_DEBUG, "no statistics for %s", qPrintable(iface_.getHostInterfaceName()));
-		return r;
+		WRITE_TRACE(DBG_DEBUG, "no statistics for %s", qPrintable(name_));
+		return NULL;
 	}
 
-	unsigned n = m_ifaces[iface_.getHostInterfaceName()];
-	QString iface = QString("net.%1.%2").arg(n);
-
-	quint64 value = 0;
-	if (getValue(iface.arg("rx.bytes"), value))
-		r.append(Stat::Counter_type(::Stat::Name::Interface::getBytesIn(iface_), value));
-
-	if (getValue(iface.arg("rx.pkts"), value))
-		r.append(Stat::Counter_type(::Stat::Name::Interface::getPacketsIn(iface_), value));
-
-	if (getValue(iface.arg("tx.bytes"), value))
-		r.append(Stat::Counter_type(::Stat::Name::Interface::getBytesOut(iface_), value));
-
-	if (getValue(iface.arg("tx.pkts"), value))
-		r.append(Stat::Counter_type(::Stat::Name::Interface::getPacketsOut(iface_), value));
-
-	return r;
-}
-
-bool Unit::getValue(const QString& name_, quint64& dst_) const
-{
-	return 1 == virTypedParamsGetULLong(m_record->params, m_record->nparams, qPrintable(name_), &dst_);
+	return &m_data.net[p.value()].values;
 }
 
 } // namespace Performance
@@ -2179,6 +2119,33 @@ Result List::all(QList<Unit>& dst_)
 	return Result();
 }
 
+Result List::getState(QHash<QString, VIRTUAL_MACHINE_STATE>& dst_)
+{
+	if (m_link.isNull())
+		return Result(Error::Simple(PRL_ERR_CANT_CONNECT_TO_DISPATCHER));
+
+	virDomainStatsRecordPtr* s = NULL;
+	int z = virConnectGetAllDomainStats(m_link.data(), VIR_DOMAIN_STATS_STATE,
+					&s, VIR_CONNECT_GET_ALL_DOMAINS_STATS_PERSISTENT);
+	if (0 > z)
+		return Failure(PRL_ERR_VM_GET_STATUS_FAILED);
+
+	for (int i = 0; i < z; ++i)
+	{
+		int v = VIR_DOMAIN_NOSTATE, r = 0;
+		if (1 != virTypedParamsGetInt(s[i]->params, s[i]->nparams, "state.state", &v))
+			continue;
+
+		virTypedParamsGetInt(s[i]->params, s[i]->nparams, "state.reason", &r);
+		QString u;
+		virDomainRef(s[i]->dom);
+		if (Unit(s[i]->dom).getUuid(u).isSucceed())
+			dst_[u] = Limb::State::translate(v, r);
+	}
+	virDomainStatsRecordListFree(s);
+	return Result();
+}
+
 QList<Performance::Unit> List::getPerformance()
 {
 	QList<Performance::Unit> output;
@@ -0,0 +1,485 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @file CDspLibvirtLoop.cpp
+///
+/// Native libvirt event loop on epoll and timerfd.
+///
+/// Copyright (c) 2017-2023 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "CDspLibvirtLoop.h"
+#include <ctime>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <sys/eventfd.h>
+#include <QMutexLocker>
+#include <prlcommon/Logging/Logging.h>
+
+namespace Libvirt
+{
+namespace Callback
+{
+namespace Native
+{
+namespace
+{
+enum
+{
+	EVENTS = 32
+};
+
+// the clock of the timerfd in microseconds
+quint64 now()
+{
+	struct timespec t;
+	::clock_gettime(CLOCK_MONOTONIC, &t);
+	return quint64(t.tv_sec) * 1000000 + t.tv_nsec / 1000;
+}
+
+quint64 later(int interval_)
+{
+	return now() + quint64(interval_) * 1000;
+}
+
+quint32 toEpoll(int events_)
+{
+	quint32 output = 0;
+	if (VIR_EVENT_HANDLE_READABLE & events_)
+		output |= EPOLLIN;
+	if (VIR_EVENT_HANDLE_WRITABLE & events_)
+		output |= EPOLLOUT;
+	if (VIR_EVENT_HANDLE_ERROR & events_)
+		output |= EPOLLERR;
+	if (VIR_EVENT_HANDLE_HANGUP & events_)
+		output |= EPOLLHUP;
+
+	return output;
+}
+
+int fromEpoll(quint32 events_)
+{
+	int output = 0;
+	if (EPOLLIN & events_)
+		output |= VIR_EVENT_HANDLE_READABLE;
+	if (EPOLLOUT & events_)
+		output |= VIR_EVENT_HANDLE_WRITABLE;
+	if (EPOLLERR & events_)
+		output |= VIR_EVENT_HANDLE_ERROR;
+	if (EPOLLHUP & events_)
+		output |= VIR_EVENT_HANDLE_HANGUP;
+
+	return output;
+}
+
+void drop(int& fd_)
+{
+	if (0 <= fd_)
+		::close(fd_);
+
+	fd_ = -1;
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Histogram
+
+Histogram::Histogram(): m_count(), m_sum(), m_max(), m_bucket()
+{
+}
+
+int Histogram::locate(quint64 value_)
+{
+	if (value_ < (Q_UINT64_C(1) << SHIFT))
+		return 0;
+
+	int b = 63 - __builtin_clzll(value_);
+	return qMin(b - SHIFT + 1, int(SIZE) - 1);
+}
+
+void Histogram::account(quint64 value_)
+{
+	++m_count;
+	m_sum += value_;
+	m_max = qMax(m_max, value_);
+	++m_bucket[locate(value_)];
+}
+
+QString Histogram::toString() const
+{
+	if (0 == m_count)
+		return QString("no events");
+
+	QString output = QString("%1 events, mean %2us, max %3us:")
+		.arg(m_count).arg(m_sum / m_count).arg(m_max);
+	for (int i = 0; i < SIZE; ++i)
+	{
+		if (0 == m_bucket[i])
+			continue;
+
+		QString b = SIZE - 1 == i ?
+			QString(" >=%1us").arg(Q_UINT64_C(1) << (SHIFT + i - 1)) :
+			QString(" <%1us").arg(Q_UINT64_C(1) << (SHIFT + i));
+		output += b + QString(" %1").arg(m_bucket[i]);
+	}
+	return output;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Loop
+
+Loop::Loop(): m_stop(true), m_epoll(-1), m_timer(-1), m_wake(-1)
+{
+}
+
+Loop::~Loop()
+{
+	close();
+}
+
+bool Loop::isChosen()
+{
+	return 0 == qstrcmp(::getenv(VZ_LIBVIRT_EVENT_LOOP_ENV), "native");
+}
+
+bool Loop::open()
+{
+	QMutexLocker g(&m_mutex);
+	m_epoll = ::epoll_create1(EPOLL_CLOEXEC);
+	m_timer = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	m_wake = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	int x[] = {m_timer, m_wake};
+	for (unsigned i = 0; i < sizeof(x) / sizeof(x[0]) && 0 <= m_epoll; ++i)
+	{
+		struct epoll_event e;
+		::memset(&e, 0, sizeof(e));
+		e.events = EPOLLIN;
+		e.data.fd = x[i];
+		if (0 > x[i] || 0 != ::epoll_ctl(m_epoll, EPOLL_CTL_ADD, x[i], &e))
+			drop(m_epoll);
+	}
+	if (0 > m_epoll)
+	{
+		WRITE_TRACE(DBG_FATAL, "Cannot create the libvirt event loop: %m");
+		drop(m_timer);
+		drop(m_wake);
+		return false;
+	}
+	m_stop = false;
+	start();
+	return true;
+}
+
+void Loop::close()
+{
+	{
+		QMutexLocker g(&m_mutex);
+		m_stop = true;
+		wake();
+	}
+	wait();
+
+	QMutexLocker g(&m_mutex);
+	foreach (const Socket& s, m_sockets)
+	{
+		if (NULL != s.free)
+			m_garbage << garbage_type(s.opaque, s.free);
+	}
+	foreach (const Timeout& t, m_timeouts)
+	{
+		if (NULL != t.free)
+			m_garbage << garbage_type(t.opaque, t.free);
+	}
+	m_sockets.clear();
+	m_timeouts.clear();
+	m_watched.clear();
+	drop(m_epoll);
+	drop(m_timer);
+	drop(m_wake);
+	g.unlock();
+	sweep();
+}
+
+bool Loop::add(int id_, int socket_, int events_, virEventHandleCallback callback_,
+	void* opaque_, virFreeCallback free_)
+{
+	QMutexLocker g(&m_mutex);
+	if (m_stop)
+		return false;
+
+	Socket s = {socket_, events_, callback_, opaque_, free_};
+	m_sockets.insert(id_, s);
+	watch(socket_);
+	return true;
+}
+
+bool Loop::add(int id_, int interval_, virEventTimeoutCallback callback_,
+	void* opaque_, virFreeCallback free_)
+{
+	QMutexLocker g(&m_mutex);
+	if (m_stop)
+		return false;
+
+	Timeout t = {interval_, later(interval_), callback_, opaque_, free_};
+	m_timeouts.insert(id_, t);
+	wake();
+	return true;
+}
+
+void Loop::setEvents(int id_, int value_)
+{
+	QMutexLocker g(&m_mutex);
+	QHash<int, Socket>::iterator p = m_sockets.find(id_);
+	if (m_sockets.end() == p)
+		return;
+
+	p->events = value_;
+	watch(p->socket);
+}
+
+void Loop::setInterval(int id_, int value_)
+{
+	QMutexLocker g(&m_mutex);
+	QHash<int, Timeout>::iterator p = m_timeouts.find(id_);
+	if (m_timeouts.end() == p)
+		return;
+
+	p->interval = value_;
+	p->deadline = later(value_);
+	wake();
+}
+
+int Loop::remove(int id_)
+{
+	QMutexLocker g(&m_mutex);
+	QHash<int, Socket>::iterator a = m_sockets.find(id_);
+	if (m_sockets.end() != a)
+	{
+		Socket s = a.value();
+		m_sockets.erase(a);
+		watch(s.socket);
+		if (NULL != s.free)
+			m_garbage << garbage_type(s.opaque, s.free);
+
+		wake();
+		return 0;
+	}
+	QHash<int, Timeout>::iterator b = m_timeouts.find(id_);
+	if (m_timeouts.end() != b)
+	{
+		Timeout t = b.value();
+		m_timeouts.erase(b);
+		if (NULL != t.free)
+			m_garbage << garbage_type(t.opaque, t.free);
+
+		wake();
+		return 0;
+	}
+	return -1;
+}
+
+void Loop::run()
+{
+	struct epoll_event e[EVENTS];
+	forever
+	{
+		{
+			QMutexLocker g(&m_mutex);
+			if (m_stop)
+				break;
+
+			arm();
+		}
+		int n = ::epoll_wait(m_epoll, e, EVENTS, -1);
+		if (0 > n)
+		{
+			if (EINTR == errno)
+				continue;
+
+			WRITE_TRACE(DBG_FATAL, "The libvirt event loop failed: %m");
+			break;
+		}
+		for (int i = 0; i < n; ++i)
+		{
+			quint64 x;
+			int f = e[i].data.fd;
+			if (f == m_wake || f == m_timer)
+			{
+				ssize_t r = ::read(f, &x, sizeof(x));
+				Q_UNUSED(r);
+			}
+			else
+				dispatch(f, e[i].events);
+		}
+		expire();
+		sweep();
+	}
+	sweep();
+}
+
+// NB. the lock is held by the caller
+void Loop::watch(int socket_)
+{
+	quint32 m = 0;
+	foreach (const Socket& s, m_sockets)
+	{
+		if (s.socket == socket_)
+			m |= toEpoll(s.events);
+	}
+	struct epoll_event e;
+	::memset(&e, 0, sizeof(e));
+	e.events = m;
+	e.data.fd = socket_;
+	QHash<int, quint32>::iterator p = m_watched.find(socket_);
+	if (m_watched.end() == p)
+	{
+		if (0 == m)
+			return;
+		if (0 == ::epoll_ctl(m_epoll, EPOLL_CTL_ADD, socket_, &e))
+			m_watched.insert(socket_, m);
+		else
+			WRITE_TRACE(DBG_FATAL, "Cannot watch the socket %d: %m", socket_);
+	}
+	else if (0 == m)
+	{
+		// the socket may be closed already
+		::epoll_ctl(m_epoll, EPOLL_CTL_DEL, socket_, &e);
+		m_watched.erase(p);
+	}
+	else if (p.value() != m)
+	{
+		if (0 != ::epoll_ctl(m_epoll, EPOLL_CTL_MOD, socket_, &e))
+			WRITE_TRACE(DBG_FATAL, "Cannot change the socket %d: %m", socket_);
+
+		p.value() = m;
+	}
+}
+
+// NB. the lock is held by the caller
+void Loop::arm()
+{
+	quint64 d = 0;
+	foreach (const Timeout& t, m_timeouts)
+	{
+		if (0 <= t.interval && (0 == d || t.deadline < d))
+			d = qMax<quint64>(t.deadline, 1);
+	}
+	// the zero value disarms the timer, an overdue one fires at once
+	struct itimerspec s;
+	::memset(&s, 0, sizeof(s));
+	s.it_value.tv_sec = d / 1000000;
+	s.it_value.tv_nsec = (d % 1000000) * 1000;
+	::timerfd_settime(m_timer, TFD_TIMER_ABSTIME, &s, NULL);
+}
+
+// NB. the lock is held by the caller
+void Loop::wake()
+{
+	if (0 > m_wake || QThread::currentThread() == this)
+		return;
+
+	quint64 x = 1;
+	ssize_t r = ::write(m_wake, &x, sizeof(x));
+	Q_UNUSED(r);
+}
+
+void Loop::dispatch(int socket_, quint32 events_)
+{
+	QList<int> x;
+	{
+		QMutexLocker g(&m_mutex);
+		QHash<int, Socket>::const_iterator p, e = m_sockets.constEnd();
+		for (p = m_sockets.constBegin(); p != e; ++p)
+		{
+			if (p->socket == socket_)
+				x << p.key();
+		}
+	}
+	int v = fromEpoll(events_);
+	foreach (int i, x)
+	{
+		Socket s;
+		{
+			// a previous callback may have removed this one
+			QMutexLocker g(&m_mutex);
+			QHash<int, Socket>::const_iterator p = m_sockets.constFind(i);
+			if (m_sockets.constEnd() == p)
+				continue;
+
+			s = p.value();
+		}
+		int m = v & (s.events | VIR_EVENT_HANDLE_ERROR | VIR_EVENT_HANDLE_HANGUP);
+		if (0 != m)
+			s.callback(i, s.socket, m, s.opaque);
+	}
+}
+
+void Loop::expire()
+{
+	QList<int> x;
+	quint64 n = now();
+	{
+		QMutexLocker g(&m_mutex);
+		QHash<int, Timeout>::const_iterator p, e = m_timeouts.constEnd();
+		for (p = m_timeouts.constBegin(); p != e; ++p)
+		{
+			if (0 <= p->interval && p->deadline <= n)
+				x << p.key();
+		}
+	}
+	foreach (int i, x)
+	{
+		Timeout t;
+		{
+			QMutexLocker g(&m_mutex);
+			QHash<int, Timeout>::iterator p = m_timeouts.find(i);
+			if (m_timeouts.end() == p || 0 > p->interval)
+				continue;
+
+			p->deadline = n + quint64(p->interval) * 1000;
+			t = p.value();
+		}
+		t.callback(i, t.opaque);
+	}
+}
+
+void Loop::sweep()
+{
+	QList<garbage_type> x;
+	{
+		QMutexLocker g(&m_mutex);
+		x.swap(m_garbage);
+	}
+	foreach (const garbage_type& g, x)
+	{
+		g.second(g.first);
+	}
+}
+
+} // namespace Native
+} // namespace Callback
+} // namespace Libvirt
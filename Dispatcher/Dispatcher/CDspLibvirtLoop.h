@@ -0,0 +1,152 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @file CDspLibvirtLoop.h
+///
+/// Native libvirt event loop on epoll and timerfd.
+///
+/// Copyright (c) 2017-2023 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __CDSPLIBVIRTLOOP_H__
+#define __CDSPLIBVIRTLOOP_H__
+
+#include <QHash>
+#include <QList>
+#include <QPair>
+#include <QMutex>
+#include <QString>
+#include <QThread>
+#include <libvirt/libvirt.h>
+
+// set to "native" to run the libvirt events on the epoll loop instead of
+// the Qt event loop of the libvirt host thread
+#define VZ_LIBVIRT_EVENT_LOOP_ENV "VZ_LIBVIRT_EVENT_LOOP"
+
+namespace Libvirt
+{
+namespace Callback
+{
+namespace Native
+{
+///////////////////////////////////////////////////////////////////////////////
+// struct Histogram
+
+struct Histogram
+{
+	// the first bucket holds latencies below 2^SHIFT us, every next one
+	// doubles the bound, the last one holds the rest
+	enum
+	{
+		SHIFT = 7,
+		SIZE = 16
+	};
+
+	Histogram();
+
+	void account(quint64 value_);
+	void reset()
+	{
+		*this = Histogram();
+	}
+	quint64 getCount() const
+	{
+		return m_count;
+	}
+	quint64 getBucket(int index_) const
+	{
+		return m_bucket[index_];
+	}
+	static int locate(quint64 value_);
+	QString toString() const;
+
+private:
+	quint64 m_count;
+	quint64 m_sum;
+	quint64 m_max;
+	quint64 m_bucket[SIZE];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Loop
+
+struct Loop: QThread
+{
+	Loop();
+	~Loop();
+
+	static bool isChosen();
+	bool open();
+	void close();
+	bool add(int id_, int socket_, int events_, virEventHandleCallback callback_,
+		void* opaque_, virFreeCallback free_);
+	bool add(int id_, int interval_, virEventTimeoutCallback callback_,
+		void* opaque_, virFreeCallback free_);
+	void setEvents(int id_, int value_);
+	void setInterval(int id_, int value_);
+	int remove(int id_);
+
+protected:
+	void run();
+
+private:
+	struct Socket
+	{
+		int socket;
+		int events;
+		virEventHandleCallback callback;
+		void* opaque;
+		virFreeCallback free;
+	};
+	struct Timeout
+	{
+		int interval;
+		quint64 deadline;
+		virEventTimeoutCallback callback;
+		void* opaque;
+		virFreeCallback free;
+	};
+	typedef QPair<void*, virFreeCallback> garbage_type;
+
+	void watch(int socket_);
+	void arm();
+	void wake();
+	void dispatch(int socket_, quint32 events_);
+	void expire();
+	void sweep();
+
+	QMutex m_mutex;
+	bool m_stop;
+	int m_epoll;
+	int m_timer;
+	int m_wake;
+	QHash<int, Socket> m_sockets;
+	QHash<int, Timeout> m_timeouts;
+	QHash<int, quint32> m_watched;
+	QList<garbage_type> m_garbage;
+};
+
+} // namespace Native
+} // namespace Callback
+} // namespace Libvirt
+
+#endif // __CDSPLIBVIRTLOOP_H__
@@ -98,6 +98,7 @@ struct Hub: QObject
 	Q_INVOKABLE virtual void setEvents(int id_, int value_) = 0;
 	Q_INVOKABLE virtual void setInterval(int id_, int value_) = 0;
 	Q_INVOKABLE virtual void setOpaque(int id_, Transport::Visitor* value_) = 0;
+	Q_INVOKABLE virtual void drain() = 0;
 
 private:
 	Q_OBJECT
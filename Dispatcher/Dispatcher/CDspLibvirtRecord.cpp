@@ -0,0 +1,174 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @file CDspLibvirtRecord.cpp
+///
+/// Decoder of the libvirt domain statistics records.
+///
+/// Copyright (c) 2017-2023 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "CDspLibvirtRecord.h"
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+
+namespace Libvirt
+{
+namespace Instrument
+{
+namespace Agent
+{
+namespace Vm
+{
+namespace Performance
+{
+namespace
+{
+// the order follows the leaf enums of the Record
+const char* const s_block[Record::BLOCK_COUNT] =
+{
+	"rd.reqs", "rd.bytes", "wr.reqs", "wr.bytes",
+	"capacity", "allocation", "physical"
+};
+
+const char* const s_net[Record::NET_COUNT] =
+{
+	"rx.bytes", "rx.pkts", "tx.bytes", "tx.pkts"
+};
+
+const char* const s_balloon[Record::BALLOON_COUNT] =
+{
+	"current", "maximum", "swap_in", "swap_out", "minor_fault",
+	"major_fault", "usable", "unused", "rss"
+};
+
+template<int N>
+int lookup(const char* leaf_, const char* const (&table_)[N])
+{
+	for (int i = 0; i < N; ++i)
+	{
+		if (0 == ::strcmp(leaf_, table_[i]))
+			return i;
+	}
+	return -1;
+}
+
+// returns the rest of the field after the prefix or NULL
+const char* skip(const char* field_, const char* prefix_)
+{
+	std::size_t n = ::strlen(prefix_);
+	return 0 == ::strncmp(field_, prefix_, n) ? field_ + n : NULL;
+}
+
+// parses "<index>.<leaf>" and returns the leaf or NULL
+const char* split(const char* field_, unsigned& index_)
+{
+	if (!::isdigit(*field_))
+		return NULL;
+
+	char* e = NULL;
+	index_ = ::strtoul(field_, &e, 10);
+	return '.' == *e ? e + 1 : NULL;
+}
+
+// an index can not exceed the number of params of a sane record
+template<class T>
+T* expand(QVector<T>& dst_, unsigned index_, int limit_)
+{
+	if (index_ >= unsigned(limit_))
+		return NULL;
+
+	if (dst_.size() <= int(index_))
+		dst_.resize(index_ + 1);
+
+	return &dst_[index_];
+}
+
+template<int N>
+void assign(Values<N>& dst_, int leaf_, const virTypedParameter& src_)
+{
+	if (0 <= leaf_ && VIR_TYPED_PARAM_ULLONG == src_.type)
+		dst_.set(leaf_, src_.value.ul);
+}
+
+template<int N>
+void assign(Device<N>& dst_, const char* leaf_, const char* tag_,
+	const char* const (&table_)[N], const virTypedParameter& src_)
+{
+	if (0 != ::strcmp(leaf_, tag_))
+		assign(dst_.values, lookup(leaf_, table_), src_);
+	else if (VIR_TYPED_PARAM_STRING == src_.type)
+		dst_.name = QString::fromUtf8(src_.value.s);
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Record
+
+void Record::decode(const virTypedParameter* params_, int count_)
+{
+	for (int i = 0; i < count_; ++i)
+	{
+		const virTypedParameter& p = params_[i];
+		const char* f = NULL;
+		const char* l = NULL;
+		unsigned n = 0;
+		if (NULL != (f = skip(p.field, "cpu.")))
+			assign(cpu, 0 == ::strcmp(f, "time") ? int(CPU_TIME) : -1, p);
+		else if (NULL != (f = skip(p.field, "balloon.")))
+			assign(balloon, lookup(f, s_balloon), p);
+		else if (NULL != (f = skip(p.field, "vcpu.")))
+		{
+			if (0 == ::strcmp(f, "current"))
+			{
+				if (VIR_TYPED_PARAM_UINT == p.type)
+					vcpuCurrent = p.value.ui;
+			}
+			else if (NULL != (l = split(f, n)) && 0 == ::strcmp(l, "time"))
+			{
+				Values<VCPU_COUNT>* v = expand(vcpu, n, count_);
+				if (NULL != v)
+					assign(*v, VCPU_TIME, p);
+			}
+		}
+		else if (NULL != (f = skip(p.field, "block.")) && NULL != (l = split(f, n)))
+		{
+			block_type* b = expand(block, n, count_);
+			if (NULL != b)
+				assign(*b, l, "path", s_block, p);
+		}
+		else if (NULL != (f = skip(p.field, "net.")) && NULL != (l = split(f, n)))
+		{
+			net_type* x = expand(net, n, count_);
+			if (NULL != x)
+				assign(*x, l, "name", s_net, p);
+		}
+	}
+}
+
+} // namespace Performance
+} // namespace Vm
+} // namespace Agent
+} // namespace Instrument
+} // namespace Libvirt
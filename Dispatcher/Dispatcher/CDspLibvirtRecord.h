@@ -0,0 +1,156 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @file CDspLibvirtRecord.h
+///
+/// Decoder of the libvirt domain statistics records.
+///
+/// Copyright (c) 2017-2023 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __CDSPLIBVIRTRECORD_H__
+#define __CDSPLIBVIRTRECORD_H__
+
+#include <QString>
+#include <QVector>
+#include <boost/optional.hpp>
+#include <libvirt/libvirt.h>
+
+namespace Libvirt
+{
+namespace Instrument
+{
+namespace Agent
+{
+namespace Vm
+{
+namespace Performance
+{
+///////////////////////////////////////////////////////////////////////////////
+// struct Values
+
+template<int N>
+struct Values
+{
+	Values(): m_mask()
+	{
+	}
+
+	bool get(int leaf_, quint64& dst_) const
+	{
+		if (0 == (m_mask & (1u << leaf_)))
+			return false;
+
+		dst_ = m_value[leaf_];
+		return true;
+	}
+	void set(int leaf_, quint64 value_)
+	{
+		m_mask |= 1u << leaf_;
+		m_value[leaf_] = value_;
+	}
+
+private:
+	quint32 m_mask;
+	quint64 m_value[N];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Device
+
+template<int N>
+struct Device
+{
+	QString name;
+	Values<N> values;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Record
+// Counters of a domain stats record decoded in one pass over its params.
+// Devices are kept by their libvirt index.
+
+struct Record
+{
+	enum
+	{
+		CPU_TIME,
+		CPU_COUNT
+	};
+	enum
+	{
+		VCPU_TIME,
+		VCPU_COUNT
+	};
+	enum
+	{
+		BLOCK_RD_REQS,
+		BLOCK_RD_BYTES,
+		BLOCK_WR_REQS,
+		BLOCK_WR_BYTES,
+		BLOCK_CAPACITY,
+		BLOCK_ALLOCATION,
+		BLOCK_PHYSICAL,
+		BLOCK_COUNT
+	};
+	enum
+	{
+		NET_RX_BYTES,
+		NET_RX_PKTS,
+		NET_TX_BYTES,
+		NET_TX_PKTS,
+		NET_COUNT
+	};
+	enum
+	{
+		BALLOON_CURRENT,
+		BALLOON_MAXIMUM,
+		BALLOON_SWAP_IN,
+		BALLOON_SWAP_OUT,
+		BALLOON_MINOR_FAULT,
+		BALLOON_MAJOR_FAULT,
+		BALLOON_USABLE,
+		BALLOON_UNUSED,
+		BALLOON_RSS,
+		BALLOON_COUNT
+	};
+
+	typedef Device<BLOCK_COUNT> block_type;
+	typedef Device<NET_COUNT> net_type;
+
+	void decode(const virTypedParameter* params_, int count_);
+
+	Values<CPU_COUNT> cpu;
+	boost::optional<unsigned> vcpuCurrent;
+	QVector<Values<VCPU_COUNT> > vcpu;
+	QVector<block_type> block;
+	QVector<net_type> net;
+	Values<BALLOON_COUNT> balloon;
+};
+
+} // namespace Performance
+} // namespace Vm
+} // namespace Agent
+} // namespace Instrument
+} // namespace Libvirt
+
+#endif // __CDSPLIBVIRTRECORD_H__
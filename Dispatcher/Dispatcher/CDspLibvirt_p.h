@@ -43,9 +43,11 @@
 #include <prlcommon/Std/SmartPtr.h>
 #include <prlcommon/Std/noncopyable.h>
 #include <boost/ptr_container/ptr_map.hpp>
+#include <boost/lockfree/queue.hpp>
 #include <libvirt/libvirt.h>
 #include <libvirt/virterror.h>
 #include <libvirt/libvirt-qemu.h>
+#include "CDspLibvirtLoop.h"
 #include <Libraries/CpuFeatures/CCpuHelper.h>
 
 class QXmlQuery;
@@ -281,15 +283,37 @@ private:
 
 struct Hub: Abstract::Hub
 {
+	Hub();
+	~Hub();
+
 	void add(int id_, virEventTimeoutCallback callback_);
 	void add(int id_, int socket_, virEventHandleCallback callback_);
 	void remove(int id_);
 	void setEvents(int id_, int value_);
 	void setInterval(int id_, int value_);
 	void setOpaque(int id_, Transport::Visitor* value_);
+	void push(const Mock::eventHandler_type& event_);
+	void drain();
 
 private:
+	enum
+	{
+		// the initial number of the queue nodes
+		QUEUE = 64,
+		// the period of the latency reports in seconds
+		REPORT_PERIOD = 600
+	};
+	// the event handler and the time it has been pushed at
+	typedef QPair<Mock::eventHandler_type, quint64> event_type;
+
+	void report();
+
 	Mock m_mock;
+	QAtomicInt m_drain;
+	quint64 m_reported;
+	Native::Histogram m_wait;
+	Native::Histogram m_react;
+	boost::lockfree::queue<event_type* > m_queue;
 	boost::ptr_map<int, Socket> m_socketMap;
 	boost::ptr_map<int, Timeout> m_timeoutMap;
 	boost::ptr_map<int, Sweeper> m_sweeperMap;
@@ -305,6 +329,15 @@ struct Access
 		return m_hub.toStrongRef();
 	}
 	void setHub(const QSharedPointer<Hub>& hub_);
+	void setLoop(const QSharedPointer<Native::Loop>& loop_)
+	{
+		m_loop = loop_;
+	}
+	bool isNative() const
+	{
+		return !m_loop.isNull();
+	}
+	void defer(const Mock::eventHandler_type& event_);
 	int add(int interval_, virEventTimeoutCallback callback_, void* opaque_, virFreeCallback free_);
 	int add(int socket_, int events_, virEventHandleCallback callback_, void* opaque_, virFreeCallback free_);
 	void setEvents(int id_, int value_);
@@ -315,6 +348,7 @@ struct Access
 private:
 	QAtomicInt m_generator;
 	QWeakPointer<Hub> m_hub;
+	QWeakPointer<Native::Loop> m_loop;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -363,7 +397,12 @@ struct Performance
 private:
 	typedef Instrument::Agent::Vm::Stat::CounterList_type data_type;
 
-	void account(Registry::Access& access_, const data_type& data_);
+	static void account(Stat::Storage& storage_, Stat::Column& column_,
+		const data_type& data_, quint64 time_);
+	template<int N>
+	void account(Stat::Storage& storage_,
+		const Instrument::Agent::Vm::Performance::Values<N>* values_,
+		const QVector<Registry::Binding::id_type>& ids_, quint64 time_);
 
 	source_type m_source;
 };
@@ -440,17 +479,29 @@ private:
 struct Domain
 {
 	typedef QSharedPointer<Model::Entry> entry_type;
+	typedef boost::optional<CVmConfiguration> config_type;
 
 	explicit Domain(const State::agent_type& agent_): m_agent(agent_)
 	{
 	}
+	Domain(const State::agent_type& agent_, const State& state_):
+		m_state(state_), m_agent(agent_)
+	{
+	}
 
 	void update(Registry::Access& access_, const entry_type& model_);
 	void updateConfig(Registry::Access& access_);
 	void insert(Registry::Access& access_, const entry_type& model_);
 	void switch_(Registry::Access& access_);
+	// reads and converts the configs for the known state, touches no
+	// registry thus runs on any thread
+	config_type read() const;
+	void adopt(Registry::Access& access_, const entry_type& model_,
+		const config_type& config_);
 
 private:
+	void apply(Registry::Access& access_, const CVmConfiguration& config_);
+
 	State m_state;
 	State::agent_type m_agent;
 };
@@ -1347,6 +1398,12 @@ namespace Breeding
 
 struct Vm
 {
+	// libvirtd serves 5 calls of a client at once by default
+	enum
+	{
+		CONCURRENCY = 4
+	};
+
 	explicit Vm(const QSharedPointer<Model::System>& view_): m_view(view_)
 	{
 	}
@@ -1354,6 +1411,7 @@ struct Vm
 	void operator()(Agent::Hub& hub_);
 private:
 	bool validate(const QString& uuid_);
+	static void define(Agent::Vm::Unit unit_, const CVmConfiguration& config_);
 
 	QSharedPointer<Model::System> m_view;
 };
@@ -148,6 +148,13 @@ struct Vm: ::Vm::State::Machine
 		return m_storage.toWeakRef();
 	}
 
+	QSharedPointer<const Binding> getBinding();
+
+	QSharedPointer<Columns> getColumns() const
+	{
+		return m_columns;
+	}
+
 	const QString getDirectory() const
 	{
 		return getUser().getVmDirectoryUuid();
@@ -155,10 +162,16 @@ struct Vm: ::Vm::State::Machine
 	PRL_VM_TOOLS_STATE getToolsState();
 
 private:
+	QSharedPointer<const Binding> bind(const CVmConfiguration& config_) const;
+
 	QMutex m_mutex;
 	QSharedPointer<Stat::Storage> m_storage;
+	QSharedPointer<Columns> m_columns;
 	QSharedPointer<Network::Routing> m_routing;
 	VmOnRebootState		m_upgradeState;
+	QMutex m_bindingMutex;
+	QSharedPointer<const CVmConfiguration> m_bound;
+	QSharedPointer<const Binding> m_binding;
 };
 
 namespace Update
@@ -341,7 +354,8 @@ Complement::result_type Complement::operator()(PRL_RESULT request_)
 Vm::Vm(const QString& uuid_, const SmartPtr<CDspClient>& user_,
 		const QSharedPointer<Network::Routing>& routing_):
 	::Vm::State::Machine(uuid_, user_, routing_),
-	m_storage(new Stat::Storage(uuid_)), m_routing(routing_),
+	m_storage(new Stat::Storage(uuid_)), m_columns(new Columns()),
+	m_routing(routing_),
 	m_upgradeState(VmOnRebootState::NONE)
 {
 	typedef ::Vm::State::Started::factory_type factory_type;
@@ -423,6 +437,63 @@ void Vm::updateConfig(CVmConfiguration value_)
 			Update::Complement(value_, *this)))(getConfigEditor()(s));
 }
 
+QSharedPointer<const Binding> Vm::getBinding()
+{
+	if (getHome().isEmpty())
+		return QSharedPointer<const Binding>();
+
+	// the snapshot is replaced on every config change
+	QSharedPointer<const CVmConfiguration> c = getService().getVmConfigManager()
+		.getSnapshot(getHome(), SmartPtr<CDspClient>(0));
+	if (c.isNull())
+		return QSharedPointer<const Binding>();
+
+	QMutexLocker g(&m_bindingMutex);
+	if (c != m_bound)
+	{
+		m_binding = bind(*c);
+		m_bound = c;
+	}
+	return m_binding;
+}
+
+QSharedPointer<const Binding> Vm::bind(const CVmConfiguration& config_) const
+{
+	typedef Libvirt::Instrument::Agent::Vm::Performance::Record record_type;
+
+	QSharedPointer<Binding> output(new Binding());
+	foreach (const CVmHardDisk* d, config_.getVmHardwareList()->m_lstHardDisks)
+	{
+		if (d->getEnabled() != PVE::DeviceEnabled ||
+			d->getConnected() != PVE::DeviceConnected)
+			continue;
+
+		QVector<Binding::id_type> x(record_type::BLOCK_COUNT);
+		x[record_type::BLOCK_RD_REQS] = m_storage->addAbsolute(Stat::Name::Hdd::getReadRequests(*d));
+		x[record_type::BLOCK_RD_BYTES] = m_storage->addAbsolute(Stat::Name::Hdd::getReadTotal(*d));
+		x[record_type::BLOCK_WR_REQS] = m_storage->addAbsolute(Stat::Name::Hdd::getWriteRequests(*d));
+		x[record_type::BLOCK_WR_BYTES] = m_storage->addAbsolute(Stat::Name::Hdd::getWriteTotal(*d));
+		x[record_type::BLOCK_CAPACITY] = m_storage->addAbsolute(Stat::Name::Hdd::getCapacity(*d));
+		x[record_type::BLOCK_ALLOCATION] = m_storage->addAbsolute(Stat::Name::Hdd::getAllocation(*d));
+		x[record_type::BLOCK_PHYSICAL] = m_storage->addAbsolute(Stat::Name::Hdd::getPhysical(*d));
+		output->disks << qMakePair(d->getSystemName(), x);
+	}
+	foreach (const CVmGenericNetworkAdapter* a, config_.getVmHardwareList()->m_lstNetworkAdapters)
+	{
+		if (a->getEnabled() != PVE::DeviceEnabled ||
+			a->getConnected() != PVE::DeviceConnected)
+			continue;
+
+		QVector<Binding::id_type> x(record_type::NET_COUNT);
+		x[record_type::NET_RX_BYTES] = m_storage->addAbsolute(Stat::Name::Interface::getBytesIn(*a));
+		x[record_type::NET_RX_PKTS] = m_storage->addAbsolute(Stat::Name::Interface::getPacketsIn(*a));
+		x[record_type::NET_TX_BYTES] = m_storage->addAbsolute(Stat::Name::Interface::getBytesOut(*a));
+		x[record_type::NET_TX_PKTS] = m_storage->addAbsolute(Stat::Name::Interface::getPacketsOut(*a));
+		output->interfaces << qMakePair(a->getHostInterfaceName(), x);
+	}
+	return output;
+}
+
 PRL_VM_TOOLS_STATE Vm::getToolsState()
 {
 	::Vm::State::Machine::Running& r = get_state< ::Vm::State::Machine::Running& >();
@@ -583,6 +654,24 @@ QWeakPointer<Stat::Storage> Access::getStorage()
 	return x->getStorage();
 }
 
+QSharedPointer<const Binding> Access::getBinding()
+{
+	QSharedPointer<Vm> x = m_vm.toStrongRef();
+	if (x.isNull())
+		return QSharedPointer<const Binding>();
+
+	return x->getBinding();
+}
+
+QSharedPointer<Columns> Access::getColumns()
+{
+	QSharedPointer<Vm> x = m_vm.toStrongRef();
+	if (x.isNull())
+		return QSharedPointer<Columns>();
+
+	return x->getColumns();
+}
+
 boost::optional< ::Vm::Config::Edit::Atomic> Access::getConfigEditor() const
 {
 	QSharedPointer<Vm> x = m_vm.toStrongRef();
@@ -36,11 +36,14 @@
 #include <QHash>
 #include <QString>
 #include <CVmIdent.h>
+#include <QVector>
 #include <QSharedPointer>
 #include <QReadWriteLock>
 #include <boost/mpl/at.hpp>
+#include <boost/optional.hpp>
 #include <prlsdk/PrlEnums.h>
 #include "CDspVmConfigManager.h"
+#include "Stat/CDspStatStorage.h"
 #include <prlcommon/Std/SmartPtr.h>
 #include <prlcommon/Messaging/CVmEvent.h>
 #include <prlxmlmodel/VmConfig/CVmConfiguration.h>
@@ -50,11 +53,6 @@
 class CDspClient;
 class CDspService;
 
-namespace Stat
-{
-struct Storage;
-} // namespace Stat
-
 namespace Network
 {
 struct Routing;
@@ -98,6 +96,34 @@ private:
 	QWeakPointer<Vm> m_vm;
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Binding
+// Counters of the VM devices to account the libvirt statistics into. It is
+// built from the shared config snapshot and kept until the snapshot changes.
+
+struct Binding
+{
+	typedef boost::optional<Stat::counterId_type> id_type;
+	// system name of a device and the ids of its counters in the order
+	// of the libvirt record leaves
+	typedef QPair<QString, QVector<id_type> > device_type;
+
+	QList<device_type> disks;
+	QList<device_type> interfaces;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Columns
+// Counters of the VM that libvirt reports as lists of names. Unlike the
+// binding they do not depend on the config and live as long as the storage.
+
+struct Columns
+{
+	Stat::Column cpu;
+	Stat::Column vcpu;
+	Stat::Column memory;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Access
 
@@ -119,6 +145,10 @@ struct Access
 
 	QWeakPointer<Stat::Storage> getStorage();
 
+	QSharedPointer<const Binding> getBinding();
+
+	QSharedPointer<Columns> getColumns();
+
 	boost::optional< ::Vm::Config::Edit::Atomic> getConfigEditor() const;
 
 	PRL_VM_TOOLS_STATE getToolsState();
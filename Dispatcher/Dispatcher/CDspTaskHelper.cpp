@@ -90,6 +90,7 @@ void CancelOperationSupport::cancelOperation (SmartPtr<CDspClient> pUserSession,
 		else
 			pUserSession->sendSimpleResponse(p, PRL_ERR_SUCCESS );
 	}
+	reactCancelled();
 }
 
 /**
@@ -146,7 +147,8 @@ CDspTaskHelper::CDspTaskHelper (
 	m_bExlusiveWasLocked(false),
 	m_pbIsRunning( pbIsRunning ),
 	m_mtxWaitExternalTask(QMutex::Recursive),
-	m_externalTask(NULL)
+	m_externalTask(NULL),
+	m_bQueued(false)
 {
 	LOG_MESSAGE(DBG_DEBUG, "Task %p instantiated", this);
 	PRL_ASSERT( m_pUser );
@@ -199,10 +201,40 @@ void CDspTaskHelper::start ( QThread::Priority priority)
 	{
 		WRITE_TRACE(DBG_FATAL, "cannot start already cancelled task of type %s.",
 			typeid(*this).name());
-		return;
 	}
-	QThread::setStackSize( 2* 1024 * 1024 );
-	QThread::start(priority);
+	else
+	{
+		QThread::setStackSize( 2* 1024 * 1024 );
+		QThread::start(priority);
+	}
+	// NB. waiters check isRunning() after wake up, so that release them
+	// only after the thread is started.
+	QMutexLocker g(&m_mtxAdmission);
+	m_bQueued = false;
+	m_admission.wakeAll();
+}
+
+void CDspTaskHelper::setQueued()
+{
+	QMutexLocker g(&m_mtxAdmission);
+	m_bQueued = true;
+}
+
+void CDspTaskHelper::reactCancelled()
+{
+	QMutexLocker g(&m_mtxAdmission);
+	if (!m_bQueued)
+		return;
+
+	g.unlock();
+	emit cancelled(this);
+}
+
+void CDspTaskHelper::waitForAdmission()
+{
+	QMutexLocker g(&m_mtxAdmission);
+	while (m_bQueued)
+		m_admission.wait(&m_mtxAdmission);
 }
 
 // thread runner
@@ -297,6 +329,7 @@ void CDspTaskHelper::run()
 #ifdef _LIN_
 	catch (const abi::__forced_unwind&)
 	{
+		emit released(this);
 		throw;
 	}
 #endif // _LIN_
@@ -326,6 +359,7 @@ void CDspTaskHelper::run()
 
 	t.finish(getLastErrorCode());
 	checkVmAdditionState( true );
+	emit released(this);
 }
 
 void CDspTaskHelper::parseFlags()
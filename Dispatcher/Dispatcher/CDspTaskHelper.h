@@ -47,6 +47,7 @@
 #include <QObject>
 #include <QDateTime>
 #include <QThread>
+#include <QWaitCondition>
 
 #include "CDspClient.h"
 #include  "CDspSync.h"
@@ -62,6 +63,22 @@ class CVmConfiguration;
 
 #define TASK_TERMINATE_TIMEOUT		7*1000	// 7 seconds
 
+namespace Task
+{
+// execution class of a task. the number of simultaneously running tasks
+// of one class is limited by the task manager, the CLASS_NONE ones are
+// started at once.
+enum Class
+{
+	CLASS_NONE,
+	CLASS_SHORT,
+	CLASS_LONG,
+	CLASS_IO,
+	CLASS_COUNT
+};
+
+} // namespace Task
+
 class CancelOperationSupport
 {
 public:
@@ -78,6 +95,11 @@ public:
 	virtual ~CancelOperationSupport();
 
 protected:
+	/**
+	* called at the end of every cancelOperation()
+	*/
+	virtual void reactCancelled() {}
+
 	/**
 	* set to default internal canceled parameters
 	*/
@@ -161,9 +183,27 @@ public:
 	virtual void cancelOperation(SmartPtr<CDspClient> pUserSession, const SmartPtr<IOPackage> &p);
 	virtual PRL_RESULT runExternalTask(CDspTaskHelper *pTask);
 
+	//Should be overrided in classes that should not run unlimited.
+	virtual Task::Class getTaskClass() const { return Task::CLASS_NONE; }
+
+	/**
+	* marks the task as waiting for an execution slot
+	*/
+	void setQueued();
+	/**
+	* blocks while the task waits for an execution slot
+	*/
+	void waitForAdmission();
+
 public slots:
 	void start ( QThread::Priority priority = QThread::InheritPriority );
 
+signals:
+	// emitted from the task thread when the task leaves run()
+	void released(CDspTaskHelper* task_);
+	// emitted from the cancelling thread when a queued task is cancelled
+	void cancelled(CDspTaskHelper* task_);
+
 protected:
 	CDspTaskHelper(
 					const SmartPtr<CDspClient>&,
@@ -237,7 +277,12 @@ private:
 	// External task thread
 	CDspTaskHelper *m_externalTask;
 
+	QMutex m_mtxAdmission;
+	QWaitCondition m_admission;
+	bool m_bQueued;
+
 protected:
+	virtual void reactCancelled();
 
 	bool lockToExecute();
 	void unlockToExecute();
@@ -277,7 +322,11 @@ struct CDspTaskFuture
 	}
 	CDspTaskFuture& wait(bool do_ = true)
 	{
-		if (do_ && m_task.isValid() && m_task->isRunning())
+		if (!do_ || !m_task.isValid())
+			return *this;
+
+		m_task->waitForAdmission();
+		if (m_task->isRunning())
 			m_task->wait();
 
 		return *this;
@@ -67,6 +67,13 @@ void CDspTaskManager::deinit()
 
 	lock.unlock();
 
+	// Queued tasks should not start anymore. Wake up their waiters
+	foreach( SmartPtr<CDspTaskHelper> pTask, m_pool.clear() )
+	{
+		pTask->cancelOperation(SmartPtr<CDspClient>(), SmartPtr<IOPackage>());
+		pTask->start();
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Cancel Tasks
 	//////////////////////////////////////////////////////////////////////////
@@ -181,6 +188,18 @@ SmartPtr<CDspTaskHelper> CDspTaskManager::registerTask ( CDspTaskHelper* task )
 					  SLOT(cleanFinishedTasks()),
 					  Qt::QueuedConnection );
 	PRL_ASSERT(bConnected);
+	// Free the execution slot right in the task thread
+	bConnected = QObject::connect( task,
+					  SIGNAL(released(CDspTaskHelper*)),
+					  SLOT(reactReleased(CDspTaskHelper*)),
+					  Qt::DirectConnection );
+	PRL_ASSERT(bConnected);
+	// Drop a queued task right in the cancelling thread
+	bConnected = QObject::connect( task,
+					  SIGNAL(cancelled(CDspTaskHelper*)),
+					  SLOT(reactCancelled(CDspTaskHelper*)),
+					  Qt::DirectConnection );
+	PRL_ASSERT(bConnected);
 	Q_UNUSED(bConnected);
 
 	m_tasks[ task->getJobUuid() ] = SmartPtr<CDspTaskHelper>(task);
@@ -344,6 +363,64 @@ void CDspTaskManager::cleanFinishedTasks()
 	tasksToDeleteNow.clear();
 }
 
+void CDspTaskManager::admit(const SmartPtr<CDspTaskHelper>& task_)
+{
+	// a task started from another task is usually awaited by its parent.
+	// do not queue it behind the parent to avoid a deadlock.
+	if (task_->operationIsCancelled() ||
+		NULL != qobject_cast<CDspTaskHelper* >(QThread::currentThread()) ||
+		m_pool.admit(task_))
+		launch(task_);
+}
+
+void CDspTaskManager::launch(const SmartPtr<CDspTaskHelper>& task_)
+{
+	task_->start();
+	if (task_->isRunning() || task_->isFinished())
+		return;
+
+	// the task has not been started. free the slot for the next one.
+	reactReleased(task_.getImpl());
+}
+
+void CDspTaskManager::reactReleased(CDspTaskHelper* task_)
+{
+	SmartPtr<CDspTaskHelper> n;
+	for (n = m_pool.release(task_); n.isValid(); n = m_pool.release(n.getImpl()))
+	{
+		n->start();
+		if (n->isRunning() || n->isFinished())
+			break;
+
+		reject(n);
+	}
+}
+
+void CDspTaskManager::reactCancelled(CDspTaskHelper* task_)
+{
+	SmartPtr<CDspTaskHelper> t = m_pool.remove(task_);
+	if (!t.isValid())
+		return;
+
+	// the cancelled task does not start, this only wakes its waiters
+	t->start();
+	reject(t);
+}
+
+void CDspTaskManager::reject(const SmartPtr<CDspTaskHelper>& task_)
+{
+	// the task was cancelled while waiting for a slot. nobody replies
+	// to the client but us.
+	task_->getClient()->sendSimpleResponse(task_->getRequestPackage(),
+		task_->getCancelResult());
+	unregisterTask(task_->getJobUuid());
+}
+
+Task::Metrics CDspTaskManager::getMetrics(Task::Class class_) const
+{
+	return m_pool.getMetrics(class_);
+}
+
 /** get all working tasks*/
 QList< SmartPtr< CDspTaskHelper > >
 CDspTaskManager::getAllTasks()
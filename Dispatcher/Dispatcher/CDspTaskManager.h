@@ -37,6 +37,7 @@
 #include <QList>
 #include <QMutex>
 
+#include "CDspTaskPool.h"
 #include "CDspTaskHelper.h"
 #include <prlcommon/Messaging/CVmEvent.h>
 
@@ -87,15 +88,28 @@ public:
 		if (!p.isValid())
 			return CDspTaskFuture<T>();
 
-		p->start();
+		admit(p);
 		return CDspTaskFuture<T>(p);
 	}
 
+	/** Returns queue depth and wait time statistics of the task class,
+	 * exported as the dispatcher.tasks.* perf counters */
+	Task::Metrics getMetrics(Task::Class class_) const;
+
 public slots:
 	void cleanFinishedTasks();
 
+private slots:
+	void reactReleased(CDspTaskHelper* task_);
+	void reactCancelled(CDspTaskHelper* task_);
+
 private:
+	void admit(const SmartPtr<CDspTaskHelper>& task_);
+	void launch(const SmartPtr<CDspTaskHelper>& task_);
+	void reject(const SmartPtr<CDspTaskHelper>& task_);
+
 	bool m_bDeinited;
+	Task::Pool m_pool;
 	QHash< Uuid, SmartPtr<CDspTaskHelper> > m_tasks;
 	QList< SmartPtr<CDspTaskHelper> > m_tasksToDelete;
 	mutable QMutex m_mutex;
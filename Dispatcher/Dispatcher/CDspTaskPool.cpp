@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @file CDspTaskPool.cpp
+///
+/// Admission control for dispatcher tasks
+///
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "CDspTaskPool.h"
+#include <prlcommon/Logging/Logging.h>
+#include <prlcommon/Std/PrlAssert.h>
+
+namespace Task
+{
+///////////////////////////////////////////////////////////////////////////////
+// struct Pool
+
+Pool::Pool()
+{
+	m_lanes[CLASS_SHORT].capacity = TASK_POOL_SHORT_CAPACITY;
+	m_lanes[CLASS_LONG].capacity = TASK_POOL_LONG_CAPACITY;
+	m_lanes[CLASS_IO].capacity = TASK_POOL_IO_CAPACITY;
+}
+
+QString Pool::getSession(CDspTaskHelper* task_)
+{
+	SmartPtr<CDspClient> c = task_->getClient();
+	if (!c.isValid())
+		return QString();
+
+	return c->getClientHandle();
+}
+
+bool Pool::admit(const task_type& task_)
+{
+	Class c = task_->getTaskClass();
+	if (CLASS_NONE == c)
+		return true;
+
+	PRL_ASSERT(c < CLASS_COUNT);
+	QMutexLocker g(&m_mutex);
+	Lane& x = m_lanes[c];
+	if (x.running.size() < (int)x.capacity && x.sessions.isEmpty())
+	{
+		x.running.insert(task_.getImpl());
+		++x.metrics.admitted;
+		return true;
+	}
+	QString s = getSession(task_.getImpl());
+	if (!x.queues.contains(s))
+		x.sessions.enqueue(s);
+
+	// NB. under the lock. the task may be released right after that.
+	task_->setQueued();
+	Entry e;
+	e.task = task_;
+	e.clock.start();
+	x.queues[s].enqueue(e);
+	++x.metrics.queued;
+	WRITE_TRACE(DBG_INFO, "task %s of class %d is queued, %u tasks are waiting",
+		QSTR2UTF8(task_->getJobUuid().toString()), c, x.metrics.queued);
+	return false;
+}
+
+Pool::task_type Pool::release(const CDspTaskHelper* task_)
+{
+	if (NULL == task_)
+		return task_type();
+
+	Class c = task_->getTaskClass();
+	if (CLASS_NONE == c)
+		return task_type();
+
+	QMutexLocker g(&m_mutex);
+	Lane& x = m_lanes[c];
+	if (!x.running.remove(task_) || x.sessions.isEmpty())
+		return task_type();
+
+	QString s = x.sessions.dequeue();
+	QQueue<Entry>& q = x.queues[s];
+	Entry e = q.dequeue();
+	if (q.isEmpty())
+		x.queues.remove(s);
+	else
+		x.sessions.enqueue(s);
+
+	quint64 w = e.clock.elapsed();
+	x.running.insert(e.task.getImpl());
+	--x.metrics.queued;
+	++x.metrics.admitted;
+	++x.metrics.delayed;
+	x.metrics.waited += w;
+	x.metrics.longest = qMax(x.metrics.longest, w);
+	WRITE_TRACE(DBG_INFO, "task %s of class %d waited %llu msecs, %u tasks are waiting",
+		QSTR2UTF8(e.task->getJobUuid().toString()), c, w, x.metrics.queued);
+	return e.task;
+}
+
+Pool::task_type Pool::remove(CDspTaskHelper* task_)
+{
+	if (NULL == task_)
+		return task_type();
+
+	Class c = task_->getTaskClass();
+	if (CLASS_NONE == c)
+		return task_type();
+
+	QMutexLocker g(&m_mutex);
+	Lane& x = m_lanes[c];
+	QHash<QString, QQueue<Entry> >::iterator q = x.queues.find(getSession(task_));
+	if (x.queues.end() == q)
+		return task_type();
+
+	for (int i = 0; i < q->size(); ++i)
+	{
+		if (q->at(i).task.getImpl() != task_)
+			continue;
+
+		task_type output = q->takeAt(i).task;
+		if (q->isEmpty())
+		{
+			x.sessions.removeOne(q.key());
+			x.queues.erase(q);
+		}
+		--x.metrics.queued;
+		return output;
+	}
+	return task_type();
+}
+
+QList<Pool::task_type> Pool::clear()
+{
+	QList<task_type> output;
+	QMutexLocker g(&m_mutex);
+	for (int i = 0; i < CLASS_COUNT; ++i)
+	{
+		Lane& x = m_lanes[i];
+		foreach (const QQueue<Entry>& q, x.queues)
+		{
+			foreach (const Entry& e, q)
+			{
+				output << e.task;
+			}
+		}
+		x.queues.clear();
+		x.sessions.clear();
+		x.metrics.queued = 0;
+	}
+	return output;
+}
+
+Metrics Pool::getMetrics(Class class_) const
+{
+	if (CLASS_NONE == class_ || CLASS_COUNT <= class_)
+		return Metrics();
+
+	QMutexLocker g(&m_mutex);
+	Metrics output = m_lanes[class_].metrics;
+	output.running = m_lanes[class_].running.size();
+	return output;
+}
+
+} // namespace Task
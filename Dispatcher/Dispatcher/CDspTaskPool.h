@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @file CDspTaskPool.h
+///
+/// Admission control for dispatcher tasks
+///
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __CDSPTASKPOOL_H__
+#define __CDSPTASKPOOL_H__
+
+#include <QSet>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QQueue>
+#include <QElapsedTimer>
+#include "CDspTaskHelper.h"
+
+#define TASK_POOL_SHORT_CAPACITY	32
+#define TASK_POOL_LONG_CAPACITY		8
+#define TASK_POOL_IO_CAPACITY		4
+
+namespace Task
+{
+///////////////////////////////////////////////////////////////////////////////
+// struct Metrics
+
+struct Metrics
+{
+	Metrics(): running(), queued(), admitted(), delayed(), waited(), longest()
+	{
+	}
+
+	// tasks holding a slot at the moment
+	quint32 running;
+	// tasks waiting for a slot at the moment
+	quint32 queued;
+	// tasks given a slot since the start
+	quint64 admitted;
+	// tasks among them that had to wait for one
+	quint64 delayed;
+	// total and maximal time spent in the queue, msecs
+	quint64 waited;
+	quint64 longest;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Pool
+//
+// Limits the number of tasks of one class that run at the same time. The
+// rest wait in per session queues that are served round robin so that a
+// bulk request of one client does not starve the others. Tasks of the
+// CLASS_NONE are never limited.
+
+struct Pool
+{
+	typedef SmartPtr<CDspTaskHelper> task_type;
+
+	Pool();
+
+	// returns true when the task may start at once otherwise keeps it
+	// in the queue until a slot is freed.
+	bool admit(const task_type& task_);
+	// frees the slot of the task and returns the next one to start.
+	task_type release(const CDspTaskHelper* task_);
+	// takes the task out of the queue, returns it if it was waiting.
+	task_type remove(CDspTaskHelper* task_);
+	// drops all the queued tasks and returns them.
+	QList<task_type> clear();
+	Metrics getMetrics(Class class_) const;
+
+private:
+	struct Entry
+	{
+		task_type task;
+		QElapsedTimer clock;
+	};
+
+	struct Lane
+	{
+		Lane(): capacity()
+		{
+		}
+
+		quint32 capacity;
+		Metrics metrics;
+		QSet<const CDspTaskHelper* > running;
+		QQueue<QString> sessions;
+		QHash<QString, QQueue<Entry> > queues;
+	};
+
+	static QString getSession(CDspTaskHelper* task_);
+
+	mutable QMutex m_mutex;
+	Lane m_lanes[CLASS_COUNT];
+};
+
+} // namespace Task
+
+#endif // __CDSPTASKPOOL_H__
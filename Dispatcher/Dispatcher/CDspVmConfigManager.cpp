@@ -35,6 +35,7 @@
 #include "CDspVmConfigManager.h"
 #include <QReadLocker>
 #include <QWriteLocker>
+#include <boost/bind.hpp>
 #include "CDspVmDirManager.h"
 #include "CDspService.h"
 #include "CDspVmDirHelper.h"
@@ -532,6 +533,10 @@ struct Work
 	{
 		return m_user.isValid() ? &(m_user->getAuthHelper()) : NULL;
 	}
+	const SmartPtr<CDspClient>& getUser() const
+	{
+		return m_user;
+	}
 	const SmartPtr<CVmConfiguration>& getConfig() const
 	{
 		return m_config;
@@ -592,32 +597,77 @@ void Base::forget(const Work& unit_)
 	u.save(getCache());
 }
 
+Base::snapshot_type Base::snapshot(Work& unit_)
+{
+	snapshot_type output = getCache().getSnapshot(unit_.getPath(), unit_.getUser());
+	if (!output.isNull())
+		return output;
+
+	// the miss is accounted already, do not look into the cache again
+	if (PRL_FAILED(load(unit_, true)))
+		return snapshot_type();
+
+	// the loaded config is private, wrap it instead of a copy
+	object_type x = unit_.getConfig();
+	return snapshot_type(x.getImpl(), boost::bind(&release, x));
+}
+
+void Base::release(const object_type& )
+{
+}
+
 namespace InMemory
 {
 ///////////////////////////////////////////////////////////////////////////////
 // struct Cache
 
-Cache::object_type Cache::getFromCache(const QString& key_, session_type)
+Cache::object_type Cache::getFromCache(const QString& key_, session_type session_)
+{
+	snapshot_type x = getSnapshot(key_, session_);
+	if (x.isNull())
+		return object_type();
+
+	m_copies.fetchAndAddRelaxed(1);
+	return object_type(new CVmConfiguration(*x));
+}
+
+Cache::snapshot_type Cache::getSnapshot(const QString& key_, session_type)
 {
 	QReadLocker g(&m_guard);
-	object_type x = m_map.value(key_, object_type());
-	if (!x.isValid())
-		return x;
+	snapshot_type output = m_map.value(key_);
+	g.unlock();
+	if (output.isNull())
+		m_misses.fetchAndAddRelaxed(1);
+	else
+		m_hits.fetchAndAddRelaxed(1);
 
-	return object_type(new CVmConfiguration(x.getImpl()));
+	return output;
+}
+
+CacheStatistics Cache::getStatistics() const
+{
+	CacheStatistics output;
+	output.hits = m_hits.load();
+	output.misses = m_misses.load();
+	output.copies = m_copies.load();
+	return output;
 }
 
 void Cache::updateCache(const QString& key_, const object_type& object_, session_type)
 {
-	QWriteLocker g(&m_guard);
 	if (object_.isValid())
 	{
-		object_type x(new CVmConfiguration(object_.getImpl()));
+		CVmConfiguration* x = new CVmConfiguration(object_.getImpl());
 		x->setAbsolutePath();
-		m_map.insert(key_, x);
+		snapshot_type y(x);
+		QWriteLocker g(&m_guard);
+		m_map.insert(key_, y);
 	}
 	else
+	{
+		QWriteLocker g(&m_guard);
 		m_map.remove(key_);
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1157,6 +1207,10 @@ struct Root: private Node
 		QStringList x = getElements(path_);
 		return *(find(x) ? : m_default.data());
 	}
+	Vm::Config::Access::Base& getDefault() const
+	{
+		return *m_default;
+	}
 	bool set(const QString& path_, Vm::Config::Access::Base* data_)
 	{
 		QStringList x = getElements(path_);
@@ -1299,6 +1353,20 @@ bool CDspVmConfigManager::canConfigRestore( const QString& config_file, SmartPtr
 	return m_trie->get(config_file).canRestore(w);
 }
 
+QSharedPointer<const CVmConfiguration> CDspVmConfigManager::getSnapshot
+	(const QString& strFileName, SmartPtr<CDspClient> pUserSession)
+{
+	QReadLocker locker(&m_mtxAccessLocker);
+	Vm::Config::Access::Work w(strFileName, pUserSession);
+	return m_trie->get(strFileName).snapshot(w);
+}
+
+CacheStatistics CDspVmConfigManager::getCacheStatistics() const
+{
+	QReadLocker locker(&m_mtxAccessLocker);
+	return m_trie->getDefault().getStatistics();
+}
+
 SmartPtr<QWriteLocker> CDspVmConfigManager::lockOnWrite()
 {
 	return SmartPtr<QWriteLocker>( new QWriteLocker(&m_mtxAccessLocker) );
@@ -38,6 +38,7 @@
 #include <prlcommon/Std/SmartPtr.h>
 #include "Dispatcher/Dispatcher/Cache/Cache.h"
 #include <QReadWriteLock>
+#include <QAtomicInteger>
 #include <QHash>
 #include <QObject>
 #include <QVector>
@@ -393,6 +394,7 @@ struct Base
 {
 	typedef CacheBase<CVmConfiguration> cache_type;
 	typedef SmartPtr<CVmConfiguration> object_type;
+	typedef cache_type::snapshot_type snapshot_type;
 
 	explicit Base(cache_type* cache_);
 	virtual ~Base();
@@ -402,12 +404,20 @@ struct Base
 	virtual PRL_RESULT restore(const Work& , const QString& ) = 0;
 	virtual bool canRestore(const Work& ) const = 0;
 	void forget(const Work& unit_);
+	snapshot_type snapshot(Work& unit_);
+	CacheStatistics getStatistics() const
+	{
+		return m_cache->getStatistics();
+	}
 protected:
 	cache_type& getCache() const
 	{
 		return *m_cache;
 	}
 private:
+	// keeps a loaded config alive while its snapshot is in use
+	static void release(const object_type& );
+
 	QScopedPointer<cache_type> m_cache;
 };
 
@@ -421,14 +431,23 @@ struct Cache: Base::cache_type
 	typedef Base::object_type object_type;
 	typedef SmartPtr<CDspClient> session_type;
 
+	Cache(): m_hits(0), m_misses(0), m_copies(0)
+	{
+	}
+
 	object_type getFromCache(const QString& key_, session_type session_);
 	void updateCache(const QString& key_, const object_type& object_, session_type session_);
+	snapshot_type getSnapshot(const QString& key_, session_type session_);
+	CacheStatistics getStatistics() const;
 
 private:
-	typedef QHash<QString, object_type> map_type;
+	typedef QHash<QString, snapshot_type> map_type;
 
 	QReadWriteLock m_guard;
 	map_type m_map;
+	QAtomicInteger<quint64> m_hits;
+	QAtomicInteger<quint64> m_misses;
+	QAtomicInteger<quint64> m_copies;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -613,6 +632,18 @@ public:
 							bool BNeedLoadAbsolutePath = true, // FIXME: Need replace to QFlags
 							bool bLoadDirectlyFromDisk = false );
 	/**
+	* @brief Get the shared read-only version of the config.
+	*
+	* Unlike loadConfig() it does not clone the cached config. The result
+	* must not be modified. Absolute paths are in use.
+	**/
+	QSharedPointer<const CVmConfiguration> getSnapshot( const QString& strFileName,
+							SmartPtr<CDspClient> pUserSession );
+	/**
+	* @brief Config cache counters of the VM configs kept on disk.
+	*/
+	CacheStatistics getCacheStatistics() const;
+	/**
 	* @brief Save config from disk.
 	*/
 	PRL_RESULT saveConfig( SmartPtr<CVmConfiguration> pConfig,
@@ -693,7 +724,7 @@ public:
 private:
 	// FIXME: May be need implement lock for every config exclude common lock
 	// mutex for lock access from other thread
-	QReadWriteLock	m_mtxAccessLocker;
+	mutable QReadWriteLock	m_mtxAccessLocker;
 
 	CHardDiskConfigCache m_HardDiskCache;
 	QScopedPointer<Trie::Root> m_trie;
@@ -1093,8 +1093,9 @@ bool CDspVmDirHelper::sendVmList(const IOSender::Handle& sender,
 	dirUuids.append(eUuids);
 
 	QStringList lstVmConfigurations;
+	::List::Directory::Probe p(*s, pUserSession, nFlags, m_listMemo);
 	QScopedPointer< ::List::Directory::Chain> x
-		(::List::Directory::Factory(*s, e)(pUserSession, nFlags));
+		(::List::Directory::Factory(*s, e, &p)(pUserSession, nFlags));
 	if (!x.isNull())
 	{
 		foreach (const QString& u, dirUuids)
@@ -4059,6 +4060,88 @@ Chain* Factory::operator()(const session_type& session_, quint32 flags_) const
 
 } // namespace Item
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Memo
+
+bool Memo::Entry::operator==(const Entry& other_) const
+{
+	return access == other_.access && state == other_.state &&
+		config == other_.config && item == other_.item;
+}
+
+Memo::bucket_type Memo::take(const key_type& key_)
+{
+	QMutexLocker g(&m_mutex);
+	return m_data.take(key_);
+}
+
+void Memo::put(const key_type& key_, const bucket_type& value_)
+{
+	QMutexLocker g(&m_mutex);
+	m_data.insert(key_, value_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Probe
+
+Probe::Probe(CDspService& service_, const session_type& session_, quint32 flags_, Memo& memo_):
+	m_flags(flags_), m_service(&service_), m_session(session_), m_memo(&memo_)
+{
+	// the extra parameters are runtime ones, they are not memoized
+	m_enabled = CDspDispConfigGuard::isConfigCacheEnabled() &&
+		(flags_ & (PGVLF_GET_STATE_INFO | PGVLF_GET_ONLY_IDENTITY_INFO));
+	m_key = qMakePair(session_->getAuthHelper().getUserName(), flags_);
+	if (m_enabled)
+		m_old = m_memo->take(m_key);
+}
+
+Probe::~Probe()
+{
+	if (m_enabled)
+		m_memo->put(m_key, m_new);
+}
+
+bool Probe::prepare(const CVmDirectoryItem& item_, Memo::Entry& dst_) const
+{
+	if (!m_enabled || PVT_CT == item_.getVmType())
+		return false;
+
+	CVmDirectoryItem i(&item_);
+	dst_.access = m_service->getAccessManager()
+		.checkAccess(m_session, PVE::DspCmdDirGetVmList, &i);
+	if (PRL_FAILED(dst_.access))
+		return false;
+
+	dst_.item = i.toString();
+	if (m_flags & PGVLF_GET_STATE_INFO)
+	{
+		QString u = item_.getVmUuid();
+		dst_.state = item_.isTemplate() ? VMS_STOPPED : CDspVm::getVmState(u,
+			CDspVmDirHelper::getVmDirUuidByVmUuid(u, m_session));
+	}
+	if (m_flags & PGVLF_GET_ONLY_IDENTITY_INFO)
+		return true;
+
+	dst_.config = m_service->getVmConfigManager()
+		.getSnapshot(item_.getVmHome(), m_session);
+	return !dst_.config.isNull();
+}
+
+boost::optional<QString> Probe::find(const QString& uuid_, const Memo::Entry& probe_)
+{
+	Memo::bucket_type::const_iterator p = m_old.constFind(uuid_);
+	if (p == m_old.constEnd() || !(p.value() == probe_))
+		return boost::none;
+
+	m_new.insert(uuid_, p.value());
+	return p.value().value;
+}
+
+void Probe::remember(const QString& uuid_, const Memo::Entry& value_)
+{
+	m_new.insert(uuid_, value_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Chain
 
@@ -4098,9 +4181,26 @@ PRL_RESULT Loop::handle(const CVmDirectory& directory_)
 
 	foreach (CVmDirectoryItem* i, directory_.m_lstVmDirectoryItems)
 	{
+		Memo::Entry m;
+		bool p = NULL != m_probe && m_probe->prepare(*i, m);
+		if (p)
+		{
+			boost::optional<QString> v = m_probe->find(i->getVmUuid(), m);
+			if (v)
+			{
+				deposit(v.get());
+				continue;
+			}
+		}
 		Item::Component::result_type x = m_loader->handle(*i);
-		if (x.isSucceed())
-			deposit(*x.value());
+		if (x.isFailed())
+			continue;
+
+		m.value = x.value()->toString();
+		if (p)
+			m_probe->remember(i->getVmUuid(), m);
+
+		deposit(m.value);
 	}
 	return PRL_ERR_SUCCESS;
 }
@@ -4209,7 +4309,8 @@ Chain* Factory::operator()(const session_type& session_, quint32 flags_) const
 	Item::Factory f(*m_service);
 	if (0 == m || (m & PVTF_VM))
 	{
-		Chain* y = new Template::Vm::Ordinary(f(session_, flags_));
+		Loop* y = new Template::Vm::Ordinary(f(session_, flags_));
+		y->setProbe(m_probe);
 		if (NULL == x)
 			output = y;
 		else
@@ -4217,12 +4318,17 @@ Chain* Factory::operator()(const session_type& session_, quint32 flags_) const
 
 		x = y;
 		y = new Vm::Ordinary(m_ephemeral, f(session_, flags_));
+		y->setProbe(m_probe);
 		x->setNext(y);
 		x = y;
 	}
 
 	if (x)
-		x->setNext(new Template::Vm::Ephemeral(m_ephemeral, f(session_, flags_)));
+	{
+		Loop* y = new Template::Vm::Ephemeral(m_ephemeral, f(session_, flags_));
+		y->setProbe(m_probe);
+		x->setNext(y);
+	}
 
 	return output;
 }
@@ -621,6 +621,7 @@ private:
 private:
 	Registry::Public& m_registry;
 	Vm::Directory::Ephemeral* m_ephemeral;
+	::List::Directory::Memo m_listMemo;
 	ExclusiveVmOperations	m_exclusiveVmOperations;
 	SmartPtr<CDspVmMountRegistry> m_vmMountRegistry;
 	QScopedPointer<CMultiEditMergeVmConfig> m_pVmConfigEdit;
@@ -41,6 +41,8 @@
 #define __CDspVmDirHelper_p_H_
 
 #include <boost/logic/tribool.hpp>
+#include <boost/optional.hpp>
+#include <QSharedPointer>
 
 namespace Task
 {
@@ -391,6 +393,68 @@ private:
 
 } // namespace Item
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Memo
+//
+// Serialized VM list entries of the previous enumeration per user and
+// flags. An entry is reused while the shared config snapshot, the directory
+// item, the access result and the VM state stay the same.
+
+struct Memo
+{
+	struct Entry
+	{
+		Entry(): access(PRL_ERR_UNINITIALIZED), state(VMS_UNKNOWN)
+		{
+		}
+
+		bool operator==(const Entry& other_) const;
+
+		PRL_RESULT access;
+		VIRTUAL_MACHINE_STATE state;
+		QString item;
+		QSharedPointer<const CVmConfiguration> config;
+		QString value;
+	};
+	typedef QHash<QString, Entry> bucket_type;
+	typedef QPair<QString, quint32> key_type;
+
+	bucket_type take(const key_type& key_);
+	void put(const key_type& key_, const bucket_type& value_);
+
+private:
+	QMutex m_mutex;
+	QHash<key_type, bucket_type> m_data;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Probe
+//
+// Memo access for one enumeration. Entries that are not visited are
+// dropped when the enumeration is over.
+
+struct Probe
+{
+	typedef Item::Component::session_type session_type;
+
+	Probe(CDspService& service_, const session_type& session_, quint32 flags_, Memo& memo_);
+	~Probe();
+
+	bool prepare(const CVmDirectoryItem& item_, Memo::Entry& dst_) const;
+	boost::optional<QString> find(const QString& uuid_, const Memo::Entry& probe_);
+	void remember(const QString& uuid_, const Memo::Entry& value_);
+
+private:
+	bool m_enabled;
+	quint32 m_flags;
+	CDspService* m_service;
+	session_type m_session;
+	Memo* m_memo;
+	Memo::key_type m_key;
+	Memo::bucket_type m_old;
+	Memo::bucket_type m_new;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Chain
 
@@ -416,6 +480,10 @@ protected:
 	{
 		m_result << item_.toString();
 	}
+	void deposit(const QString& item_)
+	{
+		m_result << item_;
+	}
 
 private:
 	QStringList m_result;
@@ -429,7 +497,15 @@ struct Loop: Chain
 {
 	typedef boost::function<bool (const CVmDirectory&)> predicate_type;
 
+	Loop(): m_probe()
+	{
+	}
+
 	PRL_RESULT handle(const CVmDirectory& directory_);
+	void setProbe(Probe* value_)
+	{
+		m_probe = value_;
+	}
 
 protected:
 	void setLoader(Item::Component* value_)
@@ -444,6 +520,7 @@ protected:
 private:
 	predicate_type m_predicate;
 	QScopedPointer<Item::Component> m_loader;
+	Probe* m_probe;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -533,8 +610,8 @@ struct Factory
 	typedef Chain::session_type session_type;
 	typedef ::Vm::Directory::Ephemeral::directoryList_type ephemeral_type;
 
-	Factory(CDspService& service_, const ephemeral_type& ephemeral_):
-		m_service(&service_), m_ephemeral(ephemeral_)
+	Factory(CDspService& service_, const ephemeral_type& ephemeral_, Probe* probe_ = NULL):
+		m_service(&service_), m_ephemeral(ephemeral_), m_probe(probe_)
 	{
 	}
 
@@ -543,6 +620,7 @@ struct Factory
 private:
 	CDspService* m_service;
 	ephemeral_type m_ephemeral;
+	Probe* m_probe;
 };
 
 } // namespace Directory
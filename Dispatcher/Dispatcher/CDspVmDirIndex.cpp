@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2015-2017, Parallels International GmbH
+ * Copyright (c) 2017-2019 Virtuozzo International GmbH. All rights reserved.
+ *
+ * This file is part of Virtuozzo Core. Virtuozzo Core is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later
+ * version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ *
+ * Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+ * Schaffhausen, Switzerland.
+ */
+
+#include "CDspVmDirIndex.h"
+#include <QDir>
+#include <prlcommon/PrlCommonUtilsBase/CFileHelper.h>
+
+namespace Vm
+{
+namespace Directory
+{
+///////////////////////////////////////////////////////////////////////////////
+// struct Index
+
+void Index::drop()
+{
+	m_valid = false;
+	m_directory.clear();
+	m_uuid.clear();
+	m_home.clear();
+	m_name.clear();
+}
+
+QString Index::normalize(const QString& home_)
+{
+	return QDir::cleanPath(home_);
+}
+
+void Index::build(const CVmDirectories& catalogue_)
+{
+	drop();
+	foreach (CVmDirectory* d, catalogue_.m_lstVmDirectory)
+	{
+		m_directory.insert(d->getUuid(), d);
+		foreach (CVmDirectoryItem* i, d->m_lstVmDirectoryItems)
+		{
+			// keep the first match like the linear search does
+			key_type k(d->getUuid(), i->getVmUuid());
+			if (!m_uuid.contains(k))
+				m_uuid.insert(k, i);
+			k.second = normalize(i->getVmHome());
+			if (!m_home.contains(k))
+				m_home.insert(k, i);
+			k.second = i->getVmName();
+			if (!m_name.contains(k))
+				m_name.insert(k, i);
+		}
+	}
+	m_valid = true;
+}
+
+CVmDirectory* Index::findDirectory(const CVmDirectories& catalogue_, const QString& dir_)
+{
+	if (!m_valid)
+		build(catalogue_);
+
+	CVmDirectory* output = m_directory.value(dir_);
+	if (NULL != output)
+		return output;
+
+	// directories may be added via the locked catalogue
+	output = const_cast<CVmDirectories& >(catalogue_).getVmDirectoryByUuid(dir_);
+	if (NULL != output)
+		build(catalogue_);
+
+	return output;
+}
+
+CVmDirectoryItem* Index::findByUuid(const CVmDirectories& catalogue_,
+	const QString& dir_, const QString& uuid_)
+{
+	CVmDirectory* d = findDirectory(catalogue_, dir_);
+	if (NULL == d)
+		return NULL;
+
+	CVmDirectoryItem* output = m_uuid.value(key_type(dir_, uuid_));
+	if (NULL != output && output->getVmUuid() == uuid_)
+		return output;
+
+	foreach (CVmDirectoryItem* i, d->m_lstVmDirectoryItems)
+	{
+		if (i->getVmUuid() == uuid_)
+		{
+			// the item has been added via a locked pointer
+			build(catalogue_);
+			return i;
+		}
+	}
+	return NULL;
+}
+
+CVmDirectoryItem* Index::findByHome(const CVmDirectories& catalogue_,
+	const QString& dir_, const QString& home_)
+{
+	CVmDirectory* d = findDirectory(catalogue_, dir_);
+	if (NULL == d)
+		return NULL;
+
+	CVmDirectoryItem* output = m_home.value(key_type(dir_, normalize(home_)));
+	if (NULL != output && CFileHelper::IsPathsEqual(output->getVmHome(), home_))
+		return output;
+
+	foreach (CVmDirectoryItem* i, d->m_lstVmDirectoryItems)
+	{
+		if (CFileHelper::IsPathsEqual(i->getVmHome(), home_))
+		{
+			// the home has been changed in place
+			build(catalogue_);
+			return i;
+		}
+	}
+	return NULL;
+}
+
+CVmDirectoryItem* Index::findByName(const CVmDirectories& catalogue_,
+	const QString& dir_, const QString& name_)
+{
+	CVmDirectory* d = findDirectory(catalogue_, dir_);
+	if (NULL == d)
+		return NULL;
+
+	CVmDirectoryItem* output = m_name.value(key_type(dir_, name_));
+	if (NULL != output && output->getVmName() == name_)
+		return output;
+
+	foreach (CVmDirectoryItem* i, d->m_lstVmDirectoryItems)
+	{
+		if (i->getVmName() == name_)
+		{
+			// the name has been changed in place
+			build(catalogue_);
+			return i;
+		}
+	}
+	return NULL;
+}
+
+} // namespace Directory
+} // namespace Vm
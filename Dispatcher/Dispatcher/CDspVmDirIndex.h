@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2015-2017, Parallels International GmbH
+ * Copyright (c) 2017-2019 Virtuozzo International GmbH. All rights reserved.
+ *
+ * This file is part of Virtuozzo Core. Virtuozzo Core is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later
+ * version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ *
+ * Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+ * Schaffhausen, Switzerland.
+ */
+
+#ifndef H__CDspVmDirIndex__H
+#define H__CDspVmDirIndex__H
+
+#include <QHash>
+#include <QPair>
+#include <QString>
+#include <prlxmlmodel/VmDirectory/CVmDirectories.h>
+
+namespace Vm
+{
+namespace Directory
+{
+///////////////////////////////////////////////////////////////////////////////
+// struct Index
+//
+// Hash lookup of the catalogue items. It is guarded by the catalogue mutex
+// and is rebuilt lazily after a structural change of the catalogue. Names
+// and homes may be changed via locked pointers behind our back thus hits
+// are verified. Items may be added via locked pointers too thus misses
+// fall back to the linear search. Uuids of the registered items never
+// change.
+
+struct Index
+{
+	Index(): m_valid(false)
+	{
+	}
+
+	void drop();
+	CVmDirectory* findDirectory(const CVmDirectories& catalogue_, const QString& dir_);
+	CVmDirectoryItem* findByUuid(const CVmDirectories& catalogue_,
+		const QString& dir_, const QString& uuid_);
+	CVmDirectoryItem* findByHome(const CVmDirectories& catalogue_,
+		const QString& dir_, const QString& home_);
+	CVmDirectoryItem* findByName(const CVmDirectories& catalogue_,
+		const QString& dir_, const QString& name_);
+
+private:
+	typedef QPair<QString, QString> key_type;
+	typedef QHash<key_type, CVmDirectoryItem* > map_type;
+
+	static QString normalize(const QString& home_);
+	void build(const CVmDirectories& catalogue_);
+
+	bool m_valid;
+	QHash<QString, CVmDirectory* > m_directory;
+	map_type m_uuid;
+	map_type m_home;
+	map_type m_name;
+};
+
+} // namespace Directory
+} // namespace Vm
+
+#endif // H__CDspVmDirIndex__H
@@ -34,10 +34,12 @@
 
 #include <prlcommon/Std/PrlAssert.h>
 #include "CDspVzHelper.h"
+#include <QDir>
 
 
 CDspVmDirManager::CDspVmDirManager(::Vm::Directory::Ephemeral& ephemeral_):
-	m_mutex(QMutex::Recursive), m_ephemeral(&ephemeral_)
+	m_mutex(QMutex::Recursive), m_ephemeral(&ephemeral_),
+	m_generation(0), m_savedGeneration(0)
 {
 }
 
@@ -68,14 +70,20 @@ CDspVmDirManager::getVmDirCatalogue()
 	return CDspLockedPointer<CVmDirectories>( &m_mutex, &m_vmDirCatalogue );
 }
 
+CDspLockedPointer<CVmDirectories>
+CDspVmDirManager::lockCatalogue()
+{
+	return CDspLockedPointer<CVmDirectories>( &m_mutex, &m_vmDirCatalogue );
+}
+
 CDspLockedPointer<CVmDirectory>
 CDspVmDirManager::getVmDirectory( const QString& dirUuid )
 {
 	// lock before start search
 	CDspLockedPointer<CVmDirectories>
-		vmDirCatalogue = getVmDirCatalogue();
+		vmDirCatalogue = lockCatalogue();
 
-	CVmDirectory* pVmDir = vmDirCatalogue->getVmDirectoryByUuid( dirUuid );
+	CVmDirectory* pVmDir = m_index.findDirectory( *vmDirCatalogue, dirUuid );
 	if ( !pVmDir )
 		WRITE_TRACE(DBG_FATAL, "can't found VmDirectory by uuid=%s", QSTR2UTF8( dirUuid ) );
 
@@ -96,15 +104,7 @@ CDspVmDirManager::getVmDirItemByUuid(	const QString& dirUuid,
 		return CDspLockedPointer<CVmDirectoryItem>( &m_mutex, 0);
 	}
 
-	CVmDirectoryItem* pItem = NULL;
-	QListIterator<CVmDirectoryItem*> it( pVmDir->m_lstVmDirectoryItems );
-	while ( it.hasNext() && !pItem )
-	{
-		pItem = it.next();
-		if ( pItem->getVmUuid() != vmUuid )
-			pItem = NULL;
-	}
-
+	CVmDirectoryItem* pItem = m_index.findByUuid( m_vmDirCatalogue, dirUuid, vmUuid );
 	return CDspLockedPointer<CVmDirectoryItem>( &m_mutex, pItem );
 }
 
@@ -124,15 +124,7 @@ CDspVmDirManager::getVmDirItemByHome(
 		return CDspLockedPointer<CVmDirectoryItem>( &m_mutex, 0);
 	}
 
-	CVmDirectoryItem* pItem = NULL;
-	QListIterator<CVmDirectoryItem*> it( pVmDir->m_lstVmDirectoryItems );
-	while ( it.hasNext() && !pItem )
-	{
-		pItem = it.next();
-		if ( !CFileHelper::IsPathsEqual(pItem->getVmHome(), vmHome ) )
-			pItem = NULL;
-	}
-
+	CVmDirectoryItem* pItem = m_index.findByHome( m_vmDirCatalogue, dirUuid, vmHome );
 	return CDspLockedPointer<CVmDirectoryItem>( &m_mutex, pItem );
 }
 
@@ -163,16 +155,7 @@ CDspVmDirManager::getVmDirItemByName(
 		return CDspLockedPointer<CVmDirectoryItem>( &m_mutex, 0);
 	}
 
-	CVmDirectoryItem* pItem = NULL;
-	QListIterator<CVmDirectoryItem*> it( pVmDir->m_lstVmDirectoryItems );
-	while ( it.hasNext() && !pItem )
-	{
-		pItem = it.next();
-		if ( pItem->getVmName() == vmName )
-			break;
-		pItem = NULL;
-	}
-
+	CVmDirectoryItem* pItem = m_index.findByName( m_vmDirCatalogue, dirUuid, vmName );
 	return CDspLockedPointer<CVmDirectoryItem>( &m_mutex, pItem );
 }
 
@@ -200,16 +183,19 @@ PRL_RESULT CDspVmDirManager::addNewVmDirectory( CVmDirectory* pVmDir )
 	if ( ! pVmDir )
 		return PRL_ERR_INVALID_PARAM;
 
-	//LOCK before use
-	CDspLockedPointer<CVmDirectories> pCatalogue = getVmDirCatalogue();
-
-	if ( pCatalogue->getVmDirectoryByUuid( pVmDir->getUuid() ) )
 	{
-		WRITE_TRACE(DBG_FATAL, "PRL_ERR_VMDIR_ALREADY_EXIST [%s]", QSTR2UTF8( pVmDir->getUuid() ) );
-		return PRL_ERR_VM_DIR_CONFIG_ALREADY_EXISTS;
-	}
+		//LOCK before use
+		CDspLockedPointer<CVmDirectories> pCatalogue = lockCatalogue();
+
+		if ( pCatalogue->getVmDirectoryByUuid( pVmDir->getUuid() ) )
+		{
+			WRITE_TRACE(DBG_FATAL, "PRL_ERR_VMDIR_ALREADY_EXIST [%s]", QSTR2UTF8( pVmDir->getUuid() ) );
+			return PRL_ERR_VM_DIR_CONFIG_ALREADY_EXISTS;
+		}
 
-	pCatalogue->addVmDirectory( pVmDir );
+		pCatalogue->addVmDirectory( pVmDir );
+		m_index.drop();
+	}
 
 	return saveVmDirCatalogue();
 }
@@ -219,39 +205,38 @@ PRL_RESULT CDspVmDirManager::addVmDirItem( const QString& dirUuid, CVmDirectoryI
 	if ( ! pVmDirItem )
 		return PRL_ERR_INVALID_PARAM;
 
-	CDspLockedPointer<CVmDirectory>
-		pVmDirectory = getVmDirectory( dirUuid );
+	{
+		CDspLockedPointer<CVmDirectory>
+			pVmDirectory = getVmDirectory( dirUuid );
 
-	if ( ! pVmDirectory )
-		return PRL_ERR_VM_DIRECTORY_NOT_EXIST;
+		if ( ! pVmDirectory )
+			return PRL_ERR_VM_DIRECTORY_NOT_EXIST;
 
 
-	// WE MUST CHECK VM UUID for valid work with deleteVmDirItem() method.
-	//  (allowed only original vm_uuid in vm directory. )
-	//
-	CDspLockedPointer<CVmDirectoryItem>
-		pExistsItem = CDspVmDirManager::getVmDirItemByUuid( dirUuid, pVmDirItem->getVmUuid() );
+		// WE MUST CHECK VM UUID for valid work with deleteVmDirItem() method.
+		//  (allowed only original vm_uuid in vm directory. )
+		//
+		CDspLockedPointer<CVmDirectoryItem>
+			pExistsItem = CDspVmDirManager::getVmDirItemByUuid( dirUuid, pVmDirItem->getVmUuid() );
 
-	if ( pExistsItem )
-		return PRL_ERR_ENTRY_ALREADY_EXISTS;
+		if ( pExistsItem )
+			return PRL_ERR_ENTRY_ALREADY_EXISTS;
 
-	pVmDirectory->addVmDirectoryItem( pVmDirItem );
+		pVmDirectory->addVmDirectoryItem( pVmDirItem );
+		m_index.drop();
+	}
 
+	// NB. the catalogue is unlocked during the disk io
 	PRL_RESULT res = saveVmDirCatalogue();
 
 	if ( ! PRL_SUCCEEDED( res ) )
 	{
 		// rollback
-		QMutableListIterator<CVmDirectoryItem*> it( pVmDirectory->m_lstVmDirectoryItems );
-		while ( it.hasNext() )
-		{
-			CVmDirectoryItem* pItem = it.next();
-			if ( pItem != pVmDirItem )
-				continue;
-
-			it.remove();
-			break;
-		}
+		CDspLockedPointer<CVmDirectory>
+			pVmDirectory = getVmDirectory( dirUuid );
+		if ( pVmDirectory )
+			pVmDirectory->m_lstVmDirectoryItems.removeOne( pVmDirItem );
+		m_index.drop();
 	}
 	else
 	{
@@ -267,36 +252,35 @@ PRL_RESULT CDspVmDirManager::addVmDirItem( const QString& dirUuid, CVmDirectoryI
 
 PRL_RESULT CDspVmDirManager::deleteVmDirItem( const QString& dirUuid, const QString& vmUuid )
 {
-	CDspLockedPointer<CVmDirectory>
-		pVmDir = getVmDirectory( dirUuid );
-
-	if ( ! pVmDir )
-		return PRL_ERR_VM_DIRECTORY_NOT_EXIST;
-
 	CVmDirectoryItem* pItem = NULL;
-	QMutableListIterator<CVmDirectoryItem*> it( pVmDir->m_lstVmDirectoryItems );
-	while ( it.hasNext() && !pItem )
 	{
-		pItem = it.next();
-		if ( pItem->getVmUuid() != vmUuid )
-		{
-			pItem = NULL;
-			continue;
-		}
+		CDspLockedPointer<CVmDirectory>
+			pVmDir = getVmDirectory( dirUuid );
 
-		it.remove();
-		break;
-	}
+		if ( ! pVmDir )
+			return PRL_ERR_VM_DIRECTORY_NOT_EXIST;
 
-	if( ! pItem )
-		return PRL_ERR_ENTRY_DOES_NOT_EXIST;
+		pItem = m_index.findByUuid( m_vmDirCatalogue, dirUuid, vmUuid );
+		if( ! pItem )
+			return PRL_ERR_ENTRY_DOES_NOT_EXIST;
+
+		pVmDir->m_lstVmDirectoryItems.removeOne( pItem );
+		m_index.drop();
+	}
 
+	// NB. the catalogue is unlocked during the disk io
 	PRL_RESULT res = saveVmDirCatalogue();
 
 	if ( ! PRL_SUCCEEDED( res ) )
 	{
 		// rollback
-		pVmDir->addVmDirectoryItem( pItem );
+		CDspLockedPointer<CVmDirectory>
+			pVmDir = getVmDirectory( dirUuid );
+		if ( pVmDir )
+			pVmDir->addVmDirectoryItem( pItem );
+		else
+			delete pItem;
+		m_index.drop();
 	}
 	else
 	{
@@ -325,27 +309,42 @@ PRL_RESULT CDspVmDirManager::deleteVmDirItem( const QString& dirUuid, const QStr
 
 PRL_RESULT CDspVmDirManager::saveVmDirCatalogue()
 {
-	CDspLockedPointer<CVmDirectories> pCatalogue = getVmDirCatalogue();
-	CVmDirectories x(pCatalogue.getPtr());
+	QScopedPointer<CVmDirectories> x;
+	QString p;
+	quint64 g;
+	{
+		// publish a snapshot and release the catalogue before the disk io
+		CDspLockedPointer<CVmDirectories> pCatalogue = lockCatalogue();
+		x.reset(new CVmDirectories(pCatalogue.getPtr()));
+		p = m_vmDirCatalogueFile;
+		g = ++m_generation;
+	}
 	QList<CVmDirectory* > y;
-	x.m_lstVmDirectory.swap(y);
-	QSet<QString> g = m_ephemeral->snapshot();
+	x->m_lstVmDirectory.swap(y);
+	QSet<QString> e = m_ephemeral->snapshot();
 	foreach (CVmDirectory* d, y)
 	{
-		if (g.contains(d->getUuid()))
+		if (e.contains(d->getUuid()))
 			delete d;
 		else
-			x.m_lstVmDirectory << d;
+			x->m_lstVmDirectory << d;
 	}
-	QFile f(m_vmDirCatalogueFile);
-	PRL_RESULT e = x.saveToFile(&f);
-	if (PRL_FAILED(e))
+
+	QMutexLocker s(&m_saveMutex);
+	// a later snapshot has already been saved
+	if (g < m_savedGeneration)
+		return PRL_ERR_SUCCESS;
+
+	QFile f(p);
+	PRL_RESULT r = x->saveToFile(&f);
+	if (PRL_FAILED(r))
 	{
 		WRITE_TRACE(DBG_FATAL, "Error %s on save VM catalogue file. Reason: %ld: %s. path = '%s'",
-			PRL_RESULT_TO_STRING(e), Prl::GetLastError(),
-			QSTR2UTF8(Prl::GetLastErrorAsString()), QSTR2UTF8(m_vmDirCatalogueFile));
+			PRL_RESULT_TO_STRING(r), Prl::GetLastError(),
+			QSTR2UTF8(Prl::GetLastErrorAsString()), QSTR2UTF8(p));
 		return PRL_ERR_SAVE_VM_CATALOG;
 	}
+	m_savedGeneration = g;
 	return PRL_ERR_SUCCESS;
 }
 
@@ -660,24 +659,27 @@ PRL_RESULT CDspVmDirManager::initVzDirCatalogue()
 		return result;
 	}
 
-	// Lock the Catalogue
-	CDspLockedPointer<CVmDirectories> pCatalogue = getVmDirCatalogue();
-
-	for (int i = 0; i < pCatalogue->m_lstVmDirectory.count(); i++)
 	{
-		CVmDirectory *pDir = pCatalogue->m_lstVmDirectory[i];
-		if (pDir->getUuid() == getVzDirectoryUuid())
+		// Lock the Catalogue
+		CDspLockedPointer<CVmDirectories> pCatalogue = lockCatalogue();
+
+		for (int i = 0; i < pCatalogue->m_lstVmDirectory.count(); i++)
 		{
-			delete pDir;
-			pCatalogue->m_lstVmDirectory.removeAt(i);
-			break;
+			CVmDirectory *pDir = pCatalogue->m_lstVmDirectory[i];
+			if (pDir->getUuid() == getVzDirectoryUuid())
+			{
+				delete pDir;
+				pCatalogue->m_lstVmDirectory.removeAt(i);
+				break;
+			}
 		}
-	}
 
-	pCatalogue->addVmDirectory( pVzDir );
+		pCatalogue->addVmDirectory( pVzDir );
+		m_index.drop();
 
-	foreach(CVmDirectoryItem *pItem, pVzDir->m_lstVmDirectoryItems)
-		CVzHelper::update_ctid_map(pItem->getVmUuid(), pItem->getCtId());
+		foreach(CVmDirectoryItem *pItem, pVzDir->m_lstVmDirectoryItems)
+			CVzHelper::update_ctid_map(pItem->getVmUuid(), pItem->getCtId());
+	}
 
 	result = saveVmDirCatalogue();
 
@@ -691,7 +693,7 @@ PRL_RESULT CDspVmDirManager::initTemplatesDirCatalogue()
 {
 	WRITE_TRACE(DBG_FATAL, "initTemplatesDirCatalogue");
 
-	CDspLockedPointer<CVmDirectories> catalogue(getVmDirCatalogue());
+	CDspLockedPointer<CVmDirectories> catalogue(lockCatalogue());
 	QList<CVmDirectory *>::iterator last(catalogue->m_lstVmDirectory.end());
 	QList<CVmDirectory *>::iterator it(std::find_if(
 				catalogue->m_lstVmDirectory.begin(), last,
@@ -752,6 +754,8 @@ PRL_RESULT CDspVmDirManager::setCatalogueFileName(const QString& value_)
 		return PRL_ERR_SUCCESS;
 
 	QFile f(value_);
+	// the load replaces the items even if it fails
+	m_index.drop();
 	PRL_RESULT e = 	m_vmDirCatalogue.loadFromFile(&f);
 	if (PRL_FAILED(e))
 	{
@@ -814,6 +818,7 @@ PRL_RESULT Ephemeral::remove(const QString& uid_)
 		return PRL_ERR_INVALID_HANDLE;
 
 	a->m_lstVmDirectory.removeOne(d);
+	m_service->getVmDirManager().m_index.drop();
 	delete d;
 	m_directoryList.remove(uid_);
 
@@ -853,18 +858,18 @@ namespace Dao
 ///////////////////////////////////////////////////////////////////////////////
 // struct Locked
 
-Locked::Locked(): m_service(CDspService::instance()->getVmDirManager().getVmDirCatalogue())
+Locked::Locked(): m_service(CDspService::instance()->getVmDirManager().lockCatalogue())
 {
 }
 
-Locked::Locked(CDspVmDirManager& manager_): m_service(manager_.getVmDirCatalogue())
+Locked::Locked(CDspVmDirManager& manager_): m_service(manager_.lockCatalogue())
 {
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 // struct Free
 
-Free::Free(): m_service(CDspService::instance()->getVmDirManager().getVmDirCatalogue().getPtr())
+Free::Free(): m_service(CDspService::instance()->getVmDirManager().lockCatalogue().getPtr())
 {
 }
 
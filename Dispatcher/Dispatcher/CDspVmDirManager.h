@@ -26,6 +26,7 @@
 #define H__CDspVmDirManager__H
 
 #include "CDspSync.h"
+#include "CDspVmDirIndex.h"
 #include <prlxmlmodel/VmDirectory/CVmDirectories.h>
 #include "CDspClient.h"
 #include <prlsdk/PrlEnums.h>
@@ -259,6 +260,9 @@ class CDspVmDirManager
 	friend class CDspVmDirHelper;
 	friend class CDspVmSnapshotStoreHelper;
 	friend class CDspVm;
+	friend struct ::Vm::Directory::Ephemeral;
+	friend struct ::Vm::Directory::Dao::Locked;
+	friend struct ::Vm::Directory::Dao::Free;
 
 public:
 	explicit CDspVmDirManager(::Vm::Directory::Ephemeral& ephemeral_);
@@ -404,10 +408,19 @@ protected:
 	PRL_RESULT deleteVmDirItem( const QString& dirUuid, const QString& vmUuid);
 
 private:
+	// catalogue access for the manager itself that keeps the index
+	CDspLockedPointer<CVmDirectories> lockCatalogue();
+
 	QMutex	m_mutex;
 	QString m_vmDirCatalogueFile;
 	CVmDirectories m_vmDirCatalogue;
 	::Vm::Directory::Ephemeral* m_ephemeral;
+	::Vm::Directory::Index m_index;
+	// catalogue saves are made from a copy outside of m_mutex.
+	// the generation orders them.
+	QMutex m_saveMutex;
+	quint64 m_generation;
+	quint64 m_savedGeneration;
 };
 
 #endif //H__CDspVmDirManager__H
@@ -38,18 +38,42 @@
 #include <QHash>
 #include <QDateTime>
 #include <QPair>
+#include <QSharedPointer>
 
 class CDspClient;
 
+///////////////////////////////////////////////////////////////////////////////
+// struct CacheStatistics
+
+struct CacheStatistics
+{
+	CacheStatistics(): hits(), misses(), copies(), invalidations()
+	{
+	}
+
+	quint64 hits;
+	quint64 misses;
+	// number of deep copies of cached objects handed out to callers
+	quint64 copies;
+	// number of entries dropped due to the changes on disk
+	quint64 invalidations;
+};
+
 template <class T>
 class CacheBase
 {
 public:
+			typedef QSharedPointer<const T> snapshot_type;
+
 				// FIXME: for Windows we should store path with username:
 				//		Network shares can be mounted to the same Disk letter from different users!
 			virtual SmartPtr<T> getFromCache( const QString& strFileName, SmartPtr<CDspClient> pUserSession ) = 0;
 			virtual void updateCache( const QString& path
 				, const SmartPtr<T>& pConfig, SmartPtr<CDspClient> pUserSession) = 0;
+			// NB. the snapshot is shared between all readers and must never
+			// be modified. use getFromCache() to obtain a private copy.
+			virtual snapshot_type getSnapshot( const QString& strFileName, SmartPtr<CDspClient> pUserSession ) = 0;
+			virtual CacheStatistics getStatistics() const = 0;
 
 			virtual ~CacheBase() {}
 };
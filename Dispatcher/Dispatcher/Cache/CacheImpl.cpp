@@ -40,25 +40,44 @@
 #include <prlcommon/HostUtils/HostUtils.h>
 #include <prlcommon/Std/PrlTime.h>
 #include <prlcommon/Interfaces/VirtuozzoDomModel.h>
+#include <boost/bind.hpp>
+#ifdef _LIN_
+#include <sys/stat.h>
+#endif // _LIN_
 
 
 template<class T> Cache<T>::FileTimestamp::FileTimestamp ( const QString& sPath )
-: dt( QFileInfo(sPath).lastModified() )
+: m_sec(), m_nsec(), m_inode(), m_size(-1)
 {
-}
+#ifdef _LIN_
+	struct stat st;
+	if (::stat(QSTR2UTF8(sPath), &st))
+		return;
 
-template<class T> Cache<T>::FileTimestamp::FileTimestamp ( const FileTimestamp& ts )
-:dt( ts.dt )
-{
+	m_sec = st.st_mtim.tv_sec;
+	m_nsec = st.st_mtim.tv_nsec;
+	m_inode = st.st_ino;
+	m_size = st.st_size;
+#else // _LIN_
+	QFileInfo f(sPath);
+	if (!f.exists())
+		return;
+
+	m_sec = f.lastModified().toMSecsSinceEpoch() / 1000;
+	m_nsec = (f.lastModified().toMSecsSinceEpoch() % 1000) * 1000000;
+	m_size = f.size();
+#endif // _LIN_
 }
 
 template<class T> QString Cache<T>::FileTimestamp::toString() const
 {
-	return dt.toString(XML_DATETIME_FORMAT_LONG);
+	return QString("%1.%2 inode %3 size %4").arg(m_sec)
+		.arg(m_nsec, 9, 10, QChar('0')).arg(m_inode).arg(m_size);
 }
 template<class T> bool Cache<T>::FileTimestamp::operator==(const FileTimestamp& ts) const
 {
-	return dt == ts.dt;
+	return m_sec == ts.m_sec && m_nsec == ts.m_nsec &&
+		m_inode == ts.m_inode && m_size == ts.m_size;
 }
 template<class T> bool Cache<T>::FileTimestamp::operator!=(const FileTimestamp& ts) const
 {
@@ -68,7 +87,7 @@ template<class T> bool Cache<T>::FileTimestamp::operator!=(const FileTimestamp&
 template<class T> Cache<T>::ConfigInfo::ConfigInfo(
 	const SmartPtr<T>& pConfigOrig, const FileTimestamp& ts )
 : pConfig( new T( pConfigOrig.getImpl() ) )
-	, dtChangeTime(ts)
+	, dtChangeTime(ts), watched(false)
 {
 	lastAccess = PrlGetTickCount64();
 	PRL_ASSERT(pConfigOrig);
@@ -76,13 +95,14 @@ template<class T> Cache<T>::ConfigInfo::ConfigInfo(
 
 template<> Cache<CVmConfiguration>::ConfigInfo::ConfigInfo(
 	const SmartPtr<CVmConfiguration>& pConfigOrig, const FileTimestamp& ts )
-: pConfig( new CVmConfiguration( pConfigOrig.getImpl() ) )
-	, dtChangeTime(ts)
+	: dtChangeTime(ts), watched(false)
 {
 	lastAccess = PrlGetTickCount64();
-	// will keep only absolute paths in cache (https://jira.sw.ru/browse/PSBM-13477)
-	pConfig->setAbsolutePath();
 	PRL_ASSERT(pConfigOrig);
+	CVmConfiguration* x = new CVmConfiguration( pConfigOrig.getImpl() );
+	// will keep only absolute paths in cache (https://jira.sw.ru/browse/PSBM-13477)
+	x->setAbsolutePath();
+	pConfig = snapshot_type(x);
 }
 
 template<class T>
@@ -100,10 +120,18 @@ Cache<T>::makeKey( const QString& path, SmartPtr<CDspClient> pClient ) const
  return qMakePair(userName, path) ;
 }
 
-template<class T> Cache<T>::Cache(int ttlSec )
+template<class T> Cache<T>::Cache(int ttlSec ): m_hits(0), m_misses(0), m_copies(0), m_invalidations(0)
 {
+	// construct the watcher first to destroy it after this cache
+	CacheWatcher::instance();
 	m_ttl = ttlSec * PrlGetTicksPerSecond();
 	m_nextTtlCheck = m_ttl ? PrlGetTickCount64() + m_ttl : 0;
+	m_nextTrace = PrlGetTickCount64() + TRACE_PERIOD_SEC * PrlGetTicksPerSecond();
+}
+
+template<class T> Cache<T>::~Cache()
+{
+	CacheWatcher::instance().forget(this);
 }
 
 template<class T>
@@ -112,7 +140,8 @@ void Cache<T>::ttlCheck()
 	QStringList keys;
 
 	{
-		QWriteLocker locker(&m_rwHashLock);
+		// NB. the sweep only reads the hash, readers are not blocked
+		QReadLocker locker(&m_rwHashLock);
 		PRL_UINT64 t = PrlGetTickCount64() - m_ttl;
 
 		typename QHash<CacheKey, ConfigInfo>::const_iterator it = m_hashConfigs.constBegin();
@@ -121,21 +150,54 @@ void Cache<T>::ttlCheck()
 				keys += it.key().second;
 			++it;
 		}
-		m_nextTtlCheck = PrlGetTickCount64() + (m_ttl / 2);
 	}
 
 	foreach (QString key, keys)
 		updateCache(key, SmartPtr<T>(0), SmartPtr<CDspClient>(0));
 }
 
-template<class T> SmartPtr<T> Cache<T>::getFromCache( const QString& strFileName, SmartPtr<CDspClient> pUserSession )
+template<class T>
+void Cache<T>::traceStatistics() const
+{
+	CacheStatistics s = getStatistics();
+	WRITE_TRACE(DBG_INFO, "config cache statistics: hits %llu, misses %llu, copies %llu, invalidations %llu",
+		s.hits, s.misses, s.copies, s.invalidations);
+}
+
+template<class T>
+void Cache<T>::invalidate( const QString& path )
+{
+	CacheKey key = makeKey(path, SmartPtr<CDspClient>(0));
+	FileTimestamp ts(path);
+
+	QWriteLocker locker(&m_rwHashLock);
+	typename QHash<CacheKey, ConfigInfo>::iterator it = m_hashConfigs.find(key);
+	// NB. our own updates are reported too. keep the entry if it
+	// matches the file on disk.
+	if (it == m_hashConfigs.end() || it->dtChangeTime == ts)
+		return;
+
+	m_hashConfigs.erase(it);
+	m_invalidations.fetchAndAddRelaxed(1);
+	WRITE_TRACE(DBG_DEBUG, "Config %s was changed on disk and dropped from the cache",
+		QSTR2UTF8(path));
+}
+
+template<class T>
+typename Cache<T>::snapshot_type Cache<T>::find( const QString& strFileName, SmartPtr<CDspClient> pUserSession )
 {
 	if( !CDspDispConfigGuard::isConfigCacheEnabled() )
-		return SmartPtr<T>();
+		return snapshot_type();
 
-	if (m_ttl != 0 && m_nextTtlCheck < PrlGetTickCount64())
+	quint64 n = m_nextTtlCheck.load(), now = PrlGetTickCount64();
+	// only one of the concurrent readers does the sweep
+	if (m_ttl != 0 && n < now && m_nextTtlCheck.testAndSetOrdered(n, now + (m_ttl / 2)))
 		ttlCheck();
 
+	n = m_nextTrace.load();
+	if (n < now && m_nextTrace.testAndSetOrdered(n, now + TRACE_PERIOD_SEC * PrlGetTicksPerSecond()))
+		traceStatistics();
+
 	QReadLocker locker(&m_rwHashLock);
 
 	// FIXME: Need compare by QFileInfo ??
@@ -143,16 +205,45 @@ template<class T> SmartPtr<T> Cache<T>::getFromCache( const QString& strFileName
 	// FIXME3: We think NOT! All configs are unique because they have got from VmDirectory, but VmDirectory contains unique paths
 	CacheKey key = makeKey(strFileName, pUserSession);
 	typename QHash<CacheKey, ConfigInfo>::const_iterator cIt = m_hashConfigs.constFind(key);
-	if(cIt != m_hashConfigs.constEnd())
+	if(cIt != m_hashConfigs.constEnd() &&
+		(cIt->watched || cIt->dtChangeTime == FileTimestamp(strFileName)))
 	{
 		LOG_MESSAGE( DBG_FATAL, "xxx ZZZ-2: Config was got from cache. path = %s", QSTR2UTF8(strFileName) );
+		m_hits.fetchAndAddRelaxed(1);
 		cIt->lastAccess = PrlGetTickCount64();
-		SmartPtr<T> pConfig( new T( cIt->pConfig.getImpl() ) );
-		return pConfig;
+		return cIt->pConfig;
 	}
 	LOG_MESSAGE( DBG_FATAL, "xxx WWW: Config was NOT got from cache. path = %s", QSTR2UTF8(strFileName) );
+	m_misses.fetchAndAddRelaxed(1);
+
+	return snapshot_type();
+}
+
+template<class T> SmartPtr<T> Cache<T>::getFromCache( const QString& strFileName, SmartPtr<CDspClient> pUserSession )
+{
+	snapshot_type x = find(strFileName, pUserSession);
+	if (x.isNull())
+		return SmartPtr<T>(0);
 
-	return SmartPtr<T>(0);
+	// the copy is made outside of the hash lock
+	m_copies.fetchAndAddRelaxed(1);
+	return SmartPtr<T>( new T( const_cast<T* >(x.data()) ) );
+}
+
+template<class T>
+typename Cache<T>::snapshot_type Cache<T>::getSnapshot( const QString& strFileName, SmartPtr<CDspClient> pUserSession )
+{
+	return find(strFileName, pUserSession);
+}
+
+template<class T> CacheStatistics Cache<T>::getStatistics() const
+{
+	CacheStatistics output;
+	output.hits = m_hits.load();
+	output.misses = m_misses.load();
+	output.copies = m_copies.load();
+	output.invalidations = m_invalidations.load();
+	return output;
 }
 
 template<class T> void Cache<T>::updateCache( const QString& path
@@ -165,15 +256,25 @@ template<class T> void Cache<T>::updateCache( const QString& path
 	if(key.second.isEmpty()) // if path.isEmpty
 		return;
 
-	QWriteLocker locker(&m_rwHashLock);
 	if(pConfig.isValid())
 	{
-		m_hashConfigs.insert(key, ConfigInfo(pConfig, FileTimestamp(path)));
+		// subscribe before the timestamp is taken not to miss
+		// a change in between.
+		bool w = CacheWatcher::instance().watch(path, this,
+			boost::bind(&Cache<T>::invalidate, this, _1));
+		// build the new version before taking the lock. readers keep
+		// their references to the previous one until they are done.
+		ConfigInfo x(pConfig, FileTimestamp(path));
+		x.watched = w;
+		QWriteLocker locker(&m_rwHashLock);
+		m_hashConfigs.insert(key, x);
 		LOG_MESSAGE(DBG_FATAL, "xxx XXX: Config was updated in cache. key= %s+%s",
 			qPrintable(key.second), qPrintable(key.first));
 	}
 	else
 	{
+		CacheWatcher::instance().forget(path, this);
+		QWriteLocker locker(&m_rwHashLock);
 		m_hashConfigs.remove(key);
 		LOG_MESSAGE(DBG_FATAL, "xxx XXX: Config was removed from cache. key= %s+%s",
 			qPrintable(key.second), qPrintable(key.first));
@@ -33,6 +33,8 @@
 #pragma once
 
 #include "Cache.h"
+#include "CacheWatcher.h"
+#include <QAtomicInteger>
 
 namespace {
 template<class T>
@@ -40,34 +42,45 @@ class Cache : public CacheBase< T>
 {
 		public:
 			Cache(int ttlSec = 0);
+			~Cache();
 			SmartPtr<T> getFromCache( const QString& strFileName, SmartPtr<CDspClient> pUserSession );
 			void updateCache( const QString& path
 				, const SmartPtr<T>& pConfig, SmartPtr<CDspClient> pUserSession);
+			typename CacheBase<T>::snapshot_type getSnapshot( const QString& strFileName, SmartPtr<CDspClient> pUserSession );
+			CacheStatistics getStatistics() const;
 
 		private:
+			typedef typename CacheBase<T>::snapshot_type snapshot_type;
+
 			struct	FileTimestamp
 			{
-				FileTimestamp ( const QString& sPath );
-				FileTimestamp ( const FileTimestamp& ts );
+				explicit FileTimestamp ( const QString& sPath );
 
 				QString toString() const;
 				bool operator==(const FileTimestamp& ts) const;
 				bool operator!=(const FileTimestamp& ts) const;
-				FileTimestamp& operator=(const FileTimestamp& changeTime) = default;
 			private:
-				// QDateTime implementation has low precession ( time without millisecs (on linux ) )
-				// It should be improved
-				QDateTime dt;
+				// nanoseconds together with the inode and the size catch
+				// the changes made within the same second as well as the
+				// file replacements by rename.
+				qint64 m_sec;
+				qint64 m_nsec;
+				quint64 m_inode;
+				qint64 m_size;
 			};
 			struct ConfigInfo
 			{
 				ConfigInfo(  const SmartPtr<T>& pConfig, const FileTimestamp& changeTime );
-				SmartPtr<T> pConfig;
+				// immutable version of the object published to readers.
+				// an update replaces the whole snapshot and never touches
+				// the previous one that may still be in use.
+				snapshot_type pConfig;
 				FileTimestamp dtChangeTime;
 				mutable PRL_UINT64 lastAccess;
+				// the file is watched by CacheWatcher. otherwise its
+				// timestamp is validated on every hit.
+				bool watched;
 				ConfigInfo& operator=(const ConfigInfo& configInfo) = default;
-
-				// FIXME: Need check also for Config ModificationTime - in PSBM on PCS we have disabled ConfigWatcher.
 			};
 		private:
 			// NOTE:
@@ -77,6 +90,9 @@ class Cache : public CacheBase< T>
 			CacheKey makeKey( const QString& path, SmartPtr<CDspClient> pClient ) const;
 
 			void ttlCheck();
+			void traceStatistics() const;
+			void invalidate( const QString& path );
+			snapshot_type find( const QString& strFileName, SmartPtr<CDspClient> pUserSession );
 
 		private:
 			QReadWriteLock	m_rwHashLock;
@@ -84,7 +100,15 @@ class Cache : public CacheBase< T>
 
 			/* time in ticks */
 			int m_ttl;
-			PRL_UINT64 m_nextTtlCheck;
+			QAtomicInteger<quint64> m_nextTtlCheck;
+			// the counters are traced on their own period regardless of the ttl
+			enum { TRACE_PERIOD_SEC = 600 };
+			QAtomicInteger<quint64> m_nextTrace;
+
+			QAtomicInteger<quint64> m_hits;
+			QAtomicInteger<quint64> m_misses;
+			QAtomicInteger<quint64> m_copies;
+			QAtomicInteger<quint64> m_invalidations;
 };
 
 #include "CacheImpl.cpp"
@@ -0,0 +1,296 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @file CacheWatcher.cpp
+///
+/// Invalidation of cached configs by file system notifications.
+///
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "CacheWatcher.h"
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <prlcommon/Logging/Logging.h>
+
+#ifdef _LIN_
+#include <sys/inotify.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+namespace
+{
+enum
+{
+	WATCH_MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE |
+		IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR
+};
+
+} // namespace
+#endif // _LIN_
+
+///////////////////////////////////////////////////////////////////////////////
+// class CacheWatcher
+
+CacheWatcher& CacheWatcher::instance()
+{
+	static CacheWatcher s_instance;
+	return s_instance;
+}
+
+CacheWatcher::CacheWatcher(): m_fd(-1), m_current(NULL)
+{
+	m_stop[0] = m_stop[1] = -1;
+#ifdef _LIN_
+	m_fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (-1 == m_fd)
+	{
+		WRITE_TRACE(DBG_FATAL, "inotify_init1() failed: %m");
+		return;
+	}
+	if (::pipe2(m_stop, O_NONBLOCK | O_CLOEXEC))
+	{
+		WRITE_TRACE(DBG_FATAL, "pipe2() failed: %m");
+		::close(m_fd);
+		m_fd = -1;
+		return;
+	}
+	start();
+#endif // _LIN_
+}
+
+CacheWatcher::~CacheWatcher()
+{
+#ifdef _LIN_
+	if (-1 == m_fd)
+		return;
+
+	char x = 0;
+	if (::write(m_stop[1], &x, sizeof(x)) == -1)
+		WRITE_TRACE(DBG_FATAL, "unable to stop the cache watcher: %m");
+	else
+		wait();
+
+	::close(m_stop[0]);
+	::close(m_stop[1]);
+	::close(m_fd);
+#endif // _LIN_
+}
+
+bool CacheWatcher::watch(const QString& path_, const void* owner_, const callback_type& callback_)
+{
+#ifdef _LIN_
+	if (-1 == m_fd)
+		return false;
+
+	QFileInfo f(path_);
+	QString d = f.absolutePath();
+	QMutexLocker g(&m_mutex);
+	int w = m_index.value(d, -1);
+	if (-1 == w)
+	{
+		w = ::inotify_add_watch(m_fd, QSTR2UTF8(d), WATCH_MASK);
+		if (-1 == w)
+		{
+			WRITE_TRACE(DBG_FATAL, "inotify_add_watch(%s) failed: %m", QSTR2UTF8(d));
+			return false;
+		}
+		m_index.insert(d, w);
+		m_watches[w].path = d;
+	}
+	m_watches[w].files[f.fileName()].insert(owner_, callback_);
+	return true;
+#else // _LIN_
+	Q_UNUSED(path_);
+	Q_UNUSED(owner_);
+	Q_UNUSED(callback_);
+	return false;
+#endif // _LIN_
+}
+
+void CacheWatcher::forget(const QString& path_, const void* owner_)
+{
+	QFileInfo f(path_);
+	QMutexLocker g(&m_mutex);
+	int w = m_index.value(f.absolutePath(), -1);
+	if (-1 == w)
+		return;
+
+	QHash<QString, subscribers_type>& x = m_watches[w].files;
+	QHash<QString, subscribers_type>::iterator p = x.find(f.fileName());
+	if (p == x.end())
+		return;
+
+	p->remove(owner_);
+	if (!p->isEmpty())
+		return;
+
+	x.erase(p);
+	if (x.isEmpty())
+		drop(w);
+}
+
+void CacheWatcher::forget(const void* owner_)
+{
+	QMutexLocker g(&m_mutex);
+	m_forgotten.insert(owner_);
+	// a callback may forget its owner itself
+	while (owner_ == m_current && QThread::currentThread() != this)
+		m_idle.wait(&m_mutex);
+
+	foreach (int w, m_watches.keys())
+	{
+		QHash<QString, subscribers_type>& x = m_watches[w].files;
+		QHash<QString, subscribers_type>::iterator p = x.begin();
+		while (p != x.end())
+		{
+			p->remove(owner_);
+			if (p->isEmpty())
+				p = x.erase(p);
+			else
+				++p;
+		}
+		if (x.isEmpty())
+			drop(w);
+	}
+}
+
+void CacheWatcher::drop(int wd_)
+{
+#ifdef _LIN_
+	::inotify_rm_watch(m_fd, wd_);
+#endif // _LIN_
+	m_index.remove(m_watches.value(wd_).path);
+	m_watches.remove(wd_);
+}
+
+void CacheWatcher::dispatch(int wd_, quint32 mask_, const QString& name_)
+{
+	typedef QPair<QString, callback_type> call_type;
+	QList<QPair<const void*, call_type> > a;
+	{
+		QMutexLocker g(&m_mutex);
+		m_forgotten.clear();
+		QHash<int, Directory>::const_iterator d = m_watches.constFind(wd_);
+		if (d == m_watches.constEnd())
+			return;
+
+		QHash<QString, subscribers_type>::const_iterator p = d->files.constBegin();
+		for (; p != d->files.constEnd(); ++p)
+		{
+			// an event on the directory itself concerns all its files
+			if (!name_.isEmpty() && p.key() != name_)
+				continue;
+
+			QString f = d->path + "/" + p.key();
+			subscribers_type::const_iterator c = p->constBegin();
+			for (; c != p->constEnd(); ++c)
+				a << qMakePair(c.key(), qMakePair(f, c.value()));
+		}
+#ifdef _LIN_
+		if (mask_ & IN_IGNORED)
+		{
+			m_index.remove(d->path);
+			m_watches.remove(wd_);
+		}
+#else // _LIN_
+		Q_UNUSED(mask_);
+#endif // _LIN_
+	}
+	// NB. callbacks are called without the lock to let them
+	// re-subscribe or forget files. an owner forgotten meanwhile
+	// is skipped, the one being called is waited for by forget().
+	typedef QPair<const void*, call_type> pair_type;
+	foreach (const pair_type& x, a)
+	{
+		{
+			QMutexLocker g(&m_mutex);
+			if (m_forgotten.contains(x.first))
+				continue;
+
+			m_current = x.first;
+		}
+		x.second.second(x.second.first);
+		QMutexLocker g(&m_mutex);
+		m_current = NULL;
+		m_idle.wakeAll();
+	}
+}
+
+void CacheWatcher::run()
+{
+#ifdef _LIN_
+	char b[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+	struct pollfd p[2];
+	p[0].fd = m_fd;
+	p[0].events = POLLIN;
+	p[1].fd = m_stop[0];
+	p[1].events = POLLIN;
+	forever
+	{
+		p[0].revents = p[1].revents = 0;
+		if (::poll(p, 2, -1) == -1)
+		{
+			if (EINTR == errno)
+				continue;
+
+			WRITE_TRACE(DBG_FATAL, "poll() failed: %m");
+			return;
+		}
+		if (p[1].revents)
+			return;
+
+		forever
+		{
+			ssize_t n = ::read(m_fd, b, sizeof(b));
+			if (n <= 0)
+				break;
+
+			for (char* x = b; x < b + n;)
+			{
+				const struct inotify_event* e = (const struct inotify_event* )x;
+				if (e->mask & IN_Q_OVERFLOW)
+				{
+					// events are lost. notify everybody.
+					WRITE_TRACE(DBG_FATAL, "inotify queue overflow");
+					QList<int> w;
+					{
+						QMutexLocker g(&m_mutex);
+						w = m_watches.keys();
+					}
+					foreach (int i, w)
+						dispatch(i, 0, QString());
+				}
+				else
+				{
+					dispatch(e->wd, e->mask, 0 < e->len ?
+						QString::fromUtf8(e->name) : QString());
+				}
+				x += sizeof(struct inotify_event) + e->len;
+			}
+		}
+	}
+#endif // _LIN_
+}
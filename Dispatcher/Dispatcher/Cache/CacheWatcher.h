@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @file CacheWatcher.h
+///
+/// Invalidation of cached configs by file system notifications.
+///
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <QHash>
+#include <QSet>
+#include <QMutex>
+#include <QThread>
+#include <QString>
+#include <QWaitCondition>
+#include <boost/function.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// class CacheWatcher
+//
+// Watches parent directories of cached files via inotify and reports
+// changes of the files of interest from its own thread. A directory is
+// watched once regardless of the number of files and caches interested
+// in it. An owner should touch instance() before it subscribes, so that
+// the watcher outlives it, and call forget() before it dies; forget()
+// waits for a callback of the owner being called at the moment.
+
+class CacheWatcher: public QThread
+{
+public:
+	typedef boost::function1<void, const QString& > callback_type;
+
+	static CacheWatcher& instance();
+
+	~CacheWatcher();
+
+	// returns false if the file cannot be watched. the caller
+	// should validate the file timestamp by itself then.
+	bool watch(const QString& path_, const void* owner_, const callback_type& callback_);
+	void forget(const QString& path_, const void* owner_);
+	void forget(const void* owner_);
+
+protected:
+	void run();
+
+private:
+	typedef QHash<const void*, callback_type> subscribers_type;
+	struct Directory
+	{
+		QString path;
+		// file name -> subscribers
+		QHash<QString, subscribers_type> files;
+	};
+
+	CacheWatcher();
+	Q_DISABLE_COPY(CacheWatcher)
+
+	void dispatch(int wd_, quint32 mask_, const QString& name_);
+	void drop(int wd_);
+
+	int m_fd;
+	int m_stop[2];
+	QMutex m_mutex;
+	// the owner whose callback is being called by the watcher thread
+	const void* m_current;
+	QWaitCondition m_idle;
+	// owners forgotten since the current batch of callbacks was collected
+	QSet<const void*> m_forgotten;
+	// directory path -> watch descriptor
+	QHash<QString, int> m_index;
+	QHash<int, Directory> m_watches;
+};
@@ -35,12 +35,14 @@
 #include <prlcommon/Std/PrlAssert.h>
 #include <prlcommon/Messaging/CVmEvent.h>
 #include <prlcommon/Messaging/CVmBinaryEventParameter.h>
+#include <prlcommon/Messaging/CVmEventParameterList.h>
 #include <prlxmlmodel/HostHardwareInfo/CHostHardwareInfo.h>
 #include "CDspClient.h"
 #include "CDspVm.h"
 #include "CDspService.h"
 #include "CDspCommon.h"
 #include "CDspStatStorage.h"
+#include "CDspStatFilter.h"
 #include "CDspLibvirt.h"
 #include "CDspLibvirtExec.h"
 #include <prlcommon/ProtoSerializer/CProtoSerializer.h>
@@ -51,6 +53,7 @@
 #include <prlcommon/Std/BitOps.h>
 #include <QDateTime>
 #include <QRegExp>
+#include <QUrlQuery>
 #include <QWeakPointer>
 #include <numeric>
 #include <limits>
@@ -73,6 +76,24 @@
  */
 #define STAT_COLLECTING_TIMEOUT 1000
 
+/**
+ * Upper bound of threads building perf events of subscribed VMs
+ * during one collecting loop iteration.
+ */
+#define PERF_SWEEP_CONCURRENCY 4
+
+/** Duration of the last perf sweep in microseconds */
+#define PERF_SWEEP_TIME_COUNTER "dispatcher.perf.sweep_time"
+
+/** Number of guest stat harvests waiting for a free thread */
+#define HARVEST_BACKLOG_COUNTER "dispatcher.harvest.backlog"
+
+/** Task pool counters of a task class: short, long or io */
+#define TASK_POOL_COUNTER "dispatcher.tasks.%1.%2"
+
+/** Counters of the VM config cache: hits, misses, copies or invalidations */
+#define CONFIG_CACHE_COUNTER "dispatcher.config_cache.%1"
+
 using namespace Virtuozzo;
 
 namespace
@@ -121,6 +142,44 @@ static DAO<QList< ::Statistics::Filesystem> > s_daoFs;
 static DAO<QList< ::Statistics::Disk> > s_daoDisk;
 static DAO<QList< ::Ct::Statistics::Network::General> > s_daoNet;
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Links
+// The host links dump of the last sweep shared with the harvesters. A stale
+// one is not served.
+
+struct Links
+{
+	typedef ::Ct::Statistics::Sweep::links_type value_type;
+
+	static value_type get();
+	static void set(const value_type& value_);
+
+private:
+	static QMutex s_mutex;
+	static quint64 s_stamp;
+	static value_type s_value;
+};
+
+QMutex Links::s_mutex;
+quint64 Links::s_stamp = 0;
+Links::value_type Links::s_value;
+
+Links::value_type Links::get()
+{
+	QMutexLocker g(&s_mutex);
+	if (0 == s_stamp || PrlGetTimeMonotonic() - s_stamp >= 2 * STAT_COLLECTING_TIMEOUT * 1000)
+		return value_type();
+
+	return s_value;
+}
+
+void Links::set(const value_type& value_)
+{
+	QMutexLocker g(&s_mutex);
+	s_stamp = PrlGetTimeMonotonic();
+	s_value = value_;
+}
+
 namespace Harvester
 {
 ///////////////////////////////////////////////////////////////////////////////
@@ -142,7 +201,7 @@ bool Ct::operator()() const
 	}
 
 	QList< ::Ct::Statistics::Network::General> n;
-	if (PRL_SUCCEEDED(CVzHelper::get_net_stat(cfg, n)))
+	if (PRL_SUCCEEDED(CVzHelper::get_net_stat(cfg, Stat::Collecting::Links::get(), n)))
 		Stat::Collecting::s_daoNet.set(m_uuid, n);
 
 	return true;
@@ -194,15 +253,164 @@ bool Vm::operator()()
 
 } // namespace Harvester
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Sweep
+// Counters of all the containers with perf subscribers collected in one go
+// by the collecting thread. An aggregate is served until the next sweep is
+// overdue, otherwise it is read with vzctl.
+
+struct Sweep
+{
+	typedef SmartPtr< ::Ct::Statistics::Aggregate> aggregate_type;
+
+	static void run(const QStringList& uuids_);
+	static aggregate_type find(const QString& uuid_);
+
+private:
+	typedef QPair<quint64, aggregate_type> value_type;
+
+	static ::Ct::Statistics::Sweep s_sweep;
+};
+
+::Ct::Statistics::Sweep Sweep::s_sweep;
+
+void Sweep::run(const QStringList& uuids_)
+{
+	::Ct::Statistics::Sweep::result_type r = s_sweep(uuids_);
+	quint64 t = PrlGetTimeMonotonic();
+	DAO<value_type> d;
+	for (::Ct::Statistics::Sweep::result_type::const_iterator p = r.constBegin();
+		p != r.constEnd(); ++p)
+	{
+		d.set(p.key(), qMakePair(t, p.value()));
+	}
+
+	// refresh the adapters found by the harvester from the same links dump
+	const ::Ct::Statistics::Sweep::links_type& l = s_sweep.getLinks();
+	Links::set(l);
+	if (l.isEmpty())
+		return;
+
+	foreach (const QString& u, r.keys())
+	{
+		QList< ::Ct::Statistics::Network::General> n = s_daoNet.get(u);
+		for (int i = 0; i < n.size(); ++i)
+		{
+			::Ct::Statistics::Sweep::links_type::const_iterator p =
+				l.constFind(n.at(i).name);
+			if (l.constEnd() == p)
+				continue;
+
+			unsigned x = n.at(i).index;
+			n[i] = p.value();
+			n[i].index = x;
+		}
+		if (!n.isEmpty())
+			s_daoNet.set(u, n);
+	}
+}
+
+Sweep::aggregate_type Sweep::find(const QString& uuid_)
+{
+	value_type v = DAO<value_type>().get(uuid_);
+	if (0 != v.first && PrlGetTimeMonotonic() - v.first < 2 * STAT_COLLECTING_TIMEOUT * 1000)
+		return v.second;
+
+	return aggregate_type(CVzHelper::get_env_stat(uuid_));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Wheel
+
+QAtomicInteger<quint32> Wheel::s_backlog(0);
+
+Wheel::Wheel(): m_timer(startTimer(TICK)), m_now(0), m_running(0)
+{
+	m_pool.setMaxThreadCount(CONCURRENCY);
+}
+
+quint64 Wheel::schedule(Farmer* farmer_, quint64 delay_, quint64 jitter_)
+{
+	if (0 < jitter_)
+		delay_ += qrand() % jitter_;
+
+	// the second level covers SLOTS * SLOTS ticks
+	quint64 t = qBound<quint64>(1, (delay_ + TICK - 1) / TICK, SLOTS * SLOTS - 1);
+	Entry e;
+	e.farmer = farmer_;
+	e.due = m_now + t;
+	place(e);
+	return e.due;
+}
+
+void Wheel::place(const Entry& entry_)
+{
+	if (entry_.due - m_now < SLOTS)
+		m_slots[0][entry_.due % SLOTS].append(entry_);
+	else
+		m_slots[1][(entry_.due / SLOTS) % SLOTS].append(entry_);
+}
+
+void Wheel::begin()
+{
+	++m_running;
+	s_backlog.storeRelease(m_running > CONCURRENCY ? m_running - CONCURRENCY : 0);
+}
+
+void Wheel::end()
+{
+	if (0 < m_running)
+		--m_running;
+	s_backlog.storeRelease(m_running > CONCURRENCY ? m_running - CONCURRENCY : 0);
+}
+
+quint32 Wheel::getBacklog()
+{
+	return s_backlog.loadAcquire();
+}
+
+void Wheel::timerEvent(QTimerEvent* event_)
+{
+	if (event_->timerId() != m_timer)
+		return;
+
+	++m_now;
+	if (0 == m_now % SLOTS)
+	{
+		// cascade the next round of the second level
+		QList<Entry> x;
+		x.swap(m_slots[1][(m_now / SLOTS) % SLOTS]);
+		foreach (const Entry& e, x)
+			place(e);
+	}
+
+	// farmers rescheduled or gone leave stale entries behind
+	QList<Entry> b;
+	b.swap(m_slots[0][m_now % SLOTS]);
+	foreach (const Entry& e, b)
+	{
+		if (!e.farmer.isNull() && e.farmer->isDue(e.due))
+			e.farmer->fire();
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Farmer
 
-Farmer::Farmer(const CVmIdent& ident_, getAccess_type access_):
-	m_timer(startTimer(0)), m_ident(ident_), m_getAccess(access_)
+Farmer::Farmer(const CVmIdent& ident_, getAccess_type access_, Wheel& wheel_):
+	m_due(0), m_ident(ident_), m_getAccess(access_), m_wheel(&wheel_)
 {
 	qint64 c = CDspService::instance()->getDispConfigGuard()
 		.getDispWorkSpacePrefs()->getVmGuestCollectPeriod() * 1000;
 	m_period = m_initialPeriod = qMax(c, qint64(STAT_COLLECTING_FS_TIMEOUT_MIN));
+	// spread the first harvests of the VMs known at start
+	m_due = m_wheel->schedule(this, 0, STAT_COLLECTING_FS_TIMEOUT_MIN);
+}
+
+Farmer::~Farmer()
+{
+	if (m_watcher)
+		m_wheel->end();
 }
 
 void Farmer::reset()
@@ -219,11 +427,12 @@ void Farmer::reset()
 			/* success, polling with initial period */
 			m_period = m_initialPeriod;
 		}
-		m_timer = startTimer(m_period);	
+		m_due = m_wheel->schedule(this, m_period, m_period / 8);
 	}
 	m_watcher->disconnect(this, SLOT(reset()));
 	m_watcher->waitForFinished();
 	m_watcher.reset();
+	m_wheel->end();
 }
 
 void Farmer::handle(unsigned state_, QString uuid_, QString dir_, bool flag_)
@@ -237,26 +446,25 @@ void Farmer::handle(unsigned state_, QString uuid_, QString dir_, bool flag_)
 	else if (m_watcher)
 		return;
 
-	if (0 != m_timer)
-		killTimer(m_timer);
-
-	m_timer = VMS_RUNNING == state_ ? startTimer(0) : 0;
+	m_due = VMS_RUNNING == state_ ? m_wheel->schedule(this, 0, 0) : 0;
 }
 
-void Farmer::timerEvent(QTimerEvent *event_)
+void Farmer::fire()
 {
-	killTimer(event_->timerId());
-
+	m_due = 0;
 	if (!m_watcher)
 	{
 		m_watcher.reset(new QFutureWatcher<bool>);
 		this->connect(m_watcher.data(), SIGNAL(finished()), SLOT(reset()));
+		m_wheel->begin();
 		PRL_VM_TYPE t = PVT_VM;
 		CDspService::instance()->getVmDirManager().getVmTypeByUuid(m_ident.first, t);
 		if (PVT_VM == t)
-			m_watcher->setFuture(QtConcurrent::run(Harvester::Vm(m_ident, m_getAccess())));
+			m_watcher->setFuture(QtConcurrent::run(&m_wheel->getPool(),
+				Harvester::Vm(m_ident, m_getAccess())));
 		else
-			m_watcher->setFuture(QtConcurrent::run(Harvester::Ct(m_ident.first)));
+			m_watcher->setFuture(QtConcurrent::run(&m_wheel->getPool(),
+				Harvester::Ct(m_ident.first)));
 	}
 }
 
@@ -278,6 +486,12 @@ void Mapper::abort(CVmIdent ident_)
 		s->disconnect(f, SLOT(handle(unsigned, QString, QString, bool)));
 }
 
+Mapper::~Mapper()
+{
+	// farmers account their harvests in the wheel
+	qDeleteAll(findChildren<Farmer* >(QString(), Qt::FindDirectChildrenOnly));
+}
+
 void Mapper::begin(CVmIdent ident_)
 {
 	QString k = QString(ident_.first).append(ident_.second);
@@ -285,7 +499,8 @@ void Mapper::begin(CVmIdent ident_)
 	if (NULL != f)
 		return;
 
-	f = new Farmer(ident_, boost::bind(&Registry::Public::find, &m_registry, ident_.first));
+	f = new Farmer(ident_, boost::bind(&Registry::Public::find, &m_registry, ident_.first),
+		m_wheel);
 	f->setObjectName(k);
 	f->setParent(this);
 
@@ -829,7 +1044,11 @@ struct Perf: private perfList_type
 	bool add(const CVmIdent& vm_, const QString& filter_, const mapped_type& user_)
 	{
 		iterator p = insert(std::make_pair(qMakePair(vm_, filter_), user_));
-		return end() != p;
+		if (end() == p)
+			return false;
+
+		Filter::compile(vm_, filter_);
+		return true;
 	}
 	void remove(const CVmIdent& vm_, const mapped_type& user_);
 	bool has(const CVmIdent& vm_) const
@@ -841,51 +1060,87 @@ struct Perf: private perfList_type
 		return end() != p && p->first.first == vm_;
 	}
 	QList<CVmIdent> select(const mapped_type& user_) const;
+
+	typedef QPair<key_type, QList<mapped_type> > batch_type;
+
+	QList<batch_type> snapshot() const;
+	void forget(const batch_type& batch_);
 	template<class P>
-	void report(P provider_);
+	static QList<batch_type> report(const QList<batch_type>& batches_,
+		P provider_, QThreadPool& pool_);
 };
 
 void Perf::remove(const CVmIdent& vm_, const mapped_type& user_)
 {
 	iterator p = lower_bound(qMakePair(vm_, QString()));
 	p = std::find_if(p, end(), Indicator(vm_, user_));
-	if (end() != p)
-		perfList_type::erase(p);
+	if (end() == p)
+		return;
+
+	key_type k = p->first;
+	perfList_type::erase(p);
+	if (0 == count(k))
+		Filter::drop(k.first, k.second);
 }
 
-template<class P>
-void Perf::report(P provider_)
+QList<Perf::batch_type> Perf::snapshot() const
 {
-	key_type k;
-	SmartPtr<IOPackage> g;
-	QList<key_type> broken;
+	QList<batch_type> output;
 	for (const_iterator p = begin(), e = end(); p != e; ++p)
 	{
-		if (p->first != k)
+		if (output.isEmpty() || output.last().first != p->first)
+			output.append(qMakePair(p->first, QList<mapped_type>()));
+
+		output.last().second.append(p->second);
+	}
+	return output;
+}
+
+void Perf::forget(const batch_type& batch_)
+{
+	foreach (const mapped_type& u, batch_.second)
+	{
+		std::pair<iterator, iterator> r = equal_range(batch_.first);
+		iterator p = std::find_if(r.first, r.second, Indicator(batch_.first.first, u));
+		if (r.second != p)
+			perfList_type::erase(p);
+	}
+	if (0 == count(batch_.first))
+		Filter::drop(batch_.first.first, batch_.first.second);
+}
+
+// Builds events for every batch of the snapshot concurrently on the pool and
+// sends each one to the users of its batch. Returns the batches of VMs that
+// are gone, the caller should forget them under the subscribers lock.
+template<class P>
+QList<Perf::batch_type> Perf::report(const QList<batch_type>& batches_,
+	P provider_, QThreadPool& pool_)
+{
+	QList<QFuture<SmartPtr<CVmEvent> > > f;
+	foreach (const batch_type& b, batches_)
+		f << QtConcurrent::run(&pool_, provider_, b.first.first, b.first.second);
+
+	QList<batch_type> output;
+	for (int i = 0; i < f.size(); ++i)
+	{
+		SmartPtr<CVmEvent> event(f[i].result());
+		if (event->m_lstEventParameters.isEmpty() || PRL_FAILED(event->getEventCode()))
 		{
-			g.reset();
-			k = p->first;
-			SmartPtr<CVmEvent> event(provider_(k.first, k.second));
-			if (event->m_lstEventParameters.isEmpty() || PRL_FAILED(event->getEventCode()))
-			{
-				if (event->getEventCode() == PRL_ERR_VM_UUID_NOT_FOUND)
-					broken << p->first;
-				// nothing to send
-				continue;
-			}
-			g = create_binary_package(*event.getImpl()) ;
-			if (!g.isValid())
-			{
-				LOG_MESSAGE(DBG_FATAL, "Failed to create an IOPackage");
-				return;
-			}
+			if (event->getEventCode() == PRL_ERR_VM_UUID_NOT_FOUND)
+				output << batches_[i];
+			// nothing to send
+			continue;
 		}
-		if (g.isValid())
-			p->second->sendPackage(g);
+		SmartPtr<IOPackage> g = create_binary_package(*event.getImpl());
+		if (!g.isValid())
+		{
+			LOG_MESSAGE(DBG_FATAL, "Failed to create an IOPackage");
+			continue;
+		}
+		foreach (const mapped_type& u, batches_[i].second)
+			u->sendPackage(g);
 	}
-
-	foreach (const key_type& k, broken)
-		perfList_type::erase(k);
+	return output;
 }
 
 QList<CVmIdent> Perf::select(const mapped_type& user_) const
@@ -899,6 +1154,53 @@ QList<CVmIdent> Perf::select(const mapped_type& user_) const
 	return output;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Report
+// Statistics of a VM built once per collecting loop iteration. The XML text
+// for the getters and the binary event for the subscribers are encoded on
+// first use and shared read-only by all of them.
+
+struct Report
+{
+	explicit Report(const SmartPtr<CSystemStatistics>& data_): m_data(data_)
+	{
+	}
+
+	QString getXml();
+	SmartPtr<IOPackage> getEvent(const QString& uuid_);
+
+private:
+	QMutex m_mutex;
+	SmartPtr<CSystemStatistics> m_data;
+	boost::optional<QString> m_xml;
+	SmartPtr<IOPackage> m_event;
+};
+
+QString Report::getXml()
+{
+	QMutexLocker g(&m_mutex);
+	if (!m_xml)
+		m_xml = m_data.isValid() ? m_data->toString() : QString();
+
+	return m_xml.get();
+}
+
+SmartPtr<IOPackage> Report::getEvent(const QString& uuid_)
+{
+	QMutexLocker g(&m_mutex);
+	if (m_event.isValid())
+		return m_event;
+
+	CVmEvent x(PET_DSP_EVT_VM_STATISTICS_UPDATED, uuid_, PIE_VIRTUAL_MACHINE);
+	CVmBinaryEventParameter *b = new CVmBinaryEventParameter(EVT_PARAM_STATISTICS);
+	if (m_data.isValid())
+		m_data->Serialize(*b->getBinaryDataStream().getImpl());
+
+	x.addEventParameter(b);
+	m_event = create_binary_package(x);
+	return m_event;
+}
+
 namespace Counter
 {
 ///////////////////////////////////////////////////////////////////////////////
@@ -2070,12 +2372,99 @@ typedef ::Stat::Counter::Enumerable<Names::Filesystem::MountPoint, Flavor> Mount
 namespace
 {
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Query
+// Request for the history of VM counters. It is a filter followed by
+// "?history=<raw|minute|hour>[&window=<seconds>]". Every matching counter
+// is reported as a list of "<msecs since epoch>:<avg>:<min>:<max>".
+
+struct Query
+{
+	static boost::optional<Query> parse(const QString& filter_);
+
+	SmartPtr<CVmEvent> operator()(const CVmIdent& id_) const;
+
+private:
+	Query(): m_tier(), m_window()
+	{
+	}
+
+	QString m_filter;
+	Stat::History::Tier m_tier;
+	quint32 m_window;
+};
+
+boost::optional<Query> Query::parse(const QString& filter_)
+{
+	int i = filter_.indexOf('?');
+	if (-1 == i)
+		return boost::none;
+
+	QUrlQuery u(filter_.mid(i + 1));
+	QString t = u.queryItemValue("history");
+	Query output;
+	if ("raw" == t)
+		output.m_tier = Stat::History::TIER_RAW;
+	else if ("minute" == t)
+		output.m_tier = Stat::History::TIER_MINUTE;
+	else if ("hour" == t)
+		output.m_tier = Stat::History::TIER_HOUR;
+	else
+		return boost::none;
+
+	output.m_filter = filter_.left(i);
+	output.m_window = u.queryItemValue("window").toUInt();
+	return output;
+}
+
+SmartPtr<CVmEvent> Query::operator()(const CVmIdent& id_) const
+{
+	SmartPtr<CVmEvent> output(new CVmEvent(PET_DSP_EVT_VM_PERFSTATS, id_.first, PIE_VIRTUAL_MACHINE));
+	// NB. only VMs keep their raw counters in a storage
+	QSharedPointer<Stat::Storage> s = CDspStatCollectingThread::getStorage(id_.first).toStrongRef();
+	if (s.isNull())
+	{
+		output->setEventCode(PRL_ERR_UNIMPLEMENTED);
+		return output;
+	}
+	// the first request starts the recording
+	s->watch();
+
+	QRegExp r = Stat::Filter::translate(m_filter);
+	quint64 n = PrlGetTimeMonotonic();
+	qint64 w = QDateTime::currentMSecsSinceEpoch();
+	quint64 b = n - qMin(n, quint64(m_window) * 1000000);
+	if (0 == m_window)
+		b = 0;
+
+	QHash<QString, Stat::counterId_type> c = s->getCounters();
+	QHash<QString, Stat::counterId_type>::const_iterator p;
+	for (p = c.constBegin(); p != c.constEnd(); ++p)
+	{
+		if (!r.exactMatch(p.key()))
+			continue;
+
+		QStringList v;
+		foreach (const Stat::Rollup& x, s->readHistory(p.value(), m_tier, b))
+		{
+			v << QString("%1:%2:%3:%4")
+				.arg(w - qint64((n - qMin(n, x.time)) / 1000))
+				.arg(x.getAverage())
+				.arg(x.min)
+				.arg(x.max);
+		}
+		output->addEventParameter(new CVmEventParameterList(PVE::String, v, p.key()));
+	}
+	output->setEventCode(PRL_ERR_SUCCESS);
+	return output;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Collector
 
 struct Collector {
 
-	Collector(QString filter, CVmEvent &event);
+	Collector(const CVmIdent &id, const QString &filter, CVmEvent &event);
 
 	void collectCt(const QString &uuid,
 			const Ct::Statistics::Aggregate &a);
@@ -2087,25 +2476,16 @@ private:
 	template <typename Counter>
 	void collect(const Counter &c);
 
-	QRegExp m_regexp;
+	QSharedPointer<Stat::Filter> m_filter;
 	CVmEvent *m_event;
 };
 
-Collector::Collector(QString filter, CVmEvent &event) :
-	m_event(&event)
+Collector::Collector(const CVmIdent &id, const QString &filter, CVmEvent &event) :
+	m_filter(Stat::Filter::find(id, filter)), m_event(&event)
 {
-	if (filter.isEmpty())
-	{
-		filter = ".*";
-	}
-	else
-	{
-		filter.replace('.', "\\.");
-		filter.replace('*', ".*");
-		filter.replace('#', "[0-9]+");
-	}
-
-	m_regexp = QRegExp(filter);
+	// not a subscription, a single request
+	if (m_filter.isNull())
+		m_filter = QSharedPointer<Stat::Filter>(new Stat::Filter(filter));
 }
 
 void Collector::collectCt(const QString &uuid,
@@ -2124,12 +2504,15 @@ void Collector::collectCt(const QString &uuid,
 	collect(ctc::Network::Classful4(a.net));
 	collect(ctc::Network::Classful6(a.net));
 	collect(ctc::Network::Classful(a.net));
-	foreach (const Ct::Statistics::Network::General& dev, Stat::Collecting::s_daoNet.get(uuid))
+	if (m_filter->admits("net.nic"))
 	{
-		collect(ctc::Network::ReceivedSize(dev.index, dev));
-		collect(ctc::Network::TransmittedSize(dev.index, dev));
-		collect(ctc::Network::ReceivedPackets(dev.index, dev));
-		collect(ctc::Network::TransmittedPackets(dev.index, dev));
+		foreach (const Ct::Statistics::Network::General& dev, Stat::Collecting::s_daoNet.get(uuid))
+		{
+			collect(ctc::Network::ReceivedSize(dev.index, dev));
+			collect(ctc::Network::TransmittedSize(dev.index, dev));
+			collect(ctc::Network::ReceivedPackets(dev.index, dev));
+			collect(ctc::Network::TransmittedPackets(dev.index, dev));
+		}
 	}
 
 	Ct::Statistics::Memory *m = a.memory.get();
@@ -2141,27 +2524,36 @@ void Collector::collectCt(const QString &uuid,
 		collect(ctc::SwapOut(*m));
 	}
 
-	quint32 vcpunum = ctc::getVcpuNum(uuid);
-	for (quint32 i = 0; i < vcpunum; ++i)
-		collect(ctc::VCpuTime(a.cpu, i, vcpunum));
+	if (m_filter->admits("guest.vcpu"))
+	{
+		quint32 vcpunum = ctc::getVcpuNum(uuid);
+		for (quint32 i = 0; i < vcpunum; ++i)
+			collect(ctc::VCpuTime(a.cpu, i, vcpunum));
+	}
 
-	const QList< ::Statistics::Filesystem>& f =
-				Stat::Collecting::s_daoFs.get(uuid);
-	for (int i = 0; i < f.size(); ++i)
+	if (m_filter->admits("guest.fs"))
 	{
-		const ::Statistics::Filesystem& fs = f.at(i);
-		collect(ctc::Filesystem::Total(i, fs));
-		collect(ctc::Filesystem::Free(i, fs));
-		collect(ctc::Filesystem::Device(i, fs));
-		collect(ctc::Filesystem::Type(i, fs));
-		collect(ctc::Filesystem::MountPoint(i, fs));
-		collect(ctc::Filesystem::Index(i, fs));
+		const QList< ::Statistics::Filesystem>& f =
+					Stat::Collecting::s_daoFs.get(uuid);
+		for (int i = 0; i < f.size(); ++i)
+		{
+			const ::Statistics::Filesystem& fs = f.at(i);
+			collect(ctc::Filesystem::Total(i, fs));
+			collect(ctc::Filesystem::Free(i, fs));
+			collect(ctc::Filesystem::Device(i, fs));
+			collect(ctc::Filesystem::Type(i, fs));
+			collect(ctc::Filesystem::MountPoint(i, fs));
+			collect(ctc::Filesystem::Index(i, fs));
+		}
 	}
 
-	foreach (const ::Statistics::Disk& disk, Stat::Collecting::s_daoDisk.get(uuid))
+	if (m_filter->admits("devices.hdd"))
 	{
-		collect(ctc::Disk::ReadTotal(disk.index, disk));
-		collect(ctc::Disk::WriteTotal(disk.index, disk));
+		foreach (const ::Statistics::Disk& disk, Stat::Collecting::s_daoDisk.get(uuid))
+		{
+			collect(ctc::Disk::ReadTotal(disk.index, disk));
+			collect(ctc::Disk::WriteTotal(disk.index, disk));
+		}
 	}
 }
 
@@ -2179,8 +2571,11 @@ void Collector::collectVm(const QString &uuid, const CVmConfiguration &config)
 	vmc::VCpu(p).recordMsec(t);
 	d.set(uuid, m);
 
-	for (quint32 i = 0; i < config.getVmHardwareList()->getCpu()->getNumber(); ++i)
-		collect(vmc::VCpuTime(vmc::VCpu(p), i));
+	if (m_filter->admits("guest.vcpu"))
+	{
+		for (quint32 i = 0; i < config.getVmHardwareList()->getCpu()->getNumber(); ++i)
+			collect(vmc::VCpuTime(vmc::VCpu(p), i));
+	}
 
 	collect(vmc::GuestUsage(t));
 	collect(vmc::GuestTimeDelta(t));
@@ -2196,16 +2591,19 @@ void Collector::collectVm(const QString &uuid, const CVmConfiguration &config)
 	collect(vmc::MinorFault(p));
 	collect(vmc::MajorFault(p));
 
-	foreach (const CVmHardDisk* d, config.getVmHardwareList()->m_lstHardDisks)
+	if (m_filter->admits("devices."))
 	{
-		collect(vmc::makeVmCounter(p,
-			Stat::Name::Hdd::getReadRequests(*d)));
-		collect(vmc::makeVmCounter(p,
-			Stat::Name::Hdd::getWriteRequests(*d)));
-		collect(vmc::makeVmCounter(p,
-			Stat::Name::Hdd::getReadTotal(*d)));
-		collect(vmc::makeVmCounter(p,
-			Stat::Name::Hdd::getWriteTotal(*d)));
+		foreach (const CVmHardDisk* d, config.getVmHardwareList()->m_lstHardDisks)
+		{
+			collect(vmc::makeVmCounter(p,
+				Stat::Name::Hdd::getReadRequests(*d)));
+			collect(vmc::makeVmCounter(p,
+				Stat::Name::Hdd::getWriteRequests(*d)));
+			collect(vmc::makeVmCounter(p,
+				Stat::Name::Hdd::getReadTotal(*d)));
+			collect(vmc::makeVmCounter(p,
+				Stat::Name::Hdd::getWriteTotal(*d)));
+		}
 	}
 
 	const QList<CVmGenericNetworkAdapter*> &nics =
@@ -2213,29 +2611,35 @@ void Collector::collectVm(const QString &uuid, const CVmConfiguration &config)
 	collect(vmc::Network::ClassfulOnline<Flavor::Network::Ipv4>(uuid, p, nics));
 	collect(vmc::Network::ClassfulOnline<Flavor::Network::Ipv6>(uuid, p, nics));
 	collect(vmc::Network::ClassfulOnline<Flavor::Network::Total>(uuid, p, nics));
-	foreach (const CVmGenericNetworkAdapter* nic, nics)
+	if (m_filter->admits("net.nic"))
 	{
-		collect(vmc::makeVmCounter(p,
-			Stat::Name::Interface::getPacketsIn(*nic)));
-		collect(vmc::makeVmCounter(p,
-			Stat::Name::Interface::getPacketsOut(*nic)));
-		collect(vmc::makeVmCounter(p,
-			Stat::Name::Interface::getBytesIn(*nic)));
-		collect(vmc::makeVmCounter(p,
-			Stat::Name::Interface::getBytesOut(*nic)));
+		foreach (const CVmGenericNetworkAdapter* nic, nics)
+		{
+			collect(vmc::makeVmCounter(p,
+				Stat::Name::Interface::getPacketsIn(*nic)));
+			collect(vmc::makeVmCounter(p,
+				Stat::Name::Interface::getPacketsOut(*nic)));
+			collect(vmc::makeVmCounter(p,
+				Stat::Name::Interface::getBytesIn(*nic)));
+			collect(vmc::makeVmCounter(p,
+				Stat::Name::Interface::getBytesOut(*nic)));
+		}
 	}
 
-	const QList< ::Statistics::Filesystem>& f =
-			Stat::Collecting::s_daoFs.get(uuid);
-	for (int i = 0; i < f.size(); ++i)
+	if (m_filter->admits("guest.fs"))
 	{
-		const ::Statistics::Filesystem& fs = f.at(i);
-		collect(ctc::Filesystem::Total(i, fs));
-		collect(ctc::Filesystem::Free(i, fs));
-		collect(ctc::Filesystem::Device(i, fs));
-		collect(ctc::Filesystem::Type(i, fs));
-		collect(ctc::Filesystem::MountPoint(i, fs));
+		const QList< ::Statistics::Filesystem>& f =
+				Stat::Collecting::s_daoFs.get(uuid);
+		for (int i = 0; i < f.size(); ++i)
+		{
+			const ::Statistics::Filesystem& fs = f.at(i);
+			collect(ctc::Filesystem::Total(i, fs));
+			collect(ctc::Filesystem::Free(i, fs));
+			collect(ctc::Filesystem::Device(i, fs));
+			collect(ctc::Filesystem::Type(i, fs));
+			collect(ctc::Filesystem::MountPoint(i, fs));
 
+		}
 	}
 }
 
@@ -2250,14 +2654,15 @@ void Collector::collectVmOffline(const QString &uuid_)
 template <typename Counter>
 void Collector::collect(const Counter &c)
 {
-	if (!m_regexp.exactMatch(c.getName()))
+	QString n = c.getName();
+	if (!m_filter->match(n))
 		return;
 
 	CVmEventParameter *p = c.getParam();
 	if (p == NULL)
 		return;
 
-	p->setParamName(c.getName());
+	p->setParamName(n);
 	m_event->addEventParameter(p);
 }
 
@@ -2265,7 +2670,7 @@ void Collector::collect(const Counter &c)
 Libvirt::Result GetPerformanceStatisticsCt(const CVmIdent &id, Collector &c)
 {
 	const QString &uuid = id.first;
-	SmartPtr<Ct::Statistics::Aggregate> a(CVzHelper::get_env_stat(uuid));
+	SmartPtr<Ct::Statistics::Aggregate> a(Stat::Collecting::Sweep::find(uuid));
 	if (!a.isValid())
 		return Libvirt::Result(Error::Simple(PRL_ERR_DISP_VM_IS_NOT_STARTED));
 
@@ -2313,8 +2718,15 @@ CDspStatCollectingThread::CHostStatGettersList
 CDspStatCollectingThread::CVmStatGettersMap
 	*CDspStatCollectingThread::g_pVmStatGetters = new CVmStatGettersMap;
 
+CDspStatCollectingThread::CVmStatReportsMap
+	*CDspStatCollectingThread::g_pVmStatReports = new CVmStatReportsMap;
+
+quint64 CDspStatCollectingThread::g_uVmStatReportsGeneration = 0;
+
 quint64 CDspStatCollectingThread::g_uSuccessivelyCyclesCounter = 0;
 
+QAtomicInteger<quint64> CDspStatCollectingThread::g_uPerfSweepTime(0);
+
 QMutex *CDspStatCollectingThread::s_instanceMutex = new QMutex();
 CDspStatCollectingThread* CDspStatCollectingThread::s_instance = NULL;
 
@@ -2325,6 +2737,7 @@ CDspStatCollectingThread::CDspStatCollectingThread(Registry::Public& registry_):
 	m_timer(),
 	m_registry(registry_)
 {
+	m_sweepPool.setMaxThreadCount(PERF_SWEEP_CONCURRENCY);
 }
 
 bool CDspStatCollectingThread::ExistStatSubscribers()
@@ -2368,6 +2781,8 @@ void CDspStatCollectingThread::timerEvent(QTimerEvent* event_)
 		else
 		{
 			g_uSuccessivelyCyclesCounter = 0;
+			g_pVmStatReports->clear();
+			++g_uVmStatReportsGeneration;
 			// If no subscribers - thread will sleep and wait
 			if (!bDoPerfStats)
 			{
@@ -2408,10 +2823,35 @@ void CDspStatCollectingThread::timerEvent(QTimerEvent* event_)
 
 		if (bDoPerfStats)
 		{
-			// Collect and send Perf Stats
+			// Collect and send Perf Stats. The subscribers lock is held
+			// only to take a snapshot and to drop the gone VMs.
+			quint64 t = PrlGetTimeMonotonic();
 			_lock.relock();
-			g_pPerfStatsSubscribers->report(&GetPerformanceStatistics);
+			QList<Stat::Perf::batch_type> b = g_pPerfStatsSubscribers->snapshot();
 			_lock.unlock();
+
+#ifdef _CT_
+			QStringList c;
+			foreach (const Stat::Perf::batch_type& x, b)
+			{
+				boost::optional<PRL_VM_TYPE> y = CDspService::instance()->
+					getVmDirManager().getVmTypeByIdent(x.first.first);
+				if (y && PVT_CT == y.get())
+					c << x.first.first.first;
+			}
+			c.removeDuplicates();
+			Stat::Collecting::Sweep::run(c);
+#endif // _CT_
+
+			b = Stat::Perf::report(b, &GetPerformanceStatistics, m_sweepPool);
+			if (!b.isEmpty())
+			{
+				_lock.relock();
+				foreach (const Stat::Perf::batch_type& x, b)
+					g_pPerfStatsSubscribers->forget(x);
+				_lock.unlock();
+			}
+			g_uPerfSweepTime.storeRelease(PrlGetTimeMonotonic() - t);
 		}
 
 		m_timer = startTimer(STAT_COLLECTING_TIMEOUT);
@@ -2689,46 +3129,41 @@ void CDspStatCollectingThread::ClientDisconnected(const SmartPtr<CDspClient> &pU
 
 void CDspStatCollectingThread::NotifyVmsStatisticsSubscribers()
 {
-	QMutexLocker _lock(g_pSubscribersMutex);
-
-	if( ! IsAvalableStatisctic() )
-		return;
-
-	SmartPtr<CSystemStatistics> y;
-	QMutableMapIterator< QPair<QString, QString>, QList<StatGetter> > it( *g_pVmStatGetters );
-	while( it.hasNext() )
+	CVmStatGettersMap a;
+	VmStatisticsSubscribersMap b;
 	{
-		it.next();
+		QMutexLocker _lock(g_pSubscribersMutex);
 
-		QString sVmStat;
-		y = GetVmGuestStatistics(it.key().first, it.key().second);
-		if (y.isValid())
-			sVmStat = y->toString();
+		if( ! IsAvalableStatisctic() )
+			return;
+
+		// a new iteration, the reports of the previous one are outdated
+		g_pVmStatReports->clear();
+		++g_uVmStatReportsGeneration;
+		a.swap(*g_pVmStatGetters);
+		b = *g_pVmsGuestStatisticsSubscribers;
+	}
 
+	// NB. the reports are built and sent outside the subscribers lock
+	for (CVmStatGettersMap::const_iterator it = a.constBegin(); it != a.constEnd(); ++it)
+	{
+		SmartPtr<Stat::Report> r = GetVmGuestReport(it.key());
 		foreach (const StatGetter& g, it.value())
 		{
-			SendStatisticsResponse(g.pUser, g.pPkg, sVmStat);
+			SendStatisticsResponse(g.pUser, g.pPkg, r->getXml());
 		}
-		it.remove();
 	}
 
 	SmartPtr<IOPackage> g;
 	typedef VmStatisticsSubscribersMap::const_iterator iterator_type;
-	iterator_type e = g_pVmsGuestStatisticsSubscribers->end();
-	iterator_type p = g_pVmsGuestStatisticsSubscribers->begin();
+	iterator_type e = b.end();
+	iterator_type p = b.begin();
 	for (VmStatisticsSubscribersMap::key_type k; p != e; ++p)
 	{
 		if (p->first != k)
 		{
 			k = p->first;
-			CVmEvent x(PET_DSP_EVT_VM_STATISTICS_UPDATED, k.first, PIE_VIRTUAL_MACHINE);
-			CVmBinaryEventParameter *b = new CVmBinaryEventParameter(EVT_PARAM_STATISTICS);
-			y = GetVmGuestStatistics(k.first, k.second);
-			if (y.isValid())
-				y->Serialize(*b->getBinaryDataStream().getImpl());
-
-			x.addEventParameter(b);
-			g = create_binary_package(x);
+			g = GetVmGuestReport(k)->getEvent(k.first);
 			if (!g.isValid())
 				return;
 		}
@@ -2736,6 +3171,35 @@ void CDspStatCollectingThread::NotifyVmsStatisticsSubscribers()
 	}
 }
 
+SmartPtr<Stat::Report> CDspStatCollectingThread::GetVmGuestReport(const CVmIdent &ident)
+{
+	quint64 n;
+	{
+		QMutexLocker _lock(g_pSubscribersMutex);
+		CVmStatReportsMap::const_iterator p = g_pVmStatReports->constFind(ident);
+		if (g_pVmStatReports->constEnd() != p)
+			return p.value();
+
+		n = g_uVmStatReportsGeneration;
+	}
+
+	// NB. the report is built outside the lock. two threads may build
+	// the same one, the first published wins. a report built across a
+	// new iteration is served but not published.
+	SmartPtr<Stat::Report> output(new Stat::Report(
+		GetVmGuestStatistics(ident.first, ident.second)));
+	QMutexLocker _lock(g_pSubscribersMutex);
+	if (n != g_uVmStatReportsGeneration)
+		return output;
+
+	CVmStatReportsMap::const_iterator p = g_pVmStatReports->constFind(ident);
+	if (g_pVmStatReports->constEnd() != p)
+		return p.value();
+
+	g_pVmStatReports->insert(ident, output);
+	return output;
+}
+
 //static
 void CDspStatCollectingThread::ProcessPerfStatsCommand(const SmartPtr<CDspClient> &pUser,
                                                        const SmartPtr<IOPackage>& pkg)
@@ -2913,12 +3377,68 @@ SmartPtr<CVmEvent> CDspStatCollectingThread::GetPerformanceStatistics(const CVmI
 		QString uuid = CDspService::instance()->getDispConfigGuard().
 			getDispConfig()->getVmServerIdentification()->getServerUuid() ;
 		SmartPtr<CVmEvent> e(new CVmEvent(PET_DSP_EVT_PERFSTATS, uuid, PIE_DISPATCHER));
+		QRegExp f = Stat::Filter::translate(filter);
+		if (f.exactMatch(PERF_SWEEP_TIME_COUNTER))
+		{
+			e->addEventParameter(new CVmEventParameter(PVE::UInt64,
+				QString::number(g_uPerfSweepTime.loadAcquire()),
+				PERF_SWEEP_TIME_COUNTER));
+		}
+		if (f.exactMatch(HARVEST_BACKLOG_COUNTER))
+		{
+			e->addEventParameter(new CVmEventParameter(PVE::UnsignedInt,
+				QString::number(Stat::Collecting::Wheel::getBacklog()),
+				HARVEST_BACKLOG_COUNTER));
+		}
+		typedef QPair<QString, quint64> counter_type;
+		static const char* const s_classes[] = {NULL, "short", "long", "io"};
+		for (int i = Task::CLASS_SHORT; i < Task::CLASS_COUNT; ++i)
+		{
+			Task::Metrics m = CDspService::instance()->getTaskManager()
+				.getMetrics(Task::Class(i));
+			QList<counter_type> l;
+			l << qMakePair(QString("running"), quint64(m.running))
+				<< qMakePair(QString("queued"), quint64(m.queued))
+				<< qMakePair(QString("admitted"), m.admitted)
+				<< qMakePair(QString("delayed"), m.delayed)
+				<< qMakePair(QString("wait_time"), m.waited)
+				<< qMakePair(QString("wait_time_max"), m.longest);
+			foreach (const counter_type& c, l)
+			{
+				QString n = QString(TASK_POOL_COUNTER).arg(s_classes[i]).arg(c.first);
+				if (f.exactMatch(n))
+				{
+					e->addEventParameter(new CVmEventParameter(PVE::UInt64,
+						QString::number(c.second), n));
+				}
+			}
+		}
+		CacheStatistics k = CDspService::instance()->getVmConfigManager()
+			.getCacheStatistics();
+		QList<counter_type> l;
+		l << qMakePair(QString("hits"), k.hits)
+			<< qMakePair(QString("misses"), k.misses)
+			<< qMakePair(QString("copies"), k.copies)
+			<< qMakePair(QString("invalidations"), k.invalidations);
+		foreach (const counter_type& c, l)
+		{
+			QString n = QString(CONFIG_CACHE_COUNTER).arg(c.first);
+			if (f.exactMatch(n))
+			{
+				e->addEventParameter(new CVmEventParameter(PVE::UInt64,
+					QString::number(c.second), n));
+			}
+		}
 		e->setEventCode(PRL_ERR_SUCCESS);
 		return e;
 	}
 
+	boost::optional<Query> q = Query::parse(filter);
+	if (q)
+		return q.get()(id);
+
 	SmartPtr<CVmEvent> e(new CVmEvent(PET_DSP_EVT_VM_PERFSTATS, id.first, PIE_VIRTUAL_MACHINE));
-	Collector c(filter, *e);
+	Collector c(id, filter, *e);
 
 	Libvirt::Result r;
 
@@ -2982,11 +3502,8 @@ void CDspStatCollectingThread::SendVmGuestStatistics(
 	if( IsAvalableStatisctic() )
 	{
 		// send response
-		QString x;
-		SmartPtr<CSystemStatistics> y = GetVmGuestStatistics(sVmUuid, pUser->getVmDirectoryUuid());
-		if (y.isValid())
-			x = y->toString();
-
+		QString x = GetVmGuestReport(qMakePair(sVmUuid,
+			pUser->getVmDirectoryUuid()))->getXml();
 		SendStatisticsResponse(pUser, p, x);
 	}
 	else
@@ -3043,7 +3560,7 @@ SmartPtr<CSystemStatistics> CDspStatCollectingThread::GetVmGuestStatistics(
 	{
 		namespace ctc = Ct::Counter;
 
-		SmartPtr< ::Ct::Statistics::Aggregate> a(CVzHelper::get_env_stat(sVmUuid));
+		SmartPtr< ::Ct::Statistics::Aggregate> a(Stat::Collecting::Sweep::find(sVmUuid));
 		if (!a.isValid())
 			return SmartPtr<CSystemStatistics>();
 		DAO<Meter> dao;
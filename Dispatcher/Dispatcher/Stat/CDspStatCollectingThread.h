@@ -37,6 +37,9 @@
 #include <QMutex>
 #include <QSet>
 #include <QMap>
+#include <QThreadPool>
+#include <QAtomicInteger>
+#include <QPointer>
 #include "CDspRegistry.h"
 #include "CDspStatCollector.h"
 #include "CDspClient.h"
@@ -48,6 +51,7 @@
 namespace Stat
 {
 struct Perf;
+struct Report;
 struct Storage;
 
 namespace Collecting
@@ -92,6 +96,60 @@ private:
 
 } // namespace Harvester
 
+class Farmer;
+
+///////////////////////////////////////////////////////////////////////////////
+// class Wheel
+// Two level timer wheel firing the farmers of all the VMs from one timer.
+// Farmers due at the same tick are started as one batch on a bounded pool.
+
+class Wheel: public QObject
+{
+	enum {
+		TICK = 1000,
+		SLOTS = 64,
+		/*
+		 * Upper bound of concurrent guest agent requests
+		 */
+		CONCURRENCY = 4
+	};
+
+	struct Entry
+	{
+		QPointer<Farmer> farmer;
+		quint64 due;
+	};
+
+public:
+	Wheel();
+
+	// returns the tick the farmer is due at
+	quint64 schedule(Farmer* farmer_, quint64 delay_, quint64 jitter_);
+	QThreadPool& getPool()
+	{
+		return m_pool;
+	}
+	void begin();
+	void end();
+
+	// harvests waiting for a free thread of the pool
+	static quint32 getBacklog();
+
+protected:
+	void timerEvent(QTimerEvent* event_);
+
+private:
+	void place(const Entry& entry_);
+
+	int m_timer;
+	quint64 m_now;
+	quint32 m_running;
+	QList<Entry> m_slots[2][SLOTS];
+	QThreadPool m_pool;
+
+	static QAtomicInteger<quint32> s_backlog;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Farmer
 
@@ -110,21 +168,26 @@ class Farmer: public QObject
 
 	Q_OBJECT
 public:
-	Farmer(const CVmIdent& ident_, getAccess_type getAccess_);
+	Farmer(const CVmIdent& ident_, getAccess_type getAccess_, Wheel& wheel_);
+	~Farmer();
+
+	bool isDue(quint64 tick_) const
+	{
+		return m_due == tick_;
+	}
+	void fire();
 
 public slots:
 	void reset();
 	void handle(unsigned state_, QString uuid_, QString dir_, bool flag_);
 
-protected:
-	void timerEvent(QTimerEvent* event_);
-
 private:
-	int m_timer;
+	quint64 m_due;
 	quint64 m_period;
 	quint64 m_initialPeriod;
 	CVmIdent m_ident;
 	getAccess_type m_getAccess;
+	Wheel* m_wheel;
 	QScopedPointer<QFutureWatcher<bool> > m_watcher;
 };
 
@@ -141,6 +204,7 @@ public:
 	explicit Mapper(Registry::Public& registry_): m_registry(registry_)
 	{
 	}
+	~Mapper();
 
 public slots:
 	void abort(CVmIdent ident_);
@@ -148,6 +212,7 @@ public slots:
 
 private:
 	Registry::Public& m_registry;
+	Wheel m_wheel;
 };
 
 } // namespace Collecting
@@ -258,6 +323,8 @@ private://Statistics collecting helpers set
 private://Static data members
 	/** stat collecting loop successively iteration counter**/
 	static quint64 g_uSuccessivelyCyclesCounter;
+	/** duration of the last perf sweep in microseconds **/
+	static QAtomicInteger<quint64> g_uPerfSweepTime;
 
 	/** Subscribers list access synchronization object */
 	static QMutex *g_pSubscribersMutex;
@@ -283,6 +350,12 @@ private://Static data members
 	typedef QMap<QPair<QString, QString>, QList<StatGetter> >  CVmStatGettersMap;
 	static CVmStatGettersMap *g_pVmStatGetters;
 
+	typedef QMap<CVmIdent, SmartPtr<Stat::Report> > CVmStatReportsMap;
+	/** VMs statistics of the current collecting loop iteration */
+	static CVmStatReportsMap *g_pVmStatReports;
+	/** bumped whenever the VMs statistics are outdated */
+	static quint64 g_uVmStatReportsGeneration;
+
 	/** Internal object data access synchronization object */
 	static QMutex* s_instanceMutex;
 	static CDspStatCollectingThread* s_instance;
@@ -319,6 +392,7 @@ private:
 
 	static QString GetHostStatistics();
 	static SmartPtr<CSystemStatistics> GetVmGuestStatistics( const QString &sVmUuid, const QString &sVmDirUuid );
+	static SmartPtr<Stat::Report> GetVmGuestReport(const CVmIdent &ident);
 	static void SendStatisticsResponse(const SmartPtr<CDspClient> &pUser,
 		const SmartPtr<IOPackage>& p,
 		const QString& statAsString );
@@ -328,6 +402,8 @@ private:
 
 	int m_timer;
 	QDateTime m_last;
+	/** Bounded pool building perf events during a sweep */
+	QThreadPool m_sweepPool;
 
 	Registry::Public& m_registry;
 };
@@ -36,10 +36,15 @@
 // By adding this interface we enable allocations tracing in the module
 #include <prlcommon/Interfaces/Debug.h>
 
+#include <QHash>
+#include <QSet>
+#include <QMutex>
 #include <unistd.h>
 #include <asm/param.h>
 #include <dirent.h>
+#include <fcntl.h>
 #include <stdio.h>
+#include <string.h>
 #include <errno.h>
 
 #ifndef HZ
@@ -50,6 +55,266 @@
 # define ULLONG_MAX ULONG_MAX
 #endif
 
+/** Limit of /proc/<pid>/stat files kept open for the targeted queries */
+#define PROC_TABLE_TRACK_LIMIT 64
+
+namespace
+{
+namespace Proc
+{
+///////////////////////////////////////////////////////////////////////////////
+// struct Stat
+
+struct Stat
+{
+	int pid;
+	// the command name in parentheses as it is in the file
+	char comm[32];
+	quint64 user;
+	quint64 system;
+	quint64 starttime;
+	quint64 vsize;
+	quint64 rss;
+};
+
+// the numbers of /proc/<pid>/stat fields, see proc(5)
+enum
+{
+	FIELD_STATE = 3,
+	FIELD_UTIME = 14,
+	FIELD_STIME = 15,
+	FIELD_STARTTIME = 22,
+	FIELD_VSIZE = 23,
+	FIELD_RSS = 24
+};
+
+bool parseNumber(const char* begin_, const char* end_, quint64& dst_)
+{
+	if (begin_ == end_)
+		return false;
+
+	dst_ = 0;
+	for (; begin_ != end_; ++begin_)
+	{
+		if (*begin_ < '0' || '9' < *begin_)
+			return false;
+
+		dst_ = dst_ * 10 + (*begin_ - '0');
+	}
+	return true;
+}
+
+// parses a line of /proc/<pid>/stat without allocations. the command name
+// may contain spaces and parentheses, thus it ends at the last ')'.
+bool parse(const char* begin_, const char* end_, Stat& dst_)
+{
+	const char* o = static_cast<const char* >(::memchr(begin_, '(', end_ - begin_));
+	const char* c = static_cast<const char* >(::memrchr(begin_, ')', end_ - begin_));
+	if (NULL == o || NULL == c || c < o || o == begin_)
+		return false;
+
+	quint64 x = 0;
+	if (!parseNumber(begin_, o - 1, x))
+		return false;
+
+	dst_.pid = x;
+	std::size_t n = qMin<std::size_t>(c + 1 - o, sizeof(dst_.comm) - 1);
+	::memcpy(dst_.comm, o, n);
+	dst_.comm[n] = 0;
+
+	int f = FIELD_STATE;
+	for (const char* p = c + 1; f <= FIELD_RSS; ++f)
+	{
+		while (p != end_ && ' ' == *p)
+			++p;
+		const char* t = p;
+		while (p != end_ && ' ' != *p && '\n' != *p)
+			++p;
+		if (t == p)
+			return false;
+
+		switch (f)
+		{
+		case FIELD_UTIME:
+			if (!parseNumber(t, p, dst_.user))
+				return false;
+			break;
+		case FIELD_STIME:
+			if (!parseNumber(t, p, dst_.system))
+				return false;
+			break;
+		case FIELD_STARTTIME:
+			if (!parseNumber(t, p, dst_.starttime))
+				return false;
+			break;
+		case FIELD_VSIZE:
+			if (!parseNumber(t, p, dst_.vsize))
+				return false;
+			break;
+		case FIELD_RSS:
+			if (!parseNumber(t, p, dst_.rss))
+				return false;
+			break;
+		}
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Table
+// Process table over /proc. The pid set is refreshed by a sweep over the
+// directory. Files of the pids queried directly are kept open and re-read
+// with pread(); they are closed as soon as their pids leave the set.
+
+struct Table
+{
+	Table(): m_proc(NULL)
+	{
+	}
+	~Table();
+
+	bool find(int pid_, Stat& dst_);
+	void scan(QList<Stat>& dst_);
+
+private:
+	bool open();
+	bool read(int fd_, Stat& dst_) const;
+	bool load(int pid_, Stat& dst_, bool track_);
+	void forget(int pid_);
+
+	QMutex m_mutex;
+	DIR* m_proc;
+	QHash<int, int> m_tracked;
+	QSet<int> m_pids;
+};
+
+Table::~Table()
+{
+	foreach (int fd, m_tracked)
+		::close(fd);
+
+	if (NULL != m_proc)
+		::closedir(m_proc);
+}
+
+bool Table::open()
+{
+	if (NULL != m_proc)
+		return true;
+
+	m_proc = ::opendir("/proc");
+	if (NULL != m_proc)
+		return true;
+
+	WRITE_TRACE_RL(1, DBG_FATAL, "Unable to open /proc by error %d", errno );
+	return false;
+}
+
+bool Table::read(int fd_, Stat& dst_) const
+{
+	char b[4096];
+	ssize_t n = ::pread(fd_, b, sizeof(b), 0);
+	return 0 < n && parse(b, b + n, dst_);
+}
+
+bool Table::load(int pid_, Stat& dst_, bool track_)
+{
+	QHash<int, int>::const_iterator p = m_tracked.constFind(pid_);
+	if (m_tracked.constEnd() != p)
+	{
+		if (read(p.value(), dst_))
+			return true;
+
+		// the process has gone, the pid may be reused already
+		forget(pid_);
+	}
+
+	char name[32];
+	::snprintf(name, sizeof(name), "%d/stat", pid_);
+	int fd = ::openat(::dirfd(m_proc), name, O_RDONLY | O_CLOEXEC);
+	if (-1 == fd)
+		return false;
+
+	bool output = read(fd, dst_);
+	if (output && track_ && m_tracked.size() < PROC_TABLE_TRACK_LIMIT)
+		m_tracked.insert(pid_, fd);
+	else
+		::close(fd);
+
+	return output;
+}
+
+void Table::forget(int pid_)
+{
+	QHash<int, int>::iterator p = m_tracked.find(pid_);
+	if (m_tracked.end() == p)
+		return;
+
+	::close(p.value());
+	m_tracked.erase(p);
+}
+
+bool Table::find(int pid_, Stat& dst_)
+{
+	QMutexLocker g(&m_mutex);
+	return open() && load(pid_, dst_, true);
+}
+
+void Table::scan(QList<Stat>& dst_)
+{
+	QMutexLocker g(&m_mutex);
+	if (!open())
+		return;
+
+	QSet<int> x;
+	x.reserve(m_pids.size());
+	::rewinddir(m_proc);
+	struct dirent* e;
+	while ((e = ::readdir(m_proc)) != NULL)
+	{
+		quint64 y = 0;
+		if (!parseNumber(e->d_name, e->d_name + ::strlen(e->d_name), y))
+			continue;
+
+		Stat s;
+		if (load(y, s, false))
+		{
+			x.insert(y);
+			dst_.append(s);
+		}
+	}
+
+	// pids that have left since the last sweep
+	m_pids.subtract(x);
+	foreach (int pid, m_pids)
+		forget(pid);
+
+	m_pids.swap(x);
+}
+
+Table& getTable()
+{
+	static Table s_table;
+	return s_table;
+}
+
+} // namespace Proc
+
+void convert(const Proc::Stat& src_, CProcStatInfo& dst_)
+{
+	dst_.m_nId = src_.pid;
+	dst_.m_sCommandName = QString::fromUtf8(src_.comm);
+	dst_.m_nUserTime = src_.user * 1000 / HZ;
+	dst_.m_nSystemTime = src_.system * 1000 / HZ;
+	dst_.m_nTotalTime = dst_.m_nUserTime + dst_.m_nSystemTime;
+	dst_.m_nStartTime = src_.starttime * 1000 / HZ;
+	dst_.m_nRealMemUsage = src_.rss * 4096;
+	dst_.m_nVirtMemUsage = src_.vsize;
+	dst_.m_nTotalMemUsage = dst_.m_nRealMemUsage + dst_.m_nVirtMemUsage;
+}
+
+} // namespace
+
 void CDspStatCollector::GetCpusStatInfo(SmartPtr<CCpusStatInfo> pCpusStatInfo)
 {
 	FILE *stat;
@@ -132,66 +397,27 @@ void CDspStatCollector::GetUptimeStatInfo(SmartPtr<CUptimeStatInfo> pUptimeStatI
 
 void CDspStatCollector::GetProcsStatInfo(SmartPtr<CProcsStatInfo> pProcsStatInfo, Q_PID tpid )
 {
-	DIR *proc;
-	FILE *fp;
-	int pid;
-	char name[512];
-	struct dirent *pde;
-	unsigned long long user, system, starttime, vsize, rsize;
-
-	proc = opendir("/proc");
-	if(!proc)
+	QList<Proc::Stat> x;
+	if (tpid)
 	{
-		WRITE_TRACE_RL(1, DBG_FATAL, "Unable to open /proc by error %d", errno );
-		return;
+		Proc::Stat s;
+		if (Proc::getTable().find(tpid, s))
+			x.append(s);
 	}
+	else
+		Proc::getTable().scan(x);
 
-	while( (pde = readdir(proc)) != NULL) {
-		if (!isdigit(pde->d_name[0])) continue;
-
-		if ( tpid && (int )tpid != UTF8_2QSTR(pde->d_name).toInt() )
-			continue;
-
-		sprintf(name, "/proc/%s/stat", pde->d_name);
-		fp = fopen(name, "r");
-		if(!fp) continue;
+	foreach (const Proc::Stat& s, x)
+	{
 		SmartPtr<CProcStatInfo> pProcStatInfo( new CProcStatInfo );
-
-		QString fileName = name;
-
-		if (fscanf(fp, "%d %31s %*c %*d %*d %*d %*d %*d %*d %*d %*d %*d %*d %llu %llu %*d %*d %*d %*d %*d %*d %llu %llu %llu",
-				&pid,
-				name,
-				&user,
-				&system,
-				&starttime,
-				&vsize,
-				&rsize) < 0) {
-			fclose(fp);
-			continue;
-		}
-
-		pProcStatInfo->m_nId = pid;
-		pProcStatInfo->m_sCommandName = QString::fromUtf8(name);
-		pProcStatInfo->m_nUserTime = quint64(user) * 1000 / HZ;
-		pProcStatInfo->m_nSystemTime = quint64(system) * 1000 / HZ;
-		pProcStatInfo->m_nTotalTime = pProcStatInfo->m_nUserTime + pProcStatInfo->m_nSystemTime;
-		pProcStatInfo->m_nStartTime = quint64(starttime) * 1000 / HZ;
-		pProcStatInfo->m_nRealMemUsage =  quint64(rsize) * 4096;
-		pProcStatInfo->m_nVirtMemUsage = vsize;
-		pProcStatInfo->m_nTotalMemUsage = pProcStatInfo->m_nRealMemUsage + pProcStatInfo->m_nVirtMemUsage;
+		convert(s, *pProcStatInfo);
 		pProcsStatInfo->m_lstProcsStatInfo.append(pProcStatInfo);
-		fclose(fp);
 
 		WRITE_TRACE( DBG_TRACE, "TMP>>> %d %llu %llu %llu %llu\n"
-			, pid, user, system, starttime, pProcStatInfo->m_nTotalTime);
+			, s.pid, s.user, s.system, s.starttime, pProcStatInfo->m_nTotalTime);
 		WRITE_TRACE( DBG_TRACE, "TMP>>> PID = %d  m_nStartTime = %llu "
 			, pProcStatInfo->m_nId, pProcStatInfo->m_nStartTime );
-
-		if (tpid)
-			break;
 	}
-	closedir(proc);
 }
 
 void CDspStatCollector::GetSystemUsersSessions(SmartPtr<CUsersStatInfo> pUsersStatInfo)
@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @file CDspStatFilter.cpp
+///
+/// Compiled filters of performance counters subscriptions.
+///
+/// Copyright (c) 2005-2017, Parallels International GmbH
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+/// 
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+/// 
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include "CDspStatFilter.h"
+
+namespace Stat
+{
+///////////////////////////////////////////////////////////////////////////////
+// struct Filter
+
+QMutex Filter::s_mutex;
+Filter::cache_type Filter::s_cache;
+
+Filter::Filter(const QString& filter_):
+	m_any(filter_.isEmpty() || filter_ == "*"), m_regexp(translate(filter_))
+{
+	if (filter_.contains('|'))
+		return;
+
+	QRegExp w("[*#?+^$()\\[\\]{}\\\\]");
+	int n = w.indexIn(filter_);
+	// NB. ? and {} may drop the character before them
+	if (0 < n && (filter_.at(n) == '?' || filter_.at(n) == '{'))
+		--n;
+
+	m_head = filter_.left(n);
+}
+
+bool Filter::admits(const QString& family_) const
+{
+	return m_head.startsWith(family_) || family_.startsWith(m_head);
+}
+
+bool Filter::match(const QString& name_) const
+{
+	if (m_any)
+		return true;
+
+	if (!name_.startsWith(m_head))
+		return false;
+
+	QMutexLocker g(&m_mutex);
+	QHash<QString, bool>::const_iterator p = m_verdicts.constFind(name_);
+	if (m_verdicts.constEnd() != p)
+		return p.value();
+
+	return m_verdicts[name_] = m_regexp.exactMatch(name_);
+}
+
+QRegExp Filter::translate(QString filter_)
+{
+	if (filter_.isEmpty())
+	{
+		filter_ = ".*";
+	}
+	else
+	{
+		filter_.replace('.', "\\.");
+		filter_.replace('*', ".*");
+		filter_.replace('#', "[0-9]+");
+	}
+
+	return QRegExp(filter_);
+}
+
+QSharedPointer<Filter> Filter::compile(const CVmIdent& vm_, const QString& filter_)
+{
+	QMutexLocker g(&s_mutex);
+	QSharedPointer<Filter>& output = s_cache[qMakePair(vm_, filter_)];
+	if (output.isNull())
+		output = QSharedPointer<Filter>(new Filter(filter_));
+
+	return output;
+}
+
+QSharedPointer<Filter> Filter::find(const CVmIdent& vm_, const QString& filter_)
+{
+	QMutexLocker g(&s_mutex);
+	return s_cache.value(qMakePair(vm_, filter_));
+}
+
+void Filter::drop(const CVmIdent& vm_, const QString& filter_)
+{
+	QMutexLocker g(&s_mutex);
+	s_cache.remove(qMakePair(vm_, filter_));
+}
+
+} // namespace Stat
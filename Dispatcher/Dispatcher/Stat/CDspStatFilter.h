@@ -0,0 +1,76 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @file CDspStatFilter.h
+///
+/// Compiled filters of performance counters subscriptions.
+///
+/// Copyright (c) 2005-2017, Parallels International GmbH
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+/// 
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+/// 
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __CDSPSTATFILTER_H__
+#define __CDSPSTATFILTER_H__
+
+#include <QHash>
+#include <QMutex>
+#include <QRegExp>
+#include <QString>
+#include <QSharedPointer>
+#include "../CVmIdent.h"
+
+namespace Stat
+{
+///////////////////////////////////////////////////////////////////////////////
+// struct Filter
+// A perf subscription filter compiled once per (VM, filter). Verdicts are
+// remembered by counter name. The literal head of the filter rejects whole
+// families of counters before their names are built.
+
+struct Filter
+{
+	explicit Filter(const QString& filter_);
+
+	bool admits(const QString& family_) const;
+	bool match(const QString& name_) const;
+
+	static QRegExp translate(QString filter_);
+	static QSharedPointer<Filter> compile(const CVmIdent& vm_, const QString& filter_);
+	static QSharedPointer<Filter> find(const CVmIdent& vm_, const QString& filter_);
+	static void drop(const CVmIdent& vm_, const QString& filter_);
+
+private:
+	typedef QHash<QPair<CVmIdent, QString>, QSharedPointer<Filter> > cache_type;
+
+	static QMutex s_mutex;
+	static cache_type s_cache;
+
+	bool m_any;
+	QString m_head;
+	mutable QMutex m_mutex;
+	mutable QRegExp m_regexp;
+	mutable QHash<QString, bool> m_verdicts;
+};
+
+} // namespace Stat
+
+#endif // __CDSPSTATFILTER_H__
@@ -33,59 +33,252 @@
 #include <QPair>
 #include <boost/foreach.hpp>
 #include <prlcommon/Interfaces/VirtuozzoQt.h>
+#include <prlcommon/Logging/Logging.h>
 #include "CDspStatStorage.h"
 
 namespace Stat
 {
+///////////////////////////////////////////////////////////////////////////////
+// struct Cell
+
+timedValue_type Cell::read() const
+{
+	forever
+	{
+		int s = m_sequence.loadAcquire();
+		if (s & 1)
+			continue;
+
+		timedValue_type output(m_value.loadAcquire(), m_time.loadAcquire());
+		if (s == m_sequence.loadAcquire())
+			return output;
+	}
+}
+
+void Cell::write(quint64 value_, quint64 time_)
+{
+	int s;
+	do
+	{
+		s = m_sequence.loadAcquire();
+	} while ((s & 1) || !m_sequence.testAndSetAcquire(s, s + 1));
+
+	m_value.storeRelease(value_);
+	m_time.storeRelease(time_);
+	m_sequence.storeRelease(s + 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Rollup
+
+void Rollup::add(quint64 value_, quint64 time_)
+{
+	if (0 == count++)
+	{
+		time = time_;
+		min = max = value_;
+	}
+	else
+	{
+		min = qMin(min, value_);
+		max = qMax(max, value_);
+	}
+	sum += value_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// struct History
+
+void History::record(quint64 value_, quint64 time_)
+{
+	// times are monotonic usecs
+	const quint64 MINUTE = 60 * 1000000ULL, HOUR = 60 * MINUTE;
+
+	Rollup r;
+	r.add(value_, time_);
+	m_raw.push(r);
+	if (0 < m_minute.count && time_ / MINUTE != m_minute.time / MINUTE)
+	{
+		m_minutes.push(m_minute);
+		m_minute = Rollup();
+	}
+	m_minute.add(value_, time_);
+	if (0 < m_hour.count && time_ / HOUR != m_hour.time / HOUR)
+	{
+		m_hours.push(m_hour);
+		m_hour = Rollup();
+	}
+	m_hour.add(value_, time_);
+}
+
+QList<Rollup> History::read(Tier tier_, quint64 since_) const
+{
+	QList<Rollup> output;
+	switch (tier_)
+	{
+	case TIER_RAW:
+		return m_raw.read(since_);
+	case TIER_MINUTE:
+		output = m_minutes.read(since_);
+		if (0 < m_minute.count && m_minute.time >= since_)
+			output << m_minute;
+		break;
+	case TIER_HOUR:
+		output = m_hours.read(since_);
+		if (0 < m_hour.count && m_hour.time >= since_)
+			output << m_hour;
+		break;
+	}
+	return output;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Storage
 
-Storage::Storage(const QString& id_)
+Storage::Storage(const QString& id_): m_size(0)
 {
 	Q_UNUSED(id_);
 }
 
-void Storage::addAbsolute(const QString& name_)
+Storage::~Storage()
+{
+	for (int i = 0; i < CHUNK_COUNT; ++i)
+		delete [] m_chunks[i].load();
+}
+
+boost::optional<counterId_type> Storage::add(const QString& name_)
 {
+	boost::optional<counterId_type> output = find(name_);
+	if (output)
+		return output;
+
 	QWriteLocker l(&m_rwLock);
+	QHash<QString, counterId_type>::const_iterator p = m_index.constFind(name_);
+	if (m_index.constEnd() != p)
+		return p.value();
 
-	if (m_absolute.contains(name_) || m_incremental.contains(name_))
-		return;
+	counterId_type x = m_size.load();
+	if (CHUNK_SIZE * CHUNK_COUNT <= x)
+	{
+		WRITE_TRACE(DBG_FATAL, "too many counters, %s is ignored", QSTR2UTF8(name_));
+		return boost::none;
+	}
+	if (0 == x % CHUNK_SIZE)
+		m_chunks[x / CHUNK_SIZE].storeRelease(new Cell[CHUNK_SIZE]);
 
-	m_absolute.insert(name_, timedValue_type());
+	m_index.insert(name_, x);
+	m_size.storeRelease(x + 1);
+	return x;
 }
 
-void Storage::addIncremental(const QString& name_)
+boost::optional<counterId_type> Storage::addAbsolute(const QString& name_)
 {
-	QWriteLocker l(&m_rwLock);
+	return add(name_);
+}
 
-	if (m_incremental.contains(name_) || m_absolute.contains(name_))
+boost::optional<counterId_type> Storage::addIncremental(const QString& name_)
+{
+	return add(name_);
+}
+
+boost::optional<counterId_type> Storage::find(const QString& name_) const
+{
+	QReadLocker l(&m_rwLock);
+	QHash<QString, counterId_type>::const_iterator p = m_index.constFind(name_);
+	if (m_index.constEnd() == p)
+		return boost::none;
+
+	return p.value();
+}
+
+Cell* Storage::locate(counterId_type id_) const
+{
+	if ((counterId_type)m_size.loadAcquire() <= id_)
+		return NULL;
+
+	return m_chunks[id_ / CHUNK_SIZE].loadAcquire() + id_ % CHUNK_SIZE;
+}
+
+timedValue_type Storage::read(const QString& name_) const
+{
+	boost::optional<counterId_type> x = find(name_);
+	if (!x)
+		return timedValue_type();
+
+	return read(x.get());
+}
+
+timedValue_type Storage::read(counterId_type id_) const
+{
+	Cell* c = locate(id_);
+	if (NULL == c)
+		return timedValue_type();
+
+	return c->read();
+}
+
+void Storage::write(const QString& name_, quint64 value_, quint64 time_)
+{
+	boost::optional<counterId_type> x = find(name_);
+	if (x)
+		write(x.get(), value_, time_);
+}
+
+void Storage::write(counterId_type id_, quint64 value_, quint64 time_)
+{
+	Cell* c = locate(id_);
+	if (NULL == c)
+		return;
+
+	c->write(value_, time_);
+	if (0 == m_watched.loadAcquire())
 		return;
 
-	m_incremental.insert(name_, timedValue_type());
+	QMutexLocker g(&m_historyMutex);
+	QSharedPointer<History>& h = m_history[id_];
+	if (h.isNull())
+		h = QSharedPointer<History>(new History());
+
+	h->record(value_, time_);
 }
 
-timedValue_type Storage::read(const QString& name_)
+QHash<QString, counterId_type> Storage::getCounters() const
 {
 	QReadLocker l(&m_rwLock);
+	return m_index;
+}
 
-	if (m_absolute.contains(name_))
-		return m_absolute[name_];
+void Storage::watch()
+{
+	m_watched.storeRelease(1);
+}
 
-	if (m_incremental.contains(name_))
-		return m_incremental[name_];
+QList<Rollup> Storage::readHistory(counterId_type id_, History::Tier tier_,
+	quint64 since_) const
+{
+	QMutexLocker g(&m_historyMutex);
+	QSharedPointer<History> h = m_history.value(id_);
+	if (h.isNull())
+		return QList<Rollup>();
 
-	return timedValue_type();
+	return h->read(tier_, since_);
 }
 
-void Storage::write(const QString& name_, quint64 value_, quint64 time_)
+///////////////////////////////////////////////////////////////////////////////
+// struct Column
+
+boost::optional<counterId_type> Column::find(Storage& storage_, int position_,
+	const QString& name_)
 {
-	QWriteLocker l(&m_rwLock);
+	QMutexLocker g(&m_mutex);
+	if (m_entries.size() <= position_)
+		m_entries.resize(position_ + 1);
+
+	entry_type& e = m_entries[position_];
+	if (e.first.isNull() || e.first != name_)
+		e = entry_type(name_, storage_.addAbsolute(name_));
 
-	if (m_absolute.contains(name_))
-		m_absolute[name_] = timedValue_type(value_, time_);
-	else if (m_incremental.contains(name_))
-		m_incremental[name_] = timedValue_type(value_, time_);
+	return e.second;
 }
 
 namespace Name
@@ -103,6 +296,30 @@ QString Cpu::getName()
 // struct VCpu
 
 QString VCpu::getName(unsigned index_)
+{
+	enum
+	{
+		CACHED = 256
+	};
+	struct Cache
+	{
+		Cache()
+		{
+			for (unsigned i = 0; i < CACHED; ++i)
+				names[i] = generate(i);
+		}
+
+		QString names[CACHED];
+	};
+	static const Cache s_cache;
+
+	if (CACHED > index_)
+		return s_cache.names[index_];
+
+	return generate(index_);
+}
+
+QString VCpu::generate(unsigned index_)
 {
 	return QString("guest.vcpu%1.time").arg(index_);
 }
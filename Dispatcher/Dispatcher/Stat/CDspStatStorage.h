@@ -35,34 +35,205 @@
 
 #include <QPair>
 #include <QHash>
+#include <QList>
+#include <QMutex>
 #include <QString>
+#include <QVector>
+#include <QAtomicInt>
+#include <QSharedPointer>
+#include <QAtomicPointer>
+#include <QAtomicInteger>
 #include <QReadWriteLock>
+#include <boost/optional.hpp>
 #include <prlxmlmodel/VmConfig/CVmConfiguration.h>
 
 namespace Stat
 {
 typedef QPair<quint64, quint64> timedValue_type;
+typedef quint32 counterId_type;
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Cell
+// Last value of a counter with its time. Writers take the odd sequence
+// number in turn, readers retry until the sequence is even and stable.
+
+struct Cell
+{
+	Cell(): m_sequence(0), m_value(0), m_time(0)
+	{
+	}
+
+	timedValue_type read() const;
+
+	void write(quint64 value_, quint64 time_);
+
+private:
+	QAtomicInt m_sequence;
+	QAtomicInteger<quint64> m_value;
+	QAtomicInteger<quint64> m_time;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Rollup
+// Aggregate of the counter samples taken during a period. A raw sample is
+// a rollup of one.
+
+struct Rollup
+{
+	Rollup(): time(), count(), min(), max(), sum()
+	{
+	}
+
+	void add(quint64 value_, quint64 time_);
+
+	quint64 getAverage() const
+	{
+		return 0 == count ? 0 : quint64(sum / count);
+	}
+
+	// the time of the first sample in the period
+	quint64 time;
+	quint32 count;
+	quint64 min;
+	quint64 max;
+	double sum;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Ring
+
+template<int N>
+struct Ring
+{
+	Ring(): m_head(), m_size()
+	{
+	}
+
+	void push(const Rollup& value_)
+	{
+		m_data[m_head] = value_;
+		m_head = (m_head + 1) % N;
+		m_size = qMin(m_size + 1, N);
+	}
+	QList<Rollup> read(quint64 since_) const
+	{
+		QList<Rollup> output;
+		for (int i = 0; i < m_size; ++i)
+		{
+			const Rollup& r = m_data[(m_head + N - m_size + i) % N];
+			if (r.time >= since_)
+				output << r;
+		}
+		return output;
+	}
+
+private:
+	int m_head;
+	int m_size;
+	Rollup m_data[N];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct History
+// Fixed memory history of a counter. Raw samples are kept as they come
+// alongside with per minute and per hour rollups of them.
+
+struct History
+{
+	enum Tier
+	{
+		TIER_RAW,
+		TIER_MINUTE,
+		TIER_HOUR
+	};
+
+	void record(quint64 value_, quint64 time_);
+
+	QList<Rollup> read(Tier tier_, quint64 since_) const;
+
+private:
+	enum
+	{
+		RAW_DEPTH = 90,
+		MINUTE_DEPTH = 120,
+		HOUR_DEPTH = 48
+	};
+
+	Ring<RAW_DEPTH> m_raw;
+	Ring<MINUTE_DEPTH> m_minutes;
+	Ring<HOUR_DEPTH> m_hours;
+	Rollup m_minute;
+	Rollup m_hour;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Storage
+// Counters are interned into small ids once. Values live in a flat array
+// of cells that never moves, thus reads and writes by id take no locks.
 
 struct Storage: boost::noncopyable
 {
 	explicit Storage(const QString& id_);
+	~Storage();
+
+	boost::optional<counterId_type> addAbsolute(const QString& name_);
 
-	void addAbsolute(const QString& name_);
+	boost::optional<counterId_type> addIncremental(const QString& name_);
 
-	void addIncremental(const QString& name_);
+	boost::optional<counterId_type> find(const QString& name_) const;
 
-	timedValue_type read(const QString& name_);
+	timedValue_type read(const QString& name_) const;
+
+	timedValue_type read(counterId_type id_) const;
 
 	void write(const QString& name_, quint64 value_, quint64 time_);
 
+	void write(counterId_type id_, quint64 value_, quint64 time_);
+
+	QHash<QString, counterId_type> getCounters() const;
+
+	// starts keeping the history of all the counters. the history costs
+	// memory thus is kept only for VMs somebody has asked about.
+	void watch();
+
+	QList<Rollup> readHistory(counterId_type id_, History::Tier tier_,
+		quint64 since_) const;
+
 private:
-	typedef QHash<QString, timedValue_type> hash_type;
+	enum
+	{
+		CHUNK_SIZE = 64,
+		CHUNK_COUNT = 64
+	};
+
+	boost::optional<counterId_type> add(const QString& name_);
+	Cell* locate(counterId_type id_) const;
+
+	mutable QReadWriteLock m_rwLock;
+	QHash<QString, counterId_type> m_index;
+	QAtomicInt m_size;
+	QAtomicPointer<Cell> m_chunks[CHUNK_COUNT];
+	QAtomicInt m_watched;
+	mutable QMutex m_historyMutex;
+	QHash<counterId_type, QSharedPointer<History> > m_history;
+};
 
-	QReadWriteLock m_rwLock;
-	hash_type m_absolute;
-	hash_type m_incremental;
+///////////////////////////////////////////////////////////////////////////////
+// struct Column
+// Ids of a list of absolute counters that is reported in the same order on
+// every sample. A name is interned once and later found by its position,
+// the storage index is consulted again only when the name there changes.
+
+struct Column: boost::noncopyable
+{
+	boost::optional<counterId_type> find(Storage& storage_, int position_,
+		const QString& name_);
+
+private:
+	typedef QPair<QString, boost::optional<counterId_type> > entry_type;
+
+	QMutex m_mutex;
+	QVector<entry_type> m_entries;
 };
 
 namespace Name
@@ -82,6 +253,9 @@ struct Cpu
 struct VCpu
 {
 	static QString getName(unsigned index_);
+
+private:
+	static QString generate(unsigned index_);
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -284,6 +284,12 @@ Prl::Expected<QPair<char*, qint32>, PRL_RESULT>
 	return PRL_ERR_SUCCESS;
 }
 
+bool Unit::isReadyRead()
+{
+	QMutexLocker g(&m_mutex);
+	return !m_channel.isNull() && 0 < m_channel->bytesAvailable();
+}
+
 PRL_RESULT Unit::read(char *data, qint32 size, UINT32 tmo)
 {
 	m_mutex.lock();
@@ -1120,6 +1126,14 @@ PRL_RESULT Chain::forward(SmartPtr<IOPackage> request_, process_type& dst_)
 	return m_next->do_(request_, dst_);
 }
 
+PRL_RESULT Chain::flush(process_type& dst_)
+{
+	if (NULL == m_next.getImpl())
+		return PRL_ERR_SUCCESS;
+
+	return m_next->flush(dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct GoodBye
 
@@ -1145,7 +1159,7 @@ PRL_RESULT GoodBye::do_(SmartPtr<IOPackage> request_, process_type& dst_)
 
 	m_yes = true;
 	WRITE_TRACE(DBG_DEBUG, "Backup client exited");
-	return PRL_ERR_SUCCESS;
+	return flush(dst_);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1167,12 +1181,17 @@ PRL_RESULT Close::do_(SmartPtr<IOPackage> request_, process_type& dst_)
 	if (ABackupProxyCloseRequest != request_->header.type)
 		return forward(request_, dst_);
 
+	// replies of the forwarded requests go first
+	PRL_RESULT e = flush(dst_);
+	if (PRL_FAILED(e))
+		return e;
+
 	// ABackupProxyCloseRequest is not implemented prior
 	// to V3 but so backup_client wait reply from dst, will send valid reply
 	// from local dispatcher
 	qint32 nReply = ABackupProxyResponse;
 	quint32 uReplySize = sizeof(nReply);
-	PRL_RESULT e = dst_.write((char *)&uReplySize, sizeof(uReplySize));
+	e = dst_.write((char *)&uReplySize, sizeof(uReplySize));
 	if (PRL_FAILED(e))
 		return e;
 
@@ -1185,6 +1204,40 @@ PRL_RESULT Close::do_(SmartPtr<IOPackage> request_, process_type& dst_)
 PRL_RESULT Forward::do_(SmartPtr<IOPackage> request_, process_type& dst_)
 {
 	IOSendJob::Handle hJob = m_client->sendPackage(request_);
+	if (!hJob.isValid())
+	{
+		WRITE_TRACE(DBG_FATAL, "Package sending failure");
+		return PRL_ERR_BACKUP_INTERNAL_PROTO_ERROR;
+	}
+	m_pending.enqueue(hJob);
+	// the backup client does not tell whether it waits for a reply. while
+	// it keeps on sending requests there is no need to - push them ahead
+	// until the window is full. once the pipe is quiet hand back replies
+	// in the order of requests.
+	while (!m_pending.isEmpty() &&
+		(m_pending.size() >= (int)m_window || !dst_.isReadyRead()))
+	{
+		PRL_RESULT e = reap(dst_);
+		if (PRL_FAILED(e))
+			return e;
+	}
+	return PRL_ERR_SUCCESS;
+}
+
+PRL_RESULT Forward::flush(process_type& dst_)
+{
+	while (!m_pending.isEmpty())
+	{
+		PRL_RESULT e = reap(dst_);
+		if (PRL_FAILED(e))
+			return e;
+	}
+	return Chain::flush(dst_);
+}
+
+PRL_RESULT Forward::reap(process_type& dst_)
+{
+	IOSendJob::Handle hJob = m_pending.dequeue();
 	IOSendJob::Result res = m_client->waitForSend(hJob, m_timeout*1000);
 	if (res != IOSendJob::Success)
 	{
@@ -1960,6 +2013,11 @@ PRL_RESULT Task_BackupMixin::startABackupClient(const QString& sVmName_, const Q
 		if (PRL_FAILED(e))
 			break;
 	}
+	// the replies still in flight carry their own errors
+	PRL_RESULT f = y->flush(*m_cABackupClient);
+	if (PRL_SUCCEEDED(e))
+		e = f;
+
 	PRL_RESULT output = x.result(m_bKillCalled, m_task->getLastError());
 	if (!m_bKillCalled && !isConnected()) {
 		WRITE_TRACE(DBG_FATAL, "Backup client IO no connection");
@@ -1983,7 +2041,8 @@ Chain * Task_BackupMixin::prepareABackupChain(const QStringList& args_,
 	CVmEvent e(event_type, sNotificationVmUuid, PIE_DISPATCHER);
 	Chain *p = new Progress(e, nDiskIdx, m_task->getRequestPackage());
 	if (args_.indexOf("--local") == -1)
-		p->next(SmartPtr<Chain>(new Forward(m_pIoClient, m_nBackupTimeout)));
+		p->next(SmartPtr<Chain>(new Forward(m_pIoClient, m_nBackupTimeout,
+			PRL_BACKUP_FORWARD_WINDOW)));
 	return p;
 }
 
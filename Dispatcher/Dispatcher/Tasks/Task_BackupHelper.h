@@ -33,6 +33,7 @@
 #ifndef __Task_BackupHelper_H_
 #define __Task_BackupHelper_H_
 
+#include <QQueue>
 #include "Task_BackupQObject_p.h"
 #include <boost/utility/enable_if.hpp>
 #include "Task_DispToDispConnHelper.h"
@@ -62,6 +63,8 @@
 #endif
 
 #define PRL_CT_BACKUP_TIB_FILE_NAME "private.tib"
+/* requests forwarded to the remote side without waiting for a reply */
+#define PRL_BACKUP_FORWARD_WINDOW 16
 
 enum BackupCheckMode {
 	PRL_BACKUP_CHECK_MODE_READ,
@@ -156,6 +159,8 @@ struct Chain
 		m_next = next_;
 	}
 	virtual PRL_RESULT do_(SmartPtr<IOPackage> request_, process_type& dst_) = 0;
+	// hands back the replies still pending down the chain
+	virtual PRL_RESULT flush(process_type& dst_);
 protected:
 	PRL_RESULT forward(SmartPtr<IOPackage> request_, process_type& dst_);
 
@@ -168,15 +173,20 @@ private:
 
 struct Forward: Chain
 {
-	Forward(SmartPtr<IOClient> client_, quint32 timeout_):
-		m_timeout(timeout_), m_client(client_)
+	Forward(SmartPtr<IOClient> client_, quint32 timeout_, quint32 window_ = 1):
+		m_timeout(timeout_), m_window(qMax(window_, 1U)), m_client(client_)
 	{
 	}
 
 	PRL_RESULT do_(SmartPtr<IOPackage> request_, process_type& dst_);
+	PRL_RESULT flush(process_type& dst_);
 private:
+	PRL_RESULT reap(process_type& dst_);
+
 	quint32 m_timeout;
+	quint32 m_window;
 	SmartPtr<IOClient> m_client;
+	QQueue<IOSendJob::Handle> m_pending;
 };
 
 struct Task_BackupMixin;
@@ -825,6 +825,7 @@ struct Unit: Abstract::Unit
 	PRL_RESULT waitForFinished();
 	void kill();
 	PRL_RESULT read(char *buffer, qint32 size, UINT32 tmo = 0);
+	bool isReadyRead();
 	PRL_RESULT write(char* data_, quint32 size_);
 	PRL_RESULT write(const SmartPtr<char>& data_, quint32 size_);
 
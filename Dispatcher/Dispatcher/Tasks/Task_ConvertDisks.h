@@ -50,6 +50,7 @@ public:
 					  PRL_UINT32 nDiskMask,
 					  PRL_UINT32 nFlags);
 	virtual ~Task_ConvertDisks();
+	virtual Task::Class getTaskClass() const { return Task::CLASS_IO; }
 
 private slots:
 
@@ -46,6 +46,7 @@ public:
 	Task_CopyImage( const SmartPtr<CDspClient>& pClient,
 					const SmartPtr<IOPackage>& p);
 	virtual ~Task_CopyImage();
+	virtual Task::Class getTaskClass() const { return Task::CLASS_IO; }
 
 private:
 
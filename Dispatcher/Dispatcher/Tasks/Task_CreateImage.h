@@ -66,6 +66,7 @@ public:
 					  bool flgRecreateIsAllowed,
 						bool bForceQuestionsSign );
 	virtual QString getVmUuid();
+	virtual Task::Class getTaskClass() const { return Task::CLASS_IO; }
 protected:
    virtual PRL_RESULT run_body();
 
@@ -60,6 +60,7 @@ public:
     * Class destructor
 	*/
     virtual ~Task_CreateProblemReport();
+    virtual Task::Class getTaskClass() const { return Task::CLASS_LONG; }
 
     /**
     * Cancels running operation
@@ -49,6 +49,7 @@ public:
 				PRL_UINT32 nOpFlags = 0);
 
 	virtual QString getVmUuid();
+	virtual Task::Class getTaskClass() const { return Task::CLASS_IO; }
 	const QString getDiskImage() const;
 
 protected:
@@ -49,6 +49,7 @@ public:
                               const SmartPtr<IOPackage>&,
                               const QString& target,
                               CHwFileSystemInfo* fs_info );
+   virtual Task::Class getTaskClass() const { return Task::CLASS_SHORT; }
 protected:
 
 	virtual PRL_RESULT run_body();
@@ -55,6 +55,7 @@ public:
 		const CProtoCommandPtr,
 		const SmartPtr<IOPackage> &);
 	~Task_MigrateCtSource();
+	virtual Task::Class getTaskClass() const { return Task::CLASS_LONG; }
 
 protected:
 	virtual PRL_RESULT prepareTask();
@@ -932,7 +932,7 @@ IO::~IO()
 
 IOSendJob::Handle IO::sendPackage(const SmartPtr<IOPackage> &package)
 {
-	return m_io->sendPackage(package);
+	return m_io->sendPackage(encode(package));
 }
 
 IOSendJob::Result IO::getSendResult(const IOSendJob::Handle& job_)
@@ -942,7 +942,11 @@ IOSendJob::Result IO::getSendResult(const IOSendJob::Handle& job_)
 
 void IO::reactReceived(const SmartPtr<IOPackage>& package)
 {
-	emit onReceived(package);
+	SmartPtr<IOPackage> p = decode(package);
+	if (p.isValid())
+		emit onReceived(p);
+	else
+		emit disconnected();
 }
 
 void IO::reactSend(IOClientInterface*, IOSendJob::Result, const SmartPtr<IOPackage> package_)
@@ -1196,6 +1200,14 @@ void Frontend::audit(const Libvirt::Trick::Online::downtime_type& downtime_)
 end of shared code from Vm/CVmMigrateTask.cpp
 */
 
+static void AddProgressParameter(CVmEvent &event, int nPercents)
+{
+	event.addEventParameter(new CVmEventParameter(
+		PVE::UnsignedInt,
+		QString::number(nPercents),
+		EVT_PARAM_PROGRESS_CHANGED));
+}
+
 static void NotifyClientsWithProgress(
 		const SmartPtr<IOPackage> &p,
 		const QString &sVmDirectoryUuid,
@@ -1203,11 +1215,27 @@ static void NotifyClientsWithProgress(
 		int nPercents)
 {
 	CVmEvent event(PET_DSP_EVT_VM_MIGRATE_PROGRESS_CHANGED, sVmUuid, PIE_DISPATCHER);
+	AddProgressParameter(event, nPercents);
+
+	SmartPtr<IOPackage> pPackage = DispatcherPackage::createInstance(PVE::DspVmEvent, event, p);
+	CDspService::instance()->getClientManager().sendPackageToVmClients(pPackage, sVmDirectoryUuid, sVmUuid);
+}
+
+static void NotifyClientsWithThroughput(
+		const SmartPtr<IOPackage> &p,
+		const QString &sVmDirectoryUuid,
+		const QString &sVmUuid,
+		int nPercents,
+		quint64 nThroughput)
+{
+	CVmEvent event(PET_DSP_EVT_VM_MIGRATE_PROGRESS_CHANGED, sVmUuid, PIE_DISPATCHER);
+	AddProgressParameter(event, nPercents);
 
+	// bytes per second, clients which do not know it just skip it
 	event.addEventParameter(new CVmEventParameter(
-		PVE::UnsignedInt,
-		QString::number(nPercents),
-		EVT_PARAM_PROGRESS_CHANGED));
+		PVE::UInt64,
+		QString::number(nThroughput),
+		EVT_PARAM_MIGRATE_THROUGHPUT));
 
 	SmartPtr<IOPackage> pPackage = DispatcherPackage::createInstance(PVE::DspVmEvent, event, p);
 	CDspService::instance()->getClientManager().sendPackageToVmClients(pPackage, sVmDirectoryUuid, sVmUuid);
@@ -1717,7 +1745,9 @@ Migrate::Vm::Source::Content::Copier* Task_MigrateVmSource::createCopier()
 				m_nTimeout));
 	copier->SetRequest(getRequestPackage());
 	copier->SetVmDirectoryUuid(m_sVmDirUuid);
-	copier->SetProgressNotifySender(NotifyClientsWithProgress);
+	copier->SetProgressNotifySender(NotifyClientsWithThroughput);
+	// keep the link busy while small files and file headers go
+	copier->SetWindow(16);
 
 	return new Migrate::Vm::Source::Content::Copier(sender, copier, error);
 }
@@ -1803,6 +1833,8 @@ PRL_RESULT Task_MigrateVmSource::run_body()
 	CAuthHelperImpersonateWrapper _impersonate(&getClient()->getAuthHelper());
 
 	mvs::Tunnel::IO io(*m_pIoClient);
+	if (m_sTunnelCodec == Migrate::Vm::Pump::Fragment::Codec::s_name)
+		io.setCodec(QSharedPointer<Migrate::Vm::Pump::Fragment::Codec>(new Migrate::Vm::Pump::Fragment::Codec()));
 	backend_type::moveState_type m(boost::msm::back::states_
 		<< boost::mpl::at_c<backend_type::moveState_type::initial_state, 0>::type
 			(boost::ref(io))
@@ -1914,6 +1946,11 @@ PRL_RESULT Task_MigrateVmSource::CheckVmMigrationPreconditions()
 			m_nReservedFlags,
 			m_nPrevVmState
 		);
+	if (!(m_nMigrationFlags & PVMT_UNCOMPRESSED))
+	{
+		CDispToDispProtoSerializer::CastToDispToDispCommand<CVmMigrateCheckPreconditionsCommand>
+			(pRequest)->SetTunnelCodec(Migrate::Vm::Pump::Fragment::Codec::s_name);
+	}
 
 	SmartPtr<IOPackage> pPackage =
 		DispatcherPackage::createInstance(pRequest->GetCommandId(), pRequest->GetCommand()->toString());
@@ -1933,6 +1970,7 @@ PRL_RESULT Task_MigrateVmSource::reactCheckReply(const SmartPtr<IOPackage>& pack
 	QStringList lstErrors = pResponseCmd->GetCheckPreconditionsResult();
 	m_nRemoteVersion = pResponseCmd->GetVersion();
 	m_nReservedFlags = pResponseCmd->GetCommandFlags();
+	m_sTunnelCodec = pResponseCmd->GetTunnelCodec();
 	m_targetConfig.reset(new CVmConfiguration(pResponseCmd->GetConfig()));
 	if (PRL_FAILED(m_targetConfig->m_uiRcInit))
 	{
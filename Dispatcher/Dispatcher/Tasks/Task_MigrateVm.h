@@ -49,6 +49,12 @@
 #include "Libraries/VmFileList/CVmFileListCopy.h"
 #include <QtConcurrent/QtConcurrent>
 
+// migration progress event parameter: bytes per second copied since the
+// previous progress event
+#ifndef EVT_PARAM_MIGRATE_THROUGHPUT
+#define EVT_PARAM_MIGRATE_THROUGHPUT "throughput"
+#endif
+
 enum _PRL_VM_MIGRATE_STEP {
 	MIGRATE_UNREGISTER_VM_WATCH	= (1 << 0),
 	MIGRATE_SUSPENDED_VM		= (1 << 1),
@@ -88,6 +94,7 @@ public:
 		const SmartPtr<IOPackage> &);
 	~Task_MigrateVmSource();
 	virtual QString  getVmUuid() {return m_sVmUuid;}
+	virtual Task::Class getTaskClass() const { return Task::CLASS_LONG; }
 
 	quint32 getFlags() const
 	{
@@ -156,6 +163,8 @@ private:
 	QString m_sSnapshotUuid;
 	/* remote client protocol version */
 	quint32 m_nRemoteVersion;
+	/* tunnel codec accepted by the target, empty for none */
+	QString m_sTunnelCodec;
 	QString m_sTargetMemFilePath;
 	QFileInfo m_cSavFile;
 	QFileInfo m_cSavFileCopy;
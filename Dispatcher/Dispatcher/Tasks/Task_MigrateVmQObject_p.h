@@ -34,6 +34,7 @@
 #define __TASK_MIGRATEVMQOBJECT_P_H__
 
 #include <QObject>
+#include <QSharedPointer>
 #include "CDspService.h"
 #include <prlcommon/Std/SmartPtr.h>
 #include <prlcommon/IOService/IOCommunication/IOClient.h>
@@ -77,6 +78,12 @@ private:
 
 namespace Pump
 {
+namespace Fragment
+{
+struct Codec;
+
+} // namespace Fragment
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct IO
 
@@ -85,6 +92,15 @@ struct IO: QObject
 	virtual IOSendJob::Handle sendPackage(const SmartPtr<IOPackage>&) = 0;
 	virtual IOSendJob::Result getSendResult(const IOSendJob::Handle& job_) = 0;
 
+	void setCodec(const QSharedPointer<Fragment::Codec>& value_)
+	{
+		m_codec = value_;
+	}
+
+protected:
+	SmartPtr<IOPackage> encode(const SmartPtr<IOPackage>& package_) const;
+	SmartPtr<IOPackage> decode(const SmartPtr<IOPackage>& package_) const;
+
 signals:
 	void onReceived(const SmartPtr<IOPackage>& package_);
 	void onSent(const SmartPtr<IOPackage>& package_);
@@ -92,6 +108,8 @@ signals:
 
 private:
 	Q_OBJECT
+
+	QSharedPointer<Fragment::Codec> m_codec;
 };
 
 namespace Push
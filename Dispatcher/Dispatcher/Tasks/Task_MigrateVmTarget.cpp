@@ -131,6 +131,28 @@ bin_type Flavor<CtMigrateCmd>::
 	return output;
 }
 
+bin_type Flavor<CtMigrateCmd>::
+	assemble(const spice_type& spice_, const SmartPtr<char>& data_, qint64 size_) const
+{
+	bin_type output;
+	if (!spice_)
+		return output;
+
+	bool k = false;
+	short t = spice_->toShort(&k);
+	if (!k) 
+		return output;
+
+	output = IOPackage::createInstance(CtMigrateCmd, 2);
+	if (!output.isValid())
+		return output;
+
+	output->fillBuffer(0, IOPackage::RawEncoding, &t, sizeof(t));
+	output->setBuffer(1, IOPackage::RawEncoding, data_, size_);
+
+	return output;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Packer
 
@@ -147,6 +169,14 @@ bin_type Packer::operator()(const QByteArray& data_)
 	return getFormat().assemble(m_spice, data_.data(), data_.size());
 }
 
+bin_type Packer::operator()(const SmartPtr<char>& data_, qint64 size_)
+{
+	if (!data_.isValid() || 0 >= size_)
+		return bin_type();
+
+	return getFormat().assemble(m_spice, data_, size_);
+}
+
 bin_type Packer::operator()(QIODevice& source_)
 {
 	bin_type output;
@@ -178,8 +208,168 @@ bin_type Packer::operator()(const QTcpSocket& source_)
 	return output;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Codec
+
+const char Codec::s_name[] = "zlib";
+
+Codec::Codec(int level_): m_level(level_), m_in(), m_out(), m_miss(), m_skip()
+{
+}
+
+Codec::~Codec()
+{
+	WRITE_TRACE(DBG_INFO, "tunnel compression: %llu bytes sent as %llu, ratio %.2f",
+		m_in, m_out, getRatio());
+}
+
+bool Codec::isTunnel(const bin_type& bin_)
+{
+	if (!bin_.isValid())
+		return false;
+
+	switch (bin_->header.type)
+	{
+	case VmMigrateLibvirtTunnelChunk:
+	case VmMigrateQemuDiskTunnelChunk:
+	case VmMigrateQemuStateTunnelChunk:
+		return true;
+	default:
+		return false;
+	}
+}
+
+double Codec::getRatio() const
+{
+	return 0 == m_out ? 1.0 : double(m_in) / m_out;
+}
+
+bool Codec::pass()
+{
+	if (0 == m_skip)
+		return true;
+
+	--m_skip;
+	return false;
+}
+
+bin_type Codec::encode(const bin_type& bin_)
+{
+	if (!isTunnel(bin_))
+		return bin_;
+
+	quint32 n = bin_->header.buffersNumber;
+	bin_type output = IOPackage::createInstance(bin_->header.type, n + 1);
+	if (!output.isValid())
+		return output;
+
+	char g = RAW;
+	for (quint32 i = 0; i < n; ++i)
+	{
+		quint32 z = 0;
+		SmartPtr<char> d;
+		IOPackage::EncodingType t;
+		if (!bin_->getBuffer(i, t, d, z))
+		{
+			output->fillBuffer(i, IOPackage::RawEncoding, NULL, 0);
+			continue;
+		}
+		if (0 < i || 0 == z)
+		{
+			output->setBuffer(i, t, d, z);
+			continue;
+		}
+		QByteArray c;
+		if (pass())
+		{
+			c = qCompress(reinterpret_cast<const uchar* >(d.getImpl()), z, m_level);
+			// NB. do not bother the peer for less than 1/8 gain.
+			if (c.isEmpty() || c.size() >= qint64(z) - (z >> 3))
+				c.clear();
+			if (!c.isEmpty())
+				m_miss = 0;
+			else if (8 <= ++m_miss)
+			{
+				m_miss = 0;
+				m_skip = 64;
+			}
+		}
+		m_in += z;
+		if (c.isEmpty())
+		{
+			m_out += z;
+			output->setBuffer(i, t, d, z);
+		}
+		else
+		{
+			g = ZLIB;
+			m_out += c.size();
+			output->fillBuffer(i, IOPackage::RawEncoding, c.constData(), c.size());
+		}
+	}
+	output->fillBuffer(n, IOPackage::RawEncoding, &g, sizeof(g));
+	return output;
+}
+
+bin_type Codec::decode(const bin_type& bin_) const
+{
+	if (!isTunnel(bin_))
+		return bin_;
+
+	quint32 z = 0;
+	SmartPtr<char> d;
+	IOPackage::EncodingType t;
+	quint32 n = bin_->header.buffersNumber;
+	if (0 == n || !bin_->getBuffer(n - 1, t, d, z) || sizeof(char) != z)
+	{
+		WRITE_TRACE(DBG_FATAL, "tunnel chunk without a codec tag");
+		return bin_type();
+	}
+	char g = *d.getImpl();
+	if (RAW != g && ZLIB != g)
+	{
+		WRITE_TRACE(DBG_FATAL, "unknown tunnel codec tag %d", g);
+		return bin_type();
+	}
+	bin_type output = IOPackage::createInstance(bin_->header.type, n - 1);
+	if (!output.isValid())
+		return output;
+
+	for (quint32 i = 0; i < n - 1; ++i)
+	{
+		if (!bin_->getBuffer(i, t, d, z))
+			output->fillBuffer(i, IOPackage::RawEncoding, NULL, 0);
+		else if (0 < i || RAW == g)
+			output->setBuffer(i, t, d, z);
+		else
+		{
+			QByteArray u = qUncompress(reinterpret_cast<const uchar* >(d.getImpl()), z);
+			if (u.isEmpty())
+			{
+				WRITE_TRACE(DBG_FATAL, "cannot uncompress a tunnel chunk");
+				return bin_type();
+			}
+			output->fillBuffer(i, IOPackage::RawEncoding, u.constData(), u.size());
+		}
+	}
+	return output;
+}
+
 } // namespace Fragment
 
+///////////////////////////////////////////////////////////////////////////////
+// struct IO
+
+SmartPtr<IOPackage> IO::encode(const SmartPtr<IOPackage>& package_) const
+{
+	return m_codec.isNull() ? package_ : m_codec->encode(package_);
+}
+
+SmartPtr<IOPackage> IO::decode(const SmartPtr<IOPackage>& package_) const
+{
+	return m_codec.isNull() ? package_ : m_codec->decode(package_);
+}
+
 namespace Pull
 {
 ///////////////////////////////////////////////////////////////////////////////
@@ -331,15 +521,17 @@ namespace Push
 // struct Queue
 
 Queue::Queue(const Fragment::Packer& packer_, IO& service_, QIODevice& device_):
-	m_service(&service_), m_device(&device_), m_packer(packer_)
+	m_service(&service_), m_device(&device_), m_collected(), m_packer(packer_)
 {
-	m_collector.reserve(1<<22);
+	Fragment::bin_type b = m_packer();
+	m_libvirt = b.isValid() &&
+		Vm::Tunnel::libvirtChunk_type::s_command == b->header.type;
 	setFormat(m_packer.getFormat());
 }
 
 Queue::enqueue_type Queue::enqueueEof()
 {
-	if (!m_collector.isEmpty())
+	if (0 < m_collected)
 	{
 		enqueue_type x = enqueue();
 		if (x.isFailed())
@@ -350,44 +542,39 @@ Queue::enqueue_type Queue::enqueueEof()
 
 Queue::enqueue_type Queue::enqueueData()
 {
-	Fragment::bin_type b = m_packer(*m_device);
-	if (!b.isValid())
-		return Flop::Event(PRL_ERR_FAILURE);
+	qint64 d = 0;
+	while (0 < m_device->bytesAvailable())
+	{
+		if (!m_collector.isValid())
+		{
+			m_collector = recycle();
+			m_collected = 0;
+		}
+		qint64 z = m_device->read(m_collector.getImpl() + m_collected,
+			s_capacity - m_collected);
+		if (-1 == z)
+		{
+			WRITE_TRACE(DBG_FATAL, "read error: %s",
+				qPrintable(m_device->errorString()));
+			return Flop::Event(PRL_ERR_FAILURE);
+		}
+		if (0 == z)
+			break;
 
-	const Fragment::Format& f = m_packer.getFormat();
-	int a = m_collector.capacity() - m_collector.size();
-	int d = f.getDataSize(b);
-	if (Vm::Tunnel::libvirtChunk_type::s_command == b->header.type)
-		WRITE_TRACE(DBG_FATAL, "Got a chunk from libvirt of size %d", d);
+		d += z;
+		m_collected += z;
+		if (s_capacity > m_collected)
+			continue;
 
-	int z = qMin(a, d);
-	QBuffer u;
-	u.setBuffer(&m_collector);
-	if (!u.open(QIODevice::ReadWrite | QIODevice::Append))
-	{
-		WRITE_TRACE(DBG_FATAL, "cannot open QBuffer");
-		return Flop::Event(PRL_ERR_UNEXPECTED);
+		enqueue_type x = enqueue();
+		if (x.isFailed())
+			return x;
 	}
-	u.write(f.getData(b), z);
-	u.close();
-	if (a != z)
-		return enqueue_type();
-
-	enqueue_type x = enqueue();
-	if (x.isFailed())
-		return x;
-	
-	d = d - z;
 	if (0 == d)
-		return enqueue_type();
+		return Flop::Event(PRL_ERR_FAILURE);
 
-	u.setBuffer(&m_collector);
-	if (!u.open(QIODevice::ReadWrite | QIODevice::Append))
-	{
-		WRITE_TRACE(DBG_FATAL, "cannot open QBuffer");
-		return Flop::Event(PRL_ERR_UNEXPECTED);
-	}
-	u.write(f.getData(b) + z, d);
+	if (m_libvirt)
+		WRITE_TRACE(DBG_FATAL, "Got a chunk from libvirt of size %lld", d);
 
 	return enqueue_type();
 }
@@ -415,9 +602,11 @@ target_type Queue::dequeue()
 
 		return state_type(Sending());
 	}
-	if (m_collector.isEmpty())
+	if (0 == m_collected)
 		return state_type(Reading());
 
+	SmartPtr<char> c = m_collector;
+	qint64 z = m_collected;
 	enqueue_type x = enqueue();
 	if (x.isFailed())
 		return x.error();
@@ -425,26 +614,54 @@ target_type Queue::dequeue()
 	target_type output = dequeue();
 	if (output.isSucceed() && !isEmpty())
 	{
-		// NB. the queue was empty, we cleared the collector
-		// but the dequeue call didn't send anything thus
-		// we remove the head item and revert m_collector
-		// usage to the item size to retry on a next dequeue
-		// call.
-		m_collector.data_ptr()->size = m_packer.getFormat()
-			.getDataSize(Vm::Pump::Queue::dequeue());
+		// NB. the queue was empty, we handed the collector
+		// over but the dequeue call didn't send anything thus
+		// we remove the head item and take the collector back
+		// to retry on a next dequeue call.
+		(void)Vm::Pump::Queue::dequeue();
+		if (!m_collector.isValid())
+			m_spent.removeLast();
+		m_collector = c;
+		m_collected = z;
 	}
 	return output;
 }
 
 Queue::enqueue_type Queue::enqueue()
 {
-	enqueue_type output = enqueue(m_packer(m_collector));
+	// NB. a small package gets a copy of the data and the collector is
+	// reused at once. a large one takes the collector by reference, the
+	// collector is reused after the package is sent.
+	bool x = s_capacity / 2 > m_collected;
+	enqueue_type output = enqueue(x ?
+		m_packer(QByteArray::fromRawData(m_collector.getImpl(), m_collected)) :
+		m_packer(m_collector, m_collected));
 	if (output.isSucceed())
-		m_collector.data_ptr()->size = 0;
-	
+	{
+		if (!x)
+		{
+			m_spent.append(m_collector);
+			if (s_spent < m_spent.size())
+				m_spent.removeFirst();
+
+			m_collector = SmartPtr<char>();
+		}
+		m_collected = 0;
+	}
 	return output;
 }
 
+SmartPtr<char> Queue::recycle()
+{
+	for (int i = 0; i < m_spent.size(); ++i)
+	{
+		// the package holding the collector is gone
+		if (1 == m_spent.at(i).countRefs())
+			return m_spent.takeAt(i);
+	}
+	return SmartPtr<char>(new char[s_capacity], SmartPtrPolicy::ArrayStorage);
+}
+
 Queue::enqueue_type Queue::enqueue(const_reference package_)
 {
 	if (package_.isValid())
@@ -684,7 +901,7 @@ IO::~IO()
 
 IOSendJob::Handle IO::sendPackage(const SmartPtr<IOPackage>& package_)
 {
-	return m_io->sendPackage(package_);
+	return m_io->sendPackage(encode(package_));
 }
 
 IOSendJob::Result IO::getSendResult(const IOSendJob::Handle& job_)
@@ -694,8 +911,14 @@ IOSendJob::Result IO::getSendResult(const IOSendJob::Handle& job_)
 
 void IO::reactReceived(IOSender::Handle handle_, const SmartPtr<IOPackage>& package_)
 {
-	if (handle_ == m_io->GetConnectionHandle())
-		emit onReceived(package_);
+	if (handle_ != m_io->GetConnectionHandle())
+		return;
+
+	SmartPtr<IOPackage> p = decode(package_);
+	if (p.isValid())
+		emit onReceived(p);
+	else
+		emit disconnected();
 }
 
 void IO::reactDisconnected(IOSender::Handle handle_)
@@ -1166,6 +1389,8 @@ m_nConfigPermissions(0)
 	m_nMigrationFlags = pCheckCmd->GetMigrationFlags();
 	m_nReservedFlags = pCheckCmd->GetReservedFlags();
 	m_nVersion = pCheckCmd->GetVersion();
+	if (pCheckCmd->GetTunnelCodec() == Migrate::Vm::Pump::Fragment::Codec::s_name)
+		m_sTunnelCodec = pCheckCmd->GetTunnelCodec();
 	m_sVmConfig = pCheckCmd->GetVmConfig();
 	m_sVmName = pCheckCmd->GetTargetVmName();
 
@@ -1965,6 +2190,8 @@ PRL_RESULT Task_MigrateVmTarget::preconditionsReply()
 {
 	SmartPtr<CVmConfiguration> C(m_pVmConfig);
 	CVmMigrateCheckPreconditionsReply c(m_lstCheckPrecondsErrors, m_lstNonSharedDisks, m_nFlags);
+	if (!m_sTunnelCodec.isEmpty())
+		c.SetTunnelCodec(m_sTunnelCodec);
 	if (!m_pstorage.isNull())
 	{
 		C = SmartPtr<CVmConfiguration>(new CVmConfiguration(m_pVmConfig.getImpl()));
@@ -1993,6 +2220,8 @@ PRL_RESULT Task_MigrateVmTarget::run_body()
 	typedef boost::msm::back::state_machine<mvt::Frontend> backend_type;
 
 	mvt::Tunnel::IO io(*m_dispConnection);
+	if (!m_sTunnelCodec.isEmpty())
+		io.setCodec(QSharedPointer<Migrate::Vm::Pump::Fragment::Codec>(new Migrate::Vm::Pump::Fragment::Codec()));
 
 	backend_type::Syncing syncingStep(boost::msm::back::states_
 		<< boost::mpl::at_c<backend_type::syncing_type::initial_state, 0>::type(boost::cref(m_sVmUuid))
@@ -149,6 +149,8 @@ private:
 	quint32 m_nReservedFlags;
 	quint32 m_nVersion;
 	VIRTUAL_MACHINE_STATE m_nPrevVmState;
+	/* tunnel codec offered by the source, empty for none */
+	QString m_sTunnelCodec;
 	QString m_sVmConfig;
 	QString m_sSrcHostInfo;
 	QString	m_sVmDirPath;
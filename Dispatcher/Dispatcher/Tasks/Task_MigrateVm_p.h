@@ -654,6 +654,10 @@ struct Format
 	virtual qint64 getDataSize(const bin_type& bin_) const = 0;
 	virtual spice_type getSpice(const bin_type& bin_) const = 0;
 	virtual bin_type assemble(const spice_type& spice_, const char* data_, qint64 size_) const = 0;
+	// NB. the package refers to the data, the caller must not change it
+	// until the package is sent.
+	virtual bin_type assemble(const spice_type& spice_, const SmartPtr<char>& data_,
+		qint64 size_) const = 0;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -700,6 +704,20 @@ struct Flavor: Format
 		}
 		return output;
 	}
+	bin_type assemble(const spice_type& spice_, const SmartPtr<char>& data_, qint64 size_) const
+	{
+		bin_type output = IOPackage::createInstance(X, 1 + !!spice_);
+		if (!output.isValid())
+			return output;
+
+		output->setBuffer(0, IOPackage::RawEncoding, data_, size_);
+		if (spice_)
+		{
+			QByteArray b = spice_.get().toUtf8();
+			output->fillBuffer(1, IOPackage::RawEncoding, b.data(), b.size());
+		}
+		return output;
+	}
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -712,6 +730,7 @@ struct Flavor<CtMigrateCmd>: Format
 	qint64 getDataSize(const bin_type& bin_) const;
 	spice_type getSpice(const bin_type& bin_) const;
 	bin_type assemble(const spice_type& spice_, const char* data_, qint64 size_) const;
+	bin_type assemble(const spice_type& spice_, const SmartPtr<char>& data_, qint64 size_) const;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -735,6 +754,7 @@ struct Packer
 	bin_type operator()();
 	bin_type operator()(QIODevice& source_);
 	bin_type operator()(const QByteArray& data_);
+	bin_type operator()(const SmartPtr<char>& data_, qint64 size_);
 	bin_type operator()(const QTcpSocket& source_);
 
 private:
@@ -742,10 +762,50 @@ private:
 	QSharedPointer<Format> m_format;
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Codec
+// NB. when both sides agree on the codec during the preconditions check
+// every tunnel chunk carries one more last buffer with a tag telling if
+// the data buffer is compressed. chunks that do not shrink enough are sent
+// as is, and after a run of those compression is not tried for a while.
+
+struct Codec
+{
+	enum
+	{
+		RAW = 0,
+		ZLIB = 1
+	};
+
+	explicit Codec(int level_ = 1);
+	~Codec();
+
+	bin_type encode(const bin_type& bin_);
+	bin_type decode(const bin_type& bin_) const;
+	// raw bytes per byte on the wire
+	double getRatio() const;
+
+	static bool isTunnel(const bin_type& bin_);
+	static const char s_name[];
+
+private:
+	bool pass();
+
+	int m_level;
+	quint64 m_in;
+	quint64 m_out;
+	int m_miss;
+	int m_skip;
+};
+
 } // namespace Fragment
 
 ///////////////////////////////////////////////////////////////////////////////
 // struct Queue
+// FIXME: all the tunnels share the one dispatcher connection of the task.
+// Striping the disk mirror traffic over several connections needs a
+// dispatcher-to-dispatcher handshake that opens and authorizes the extra
+// channels, and reordering on the target. It is not done yet.
 
 struct Queue: QQueue<Fragment::bin_type>
 {
@@ -806,10 +866,20 @@ struct Queue: private Vm::Pump::Queue
 private:
 	enqueue_type enqueue();
 	enqueue_type enqueue(const_reference package_);
+	SmartPtr<char> recycle();
+
+	static const qint64 s_capacity = 1<<22;
+	static const int s_spent = 4;
 
 	IO* m_service;
 	QIODevice* m_device;
-	QByteArray m_collector;
+	// NB. the device is read straight into the collector. a large package
+	// takes the collector by reference, the collector goes to the spent
+	// ones and is reused once the package releases it.
+	SmartPtr<char> m_collector;
+	qint64 m_collected;
+	QList<SmartPtr<char> > m_spent;
+	bool m_libvirt;
 	Fragment::Packer m_packer;
 };
 
@@ -63,6 +63,7 @@ public:
 		Vm::Directory::Ephemeral& ephemeral_);
 
 	virtual QString getVmUuid();
+	virtual Task::Class getTaskClass() const { return Task::CLASS_IO; }
 	const QString& getVmDirectory() const
 	{
 		return m_sVmDirUuid;
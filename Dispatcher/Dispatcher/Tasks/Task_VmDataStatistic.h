@@ -45,6 +45,7 @@ public:
 						 const SmartPtr<IOPackage>& p,
 						 bool bNeedCleanUpInfoOnly = false);
 	virtual ~Task_VmDataStatistic();
+	virtual Task::Class getTaskClass() const { return Task::CLASS_SHORT; }
 
 	virtual void cancelOperation(SmartPtr<CDspClient> pUserSession, const SmartPtr<IOPackage> &p);
 
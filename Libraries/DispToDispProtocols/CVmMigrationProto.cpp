@@ -185,6 +185,16 @@ PRL_UINT64 CVmMigrateCheckPreconditionsCommand::GetRequiresDiskSpace()
 	return (GetUnsignedInt64ParamValue(EVT_PARAM_MIGRATE_REQUIRES_DISK_SPACE));
 }
 
+QString CVmMigrateCheckPreconditionsCommand::GetTunnelCodec()
+{
+	return GetStringParamValue("migrate_check_preconditions_tunnel_codec");
+}
+
+void CVmMigrateCheckPreconditionsCommand::SetTunnelCodec(const QString& codec)
+{
+	SetStringParamValue(codec, "migrate_check_preconditions_tunnel_codec");
+}
+
 
 //**********************************************Check preconditions reply implementation*****************************
 CVmMigrateCheckPreconditionsReply::CVmMigrateCheckPreconditionsReply(
@@ -235,6 +245,16 @@ void CVmMigrateCheckPreconditionsReply::SetBandwidth(const quint64 bw)
 	SetUnsignedInt64ParamValue(bw, "migrate_check_preconditions_bandwidth");
 }
 
+QString CVmMigrateCheckPreconditionsReply::GetTunnelCodec()
+{
+	return GetStringParamValue("migrate_check_preconditions_tunnel_codec");
+}
+
+void CVmMigrateCheckPreconditionsReply::SetTunnelCodec(const QString& codec)
+{
+	SetStringParamValue(codec, "migrate_check_preconditions_tunnel_codec");
+}
+
 //**********************************************Start migration command implementation*********************************
 
 CVmMigrateStartCommand::CVmMigrateStartCommand(
@@ -165,6 +165,9 @@ public:
 	QString GetStorageInfo();
 	/** Returns requires disk space */
 	PRL_UINT64 GetRequiresDiskSpace();
+	/** Returns tunnel codec offered by the source, empty for none */
+	QString GetTunnelCodec();
+	void SetTunnelCodec(const QString& codec);
 };
 
 /**
@@ -244,6 +247,9 @@ public:
 	void SetConfig(const QString& config);
 	quint64 GetBandwidth();
 	void SetBandwidth(const quint64 bw);
+	/** Returns tunnel codec accepted by the target, empty for none */
+	QString GetTunnelCodec();
+	void SetTunnelCodec(const QString& codec);
 };
 
 /**
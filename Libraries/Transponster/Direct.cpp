@@ -30,6 +30,7 @@
 #include <prlsdk/PrlOses.h>
 #include <prlcommon/HostUtils/HostUtils.h>
 #include <boost/bind/placeholders.hpp>
+#include <QXmlStreamReader>
 
 namespace Transponster
 {
@@ -83,6 +84,76 @@ Text::Text(const QString& xml_)
 	setValue(xml_.toUtf8());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Reader
+
+bool Reader::load(const QByteArray& xml_, QDomDocument& dst_)
+{
+	QDomDocument d;
+	QDomNode p = d;
+	QXmlStreamReader r(xml_);
+	while (!r.atEnd())
+	{
+		switch (r.readNext())
+		{
+		case QXmlStreamReader::StartElement:
+		{
+			QDomElement e = d.createElementNS(r.namespaceUri().toString(),
+					r.qualifiedName().toString());
+			foreach (const QXmlStreamAttribute& a, r.attributes())
+			{
+				e.setAttributeNS(a.namespaceUri().toString(),
+					a.qualifiedName().toString(), a.value().toString());
+			}
+			p = p.appendChild(e);
+			break;
+		}
+		case QXmlStreamReader::EndElement:
+			p = p.parentNode();
+			break;
+		case QXmlStreamReader::Characters:
+			if (r.isCDATA())
+				p.appendChild(d.createCDATASection(r.text().toString()));
+			else if (!r.isWhitespace())
+				p.appendChild(d.createTextNode(r.text().toString()));
+			break;
+		case QXmlStreamReader::Comment:
+			p.appendChild(d.createComment(r.text().toString()));
+			break;
+		case QXmlStreamReader::ProcessingInstruction:
+			p.appendChild(d.createProcessingInstruction(
+				r.processingInstructionTarget().toString(),
+				r.processingInstructionData().toString()));
+			break;
+		default:
+			break;
+		}
+	}
+	if (r.hasError())
+	{
+		WRITE_TRACE(DBG_FATAL, "XML error at %lld:%lld: %s", r.lineNumber(),
+			r.columnNumber(), QSTR2UTF8(r.errorString()));
+		return false;
+	}
+	dst_ = d;
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Writer
+
+Writer::Writer(): m_stream(&m_buffer)
+{
+	m_buffer.reserve(RESERVE);
+	m_stream.setAutoFormatting(true);
+	m_stream.setAutoFormattingIndent(1);
+}
+
+QString Writer::getResult() const
+{
+	return QString::fromUtf8(m_buffer);
+}
+
 } // namespace Direct
 
 namespace Visitor
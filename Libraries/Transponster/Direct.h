@@ -39,6 +39,8 @@
 #include "nodedev_type.h"
 #include "snapshot_type.h"
 #include "capability_type.h"
+#include <QXmlStreamWriter>
+#include <boost/noncopyable.hpp>
 #include <prlxmlmodel/VtInfo/VtInfo.h>
 #include <Libraries/StatesStore/SavedStateTree.h>
 #include <prlxmlmodel/VmConfig/CVmConfiguration.h>
@@ -61,6 +63,44 @@ struct Text: Libvirt::Details::Value::Bin<QByteArray>
 	explicit Text(const QString& xml_);
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Reader
+// Builds the DOM of an XML text in one pass of QXmlStreamReader instead of
+// the SAX based QDomDocument::setContent(). Whitespace only text is dropped
+// and namespaces are processed the same way, the XML declaration is not kept.
+
+struct Reader
+{
+	static bool load(const QByteArray& xml_, QDomDocument& dst_);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Writer
+// The output side of the Reader. A generated type is saved through
+// QXmlStreamWriter into one reserved buffer, no DOM is built on the way.
+// The attributes come in the schema order instead of the QDom hash one, thus
+// the text is equivalent to QDomDocument::toString() but not the same.
+
+struct Writer: boost::noncopyable
+{
+	enum
+	{
+		RESERVE = 16 * 1024
+	};
+
+	Writer();
+
+	QXmlStreamWriter& getStream()
+	{
+		return m_stream;
+	}
+	QString getResult() const;
+
+private:
+	QByteArray m_buffer;
+	QXmlStreamWriter m_stream;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Distiller
 
@@ -70,7 +110,7 @@ struct Distiller: Libvirt::Details::Value::Bin<T>
 	PRL_RESULT operator()(const Text& xml_)
 	{
 		QDomDocument x;
-		if (!x.setContent(xml_.getValue(), true))
+		if (!Reader::load(xml_.getValue(), x))
 		{
 			WRITE_TRACE(DBG_FATAL, "Cannot parse XML");
 			return PRL_ERR_READ_XML_CONTENT;
@@ -465,9 +505,9 @@ struct Director
 		if (PRL_FAILED(e))
 			return e;
 
-		QDomDocument x;
-		builder_.getValue().save(x);
-		return x.toString();
+		Direct::Writer x;
+		builder_.getValue().save(x.getStream());
+		return x.getResult();
 	}
 };
 
@@ -1915,9 +1915,9 @@ QString Device<Dimm>::getPlugXml(const Dimm& model_)
 	t.setSize(v);
 	t.setNode(model_.getNodeId());
 	d.setTarget(t);
-	QDomDocument x;
-	d.save(x);
-	return x.toString();
+	Transponster::Direct::Writer x;
+	d.save(x.getStream());
+	return x.getResult();
 }
 
 QString Device<CVmHardDisk>::getPlugXml(const CVmHardDisk& model_)
@@ -1935,10 +1935,10 @@ QString Device<CVmHardDisk>::getPlugXml(const CVmHardDisk& model_)
 	if (!s.isEmpty())
 		b.setSerial(s);
 
-	QDomDocument x;
-	static_cast<const builder_type&>(b).getResult().save(x);
+	Transponster::Direct::Writer x;
+	static_cast<const builder_type&>(b).getResult().save(x.getStream());
 
-	return x.toString();
+	return x.getResult();
 }
 
 QString Device<CVmHardDisk>::getTargetName(const CVmHardDisk& model_)
@@ -1973,11 +1973,11 @@ Prl::Expected<QString, ::Error::Simple>
 	if (p.isFailed())
 		return p.error();
 
-	QDomDocument x;
-	if (!p.value().save(x))
+	Transponster::Direct::Writer x;
+	if (!p.value().save(x.getStream()))
 		return ::Error::Simple(PRL_ERR_INVALID_ARG);
 
-	return x.toString();
+	return x.getResult();
 }
 
 namespace
@@ -2078,9 +2078,9 @@ Prl::Expected<QString, ::Error::Simple>
 	iface.setInterface(a.value());
 	e.setValue(iface);
 
-	QDomDocument x;
-	e.produce(x);
-	return x.toString();
+	Transponster::Direct::Writer x;
+	e.produce(x.getStream());
+	return x.getResult();
 }
 
 Prl::Expected<QString, ::Error::Simple>
@@ -2121,9 +2121,9 @@ Prl::Expected<QString, ::Error::Simple> RemoteDisplayUpdater::updateVncXml(const
 	mpl::at_c<Extract<Libvirt::Domain::Xml::VChoice7097Impl>::type,
 	Transponster::Device::List::XML_DEVICES_ORDER::GRAPHIC >::type e;
 	e.setValue(z);
-	QDomDocument x;
-	e.produce(x);
-	return x.toString();
+	Transponster::Direct::Writer x;
+	e.produce(x.getStream());
+	return x.getResult();
 }
 
 Libvirt::Domain::Xml::Hostdev
@@ -2165,9 +2165,9 @@ Libvirt::Domain::Xml::Hostdev
 
 QString Device<CHwUsbDevice>::getPlugXml(const CHwUsbDevice& model_)
 {
-	QDomDocument x;
-	getView(model_).save(x);
-	return x.toString();
+	Transponster::Direct::Writer x;
+	getView(model_).save(x.getStream());
+	return x.getResult();
 }
 
 QString Device<CHwUsbDevice>::getAlias(const CHwUsbDevice& model_)
@@ -2614,10 +2614,10 @@ QString Builder::getResult()
 	if (m_result.isNull())
 		return QString();
 
-	QDomDocument x;
-	m_result->save(x);
+	Transponster::Direct::Writer x;
+	m_result->save(x.getStream());
 	m_result.reset();
-	return x.toString();
+	return x.getResult();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2904,11 +2904,11 @@ PRL_RESULT Pipeline::operator()(object_type object_)
 	if (PRL_FAILED(e))
 		return e;
 
-	QDomDocument x;
-	if (!object_.save(x))
+	Transponster::Direct::Writer x;
+	if (!object_.save(x.getStream()))
 		return PRL_ERR_UNEXPECTED;
 
-	setValue(x.toString());
+	setValue(x.getResult());
 
 	return PRL_ERR_SUCCESS;
 }
@@ -3285,9 +3285,9 @@ PRL_RESULT Reverse::setHostOnly()
 
 QString Reverse::getResult() const
 {
-	QDomDocument x;
-	m_result.save(x);
-	return x.toString();
+	Transponster::Direct::Writer x;
+	m_result.save(x.getStream());
+	return x.getResult();
 }
 
 } // namespace Network
@@ -3342,9 +3342,9 @@ PRL_RESULT Reverse::setInterface()
 
 QString Reverse::getResult() const
 {
-	QDomDocument x;
-	m_result.save(x);
-	return x.toString();
+	Transponster::Direct::Writer x;
+	m_result.save(x.getStream());
+	return x.getResult();
 }
 
 } // namespace Bridge
@@ -3520,9 +3520,9 @@ PRL_RESULT Reverse::setInstructions()
 
 QString Reverse::getResult() const
 {
-	QDomDocument x;
-	m_result.save(x);
-	return x.toString();
+	Transponster::Direct::Writer x;
+	m_result.save(x.getStream());
+	return x.getResult();
 }
 
 void Reverse::setMemory()
@@ -3637,10 +3637,10 @@ QString Reverse::getResult()
 	if (m_result.isNull())
 		return QString();
 
-	QDomDocument x;
-	m_result->save(x);
+	Transponster::Direct::Writer x;
+	m_result->save(x.getStream());
 	m_result.reset();
-	return x.toString();
+	return x.getResult();
 }
 
 void Reverse::setUuid(const QString &uuid)
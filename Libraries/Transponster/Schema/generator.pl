@@ -313,9 +313,7 @@ FOOTER
 	print $h <<HEADER;
 $Strings::license
 #include "@{[$namespace->header('enum')]}"
-#include <boost/assign/list_of.hpp>
 
-namespace ba = boost::assign;
 namespace Libvirt
 {
 HEADER
@@ -1014,12 +1012,53 @@ sub getTraits
 	my $self = shift;
 	my @output;
 	my $q = $self->getQualifiedName();
+	my $n = $self->getNamespace();
 	push @output, 'template<>';
-	push @output, "Enum<$q>::data_type Enum<$q>::getData()";
+	push @output, "QString Enum<$q>::getText($q value_)";
 	push @output, '{';
-	push @output, "\treturn ba::list_of<data_type::relation>";
-	push @output, map {"\t\t\t(data_type::value_type(".$self->getNamespace()->qualify($_->{enumerator}).', "'.$_->{text}.'"))'} @{$self->{values}};
-	$output[$#output] .= ';';
+	push @output, "\tswitch (value_)";
+	push @output, "\t{";
+	foreach my $x (@{$self->{values}})
+	{
+		push @output, "\tcase ".$n->qualify($x->{enumerator}).':';
+		push @output, "\t\treturn QStringLiteral(\"$x->{text}\");";
+	}
+	push @output, "\t}";
+	push @output, "\treturn QString();";
+	push @output, '}';
+	push @output, '';
+	# a switch over the length and the first letter leaves one candidate
+	# mostly, the compare with it needs no copy of the text
+	my %g;
+	foreach my $x (@{$self->{values}})
+	{
+		push @{$g{length($x->{text})}{substr($x->{text}, 0, 1)}}, $x;
+	}
+	push @output, 'template<>';
+	push @output, "int Enum<$q>::find(const QStringRef& text_)";
+	push @output, '{';
+	push @output, "\tswitch (text_.size())";
+	push @output, "\t{";
+	foreach my $l (sort {$a <=> $b} keys %g)
+	{
+		push @output, "\tcase $l:";
+		push @output, "\t\tswitch (text_.at(0).unicode())";
+		push @output, "\t\t{";
+		foreach my $c (sort keys %{$g{$l}})
+		{
+			push @output, "\t\tcase '$c':";
+			foreach my $x (@{$g{$l}{$c}})
+			{
+				push @output, "\t\t\tif (text_ == QLatin1String(\"$x->{text}\"))";
+				push @output, "\t\t\t\treturn ".$n->qualify($x->{enumerator}).';';
+			}
+			push @output, "\t\t\tbreak;";
+		}
+		push @output, "\t\t}";
+		push @output, "\t\tbreak;";
+	}
+	push @output, "\t}";
+	push @output, "\treturn -1;";
 	push @output, '}';
 	return @output;
 }
@@ -1377,6 +1416,7 @@ sub getDeclaration
 			if ($self->{serializer}->can('getTopSaviour'))
 			{
 				push @output, "\tbool save(QDomDocument& ) const;";
+				push @output, "\tbool save(QXmlStreamWriter& ) const;";
 			}
 		}
 		push @output, '';
@@ -1403,6 +1443,10 @@ sub getTraits
 	push @output, '';
 	push @output, "\tstatic int parse(".$self->getQualifiedName().'& , QStack<QDomElement>& );';
 	push @output, "\tstatic int generate(const ".$self->getQualifiedName().'& , QDomElement& );';
+	push @output, "\tstatic int generate(const ".$self->getQualifiedName().'& , Stream& );';
+	push @output, '';
+	push @output, "\ttemplate<class D>";
+	push @output, "\tstatic int produce(const ".$self->getQualifiedName().'& , D& );';
 	push @output, "};";
 	return @output;
 }
@@ -1454,6 +1498,10 @@ sub getDefinition
 				push @b, "{";
 				push @b, map {"\t$_"} $self->{serializer}->getTopSaviour("dst_");
 				push @b, '}', '';
+				push @b, "bool $self->{name}::save(QXmlStreamWriter& dst_) const";
+				push @b, "{";
+				push @b, map {"\t$_"} $self->{serializer}->getTopSaviour("dst_");
+				push @b, '}', '';
 			}
 		}
 		push @w, "int Traits<${q}>::parse(${q}& dst_, QStack<QDomElement>& stack_)";
@@ -1478,7 +1526,8 @@ sub getDefinition
 		push @w, "\treturn output;";
 		push @w, "}";
 		push @w, '';
-		push @w, "int Traits<${q}>::generate(const ${q}& src_, QDomElement& dst_)";
+		push @w, "template<class D>";
+		push @w, "int Traits<${q}>::produce(const ${q}& src_, D& dst_)";
 		push @w, "{";
 		push @w, "\tmarshal_type m;";
 		foreach my $x ($self->members_())
@@ -1508,12 +1557,21 @@ sub getDefinition
 		push @w, "\treturn m.consume(stack_);";
 		push @w, "}";
 		push @w, '';
-		push @w, "int Traits<${q}>::generate(const ${q}& , QDomElement& dst_)";
+		push @w, "template<class D>";
+		push @w, "int Traits<${q}>::produce(const ${q}& , D& dst_)";
 		push @w, "{";
 		push @w, "\tmarshal_type m;";
 		push @w, "\treturn m.produce(dst_);";
 		push @w, "}";
 	}
+	foreach my $d ('QDomElement', 'Stream')
+	{
+		push @w, '';
+		push @w, "int Traits<${q}>::generate(const ${q}& src_, ${d}& dst_)";
+		push @w, "{";
+		push @w, "\treturn produce(src_, dst_);";
+		push @w, "}";
+	}
 	my $n = $self->getNamespace();
 	return (@b, @w) unless @b && $n;
 
@@ -26,6 +26,7 @@
 #define __BASE_H__
 #include <QString>
 #include <QDomNode>
+#include <QXmlStreamWriter>
 #include <boost/mpl/at.hpp>
 #include <boost/mpl/back.hpp>
 #include <boost/mpl/size.hpp>
@@ -44,6 +45,43 @@ const QString& getText(quint32 );
 
 namespace Libvirt
 {
+///////////////////////////////////////////////////////////////////////////////
+// struct Stream
+// QXmlStreamWriter wants the attributes of an element before its content
+// while a schema may list them after the nested elements. thus an element
+// is produced into a stream in two passes over the same pattern: the first
+// one writes the attributes, the second one writes everything else.
+
+struct Stream
+{
+	enum pass_type
+	{
+		ATTRIBUTES,
+		CONTENT
+	};
+
+	explicit Stream(QXmlStreamWriter& writer_): m_pass(CONTENT), m_writer(&writer_)
+	{
+	}
+
+	pass_type getPass() const
+	{
+		return m_pass;
+	}
+	void setPass(pass_type value_)
+	{
+		m_pass = value_;
+	}
+	QXmlStreamWriter& getWriter() const
+	{
+		return *m_writer;
+	}
+
+private:
+	pass_type m_pass;
+	QXmlStreamWriter* m_writer;
+};
+
 namespace Name
 {
 ///////////////////////////////////////////////////////////////////////////////
@@ -99,6 +137,14 @@ struct Traits<Strict<N> >
 	{
 		return dst_.createElement(getText(N));
 	}
+	static void produceAttribute(const QString& value_, Stream& dst_)
+	{
+		dst_.getWriter().writeAttribute(getText(N), value_);
+	}
+	static void produceElement(Stream& dst_)
+	{
+		dst_.getWriter().writeStartElement(getText(N));
+	}
 };
 
 template<unsigned N, unsigned S>
@@ -117,6 +163,16 @@ struct Traits<Scoped<N, S> >
 	{
 		return dst_.createElementNS(getText(S), getText(N));
 	}
+	static void produceAttribute(const QString& value_, Stream& dst_)
+	{
+		dst_.getWriter().writeAttribute(getText(S), getText(N), value_);
+	}
+	static void produceElement(Stream& dst_)
+	{
+		// the same declaration as QDom makes for an unprefixed name
+		dst_.getWriter().writeStartElement(getText(N));
+		dst_.getWriter().writeDefaultNamespace(getText(S));
+	}
 };
 
 } // namespace Name
@@ -23,17 +23,47 @@
  */
 
 #include "blockexport_enum.h"
-#include <boost/assign/list_of.hpp>
 
-namespace ba = boost::assign;
 namespace Libvirt
 {
 template<>
-Enum<Blockexport::Xml::EVirYesNo>::data_type Enum<Blockexport::Xml::EVirYesNo>::getData()
+QString Enum<Blockexport::Xml::EVirYesNo>::getText(Blockexport::Xml::EVirYesNo value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Blockexport::Xml::EVirYesNoYes, "yes"))
-			(data_type::value_type(Blockexport::Xml::EVirYesNoNo, "no"));
+	switch (value_)
+	{
+	case Blockexport::Xml::EVirYesNoYes:
+		return QStringLiteral("yes");
+	case Blockexport::Xml::EVirYesNoNo:
+		return QStringLiteral("no");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Blockexport::Xml::EVirYesNo>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("no"))
+				return Blockexport::Xml::EVirYesNoNo;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'y':
+			if (text_ == QLatin1String("yes"))
+				return Blockexport::Xml::EVirYesNoYes;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 } // namespace Libvirt
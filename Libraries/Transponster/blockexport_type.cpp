@@ -59,6 +59,13 @@ bool Address::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Address::save(QXmlStreamWriter& dst_) const
+{
+	Element<Address, Name::Strict<111> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Blockexport
@@ -77,7 +84,8 @@ int Traits<Blockexport::Xml::Address>::parse(Blockexport::Xml::Address& dst_, QS
 	return output;
 }
 
-int Traits<Blockexport::Xml::Address>::generate(const Blockexport::Xml::Address& src_, QDomElement& dst_)
+template<class D>
+int Traits<Blockexport::Xml::Address>::produce(const Blockexport::Xml::Address& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getHost(), m.get<1>()))
@@ -92,6 +100,16 @@ int Traits<Blockexport::Xml::Address>::generate(const Blockexport::Xml::Address&
 	return m.produce(dst_);
 }
 
+int Traits<Blockexport::Xml::Address>::generate(const Blockexport::Xml::Address& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Blockexport::Xml::Address>::generate(const Blockexport::Xml::Address& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Disk
 
@@ -125,6 +143,13 @@ bool Disk::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Disk::save(QXmlStreamWriter& dst_) const
+{
+	Element<Disk, Name::Strict<472> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Blockexport
@@ -144,7 +169,8 @@ int Traits<Blockexport::Xml::Disk>::parse(Blockexport::Xml::Disk& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Blockexport::Xml::Disk>::generate(const Blockexport::Xml::Disk& src_, QDomElement& dst_)
+template<class D>
+int Traits<Blockexport::Xml::Disk>::produce(const Blockexport::Xml::Disk& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -161,6 +187,16 @@ int Traits<Blockexport::Xml::Disk>::generate(const Blockexport::Xml::Disk& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Blockexport::Xml::Disk>::generate(const Blockexport::Xml::Disk& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Blockexport::Xml::Disk>::generate(const Blockexport::Xml::Disk& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Domainblockexport_
 
@@ -194,6 +230,13 @@ bool Domainblockexport_::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Domainblockexport_::save(QXmlStreamWriter& dst_) const
+{
+	Element<Domainblockexport_, Name::Strict<2112> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Blockexport
@@ -210,7 +253,8 @@ int Traits<Blockexport::Xml::Domainblockexport_>::parse(Blockexport::Xml::Domain
 	return output;
 }
 
-int Traits<Blockexport::Xml::Domainblockexport_>::generate(const Blockexport::Xml::Domainblockexport_& src_, QDomElement& dst_)
+template<class D>
+int Traits<Blockexport::Xml::Domainblockexport_>::produce(const Blockexport::Xml::Domainblockexport_& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAddress(), m.get<1>().get<0>()))
@@ -221,4 +265,14 @@ int Traits<Blockexport::Xml::Domainblockexport_>::generate(const Blockexport::Xm
 	return m.produce(dst_);
 }
 
+int Traits<Blockexport::Xml::Domainblockexport_>::generate(const Blockexport::Xml::Domainblockexport_& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Blockexport::Xml::Domainblockexport_>::generate(const Blockexport::Xml::Domainblockexport_& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 } // namespace Libvirt
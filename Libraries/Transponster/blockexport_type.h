@@ -77,6 +77,7 @@ struct Address
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PAddrIPorName::value_type m_host;
@@ -153,6 +154,7 @@ struct Disk
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VName m_name;
@@ -193,6 +195,7 @@ struct Domainblockexport_
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	Address m_address;
@@ -212,6 +215,10 @@ struct Traits<Blockexport::Xml::Address>
 
 	static int parse(Blockexport::Xml::Address& , QStack<QDomElement>& );
 	static int generate(const Blockexport::Xml::Address& , QDomElement& );
+	static int generate(const Blockexport::Xml::Address& , Stream& );
+
+	template<class D>
+	static int produce(const Blockexport::Xml::Address& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -224,6 +231,10 @@ struct Traits<Blockexport::Xml::Disk>
 
 	static int parse(Blockexport::Xml::Disk& , QStack<QDomElement>& );
 	static int generate(const Blockexport::Xml::Disk& , QDomElement& );
+	static int generate(const Blockexport::Xml::Disk& , Stream& );
+
+	template<class D>
+	static int produce(const Blockexport::Xml::Disk& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -236,6 +247,10 @@ struct Traits<Blockexport::Xml::Domainblockexport_>
 
 	static int parse(Blockexport::Xml::Domainblockexport_& , QStack<QDomElement>& );
 	static int generate(const Blockexport::Xml::Domainblockexport_& , QDomElement& );
+	static int generate(const Blockexport::Xml::Domainblockexport_& , Stream& );
+
+	template<class D>
+	static int produce(const Blockexport::Xml::Domainblockexport_& , D& );
 };
 
 } // namespace Libvirt
@@ -23,9 +23,7 @@
  */
 
 #include "blocksnapshot_enum.h"
-#include <boost/assign/list_of.hpp>
 
-namespace ba = boost::assign;
 namespace Libvirt
 {
 } // namespace Libvirt
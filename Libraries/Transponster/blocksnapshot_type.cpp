@@ -59,6 +59,13 @@ bool Disk::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Disk::save(QXmlStreamWriter& dst_) const
+{
+	Element<Disk, Name::Strict<472> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Blocksnapshot
@@ -75,7 +82,8 @@ int Traits<Blocksnapshot::Xml::Disk>::parse(Blocksnapshot::Xml::Disk& dst_, QSta
 	return output;
 }
 
-int Traits<Blocksnapshot::Xml::Disk>::generate(const Blocksnapshot::Xml::Disk& src_, QDomElement& dst_)
+template<class D>
+int Traits<Blocksnapshot::Xml::Disk>::produce(const Blocksnapshot::Xml::Disk& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -86,6 +94,16 @@ int Traits<Blocksnapshot::Xml::Disk>::generate(const Blocksnapshot::Xml::Disk& s
 	return m.produce(dst_);
 }
 
+int Traits<Blocksnapshot::Xml::Disk>::generate(const Blocksnapshot::Xml::Disk& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Blocksnapshot::Xml::Disk>::generate(const Blocksnapshot::Xml::Disk& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Domainblocksnapshot
 
@@ -119,6 +137,13 @@ bool Domainblocksnapshot::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Domainblocksnapshot::save(QXmlStreamWriter& dst_) const
+{
+	Element<Domainblocksnapshot, Name::Strict<2113> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Blocksnapshot
@@ -135,7 +160,8 @@ int Traits<Blocksnapshot::Xml::Domainblocksnapshot>::parse(Blocksnapshot::Xml::D
 	return output;
 }
 
-int Traits<Blocksnapshot::Xml::Domainblocksnapshot>::generate(const Blocksnapshot::Xml::Domainblocksnapshot& src_, QDomElement& dst_)
+template<class D>
+int Traits<Blocksnapshot::Xml::Domainblocksnapshot>::produce(const Blocksnapshot::Xml::Domainblocksnapshot& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -146,4 +172,14 @@ int Traits<Blocksnapshot::Xml::Domainblocksnapshot>::generate(const Blocksnapsho
 	return m.produce(dst_);
 }
 
+int Traits<Blocksnapshot::Xml::Domainblocksnapshot>::generate(const Blocksnapshot::Xml::Domainblocksnapshot& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Blocksnapshot::Xml::Domainblocksnapshot>::generate(const Blocksnapshot::Xml::Domainblocksnapshot& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 } // namespace Libvirt
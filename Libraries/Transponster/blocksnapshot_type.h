@@ -61,6 +61,7 @@ struct Disk
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VName m_name;
@@ -98,6 +99,7 @@ struct Domainblocksnapshot
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<QString > m_name;
@@ -117,6 +119,10 @@ struct Traits<Blocksnapshot::Xml::Disk>
 
 	static int parse(Blocksnapshot::Xml::Disk& , QStack<QDomElement>& );
 	static int generate(const Blocksnapshot::Xml::Disk& , QDomElement& );
+	static int generate(const Blocksnapshot::Xml::Disk& , Stream& );
+
+	template<class D>
+	static int produce(const Blocksnapshot::Xml::Disk& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -129,6 +135,10 @@ struct Traits<Blocksnapshot::Xml::Domainblocksnapshot>
 
 	static int parse(Blocksnapshot::Xml::Domainblocksnapshot& , QStack<QDomElement>& );
 	static int generate(const Blocksnapshot::Xml::Domainblocksnapshot& , QDomElement& );
+	static int generate(const Blocksnapshot::Xml::Domainblocksnapshot& , Stream& );
+
+	template<class D>
+	static int produce(const Blocksnapshot::Xml::Domainblocksnapshot& , D& );
 };
 
 } // namespace Libvirt
@@ -23,53 +23,246 @@
  */
 
 #include "capability_enum.h"
-#include <boost/assign/list_of.hpp>
 
-namespace ba = boost::assign;
 namespace Libvirt
 {
 template<>
-Enum<Capability::Xml::EVirYesNo>::data_type Enum<Capability::Xml::EVirYesNo>::getData()
+QString Enum<Capability::Xml::EVirYesNo>::getText(Capability::Xml::EVirYesNo value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Capability::Xml::EVirYesNoYes, "yes"))
-			(data_type::value_type(Capability::Xml::EVirYesNoNo, "no"));
+	switch (value_)
+	{
+	case Capability::Xml::EVirYesNoYes:
+		return QStringLiteral("yes");
+	case Capability::Xml::EVirYesNoNo:
+		return QStringLiteral("no");
+	}
+	return QString();
 }
 
 template<>
-Enum<Capability::Xml::EFallback>::data_type Enum<Capability::Xml::EFallback>::getData()
+int Enum<Capability::Xml::EVirYesNo>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Capability::Xml::EFallbackAllow, "allow"))
-			(data_type::value_type(Capability::Xml::EFallbackForbid, "forbid"));
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("no"))
+				return Capability::Xml::EVirYesNoNo;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'y':
+			if (text_ == QLatin1String("yes"))
+				return Capability::Xml::EVirYesNoYes;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Capability::Xml::EPolicy>::data_type Enum<Capability::Xml::EPolicy>::getData()
+QString Enum<Capability::Xml::EFallback>::getText(Capability::Xml::EFallback value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Capability::Xml::EPolicyForce, "force"))
-			(data_type::value_type(Capability::Xml::EPolicyRequire, "require"))
-			(data_type::value_type(Capability::Xml::EPolicyOptional, "optional"))
-			(data_type::value_type(Capability::Xml::EPolicyDisable, "disable"))
-			(data_type::value_type(Capability::Xml::EPolicyForbid, "forbid"));
+	switch (value_)
+	{
+	case Capability::Xml::EFallbackAllow:
+		return QStringLiteral("allow");
+	case Capability::Xml::EFallbackForbid:
+		return QStringLiteral("forbid");
+	}
+	return QString();
 }
 
 template<>
-Enum<Capability::Xml::EUsable>::data_type Enum<Capability::Xml::EUsable>::getData()
+int Enum<Capability::Xml::EFallback>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Capability::Xml::EUsableYes, "yes"))
-			(data_type::value_type(Capability::Xml::EUsableNo, "no"))
-			(data_type::value_type(Capability::Xml::EUsableUnknown, "unknown"));
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("allow"))
+				return Capability::Xml::EFallbackAllow;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("forbid"))
+				return Capability::Xml::EFallbackForbid;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Capability::Xml::EDeprecated>::data_type Enum<Capability::Xml::EDeprecated>::getData()
+QString Enum<Capability::Xml::EPolicy>::getText(Capability::Xml::EPolicy value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Capability::Xml::EDeprecatedYes, "yes"))
-			(data_type::value_type(Capability::Xml::EDeprecatedNo, "no"));
+	switch (value_)
+	{
+	case Capability::Xml::EPolicyForce:
+		return QStringLiteral("force");
+	case Capability::Xml::EPolicyRequire:
+		return QStringLiteral("require");
+	case Capability::Xml::EPolicyOptional:
+		return QStringLiteral("optional");
+	case Capability::Xml::EPolicyDisable:
+		return QStringLiteral("disable");
+	case Capability::Xml::EPolicyForbid:
+		return QStringLiteral("forbid");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Capability::Xml::EPolicy>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("force"))
+				return Capability::Xml::EPolicyForce;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("forbid"))
+				return Capability::Xml::EPolicyForbid;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("disable"))
+				return Capability::Xml::EPolicyDisable;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("require"))
+				return Capability::Xml::EPolicyRequire;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("optional"))
+				return Capability::Xml::EPolicyOptional;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Capability::Xml::EUsable>::getText(Capability::Xml::EUsable value_)
+{
+	switch (value_)
+	{
+	case Capability::Xml::EUsableYes:
+		return QStringLiteral("yes");
+	case Capability::Xml::EUsableNo:
+		return QStringLiteral("no");
+	case Capability::Xml::EUsableUnknown:
+		return QStringLiteral("unknown");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Capability::Xml::EUsable>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("no"))
+				return Capability::Xml::EUsableNo;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'y':
+			if (text_ == QLatin1String("yes"))
+				return Capability::Xml::EUsableYes;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("unknown"))
+				return Capability::Xml::EUsableUnknown;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Capability::Xml::EDeprecated>::getText(Capability::Xml::EDeprecated value_)
+{
+	switch (value_)
+	{
+	case Capability::Xml::EDeprecatedYes:
+		return QStringLiteral("yes");
+	case Capability::Xml::EDeprecatedNo:
+		return QStringLiteral("no");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Capability::Xml::EDeprecated>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("no"))
+				return Capability::Xml::EDeprecatedNo;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'y':
+			if (text_ == QLatin1String("yes"))
+				return Capability::Xml::EDeprecatedYes;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 } // namespace Libvirt
@@ -59,6 +59,13 @@ bool Enum::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Enum::save(QXmlStreamWriter& dst_) const
+{
+	Element<Enum, Name::Strict<1882> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -75,7 +82,8 @@ int Traits<Capability::Xml::Enum>::parse(Capability::Xml::Enum& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Capability::Xml::Enum>::generate(const Capability::Xml::Enum& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Enum>::produce(const Capability::Xml::Enum& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -86,6 +94,16 @@ int Traits<Capability::Xml::Enum>::generate(const Capability::Xml::Enum& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Enum>::generate(const Capability::Xml::Enum& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Enum>::generate(const Capability::Xml::Enum& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Loader
 
@@ -123,6 +141,13 @@ bool Loader::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Loader::save(QXmlStreamWriter& dst_) const
+{
+	Element<Loader, Name::Strict<273> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -140,7 +165,8 @@ int Traits<Capability::Xml::Loader>::parse(Capability::Xml::Loader& dst_, QStack
 	return output;
 }
 
-int Traits<Capability::Xml::Loader>::generate(const Capability::Xml::Loader& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Loader>::produce(const Capability::Xml::Loader& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<0>()))
@@ -153,6 +179,16 @@ int Traits<Capability::Xml::Loader>::generate(const Capability::Xml::Loader& src
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Loader>::generate(const Capability::Xml::Loader& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Loader>::generate(const Capability::Xml::Loader& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Os
 
@@ -190,6 +226,13 @@ bool Os::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Os::save(QXmlStreamWriter& dst_) const
+{
+	Element<Os, Name::Strict<222> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -207,7 +250,8 @@ int Traits<Capability::Xml::Os>::parse(Capability::Xml::Os& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Capability::Xml::Os>::generate(const Capability::Xml::Os& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Os>::produce(const Capability::Xml::Os& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<0>()))
@@ -220,6 +264,16 @@ int Traits<Capability::Xml::Os>::generate(const Capability::Xml::Os& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Os>::generate(const Capability::Xml::Os& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Os>::generate(const Capability::Xml::Os& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Mode
 
@@ -257,6 +311,13 @@ bool Mode::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Mode::save(QXmlStreamWriter& dst_) const
+{
+	Element<Mode, Name::Strict<379> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -273,7 +334,8 @@ int Traits<Capability::Xml::Mode>::parse(Capability::Xml::Mode& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Capability::Xml::Mode>::generate(const Capability::Xml::Mode& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Mode>::produce(const Capability::Xml::Mode& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<1>()))
@@ -284,6 +346,16 @@ int Traits<Capability::Xml::Mode>::generate(const Capability::Xml::Mode& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Mode>::generate(const Capability::Xml::Mode& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Mode>::generate(const Capability::Xml::Mode& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Mode1
 
@@ -321,6 +393,13 @@ bool Mode1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Mode1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Mode1, Name::Strict<379> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -337,7 +416,8 @@ int Traits<Capability::Xml::Mode1>::parse(Capability::Xml::Mode1& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Capability::Xml::Mode1>::generate(const Capability::Xml::Mode1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Mode1>::produce(const Capability::Xml::Mode1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<1>()))
@@ -348,6 +428,16 @@ int Traits<Capability::Xml::Mode1>::generate(const Capability::Xml::Mode1& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Mode1>::generate(const Capability::Xml::Mode1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Mode1>::generate(const Capability::Xml::Mode1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Model
 
@@ -381,6 +471,13 @@ bool Model::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Model::save(QXmlStreamWriter& dst_) const
+{
+	Element<Model, Name::Strict<231> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -398,7 +495,8 @@ int Traits<Capability::Xml::Model>::parse(Capability::Xml::Model& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Capability::Xml::Model>::generate(const Capability::Xml::Model& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Model>::produce(const Capability::Xml::Model& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFallback(), m.get<0>()))
@@ -411,6 +509,16 @@ int Traits<Capability::Xml::Model>::generate(const Capability::Xml::Model& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Model>::generate(const Capability::Xml::Model& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Model>::generate(const Capability::Xml::Model& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Feature
 
@@ -448,6 +556,13 @@ bool Feature::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Feature::save(QXmlStreamWriter& dst_) const
+{
+	Element<Feature, Name::Strict<1022> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -464,7 +579,8 @@ int Traits<Capability::Xml::Feature>::parse(Capability::Xml::Feature& dst_, QSta
 	return output;
 }
 
-int Traits<Capability::Xml::Feature>::generate(const Capability::Xml::Feature& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Feature>::produce(const Capability::Xml::Feature& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPolicy(), m.get<0>()))
@@ -475,6 +591,16 @@ int Traits<Capability::Xml::Feature>::generate(const Capability::Xml::Feature& s
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Feature>::generate(const Capability::Xml::Feature& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Feature>::generate(const Capability::Xml::Feature& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Anonymous4936
 
@@ -512,7 +638,8 @@ int Traits<Capability::Xml::Anonymous4936>::parse(Capability::Xml::Anonymous4936
 	return output;
 }
 
-int Traits<Capability::Xml::Anonymous4936>::generate(const Capability::Xml::Anonymous4936& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Anonymous4936>::produce(const Capability::Xml::Anonymous4936& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -525,6 +652,16 @@ int Traits<Capability::Xml::Anonymous4936>::generate(const Capability::Xml::Anon
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Anonymous4936>::generate(const Capability::Xml::Anonymous4936& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Anonymous4936>::generate(const Capability::Xml::Anonymous4936& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Mode2
 
@@ -562,6 +699,13 @@ bool Mode2::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Mode2::save(QXmlStreamWriter& dst_) const
+{
+	Element<Mode2, Name::Strict<379> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -578,7 +722,8 @@ int Traits<Capability::Xml::Mode2>::parse(Capability::Xml::Mode2& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Capability::Xml::Mode2>::generate(const Capability::Xml::Mode2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Mode2>::produce(const Capability::Xml::Mode2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<1>()))
@@ -589,6 +734,16 @@ int Traits<Capability::Xml::Mode2>::generate(const Capability::Xml::Mode2& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Mode2>::generate(const Capability::Xml::Mode2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Mode2>::generate(const Capability::Xml::Mode2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Model1
 
@@ -626,6 +781,13 @@ bool Model1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Model1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Model1, Name::Strict<231> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -643,7 +805,8 @@ int Traits<Capability::Xml::Model1>::parse(Capability::Xml::Model1& dst_, QStack
 	return output;
 }
 
-int Traits<Capability::Xml::Model1>::generate(const Capability::Xml::Model1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Model1>::produce(const Capability::Xml::Model1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getUsable(), m.get<0>()))
@@ -656,6 +819,16 @@ int Traits<Capability::Xml::Model1>::generate(const Capability::Xml::Model1& src
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Model1>::generate(const Capability::Xml::Model1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Model1>::generate(const Capability::Xml::Model1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Mode3
 
@@ -693,6 +866,13 @@ bool Mode3::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Mode3::save(QXmlStreamWriter& dst_) const
+{
+	Element<Mode3, Name::Strict<379> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -709,7 +889,8 @@ int Traits<Capability::Xml::Mode3>::parse(Capability::Xml::Mode3& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Capability::Xml::Mode3>::generate(const Capability::Xml::Mode3& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Mode3>::produce(const Capability::Xml::Mode3& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<1>()))
@@ -720,6 +901,16 @@ int Traits<Capability::Xml::Mode3>::generate(const Capability::Xml::Mode3& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Mode3>::generate(const Capability::Xml::Mode3& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Mode3>::generate(const Capability::Xml::Mode3& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Cpu
 
@@ -753,6 +944,13 @@ bool Cpu::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Cpu::save(QXmlStreamWriter& dst_) const
+{
+	Element<Cpu, Name::Strict<220> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -771,7 +969,8 @@ int Traits<Capability::Xml::Cpu>::parse(Capability::Xml::Cpu& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Capability::Xml::Cpu>::generate(const Capability::Xml::Cpu& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Cpu>::produce(const Capability::Xml::Cpu& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMode(), m.get<0>()))
@@ -786,6 +985,16 @@ int Traits<Capability::Xml::Cpu>::generate(const Capability::Xml::Cpu& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Cpu>::generate(const Capability::Xml::Cpu& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Cpu>::generate(const Capability::Xml::Cpu& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct MemoryBacking
 
@@ -823,6 +1032,13 @@ bool MemoryBacking::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool MemoryBacking::save(QXmlStreamWriter& dst_) const
+{
+	Element<MemoryBacking, Name::Strict<331> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -839,7 +1055,8 @@ int Traits<Capability::Xml::MemoryBacking>::parse(Capability::Xml::MemoryBacking
 	return output;
 }
 
-int Traits<Capability::Xml::MemoryBacking>::generate(const Capability::Xml::MemoryBacking& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::MemoryBacking>::produce(const Capability::Xml::MemoryBacking& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<0>()))
@@ -850,6 +1067,16 @@ int Traits<Capability::Xml::MemoryBacking>::generate(const Capability::Xml::Memo
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::MemoryBacking>::generate(const Capability::Xml::MemoryBacking& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::MemoryBacking>::generate(const Capability::Xml::MemoryBacking& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Disk
 
@@ -887,6 +1114,13 @@ bool Disk::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Disk::save(QXmlStreamWriter& dst_) const
+{
+	Element<Disk, Name::Strict<472> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -903,7 +1137,8 @@ int Traits<Capability::Xml::Disk>::parse(Capability::Xml::Disk& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Capability::Xml::Disk>::generate(const Capability::Xml::Disk& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Disk>::produce(const Capability::Xml::Disk& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<0>()))
@@ -914,6 +1149,16 @@ int Traits<Capability::Xml::Disk>::generate(const Capability::Xml::Disk& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Disk>::generate(const Capability::Xml::Disk& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Disk>::generate(const Capability::Xml::Disk& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Graphics
 
@@ -951,6 +1196,13 @@ bool Graphics::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Graphics::save(QXmlStreamWriter& dst_) const
+{
+	Element<Graphics, Name::Strict<712> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -967,7 +1219,8 @@ int Traits<Capability::Xml::Graphics>::parse(Capability::Xml::Graphics& dst_, QS
 	return output;
 }
 
-int Traits<Capability::Xml::Graphics>::generate(const Capability::Xml::Graphics& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Graphics>::produce(const Capability::Xml::Graphics& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<0>()))
@@ -978,6 +1231,16 @@ int Traits<Capability::Xml::Graphics>::generate(const Capability::Xml::Graphics&
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Graphics>::generate(const Capability::Xml::Graphics& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Graphics>::generate(const Capability::Xml::Graphics& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Video
 
@@ -1015,6 +1278,13 @@ bool Video::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Video::save(QXmlStreamWriter& dst_) const
+{
+	Element<Video, Name::Strict<779> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -1031,7 +1301,8 @@ int Traits<Capability::Xml::Video>::parse(Capability::Xml::Video& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Capability::Xml::Video>::generate(const Capability::Xml::Video& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Video>::produce(const Capability::Xml::Video& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<0>()))
@@ -1042,6 +1313,16 @@ int Traits<Capability::Xml::Video>::generate(const Capability::Xml::Video& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Video>::generate(const Capability::Xml::Video& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Video>::generate(const Capability::Xml::Video& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hostdev
 
@@ -1079,6 +1360,13 @@ bool Hostdev::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Hostdev::save(QXmlStreamWriter& dst_) const
+{
+	Element<Hostdev, Name::Strict<676> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -1095,7 +1383,8 @@ int Traits<Capability::Xml::Hostdev>::parse(Capability::Xml::Hostdev& dst_, QSta
 	return output;
 }
 
-int Traits<Capability::Xml::Hostdev>::generate(const Capability::Xml::Hostdev& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Hostdev>::produce(const Capability::Xml::Hostdev& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<0>()))
@@ -1106,6 +1395,16 @@ int Traits<Capability::Xml::Hostdev>::generate(const Capability::Xml::Hostdev& s
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Hostdev>::generate(const Capability::Xml::Hostdev& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Hostdev>::generate(const Capability::Xml::Hostdev& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Rng
 
@@ -1143,6 +1442,13 @@ bool Rng::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Rng::save(QXmlStreamWriter& dst_) const
+{
+	Element<Rng, Name::Strict<981> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -1159,7 +1465,8 @@ int Traits<Capability::Xml::Rng>::parse(Capability::Xml::Rng& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Capability::Xml::Rng>::generate(const Capability::Xml::Rng& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Rng>::produce(const Capability::Xml::Rng& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<0>()))
@@ -1170,6 +1477,16 @@ int Traits<Capability::Xml::Rng>::generate(const Capability::Xml::Rng& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Rng>::generate(const Capability::Xml::Rng& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Rng>::generate(const Capability::Xml::Rng& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Filesystem
 
@@ -1207,6 +1524,13 @@ bool Filesystem::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Filesystem::save(QXmlStreamWriter& dst_) const
+{
+	Element<Filesystem, Name::Strict<630> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -1223,7 +1547,8 @@ int Traits<Capability::Xml::Filesystem>::parse(Capability::Xml::Filesystem& dst_
 	return output;
 }
 
-int Traits<Capability::Xml::Filesystem>::generate(const Capability::Xml::Filesystem& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Filesystem>::produce(const Capability::Xml::Filesystem& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<0>()))
@@ -1234,6 +1559,16 @@ int Traits<Capability::Xml::Filesystem>::generate(const Capability::Xml::Filesys
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Filesystem>::generate(const Capability::Xml::Filesystem& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Filesystem>::generate(const Capability::Xml::Filesystem& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Tpm
 
@@ -1271,6 +1606,13 @@ bool Tpm::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Tpm::save(QXmlStreamWriter& dst_) const
+{
+	Element<Tpm, Name::Strict<902> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -1287,7 +1629,8 @@ int Traits<Capability::Xml::Tpm>::parse(Capability::Xml::Tpm& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Capability::Xml::Tpm>::generate(const Capability::Xml::Tpm& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Tpm>::produce(const Capability::Xml::Tpm& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<0>()))
@@ -1298,6 +1641,16 @@ int Traits<Capability::Xml::Tpm>::generate(const Capability::Xml::Tpm& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Tpm>::generate(const Capability::Xml::Tpm& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Tpm>::generate(const Capability::Xml::Tpm& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Devices
 
@@ -1331,6 +1684,13 @@ bool Devices::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Devices::save(QXmlStreamWriter& dst_) const
+{
+	Element<Devices, Name::Strict<228> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -1352,7 +1712,8 @@ int Traits<Capability::Xml::Devices>::parse(Capability::Xml::Devices& dst_, QSta
 	return output;
 }
 
-int Traits<Capability::Xml::Devices>::generate(const Capability::Xml::Devices& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Devices>::produce(const Capability::Xml::Devices& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDisk(), m.get<0>()))
@@ -1373,6 +1734,16 @@ int Traits<Capability::Xml::Devices>::generate(const Capability::Xml::Devices& s
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Devices>::generate(const Capability::Xml::Devices& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Devices>::generate(const Capability::Xml::Devices& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Gic
 
@@ -1410,6 +1781,13 @@ bool Gic::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Gic::save(QXmlStreamWriter& dst_) const
+{
+	Element<Gic, Name::Strict<1001> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -1426,7 +1804,8 @@ int Traits<Capability::Xml::Gic>::parse(Capability::Xml::Gic& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Capability::Xml::Gic>::generate(const Capability::Xml::Gic& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Gic>::produce(const Capability::Xml::Gic& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<0>()))
@@ -1437,6 +1816,16 @@ int Traits<Capability::Xml::Gic>::generate(const Capability::Xml::Gic& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Gic>::generate(const Capability::Xml::Gic& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Gic>::generate(const Capability::Xml::Gic& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Anonymous5138
 
@@ -1479,7 +1868,8 @@ int Traits<Capability::Xml::Anonymous5138>::parse(Capability::Xml::Anonymous5138
 	return output;
 }
 
-int Traits<Capability::Xml::Anonymous5138>::generate(const Capability::Xml::Anonymous5138& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Anonymous5138>::produce(const Capability::Xml::Anonymous5138& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCbitpos(), m.get<0>()))
@@ -1494,6 +1884,16 @@ int Traits<Capability::Xml::Anonymous5138>::generate(const Capability::Xml::Anon
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Anonymous5138>::generate(const Capability::Xml::Anonymous5138& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Anonymous5138>::generate(const Capability::Xml::Anonymous5138& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Sev
 
@@ -1531,6 +1931,13 @@ bool Sev::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Sev::save(QXmlStreamWriter& dst_) const
+{
+	Element<Sev, Name::Strict<3562> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -1547,7 +1954,8 @@ int Traits<Capability::Xml::Sev>::parse(Capability::Xml::Sev& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Capability::Xml::Sev>::generate(const Capability::Xml::Sev& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Sev>::produce(const Capability::Xml::Sev& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSupported(), m.get<0>()))
@@ -1558,6 +1966,16 @@ int Traits<Capability::Xml::Sev>::generate(const Capability::Xml::Sev& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Sev>::generate(const Capability::Xml::Sev& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Sev>::generate(const Capability::Xml::Sev& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Features
 
@@ -1591,6 +2009,13 @@ bool Features::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Features::save(QXmlStreamWriter& dst_) const
+{
+	Element<Features, Name::Strict<155> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -1612,7 +2037,8 @@ int Traits<Capability::Xml::Features>::parse(Capability::Xml::Features& dst_, QS
 	return output;
 }
 
-int Traits<Capability::Xml::Features>::generate(const Capability::Xml::Features& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::Features>::produce(const Capability::Xml::Features& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getGic(), m.get<0>()))
@@ -1633,6 +2059,16 @@ int Traits<Capability::Xml::Features>::generate(const Capability::Xml::Features&
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::Features>::generate(const Capability::Xml::Features& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::Features>::generate(const Capability::Xml::Features& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct DomainCapabilities
 
@@ -1666,6 +2102,13 @@ bool DomainCapabilities::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool DomainCapabilities::save(QXmlStreamWriter& dst_) const
+{
+	Element<DomainCapabilities, Name::Strict<1879> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Capability
@@ -1691,7 +2134,8 @@ int Traits<Capability::Xml::DomainCapabilities>::parse(Capability::Xml::DomainCa
 	return output;
 }
 
-int Traits<Capability::Xml::DomainCapabilities>::generate(const Capability::Xml::DomainCapabilities& src_, QDomElement& dst_)
+template<class D>
+int Traits<Capability::Xml::DomainCapabilities>::produce(const Capability::Xml::DomainCapabilities& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPath(), m.get<0>()))
@@ -1720,4 +2164,14 @@ int Traits<Capability::Xml::DomainCapabilities>::generate(const Capability::Xml:
 	return m.produce(dst_);
 }
 
+int Traits<Capability::Xml::DomainCapabilities>::generate(const Capability::Xml::DomainCapabilities& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Capability::Xml::DomainCapabilities>::generate(const Capability::Xml::DomainCapabilities& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 } // namespace Libvirt
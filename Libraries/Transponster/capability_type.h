@@ -61,6 +61,7 @@ struct Enum
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QString m_name;
@@ -108,6 +109,7 @@ struct Loader
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -156,6 +158,7 @@ struct Os
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -196,6 +199,7 @@ struct Mode
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -235,6 +239,7 @@ struct Mode1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -280,6 +285,7 @@ struct Model
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EFallback > m_fallback;
@@ -320,6 +326,7 @@ struct Feature
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EPolicy m_policy;
@@ -404,6 +411,7 @@ struct Mode2
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -451,6 +459,7 @@ struct Model1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EUsable m_usable;
@@ -491,6 +500,7 @@ struct Mode3
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -544,6 +554,7 @@ struct Cpu
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	Mode m_mode;
@@ -585,6 +596,7 @@ struct MemoryBacking
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -624,6 +636,7 @@ struct Disk
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -663,6 +676,7 @@ struct Graphics
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -702,6 +716,7 @@ struct Video
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -741,6 +756,7 @@ struct Hostdev
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -780,6 +796,7 @@ struct Rng
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -819,6 +836,7 @@ struct Filesystem
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -858,6 +876,7 @@ struct Tpm
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -935,6 +954,7 @@ struct Devices
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<Disk > m_disk;
@@ -979,6 +999,7 @@ struct Gic
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -1074,6 +1095,7 @@ struct Sev
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_supported;
@@ -1151,6 +1173,7 @@ struct Features
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<Gic > m_gic;
@@ -1265,6 +1288,7 @@ struct DomainCapabilities
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PAbsFilePath::value_type m_path;
@@ -1293,6 +1317,10 @@ struct Traits<Capability::Xml::Enum>
 
 	static int parse(Capability::Xml::Enum& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Enum& , QDomElement& );
+	static int generate(const Capability::Xml::Enum& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Enum& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1305,6 +1333,10 @@ struct Traits<Capability::Xml::Loader>
 
 	static int parse(Capability::Xml::Loader& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Loader& , QDomElement& );
+	static int generate(const Capability::Xml::Loader& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Loader& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1317,6 +1349,10 @@ struct Traits<Capability::Xml::Os>
 
 	static int parse(Capability::Xml::Os& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Os& , QDomElement& );
+	static int generate(const Capability::Xml::Os& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Os& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1329,6 +1365,10 @@ struct Traits<Capability::Xml::Mode>
 
 	static int parse(Capability::Xml::Mode& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Mode& , QDomElement& );
+	static int generate(const Capability::Xml::Mode& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Mode& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1341,6 +1381,10 @@ struct Traits<Capability::Xml::Mode1>
 
 	static int parse(Capability::Xml::Mode1& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Mode1& , QDomElement& );
+	static int generate(const Capability::Xml::Mode1& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Mode1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1353,6 +1397,10 @@ struct Traits<Capability::Xml::Model>
 
 	static int parse(Capability::Xml::Model& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Model& , QDomElement& );
+	static int generate(const Capability::Xml::Model& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Model& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1365,6 +1413,10 @@ struct Traits<Capability::Xml::Feature>
 
 	static int parse(Capability::Xml::Feature& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Feature& , QDomElement& );
+	static int generate(const Capability::Xml::Feature& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Feature& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1377,6 +1429,10 @@ struct Traits<Capability::Xml::Anonymous4936>
 
 	static int parse(Capability::Xml::Anonymous4936& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Anonymous4936& , QDomElement& );
+	static int generate(const Capability::Xml::Anonymous4936& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Anonymous4936& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1389,6 +1445,10 @@ struct Traits<Capability::Xml::Mode2>
 
 	static int parse(Capability::Xml::Mode2& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Mode2& , QDomElement& );
+	static int generate(const Capability::Xml::Mode2& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Mode2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1401,6 +1461,10 @@ struct Traits<Capability::Xml::Model1>
 
 	static int parse(Capability::Xml::Model1& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Model1& , QDomElement& );
+	static int generate(const Capability::Xml::Model1& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Model1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1413,6 +1477,10 @@ struct Traits<Capability::Xml::Mode3>
 
 	static int parse(Capability::Xml::Mode3& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Mode3& , QDomElement& );
+	static int generate(const Capability::Xml::Mode3& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Mode3& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1425,6 +1493,10 @@ struct Traits<Capability::Xml::Cpu>
 
 	static int parse(Capability::Xml::Cpu& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Cpu& , QDomElement& );
+	static int generate(const Capability::Xml::Cpu& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Cpu& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1437,6 +1509,10 @@ struct Traits<Capability::Xml::MemoryBacking>
 
 	static int parse(Capability::Xml::MemoryBacking& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::MemoryBacking& , QDomElement& );
+	static int generate(const Capability::Xml::MemoryBacking& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::MemoryBacking& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1449,6 +1525,10 @@ struct Traits<Capability::Xml::Disk>
 
 	static int parse(Capability::Xml::Disk& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Disk& , QDomElement& );
+	static int generate(const Capability::Xml::Disk& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Disk& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1461,6 +1541,10 @@ struct Traits<Capability::Xml::Graphics>
 
 	static int parse(Capability::Xml::Graphics& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Graphics& , QDomElement& );
+	static int generate(const Capability::Xml::Graphics& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Graphics& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1473,6 +1557,10 @@ struct Traits<Capability::Xml::Video>
 
 	static int parse(Capability::Xml::Video& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Video& , QDomElement& );
+	static int generate(const Capability::Xml::Video& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Video& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1485,6 +1573,10 @@ struct Traits<Capability::Xml::Hostdev>
 
 	static int parse(Capability::Xml::Hostdev& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Hostdev& , QDomElement& );
+	static int generate(const Capability::Xml::Hostdev& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Hostdev& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1497,6 +1589,10 @@ struct Traits<Capability::Xml::Rng>
 
 	static int parse(Capability::Xml::Rng& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Rng& , QDomElement& );
+	static int generate(const Capability::Xml::Rng& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Rng& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1509,6 +1605,10 @@ struct Traits<Capability::Xml::Filesystem>
 
 	static int parse(Capability::Xml::Filesystem& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Filesystem& , QDomElement& );
+	static int generate(const Capability::Xml::Filesystem& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Filesystem& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1521,6 +1621,10 @@ struct Traits<Capability::Xml::Tpm>
 
 	static int parse(Capability::Xml::Tpm& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Tpm& , QDomElement& );
+	static int generate(const Capability::Xml::Tpm& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Tpm& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1533,6 +1637,10 @@ struct Traits<Capability::Xml::Devices>
 
 	static int parse(Capability::Xml::Devices& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Devices& , QDomElement& );
+	static int generate(const Capability::Xml::Devices& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Devices& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1545,6 +1653,10 @@ struct Traits<Capability::Xml::Gic>
 
 	static int parse(Capability::Xml::Gic& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Gic& , QDomElement& );
+	static int generate(const Capability::Xml::Gic& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Gic& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1557,6 +1669,10 @@ struct Traits<Capability::Xml::Anonymous5138>
 
 	static int parse(Capability::Xml::Anonymous5138& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Anonymous5138& , QDomElement& );
+	static int generate(const Capability::Xml::Anonymous5138& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Anonymous5138& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1569,6 +1685,10 @@ struct Traits<Capability::Xml::Sev>
 
 	static int parse(Capability::Xml::Sev& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Sev& , QDomElement& );
+	static int generate(const Capability::Xml::Sev& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Sev& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1581,6 +1701,10 @@ struct Traits<Capability::Xml::Features>
 
 	static int parse(Capability::Xml::Features& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::Features& , QDomElement& );
+	static int generate(const Capability::Xml::Features& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::Features& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1593,6 +1717,10 @@ struct Traits<Capability::Xml::DomainCapabilities>
 
 	static int parse(Capability::Xml::DomainCapabilities& , QStack<QDomElement>& );
 	static int generate(const Capability::Xml::DomainCapabilities& , QDomElement& );
+	static int generate(const Capability::Xml::DomainCapabilities& , Stream& );
+
+	template<class D>
+	static int produce(const Capability::Xml::DomainCapabilities& , D& );
 };
 
 } // namespace Libvirt
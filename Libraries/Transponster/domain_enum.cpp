@@ -23,1452 +23,7949 @@
  */
 
 #include "domain_enum.h"
-#include <boost/assign/list_of.hpp>
 
-namespace ba = boost::assign;
 namespace Libvirt
 {
 template<>
-Enum<Domain::Xml::EType>::data_type Enum<Domain::Xml::EType>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ETypeQemu, "qemu"))
-			(data_type::value_type(Domain::Xml::ETypeKqemu, "kqemu"))
-			(data_type::value_type(Domain::Xml::ETypeKvm, "kvm"))
-			(data_type::value_type(Domain::Xml::ETypeXen, "xen"))
-			(data_type::value_type(Domain::Xml::ETypeLxc, "lxc"))
-			(data_type::value_type(Domain::Xml::ETypeUml, "uml"))
-			(data_type::value_type(Domain::Xml::ETypeOpenvz, "openvz"))
-			(data_type::value_type(Domain::Xml::ETypeTest, "test"))
-			(data_type::value_type(Domain::Xml::ETypeVmware, "vmware"))
-			(data_type::value_type(Domain::Xml::ETypeHyperv, "hyperv"))
-			(data_type::value_type(Domain::Xml::ETypeVbox, "vbox"))
-			(data_type::value_type(Domain::Xml::ETypePhyp, "phyp"))
-			(data_type::value_type(Domain::Xml::ETypeVirtuozzo, "virtuozzo"))
-			(data_type::value_type(Domain::Xml::ETypeBhyve, "bhyve"));
-}
-
-template<>
-Enum<Domain::Xml::EMode>::data_type Enum<Domain::Xml::EMode>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModeCustom, "custom"))
-			(data_type::value_type(Domain::Xml::EModeHostModel, "host-model"))
-			(data_type::value_type(Domain::Xml::EModeHostPassthrough, "host-passthrough"))
-			(data_type::value_type(Domain::Xml::EModeMaximum, "maximum"));
-}
-
-template<>
-Enum<Domain::Xml::EMatch>::data_type Enum<Domain::Xml::EMatch>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMatchMinimum, "minimum"))
-			(data_type::value_type(Domain::Xml::EMatchExact, "exact"))
-			(data_type::value_type(Domain::Xml::EMatchStrict, "strict"));
-}
-
-template<>
-Enum<Domain::Xml::ECheck>::data_type Enum<Domain::Xml::ECheck>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ECheckNone, "none"))
-			(data_type::value_type(Domain::Xml::ECheckPartial, "partial"))
-			(data_type::value_type(Domain::Xml::ECheckFull, "full"));
-}
-
-template<>
-Enum<Domain::Xml::EVirOnOff>::data_type Enum<Domain::Xml::EVirOnOff>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EVirOnOffOn, "on"))
-			(data_type::value_type(Domain::Xml::EVirOnOffOff, "off"));
-}
-
-template<>
-Enum<Domain::Xml::EFallback>::data_type Enum<Domain::Xml::EFallback>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EFallbackAllow, "allow"))
-			(data_type::value_type(Domain::Xml::EFallbackForbid, "forbid"));
-}
-
-template<>
-Enum<Domain::Xml::EPolicy>::data_type Enum<Domain::Xml::EPolicy>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EPolicyForce, "force"))
-			(data_type::value_type(Domain::Xml::EPolicyRequire, "require"))
-			(data_type::value_type(Domain::Xml::EPolicyOptional, "optional"))
-			(data_type::value_type(Domain::Xml::EPolicyDisable, "disable"))
-			(data_type::value_type(Domain::Xml::EPolicyForbid, "forbid"));
-}
-
-template<>
-Enum<Domain::Xml::EMemAccess>::data_type Enum<Domain::Xml::EMemAccess>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMemAccessShared, "shared"))
-			(data_type::value_type(Domain::Xml::EMemAccessPrivate, "private"));
-}
-
-template<>
-Enum<Domain::Xml::EVirYesNo>::data_type Enum<Domain::Xml::EVirYesNo>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EVirYesNoYes, "yes"))
-			(data_type::value_type(Domain::Xml::EVirYesNoNo, "no"));
-}
-
-template<>
-Enum<Domain::Xml::EAssociativity>::data_type Enum<Domain::Xml::EAssociativity>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EAssociativityNone, "none"))
-			(data_type::value_type(Domain::Xml::EAssociativityDirect, "direct"))
-			(data_type::value_type(Domain::Xml::EAssociativityFull, "full"));
-}
-
-template<>
-Enum<Domain::Xml::EPolicy1>::data_type Enum<Domain::Xml::EPolicy1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EPolicy1None, "none"))
-			(data_type::value_type(Domain::Xml::EPolicy1Writeback, "writeback"))
-			(data_type::value_type(Domain::Xml::EPolicy1Writethrough, "writethrough"));
-}
-
-template<>
-Enum<Domain::Xml::EType1>::data_type Enum<Domain::Xml::EType1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType1Access, "access"))
-			(data_type::value_type(Domain::Xml::EType1Read, "read"))
-			(data_type::value_type(Domain::Xml::EType1Write, "write"));
-}
-
-template<>
-Enum<Domain::Xml::EType2>::data_type Enum<Domain::Xml::EType2>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType2Access, "access"))
-			(data_type::value_type(Domain::Xml::EType2Read, "read"))
-			(data_type::value_type(Domain::Xml::EType2Write, "write"));
-}
-
-template<>
-Enum<Domain::Xml::ELevel>::data_type Enum<Domain::Xml::ELevel>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ELevel1, "1"))
-			(data_type::value_type(Domain::Xml::ELevel2, "2"))
-			(data_type::value_type(Domain::Xml::ELevel3, "3"));
-}
-
-template<>
-Enum<Domain::Xml::EMode1>::data_type Enum<Domain::Xml::EMode1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMode1Emulate, "emulate"))
-			(data_type::value_type(Domain::Xml::EMode1Passthrough, "passthrough"))
-			(data_type::value_type(Domain::Xml::EMode1Disable, "disable"));
-}
-
-template<>
-Enum<Domain::Xml::ESysinfoBiosName>::data_type Enum<Domain::Xml::ESysinfoBiosName>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ESysinfoBiosNameVendor, "vendor"))
-			(data_type::value_type(Domain::Xml::ESysinfoBiosNameVersion, "version"))
-			(data_type::value_type(Domain::Xml::ESysinfoBiosNameDate, "date"))
-			(data_type::value_type(Domain::Xml::ESysinfoBiosNameRelease, "release"));
-}
-
-template<>
-Enum<Domain::Xml::ESysinfoSystemName>::data_type Enum<Domain::Xml::ESysinfoSystemName>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ESysinfoSystemNameManufacturer, "manufacturer"))
-			(data_type::value_type(Domain::Xml::ESysinfoSystemNameProduct, "product"))
-			(data_type::value_type(Domain::Xml::ESysinfoSystemNameVersion, "version"))
-			(data_type::value_type(Domain::Xml::ESysinfoSystemNameSerial, "serial"))
-			(data_type::value_type(Domain::Xml::ESysinfoSystemNameUuid, "uuid"))
-			(data_type::value_type(Domain::Xml::ESysinfoSystemNameSku, "sku"))
-			(data_type::value_type(Domain::Xml::ESysinfoSystemNameFamily, "family"));
-}
-
-template<>
-Enum<Domain::Xml::ESysinfoBaseBoardName>::data_type Enum<Domain::Xml::ESysinfoBaseBoardName>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ESysinfoBaseBoardNameManufacturer, "manufacturer"))
-			(data_type::value_type(Domain::Xml::ESysinfoBaseBoardNameProduct, "product"))
-			(data_type::value_type(Domain::Xml::ESysinfoBaseBoardNameVersion, "version"))
-			(data_type::value_type(Domain::Xml::ESysinfoBaseBoardNameSerial, "serial"))
-			(data_type::value_type(Domain::Xml::ESysinfoBaseBoardNameAsset, "asset"))
-			(data_type::value_type(Domain::Xml::ESysinfoBaseBoardNameLocation, "location"));
-}
-
-template<>
-Enum<Domain::Xml::ESysinfoChassisName>::data_type Enum<Domain::Xml::ESysinfoChassisName>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ESysinfoChassisNameManufacturer, "manufacturer"))
-			(data_type::value_type(Domain::Xml::ESysinfoChassisNameVersion, "version"))
-			(data_type::value_type(Domain::Xml::ESysinfoChassisNameSerial, "serial"))
-			(data_type::value_type(Domain::Xml::ESysinfoChassisNameAsset, "asset"))
-			(data_type::value_type(Domain::Xml::ESysinfoChassisNameSku, "sku"));
-}
-
-template<>
-Enum<Domain::Xml::EArch>::data_type Enum<Domain::Xml::EArch>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EArchI686, "i686"))
-			(data_type::value_type(Domain::Xml::EArchX8664, "x86_64"))
-			(data_type::value_type(Domain::Xml::EArchIa64, "ia64"));
-}
-
-template<>
-Enum<Domain::Xml::EMachine>::data_type Enum<Domain::Xml::EMachine>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMachineXenpv, "xenpv"))
-			(data_type::value_type(Domain::Xml::EMachineXenner, "xenner"));
-}
-
-template<>
-Enum<Domain::Xml::EType3>::data_type Enum<Domain::Xml::EType3>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType3Xen, "xen"))
-			(data_type::value_type(Domain::Xml::EType3Linux, "linux"));
-}
-
-template<>
-Enum<Domain::Xml::EArch1>::data_type Enum<Domain::Xml::EArch1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EArch1I686, "i686"))
-			(data_type::value_type(Domain::Xml::EArch1X8664, "x86_64"));
-}
-
-template<>
-Enum<Domain::Xml::EMachine1>::data_type Enum<Domain::Xml::EMachine1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMachine1G3beige, "g3beige"))
-			(data_type::value_type(Domain::Xml::EMachine1Mac99, "mac99"))
-			(data_type::value_type(Domain::Xml::EMachine1Prep, "prep"))
-			(data_type::value_type(Domain::Xml::EMachine1Ppce500, "ppce500"));
-}
-
-template<>
-Enum<Domain::Xml::EMachine2>::data_type Enum<Domain::Xml::EMachine2>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMachine2Pseries, "pseries"));
-}
-
-template<>
-Enum<Domain::Xml::EArch2>::data_type Enum<Domain::Xml::EArch2>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EArch2S390, "s390"))
-			(data_type::value_type(Domain::Xml::EArch2S390x, "s390x"));
-}
-
-template<>
-Enum<Domain::Xml::EMachine3>::data_type Enum<Domain::Xml::EMachine3>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMachine3S390, "s390"))
-			(data_type::value_type(Domain::Xml::EMachine3S390Virtio, "s390-virtio"))
-			(data_type::value_type(Domain::Xml::EMachine3S390Ccw, "s390-ccw"))
-			(data_type::value_type(Domain::Xml::EMachine3S390CcwVirtio, "s390-ccw-virtio"));
-}
-
-template<>
-Enum<Domain::Xml::EArch3>::data_type Enum<Domain::Xml::EArch3>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EArch3Armv7l, "armv7l"));
-}
-
-template<>
-Enum<Domain::Xml::EArch4>::data_type Enum<Domain::Xml::EArch4>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EArch4Aarch64, "aarch64"));
-}
-
-template<>
-Enum<Domain::Xml::EReadonly>::data_type Enum<Domain::Xml::EReadonly>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EReadonlyYes, "yes"))
-			(data_type::value_type(Domain::Xml::EReadonlyNo, "no"));
-}
-
-template<>
-Enum<Domain::Xml::ESecure>::data_type Enum<Domain::Xml::ESecure>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ESecureYes, "yes"))
-			(data_type::value_type(Domain::Xml::ESecureNo, "no"));
-}
-
-template<>
-Enum<Domain::Xml::EType4>::data_type Enum<Domain::Xml::EType4>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType4Rom, "rom"))
-			(data_type::value_type(Domain::Xml::EType4Pflash, "pflash"));
-}
-
-template<>
-Enum<Domain::Xml::EStartupPolicy>::data_type Enum<Domain::Xml::EStartupPolicy>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EStartupPolicyMandatory, "mandatory"))
-			(data_type::value_type(Domain::Xml::EStartupPolicyRequisite, "requisite"))
-			(data_type::value_type(Domain::Xml::EStartupPolicyOptional, "optional"));
-}
-
-template<>
-Enum<Domain::Xml::EFormat>::data_type Enum<Domain::Xml::EFormat>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EFormatDefault, "default"))
-			(data_type::value_type(Domain::Xml::EFormatQcow, "qcow"))
-			(data_type::value_type(Domain::Xml::EFormatLuks, "luks"));
-}
-
-template<>
-Enum<Domain::Xml::EProtocol>::data_type Enum<Domain::Xml::EProtocol>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EProtocolNbd, "nbd"))
-			(data_type::value_type(Domain::Xml::EProtocolRbd, "rbd"))
-			(data_type::value_type(Domain::Xml::EProtocolSheepdog, "sheepdog"))
-			(data_type::value_type(Domain::Xml::EProtocolGluster, "gluster"))
-			(data_type::value_type(Domain::Xml::EProtocolIscsi, "iscsi"))
-			(data_type::value_type(Domain::Xml::EProtocolHttp, "http"))
-			(data_type::value_type(Domain::Xml::EProtocolHttps, "https"))
-			(data_type::value_type(Domain::Xml::EProtocolFtp, "ftp"))
-			(data_type::value_type(Domain::Xml::EProtocolFtps, "ftps"))
-			(data_type::value_type(Domain::Xml::EProtocolTftp, "tftp"));
-}
-
-template<>
-Enum<Domain::Xml::ETransport>::data_type Enum<Domain::Xml::ETransport>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ETransportTcp, "tcp"))
-			(data_type::value_type(Domain::Xml::ETransportRdma, "rdma"));
-}
-
-template<>
-Enum<Domain::Xml::EMode2>::data_type Enum<Domain::Xml::EMode2>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMode2Host, "host"))
-			(data_type::value_type(Domain::Xml::EMode2Direct, "direct"));
-}
-
-template<>
-Enum<Domain::Xml::EFormat1>::data_type Enum<Domain::Xml::EFormat1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EFormat1Raw, "raw"))
-			(data_type::value_type(Domain::Xml::EFormat1Qcow2, "qcow2"));
-}
-
-template<>
-Enum<Domain::Xml::EDev>::data_type Enum<Domain::Xml::EDev>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EDevHd, "hd"))
-			(data_type::value_type(Domain::Xml::EDevFd, "fd"))
-			(data_type::value_type(Domain::Xml::EDevCdrom, "cdrom"))
-			(data_type::value_type(Domain::Xml::EDevNetwork, "network"));
-}
-
-template<>
-Enum<Domain::Xml::EMode3>::data_type Enum<Domain::Xml::EMode3>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMode3Emulate, "emulate"))
-			(data_type::value_type(Domain::Xml::EMode3Host, "host"))
-			(data_type::value_type(Domain::Xml::EMode3Sysinfo, "sysinfo"));
-}
-
-template<>
-Enum<Domain::Xml::EArch5>::data_type Enum<Domain::Xml::EArch5>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EArch5I686, "i686"))
-			(data_type::value_type(Domain::Xml::EArch5X8664, "x86_64"))
-			(data_type::value_type(Domain::Xml::EArch5Ppc, "ppc"))
-			(data_type::value_type(Domain::Xml::EArch5Ppc64, "ppc64"))
-			(data_type::value_type(Domain::Xml::EArch5Mips, "mips"))
-			(data_type::value_type(Domain::Xml::EArch5Sparc, "sparc"));
-}
-
-template<>
-Enum<Domain::Xml::EOffset>::data_type Enum<Domain::Xml::EOffset>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EOffsetLocaltime, "localtime"))
-			(data_type::value_type(Domain::Xml::EOffsetUtc, "utc"));
-}
-
-template<>
-Enum<Domain::Xml::EAdjustment>::data_type Enum<Domain::Xml::EAdjustment>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EAdjustmentReset, "reset"));
-}
-
-template<>
-Enum<Domain::Xml::EBasis>::data_type Enum<Domain::Xml::EBasis>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EBasisUtc, "utc"))
-			(data_type::value_type(Domain::Xml::EBasisLocaltime, "localtime"));
-}
-
-template<>
-Enum<Domain::Xml::EName>::data_type Enum<Domain::Xml::EName>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ENamePlatform, "platform"))
-			(data_type::value_type(Domain::Xml::ENameRtc, "rtc"));
-}
-
-template<>
-Enum<Domain::Xml::ETrack>::data_type Enum<Domain::Xml::ETrack>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ETrackBoot, "boot"))
-			(data_type::value_type(Domain::Xml::ETrackGuest, "guest"))
-			(data_type::value_type(Domain::Xml::ETrackWall, "wall"));
-}
-
-template<>
-Enum<Domain::Xml::ETickpolicy>::data_type Enum<Domain::Xml::ETickpolicy>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ETickpolicyDelay, "delay"))
-			(data_type::value_type(Domain::Xml::ETickpolicyMerge, "merge"))
-			(data_type::value_type(Domain::Xml::ETickpolicyDiscard, "discard"));
-}
-
-template<>
-Enum<Domain::Xml::EMode4>::data_type Enum<Domain::Xml::EMode4>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMode4Auto, "auto"))
-			(data_type::value_type(Domain::Xml::EMode4Native, "native"))
-			(data_type::value_type(Domain::Xml::EMode4Emulate, "emulate"))
-			(data_type::value_type(Domain::Xml::EMode4Paravirt, "paravirt"))
-			(data_type::value_type(Domain::Xml::EMode4Smpsafe, "smpsafe"));
-}
-
-template<>
-Enum<Domain::Xml::EName1>::data_type Enum<Domain::Xml::EName1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EName1Hpet, "hpet"))
-			(data_type::value_type(Domain::Xml::EName1Pit, "pit"));
-}
-
-template<>
-Enum<Domain::Xml::EName2>::data_type Enum<Domain::Xml::EName2>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EName2Kvmclock, "kvmclock"))
-			(data_type::value_type(Domain::Xml::EName2Hypervclock, "hypervclock"));
-}
-
-template<>
-Enum<Domain::Xml::EType5>::data_type Enum<Domain::Xml::EType5>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType5File, "file"))
-			(data_type::value_type(Domain::Xml::EType5Anonymous, "anonymous"))
-			(data_type::value_type(Domain::Xml::EType5Memfd, "memfd"));
-}
-
-template<>
-Enum<Domain::Xml::EMode5>::data_type Enum<Domain::Xml::EMode5>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMode5Shared, "shared"))
-			(data_type::value_type(Domain::Xml::EMode5Private, "private"));
-}
-
-template<>
-Enum<Domain::Xml::EMode6>::data_type Enum<Domain::Xml::EMode6>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMode6Immediate, "immediate"))
-			(data_type::value_type(Domain::Xml::EMode6Ondemand, "ondemand"));
-}
-
-template<>
-Enum<Domain::Xml::EPlacement>::data_type Enum<Domain::Xml::EPlacement>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EPlacementStatic, "static"))
-			(data_type::value_type(Domain::Xml::EPlacementAuto, "auto"));
-}
-
-template<>
-Enum<Domain::Xml::EScheduler>::data_type Enum<Domain::Xml::EScheduler>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ESchedulerBatch, "batch"))
-			(data_type::value_type(Domain::Xml::ESchedulerIdle, "idle"));
-}
-
-template<>
-Enum<Domain::Xml::EScheduler1>::data_type Enum<Domain::Xml::EScheduler1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EScheduler1Fifo, "fifo"))
-			(data_type::value_type(Domain::Xml::EScheduler1Rr, "rr"));
-}
-
-template<>
-Enum<Domain::Xml::EType6>::data_type Enum<Domain::Xml::EType6>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType6Both, "both"))
-			(data_type::value_type(Domain::Xml::EType6Code, "code"))
-			(data_type::value_type(Domain::Xml::EType6Data, "data"));
-}
-
-template<>
-Enum<Domain::Xml::EMode7>::data_type Enum<Domain::Xml::EMode7>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMode7Strict, "strict"))
-			(data_type::value_type(Domain::Xml::EMode7Preferred, "preferred"))
-			(data_type::value_type(Domain::Xml::EMode7Interleave, "interleave"));
-}
-
-template<>
-Enum<Domain::Xml::EMode8>::data_type Enum<Domain::Xml::EMode8>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMode8Strict, "strict"))
-			(data_type::value_type(Domain::Xml::EMode8Preferred, "preferred"))
-			(data_type::value_type(Domain::Xml::EMode8Interleave, "interleave"));
-}
-
-template<>
-Enum<Domain::Xml::EPolicy2>::data_type Enum<Domain::Xml::EPolicy2>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EPolicy2Default, "default"))
-			(data_type::value_type(Domain::Xml::EPolicy2Allow, "allow"))
-			(data_type::value_type(Domain::Xml::EPolicy2Deny, "deny"));
-}
-
-template<>
-Enum<Domain::Xml::EDriver>::data_type Enum<Domain::Xml::EDriver>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EDriverQemu, "qemu"))
-			(data_type::value_type(Domain::Xml::EDriverKvm, "kvm"));
-}
-
-template<>
-Enum<Domain::Xml::EResizing>::data_type Enum<Domain::Xml::EResizing>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EResizingEnabled, "enabled"))
-			(data_type::value_type(Domain::Xml::EResizingDisabled, "disabled"))
-			(data_type::value_type(Domain::Xml::EResizingRequired, "required"));
-}
-
-template<>
-Enum<Domain::Xml::EUnknown>::data_type Enum<Domain::Xml::EUnknown>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EUnknownIgnore, "ignore"))
-			(data_type::value_type(Domain::Xml::EUnknownFault, "fault"));
-}
-
-template<>
-Enum<Domain::Xml::EValue>::data_type Enum<Domain::Xml::EValue>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EValueBroken, "broken"))
-			(data_type::value_type(Domain::Xml::EValueWorkaround, "workaround"))
-			(data_type::value_type(Domain::Xml::EValueFixed, "fixed"));
-}
-
-template<>
-Enum<Domain::Xml::EValue1>::data_type Enum<Domain::Xml::EValue1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EValue1Broken, "broken"))
-			(data_type::value_type(Domain::Xml::EValue1Workaround, "workaround"))
-			(data_type::value_type(Domain::Xml::EValue1Fixed, "fixed"));
-}
-
-template<>
-Enum<Domain::Xml::EValue2>::data_type Enum<Domain::Xml::EValue2>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EValue2Broken, "broken"))
-			(data_type::value_type(Domain::Xml::EValue2Workaround, "workaround"))
-			(data_type::value_type(Domain::Xml::EValue2FixedIbs, "fixed-ibs"))
-			(data_type::value_type(Domain::Xml::EValue2FixedCcd, "fixed-ccd"))
-			(data_type::value_type(Domain::Xml::EValue2FixedNa, "fixed-na"));
-}
-
-template<>
-Enum<Domain::Xml::EOffOptions>::data_type Enum<Domain::Xml::EOffOptions>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EOffOptionsDestroy, "destroy"))
-			(data_type::value_type(Domain::Xml::EOffOptionsRestart, "restart"))
-			(data_type::value_type(Domain::Xml::EOffOptionsPreserve, "preserve"))
-			(data_type::value_type(Domain::Xml::EOffOptionsRenameRestart, "rename-restart"));
-}
-
-template<>
-Enum<Domain::Xml::ECrashOptions>::data_type Enum<Domain::Xml::ECrashOptions>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ECrashOptionsDestroy, "destroy"))
-			(data_type::value_type(Domain::Xml::ECrashOptionsRestart, "restart"))
-			(data_type::value_type(Domain::Xml::ECrashOptionsPreserve, "preserve"))
-			(data_type::value_type(Domain::Xml::ECrashOptionsRenameRestart, "rename-restart"))
-			(data_type::value_type(Domain::Xml::ECrashOptionsCoredumpDestroy, "coredump-destroy"))
-			(data_type::value_type(Domain::Xml::ECrashOptionsCoredumpRestart, "coredump-restart"));
-}
-
-template<>
-Enum<Domain::Xml::ELockfailureOptions>::data_type Enum<Domain::Xml::ELockfailureOptions>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ELockfailureOptionsPoweroff, "poweroff"))
-			(data_type::value_type(Domain::Xml::ELockfailureOptionsRestart, "restart"))
-			(data_type::value_type(Domain::Xml::ELockfailureOptionsPause, "pause"))
-			(data_type::value_type(Domain::Xml::ELockfailureOptionsIgnore, "ignore"));
-}
-
-template<>
-Enum<Domain::Xml::EName3>::data_type Enum<Domain::Xml::EName3>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EName3Cmt, "cmt"))
-			(data_type::value_type(Domain::Xml::EName3Mbmt, "mbmt"))
-			(data_type::value_type(Domain::Xml::EName3Mbml, "mbml"))
-			(data_type::value_type(Domain::Xml::EName3CpuCycles, "cpu_cycles"))
-			(data_type::value_type(Domain::Xml::EName3Instructions, "instructions"))
-			(data_type::value_type(Domain::Xml::EName3CacheReferences, "cache_references"))
-			(data_type::value_type(Domain::Xml::EName3CacheMisses, "cache_misses"))
-			(data_type::value_type(Domain::Xml::EName3BranchInstructions, "branch_instructions"))
-			(data_type::value_type(Domain::Xml::EName3BranchMisses, "branch_misses"))
-			(data_type::value_type(Domain::Xml::EName3BusCycles, "bus_cycles"))
-			(data_type::value_type(Domain::Xml::EName3StalledCyclesFrontend, "stalled_cycles_frontend"))
-			(data_type::value_type(Domain::Xml::EName3StalledCyclesBackend, "stalled_cycles_backend"))
-			(data_type::value_type(Domain::Xml::EName3RefCpuCycles, "ref_cpu_cycles"))
-			(data_type::value_type(Domain::Xml::EName3CpuClock, "cpu_clock"))
-			(data_type::value_type(Domain::Xml::EName3TaskClock, "task_clock"))
-			(data_type::value_type(Domain::Xml::EName3PageFaults, "page_faults"))
-			(data_type::value_type(Domain::Xml::EName3ContextSwitches, "context_switches"))
-			(data_type::value_type(Domain::Xml::EName3CpuMigrations, "cpu_migrations"))
-			(data_type::value_type(Domain::Xml::EName3PageFaultsMin, "page_faults_min"))
-			(data_type::value_type(Domain::Xml::EName3PageFaultsMaj, "page_faults_maj"))
-			(data_type::value_type(Domain::Xml::EName3AlignmentFaults, "alignment_faults"))
-			(data_type::value_type(Domain::Xml::EName3EmulationFaults, "emulation_faults"));
-}
-
-template<>
-Enum<Domain::Xml::EDevice>::data_type Enum<Domain::Xml::EDevice>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EDeviceFloppy, "floppy"))
-			(data_type::value_type(Domain::Xml::EDeviceDisk, "disk"))
-			(data_type::value_type(Domain::Xml::EDeviceCdrom, "cdrom"));
-}
-
-template<>
-Enum<Domain::Xml::EDevice1>::data_type Enum<Domain::Xml::EDevice1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EDevice1Lun, "lun"));
-}
-
-template<>
-Enum<Domain::Xml::ESgio>::data_type Enum<Domain::Xml::ESgio>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ESgioFiltered, "filtered"))
-			(data_type::value_type(Domain::Xml::ESgioUnfiltered, "unfiltered"))
-			(data_type::value_type(Domain::Xml::ESgioVirtioNonTransitional, "virtio-non-transitional"));
-}
-
-template<>
-Enum<Domain::Xml::ESnapshot>::data_type Enum<Domain::Xml::ESnapshot>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ESnapshotNo, "no"))
-			(data_type::value_type(Domain::Xml::ESnapshotInternal, "internal"))
-			(data_type::value_type(Domain::Xml::ESnapshotExternal, "external"));
-}
-
-template<>
-Enum<Domain::Xml::EType7>::data_type Enum<Domain::Xml::EType7>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType7Aio, "aio"));
-}
-
-template<>
-Enum<Domain::Xml::EStorageFormat>::data_type Enum<Domain::Xml::EStorageFormat>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EStorageFormatRaw, "raw"))
-			(data_type::value_type(Domain::Xml::EStorageFormatDir, "dir"))
-			(data_type::value_type(Domain::Xml::EStorageFormatBochs, "bochs"))
-			(data_type::value_type(Domain::Xml::EStorageFormatCloop, "cloop"))
-			(data_type::value_type(Domain::Xml::EStorageFormatDmg, "dmg"))
-			(data_type::value_type(Domain::Xml::EStorageFormatIso, "iso"))
-			(data_type::value_type(Domain::Xml::EStorageFormatVpc, "vpc"))
-			(data_type::value_type(Domain::Xml::EStorageFormatVdi, "vdi"))
-			(data_type::value_type(Domain::Xml::EStorageFormatFat, "fat"))
-			(data_type::value_type(Domain::Xml::EStorageFormatVhd, "vhd"))
-			(data_type::value_type(Domain::Xml::EStorageFormatPloop, "ploop"))
-			(data_type::value_type(Domain::Xml::EStorageFormatLuks, "luks"));
-}
-
-template<>
-Enum<Domain::Xml::EStorageFormatBacking>::data_type Enum<Domain::Xml::EStorageFormatBacking>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EStorageFormatBackingCow, "cow"))
-			(data_type::value_type(Domain::Xml::EStorageFormatBackingQcow, "qcow"))
-			(data_type::value_type(Domain::Xml::EStorageFormatBackingQcow2, "qcow2"))
-			(data_type::value_type(Domain::Xml::EStorageFormatBackingQed, "qed"))
-			(data_type::value_type(Domain::Xml::EStorageFormatBackingVmdk, "vmdk"));
-}
-
-template<>
-Enum<Domain::Xml::ECache>::data_type Enum<Domain::Xml::ECache>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ECacheNone, "none"))
-			(data_type::value_type(Domain::Xml::ECacheWriteback, "writeback"))
-			(data_type::value_type(Domain::Xml::ECacheWritethrough, "writethrough"))
-			(data_type::value_type(Domain::Xml::ECacheDirectsync, "directsync"))
-			(data_type::value_type(Domain::Xml::ECacheUnsafe, "unsafe"));
-}
-
-template<>
-Enum<Domain::Xml::EErrorPolicy>::data_type Enum<Domain::Xml::EErrorPolicy>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EErrorPolicyStop, "stop"))
-			(data_type::value_type(Domain::Xml::EErrorPolicyReport, "report"))
-			(data_type::value_type(Domain::Xml::EErrorPolicyIgnore, "ignore"))
-			(data_type::value_type(Domain::Xml::EErrorPolicyEnospace, "enospace"));
-}
-
-template<>
-Enum<Domain::Xml::ERerrorPolicy>::data_type Enum<Domain::Xml::ERerrorPolicy>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ERerrorPolicyStop, "stop"))
-			(data_type::value_type(Domain::Xml::ERerrorPolicyReport, "report"))
-			(data_type::value_type(Domain::Xml::ERerrorPolicyIgnore, "ignore"));
-}
-
-template<>
-Enum<Domain::Xml::EIo>::data_type Enum<Domain::Xml::EIo>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EIoThreads, "threads"))
-			(data_type::value_type(Domain::Xml::EIoNative, "native"));
-}
-
-template<>
-Enum<Domain::Xml::EDiscard>::data_type Enum<Domain::Xml::EDiscard>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EDiscardUnmap, "unmap"))
-			(data_type::value_type(Domain::Xml::EDiscardIgnore, "ignore"));
-}
-
-template<>
-Enum<Domain::Xml::EDetectZeroes>::data_type Enum<Domain::Xml::EDetectZeroes>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EDetectZeroesOff, "off"))
-			(data_type::value_type(Domain::Xml::EDetectZeroesOn, "on"))
-			(data_type::value_type(Domain::Xml::EDetectZeroesUnmap, "unmap"));
-}
-
-template<>
-Enum<Domain::Xml::EJob>::data_type Enum<Domain::Xml::EJob>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EJobCopy, "copy"));
-}
-
-template<>
-Enum<Domain::Xml::EJob1>::data_type Enum<Domain::Xml::EJob1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EJob1Copy, "copy"))
-			(data_type::value_type(Domain::Xml::EJob1ActiveCommit, "active-commit"));
-}
-
-template<>
-Enum<Domain::Xml::EReady>::data_type Enum<Domain::Xml::EReady>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EReadyYes, "yes"))
-			(data_type::value_type(Domain::Xml::EReadyAbort, "abort"))
-			(data_type::value_type(Domain::Xml::EReadyPivot, "pivot"));
-}
-
-template<>
-Enum<Domain::Xml::EType8>::data_type Enum<Domain::Xml::EType8>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType8Ceph, "ceph"))
-			(data_type::value_type(Domain::Xml::EType8Iscsi, "iscsi"));
-}
-
-template<>
-Enum<Domain::Xml::EBus>::data_type Enum<Domain::Xml::EBus>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EBusIde, "ide"))
-			(data_type::value_type(Domain::Xml::EBusFdc, "fdc"))
-			(data_type::value_type(Domain::Xml::EBusScsi, "scsi"))
-			(data_type::value_type(Domain::Xml::EBusVirtio, "virtio"))
-			(data_type::value_type(Domain::Xml::EBusXen, "xen"))
-			(data_type::value_type(Domain::Xml::EBusUsb, "usb"))
-			(data_type::value_type(Domain::Xml::EBusUml, "uml"))
-			(data_type::value_type(Domain::Xml::EBusSata, "sata"))
-			(data_type::value_type(Domain::Xml::EBusSd, "sd"));
-}
-
-template<>
-Enum<Domain::Xml::ETray>::data_type Enum<Domain::Xml::ETray>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ETrayOpen, "open"))
-			(data_type::value_type(Domain::Xml::ETrayClosed, "closed"));
-}
-
-template<>
-Enum<Domain::Xml::ETrans>::data_type Enum<Domain::Xml::ETrans>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ETransAuto, "auto"))
-			(data_type::value_type(Domain::Xml::ETransNone, "none"))
-			(data_type::value_type(Domain::Xml::ETransLba, "lba"));
-}
-
-template<>
-Enum<Domain::Xml::EType9>::data_type Enum<Domain::Xml::EType9>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType9Fdc, "fdc"))
-			(data_type::value_type(Domain::Xml::EType9Ide, "ide"))
-			(data_type::value_type(Domain::Xml::EType9Sata, "sata"))
-			(data_type::value_type(Domain::Xml::EType9Ccid, "ccid"));
-}
-
-template<>
-Enum<Domain::Xml::EModel>::data_type Enum<Domain::Xml::EModel>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModelAuto, "auto"))
-			(data_type::value_type(Domain::Xml::EModelBuslogic, "buslogic"))
-			(data_type::value_type(Domain::Xml::EModelLsilogic, "lsilogic"))
-			(data_type::value_type(Domain::Xml::EModelLsisas1068, "lsisas1068"))
-			(data_type::value_type(Domain::Xml::EModelVmpvscsi, "vmpvscsi"))
-			(data_type::value_type(Domain::Xml::EModelIbmvscsi, "ibmvscsi"))
-			(data_type::value_type(Domain::Xml::EModelVirtioScsi, "virtio-scsi"))
-			(data_type::value_type(Domain::Xml::EModelLsisas1078, "lsisas1078"))
-			(data_type::value_type(Domain::Xml::EModelVirtioTransitional, "virtio-transitional"))
-			(data_type::value_type(Domain::Xml::EModelVirtioNonTransitional, "virtio-non-transitional"))
-			(data_type::value_type(Domain::Xml::EModelNcr53c90, "ncr53c90"))
-			(data_type::value_type(Domain::Xml::EModelDc390, "dc390"))
-			(data_type::value_type(Domain::Xml::EModelAm53c974, "am53c974"))
-			(data_type::value_type(Domain::Xml::EModelHvScsi, "hv-scsi"));
-}
-
-template<>
-Enum<Domain::Xml::EModel1>::data_type Enum<Domain::Xml::EModel1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel1Piix3Uhci, "piix3-uhci"))
-			(data_type::value_type(Domain::Xml::EModel1Piix4Uhci, "piix4-uhci"))
-			(data_type::value_type(Domain::Xml::EModel1Ehci, "ehci"))
-			(data_type::value_type(Domain::Xml::EModel1Ich9Ehci1, "ich9-ehci1"))
-			(data_type::value_type(Domain::Xml::EModel1Ich9Uhci1, "ich9-uhci1"))
-			(data_type::value_type(Domain::Xml::EModel1Ich9Uhci2, "ich9-uhci2"))
-			(data_type::value_type(Domain::Xml::EModel1Ich9Uhci3, "ich9-uhci3"))
-			(data_type::value_type(Domain::Xml::EModel1Vt82c686bUhci, "vt82c686b-uhci"))
-			(data_type::value_type(Domain::Xml::EModel1PciOhci, "pci-ohci"))
-			(data_type::value_type(Domain::Xml::EModel1NecXhci, "nec-xhci"))
-			(data_type::value_type(Domain::Xml::EModel1None, "none"))
-			(data_type::value_type(Domain::Xml::EModel1Qusb1, "qusb1"))
-			(data_type::value_type(Domain::Xml::EModel1Qusb2, "qusb2"))
-			(data_type::value_type(Domain::Xml::EModel1QemuXhci, "qemu-xhci"));
-}
-
-template<>
-Enum<Domain::Xml::EModel2>::data_type Enum<Domain::Xml::EModel2>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel2Piix3, "piix3"))
-			(data_type::value_type(Domain::Xml::EModel2Piix4, "piix4"))
-			(data_type::value_type(Domain::Xml::EModel2Ich6, "ich6"));
-}
-
-template<>
-Enum<Domain::Xml::EName4>::data_type Enum<Domain::Xml::EName4>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EName4SpaprPciHostBridge, "spapr-pci-host-bridge"))
-			(data_type::value_type(Domain::Xml::EName4PciBridge, "pci-bridge"))
-			(data_type::value_type(Domain::Xml::EName4I82801b11Bridge, "i82801b11-bridge"))
-			(data_type::value_type(Domain::Xml::EName4PciePciBridge, "pcie-pci-bridge"))
-			(data_type::value_type(Domain::Xml::EName4Ioh3420, "ioh3420"))
-			(data_type::value_type(Domain::Xml::EName4PcieRootPort, "pcie-root-port"))
-			(data_type::value_type(Domain::Xml::EName4X3130Upstream, "x3130-upstream"))
-			(data_type::value_type(Domain::Xml::EName4Xio3130Downstream, "xio3130-downstream"))
-			(data_type::value_type(Domain::Xml::EName4Pxb, "pxb"))
-			(data_type::value_type(Domain::Xml::EName4PxbPcie, "pxb-pcie"));
-}
-
-template<>
-Enum<Domain::Xml::EModel3>::data_type Enum<Domain::Xml::EModel3>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel3PciRoot, "pci-root"))
-			(data_type::value_type(Domain::Xml::EModel3PcieRoot, "pcie-root"));
-}
-
-template<>
-Enum<Domain::Xml::EModel4>::data_type Enum<Domain::Xml::EModel4>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel4PciBridge, "pci-bridge"))
-			(data_type::value_type(Domain::Xml::EModel4DmiToPciBridge, "dmi-to-pci-bridge"))
-			(data_type::value_type(Domain::Xml::EModel4PcieToPciBridge, "pcie-to-pci-bridge"))
-			(data_type::value_type(Domain::Xml::EModel4PcieRootPort, "pcie-root-port"))
-			(data_type::value_type(Domain::Xml::EModel4PcieSwitchUpstreamPort, "pcie-switch-upstream-port"))
-			(data_type::value_type(Domain::Xml::EModel4PcieSwitchDownstreamPort, "pcie-switch-downstream-port"))
-			(data_type::value_type(Domain::Xml::EModel4PciExpanderBus, "pci-expander-bus"))
-			(data_type::value_type(Domain::Xml::EModel4PcieExpanderBus, "pcie-expander-bus"));
-}
-
-template<>
-Enum<Domain::Xml::EModel5>::data_type Enum<Domain::Xml::EModel5>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel5Virtio, "virtio"))
-			(data_type::value_type(Domain::Xml::EModel5VirtioTransitional, "virtio-transitional"))
-			(data_type::value_type(Domain::Xml::EModel5VirtioNonTransitional, "virtio-non-transitional"));
-}
-
-template<>
-Enum<Domain::Xml::EType10>::data_type Enum<Domain::Xml::EType10>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType10Path, "path"))
-			(data_type::value_type(Domain::Xml::EType10Handle, "handle"))
-			(data_type::value_type(Domain::Xml::EType10Loop, "loop"))
-			(data_type::value_type(Domain::Xml::EType10Nbd, "nbd"))
-			(data_type::value_type(Domain::Xml::EType10Ploop, "ploop"));
-}
-
-template<>
-Enum<Domain::Xml::EAccessmode>::data_type Enum<Domain::Xml::EAccessmode>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EAccessmodePassthrough, "passthrough"))
-			(data_type::value_type(Domain::Xml::EAccessmodeMapped, "mapped"))
-			(data_type::value_type(Domain::Xml::EAccessmodeSquash, "squash"));
-}
-
-template<>
-Enum<Domain::Xml::EMultidevs>::data_type Enum<Domain::Xml::EMultidevs>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMultidevsDefault, "default"))
-			(data_type::value_type(Domain::Xml::EMultidevsRemap, "remap"))
-			(data_type::value_type(Domain::Xml::EMultidevsForbid, "forbid"))
-			(data_type::value_type(Domain::Xml::EMultidevsWarn, "warn"));
-}
-
-template<>
-Enum<Domain::Xml::EModel6>::data_type Enum<Domain::Xml::EModel6>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel6Virtio, "virtio"))
-			(data_type::value_type(Domain::Xml::EModel6VirtioTransitional, "virtio-transitional"))
-			(data_type::value_type(Domain::Xml::EModel6VirtioNonTransitional, "virtio-non-transitional"));
-}
-
-template<>
-Enum<Domain::Xml::EMacTableManager>::data_type Enum<Domain::Xml::EMacTableManager>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMacTableManagerKernel, "kernel"))
-			(data_type::value_type(Domain::Xml::EMacTableManagerLibvirt, "libvirt"));
-}
-
-template<>
-Enum<Domain::Xml::EState>::data_type Enum<Domain::Xml::EState>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EStateUp, "up"))
-			(data_type::value_type(Domain::Xml::EStateDown, "down"));
-}
-
-template<>
-Enum<Domain::Xml::EName5>::data_type Enum<Domain::Xml::EName5>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EName5Kvm, "kvm"))
-			(data_type::value_type(Domain::Xml::EName5Vfio, "vfio"));
-}
-
-template<>
-Enum<Domain::Xml::EName6>::data_type Enum<Domain::Xml::EName6>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EName6Qemu, "qemu"))
-			(data_type::value_type(Domain::Xml::EName6Vhost, "vhost"));
-}
-
-template<>
-Enum<Domain::Xml::ETxmode>::data_type Enum<Domain::Xml::ETxmode>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ETxmodeIothread, "iothread"))
-			(data_type::value_type(Domain::Xml::ETxmodeTimer, "timer"));
-}
-
-template<>
-Enum<Domain::Xml::ENativeMode>::data_type Enum<Domain::Xml::ENativeMode>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ENativeModeTagged, "tagged"))
-			(data_type::value_type(Domain::Xml::ENativeModeUntagged, "untagged"));
-}
-
-template<>
-Enum<Domain::Xml::EType11>::data_type Enum<Domain::Xml::EType11>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType11Unix, "unix"));
-}
-
-template<>
-Enum<Domain::Xml::EMode9>::data_type Enum<Domain::Xml::EMode9>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMode9Server, "server"))
-			(data_type::value_type(Domain::Xml::EMode9Client, "client"));
-}
-
-template<>
-Enum<Domain::Xml::EType12>::data_type Enum<Domain::Xml::EType12>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType12Mcast, "mcast"))
-			(data_type::value_type(Domain::Xml::EType12Client, "client"));
-}
-
-template<>
-Enum<Domain::Xml::EType13>::data_type Enum<Domain::Xml::EType13>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType13Tablet, "tablet"))
-			(data_type::value_type(Domain::Xml::EType13Mouse, "mouse"))
-			(data_type::value_type(Domain::Xml::EType13Keyboard, "keyboard"));
-}
-
-template<>
-Enum<Domain::Xml::EBus1>::data_type Enum<Domain::Xml::EBus1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EBus1Ps2, "ps2"))
-			(data_type::value_type(Domain::Xml::EBus1Usb, "usb"))
-			(data_type::value_type(Domain::Xml::EBus1Xen, "xen"));
-}
-
-template<>
-Enum<Domain::Xml::EModel7>::data_type Enum<Domain::Xml::EModel7>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel7Virtio, "virtio"))
-			(data_type::value_type(Domain::Xml::EModel7VirtioTransitional, "virtio-transitional"))
-			(data_type::value_type(Domain::Xml::EModel7VirtioNonTransitional, "virtio-non-transitional"));
-}
-
-template<>
-Enum<Domain::Xml::EModel8>::data_type Enum<Domain::Xml::EModel8>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel8Sb16, "sb16"))
-			(data_type::value_type(Domain::Xml::EModel8Es1370, "es1370"))
-			(data_type::value_type(Domain::Xml::EModel8Pcspk, "pcspk"))
-			(data_type::value_type(Domain::Xml::EModel8Ac97, "ac97"))
-			(data_type::value_type(Domain::Xml::EModel8Ich6, "ich6"))
-			(data_type::value_type(Domain::Xml::EModel8Ich9, "ich9"))
-			(data_type::value_type(Domain::Xml::EModel8Usb, "usb"));
-}
-
-template<>
-Enum<Domain::Xml::EType14>::data_type Enum<Domain::Xml::EType14>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType14Duplex, "duplex"))
-			(data_type::value_type(Domain::Xml::EType14Micro, "micro"));
-}
-
-template<>
-Enum<Domain::Xml::EName7>::data_type Enum<Domain::Xml::EName7>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EName7Kvm, "kvm"))
-			(data_type::value_type(Domain::Xml::EName7Vfio, "vfio"))
-			(data_type::value_type(Domain::Xml::EName7Xen, "xen"));
-}
-
-template<>
-Enum<Domain::Xml::ESgio1>::data_type Enum<Domain::Xml::ESgio1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ESgio1Filtered, "filtered"))
-			(data_type::value_type(Domain::Xml::ESgio1Unfiltered, "unfiltered"));
-}
-
-template<>
-Enum<Domain::Xml::EProtocol1>::data_type Enum<Domain::Xml::EProtocol1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EProtocol1Adapter, "adapter"));
-}
-
-template<>
-Enum<Domain::Xml::EProtocol2>::data_type Enum<Domain::Xml::EProtocol2>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EProtocol2Iscsi, "iscsi"));
-}
-
-template<>
-Enum<Domain::Xml::ESharePolicy>::data_type Enum<Domain::Xml::ESharePolicy>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ESharePolicyAllowExclusive, "allow-exclusive"))
-			(data_type::value_type(Domain::Xml::ESharePolicyForceShared, "force-shared"))
-			(data_type::value_type(Domain::Xml::ESharePolicyIgnore, "ignore"));
-}
-
-template<>
-Enum<Domain::Xml::EConnected>::data_type Enum<Domain::Xml::EConnected>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EConnectedKeep, "keep"));
-}
-
-template<>
-Enum<Domain::Xml::EConnected1>::data_type Enum<Domain::Xml::EConnected1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EConnected1Fail, "fail"))
-			(data_type::value_type(Domain::Xml::EConnected1Disconnect, "disconnect"))
-			(data_type::value_type(Domain::Xml::EConnected1Keep, "keep"));
-}
-
-template<>
-Enum<Domain::Xml::EDefaultMode>::data_type Enum<Domain::Xml::EDefaultMode>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EDefaultModeAny, "any"))
-			(data_type::value_type(Domain::Xml::EDefaultModeSecure, "secure"))
-			(data_type::value_type(Domain::Xml::EDefaultModeInsecure, "insecure"));
-}
-
-template<>
-Enum<Domain::Xml::EName8>::data_type Enum<Domain::Xml::EName8>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EName8Main, "main"))
-			(data_type::value_type(Domain::Xml::EName8Display, "display"))
-			(data_type::value_type(Domain::Xml::EName8Inputs, "inputs"))
-			(data_type::value_type(Domain::Xml::EName8Cursor, "cursor"))
-			(data_type::value_type(Domain::Xml::EName8Playback, "playback"))
-			(data_type::value_type(Domain::Xml::EName8Record, "record"))
-			(data_type::value_type(Domain::Xml::EName8Smartcard, "smartcard"))
-			(data_type::value_type(Domain::Xml::EName8Usbredir, "usbredir"));
-}
-
-template<>
-Enum<Domain::Xml::EMode10>::data_type Enum<Domain::Xml::EMode10>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMode10Any, "any"))
-			(data_type::value_type(Domain::Xml::EMode10Secure, "secure"))
-			(data_type::value_type(Domain::Xml::EMode10Insecure, "insecure"));
-}
-
-template<>
-Enum<Domain::Xml::ECompression>::data_type Enum<Domain::Xml::ECompression>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ECompressionAutoGlz, "auto_glz"))
-			(data_type::value_type(Domain::Xml::ECompressionAutoLz, "auto_lz"))
-			(data_type::value_type(Domain::Xml::ECompressionQuic, "quic"))
-			(data_type::value_type(Domain::Xml::ECompressionGlz, "glz"))
-			(data_type::value_type(Domain::Xml::ECompressionLz, "lz"))
-			(data_type::value_type(Domain::Xml::ECompressionOff, "off"));
-}
-
-template<>
-Enum<Domain::Xml::ECompression1>::data_type Enum<Domain::Xml::ECompression1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ECompression1Auto, "auto"))
-			(data_type::value_type(Domain::Xml::ECompression1Never, "never"))
-			(data_type::value_type(Domain::Xml::ECompression1Always, "always"));
-}
-
-template<>
-Enum<Domain::Xml::ECompression2>::data_type Enum<Domain::Xml::ECompression2>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::ECompression2Auto, "auto"))
-			(data_type::value_type(Domain::Xml::ECompression2Never, "never"))
-			(data_type::value_type(Domain::Xml::ECompression2Always, "always"));
-}
-
-template<>
-Enum<Domain::Xml::EMode11>::data_type Enum<Domain::Xml::EMode11>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMode11Filter, "filter"))
-			(data_type::value_type(Domain::Xml::EMode11All, "all"))
-			(data_type::value_type(Domain::Xml::EMode11Off, "off"));
-}
-
-template<>
-Enum<Domain::Xml::EMode12>::data_type Enum<Domain::Xml::EMode12>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EMode12Server, "server"))
-			(data_type::value_type(Domain::Xml::EMode12Client, "client"));
-}
-
-template<>
-Enum<Domain::Xml::EName9>::data_type Enum<Domain::Xml::EName9>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EName9Qemu, "qemu"))
-			(data_type::value_type(Domain::Xml::EName9Vhostuser, "vhostuser"));
-}
-
-template<>
-Enum<Domain::Xml::EVgaconf>::data_type Enum<Domain::Xml::EVgaconf>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EVgaconfIo, "io"))
-			(data_type::value_type(Domain::Xml::EVgaconfOn, "on"))
-			(data_type::value_type(Domain::Xml::EVgaconfOff, "off"));
-}
-
-template<>
-Enum<Domain::Xml::EType15>::data_type Enum<Domain::Xml::EType15>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType15Vga, "vga"))
-			(data_type::value_type(Domain::Xml::EType15Cirrus, "cirrus"))
-			(data_type::value_type(Domain::Xml::EType15Vmvga, "vmvga"))
-			(data_type::value_type(Domain::Xml::EType15Xen, "xen"))
-			(data_type::value_type(Domain::Xml::EType15Vbox, "vbox"))
-			(data_type::value_type(Domain::Xml::EType15Virtio, "virtio"))
-			(data_type::value_type(Domain::Xml::EType15Vzct, "vzct"))
-			(data_type::value_type(Domain::Xml::EType15Gop, "gop"))
-			(data_type::value_type(Domain::Xml::EType15None, "none"))
-			(data_type::value_type(Domain::Xml::EType15Bochs, "bochs"))
-			(data_type::value_type(Domain::Xml::EType15Ramfb, "ramfb"));
-}
-
-template<>
-Enum<Domain::Xml::EQemucdevSrcTypeChoice>::data_type Enum<Domain::Xml::EQemucdevSrcTypeChoice>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EQemucdevSrcTypeChoiceDev, "dev"))
-			(data_type::value_type(Domain::Xml::EQemucdevSrcTypeChoiceFile, "file"))
-			(data_type::value_type(Domain::Xml::EQemucdevSrcTypeChoicePipe, "pipe"))
-			(data_type::value_type(Domain::Xml::EQemucdevSrcTypeChoiceUnix, "unix"))
-			(data_type::value_type(Domain::Xml::EQemucdevSrcTypeChoiceTcp, "tcp"))
-			(data_type::value_type(Domain::Xml::EQemucdevSrcTypeChoiceUdp, "udp"))
-			(data_type::value_type(Domain::Xml::EQemucdevSrcTypeChoiceNull, "null"))
-			(data_type::value_type(Domain::Xml::EQemucdevSrcTypeChoiceStdio, "stdio"))
-			(data_type::value_type(Domain::Xml::EQemucdevSrcTypeChoiceVc, "vc"))
-			(data_type::value_type(Domain::Xml::EQemucdevSrcTypeChoicePty, "pty"))
-			(data_type::value_type(Domain::Xml::EQemucdevSrcTypeChoiceSpicevmc, "spicevmc"))
-			(data_type::value_type(Domain::Xml::EQemucdevSrcTypeChoiceSpiceport, "spiceport"))
-			(data_type::value_type(Domain::Xml::EQemucdevSrcTypeChoiceNmdm, "nmdm"));
-}
-
-template<>
-Enum<Domain::Xml::EType16>::data_type Enum<Domain::Xml::EType16>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType16Raw, "raw"))
-			(data_type::value_type(Domain::Xml::EType16Telnet, "telnet"))
-			(data_type::value_type(Domain::Xml::EType16Telnets, "telnets"))
-			(data_type::value_type(Domain::Xml::EType16Tls, "tls"));
-}
-
-template<>
-Enum<Domain::Xml::EType17>::data_type Enum<Domain::Xml::EType17>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType17Xen, "xen"))
-			(data_type::value_type(Domain::Xml::EType17Serial, "serial"))
-			(data_type::value_type(Domain::Xml::EType17Uml, "uml"))
-			(data_type::value_type(Domain::Xml::EType17Virtio, "virtio"))
-			(data_type::value_type(Domain::Xml::EType17Lxc, "lxc"))
-			(data_type::value_type(Domain::Xml::EType17Openvz, "openvz"))
-			(data_type::value_type(Domain::Xml::EType17Sclp, "sclp"))
-			(data_type::value_type(Domain::Xml::EType17Sclplm, "sclplm"));
-}
-
-template<>
-Enum<Domain::Xml::EType18>::data_type Enum<Domain::Xml::EType18>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EType18IsaSerial, "isa-serial"))
-			(data_type::value_type(Domain::Xml::EType18UsbSerial, "usb-serial"));
-}
-
-template<>
-Enum<Domain::Xml::EName10>::data_type Enum<Domain::Xml::EName10>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EName10IsaSerial, "isa-serial"))
-			(data_type::value_type(Domain::Xml::EName10UsbSerial, "usb-serial"))
-			(data_type::value_type(Domain::Xml::EName10PciSerial, "pci-serial"))
-			(data_type::value_type(Domain::Xml::EName10SpaprVty, "spapr-vty"))
-			(data_type::value_type(Domain::Xml::EName10Pl011, "pl011"))
-			(data_type::value_type(Domain::Xml::EName10Sclpconsole, "sclpconsole"))
-			(data_type::value_type(Domain::Xml::EName10Sclplmconsole, "sclplmconsole"));
-}
-
-template<>
-Enum<Domain::Xml::EState1>::data_type Enum<Domain::Xml::EState1>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EState1Connected, "connected"))
-			(data_type::value_type(Domain::Xml::EState1Disconnected, "disconnected"));
-}
-
-template<>
-Enum<Domain::Xml::EModel9>::data_type Enum<Domain::Xml::EModel9>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel9Virtio, "virtio"))
-			(data_type::value_type(Domain::Xml::EModel9VirtioTransitional, "virtio-transitional"))
-			(data_type::value_type(Domain::Xml::EModel9VirtioNonTransitional, "virtio-non-transitional"));
-}
-
-template<>
-Enum<Domain::Xml::EModel10>::data_type Enum<Domain::Xml::EModel10>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel10TpmTis, "tpm-tis"))
-			(data_type::value_type(Domain::Xml::EModel10TpmCrb, "tpm-crb"));
-}
-
-template<>
-Enum<Domain::Xml::EVersion>::data_type Enum<Domain::Xml::EVersion>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EVersion12, "1.2"))
-			(data_type::value_type(Domain::Xml::EVersion20, "2.0"));
-}
-
-template<>
-Enum<Domain::Xml::EModel11>::data_type Enum<Domain::Xml::EModel11>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel11Dimm, "dimm"));
-}
-
-template<>
-Enum<Domain::Xml::EAccess>::data_type Enum<Domain::Xml::EAccess>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EAccessShared, "shared"))
-			(data_type::value_type(Domain::Xml::EAccessPrivate, "private"));
-}
-
-template<>
-Enum<Domain::Xml::EModel12>::data_type Enum<Domain::Xml::EModel12>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel12I6300esb, "i6300esb"))
-			(data_type::value_type(Domain::Xml::EModel12Ib700, "ib700"));
-}
-
-template<>
-Enum<Domain::Xml::EAction>::data_type Enum<Domain::Xml::EAction>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EActionReset, "reset"))
-			(data_type::value_type(Domain::Xml::EActionShutdown, "shutdown"))
-			(data_type::value_type(Domain::Xml::EActionPoweroff, "poweroff"))
-			(data_type::value_type(Domain::Xml::EActionPause, "pause"))
-			(data_type::value_type(Domain::Xml::EActionNone, "none"))
-			(data_type::value_type(Domain::Xml::EActionDump, "dump"));
-}
-
-template<>
-Enum<Domain::Xml::EModel13>::data_type Enum<Domain::Xml::EModel13>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel13Virtio, "virtio"))
-			(data_type::value_type(Domain::Xml::EModel13VirtioTransitional, "virtio-transitional"))
-			(data_type::value_type(Domain::Xml::EModel13VirtioNonTransitional, "virtio-non-transitional"))
-			(data_type::value_type(Domain::Xml::EModel13Xen, "xen"))
-			(data_type::value_type(Domain::Xml::EModel13None, "none"));
-}
-
-template<>
-Enum<Domain::Xml::EModel14>::data_type Enum<Domain::Xml::EModel14>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EModel14Isa, "isa"))
-			(data_type::value_type(Domain::Xml::EModel14Pseries, "pseries"))
-			(data_type::value_type(Domain::Xml::EModel14Hyperv, "hyperv"));
-}
-
-template<>
-Enum<Domain::Xml::EName11>::data_type Enum<Domain::Xml::EName11>::getData()
-{
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Domain::Xml::EName11Aes, "aes"))
-			(data_type::value_type(Domain::Xml::EName11Dea, "dea"));
+QString Enum<Domain::Xml::EType>::getText(Domain::Xml::EType value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ETypeQemu:
+		return QStringLiteral("qemu");
+	case Domain::Xml::ETypeKqemu:
+		return QStringLiteral("kqemu");
+	case Domain::Xml::ETypeKvm:
+		return QStringLiteral("kvm");
+	case Domain::Xml::ETypeXen:
+		return QStringLiteral("xen");
+	case Domain::Xml::ETypeLxc:
+		return QStringLiteral("lxc");
+	case Domain::Xml::ETypeUml:
+		return QStringLiteral("uml");
+	case Domain::Xml::ETypeOpenvz:
+		return QStringLiteral("openvz");
+	case Domain::Xml::ETypeTest:
+		return QStringLiteral("test");
+	case Domain::Xml::ETypeVmware:
+		return QStringLiteral("vmware");
+	case Domain::Xml::ETypeHyperv:
+		return QStringLiteral("hyperv");
+	case Domain::Xml::ETypeVbox:
+		return QStringLiteral("vbox");
+	case Domain::Xml::ETypePhyp:
+		return QStringLiteral("phyp");
+	case Domain::Xml::ETypeVirtuozzo:
+		return QStringLiteral("virtuozzo");
+	case Domain::Xml::ETypeBhyve:
+		return QStringLiteral("bhyve");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'k':
+			if (text_ == QLatin1String("kvm"))
+				return Domain::Xml::ETypeKvm;
+			break;
+		case 'l':
+			if (text_ == QLatin1String("lxc"))
+				return Domain::Xml::ETypeLxc;
+			break;
+		case 'u':
+			if (text_ == QLatin1String("uml"))
+				return Domain::Xml::ETypeUml;
+			break;
+		case 'x':
+			if (text_ == QLatin1String("xen"))
+				return Domain::Xml::ETypeXen;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("phyp"))
+				return Domain::Xml::ETypePhyp;
+			break;
+		case 'q':
+			if (text_ == QLatin1String("qemu"))
+				return Domain::Xml::ETypeQemu;
+			break;
+		case 't':
+			if (text_ == QLatin1String("test"))
+				return Domain::Xml::ETypeTest;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("vbox"))
+				return Domain::Xml::ETypeVbox;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("bhyve"))
+				return Domain::Xml::ETypeBhyve;
+			break;
+		case 'k':
+			if (text_ == QLatin1String("kqemu"))
+				return Domain::Xml::ETypeKqemu;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("hyperv"))
+				return Domain::Xml::ETypeHyperv;
+			break;
+		case 'o':
+			if (text_ == QLatin1String("openvz"))
+				return Domain::Xml::ETypeOpenvz;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("vmware"))
+				return Domain::Xml::ETypeVmware;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtuozzo"))
+				return Domain::Xml::ETypeVirtuozzo;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMode>::getText(Domain::Xml::EMode value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModeCustom:
+		return QStringLiteral("custom");
+	case Domain::Xml::EModeHostModel:
+		return QStringLiteral("host-model");
+	case Domain::Xml::EModeHostPassthrough:
+		return QStringLiteral("host-passthrough");
+	case Domain::Xml::EModeMaximum:
+		return QStringLiteral("maximum");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMode>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("custom"))
+				return Domain::Xml::EModeCustom;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("maximum"))
+				return Domain::Xml::EModeMaximum;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("host-model"))
+				return Domain::Xml::EModeHostModel;
+			break;
+		}
+		break;
+	case 16:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("host-passthrough"))
+				return Domain::Xml::EModeHostPassthrough;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMatch>::getText(Domain::Xml::EMatch value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMatchMinimum:
+		return QStringLiteral("minimum");
+	case Domain::Xml::EMatchExact:
+		return QStringLiteral("exact");
+	case Domain::Xml::EMatchStrict:
+		return QStringLiteral("strict");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMatch>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'e':
+			if (text_ == QLatin1String("exact"))
+				return Domain::Xml::EMatchExact;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("strict"))
+				return Domain::Xml::EMatchStrict;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("minimum"))
+				return Domain::Xml::EMatchMinimum;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ECheck>::getText(Domain::Xml::ECheck value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ECheckNone:
+		return QStringLiteral("none");
+	case Domain::Xml::ECheckPartial:
+		return QStringLiteral("partial");
+	case Domain::Xml::ECheckFull:
+		return QStringLiteral("full");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ECheck>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("full"))
+				return Domain::Xml::ECheckFull;
+			break;
+		case 'n':
+			if (text_ == QLatin1String("none"))
+				return Domain::Xml::ECheckNone;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("partial"))
+				return Domain::Xml::ECheckPartial;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EVirOnOff>::getText(Domain::Xml::EVirOnOff value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EVirOnOffOn:
+		return QStringLiteral("on");
+	case Domain::Xml::EVirOnOffOff:
+		return QStringLiteral("off");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EVirOnOff>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("on"))
+				return Domain::Xml::EVirOnOffOn;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("off"))
+				return Domain::Xml::EVirOnOffOff;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EFallback>::getText(Domain::Xml::EFallback value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EFallbackAllow:
+		return QStringLiteral("allow");
+	case Domain::Xml::EFallbackForbid:
+		return QStringLiteral("forbid");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EFallback>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("allow"))
+				return Domain::Xml::EFallbackAllow;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("forbid"))
+				return Domain::Xml::EFallbackForbid;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EPolicy>::getText(Domain::Xml::EPolicy value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EPolicyForce:
+		return QStringLiteral("force");
+	case Domain::Xml::EPolicyRequire:
+		return QStringLiteral("require");
+	case Domain::Xml::EPolicyOptional:
+		return QStringLiteral("optional");
+	case Domain::Xml::EPolicyDisable:
+		return QStringLiteral("disable");
+	case Domain::Xml::EPolicyForbid:
+		return QStringLiteral("forbid");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EPolicy>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("force"))
+				return Domain::Xml::EPolicyForce;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("forbid"))
+				return Domain::Xml::EPolicyForbid;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("disable"))
+				return Domain::Xml::EPolicyDisable;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("require"))
+				return Domain::Xml::EPolicyRequire;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("optional"))
+				return Domain::Xml::EPolicyOptional;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMemAccess>::getText(Domain::Xml::EMemAccess value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMemAccessShared:
+		return QStringLiteral("shared");
+	case Domain::Xml::EMemAccessPrivate:
+		return QStringLiteral("private");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMemAccess>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("shared"))
+				return Domain::Xml::EMemAccessShared;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("private"))
+				return Domain::Xml::EMemAccessPrivate;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EVirYesNo>::getText(Domain::Xml::EVirYesNo value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EVirYesNoYes:
+		return QStringLiteral("yes");
+	case Domain::Xml::EVirYesNoNo:
+		return QStringLiteral("no");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EVirYesNo>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("no"))
+				return Domain::Xml::EVirYesNoNo;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'y':
+			if (text_ == QLatin1String("yes"))
+				return Domain::Xml::EVirYesNoYes;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EAssociativity>::getText(Domain::Xml::EAssociativity value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EAssociativityNone:
+		return QStringLiteral("none");
+	case Domain::Xml::EAssociativityDirect:
+		return QStringLiteral("direct");
+	case Domain::Xml::EAssociativityFull:
+		return QStringLiteral("full");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EAssociativity>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("full"))
+				return Domain::Xml::EAssociativityFull;
+			break;
+		case 'n':
+			if (text_ == QLatin1String("none"))
+				return Domain::Xml::EAssociativityNone;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("direct"))
+				return Domain::Xml::EAssociativityDirect;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EPolicy1>::getText(Domain::Xml::EPolicy1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EPolicy1None:
+		return QStringLiteral("none");
+	case Domain::Xml::EPolicy1Writeback:
+		return QStringLiteral("writeback");
+	case Domain::Xml::EPolicy1Writethrough:
+		return QStringLiteral("writethrough");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EPolicy1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("none"))
+				return Domain::Xml::EPolicy1None;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'w':
+			if (text_ == QLatin1String("writeback"))
+				return Domain::Xml::EPolicy1Writeback;
+			break;
+		}
+		break;
+	case 12:
+		switch (text_.at(0).unicode())
+		{
+		case 'w':
+			if (text_ == QLatin1String("writethrough"))
+				return Domain::Xml::EPolicy1Writethrough;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType1>::getText(Domain::Xml::EType1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType1Access:
+		return QStringLiteral("access");
+	case Domain::Xml::EType1Read:
+		return QStringLiteral("read");
+	case Domain::Xml::EType1Write:
+		return QStringLiteral("write");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("read"))
+				return Domain::Xml::EType1Read;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'w':
+			if (text_ == QLatin1String("write"))
+				return Domain::Xml::EType1Write;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("access"))
+				return Domain::Xml::EType1Access;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType2>::getText(Domain::Xml::EType2 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType2Access:
+		return QStringLiteral("access");
+	case Domain::Xml::EType2Read:
+		return QStringLiteral("read");
+	case Domain::Xml::EType2Write:
+		return QStringLiteral("write");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType2>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("read"))
+				return Domain::Xml::EType2Read;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'w':
+			if (text_ == QLatin1String("write"))
+				return Domain::Xml::EType2Write;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("access"))
+				return Domain::Xml::EType2Access;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ELevel>::getText(Domain::Xml::ELevel value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ELevel1:
+		return QStringLiteral("1");
+	case Domain::Xml::ELevel2:
+		return QStringLiteral("2");
+	case Domain::Xml::ELevel3:
+		return QStringLiteral("3");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ELevel>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 1:
+		switch (text_.at(0).unicode())
+		{
+		case '1':
+			if (text_ == QLatin1String("1"))
+				return Domain::Xml::ELevel1;
+			break;
+		case '2':
+			if (text_ == QLatin1String("2"))
+				return Domain::Xml::ELevel2;
+			break;
+		case '3':
+			if (text_ == QLatin1String("3"))
+				return Domain::Xml::ELevel3;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMode1>::getText(Domain::Xml::EMode1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMode1Emulate:
+		return QStringLiteral("emulate");
+	case Domain::Xml::EMode1Passthrough:
+		return QStringLiteral("passthrough");
+	case Domain::Xml::EMode1Disable:
+		return QStringLiteral("disable");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMode1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("disable"))
+				return Domain::Xml::EMode1Disable;
+			break;
+		case 'e':
+			if (text_ == QLatin1String("emulate"))
+				return Domain::Xml::EMode1Emulate;
+			break;
+		}
+		break;
+	case 11:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("passthrough"))
+				return Domain::Xml::EMode1Passthrough;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ESysinfoBiosName>::getText(Domain::Xml::ESysinfoBiosName value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ESysinfoBiosNameVendor:
+		return QStringLiteral("vendor");
+	case Domain::Xml::ESysinfoBiosNameVersion:
+		return QStringLiteral("version");
+	case Domain::Xml::ESysinfoBiosNameDate:
+		return QStringLiteral("date");
+	case Domain::Xml::ESysinfoBiosNameRelease:
+		return QStringLiteral("release");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ESysinfoBiosName>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("date"))
+				return Domain::Xml::ESysinfoBiosNameDate;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("vendor"))
+				return Domain::Xml::ESysinfoBiosNameVendor;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("release"))
+				return Domain::Xml::ESysinfoBiosNameRelease;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("version"))
+				return Domain::Xml::ESysinfoBiosNameVersion;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ESysinfoSystemName>::getText(Domain::Xml::ESysinfoSystemName value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ESysinfoSystemNameManufacturer:
+		return QStringLiteral("manufacturer");
+	case Domain::Xml::ESysinfoSystemNameProduct:
+		return QStringLiteral("product");
+	case Domain::Xml::ESysinfoSystemNameVersion:
+		return QStringLiteral("version");
+	case Domain::Xml::ESysinfoSystemNameSerial:
+		return QStringLiteral("serial");
+	case Domain::Xml::ESysinfoSystemNameUuid:
+		return QStringLiteral("uuid");
+	case Domain::Xml::ESysinfoSystemNameSku:
+		return QStringLiteral("sku");
+	case Domain::Xml::ESysinfoSystemNameFamily:
+		return QStringLiteral("family");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ESysinfoSystemName>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("sku"))
+				return Domain::Xml::ESysinfoSystemNameSku;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("uuid"))
+				return Domain::Xml::ESysinfoSystemNameUuid;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("family"))
+				return Domain::Xml::ESysinfoSystemNameFamily;
+			break;
+		case 's':
+			if (text_ == QLatin1String("serial"))
+				return Domain::Xml::ESysinfoSystemNameSerial;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("product"))
+				return Domain::Xml::ESysinfoSystemNameProduct;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("version"))
+				return Domain::Xml::ESysinfoSystemNameVersion;
+			break;
+		}
+		break;
+	case 12:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("manufacturer"))
+				return Domain::Xml::ESysinfoSystemNameManufacturer;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ESysinfoBaseBoardName>::getText(Domain::Xml::ESysinfoBaseBoardName value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ESysinfoBaseBoardNameManufacturer:
+		return QStringLiteral("manufacturer");
+	case Domain::Xml::ESysinfoBaseBoardNameProduct:
+		return QStringLiteral("product");
+	case Domain::Xml::ESysinfoBaseBoardNameVersion:
+		return QStringLiteral("version");
+	case Domain::Xml::ESysinfoBaseBoardNameSerial:
+		return QStringLiteral("serial");
+	case Domain::Xml::ESysinfoBaseBoardNameAsset:
+		return QStringLiteral("asset");
+	case Domain::Xml::ESysinfoBaseBoardNameLocation:
+		return QStringLiteral("location");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ESysinfoBaseBoardName>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("asset"))
+				return Domain::Xml::ESysinfoBaseBoardNameAsset;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("serial"))
+				return Domain::Xml::ESysinfoBaseBoardNameSerial;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("product"))
+				return Domain::Xml::ESysinfoBaseBoardNameProduct;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("version"))
+				return Domain::Xml::ESysinfoBaseBoardNameVersion;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("location"))
+				return Domain::Xml::ESysinfoBaseBoardNameLocation;
+			break;
+		}
+		break;
+	case 12:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("manufacturer"))
+				return Domain::Xml::ESysinfoBaseBoardNameManufacturer;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ESysinfoChassisName>::getText(Domain::Xml::ESysinfoChassisName value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ESysinfoChassisNameManufacturer:
+		return QStringLiteral("manufacturer");
+	case Domain::Xml::ESysinfoChassisNameVersion:
+		return QStringLiteral("version");
+	case Domain::Xml::ESysinfoChassisNameSerial:
+		return QStringLiteral("serial");
+	case Domain::Xml::ESysinfoChassisNameAsset:
+		return QStringLiteral("asset");
+	case Domain::Xml::ESysinfoChassisNameSku:
+		return QStringLiteral("sku");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ESysinfoChassisName>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("sku"))
+				return Domain::Xml::ESysinfoChassisNameSku;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("asset"))
+				return Domain::Xml::ESysinfoChassisNameAsset;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("serial"))
+				return Domain::Xml::ESysinfoChassisNameSerial;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("version"))
+				return Domain::Xml::ESysinfoChassisNameVersion;
+			break;
+		}
+		break;
+	case 12:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("manufacturer"))
+				return Domain::Xml::ESysinfoChassisNameManufacturer;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EArch>::getText(Domain::Xml::EArch value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EArchI686:
+		return QStringLiteral("i686");
+	case Domain::Xml::EArchX8664:
+		return QStringLiteral("x86_64");
+	case Domain::Xml::EArchIa64:
+		return QStringLiteral("ia64");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EArch>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("i686"))
+				return Domain::Xml::EArchI686;
+			if (text_ == QLatin1String("ia64"))
+				return Domain::Xml::EArchIa64;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'x':
+			if (text_ == QLatin1String("x86_64"))
+				return Domain::Xml::EArchX8664;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMachine>::getText(Domain::Xml::EMachine value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMachineXenpv:
+		return QStringLiteral("xenpv");
+	case Domain::Xml::EMachineXenner:
+		return QStringLiteral("xenner");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMachine>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'x':
+			if (text_ == QLatin1String("xenpv"))
+				return Domain::Xml::EMachineXenpv;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'x':
+			if (text_ == QLatin1String("xenner"))
+				return Domain::Xml::EMachineXenner;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType3>::getText(Domain::Xml::EType3 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType3Xen:
+		return QStringLiteral("xen");
+	case Domain::Xml::EType3Linux:
+		return QStringLiteral("linux");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType3>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'x':
+			if (text_ == QLatin1String("xen"))
+				return Domain::Xml::EType3Xen;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("linux"))
+				return Domain::Xml::EType3Linux;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EArch1>::getText(Domain::Xml::EArch1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EArch1I686:
+		return QStringLiteral("i686");
+	case Domain::Xml::EArch1X8664:
+		return QStringLiteral("x86_64");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EArch1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("i686"))
+				return Domain::Xml::EArch1I686;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'x':
+			if (text_ == QLatin1String("x86_64"))
+				return Domain::Xml::EArch1X8664;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMachine1>::getText(Domain::Xml::EMachine1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMachine1G3beige:
+		return QStringLiteral("g3beige");
+	case Domain::Xml::EMachine1Mac99:
+		return QStringLiteral("mac99");
+	case Domain::Xml::EMachine1Prep:
+		return QStringLiteral("prep");
+	case Domain::Xml::EMachine1Ppce500:
+		return QStringLiteral("ppce500");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMachine1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("prep"))
+				return Domain::Xml::EMachine1Prep;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("mac99"))
+				return Domain::Xml::EMachine1Mac99;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'g':
+			if (text_ == QLatin1String("g3beige"))
+				return Domain::Xml::EMachine1G3beige;
+			break;
+		case 'p':
+			if (text_ == QLatin1String("ppce500"))
+				return Domain::Xml::EMachine1Ppce500;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMachine2>::getText(Domain::Xml::EMachine2 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMachine2Pseries:
+		return QStringLiteral("pseries");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMachine2>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pseries"))
+				return Domain::Xml::EMachine2Pseries;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EArch2>::getText(Domain::Xml::EArch2 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EArch2S390:
+		return QStringLiteral("s390");
+	case Domain::Xml::EArch2S390x:
+		return QStringLiteral("s390x");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EArch2>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("s390"))
+				return Domain::Xml::EArch2S390;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("s390x"))
+				return Domain::Xml::EArch2S390x;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMachine3>::getText(Domain::Xml::EMachine3 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMachine3S390:
+		return QStringLiteral("s390");
+	case Domain::Xml::EMachine3S390Virtio:
+		return QStringLiteral("s390-virtio");
+	case Domain::Xml::EMachine3S390Ccw:
+		return QStringLiteral("s390-ccw");
+	case Domain::Xml::EMachine3S390CcwVirtio:
+		return QStringLiteral("s390-ccw-virtio");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMachine3>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("s390"))
+				return Domain::Xml::EMachine3S390;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("s390-ccw"))
+				return Domain::Xml::EMachine3S390Ccw;
+			break;
+		}
+		break;
+	case 11:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("s390-virtio"))
+				return Domain::Xml::EMachine3S390Virtio;
+			break;
+		}
+		break;
+	case 15:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("s390-ccw-virtio"))
+				return Domain::Xml::EMachine3S390CcwVirtio;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EArch3>::getText(Domain::Xml::EArch3 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EArch3Armv7l:
+		return QStringLiteral("armv7l");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EArch3>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("armv7l"))
+				return Domain::Xml::EArch3Armv7l;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EArch4>::getText(Domain::Xml::EArch4 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EArch4Aarch64:
+		return QStringLiteral("aarch64");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EArch4>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("aarch64"))
+				return Domain::Xml::EArch4Aarch64;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EReadonly>::getText(Domain::Xml::EReadonly value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EReadonlyYes:
+		return QStringLiteral("yes");
+	case Domain::Xml::EReadonlyNo:
+		return QStringLiteral("no");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EReadonly>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("no"))
+				return Domain::Xml::EReadonlyNo;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'y':
+			if (text_ == QLatin1String("yes"))
+				return Domain::Xml::EReadonlyYes;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ESecure>::getText(Domain::Xml::ESecure value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ESecureYes:
+		return QStringLiteral("yes");
+	case Domain::Xml::ESecureNo:
+		return QStringLiteral("no");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ESecure>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("no"))
+				return Domain::Xml::ESecureNo;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'y':
+			if (text_ == QLatin1String("yes"))
+				return Domain::Xml::ESecureYes;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType4>::getText(Domain::Xml::EType4 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType4Rom:
+		return QStringLiteral("rom");
+	case Domain::Xml::EType4Pflash:
+		return QStringLiteral("pflash");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType4>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("rom"))
+				return Domain::Xml::EType4Rom;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pflash"))
+				return Domain::Xml::EType4Pflash;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EStartupPolicy>::getText(Domain::Xml::EStartupPolicy value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EStartupPolicyMandatory:
+		return QStringLiteral("mandatory");
+	case Domain::Xml::EStartupPolicyRequisite:
+		return QStringLiteral("requisite");
+	case Domain::Xml::EStartupPolicyOptional:
+		return QStringLiteral("optional");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EStartupPolicy>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("optional"))
+				return Domain::Xml::EStartupPolicyOptional;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("mandatory"))
+				return Domain::Xml::EStartupPolicyMandatory;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("requisite"))
+				return Domain::Xml::EStartupPolicyRequisite;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EFormat>::getText(Domain::Xml::EFormat value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EFormatDefault:
+		return QStringLiteral("default");
+	case Domain::Xml::EFormatQcow:
+		return QStringLiteral("qcow");
+	case Domain::Xml::EFormatLuks:
+		return QStringLiteral("luks");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EFormat>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("luks"))
+				return Domain::Xml::EFormatLuks;
+			break;
+		case 'q':
+			if (text_ == QLatin1String("qcow"))
+				return Domain::Xml::EFormatQcow;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("default"))
+				return Domain::Xml::EFormatDefault;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EProtocol>::getText(Domain::Xml::EProtocol value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EProtocolNbd:
+		return QStringLiteral("nbd");
+	case Domain::Xml::EProtocolRbd:
+		return QStringLiteral("rbd");
+	case Domain::Xml::EProtocolSheepdog:
+		return QStringLiteral("sheepdog");
+	case Domain::Xml::EProtocolGluster:
+		return QStringLiteral("gluster");
+	case Domain::Xml::EProtocolIscsi:
+		return QStringLiteral("iscsi");
+	case Domain::Xml::EProtocolHttp:
+		return QStringLiteral("http");
+	case Domain::Xml::EProtocolHttps:
+		return QStringLiteral("https");
+	case Domain::Xml::EProtocolFtp:
+		return QStringLiteral("ftp");
+	case Domain::Xml::EProtocolFtps:
+		return QStringLiteral("ftps");
+	case Domain::Xml::EProtocolTftp:
+		return QStringLiteral("tftp");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EProtocol>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("ftp"))
+				return Domain::Xml::EProtocolFtp;
+			break;
+		case 'n':
+			if (text_ == QLatin1String("nbd"))
+				return Domain::Xml::EProtocolNbd;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("rbd"))
+				return Domain::Xml::EProtocolRbd;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("ftps"))
+				return Domain::Xml::EProtocolFtps;
+			break;
+		case 'h':
+			if (text_ == QLatin1String("http"))
+				return Domain::Xml::EProtocolHttp;
+			break;
+		case 't':
+			if (text_ == QLatin1String("tftp"))
+				return Domain::Xml::EProtocolTftp;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("https"))
+				return Domain::Xml::EProtocolHttps;
+			break;
+		case 'i':
+			if (text_ == QLatin1String("iscsi"))
+				return Domain::Xml::EProtocolIscsi;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'g':
+			if (text_ == QLatin1String("gluster"))
+				return Domain::Xml::EProtocolGluster;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("sheepdog"))
+				return Domain::Xml::EProtocolSheepdog;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ETransport>::getText(Domain::Xml::ETransport value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ETransportTcp:
+		return QStringLiteral("tcp");
+	case Domain::Xml::ETransportRdma:
+		return QStringLiteral("rdma");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ETransport>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 't':
+			if (text_ == QLatin1String("tcp"))
+				return Domain::Xml::ETransportTcp;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("rdma"))
+				return Domain::Xml::ETransportRdma;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMode2>::getText(Domain::Xml::EMode2 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMode2Host:
+		return QStringLiteral("host");
+	case Domain::Xml::EMode2Direct:
+		return QStringLiteral("direct");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMode2>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("host"))
+				return Domain::Xml::EMode2Host;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("direct"))
+				return Domain::Xml::EMode2Direct;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EFormat1>::getText(Domain::Xml::EFormat1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EFormat1Raw:
+		return QStringLiteral("raw");
+	case Domain::Xml::EFormat1Qcow2:
+		return QStringLiteral("qcow2");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EFormat1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("raw"))
+				return Domain::Xml::EFormat1Raw;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'q':
+			if (text_ == QLatin1String("qcow2"))
+				return Domain::Xml::EFormat1Qcow2;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EDev>::getText(Domain::Xml::EDev value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EDevHd:
+		return QStringLiteral("hd");
+	case Domain::Xml::EDevFd:
+		return QStringLiteral("fd");
+	case Domain::Xml::EDevCdrom:
+		return QStringLiteral("cdrom");
+	case Domain::Xml::EDevNetwork:
+		return QStringLiteral("network");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EDev>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("fd"))
+				return Domain::Xml::EDevFd;
+			break;
+		case 'h':
+			if (text_ == QLatin1String("hd"))
+				return Domain::Xml::EDevHd;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("cdrom"))
+				return Domain::Xml::EDevCdrom;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("network"))
+				return Domain::Xml::EDevNetwork;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMode3>::getText(Domain::Xml::EMode3 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMode3Emulate:
+		return QStringLiteral("emulate");
+	case Domain::Xml::EMode3Host:
+		return QStringLiteral("host");
+	case Domain::Xml::EMode3Sysinfo:
+		return QStringLiteral("sysinfo");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMode3>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("host"))
+				return Domain::Xml::EMode3Host;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'e':
+			if (text_ == QLatin1String("emulate"))
+				return Domain::Xml::EMode3Emulate;
+			break;
+		case 's':
+			if (text_ == QLatin1String("sysinfo"))
+				return Domain::Xml::EMode3Sysinfo;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EArch5>::getText(Domain::Xml::EArch5 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EArch5I686:
+		return QStringLiteral("i686");
+	case Domain::Xml::EArch5X8664:
+		return QStringLiteral("x86_64");
+	case Domain::Xml::EArch5Ppc:
+		return QStringLiteral("ppc");
+	case Domain::Xml::EArch5Ppc64:
+		return QStringLiteral("ppc64");
+	case Domain::Xml::EArch5Mips:
+		return QStringLiteral("mips");
+	case Domain::Xml::EArch5Sparc:
+		return QStringLiteral("sparc");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EArch5>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("ppc"))
+				return Domain::Xml::EArch5Ppc;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("i686"))
+				return Domain::Xml::EArch5I686;
+			break;
+		case 'm':
+			if (text_ == QLatin1String("mips"))
+				return Domain::Xml::EArch5Mips;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("ppc64"))
+				return Domain::Xml::EArch5Ppc64;
+			break;
+		case 's':
+			if (text_ == QLatin1String("sparc"))
+				return Domain::Xml::EArch5Sparc;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'x':
+			if (text_ == QLatin1String("x86_64"))
+				return Domain::Xml::EArch5X8664;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EOffset>::getText(Domain::Xml::EOffset value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EOffsetLocaltime:
+		return QStringLiteral("localtime");
+	case Domain::Xml::EOffsetUtc:
+		return QStringLiteral("utc");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EOffset>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("utc"))
+				return Domain::Xml::EOffsetUtc;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("localtime"))
+				return Domain::Xml::EOffsetLocaltime;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EAdjustment>::getText(Domain::Xml::EAdjustment value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EAdjustmentReset:
+		return QStringLiteral("reset");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EAdjustment>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("reset"))
+				return Domain::Xml::EAdjustmentReset;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EBasis>::getText(Domain::Xml::EBasis value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EBasisUtc:
+		return QStringLiteral("utc");
+	case Domain::Xml::EBasisLocaltime:
+		return QStringLiteral("localtime");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EBasis>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("utc"))
+				return Domain::Xml::EBasisUtc;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("localtime"))
+				return Domain::Xml::EBasisLocaltime;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EName>::getText(Domain::Xml::EName value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ENamePlatform:
+		return QStringLiteral("platform");
+	case Domain::Xml::ENameRtc:
+		return QStringLiteral("rtc");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EName>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("rtc"))
+				return Domain::Xml::ENameRtc;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("platform"))
+				return Domain::Xml::ENamePlatform;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ETrack>::getText(Domain::Xml::ETrack value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ETrackBoot:
+		return QStringLiteral("boot");
+	case Domain::Xml::ETrackGuest:
+		return QStringLiteral("guest");
+	case Domain::Xml::ETrackWall:
+		return QStringLiteral("wall");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ETrack>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("boot"))
+				return Domain::Xml::ETrackBoot;
+			break;
+		case 'w':
+			if (text_ == QLatin1String("wall"))
+				return Domain::Xml::ETrackWall;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'g':
+			if (text_ == QLatin1String("guest"))
+				return Domain::Xml::ETrackGuest;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ETickpolicy>::getText(Domain::Xml::ETickpolicy value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ETickpolicyDelay:
+		return QStringLiteral("delay");
+	case Domain::Xml::ETickpolicyMerge:
+		return QStringLiteral("merge");
+	case Domain::Xml::ETickpolicyDiscard:
+		return QStringLiteral("discard");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ETickpolicy>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("delay"))
+				return Domain::Xml::ETickpolicyDelay;
+			break;
+		case 'm':
+			if (text_ == QLatin1String("merge"))
+				return Domain::Xml::ETickpolicyMerge;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("discard"))
+				return Domain::Xml::ETickpolicyDiscard;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMode4>::getText(Domain::Xml::EMode4 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMode4Auto:
+		return QStringLiteral("auto");
+	case Domain::Xml::EMode4Native:
+		return QStringLiteral("native");
+	case Domain::Xml::EMode4Emulate:
+		return QStringLiteral("emulate");
+	case Domain::Xml::EMode4Paravirt:
+		return QStringLiteral("paravirt");
+	case Domain::Xml::EMode4Smpsafe:
+		return QStringLiteral("smpsafe");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMode4>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("auto"))
+				return Domain::Xml::EMode4Auto;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("native"))
+				return Domain::Xml::EMode4Native;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'e':
+			if (text_ == QLatin1String("emulate"))
+				return Domain::Xml::EMode4Emulate;
+			break;
+		case 's':
+			if (text_ == QLatin1String("smpsafe"))
+				return Domain::Xml::EMode4Smpsafe;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("paravirt"))
+				return Domain::Xml::EMode4Paravirt;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EName1>::getText(Domain::Xml::EName1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EName1Hpet:
+		return QStringLiteral("hpet");
+	case Domain::Xml::EName1Pit:
+		return QStringLiteral("pit");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EName1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pit"))
+				return Domain::Xml::EName1Pit;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("hpet"))
+				return Domain::Xml::EName1Hpet;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EName2>::getText(Domain::Xml::EName2 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EName2Kvmclock:
+		return QStringLiteral("kvmclock");
+	case Domain::Xml::EName2Hypervclock:
+		return QStringLiteral("hypervclock");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EName2>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'k':
+			if (text_ == QLatin1String("kvmclock"))
+				return Domain::Xml::EName2Kvmclock;
+			break;
+		}
+		break;
+	case 11:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("hypervclock"))
+				return Domain::Xml::EName2Hypervclock;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType5>::getText(Domain::Xml::EType5 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType5File:
+		return QStringLiteral("file");
+	case Domain::Xml::EType5Anonymous:
+		return QStringLiteral("anonymous");
+	case Domain::Xml::EType5Memfd:
+		return QStringLiteral("memfd");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType5>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("file"))
+				return Domain::Xml::EType5File;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("memfd"))
+				return Domain::Xml::EType5Memfd;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("anonymous"))
+				return Domain::Xml::EType5Anonymous;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMode5>::getText(Domain::Xml::EMode5 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMode5Shared:
+		return QStringLiteral("shared");
+	case Domain::Xml::EMode5Private:
+		return QStringLiteral("private");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMode5>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("shared"))
+				return Domain::Xml::EMode5Shared;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("private"))
+				return Domain::Xml::EMode5Private;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMode6>::getText(Domain::Xml::EMode6 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMode6Immediate:
+		return QStringLiteral("immediate");
+	case Domain::Xml::EMode6Ondemand:
+		return QStringLiteral("ondemand");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMode6>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("ondemand"))
+				return Domain::Xml::EMode6Ondemand;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("immediate"))
+				return Domain::Xml::EMode6Immediate;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EPlacement>::getText(Domain::Xml::EPlacement value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EPlacementStatic:
+		return QStringLiteral("static");
+	case Domain::Xml::EPlacementAuto:
+		return QStringLiteral("auto");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EPlacement>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("auto"))
+				return Domain::Xml::EPlacementAuto;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("static"))
+				return Domain::Xml::EPlacementStatic;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EScheduler>::getText(Domain::Xml::EScheduler value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ESchedulerBatch:
+		return QStringLiteral("batch");
+	case Domain::Xml::ESchedulerIdle:
+		return QStringLiteral("idle");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EScheduler>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("idle"))
+				return Domain::Xml::ESchedulerIdle;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("batch"))
+				return Domain::Xml::ESchedulerBatch;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EScheduler1>::getText(Domain::Xml::EScheduler1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EScheduler1Fifo:
+		return QStringLiteral("fifo");
+	case Domain::Xml::EScheduler1Rr:
+		return QStringLiteral("rr");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EScheduler1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("rr"))
+				return Domain::Xml::EScheduler1Rr;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("fifo"))
+				return Domain::Xml::EScheduler1Fifo;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType6>::getText(Domain::Xml::EType6 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType6Both:
+		return QStringLiteral("both");
+	case Domain::Xml::EType6Code:
+		return QStringLiteral("code");
+	case Domain::Xml::EType6Data:
+		return QStringLiteral("data");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType6>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("both"))
+				return Domain::Xml::EType6Both;
+			break;
+		case 'c':
+			if (text_ == QLatin1String("code"))
+				return Domain::Xml::EType6Code;
+			break;
+		case 'd':
+			if (text_ == QLatin1String("data"))
+				return Domain::Xml::EType6Data;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMode7>::getText(Domain::Xml::EMode7 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMode7Strict:
+		return QStringLiteral("strict");
+	case Domain::Xml::EMode7Preferred:
+		return QStringLiteral("preferred");
+	case Domain::Xml::EMode7Interleave:
+		return QStringLiteral("interleave");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMode7>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("strict"))
+				return Domain::Xml::EMode7Strict;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("preferred"))
+				return Domain::Xml::EMode7Preferred;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("interleave"))
+				return Domain::Xml::EMode7Interleave;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMode8>::getText(Domain::Xml::EMode8 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMode8Strict:
+		return QStringLiteral("strict");
+	case Domain::Xml::EMode8Preferred:
+		return QStringLiteral("preferred");
+	case Domain::Xml::EMode8Interleave:
+		return QStringLiteral("interleave");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMode8>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("strict"))
+				return Domain::Xml::EMode8Strict;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("preferred"))
+				return Domain::Xml::EMode8Preferred;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("interleave"))
+				return Domain::Xml::EMode8Interleave;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EPolicy2>::getText(Domain::Xml::EPolicy2 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EPolicy2Default:
+		return QStringLiteral("default");
+	case Domain::Xml::EPolicy2Allow:
+		return QStringLiteral("allow");
+	case Domain::Xml::EPolicy2Deny:
+		return QStringLiteral("deny");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EPolicy2>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("deny"))
+				return Domain::Xml::EPolicy2Deny;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("allow"))
+				return Domain::Xml::EPolicy2Allow;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("default"))
+				return Domain::Xml::EPolicy2Default;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EDriver>::getText(Domain::Xml::EDriver value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EDriverQemu:
+		return QStringLiteral("qemu");
+	case Domain::Xml::EDriverKvm:
+		return QStringLiteral("kvm");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EDriver>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'k':
+			if (text_ == QLatin1String("kvm"))
+				return Domain::Xml::EDriverKvm;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'q':
+			if (text_ == QLatin1String("qemu"))
+				return Domain::Xml::EDriverQemu;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EResizing>::getText(Domain::Xml::EResizing value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EResizingEnabled:
+		return QStringLiteral("enabled");
+	case Domain::Xml::EResizingDisabled:
+		return QStringLiteral("disabled");
+	case Domain::Xml::EResizingRequired:
+		return QStringLiteral("required");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EResizing>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'e':
+			if (text_ == QLatin1String("enabled"))
+				return Domain::Xml::EResizingEnabled;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("disabled"))
+				return Domain::Xml::EResizingDisabled;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("required"))
+				return Domain::Xml::EResizingRequired;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EUnknown>::getText(Domain::Xml::EUnknown value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EUnknownIgnore:
+		return QStringLiteral("ignore");
+	case Domain::Xml::EUnknownFault:
+		return QStringLiteral("fault");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EUnknown>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("fault"))
+				return Domain::Xml::EUnknownFault;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("ignore"))
+				return Domain::Xml::EUnknownIgnore;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EValue>::getText(Domain::Xml::EValue value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EValueBroken:
+		return QStringLiteral("broken");
+	case Domain::Xml::EValueWorkaround:
+		return QStringLiteral("workaround");
+	case Domain::Xml::EValueFixed:
+		return QStringLiteral("fixed");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EValue>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("fixed"))
+				return Domain::Xml::EValueFixed;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("broken"))
+				return Domain::Xml::EValueBroken;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'w':
+			if (text_ == QLatin1String("workaround"))
+				return Domain::Xml::EValueWorkaround;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EValue1>::getText(Domain::Xml::EValue1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EValue1Broken:
+		return QStringLiteral("broken");
+	case Domain::Xml::EValue1Workaround:
+		return QStringLiteral("workaround");
+	case Domain::Xml::EValue1Fixed:
+		return QStringLiteral("fixed");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EValue1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("fixed"))
+				return Domain::Xml::EValue1Fixed;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("broken"))
+				return Domain::Xml::EValue1Broken;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'w':
+			if (text_ == QLatin1String("workaround"))
+				return Domain::Xml::EValue1Workaround;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EValue2>::getText(Domain::Xml::EValue2 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EValue2Broken:
+		return QStringLiteral("broken");
+	case Domain::Xml::EValue2Workaround:
+		return QStringLiteral("workaround");
+	case Domain::Xml::EValue2FixedIbs:
+		return QStringLiteral("fixed-ibs");
+	case Domain::Xml::EValue2FixedCcd:
+		return QStringLiteral("fixed-ccd");
+	case Domain::Xml::EValue2FixedNa:
+		return QStringLiteral("fixed-na");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EValue2>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("broken"))
+				return Domain::Xml::EValue2Broken;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("fixed-na"))
+				return Domain::Xml::EValue2FixedNa;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("fixed-ibs"))
+				return Domain::Xml::EValue2FixedIbs;
+			if (text_ == QLatin1String("fixed-ccd"))
+				return Domain::Xml::EValue2FixedCcd;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'w':
+			if (text_ == QLatin1String("workaround"))
+				return Domain::Xml::EValue2Workaround;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EOffOptions>::getText(Domain::Xml::EOffOptions value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EOffOptionsDestroy:
+		return QStringLiteral("destroy");
+	case Domain::Xml::EOffOptionsRestart:
+		return QStringLiteral("restart");
+	case Domain::Xml::EOffOptionsPreserve:
+		return QStringLiteral("preserve");
+	case Domain::Xml::EOffOptionsRenameRestart:
+		return QStringLiteral("rename-restart");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EOffOptions>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("destroy"))
+				return Domain::Xml::EOffOptionsDestroy;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("restart"))
+				return Domain::Xml::EOffOptionsRestart;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("preserve"))
+				return Domain::Xml::EOffOptionsPreserve;
+			break;
+		}
+		break;
+	case 14:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("rename-restart"))
+				return Domain::Xml::EOffOptionsRenameRestart;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ECrashOptions>::getText(Domain::Xml::ECrashOptions value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ECrashOptionsDestroy:
+		return QStringLiteral("destroy");
+	case Domain::Xml::ECrashOptionsRestart:
+		return QStringLiteral("restart");
+	case Domain::Xml::ECrashOptionsPreserve:
+		return QStringLiteral("preserve");
+	case Domain::Xml::ECrashOptionsRenameRestart:
+		return QStringLiteral("rename-restart");
+	case Domain::Xml::ECrashOptionsCoredumpDestroy:
+		return QStringLiteral("coredump-destroy");
+	case Domain::Xml::ECrashOptionsCoredumpRestart:
+		return QStringLiteral("coredump-restart");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ECrashOptions>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("destroy"))
+				return Domain::Xml::ECrashOptionsDestroy;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("restart"))
+				return Domain::Xml::ECrashOptionsRestart;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("preserve"))
+				return Domain::Xml::ECrashOptionsPreserve;
+			break;
+		}
+		break;
+	case 14:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("rename-restart"))
+				return Domain::Xml::ECrashOptionsRenameRestart;
+			break;
+		}
+		break;
+	case 16:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("coredump-destroy"))
+				return Domain::Xml::ECrashOptionsCoredumpDestroy;
+			if (text_ == QLatin1String("coredump-restart"))
+				return Domain::Xml::ECrashOptionsCoredumpRestart;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ELockfailureOptions>::getText(Domain::Xml::ELockfailureOptions value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ELockfailureOptionsPoweroff:
+		return QStringLiteral("poweroff");
+	case Domain::Xml::ELockfailureOptionsRestart:
+		return QStringLiteral("restart");
+	case Domain::Xml::ELockfailureOptionsPause:
+		return QStringLiteral("pause");
+	case Domain::Xml::ELockfailureOptionsIgnore:
+		return QStringLiteral("ignore");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ELockfailureOptions>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pause"))
+				return Domain::Xml::ELockfailureOptionsPause;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("ignore"))
+				return Domain::Xml::ELockfailureOptionsIgnore;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("restart"))
+				return Domain::Xml::ELockfailureOptionsRestart;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("poweroff"))
+				return Domain::Xml::ELockfailureOptionsPoweroff;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EName3>::getText(Domain::Xml::EName3 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EName3Cmt:
+		return QStringLiteral("cmt");
+	case Domain::Xml::EName3Mbmt:
+		return QStringLiteral("mbmt");
+	case Domain::Xml::EName3Mbml:
+		return QStringLiteral("mbml");
+	case Domain::Xml::EName3CpuCycles:
+		return QStringLiteral("cpu_cycles");
+	case Domain::Xml::EName3Instructions:
+		return QStringLiteral("instructions");
+	case Domain::Xml::EName3CacheReferences:
+		return QStringLiteral("cache_references");
+	case Domain::Xml::EName3CacheMisses:
+		return QStringLiteral("cache_misses");
+	case Domain::Xml::EName3BranchInstructions:
+		return QStringLiteral("branch_instructions");
+	case Domain::Xml::EName3BranchMisses:
+		return QStringLiteral("branch_misses");
+	case Domain::Xml::EName3BusCycles:
+		return QStringLiteral("bus_cycles");
+	case Domain::Xml::EName3StalledCyclesFrontend:
+		return QStringLiteral("stalled_cycles_frontend");
+	case Domain::Xml::EName3StalledCyclesBackend:
+		return QStringLiteral("stalled_cycles_backend");
+	case Domain::Xml::EName3RefCpuCycles:
+		return QStringLiteral("ref_cpu_cycles");
+	case Domain::Xml::EName3CpuClock:
+		return QStringLiteral("cpu_clock");
+	case Domain::Xml::EName3TaskClock:
+		return QStringLiteral("task_clock");
+	case Domain::Xml::EName3PageFaults:
+		return QStringLiteral("page_faults");
+	case Domain::Xml::EName3ContextSwitches:
+		return QStringLiteral("context_switches");
+	case Domain::Xml::EName3CpuMigrations:
+		return QStringLiteral("cpu_migrations");
+	case Domain::Xml::EName3PageFaultsMin:
+		return QStringLiteral("page_faults_min");
+	case Domain::Xml::EName3PageFaultsMaj:
+		return QStringLiteral("page_faults_maj");
+	case Domain::Xml::EName3AlignmentFaults:
+		return QStringLiteral("alignment_faults");
+	case Domain::Xml::EName3EmulationFaults:
+		return QStringLiteral("emulation_faults");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EName3>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("cmt"))
+				return Domain::Xml::EName3Cmt;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("mbmt"))
+				return Domain::Xml::EName3Mbmt;
+			if (text_ == QLatin1String("mbml"))
+				return Domain::Xml::EName3Mbml;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("cpu_clock"))
+				return Domain::Xml::EName3CpuClock;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("bus_cycles"))
+				return Domain::Xml::EName3BusCycles;
+			break;
+		case 'c':
+			if (text_ == QLatin1String("cpu_cycles"))
+				return Domain::Xml::EName3CpuCycles;
+			break;
+		case 't':
+			if (text_ == QLatin1String("task_clock"))
+				return Domain::Xml::EName3TaskClock;
+			break;
+		}
+		break;
+	case 11:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("page_faults"))
+				return Domain::Xml::EName3PageFaults;
+			break;
+		}
+		break;
+	case 12:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("cache_misses"))
+				return Domain::Xml::EName3CacheMisses;
+			break;
+		case 'i':
+			if (text_ == QLatin1String("instructions"))
+				return Domain::Xml::EName3Instructions;
+			break;
+		}
+		break;
+	case 13:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("branch_misses"))
+				return Domain::Xml::EName3BranchMisses;
+			break;
+		}
+		break;
+	case 14:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("cpu_migrations"))
+				return Domain::Xml::EName3CpuMigrations;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("ref_cpu_cycles"))
+				return Domain::Xml::EName3RefCpuCycles;
+			break;
+		}
+		break;
+	case 15:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("page_faults_min"))
+				return Domain::Xml::EName3PageFaultsMin;
+			if (text_ == QLatin1String("page_faults_maj"))
+				return Domain::Xml::EName3PageFaultsMaj;
+			break;
+		}
+		break;
+	case 16:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("alignment_faults"))
+				return Domain::Xml::EName3AlignmentFaults;
+			break;
+		case 'c':
+			if (text_ == QLatin1String("cache_references"))
+				return Domain::Xml::EName3CacheReferences;
+			if (text_ == QLatin1String("context_switches"))
+				return Domain::Xml::EName3ContextSwitches;
+			break;
+		case 'e':
+			if (text_ == QLatin1String("emulation_faults"))
+				return Domain::Xml::EName3EmulationFaults;
+			break;
+		}
+		break;
+	case 19:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("branch_instructions"))
+				return Domain::Xml::EName3BranchInstructions;
+			break;
+		}
+		break;
+	case 22:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("stalled_cycles_backend"))
+				return Domain::Xml::EName3StalledCyclesBackend;
+			break;
+		}
+		break;
+	case 23:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("stalled_cycles_frontend"))
+				return Domain::Xml::EName3StalledCyclesFrontend;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EDevice>::getText(Domain::Xml::EDevice value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EDeviceFloppy:
+		return QStringLiteral("floppy");
+	case Domain::Xml::EDeviceDisk:
+		return QStringLiteral("disk");
+	case Domain::Xml::EDeviceCdrom:
+		return QStringLiteral("cdrom");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EDevice>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("disk"))
+				return Domain::Xml::EDeviceDisk;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("cdrom"))
+				return Domain::Xml::EDeviceCdrom;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("floppy"))
+				return Domain::Xml::EDeviceFloppy;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EDevice1>::getText(Domain::Xml::EDevice1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EDevice1Lun:
+		return QStringLiteral("lun");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EDevice1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("lun"))
+				return Domain::Xml::EDevice1Lun;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ESgio>::getText(Domain::Xml::ESgio value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ESgioFiltered:
+		return QStringLiteral("filtered");
+	case Domain::Xml::ESgioUnfiltered:
+		return QStringLiteral("unfiltered");
+	case Domain::Xml::ESgioVirtioNonTransitional:
+		return QStringLiteral("virtio-non-transitional");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ESgio>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("filtered"))
+				return Domain::Xml::ESgioFiltered;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("unfiltered"))
+				return Domain::Xml::ESgioUnfiltered;
+			break;
+		}
+		break;
+	case 23:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-non-transitional"))
+				return Domain::Xml::ESgioVirtioNonTransitional;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ESnapshot>::getText(Domain::Xml::ESnapshot value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ESnapshotNo:
+		return QStringLiteral("no");
+	case Domain::Xml::ESnapshotInternal:
+		return QStringLiteral("internal");
+	case Domain::Xml::ESnapshotExternal:
+		return QStringLiteral("external");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ESnapshot>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("no"))
+				return Domain::Xml::ESnapshotNo;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'e':
+			if (text_ == QLatin1String("external"))
+				return Domain::Xml::ESnapshotExternal;
+			break;
+		case 'i':
+			if (text_ == QLatin1String("internal"))
+				return Domain::Xml::ESnapshotInternal;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType7>::getText(Domain::Xml::EType7 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType7Aio:
+		return QStringLiteral("aio");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType7>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("aio"))
+				return Domain::Xml::EType7Aio;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EStorageFormat>::getText(Domain::Xml::EStorageFormat value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EStorageFormatRaw:
+		return QStringLiteral("raw");
+	case Domain::Xml::EStorageFormatDir:
+		return QStringLiteral("dir");
+	case Domain::Xml::EStorageFormatBochs:
+		return QStringLiteral("bochs");
+	case Domain::Xml::EStorageFormatCloop:
+		return QStringLiteral("cloop");
+	case Domain::Xml::EStorageFormatDmg:
+		return QStringLiteral("dmg");
+	case Domain::Xml::EStorageFormatIso:
+		return QStringLiteral("iso");
+	case Domain::Xml::EStorageFormatVpc:
+		return QStringLiteral("vpc");
+	case Domain::Xml::EStorageFormatVdi:
+		return QStringLiteral("vdi");
+	case Domain::Xml::EStorageFormatFat:
+		return QStringLiteral("fat");
+	case Domain::Xml::EStorageFormatVhd:
+		return QStringLiteral("vhd");
+	case Domain::Xml::EStorageFormatPloop:
+		return QStringLiteral("ploop");
+	case Domain::Xml::EStorageFormatLuks:
+		return QStringLiteral("luks");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EStorageFormat>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("dir"))
+				return Domain::Xml::EStorageFormatDir;
+			if (text_ == QLatin1String("dmg"))
+				return Domain::Xml::EStorageFormatDmg;
+			break;
+		case 'f':
+			if (text_ == QLatin1String("fat"))
+				return Domain::Xml::EStorageFormatFat;
+			break;
+		case 'i':
+			if (text_ == QLatin1String("iso"))
+				return Domain::Xml::EStorageFormatIso;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("raw"))
+				return Domain::Xml::EStorageFormatRaw;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("vpc"))
+				return Domain::Xml::EStorageFormatVpc;
+			if (text_ == QLatin1String("vdi"))
+				return Domain::Xml::EStorageFormatVdi;
+			if (text_ == QLatin1String("vhd"))
+				return Domain::Xml::EStorageFormatVhd;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("luks"))
+				return Domain::Xml::EStorageFormatLuks;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("bochs"))
+				return Domain::Xml::EStorageFormatBochs;
+			break;
+		case 'c':
+			if (text_ == QLatin1String("cloop"))
+				return Domain::Xml::EStorageFormatCloop;
+			break;
+		case 'p':
+			if (text_ == QLatin1String("ploop"))
+				return Domain::Xml::EStorageFormatPloop;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EStorageFormatBacking>::getText(Domain::Xml::EStorageFormatBacking value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EStorageFormatBackingCow:
+		return QStringLiteral("cow");
+	case Domain::Xml::EStorageFormatBackingQcow:
+		return QStringLiteral("qcow");
+	case Domain::Xml::EStorageFormatBackingQcow2:
+		return QStringLiteral("qcow2");
+	case Domain::Xml::EStorageFormatBackingQed:
+		return QStringLiteral("qed");
+	case Domain::Xml::EStorageFormatBackingVmdk:
+		return QStringLiteral("vmdk");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EStorageFormatBacking>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("cow"))
+				return Domain::Xml::EStorageFormatBackingCow;
+			break;
+		case 'q':
+			if (text_ == QLatin1String("qed"))
+				return Domain::Xml::EStorageFormatBackingQed;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'q':
+			if (text_ == QLatin1String("qcow"))
+				return Domain::Xml::EStorageFormatBackingQcow;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("vmdk"))
+				return Domain::Xml::EStorageFormatBackingVmdk;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'q':
+			if (text_ == QLatin1String("qcow2"))
+				return Domain::Xml::EStorageFormatBackingQcow2;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ECache>::getText(Domain::Xml::ECache value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ECacheNone:
+		return QStringLiteral("none");
+	case Domain::Xml::ECacheWriteback:
+		return QStringLiteral("writeback");
+	case Domain::Xml::ECacheWritethrough:
+		return QStringLiteral("writethrough");
+	case Domain::Xml::ECacheDirectsync:
+		return QStringLiteral("directsync");
+	case Domain::Xml::ECacheUnsafe:
+		return QStringLiteral("unsafe");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ECache>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("none"))
+				return Domain::Xml::ECacheNone;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("unsafe"))
+				return Domain::Xml::ECacheUnsafe;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'w':
+			if (text_ == QLatin1String("writeback"))
+				return Domain::Xml::ECacheWriteback;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("directsync"))
+				return Domain::Xml::ECacheDirectsync;
+			break;
+		}
+		break;
+	case 12:
+		switch (text_.at(0).unicode())
+		{
+		case 'w':
+			if (text_ == QLatin1String("writethrough"))
+				return Domain::Xml::ECacheWritethrough;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EErrorPolicy>::getText(Domain::Xml::EErrorPolicy value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EErrorPolicyStop:
+		return QStringLiteral("stop");
+	case Domain::Xml::EErrorPolicyReport:
+		return QStringLiteral("report");
+	case Domain::Xml::EErrorPolicyIgnore:
+		return QStringLiteral("ignore");
+	case Domain::Xml::EErrorPolicyEnospace:
+		return QStringLiteral("enospace");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EErrorPolicy>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("stop"))
+				return Domain::Xml::EErrorPolicyStop;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("ignore"))
+				return Domain::Xml::EErrorPolicyIgnore;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("report"))
+				return Domain::Xml::EErrorPolicyReport;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'e':
+			if (text_ == QLatin1String("enospace"))
+				return Domain::Xml::EErrorPolicyEnospace;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ERerrorPolicy>::getText(Domain::Xml::ERerrorPolicy value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ERerrorPolicyStop:
+		return QStringLiteral("stop");
+	case Domain::Xml::ERerrorPolicyReport:
+		return QStringLiteral("report");
+	case Domain::Xml::ERerrorPolicyIgnore:
+		return QStringLiteral("ignore");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ERerrorPolicy>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("stop"))
+				return Domain::Xml::ERerrorPolicyStop;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("ignore"))
+				return Domain::Xml::ERerrorPolicyIgnore;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("report"))
+				return Domain::Xml::ERerrorPolicyReport;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EIo>::getText(Domain::Xml::EIo value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EIoThreads:
+		return QStringLiteral("threads");
+	case Domain::Xml::EIoNative:
+		return QStringLiteral("native");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EIo>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("native"))
+				return Domain::Xml::EIoNative;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 't':
+			if (text_ == QLatin1String("threads"))
+				return Domain::Xml::EIoThreads;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EDiscard>::getText(Domain::Xml::EDiscard value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EDiscardUnmap:
+		return QStringLiteral("unmap");
+	case Domain::Xml::EDiscardIgnore:
+		return QStringLiteral("ignore");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EDiscard>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("unmap"))
+				return Domain::Xml::EDiscardUnmap;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("ignore"))
+				return Domain::Xml::EDiscardIgnore;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EDetectZeroes>::getText(Domain::Xml::EDetectZeroes value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EDetectZeroesOff:
+		return QStringLiteral("off");
+	case Domain::Xml::EDetectZeroesOn:
+		return QStringLiteral("on");
+	case Domain::Xml::EDetectZeroesUnmap:
+		return QStringLiteral("unmap");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EDetectZeroes>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("on"))
+				return Domain::Xml::EDetectZeroesOn;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("off"))
+				return Domain::Xml::EDetectZeroesOff;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("unmap"))
+				return Domain::Xml::EDetectZeroesUnmap;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EJob>::getText(Domain::Xml::EJob value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EJobCopy:
+		return QStringLiteral("copy");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EJob>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("copy"))
+				return Domain::Xml::EJobCopy;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EJob1>::getText(Domain::Xml::EJob1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EJob1Copy:
+		return QStringLiteral("copy");
+	case Domain::Xml::EJob1ActiveCommit:
+		return QStringLiteral("active-commit");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EJob1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("copy"))
+				return Domain::Xml::EJob1Copy;
+			break;
+		}
+		break;
+	case 13:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("active-commit"))
+				return Domain::Xml::EJob1ActiveCommit;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EReady>::getText(Domain::Xml::EReady value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EReadyYes:
+		return QStringLiteral("yes");
+	case Domain::Xml::EReadyAbort:
+		return QStringLiteral("abort");
+	case Domain::Xml::EReadyPivot:
+		return QStringLiteral("pivot");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EReady>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'y':
+			if (text_ == QLatin1String("yes"))
+				return Domain::Xml::EReadyYes;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("abort"))
+				return Domain::Xml::EReadyAbort;
+			break;
+		case 'p':
+			if (text_ == QLatin1String("pivot"))
+				return Domain::Xml::EReadyPivot;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType8>::getText(Domain::Xml::EType8 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType8Ceph:
+		return QStringLiteral("ceph");
+	case Domain::Xml::EType8Iscsi:
+		return QStringLiteral("iscsi");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType8>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("ceph"))
+				return Domain::Xml::EType8Ceph;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("iscsi"))
+				return Domain::Xml::EType8Iscsi;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EBus>::getText(Domain::Xml::EBus value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EBusIde:
+		return QStringLiteral("ide");
+	case Domain::Xml::EBusFdc:
+		return QStringLiteral("fdc");
+	case Domain::Xml::EBusScsi:
+		return QStringLiteral("scsi");
+	case Domain::Xml::EBusVirtio:
+		return QStringLiteral("virtio");
+	case Domain::Xml::EBusXen:
+		return QStringLiteral("xen");
+	case Domain::Xml::EBusUsb:
+		return QStringLiteral("usb");
+	case Domain::Xml::EBusUml:
+		return QStringLiteral("uml");
+	case Domain::Xml::EBusSata:
+		return QStringLiteral("sata");
+	case Domain::Xml::EBusSd:
+		return QStringLiteral("sd");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EBus>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("sd"))
+				return Domain::Xml::EBusSd;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("fdc"))
+				return Domain::Xml::EBusFdc;
+			break;
+		case 'i':
+			if (text_ == QLatin1String("ide"))
+				return Domain::Xml::EBusIde;
+			break;
+		case 'u':
+			if (text_ == QLatin1String("usb"))
+				return Domain::Xml::EBusUsb;
+			if (text_ == QLatin1String("uml"))
+				return Domain::Xml::EBusUml;
+			break;
+		case 'x':
+			if (text_ == QLatin1String("xen"))
+				return Domain::Xml::EBusXen;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("scsi"))
+				return Domain::Xml::EBusScsi;
+			if (text_ == QLatin1String("sata"))
+				return Domain::Xml::EBusSata;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio"))
+				return Domain::Xml::EBusVirtio;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ETray>::getText(Domain::Xml::ETray value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ETrayOpen:
+		return QStringLiteral("open");
+	case Domain::Xml::ETrayClosed:
+		return QStringLiteral("closed");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ETray>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("open"))
+				return Domain::Xml::ETrayOpen;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("closed"))
+				return Domain::Xml::ETrayClosed;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ETrans>::getText(Domain::Xml::ETrans value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ETransAuto:
+		return QStringLiteral("auto");
+	case Domain::Xml::ETransNone:
+		return QStringLiteral("none");
+	case Domain::Xml::ETransLba:
+		return QStringLiteral("lba");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ETrans>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("lba"))
+				return Domain::Xml::ETransLba;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("auto"))
+				return Domain::Xml::ETransAuto;
+			break;
+		case 'n':
+			if (text_ == QLatin1String("none"))
+				return Domain::Xml::ETransNone;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType9>::getText(Domain::Xml::EType9 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType9Fdc:
+		return QStringLiteral("fdc");
+	case Domain::Xml::EType9Ide:
+		return QStringLiteral("ide");
+	case Domain::Xml::EType9Sata:
+		return QStringLiteral("sata");
+	case Domain::Xml::EType9Ccid:
+		return QStringLiteral("ccid");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType9>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("fdc"))
+				return Domain::Xml::EType9Fdc;
+			break;
+		case 'i':
+			if (text_ == QLatin1String("ide"))
+				return Domain::Xml::EType9Ide;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("ccid"))
+				return Domain::Xml::EType9Ccid;
+			break;
+		case 's':
+			if (text_ == QLatin1String("sata"))
+				return Domain::Xml::EType9Sata;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel>::getText(Domain::Xml::EModel value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModelAuto:
+		return QStringLiteral("auto");
+	case Domain::Xml::EModelBuslogic:
+		return QStringLiteral("buslogic");
+	case Domain::Xml::EModelLsilogic:
+		return QStringLiteral("lsilogic");
+	case Domain::Xml::EModelLsisas1068:
+		return QStringLiteral("lsisas1068");
+	case Domain::Xml::EModelVmpvscsi:
+		return QStringLiteral("vmpvscsi");
+	case Domain::Xml::EModelIbmvscsi:
+		return QStringLiteral("ibmvscsi");
+	case Domain::Xml::EModelVirtioScsi:
+		return QStringLiteral("virtio-scsi");
+	case Domain::Xml::EModelLsisas1078:
+		return QStringLiteral("lsisas1078");
+	case Domain::Xml::EModelVirtioTransitional:
+		return QStringLiteral("virtio-transitional");
+	case Domain::Xml::EModelVirtioNonTransitional:
+		return QStringLiteral("virtio-non-transitional");
+	case Domain::Xml::EModelNcr53c90:
+		return QStringLiteral("ncr53c90");
+	case Domain::Xml::EModelDc390:
+		return QStringLiteral("dc390");
+	case Domain::Xml::EModelAm53c974:
+		return QStringLiteral("am53c974");
+	case Domain::Xml::EModelHvScsi:
+		return QStringLiteral("hv-scsi");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("auto"))
+				return Domain::Xml::EModelAuto;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("dc390"))
+				return Domain::Xml::EModelDc390;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("hv-scsi"))
+				return Domain::Xml::EModelHvScsi;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("am53c974"))
+				return Domain::Xml::EModelAm53c974;
+			break;
+		case 'b':
+			if (text_ == QLatin1String("buslogic"))
+				return Domain::Xml::EModelBuslogic;
+			break;
+		case 'i':
+			if (text_ == QLatin1String("ibmvscsi"))
+				return Domain::Xml::EModelIbmvscsi;
+			break;
+		case 'l':
+			if (text_ == QLatin1String("lsilogic"))
+				return Domain::Xml::EModelLsilogic;
+			break;
+		case 'n':
+			if (text_ == QLatin1String("ncr53c90"))
+				return Domain::Xml::EModelNcr53c90;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("vmpvscsi"))
+				return Domain::Xml::EModelVmpvscsi;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("lsisas1068"))
+				return Domain::Xml::EModelLsisas1068;
+			if (text_ == QLatin1String("lsisas1078"))
+				return Domain::Xml::EModelLsisas1078;
+			break;
+		}
+		break;
+	case 11:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-scsi"))
+				return Domain::Xml::EModelVirtioScsi;
+			break;
+		}
+		break;
+	case 19:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-transitional"))
+				return Domain::Xml::EModelVirtioTransitional;
+			break;
+		}
+		break;
+	case 23:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-non-transitional"))
+				return Domain::Xml::EModelVirtioNonTransitional;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel1>::getText(Domain::Xml::EModel1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel1Piix3Uhci:
+		return QStringLiteral("piix3-uhci");
+	case Domain::Xml::EModel1Piix4Uhci:
+		return QStringLiteral("piix4-uhci");
+	case Domain::Xml::EModel1Ehci:
+		return QStringLiteral("ehci");
+	case Domain::Xml::EModel1Ich9Ehci1:
+		return QStringLiteral("ich9-ehci1");
+	case Domain::Xml::EModel1Ich9Uhci1:
+		return QStringLiteral("ich9-uhci1");
+	case Domain::Xml::EModel1Ich9Uhci2:
+		return QStringLiteral("ich9-uhci2");
+	case Domain::Xml::EModel1Ich9Uhci3:
+		return QStringLiteral("ich9-uhci3");
+	case Domain::Xml::EModel1Vt82c686bUhci:
+		return QStringLiteral("vt82c686b-uhci");
+	case Domain::Xml::EModel1PciOhci:
+		return QStringLiteral("pci-ohci");
+	case Domain::Xml::EModel1NecXhci:
+		return QStringLiteral("nec-xhci");
+	case Domain::Xml::EModel1None:
+		return QStringLiteral("none");
+	case Domain::Xml::EModel1Qusb1:
+		return QStringLiteral("qusb1");
+	case Domain::Xml::EModel1Qusb2:
+		return QStringLiteral("qusb2");
+	case Domain::Xml::EModel1QemuXhci:
+		return QStringLiteral("qemu-xhci");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'e':
+			if (text_ == QLatin1String("ehci"))
+				return Domain::Xml::EModel1Ehci;
+			break;
+		case 'n':
+			if (text_ == QLatin1String("none"))
+				return Domain::Xml::EModel1None;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'q':
+			if (text_ == QLatin1String("qusb1"))
+				return Domain::Xml::EModel1Qusb1;
+			if (text_ == QLatin1String("qusb2"))
+				return Domain::Xml::EModel1Qusb2;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("nec-xhci"))
+				return Domain::Xml::EModel1NecXhci;
+			break;
+		case 'p':
+			if (text_ == QLatin1String("pci-ohci"))
+				return Domain::Xml::EModel1PciOhci;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'q':
+			if (text_ == QLatin1String("qemu-xhci"))
+				return Domain::Xml::EModel1QemuXhci;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("ich9-ehci1"))
+				return Domain::Xml::EModel1Ich9Ehci1;
+			if (text_ == QLatin1String("ich9-uhci1"))
+				return Domain::Xml::EModel1Ich9Uhci1;
+			if (text_ == QLatin1String("ich9-uhci2"))
+				return Domain::Xml::EModel1Ich9Uhci2;
+			if (text_ == QLatin1String("ich9-uhci3"))
+				return Domain::Xml::EModel1Ich9Uhci3;
+			break;
+		case 'p':
+			if (text_ == QLatin1String("piix3-uhci"))
+				return Domain::Xml::EModel1Piix3Uhci;
+			if (text_ == QLatin1String("piix4-uhci"))
+				return Domain::Xml::EModel1Piix4Uhci;
+			break;
+		}
+		break;
+	case 14:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("vt82c686b-uhci"))
+				return Domain::Xml::EModel1Vt82c686bUhci;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel2>::getText(Domain::Xml::EModel2 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel2Piix3:
+		return QStringLiteral("piix3");
+	case Domain::Xml::EModel2Piix4:
+		return QStringLiteral("piix4");
+	case Domain::Xml::EModel2Ich6:
+		return QStringLiteral("ich6");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel2>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("ich6"))
+				return Domain::Xml::EModel2Ich6;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("piix3"))
+				return Domain::Xml::EModel2Piix3;
+			if (text_ == QLatin1String("piix4"))
+				return Domain::Xml::EModel2Piix4;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EName4>::getText(Domain::Xml::EName4 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EName4SpaprPciHostBridge:
+		return QStringLiteral("spapr-pci-host-bridge");
+	case Domain::Xml::EName4PciBridge:
+		return QStringLiteral("pci-bridge");
+	case Domain::Xml::EName4I82801b11Bridge:
+		return QStringLiteral("i82801b11-bridge");
+	case Domain::Xml::EName4PciePciBridge:
+		return QStringLiteral("pcie-pci-bridge");
+	case Domain::Xml::EName4Ioh3420:
+		return QStringLiteral("ioh3420");
+	case Domain::Xml::EName4PcieRootPort:
+		return QStringLiteral("pcie-root-port");
+	case Domain::Xml::EName4X3130Upstream:
+		return QStringLiteral("x3130-upstream");
+	case Domain::Xml::EName4Xio3130Downstream:
+		return QStringLiteral("xio3130-downstream");
+	case Domain::Xml::EName4Pxb:
+		return QStringLiteral("pxb");
+	case Domain::Xml::EName4PxbPcie:
+		return QStringLiteral("pxb-pcie");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EName4>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pxb"))
+				return Domain::Xml::EName4Pxb;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("ioh3420"))
+				return Domain::Xml::EName4Ioh3420;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pxb-pcie"))
+				return Domain::Xml::EName4PxbPcie;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pci-bridge"))
+				return Domain::Xml::EName4PciBridge;
+			break;
+		}
+		break;
+	case 14:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pcie-root-port"))
+				return Domain::Xml::EName4PcieRootPort;
+			break;
+		case 'x':
+			if (text_ == QLatin1String("x3130-upstream"))
+				return Domain::Xml::EName4X3130Upstream;
+			break;
+		}
+		break;
+	case 15:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pcie-pci-bridge"))
+				return Domain::Xml::EName4PciePciBridge;
+			break;
+		}
+		break;
+	case 16:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("i82801b11-bridge"))
+				return Domain::Xml::EName4I82801b11Bridge;
+			break;
+		}
+		break;
+	case 18:
+		switch (text_.at(0).unicode())
+		{
+		case 'x':
+			if (text_ == QLatin1String("xio3130-downstream"))
+				return Domain::Xml::EName4Xio3130Downstream;
+			break;
+		}
+		break;
+	case 21:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("spapr-pci-host-bridge"))
+				return Domain::Xml::EName4SpaprPciHostBridge;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel3>::getText(Domain::Xml::EModel3 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel3PciRoot:
+		return QStringLiteral("pci-root");
+	case Domain::Xml::EModel3PcieRoot:
+		return QStringLiteral("pcie-root");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel3>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pci-root"))
+				return Domain::Xml::EModel3PciRoot;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pcie-root"))
+				return Domain::Xml::EModel3PcieRoot;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel4>::getText(Domain::Xml::EModel4 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel4PciBridge:
+		return QStringLiteral("pci-bridge");
+	case Domain::Xml::EModel4DmiToPciBridge:
+		return QStringLiteral("dmi-to-pci-bridge");
+	case Domain::Xml::EModel4PcieToPciBridge:
+		return QStringLiteral("pcie-to-pci-bridge");
+	case Domain::Xml::EModel4PcieRootPort:
+		return QStringLiteral("pcie-root-port");
+	case Domain::Xml::EModel4PcieSwitchUpstreamPort:
+		return QStringLiteral("pcie-switch-upstream-port");
+	case Domain::Xml::EModel4PcieSwitchDownstreamPort:
+		return QStringLiteral("pcie-switch-downstream-port");
+	case Domain::Xml::EModel4PciExpanderBus:
+		return QStringLiteral("pci-expander-bus");
+	case Domain::Xml::EModel4PcieExpanderBus:
+		return QStringLiteral("pcie-expander-bus");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel4>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pci-bridge"))
+				return Domain::Xml::EModel4PciBridge;
+			break;
+		}
+		break;
+	case 14:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pcie-root-port"))
+				return Domain::Xml::EModel4PcieRootPort;
+			break;
+		}
+		break;
+	case 16:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pci-expander-bus"))
+				return Domain::Xml::EModel4PciExpanderBus;
+			break;
+		}
+		break;
+	case 17:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("dmi-to-pci-bridge"))
+				return Domain::Xml::EModel4DmiToPciBridge;
+			break;
+		case 'p':
+			if (text_ == QLatin1String("pcie-expander-bus"))
+				return Domain::Xml::EModel4PcieExpanderBus;
+			break;
+		}
+		break;
+	case 18:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pcie-to-pci-bridge"))
+				return Domain::Xml::EModel4PcieToPciBridge;
+			break;
+		}
+		break;
+	case 25:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pcie-switch-upstream-port"))
+				return Domain::Xml::EModel4PcieSwitchUpstreamPort;
+			break;
+		}
+		break;
+	case 27:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pcie-switch-downstream-port"))
+				return Domain::Xml::EModel4PcieSwitchDownstreamPort;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel5>::getText(Domain::Xml::EModel5 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel5Virtio:
+		return QStringLiteral("virtio");
+	case Domain::Xml::EModel5VirtioTransitional:
+		return QStringLiteral("virtio-transitional");
+	case Domain::Xml::EModel5VirtioNonTransitional:
+		return QStringLiteral("virtio-non-transitional");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel5>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio"))
+				return Domain::Xml::EModel5Virtio;
+			break;
+		}
+		break;
+	case 19:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-transitional"))
+				return Domain::Xml::EModel5VirtioTransitional;
+			break;
+		}
+		break;
+	case 23:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-non-transitional"))
+				return Domain::Xml::EModel5VirtioNonTransitional;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType10>::getText(Domain::Xml::EType10 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType10Path:
+		return QStringLiteral("path");
+	case Domain::Xml::EType10Handle:
+		return QStringLiteral("handle");
+	case Domain::Xml::EType10Loop:
+		return QStringLiteral("loop");
+	case Domain::Xml::EType10Nbd:
+		return QStringLiteral("nbd");
+	case Domain::Xml::EType10Ploop:
+		return QStringLiteral("ploop");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType10>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("nbd"))
+				return Domain::Xml::EType10Nbd;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("loop"))
+				return Domain::Xml::EType10Loop;
+			break;
+		case 'p':
+			if (text_ == QLatin1String("path"))
+				return Domain::Xml::EType10Path;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("ploop"))
+				return Domain::Xml::EType10Ploop;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("handle"))
+				return Domain::Xml::EType10Handle;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EAccessmode>::getText(Domain::Xml::EAccessmode value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EAccessmodePassthrough:
+		return QStringLiteral("passthrough");
+	case Domain::Xml::EAccessmodeMapped:
+		return QStringLiteral("mapped");
+	case Domain::Xml::EAccessmodeSquash:
+		return QStringLiteral("squash");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EAccessmode>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("mapped"))
+				return Domain::Xml::EAccessmodeMapped;
+			break;
+		case 's':
+			if (text_ == QLatin1String("squash"))
+				return Domain::Xml::EAccessmodeSquash;
+			break;
+		}
+		break;
+	case 11:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("passthrough"))
+				return Domain::Xml::EAccessmodePassthrough;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMultidevs>::getText(Domain::Xml::EMultidevs value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMultidevsDefault:
+		return QStringLiteral("default");
+	case Domain::Xml::EMultidevsRemap:
+		return QStringLiteral("remap");
+	case Domain::Xml::EMultidevsForbid:
+		return QStringLiteral("forbid");
+	case Domain::Xml::EMultidevsWarn:
+		return QStringLiteral("warn");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMultidevs>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'w':
+			if (text_ == QLatin1String("warn"))
+				return Domain::Xml::EMultidevsWarn;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("remap"))
+				return Domain::Xml::EMultidevsRemap;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("forbid"))
+				return Domain::Xml::EMultidevsForbid;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("default"))
+				return Domain::Xml::EMultidevsDefault;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel6>::getText(Domain::Xml::EModel6 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel6Virtio:
+		return QStringLiteral("virtio");
+	case Domain::Xml::EModel6VirtioTransitional:
+		return QStringLiteral("virtio-transitional");
+	case Domain::Xml::EModel6VirtioNonTransitional:
+		return QStringLiteral("virtio-non-transitional");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel6>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio"))
+				return Domain::Xml::EModel6Virtio;
+			break;
+		}
+		break;
+	case 19:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-transitional"))
+				return Domain::Xml::EModel6VirtioTransitional;
+			break;
+		}
+		break;
+	case 23:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-non-transitional"))
+				return Domain::Xml::EModel6VirtioNonTransitional;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMacTableManager>::getText(Domain::Xml::EMacTableManager value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMacTableManagerKernel:
+		return QStringLiteral("kernel");
+	case Domain::Xml::EMacTableManagerLibvirt:
+		return QStringLiteral("libvirt");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMacTableManager>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'k':
+			if (text_ == QLatin1String("kernel"))
+				return Domain::Xml::EMacTableManagerKernel;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("libvirt"))
+				return Domain::Xml::EMacTableManagerLibvirt;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EState>::getText(Domain::Xml::EState value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EStateUp:
+		return QStringLiteral("up");
+	case Domain::Xml::EStateDown:
+		return QStringLiteral("down");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EState>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("up"))
+				return Domain::Xml::EStateUp;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("down"))
+				return Domain::Xml::EStateDown;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EName5>::getText(Domain::Xml::EName5 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EName5Kvm:
+		return QStringLiteral("kvm");
+	case Domain::Xml::EName5Vfio:
+		return QStringLiteral("vfio");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EName5>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'k':
+			if (text_ == QLatin1String("kvm"))
+				return Domain::Xml::EName5Kvm;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("vfio"))
+				return Domain::Xml::EName5Vfio;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EName6>::getText(Domain::Xml::EName6 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EName6Qemu:
+		return QStringLiteral("qemu");
+	case Domain::Xml::EName6Vhost:
+		return QStringLiteral("vhost");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EName6>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'q':
+			if (text_ == QLatin1String("qemu"))
+				return Domain::Xml::EName6Qemu;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("vhost"))
+				return Domain::Xml::EName6Vhost;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ETxmode>::getText(Domain::Xml::ETxmode value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ETxmodeIothread:
+		return QStringLiteral("iothread");
+	case Domain::Xml::ETxmodeTimer:
+		return QStringLiteral("timer");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ETxmode>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 't':
+			if (text_ == QLatin1String("timer"))
+				return Domain::Xml::ETxmodeTimer;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("iothread"))
+				return Domain::Xml::ETxmodeIothread;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ENativeMode>::getText(Domain::Xml::ENativeMode value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ENativeModeTagged:
+		return QStringLiteral("tagged");
+	case Domain::Xml::ENativeModeUntagged:
+		return QStringLiteral("untagged");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ENativeMode>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 't':
+			if (text_ == QLatin1String("tagged"))
+				return Domain::Xml::ENativeModeTagged;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("untagged"))
+				return Domain::Xml::ENativeModeUntagged;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType11>::getText(Domain::Xml::EType11 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType11Unix:
+		return QStringLiteral("unix");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType11>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("unix"))
+				return Domain::Xml::EType11Unix;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMode9>::getText(Domain::Xml::EMode9 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMode9Server:
+		return QStringLiteral("server");
+	case Domain::Xml::EMode9Client:
+		return QStringLiteral("client");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMode9>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("client"))
+				return Domain::Xml::EMode9Client;
+			break;
+		case 's':
+			if (text_ == QLatin1String("server"))
+				return Domain::Xml::EMode9Server;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType12>::getText(Domain::Xml::EType12 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType12Mcast:
+		return QStringLiteral("mcast");
+	case Domain::Xml::EType12Client:
+		return QStringLiteral("client");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType12>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("mcast"))
+				return Domain::Xml::EType12Mcast;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("client"))
+				return Domain::Xml::EType12Client;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType13>::getText(Domain::Xml::EType13 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType13Tablet:
+		return QStringLiteral("tablet");
+	case Domain::Xml::EType13Mouse:
+		return QStringLiteral("mouse");
+	case Domain::Xml::EType13Keyboard:
+		return QStringLiteral("keyboard");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType13>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("mouse"))
+				return Domain::Xml::EType13Mouse;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 't':
+			if (text_ == QLatin1String("tablet"))
+				return Domain::Xml::EType13Tablet;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'k':
+			if (text_ == QLatin1String("keyboard"))
+				return Domain::Xml::EType13Keyboard;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EBus1>::getText(Domain::Xml::EBus1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EBus1Ps2:
+		return QStringLiteral("ps2");
+	case Domain::Xml::EBus1Usb:
+		return QStringLiteral("usb");
+	case Domain::Xml::EBus1Xen:
+		return QStringLiteral("xen");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EBus1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("ps2"))
+				return Domain::Xml::EBus1Ps2;
+			break;
+		case 'u':
+			if (text_ == QLatin1String("usb"))
+				return Domain::Xml::EBus1Usb;
+			break;
+		case 'x':
+			if (text_ == QLatin1String("xen"))
+				return Domain::Xml::EBus1Xen;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel7>::getText(Domain::Xml::EModel7 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel7Virtio:
+		return QStringLiteral("virtio");
+	case Domain::Xml::EModel7VirtioTransitional:
+		return QStringLiteral("virtio-transitional");
+	case Domain::Xml::EModel7VirtioNonTransitional:
+		return QStringLiteral("virtio-non-transitional");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel7>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio"))
+				return Domain::Xml::EModel7Virtio;
+			break;
+		}
+		break;
+	case 19:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-transitional"))
+				return Domain::Xml::EModel7VirtioTransitional;
+			break;
+		}
+		break;
+	case 23:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-non-transitional"))
+				return Domain::Xml::EModel7VirtioNonTransitional;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel8>::getText(Domain::Xml::EModel8 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel8Sb16:
+		return QStringLiteral("sb16");
+	case Domain::Xml::EModel8Es1370:
+		return QStringLiteral("es1370");
+	case Domain::Xml::EModel8Pcspk:
+		return QStringLiteral("pcspk");
+	case Domain::Xml::EModel8Ac97:
+		return QStringLiteral("ac97");
+	case Domain::Xml::EModel8Ich6:
+		return QStringLiteral("ich6");
+	case Domain::Xml::EModel8Ich9:
+		return QStringLiteral("ich9");
+	case Domain::Xml::EModel8Usb:
+		return QStringLiteral("usb");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel8>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("usb"))
+				return Domain::Xml::EModel8Usb;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("ac97"))
+				return Domain::Xml::EModel8Ac97;
+			break;
+		case 'i':
+			if (text_ == QLatin1String("ich6"))
+				return Domain::Xml::EModel8Ich6;
+			if (text_ == QLatin1String("ich9"))
+				return Domain::Xml::EModel8Ich9;
+			break;
+		case 's':
+			if (text_ == QLatin1String("sb16"))
+				return Domain::Xml::EModel8Sb16;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pcspk"))
+				return Domain::Xml::EModel8Pcspk;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'e':
+			if (text_ == QLatin1String("es1370"))
+				return Domain::Xml::EModel8Es1370;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType14>::getText(Domain::Xml::EType14 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType14Duplex:
+		return QStringLiteral("duplex");
+	case Domain::Xml::EType14Micro:
+		return QStringLiteral("micro");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType14>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("micro"))
+				return Domain::Xml::EType14Micro;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("duplex"))
+				return Domain::Xml::EType14Duplex;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EName7>::getText(Domain::Xml::EName7 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EName7Kvm:
+		return QStringLiteral("kvm");
+	case Domain::Xml::EName7Vfio:
+		return QStringLiteral("vfio");
+	case Domain::Xml::EName7Xen:
+		return QStringLiteral("xen");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EName7>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'k':
+			if (text_ == QLatin1String("kvm"))
+				return Domain::Xml::EName7Kvm;
+			break;
+		case 'x':
+			if (text_ == QLatin1String("xen"))
+				return Domain::Xml::EName7Xen;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("vfio"))
+				return Domain::Xml::EName7Vfio;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ESgio1>::getText(Domain::Xml::ESgio1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ESgio1Filtered:
+		return QStringLiteral("filtered");
+	case Domain::Xml::ESgio1Unfiltered:
+		return QStringLiteral("unfiltered");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ESgio1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("filtered"))
+				return Domain::Xml::ESgio1Filtered;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("unfiltered"))
+				return Domain::Xml::ESgio1Unfiltered;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EProtocol1>::getText(Domain::Xml::EProtocol1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EProtocol1Adapter:
+		return QStringLiteral("adapter");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EProtocol1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("adapter"))
+				return Domain::Xml::EProtocol1Adapter;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EProtocol2>::getText(Domain::Xml::EProtocol2 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EProtocol2Iscsi:
+		return QStringLiteral("iscsi");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EProtocol2>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("iscsi"))
+				return Domain::Xml::EProtocol2Iscsi;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ESharePolicy>::getText(Domain::Xml::ESharePolicy value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ESharePolicyAllowExclusive:
+		return QStringLiteral("allow-exclusive");
+	case Domain::Xml::ESharePolicyForceShared:
+		return QStringLiteral("force-shared");
+	case Domain::Xml::ESharePolicyIgnore:
+		return QStringLiteral("ignore");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ESharePolicy>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("ignore"))
+				return Domain::Xml::ESharePolicyIgnore;
+			break;
+		}
+		break;
+	case 12:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("force-shared"))
+				return Domain::Xml::ESharePolicyForceShared;
+			break;
+		}
+		break;
+	case 15:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("allow-exclusive"))
+				return Domain::Xml::ESharePolicyAllowExclusive;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EConnected>::getText(Domain::Xml::EConnected value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EConnectedKeep:
+		return QStringLiteral("keep");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EConnected>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'k':
+			if (text_ == QLatin1String("keep"))
+				return Domain::Xml::EConnectedKeep;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EConnected1>::getText(Domain::Xml::EConnected1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EConnected1Fail:
+		return QStringLiteral("fail");
+	case Domain::Xml::EConnected1Disconnect:
+		return QStringLiteral("disconnect");
+	case Domain::Xml::EConnected1Keep:
+		return QStringLiteral("keep");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EConnected1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("fail"))
+				return Domain::Xml::EConnected1Fail;
+			break;
+		case 'k':
+			if (text_ == QLatin1String("keep"))
+				return Domain::Xml::EConnected1Keep;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("disconnect"))
+				return Domain::Xml::EConnected1Disconnect;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EDefaultMode>::getText(Domain::Xml::EDefaultMode value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EDefaultModeAny:
+		return QStringLiteral("any");
+	case Domain::Xml::EDefaultModeSecure:
+		return QStringLiteral("secure");
+	case Domain::Xml::EDefaultModeInsecure:
+		return QStringLiteral("insecure");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EDefaultMode>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("any"))
+				return Domain::Xml::EDefaultModeAny;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("secure"))
+				return Domain::Xml::EDefaultModeSecure;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("insecure"))
+				return Domain::Xml::EDefaultModeInsecure;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EName8>::getText(Domain::Xml::EName8 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EName8Main:
+		return QStringLiteral("main");
+	case Domain::Xml::EName8Display:
+		return QStringLiteral("display");
+	case Domain::Xml::EName8Inputs:
+		return QStringLiteral("inputs");
+	case Domain::Xml::EName8Cursor:
+		return QStringLiteral("cursor");
+	case Domain::Xml::EName8Playback:
+		return QStringLiteral("playback");
+	case Domain::Xml::EName8Record:
+		return QStringLiteral("record");
+	case Domain::Xml::EName8Smartcard:
+		return QStringLiteral("smartcard");
+	case Domain::Xml::EName8Usbredir:
+		return QStringLiteral("usbredir");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EName8>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("main"))
+				return Domain::Xml::EName8Main;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("cursor"))
+				return Domain::Xml::EName8Cursor;
+			break;
+		case 'i':
+			if (text_ == QLatin1String("inputs"))
+				return Domain::Xml::EName8Inputs;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("record"))
+				return Domain::Xml::EName8Record;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("display"))
+				return Domain::Xml::EName8Display;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("playback"))
+				return Domain::Xml::EName8Playback;
+			break;
+		case 'u':
+			if (text_ == QLatin1String("usbredir"))
+				return Domain::Xml::EName8Usbredir;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("smartcard"))
+				return Domain::Xml::EName8Smartcard;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMode10>::getText(Domain::Xml::EMode10 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMode10Any:
+		return QStringLiteral("any");
+	case Domain::Xml::EMode10Secure:
+		return QStringLiteral("secure");
+	case Domain::Xml::EMode10Insecure:
+		return QStringLiteral("insecure");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMode10>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("any"))
+				return Domain::Xml::EMode10Any;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("secure"))
+				return Domain::Xml::EMode10Secure;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("insecure"))
+				return Domain::Xml::EMode10Insecure;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ECompression>::getText(Domain::Xml::ECompression value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ECompressionAutoGlz:
+		return QStringLiteral("auto_glz");
+	case Domain::Xml::ECompressionAutoLz:
+		return QStringLiteral("auto_lz");
+	case Domain::Xml::ECompressionQuic:
+		return QStringLiteral("quic");
+	case Domain::Xml::ECompressionGlz:
+		return QStringLiteral("glz");
+	case Domain::Xml::ECompressionLz:
+		return QStringLiteral("lz");
+	case Domain::Xml::ECompressionOff:
+		return QStringLiteral("off");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ECompression>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("lz"))
+				return Domain::Xml::ECompressionLz;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'g':
+			if (text_ == QLatin1String("glz"))
+				return Domain::Xml::ECompressionGlz;
+			break;
+		case 'o':
+			if (text_ == QLatin1String("off"))
+				return Domain::Xml::ECompressionOff;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'q':
+			if (text_ == QLatin1String("quic"))
+				return Domain::Xml::ECompressionQuic;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("auto_lz"))
+				return Domain::Xml::ECompressionAutoLz;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("auto_glz"))
+				return Domain::Xml::ECompressionAutoGlz;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ECompression1>::getText(Domain::Xml::ECompression1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ECompression1Auto:
+		return QStringLiteral("auto");
+	case Domain::Xml::ECompression1Never:
+		return QStringLiteral("never");
+	case Domain::Xml::ECompression1Always:
+		return QStringLiteral("always");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ECompression1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("auto"))
+				return Domain::Xml::ECompression1Auto;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("never"))
+				return Domain::Xml::ECompression1Never;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("always"))
+				return Domain::Xml::ECompression1Always;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::ECompression2>::getText(Domain::Xml::ECompression2 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::ECompression2Auto:
+		return QStringLiteral("auto");
+	case Domain::Xml::ECompression2Never:
+		return QStringLiteral("never");
+	case Domain::Xml::ECompression2Always:
+		return QStringLiteral("always");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::ECompression2>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("auto"))
+				return Domain::Xml::ECompression2Auto;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("never"))
+				return Domain::Xml::ECompression2Never;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("always"))
+				return Domain::Xml::ECompression2Always;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMode11>::getText(Domain::Xml::EMode11 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMode11Filter:
+		return QStringLiteral("filter");
+	case Domain::Xml::EMode11All:
+		return QStringLiteral("all");
+	case Domain::Xml::EMode11Off:
+		return QStringLiteral("off");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMode11>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("all"))
+				return Domain::Xml::EMode11All;
+			break;
+		case 'o':
+			if (text_ == QLatin1String("off"))
+				return Domain::Xml::EMode11Off;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("filter"))
+				return Domain::Xml::EMode11Filter;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EMode12>::getText(Domain::Xml::EMode12 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EMode12Server:
+		return QStringLiteral("server");
+	case Domain::Xml::EMode12Client:
+		return QStringLiteral("client");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EMode12>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("client"))
+				return Domain::Xml::EMode12Client;
+			break;
+		case 's':
+			if (text_ == QLatin1String("server"))
+				return Domain::Xml::EMode12Server;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EName9>::getText(Domain::Xml::EName9 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EName9Qemu:
+		return QStringLiteral("qemu");
+	case Domain::Xml::EName9Vhostuser:
+		return QStringLiteral("vhostuser");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EName9>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'q':
+			if (text_ == QLatin1String("qemu"))
+				return Domain::Xml::EName9Qemu;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("vhostuser"))
+				return Domain::Xml::EName9Vhostuser;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EVgaconf>::getText(Domain::Xml::EVgaconf value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EVgaconfIo:
+		return QStringLiteral("io");
+	case Domain::Xml::EVgaconfOn:
+		return QStringLiteral("on");
+	case Domain::Xml::EVgaconfOff:
+		return QStringLiteral("off");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EVgaconf>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("io"))
+				return Domain::Xml::EVgaconfIo;
+			break;
+		case 'o':
+			if (text_ == QLatin1String("on"))
+				return Domain::Xml::EVgaconfOn;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("off"))
+				return Domain::Xml::EVgaconfOff;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType15>::getText(Domain::Xml::EType15 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType15Vga:
+		return QStringLiteral("vga");
+	case Domain::Xml::EType15Cirrus:
+		return QStringLiteral("cirrus");
+	case Domain::Xml::EType15Vmvga:
+		return QStringLiteral("vmvga");
+	case Domain::Xml::EType15Xen:
+		return QStringLiteral("xen");
+	case Domain::Xml::EType15Vbox:
+		return QStringLiteral("vbox");
+	case Domain::Xml::EType15Virtio:
+		return QStringLiteral("virtio");
+	case Domain::Xml::EType15Vzct:
+		return QStringLiteral("vzct");
+	case Domain::Xml::EType15Gop:
+		return QStringLiteral("gop");
+	case Domain::Xml::EType15None:
+		return QStringLiteral("none");
+	case Domain::Xml::EType15Bochs:
+		return QStringLiteral("bochs");
+	case Domain::Xml::EType15Ramfb:
+		return QStringLiteral("ramfb");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType15>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'g':
+			if (text_ == QLatin1String("gop"))
+				return Domain::Xml::EType15Gop;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("vga"))
+				return Domain::Xml::EType15Vga;
+			break;
+		case 'x':
+			if (text_ == QLatin1String("xen"))
+				return Domain::Xml::EType15Xen;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("none"))
+				return Domain::Xml::EType15None;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("vbox"))
+				return Domain::Xml::EType15Vbox;
+			if (text_ == QLatin1String("vzct"))
+				return Domain::Xml::EType15Vzct;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("bochs"))
+				return Domain::Xml::EType15Bochs;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("ramfb"))
+				return Domain::Xml::EType15Ramfb;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("vmvga"))
+				return Domain::Xml::EType15Vmvga;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("cirrus"))
+				return Domain::Xml::EType15Cirrus;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("virtio"))
+				return Domain::Xml::EType15Virtio;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EQemucdevSrcTypeChoice>::getText(Domain::Xml::EQemucdevSrcTypeChoice value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EQemucdevSrcTypeChoiceDev:
+		return QStringLiteral("dev");
+	case Domain::Xml::EQemucdevSrcTypeChoiceFile:
+		return QStringLiteral("file");
+	case Domain::Xml::EQemucdevSrcTypeChoicePipe:
+		return QStringLiteral("pipe");
+	case Domain::Xml::EQemucdevSrcTypeChoiceUnix:
+		return QStringLiteral("unix");
+	case Domain::Xml::EQemucdevSrcTypeChoiceTcp:
+		return QStringLiteral("tcp");
+	case Domain::Xml::EQemucdevSrcTypeChoiceUdp:
+		return QStringLiteral("udp");
+	case Domain::Xml::EQemucdevSrcTypeChoiceNull:
+		return QStringLiteral("null");
+	case Domain::Xml::EQemucdevSrcTypeChoiceStdio:
+		return QStringLiteral("stdio");
+	case Domain::Xml::EQemucdevSrcTypeChoiceVc:
+		return QStringLiteral("vc");
+	case Domain::Xml::EQemucdevSrcTypeChoicePty:
+		return QStringLiteral("pty");
+	case Domain::Xml::EQemucdevSrcTypeChoiceSpicevmc:
+		return QStringLiteral("spicevmc");
+	case Domain::Xml::EQemucdevSrcTypeChoiceSpiceport:
+		return QStringLiteral("spiceport");
+	case Domain::Xml::EQemucdevSrcTypeChoiceNmdm:
+		return QStringLiteral("nmdm");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EQemucdevSrcTypeChoice>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("vc"))
+				return Domain::Xml::EQemucdevSrcTypeChoiceVc;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("dev"))
+				return Domain::Xml::EQemucdevSrcTypeChoiceDev;
+			break;
+		case 'p':
+			if (text_ == QLatin1String("pty"))
+				return Domain::Xml::EQemucdevSrcTypeChoicePty;
+			break;
+		case 't':
+			if (text_ == QLatin1String("tcp"))
+				return Domain::Xml::EQemucdevSrcTypeChoiceTcp;
+			break;
+		case 'u':
+			if (text_ == QLatin1String("udp"))
+				return Domain::Xml::EQemucdevSrcTypeChoiceUdp;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("file"))
+				return Domain::Xml::EQemucdevSrcTypeChoiceFile;
+			break;
+		case 'n':
+			if (text_ == QLatin1String("null"))
+				return Domain::Xml::EQemucdevSrcTypeChoiceNull;
+			if (text_ == QLatin1String("nmdm"))
+				return Domain::Xml::EQemucdevSrcTypeChoiceNmdm;
+			break;
+		case 'p':
+			if (text_ == QLatin1String("pipe"))
+				return Domain::Xml::EQemucdevSrcTypeChoicePipe;
+			break;
+		case 'u':
+			if (text_ == QLatin1String("unix"))
+				return Domain::Xml::EQemucdevSrcTypeChoiceUnix;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("stdio"))
+				return Domain::Xml::EQemucdevSrcTypeChoiceStdio;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("spicevmc"))
+				return Domain::Xml::EQemucdevSrcTypeChoiceSpicevmc;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("spiceport"))
+				return Domain::Xml::EQemucdevSrcTypeChoiceSpiceport;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType16>::getText(Domain::Xml::EType16 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType16Raw:
+		return QStringLiteral("raw");
+	case Domain::Xml::EType16Telnet:
+		return QStringLiteral("telnet");
+	case Domain::Xml::EType16Telnets:
+		return QStringLiteral("telnets");
+	case Domain::Xml::EType16Tls:
+		return QStringLiteral("tls");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType16>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("raw"))
+				return Domain::Xml::EType16Raw;
+			break;
+		case 't':
+			if (text_ == QLatin1String("tls"))
+				return Domain::Xml::EType16Tls;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 't':
+			if (text_ == QLatin1String("telnet"))
+				return Domain::Xml::EType16Telnet;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 't':
+			if (text_ == QLatin1String("telnets"))
+				return Domain::Xml::EType16Telnets;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType17>::getText(Domain::Xml::EType17 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType17Xen:
+		return QStringLiteral("xen");
+	case Domain::Xml::EType17Serial:
+		return QStringLiteral("serial");
+	case Domain::Xml::EType17Uml:
+		return QStringLiteral("uml");
+	case Domain::Xml::EType17Virtio:
+		return QStringLiteral("virtio");
+	case Domain::Xml::EType17Lxc:
+		return QStringLiteral("lxc");
+	case Domain::Xml::EType17Openvz:
+		return QStringLiteral("openvz");
+	case Domain::Xml::EType17Sclp:
+		return QStringLiteral("sclp");
+	case Domain::Xml::EType17Sclplm:
+		return QStringLiteral("sclplm");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType17>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("lxc"))
+				return Domain::Xml::EType17Lxc;
+			break;
+		case 'u':
+			if (text_ == QLatin1String("uml"))
+				return Domain::Xml::EType17Uml;
+			break;
+		case 'x':
+			if (text_ == QLatin1String("xen"))
+				return Domain::Xml::EType17Xen;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("sclp"))
+				return Domain::Xml::EType17Sclp;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("openvz"))
+				return Domain::Xml::EType17Openvz;
+			break;
+		case 's':
+			if (text_ == QLatin1String("serial"))
+				return Domain::Xml::EType17Serial;
+			if (text_ == QLatin1String("sclplm"))
+				return Domain::Xml::EType17Sclplm;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("virtio"))
+				return Domain::Xml::EType17Virtio;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EType18>::getText(Domain::Xml::EType18 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EType18IsaSerial:
+		return QStringLiteral("isa-serial");
+	case Domain::Xml::EType18UsbSerial:
+		return QStringLiteral("usb-serial");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EType18>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("isa-serial"))
+				return Domain::Xml::EType18IsaSerial;
+			break;
+		case 'u':
+			if (text_ == QLatin1String("usb-serial"))
+				return Domain::Xml::EType18UsbSerial;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EName10>::getText(Domain::Xml::EName10 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EName10IsaSerial:
+		return QStringLiteral("isa-serial");
+	case Domain::Xml::EName10UsbSerial:
+		return QStringLiteral("usb-serial");
+	case Domain::Xml::EName10PciSerial:
+		return QStringLiteral("pci-serial");
+	case Domain::Xml::EName10SpaprVty:
+		return QStringLiteral("spapr-vty");
+	case Domain::Xml::EName10Pl011:
+		return QStringLiteral("pl011");
+	case Domain::Xml::EName10Sclpconsole:
+		return QStringLiteral("sclpconsole");
+	case Domain::Xml::EName10Sclplmconsole:
+		return QStringLiteral("sclplmconsole");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EName10>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pl011"))
+				return Domain::Xml::EName10Pl011;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("spapr-vty"))
+				return Domain::Xml::EName10SpaprVty;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("isa-serial"))
+				return Domain::Xml::EName10IsaSerial;
+			break;
+		case 'p':
+			if (text_ == QLatin1String("pci-serial"))
+				return Domain::Xml::EName10PciSerial;
+			break;
+		case 'u':
+			if (text_ == QLatin1String("usb-serial"))
+				return Domain::Xml::EName10UsbSerial;
+			break;
+		}
+		break;
+	case 11:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("sclpconsole"))
+				return Domain::Xml::EName10Sclpconsole;
+			break;
+		}
+		break;
+	case 13:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("sclplmconsole"))
+				return Domain::Xml::EName10Sclplmconsole;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EState1>::getText(Domain::Xml::EState1 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EState1Connected:
+		return QStringLiteral("connected");
+	case Domain::Xml::EState1Disconnected:
+		return QStringLiteral("disconnected");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EState1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("connected"))
+				return Domain::Xml::EState1Connected;
+			break;
+		}
+		break;
+	case 12:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("disconnected"))
+				return Domain::Xml::EState1Disconnected;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel9>::getText(Domain::Xml::EModel9 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel9Virtio:
+		return QStringLiteral("virtio");
+	case Domain::Xml::EModel9VirtioTransitional:
+		return QStringLiteral("virtio-transitional");
+	case Domain::Xml::EModel9VirtioNonTransitional:
+		return QStringLiteral("virtio-non-transitional");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel9>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio"))
+				return Domain::Xml::EModel9Virtio;
+			break;
+		}
+		break;
+	case 19:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-transitional"))
+				return Domain::Xml::EModel9VirtioTransitional;
+			break;
+		}
+		break;
+	case 23:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-non-transitional"))
+				return Domain::Xml::EModel9VirtioNonTransitional;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel10>::getText(Domain::Xml::EModel10 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel10TpmTis:
+		return QStringLiteral("tpm-tis");
+	case Domain::Xml::EModel10TpmCrb:
+		return QStringLiteral("tpm-crb");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel10>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 't':
+			if (text_ == QLatin1String("tpm-tis"))
+				return Domain::Xml::EModel10TpmTis;
+			if (text_ == QLatin1String("tpm-crb"))
+				return Domain::Xml::EModel10TpmCrb;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EVersion>::getText(Domain::Xml::EVersion value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EVersion12:
+		return QStringLiteral("1.2");
+	case Domain::Xml::EVersion20:
+		return QStringLiteral("2.0");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EVersion>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case '1':
+			if (text_ == QLatin1String("1.2"))
+				return Domain::Xml::EVersion12;
+			break;
+		case '2':
+			if (text_ == QLatin1String("2.0"))
+				return Domain::Xml::EVersion20;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel11>::getText(Domain::Xml::EModel11 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel11Dimm:
+		return QStringLiteral("dimm");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel11>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("dimm"))
+				return Domain::Xml::EModel11Dimm;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EAccess>::getText(Domain::Xml::EAccess value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EAccessShared:
+		return QStringLiteral("shared");
+	case Domain::Xml::EAccessPrivate:
+		return QStringLiteral("private");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EAccess>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("shared"))
+				return Domain::Xml::EAccessShared;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("private"))
+				return Domain::Xml::EAccessPrivate;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel12>::getText(Domain::Xml::EModel12 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel12I6300esb:
+		return QStringLiteral("i6300esb");
+	case Domain::Xml::EModel12Ib700:
+		return QStringLiteral("ib700");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel12>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("ib700"))
+				return Domain::Xml::EModel12Ib700;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("i6300esb"))
+				return Domain::Xml::EModel12I6300esb;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EAction>::getText(Domain::Xml::EAction value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EActionReset:
+		return QStringLiteral("reset");
+	case Domain::Xml::EActionShutdown:
+		return QStringLiteral("shutdown");
+	case Domain::Xml::EActionPoweroff:
+		return QStringLiteral("poweroff");
+	case Domain::Xml::EActionPause:
+		return QStringLiteral("pause");
+	case Domain::Xml::EActionNone:
+		return QStringLiteral("none");
+	case Domain::Xml::EActionDump:
+		return QStringLiteral("dump");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EAction>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("dump"))
+				return Domain::Xml::EActionDump;
+			break;
+		case 'n':
+			if (text_ == QLatin1String("none"))
+				return Domain::Xml::EActionNone;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pause"))
+				return Domain::Xml::EActionPause;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("reset"))
+				return Domain::Xml::EActionReset;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("poweroff"))
+				return Domain::Xml::EActionPoweroff;
+			break;
+		case 's':
+			if (text_ == QLatin1String("shutdown"))
+				return Domain::Xml::EActionShutdown;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel13>::getText(Domain::Xml::EModel13 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel13Virtio:
+		return QStringLiteral("virtio");
+	case Domain::Xml::EModel13VirtioTransitional:
+		return QStringLiteral("virtio-transitional");
+	case Domain::Xml::EModel13VirtioNonTransitional:
+		return QStringLiteral("virtio-non-transitional");
+	case Domain::Xml::EModel13Xen:
+		return QStringLiteral("xen");
+	case Domain::Xml::EModel13None:
+		return QStringLiteral("none");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel13>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'x':
+			if (text_ == QLatin1String("xen"))
+				return Domain::Xml::EModel13Xen;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("none"))
+				return Domain::Xml::EModel13None;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio"))
+				return Domain::Xml::EModel13Virtio;
+			break;
+		}
+		break;
+	case 19:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-transitional"))
+				return Domain::Xml::EModel13VirtioTransitional;
+			break;
+		}
+		break;
+	case 23:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("virtio-non-transitional"))
+				return Domain::Xml::EModel13VirtioNonTransitional;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EModel14>::getText(Domain::Xml::EModel14 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EModel14Isa:
+		return QStringLiteral("isa");
+	case Domain::Xml::EModel14Pseries:
+		return QStringLiteral("pseries");
+	case Domain::Xml::EModel14Hyperv:
+		return QStringLiteral("hyperv");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EModel14>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("isa"))
+				return Domain::Xml::EModel14Isa;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("hyperv"))
+				return Domain::Xml::EModel14Hyperv;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pseries"))
+				return Domain::Xml::EModel14Pseries;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Domain::Xml::EName11>::getText(Domain::Xml::EName11 value_)
+{
+	switch (value_)
+	{
+	case Domain::Xml::EName11Aes:
+		return QStringLiteral("aes");
+	case Domain::Xml::EName11Dea:
+		return QStringLiteral("dea");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Domain::Xml::EName11>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("aes"))
+				return Domain::Xml::EName11Aes;
+			break;
+		case 'd':
+			if (text_ == QLatin1String("dea"))
+				return Domain::Xml::EName11Dea;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 } // namespace Libvirt
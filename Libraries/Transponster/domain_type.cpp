@@ -65,7 +65,8 @@ int Traits<Domain::Xml::Ids>::parse(Domain::Xml::Ids& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Ids>::generate(const Domain::Xml::Ids& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Ids>::produce(const Domain::Xml::Ids& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -82,6 +83,16 @@ int Traits<Domain::Xml::Ids>::generate(const Domain::Xml::Ids& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Ids>::generate(const Domain::Xml::Ids& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Ids>::generate(const Domain::Xml::Ids& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Model
 
@@ -115,6 +126,13 @@ bool Model::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Model::save(QXmlStreamWriter& dst_) const
+{
+	Element<Model, Name::Strict<231> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -132,7 +150,8 @@ int Traits<Domain::Xml::Model>::parse(Domain::Xml::Model& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Model>::generate(const Domain::Xml::Model& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Model>::produce(const Domain::Xml::Model& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFallback(), m.get<0>()))
@@ -145,6 +164,16 @@ int Traits<Domain::Xml::Model>::generate(const Domain::Xml::Model& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Model>::generate(const Domain::Xml::Model& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Model>::generate(const Domain::Xml::Model& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Topology
 
@@ -182,6 +211,13 @@ bool Topology::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Topology::save(QXmlStreamWriter& dst_) const
+{
+	Element<Topology, Name::Strict<1028> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -200,7 +236,8 @@ int Traits<Domain::Xml::Topology>::parse(Domain::Xml::Topology& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Topology>::generate(const Domain::Xml::Topology& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Topology>::produce(const Domain::Xml::Topology& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSockets(), m.get<0>()))
@@ -215,6 +252,16 @@ int Traits<Domain::Xml::Topology>::generate(const Domain::Xml::Topology& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Topology>::generate(const Domain::Xml::Topology& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Topology>::generate(const Domain::Xml::Topology& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Feature
 
@@ -252,6 +299,13 @@ bool Feature::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Feature::save(QXmlStreamWriter& dst_) const
+{
+	Element<Feature, Name::Strict<1022> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -268,7 +322,8 @@ int Traits<Domain::Xml::Feature>::parse(Domain::Xml::Feature& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Feature>::generate(const Domain::Xml::Feature& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Feature>::produce(const Domain::Xml::Feature& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPolicy(), m.get<0>()))
@@ -279,6 +334,16 @@ int Traits<Domain::Xml::Feature>::generate(const Domain::Xml::Feature& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Feature>::generate(const Domain::Xml::Feature& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Feature>::generate(const Domain::Xml::Feature& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Sibling
 
@@ -316,6 +381,13 @@ bool Sibling::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Sibling::save(QXmlStreamWriter& dst_) const
+{
+	Element<Sibling, Name::Strict<5785> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -332,7 +404,8 @@ int Traits<Domain::Xml::Sibling>::parse(Domain::Xml::Sibling& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Sibling>::generate(const Domain::Xml::Sibling& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Sibling>::produce(const Domain::Xml::Sibling& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -343,6 +416,16 @@ int Traits<Domain::Xml::Sibling>::generate(const Domain::Xml::Sibling& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Sibling>::generate(const Domain::Xml::Sibling& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Sibling>::generate(const Domain::Xml::Sibling& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Size
 
@@ -380,6 +463,13 @@ bool Size::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Size::save(QXmlStreamWriter& dst_) const
+{
+	Element<Size, Name::Strict<334> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -396,7 +486,8 @@ int Traits<Domain::Xml::Size>::parse(Domain::Xml::Size& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Size>::generate(const Domain::Xml::Size& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Size>::produce(const Domain::Xml::Size& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getValue(), m.get<0>()))
@@ -407,6 +498,16 @@ int Traits<Domain::Xml::Size>::generate(const Domain::Xml::Size& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Size>::generate(const Domain::Xml::Size& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Size>::generate(const Domain::Xml::Size& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Line
 
@@ -444,6 +545,13 @@ bool Line::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Line::save(QXmlStreamWriter& dst_) const
+{
+	Element<Line, Name::Strict<5787> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -460,7 +568,8 @@ int Traits<Domain::Xml::Line>::parse(Domain::Xml::Line& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Line>::generate(const Domain::Xml::Line& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Line>::produce(const Domain::Xml::Line& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getValue(), m.get<0>()))
@@ -471,6 +580,16 @@ int Traits<Domain::Xml::Line>::generate(const Domain::Xml::Line& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Line>::generate(const Domain::Xml::Line& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Line>::generate(const Domain::Xml::Line& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Cache
 
@@ -508,6 +627,13 @@ bool Cache::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Cache::save(QXmlStreamWriter& dst_) const
+{
+	Element<Cache, Name::Strict<558> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -527,7 +653,8 @@ int Traits<Domain::Xml::Cache>::parse(Domain::Xml::Cache& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Cache>::generate(const Domain::Xml::Cache& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Cache>::produce(const Domain::Xml::Cache& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getLevel(), m.get<0>()))
@@ -544,6 +671,16 @@ int Traits<Domain::Xml::Cache>::generate(const Domain::Xml::Cache& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Cache>::generate(const Domain::Xml::Cache& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Cache>::generate(const Domain::Xml::Cache& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Cell
 
@@ -581,6 +718,13 @@ bool Cell::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Cell::save(QXmlStreamWriter& dst_) const
+{
+	Element<Cell, Name::Strict<1033> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -603,7 +747,8 @@ int Traits<Domain::Xml::Cell>::parse(Domain::Xml::Cell& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Cell>::generate(const Domain::Xml::Cell& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Cell>::produce(const Domain::Xml::Cell& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -626,6 +771,16 @@ int Traits<Domain::Xml::Cell>::generate(const Domain::Xml::Cell& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Cell>::generate(const Domain::Xml::Cell& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Cell>::generate(const Domain::Xml::Cell& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Latency
 
@@ -663,6 +818,13 @@ bool Latency::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Latency::save(QXmlStreamWriter& dst_) const
+{
+	Element<Latency, Name::Strict<5789> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -682,7 +844,8 @@ int Traits<Domain::Xml::Latency>::parse(Domain::Xml::Latency& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Latency>::generate(const Domain::Xml::Latency& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Latency>::produce(const Domain::Xml::Latency& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getInitiator(), m.get<0>()))
@@ -699,6 +862,16 @@ int Traits<Domain::Xml::Latency>::generate(const Domain::Xml::Latency& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Latency>::generate(const Domain::Xml::Latency& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Latency>::generate(const Domain::Xml::Latency& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Bandwidth
 
@@ -736,6 +909,13 @@ bool Bandwidth::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Bandwidth::save(QXmlStreamWriter& dst_) const
+{
+	Element<Bandwidth, Name::Strict<193> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -756,7 +936,8 @@ int Traits<Domain::Xml::Bandwidth>::parse(Domain::Xml::Bandwidth& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Bandwidth>::generate(const Domain::Xml::Bandwidth& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Bandwidth>::produce(const Domain::Xml::Bandwidth& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getInitiator(), m.get<0>()))
@@ -775,6 +956,16 @@ int Traits<Domain::Xml::Bandwidth>::generate(const Domain::Xml::Bandwidth& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Bandwidth>::generate(const Domain::Xml::Bandwidth& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Bandwidth>::generate(const Domain::Xml::Bandwidth& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interconnects
 
@@ -808,6 +999,13 @@ bool Interconnects::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Interconnects::save(QXmlStreamWriter& dst_) const
+{
+	Element<Interconnects, Name::Strict<5788> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -824,7 +1022,8 @@ int Traits<Domain::Xml::Interconnects>::parse(Domain::Xml::Interconnects& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Interconnects>::generate(const Domain::Xml::Interconnects& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Interconnects>::produce(const Domain::Xml::Interconnects& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getLatencyList(), m.get<0>()))
@@ -835,6 +1034,16 @@ int Traits<Domain::Xml::Interconnects>::generate(const Domain::Xml::Interconnect
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Interconnects>::generate(const Domain::Xml::Interconnects& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Interconnects>::generate(const Domain::Xml::Interconnects& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Numa
 
@@ -868,6 +1077,13 @@ bool Numa::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Numa::save(QXmlStreamWriter& dst_) const
+{
+	Element<Numa, Name::Strict<1031> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -884,7 +1100,8 @@ int Traits<Domain::Xml::Numa>::parse(Domain::Xml::Numa& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Numa>::generate(const Domain::Xml::Numa& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Numa>::produce(const Domain::Xml::Numa& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCellList(), m.get<0>()))
@@ -895,6 +1112,16 @@ int Traits<Domain::Xml::Numa>::generate(const Domain::Xml::Numa& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Numa>::generate(const Domain::Xml::Numa& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Numa>::generate(const Domain::Xml::Numa& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Cache1
 
@@ -932,6 +1159,13 @@ bool Cache1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Cache1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Cache1, Name::Strict<558> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -948,7 +1182,8 @@ int Traits<Domain::Xml::Cache1>::parse(Domain::Xml::Cache1& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Cache1>::generate(const Domain::Xml::Cache1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Cache1>::produce(const Domain::Xml::Cache1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getLevel(), m.get<0>()))
@@ -959,6 +1194,16 @@ int Traits<Domain::Xml::Cache1>::generate(const Domain::Xml::Cache1& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Cache1>::generate(const Domain::Xml::Cache1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Cache1>::generate(const Domain::Xml::Cache1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Cpu
 
@@ -992,6 +1237,13 @@ bool Cpu::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Cpu::save(QXmlStreamWriter& dst_) const
+{
+	Element<Cpu, Name::Strict<220> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -1016,7 +1268,8 @@ int Traits<Domain::Xml::Cpu>::parse(Domain::Xml::Cpu& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Cpu>::generate(const Domain::Xml::Cpu& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Cpu>::produce(const Domain::Xml::Cpu& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMode(), m.get<0>()))
@@ -1043,6 +1296,16 @@ int Traits<Domain::Xml::Cpu>::generate(const Domain::Xml::Cpu& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Cpu>::generate(const Domain::Xml::Cpu& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Cpu>::generate(const Domain::Xml::Cpu& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Entry
 
@@ -1080,6 +1343,13 @@ bool Entry::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Entry::save(QXmlStreamWriter& dst_) const
+{
+	Element<Entry, Name::Strict<1039> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -1096,7 +1366,8 @@ int Traits<Domain::Xml::Entry>::parse(Domain::Xml::Entry& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Entry>::generate(const Domain::Xml::Entry& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Entry>::produce(const Domain::Xml::Entry& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -1107,6 +1378,16 @@ int Traits<Domain::Xml::Entry>::generate(const Domain::Xml::Entry& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Entry>::generate(const Domain::Xml::Entry& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Entry>::generate(const Domain::Xml::Entry& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Entry1
 
@@ -1144,6 +1425,13 @@ bool Entry1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Entry1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Entry1, Name::Strict<1039> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -1160,7 +1448,8 @@ int Traits<Domain::Xml::Entry1>::parse(Domain::Xml::Entry1& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Entry1>::generate(const Domain::Xml::Entry1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Entry1>::produce(const Domain::Xml::Entry1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -1171,6 +1460,16 @@ int Traits<Domain::Xml::Entry1>::generate(const Domain::Xml::Entry1& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Entry1>::generate(const Domain::Xml::Entry1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Entry1>::generate(const Domain::Xml::Entry1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Entry2
 
@@ -1208,6 +1507,13 @@ bool Entry2::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Entry2::save(QXmlStreamWriter& dst_) const
+{
+	Element<Entry2, Name::Strict<1039> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -1224,7 +1530,8 @@ int Traits<Domain::Xml::Entry2>::parse(Domain::Xml::Entry2& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Entry2>::generate(const Domain::Xml::Entry2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Entry2>::produce(const Domain::Xml::Entry2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -1235,6 +1542,16 @@ int Traits<Domain::Xml::Entry2>::generate(const Domain::Xml::Entry2& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Entry2>::generate(const Domain::Xml::Entry2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Entry2>::generate(const Domain::Xml::Entry2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Entry3
 
@@ -1272,6 +1589,13 @@ bool Entry3::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Entry3::save(QXmlStreamWriter& dst_) const
+{
+	Element<Entry3, Name::Strict<1039> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -1288,7 +1612,8 @@ int Traits<Domain::Xml::Entry3>::parse(Domain::Xml::Entry3& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Entry3>::generate(const Domain::Xml::Entry3& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Entry3>::produce(const Domain::Xml::Entry3& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -1299,9 +1624,19 @@ int Traits<Domain::Xml::Entry3>::generate(const Domain::Xml::Entry3& src_, QDomE
 	return m.produce(dst_);
 }
 
-///////////////////////////////////////////////////////////////////////////////
-// struct Sysinfo
-
+int Traits<Domain::Xml::Entry3>::generate(const Domain::Xml::Entry3& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Entry3>::generate(const Domain::Xml::Entry3& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Sysinfo
+
 namespace Domain
 {
 namespace Xml
@@ -1332,6 +1667,13 @@ bool Sysinfo::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Sysinfo::save(QXmlStreamWriter& dst_) const
+{
+	Element<Sysinfo, Name::Strict<221> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -1351,7 +1693,8 @@ int Traits<Domain::Xml::Sysinfo>::parse(Domain::Xml::Sysinfo& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Sysinfo>::generate(const Domain::Xml::Sysinfo& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Sysinfo>::produce(const Domain::Xml::Sysinfo& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBios(), m.get<1>().get<0>()))
@@ -1368,6 +1711,16 @@ int Traits<Domain::Xml::Sysinfo>::generate(const Domain::Xml::Sysinfo& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Sysinfo>::generate(const Domain::Xml::Sysinfo& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Sysinfo>::generate(const Domain::Xml::Sysinfo& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Bootloader
 
@@ -1404,7 +1757,8 @@ int Traits<Domain::Xml::Bootloader>::parse(Domain::Xml::Bootloader& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Bootloader>::generate(const Domain::Xml::Bootloader& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Bootloader>::produce(const Domain::Xml::Bootloader& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBootloader(), m.get<0>()))
@@ -1415,6 +1769,16 @@ int Traits<Domain::Xml::Bootloader>::generate(const Domain::Xml::Bootloader& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Bootloader>::generate(const Domain::Xml::Bootloader& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Bootloader>::generate(const Domain::Xml::Bootloader& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Type
 
@@ -1452,6 +1816,13 @@ bool Type::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Type::save(QXmlStreamWriter& dst_) const
+{
+	Element<Type, Name::Strict<105> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -1469,7 +1840,8 @@ int Traits<Domain::Xml::Type>::parse(Domain::Xml::Type& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Type>::generate(const Domain::Xml::Type& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Type>::produce(const Domain::Xml::Type& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getArch(), m.get<0>()))
@@ -1482,6 +1854,16 @@ int Traits<Domain::Xml::Type>::generate(const Domain::Xml::Type& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Type>::generate(const Domain::Xml::Type& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Type>::generate(const Domain::Xml::Type& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Osbootkernel
 
@@ -1521,7 +1903,8 @@ int Traits<Domain::Xml::Osbootkernel>::parse(Domain::Xml::Osbootkernel& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::Osbootkernel>::generate(const Domain::Xml::Osbootkernel& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Osbootkernel>::produce(const Domain::Xml::Osbootkernel& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getKernel(), m.get<0>()))
@@ -1538,6 +1921,16 @@ int Traits<Domain::Xml::Osbootkernel>::generate(const Domain::Xml::Osbootkernel&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Osbootkernel>::generate(const Domain::Xml::Osbootkernel& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Osbootkernel>::generate(const Domain::Xml::Osbootkernel& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Os
 
@@ -1571,6 +1964,13 @@ bool Os::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Os::save(QXmlStreamWriter& dst_) const
+{
+	Element<Os, Name::Strict<222> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -1587,7 +1987,8 @@ int Traits<Domain::Xml::Os>::parse(Domain::Xml::Os& dst_, QStack<QDomElement>& s
 	return output;
 }
 
-int Traits<Domain::Xml::Os>::generate(const Domain::Xml::Os& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Os>::produce(const Domain::Xml::Os& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -1598,6 +1999,16 @@ int Traits<Domain::Xml::Os>::generate(const Domain::Xml::Os& src_, QDomElement&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Os>::generate(const Domain::Xml::Os& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Os>::generate(const Domain::Xml::Os& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Osxen6979
 
@@ -1613,7 +2024,8 @@ int Traits<Domain::Xml::Osxen6979>::parse(Domain::Xml::Osxen6979& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Osxen6979>::generate(const Domain::Xml::Osxen6979& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Osxen6979>::produce(const Domain::Xml::Osxen6979& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBootloader(), m.get<0>()))
@@ -1624,6 +2036,16 @@ int Traits<Domain::Xml::Osxen6979>::generate(const Domain::Xml::Osxen6979& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Osxen6979>::generate(const Domain::Xml::Osxen6979& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Osxen6979>::generate(const Domain::Xml::Osxen6979& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Os1
 
@@ -1657,6 +2079,13 @@ bool Os1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Os1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Os1, Name::Strict<222> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -1673,7 +2102,8 @@ int Traits<Domain::Xml::Os1>::parse(Domain::Xml::Os1& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Os1>::generate(const Domain::Xml::Os1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Os1>::produce(const Domain::Xml::Os1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -1684,6 +2114,16 @@ int Traits<Domain::Xml::Os1>::generate(const Domain::Xml::Os1& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Os1>::generate(const Domain::Xml::Os1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Os1>::generate(const Domain::Xml::Os1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Osxen6980
 
@@ -1699,7 +2139,8 @@ int Traits<Domain::Xml::Osxen6980>::parse(Domain::Xml::Osxen6980& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Osxen6980>::generate(const Domain::Xml::Osxen6980& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Osxen6980>::produce(const Domain::Xml::Osxen6980& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBootloader(), m.get<0>()))
@@ -1710,6 +2151,16 @@ int Traits<Domain::Xml::Osxen6980>::generate(const Domain::Xml::Osxen6980& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Osxen6980>::generate(const Domain::Xml::Osxen6980& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Osxen6980>::generate(const Domain::Xml::Osxen6980& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hvmx86
 
@@ -1725,7 +2176,8 @@ int Traits<Domain::Xml::Hvmx86>::parse(Domain::Xml::Hvmx86& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Hvmx86>::generate(const Domain::Xml::Hvmx86& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hvmx86>::produce(const Domain::Xml::Hvmx86& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getArch(), m.get<0>()))
@@ -1736,6 +2188,16 @@ int Traits<Domain::Xml::Hvmx86>::generate(const Domain::Xml::Hvmx86& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hvmx86>::generate(const Domain::Xml::Hvmx86& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hvmx86>::generate(const Domain::Xml::Hvmx86& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hvmmips
 
@@ -1745,12 +2207,23 @@ int Traits<Domain::Xml::Hvmmips>::parse(Domain::Xml::Hvmmips& , QStack<QDomEleme
 	return m.consume(stack_);
 }
 
-int Traits<Domain::Xml::Hvmmips>::generate(const Domain::Xml::Hvmmips& , QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hvmmips>::produce(const Domain::Xml::Hvmmips& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hvmmips>::generate(const Domain::Xml::Hvmmips& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hvmmips>::generate(const Domain::Xml::Hvmmips& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hvmsparc
 
@@ -1760,12 +2233,23 @@ int Traits<Domain::Xml::Hvmsparc>::parse(Domain::Xml::Hvmsparc& , QStack<QDomEle
 	return m.consume(stack_);
 }
 
-int Traits<Domain::Xml::Hvmsparc>::generate(const Domain::Xml::Hvmsparc& , QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hvmsparc>::produce(const Domain::Xml::Hvmsparc& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hvmsparc>::generate(const Domain::Xml::Hvmsparc& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hvmsparc>::generate(const Domain::Xml::Hvmsparc& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hvms390
 
@@ -1781,7 +2265,8 @@ int Traits<Domain::Xml::Hvms390>::parse(Domain::Xml::Hvms390& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Hvms390>::generate(const Domain::Xml::Hvms390& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hvms390>::produce(const Domain::Xml::Hvms390& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getArch(), m.get<0>()))
@@ -1792,6 +2277,16 @@ int Traits<Domain::Xml::Hvms390>::generate(const Domain::Xml::Hvms390& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hvms390>::generate(const Domain::Xml::Hvms390& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hvms390>::generate(const Domain::Xml::Hvms390& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hvmarm
 
@@ -1807,7 +2302,8 @@ int Traits<Domain::Xml::Hvmarm>::parse(Domain::Xml::Hvmarm& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Hvmarm>::generate(const Domain::Xml::Hvmarm& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hvmarm>::produce(const Domain::Xml::Hvmarm& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getArch(), m.get<0>()))
@@ -1818,6 +2314,16 @@ int Traits<Domain::Xml::Hvmarm>::generate(const Domain::Xml::Hvmarm& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hvmarm>::generate(const Domain::Xml::Hvmarm& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hvmarm>::generate(const Domain::Xml::Hvmarm& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hvmaarch64
 
@@ -1833,7 +2339,8 @@ int Traits<Domain::Xml::Hvmaarch64>::parse(Domain::Xml::Hvmaarch64& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Hvmaarch64>::generate(const Domain::Xml::Hvmaarch64& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hvmaarch64>::produce(const Domain::Xml::Hvmaarch64& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getArch(), m.get<0>()))
@@ -1844,6 +2351,16 @@ int Traits<Domain::Xml::Hvmaarch64>::generate(const Domain::Xml::Hvmaarch64& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hvmaarch64>::generate(const Domain::Xml::Hvmaarch64& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hvmaarch64>::generate(const Domain::Xml::Hvmaarch64& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Loader
 
@@ -1877,6 +2394,13 @@ bool Loader::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Loader::save(QXmlStreamWriter& dst_) const
+{
+	Element<Loader, Name::Strict<273> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -1895,7 +2419,8 @@ int Traits<Domain::Xml::Loader>::parse(Domain::Xml::Loader& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Loader>::generate(const Domain::Xml::Loader& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Loader>::produce(const Domain::Xml::Loader& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getReadonly(), m.get<0>()))
@@ -1910,6 +2435,16 @@ int Traits<Domain::Xml::Loader>::generate(const Domain::Xml::Loader& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Loader>::generate(const Domain::Xml::Loader& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Loader>::generate(const Domain::Xml::Loader& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Seclabel6973
 
@@ -1919,12 +2454,23 @@ int Traits<Domain::Xml::Seclabel6973>::parse(Domain::Xml::Seclabel6973& , QStack
 	return m.consume(stack_);
 }
 
-int Traits<Domain::Xml::Seclabel6973>::generate(const Domain::Xml::Seclabel6973& , QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Seclabel6973>::produce(const Domain::Xml::Seclabel6973& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Seclabel6973>::generate(const Domain::Xml::Seclabel6973& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Seclabel6973>::generate(const Domain::Xml::Seclabel6973& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Seclabel6974
 
@@ -1934,12 +2480,23 @@ int Traits<Domain::Xml::Seclabel6974>::parse(Domain::Xml::Seclabel6974& , QStack
 	return m.consume(stack_);
 }
 
-int Traits<Domain::Xml::Seclabel6974>::generate(const Domain::Xml::Seclabel6974& , QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Seclabel6974>::produce(const Domain::Xml::Seclabel6974& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Seclabel6974>::generate(const Domain::Xml::Seclabel6974& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Seclabel6974>::generate(const Domain::Xml::Seclabel6974& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Seclabel
 
@@ -1973,6 +2530,13 @@ bool Seclabel::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Seclabel::save(QXmlStreamWriter& dst_) const
+{
+	Element<Seclabel, Name::Strict<229> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -1989,7 +2553,8 @@ int Traits<Domain::Xml::Seclabel>::parse(Domain::Xml::Seclabel& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Seclabel>::generate(const Domain::Xml::Seclabel& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Seclabel>::produce(const Domain::Xml::Seclabel& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -2000,6 +2565,16 @@ int Traits<Domain::Xml::Seclabel>::generate(const Domain::Xml::Seclabel& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Seclabel>::generate(const Domain::Xml::Seclabel& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Seclabel>::generate(const Domain::Xml::Seclabel& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source
 
@@ -2033,6 +2608,13 @@ bool Source::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -2050,7 +2632,8 @@ int Traits<Domain::Xml::Source>::parse(Domain::Xml::Source& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Source>::generate(const Domain::Xml::Source& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source>::produce(const Domain::Xml::Source& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDev(), m.get<0>()))
@@ -2063,6 +2646,16 @@ int Traits<Domain::Xml::Source>::generate(const Domain::Xml::Source& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source>::generate(const Domain::Xml::Source& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source>::generate(const Domain::Xml::Source& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Anonymous7117
 
@@ -2099,7 +2692,8 @@ int Traits<Domain::Xml::Anonymous7117>::parse(Domain::Xml::Anonymous7117& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Anonymous7117>::generate(const Domain::Xml::Anonymous7117& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Anonymous7117>::produce(const Domain::Xml::Anonymous7117& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMode(), m.get<0>()))
@@ -2110,6 +2704,16 @@ int Traits<Domain::Xml::Anonymous7117>::generate(const Domain::Xml::Anonymous711
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Anonymous7117>::generate(const Domain::Xml::Anonymous7117& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Anonymous7117>::generate(const Domain::Xml::Anonymous7117& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Keycipher
 
@@ -2147,6 +2751,13 @@ bool Keycipher::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Keycipher::save(QXmlStreamWriter& dst_) const
+{
+	Element<Keycipher, Name::Strict<5049> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -2164,7 +2775,8 @@ int Traits<Domain::Xml::Keycipher>::parse(Domain::Xml::Keycipher& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Keycipher>::generate(const Domain::Xml::Keycipher& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Keycipher>::produce(const Domain::Xml::Keycipher& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -2177,6 +2789,16 @@ int Traits<Domain::Xml::Keycipher>::generate(const Domain::Xml::Keycipher& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Keycipher>::generate(const Domain::Xml::Keycipher& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Keycipher>::generate(const Domain::Xml::Keycipher& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Keyivgen
 
@@ -2210,6 +2832,13 @@ bool Keyivgen::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Keyivgen::save(QXmlStreamWriter& dst_) const
+{
+	Element<Keyivgen, Name::Strict<5751> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -2226,7 +2855,8 @@ int Traits<Domain::Xml::Keyivgen>::parse(Domain::Xml::Keyivgen& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Keyivgen>::generate(const Domain::Xml::Keyivgen& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Keyivgen>::produce(const Domain::Xml::Keyivgen& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -2237,6 +2867,16 @@ int Traits<Domain::Xml::Keyivgen>::generate(const Domain::Xml::Keyivgen& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Keyivgen>::generate(const Domain::Xml::Keyivgen& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Keyivgen>::generate(const Domain::Xml::Keyivgen& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Anonymous7118
 
@@ -2273,7 +2913,8 @@ int Traits<Domain::Xml::Anonymous7118>::parse(Domain::Xml::Anonymous7118& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Anonymous7118>::generate(const Domain::Xml::Anonymous7118& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Anonymous7118>::produce(const Domain::Xml::Anonymous7118& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCipher(), m.get<0>()))
@@ -2284,6 +2925,16 @@ int Traits<Domain::Xml::Anonymous7118>::generate(const Domain::Xml::Anonymous711
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Anonymous7118>::generate(const Domain::Xml::Anonymous7118& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Anonymous7118>::generate(const Domain::Xml::Anonymous7118& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Encryption
 
@@ -2321,6 +2972,13 @@ bool Encryption::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Encryption::save(QXmlStreamWriter& dst_) const
+{
+	Element<Encryption, Name::Strict<145> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -2338,7 +2996,8 @@ int Traits<Domain::Xml::Encryption>::parse(Domain::Xml::Encryption& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Encryption>::generate(const Domain::Xml::Encryption& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Encryption>::produce(const Domain::Xml::Encryption& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFormat(), m.get<0>()))
@@ -2351,6 +3010,16 @@ int Traits<Domain::Xml::Encryption>::generate(const Domain::Xml::Encryption& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Encryption>::generate(const Domain::Xml::Encryption& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Encryption>::generate(const Domain::Xml::Encryption& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source1
 
@@ -2384,6 +3053,13 @@ bool Source1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source1, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -2401,7 +3077,8 @@ int Traits<Domain::Xml::Source1>::parse(Domain::Xml::Source1& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Source1>::generate(const Domain::Xml::Source1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source1>::produce(const Domain::Xml::Source1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDir(), m.get<0>()))
@@ -2414,6 +3091,16 @@ int Traits<Domain::Xml::Source1>::generate(const Domain::Xml::Source1& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source1>::generate(const Domain::Xml::Source1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source1>::generate(const Domain::Xml::Source1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Host7010
 
@@ -2430,7 +3117,8 @@ int Traits<Domain::Xml::Host7010>::parse(Domain::Xml::Host7010& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Host7010>::generate(const Domain::Xml::Host7010& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Host7010>::produce(const Domain::Xml::Host7010& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getTransport(), m.get<0>()))
@@ -2443,6 +3131,16 @@ int Traits<Domain::Xml::Host7010>::generate(const Domain::Xml::Host7010& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Host7010>::generate(const Domain::Xml::Host7010& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Host7010>::generate(const Domain::Xml::Host7010& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source2
 
@@ -2480,6 +3178,13 @@ bool Source2::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source2::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source2, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -2497,7 +3202,8 @@ int Traits<Domain::Xml::Source2>::parse(Domain::Xml::Source2& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Source2>::generate(const Domain::Xml::Source2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source2>::produce(const Domain::Xml::Source2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getProtocol(), m.get<0>()))
@@ -2510,6 +3216,16 @@ int Traits<Domain::Xml::Source2>::generate(const Domain::Xml::Source2& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source2>::generate(const Domain::Xml::Source2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source2>::generate(const Domain::Xml::Source2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source3
 
@@ -2543,6 +3259,13 @@ bool Source3::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source3::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source3, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -2563,7 +3286,8 @@ int Traits<Domain::Xml::Source3>::parse(Domain::Xml::Source3& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Source3>::generate(const Domain::Xml::Source3& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source3>::produce(const Domain::Xml::Source3& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPool(), m.get<0>()))
@@ -2582,6 +3306,16 @@ int Traits<Domain::Xml::Source3>::generate(const Domain::Xml::Source3& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source3>::generate(const Domain::Xml::Source3& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source3>::generate(const Domain::Xml::Source3& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source4
 
@@ -2615,6 +3349,13 @@ bool Source4::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source4::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source4, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -2632,7 +3373,8 @@ int Traits<Domain::Xml::Source4>::parse(Domain::Xml::Source4& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Source4>::generate(const Domain::Xml::Source4& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source4>::produce(const Domain::Xml::Source4& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFile(), m.get<0>()))
@@ -2645,6 +3387,16 @@ int Traits<Domain::Xml::Source4>::generate(const Domain::Xml::Source4& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source4>::generate(const Domain::Xml::Source4& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source4>::generate(const Domain::Xml::Source4& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Nvram
 
@@ -2678,6 +3430,13 @@ bool Nvram::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Nvram::save(QXmlStreamWriter& dst_) const
+{
+	Element<Nvram, Name::Strict<277> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -2695,7 +3454,8 @@ int Traits<Domain::Xml::Nvram>::parse(Domain::Xml::Nvram& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Nvram>::generate(const Domain::Xml::Nvram& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Nvram>::produce(const Domain::Xml::Nvram& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getTemplate(), m.get<0>()))
@@ -2708,6 +3468,16 @@ int Traits<Domain::Xml::Nvram>::generate(const Domain::Xml::Nvram& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Nvram>::generate(const Domain::Xml::Nvram& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Nvram>::generate(const Domain::Xml::Nvram& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Bootmenu
 
@@ -2745,6 +3515,13 @@ bool Bootmenu::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Bootmenu::save(QXmlStreamWriter& dst_) const
+{
+	Element<Bootmenu, Name::Strict<280> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -2761,7 +3538,8 @@ int Traits<Domain::Xml::Bootmenu>::parse(Domain::Xml::Bootmenu& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Bootmenu>::generate(const Domain::Xml::Bootmenu& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Bootmenu>::produce(const Domain::Xml::Bootmenu& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getEnable(), m.get<0>()))
@@ -2772,6 +3550,16 @@ int Traits<Domain::Xml::Bootmenu>::generate(const Domain::Xml::Bootmenu& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Bootmenu>::generate(const Domain::Xml::Bootmenu& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Bootmenu>::generate(const Domain::Xml::Bootmenu& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Bios
 
@@ -2805,6 +3593,13 @@ bool Bios::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Bios::save(QXmlStreamWriter& dst_) const
+{
+	Element<Bios, Name::Strict<284> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -2821,7 +3616,8 @@ int Traits<Domain::Xml::Bios>::parse(Domain::Xml::Bios& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Bios>::generate(const Domain::Xml::Bios& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Bios>::produce(const Domain::Xml::Bios& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getUseserial(), m.get<0>()))
@@ -2832,6 +3628,16 @@ int Traits<Domain::Xml::Bios>::generate(const Domain::Xml::Bios& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Bios>::generate(const Domain::Xml::Bios& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Bios>::generate(const Domain::Xml::Bios& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Os2
 
@@ -2865,6 +3671,13 @@ bool Os2::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Os2::save(QXmlStreamWriter& dst_) const
+{
+	Element<Os2, Name::Strict<222> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -2888,7 +3701,8 @@ int Traits<Domain::Xml::Os2>::parse(Domain::Xml::Os2& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Os2>::generate(const Domain::Xml::Os2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Os2>::produce(const Domain::Xml::Os2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -2913,6 +3727,16 @@ int Traits<Domain::Xml::Os2>::generate(const Domain::Xml::Os2& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Os2>::generate(const Domain::Xml::Os2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Os2>::generate(const Domain::Xml::Os2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Initenv
 
@@ -2946,6 +3770,13 @@ bool Initenv::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Initenv::save(QXmlStreamWriter& dst_) const
+{
+	Element<Initenv, Name::Strict<9348> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -2962,7 +3793,8 @@ int Traits<Domain::Xml::Initenv>::parse(Domain::Xml::Initenv& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Initenv>::generate(const Domain::Xml::Initenv& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Initenv>::produce(const Domain::Xml::Initenv& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -2973,6 +3805,16 @@ int Traits<Domain::Xml::Initenv>::generate(const Domain::Xml::Initenv& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Initenv>::generate(const Domain::Xml::Initenv& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Initenv>::generate(const Domain::Xml::Initenv& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Os3
 
@@ -3006,6 +3848,13 @@ bool Os3::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Os3::save(QXmlStreamWriter& dst_) const
+{
+	Element<Os3, Name::Strict<222> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -3027,7 +3876,8 @@ int Traits<Domain::Xml::Os3>::parse(Domain::Xml::Os3& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Os3>::generate(const Domain::Xml::Os3& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Os3>::produce(const Domain::Xml::Os3& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -3048,6 +3898,16 @@ int Traits<Domain::Xml::Os3>::generate(const Domain::Xml::Os3& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Os3>::generate(const Domain::Xml::Os3& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Os3>::generate(const Domain::Xml::Os3& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Clock6991
 
@@ -3075,7 +3935,8 @@ int Traits<Domain::Xml::Clock6991>::parse(Domain::Xml::Clock6991& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Clock6991>::generate(const Domain::Xml::Clock6991& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Clock6991>::produce(const Domain::Xml::Clock6991& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getOffset(), m.get<0>()))
@@ -3086,6 +3947,16 @@ int Traits<Domain::Xml::Clock6991>::generate(const Domain::Xml::Clock6991& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Clock6991>::generate(const Domain::Xml::Clock6991& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Clock6991>::generate(const Domain::Xml::Clock6991& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Clock6993
 
@@ -3101,7 +3972,8 @@ int Traits<Domain::Xml::Clock6993>::parse(Domain::Xml::Clock6993& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Clock6993>::generate(const Domain::Xml::Clock6993& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Clock6993>::produce(const Domain::Xml::Clock6993& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAdjustment(), m.get<1>()))
@@ -3112,6 +3984,16 @@ int Traits<Domain::Xml::Clock6993>::generate(const Domain::Xml::Clock6993& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Clock6993>::generate(const Domain::Xml::Clock6993& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Clock6993>::generate(const Domain::Xml::Clock6993& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Catchup
 
@@ -3145,6 +4027,13 @@ bool Catchup::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Catchup::save(QXmlStreamWriter& dst_) const
+{
+	Element<Catchup, Name::Strict<430> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -3162,7 +4051,8 @@ int Traits<Domain::Xml::Catchup>::parse(Domain::Xml::Catchup& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Catchup>::generate(const Domain::Xml::Catchup& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Catchup>::produce(const Domain::Xml::Catchup& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getThreshold(), m.get<0>()))
@@ -3175,6 +4065,16 @@ int Traits<Domain::Xml::Catchup>::generate(const Domain::Xml::Catchup& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Catchup>::generate(const Domain::Xml::Catchup& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Catchup>::generate(const Domain::Xml::Catchup& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Timer6994
 
@@ -3203,7 +4103,8 @@ int Traits<Domain::Xml::Timer6994>::parse(Domain::Xml::Timer6994& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Timer6994>::generate(const Domain::Xml::Timer6994& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Timer6994>::produce(const Domain::Xml::Timer6994& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -3216,6 +4117,16 @@ int Traits<Domain::Xml::Timer6994>::generate(const Domain::Xml::Timer6994& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Timer6994>::generate(const Domain::Xml::Timer6994& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Timer6994>::generate(const Domain::Xml::Timer6994& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Timer6995
 
@@ -3232,7 +4143,8 @@ int Traits<Domain::Xml::Timer6995>::parse(Domain::Xml::Timer6995& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Timer6995>::generate(const Domain::Xml::Timer6995& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Timer6995>::produce(const Domain::Xml::Timer6995& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getTickpolicy(), m.get<1>()))
@@ -3245,6 +4157,16 @@ int Traits<Domain::Xml::Timer6995>::generate(const Domain::Xml::Timer6995& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Timer6995>::generate(const Domain::Xml::Timer6995& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Timer6995>::generate(const Domain::Xml::Timer6995& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Timer6996
 
@@ -3272,7 +4194,8 @@ int Traits<Domain::Xml::Timer6996>::parse(Domain::Xml::Timer6996& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Timer6996>::generate(const Domain::Xml::Timer6996& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Timer6996>::produce(const Domain::Xml::Timer6996& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -3283,6 +4206,16 @@ int Traits<Domain::Xml::Timer6996>::generate(const Domain::Xml::Timer6996& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Timer6996>::generate(const Domain::Xml::Timer6996& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Timer6996>::generate(const Domain::Xml::Timer6996& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Timer
 
@@ -3316,6 +4249,13 @@ bool Timer::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Timer::save(QXmlStreamWriter& dst_) const
+{
+	Element<Timer, Name::Strict<403> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -3332,7 +4272,8 @@ int Traits<Domain::Xml::Timer>::parse(Domain::Xml::Timer& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Timer>::generate(const Domain::Xml::Timer& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Timer>::produce(const Domain::Xml::Timer& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getTimer(), m.get<0>()))
@@ -3343,6 +4284,16 @@ int Traits<Domain::Xml::Timer>::generate(const Domain::Xml::Timer& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Timer>::generate(const Domain::Xml::Timer& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Timer>::generate(const Domain::Xml::Timer& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Clock
 
@@ -3376,6 +4327,13 @@ bool Clock::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Clock::save(QXmlStreamWriter& dst_) const
+{
+	Element<Clock, Name::Strict<223> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -3392,7 +4350,8 @@ int Traits<Domain::Xml::Clock>::parse(Domain::Xml::Clock& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Clock>::generate(const Domain::Xml::Clock& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Clock>::produce(const Domain::Xml::Clock& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getClock(), m.get<0>()))
@@ -3403,6 +4362,16 @@ int Traits<Domain::Xml::Clock>::generate(const Domain::Xml::Clock& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Clock>::generate(const Domain::Xml::Clock& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Clock>::generate(const Domain::Xml::Clock& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct ScaledInteger
 
@@ -3440,6 +4409,13 @@ bool ScaledInteger::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool ScaledInteger::save(QXmlStreamWriter& dst_) const
+{
+	Element<ScaledInteger, Name::Strict<334> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -3456,7 +4432,8 @@ int Traits<Domain::Xml::ScaledInteger>::parse(Domain::Xml::ScaledInteger& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::ScaledInteger>::generate(const Domain::Xml::ScaledInteger& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::ScaledInteger>::produce(const Domain::Xml::ScaledInteger& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getUnit(), m.get<0>()))
@@ -3467,6 +4444,16 @@ int Traits<Domain::Xml::ScaledInteger>::generate(const Domain::Xml::ScaledIntege
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::ScaledInteger>::generate(const Domain::Xml::ScaledInteger& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::ScaledInteger>::generate(const Domain::Xml::ScaledInteger& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Memory
 
@@ -3500,6 +4487,13 @@ bool Memory::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Memory::save(QXmlStreamWriter& dst_) const
+{
+	Element<Memory, Name::Strict<326> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -3516,7 +4510,8 @@ int Traits<Domain::Xml::Memory>::parse(Domain::Xml::Memory& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Memory>::generate(const Domain::Xml::Memory& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Memory>::produce(const Domain::Xml::Memory& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getScaledInteger(), m.get<0>()))
@@ -3527,6 +4522,16 @@ int Traits<Domain::Xml::Memory>::generate(const Domain::Xml::Memory& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Memory>::generate(const Domain::Xml::Memory& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Memory>::generate(const Domain::Xml::Memory& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct MaxMemory
 
@@ -3564,6 +4569,13 @@ bool MaxMemory::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool MaxMemory::save(QXmlStreamWriter& dst_) const
+{
+	Element<MaxMemory, Name::Strict<328> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -3580,7 +4592,8 @@ int Traits<Domain::Xml::MaxMemory>::parse(Domain::Xml::MaxMemory& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::MaxMemory>::generate(const Domain::Xml::MaxMemory& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::MaxMemory>::produce(const Domain::Xml::MaxMemory& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getScaledInteger(), m.get<0>()))
@@ -3591,6 +4604,16 @@ int Traits<Domain::Xml::MaxMemory>::generate(const Domain::Xml::MaxMemory& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::MaxMemory>::generate(const Domain::Xml::MaxMemory& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::MaxMemory>::generate(const Domain::Xml::MaxMemory& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Page
 
@@ -3628,6 +4651,13 @@ bool Page::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Page::save(QXmlStreamWriter& dst_) const
+{
+	Element<Page, Name::Strict<333> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -3645,7 +4675,8 @@ int Traits<Domain::Xml::Page>::parse(Domain::Xml::Page& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Page>::generate(const Domain::Xml::Page& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Page>::produce(const Domain::Xml::Page& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSize(), m.get<0>()))
@@ -3658,6 +4689,16 @@ int Traits<Domain::Xml::Page>::generate(const Domain::Xml::Page& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Page>::generate(const Domain::Xml::Page& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Page>::generate(const Domain::Xml::Page& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct MemoryBacking
 
@@ -3695,6 +4736,13 @@ bool MemoryBacking::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool MemoryBacking::save(QXmlStreamWriter& dst_) const
+{
+	Element<MemoryBacking, Name::Strict<331> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -3716,7 +4764,8 @@ int Traits<Domain::Xml::MemoryBacking>::parse(Domain::Xml::MemoryBacking& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::MemoryBacking>::generate(const Domain::Xml::MemoryBacking& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::MemoryBacking>::produce(const Domain::Xml::MemoryBacking& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getHugepages(), m.get<0>()))
@@ -3737,6 +4786,16 @@ int Traits<Domain::Xml::MemoryBacking>::generate(const Domain::Xml::MemoryBackin
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::MemoryBacking>::generate(const Domain::Xml::MemoryBacking& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::MemoryBacking>::generate(const Domain::Xml::MemoryBacking& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Vcpu
 
@@ -3774,6 +4833,13 @@ bool Vcpu::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Vcpu::save(QXmlStreamWriter& dst_) const
+{
+	Element<Vcpu, Name::Strict<338> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -3792,7 +4858,8 @@ int Traits<Domain::Xml::Vcpu>::parse(Domain::Xml::Vcpu& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Vcpu>::generate(const Domain::Xml::Vcpu& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Vcpu>::produce(const Domain::Xml::Vcpu& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPlacement(), m.get<0>()))
@@ -3807,6 +4874,16 @@ int Traits<Domain::Xml::Vcpu>::generate(const Domain::Xml::Vcpu& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Vcpu>::generate(const Domain::Xml::Vcpu& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Vcpu>::generate(const Domain::Xml::Vcpu& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Vcpu1
 
@@ -3844,6 +4921,13 @@ bool Vcpu1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Vcpu1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Vcpu1, Name::Strict<338> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -3862,7 +4946,8 @@ int Traits<Domain::Xml::Vcpu1>::parse(Domain::Xml::Vcpu1& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Vcpu1>::generate(const Domain::Xml::Vcpu1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Vcpu1>::produce(const Domain::Xml::Vcpu1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -3877,6 +4962,16 @@ int Traits<Domain::Xml::Vcpu1>::generate(const Domain::Xml::Vcpu1& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Vcpu1>::generate(const Domain::Xml::Vcpu1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Vcpu1>::generate(const Domain::Xml::Vcpu1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Device
 
@@ -3910,6 +5005,13 @@ bool Device::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Device::save(QXmlStreamWriter& dst_) const
+{
+	Element<Device, Name::Strict<354> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -3930,7 +5032,8 @@ int Traits<Domain::Xml::Device>::parse(Domain::Xml::Device& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Device>::generate(const Domain::Xml::Device& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Device>::produce(const Domain::Xml::Device& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPath(), m.get<0>()))
@@ -3949,6 +5052,16 @@ int Traits<Domain::Xml::Device>::generate(const Domain::Xml::Device& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Device>::generate(const Domain::Xml::Device& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Device>::generate(const Domain::Xml::Device& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Blkiotune
 
@@ -3982,6 +5095,13 @@ bool Blkiotune::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Blkiotune::save(QXmlStreamWriter& dst_) const
+{
+	Element<Blkiotune, Name::Strict<348> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -3998,7 +5118,8 @@ int Traits<Domain::Xml::Blkiotune>::parse(Domain::Xml::Blkiotune& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Blkiotune>::generate(const Domain::Xml::Blkiotune& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Blkiotune>::produce(const Domain::Xml::Blkiotune& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getWeight(), m.get<0>()))
@@ -4006,7 +5127,17 @@ int Traits<Domain::Xml::Blkiotune>::generate(const Domain::Xml::Blkiotune& src_,
 	if (0 > Details::Marshal::assign(src_.getDeviceList(), m.get<1>()))
 		return -1;
 
-	return m.produce(dst_);
+	return m.produce(dst_);
+}
+
+int Traits<Domain::Xml::Blkiotune>::generate(const Domain::Xml::Blkiotune& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Blkiotune>::generate(const Domain::Xml::Blkiotune& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4042,6 +5173,13 @@ bool Memtune::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Memtune::save(QXmlStreamWriter& dst_) const
+{
+	Element<Memtune, Name::Strict<349> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4060,7 +5198,8 @@ int Traits<Domain::Xml::Memtune>::parse(Domain::Xml::Memtune& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Memtune>::generate(const Domain::Xml::Memtune& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Memtune>::produce(const Domain::Xml::Memtune& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getHardLimit(), m.get<0>()))
@@ -4075,6 +5214,16 @@ int Traits<Domain::Xml::Memtune>::generate(const Domain::Xml::Memtune& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Memtune>::generate(const Domain::Xml::Memtune& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Memtune>::generate(const Domain::Xml::Memtune& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Vcpupin
 
@@ -4112,6 +5261,13 @@ bool Vcpupin::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Vcpupin::save(QXmlStreamWriter& dst_) const
+{
+	Element<Vcpupin, Name::Strict<374> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4128,7 +5284,8 @@ int Traits<Domain::Xml::Vcpupin>::parse(Domain::Xml::Vcpupin& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Vcpupin>::generate(const Domain::Xml::Vcpupin& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Vcpupin>::produce(const Domain::Xml::Vcpupin& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getVcpu(), m.get<0>()))
@@ -4139,6 +5296,16 @@ int Traits<Domain::Xml::Vcpupin>::generate(const Domain::Xml::Vcpupin& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Vcpupin>::generate(const Domain::Xml::Vcpupin& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Vcpupin>::generate(const Domain::Xml::Vcpupin& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Iothreadpin
 
@@ -4176,6 +5343,13 @@ bool Iothreadpin::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Iothreadpin::save(QXmlStreamWriter& dst_) const
+{
+	Element<Iothreadpin, Name::Strict<377> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4192,7 +5366,8 @@ int Traits<Domain::Xml::Iothreadpin>::parse(Domain::Xml::Iothreadpin& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Iothreadpin>::generate(const Domain::Xml::Iothreadpin& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Iothreadpin>::produce(const Domain::Xml::Iothreadpin& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIothread(), m.get<0>()))
@@ -4203,6 +5378,16 @@ int Traits<Domain::Xml::Iothreadpin>::generate(const Domain::Xml::Iothreadpin& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Iothreadpin>::generate(const Domain::Xml::Iothreadpin& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Iothreadpin>::generate(const Domain::Xml::Iothreadpin& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Schedparam9370
 
@@ -4230,7 +5415,8 @@ int Traits<Domain::Xml::Schedparam9370>::parse(Domain::Xml::Schedparam9370& dst_
 	return output;
 }
 
-int Traits<Domain::Xml::Schedparam9370>::generate(const Domain::Xml::Schedparam9370& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Schedparam9370>::produce(const Domain::Xml::Schedparam9370& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getScheduler(), m.get<0>()))
@@ -4241,6 +5427,16 @@ int Traits<Domain::Xml::Schedparam9370>::generate(const Domain::Xml::Schedparam9
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Schedparam9370>::generate(const Domain::Xml::Schedparam9370& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Schedparam9370>::generate(const Domain::Xml::Schedparam9370& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Vcpusched
 
@@ -4274,6 +5470,13 @@ bool Vcpusched::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Vcpusched::save(QXmlStreamWriter& dst_) const
+{
+	Element<Vcpusched, Name::Strict<9356> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4290,7 +5493,8 @@ int Traits<Domain::Xml::Vcpusched>::parse(Domain::Xml::Vcpusched& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Vcpusched>::generate(const Domain::Xml::Vcpusched& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Vcpusched>::produce(const Domain::Xml::Vcpusched& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getVcpus(), m.get<0>()))
@@ -4301,6 +5505,16 @@ int Traits<Domain::Xml::Vcpusched>::generate(const Domain::Xml::Vcpusched& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Vcpusched>::generate(const Domain::Xml::Vcpusched& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Vcpusched>::generate(const Domain::Xml::Vcpusched& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Iothreadsched
 
@@ -4334,6 +5548,13 @@ bool Iothreadsched::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Iothreadsched::save(QXmlStreamWriter& dst_) const
+{
+	Element<Iothreadsched, Name::Strict<9358> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4350,7 +5571,8 @@ int Traits<Domain::Xml::Iothreadsched>::parse(Domain::Xml::Iothreadsched& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Iothreadsched>::generate(const Domain::Xml::Iothreadsched& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Iothreadsched>::produce(const Domain::Xml::Iothreadsched& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIothreads(), m.get<0>()))
@@ -4361,6 +5583,16 @@ int Traits<Domain::Xml::Iothreadsched>::generate(const Domain::Xml::Iothreadsche
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Iothreadsched>::generate(const Domain::Xml::Iothreadsched& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Iothreadsched>::generate(const Domain::Xml::Iothreadsched& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Cache2
 
@@ -4398,6 +5630,13 @@ bool Cache2::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Cache2::save(QXmlStreamWriter& dst_) const
+{
+	Element<Cache2, Name::Strict<558> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4417,7 +5656,8 @@ int Traits<Domain::Xml::Cache2>::parse(Domain::Xml::Cache2& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Cache2>::generate(const Domain::Xml::Cache2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Cache2>::produce(const Domain::Xml::Cache2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -4434,6 +5674,16 @@ int Traits<Domain::Xml::Cache2>::generate(const Domain::Xml::Cache2& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Cache2>::generate(const Domain::Xml::Cache2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Cache2>::generate(const Domain::Xml::Cache2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Monitor
 
@@ -4471,6 +5721,13 @@ bool Monitor::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Monitor::save(QXmlStreamWriter& dst_) const
+{
+	Element<Monitor, Name::Strict<9363> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4487,7 +5744,8 @@ int Traits<Domain::Xml::Monitor>::parse(Domain::Xml::Monitor& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Monitor>::generate(const Domain::Xml::Monitor& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Monitor>::produce(const Domain::Xml::Monitor& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getLevel(), m.get<0>()))
@@ -4498,6 +5756,16 @@ int Traits<Domain::Xml::Monitor>::generate(const Domain::Xml::Monitor& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Monitor>::generate(const Domain::Xml::Monitor& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Monitor>::generate(const Domain::Xml::Monitor& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Cachetune
 
@@ -4531,6 +5799,13 @@ bool Cachetune::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Cachetune::save(QXmlStreamWriter& dst_) const
+{
+	Element<Cachetune, Name::Strict<9360> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4548,7 +5823,8 @@ int Traits<Domain::Xml::Cachetune>::parse(Domain::Xml::Cachetune& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Cachetune>::generate(const Domain::Xml::Cachetune& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Cachetune>::produce(const Domain::Xml::Cachetune& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getVcpus(), m.get<0>()))
@@ -4561,6 +5837,16 @@ int Traits<Domain::Xml::Cachetune>::generate(const Domain::Xml::Cachetune& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Cachetune>::generate(const Domain::Xml::Cachetune& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Cachetune>::generate(const Domain::Xml::Cachetune& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Node
 
@@ -4598,6 +5884,13 @@ bool Node::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Node::save(QXmlStreamWriter& dst_) const
+{
+	Element<Node, Name::Strict<609> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4614,7 +5907,8 @@ int Traits<Domain::Xml::Node>::parse(Domain::Xml::Node& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Node>::generate(const Domain::Xml::Node& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Node>::produce(const Domain::Xml::Node& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -4625,6 +5919,16 @@ int Traits<Domain::Xml::Node>::generate(const Domain::Xml::Node& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Node>::generate(const Domain::Xml::Node& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Node>::generate(const Domain::Xml::Node& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Memorytune
 
@@ -4658,6 +5962,13 @@ bool Memorytune::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Memorytune::save(QXmlStreamWriter& dst_) const
+{
+	Element<Memorytune, Name::Strict<9364> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4674,7 +5985,8 @@ int Traits<Domain::Xml::Memorytune>::parse(Domain::Xml::Memorytune& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Memorytune>::generate(const Domain::Xml::Memorytune& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Memorytune>::produce(const Domain::Xml::Memorytune& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getVcpus(), m.get<0>()))
@@ -4685,6 +5997,16 @@ int Traits<Domain::Xml::Memorytune>::generate(const Domain::Xml::Memorytune& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Memorytune>::generate(const Domain::Xml::Memorytune& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Memorytune>::generate(const Domain::Xml::Memorytune& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Cputune
 
@@ -4718,6 +6040,13 @@ bool Cputune::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Cputune::save(QXmlStreamWriter& dst_) const
+{
+	Element<Cputune, Name::Strict<350> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4749,7 +6078,8 @@ int Traits<Domain::Xml::Cputune>::parse(Domain::Xml::Cputune& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Cputune>::generate(const Domain::Xml::Cputune& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Cputune>::produce(const Domain::Xml::Cputune& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getShares(), m.get<0>()))
@@ -4790,6 +6120,16 @@ int Traits<Domain::Xml::Cputune>::generate(const Domain::Xml::Cputune& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Cputune>::generate(const Domain::Xml::Cputune& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Cputune>::generate(const Domain::Xml::Cputune& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Memory2356
 
@@ -4799,12 +6139,23 @@ int Traits<Domain::Xml::Memory2356>::parse(Domain::Xml::Memory2356& , QStack<QDo
 	return m.consume(stack_);
 }
 
-int Traits<Domain::Xml::Memory2356>::generate(const Domain::Xml::Memory2356& , QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Memory2356>::produce(const Domain::Xml::Memory2356& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Memory2356>::generate(const Domain::Xml::Memory2356& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Memory2356>::generate(const Domain::Xml::Memory2356& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Memory1
 
@@ -4838,6 +6189,13 @@ bool Memory1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Memory1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Memory1, Name::Strict<326> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4854,7 +6212,8 @@ int Traits<Domain::Xml::Memory1>::parse(Domain::Xml::Memory1& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Memory1>::generate(const Domain::Xml::Memory1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Memory1>::produce(const Domain::Xml::Memory1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMode(), m.get<0>()))
@@ -4865,6 +6224,16 @@ int Traits<Domain::Xml::Memory1>::generate(const Domain::Xml::Memory1& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Memory1>::generate(const Domain::Xml::Memory1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Memory1>::generate(const Domain::Xml::Memory1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Memnode
 
@@ -4902,6 +6271,13 @@ bool Memnode::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Memnode::save(QXmlStreamWriter& dst_) const
+{
+	Element<Memnode, Name::Strict<385> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4919,7 +6295,8 @@ int Traits<Domain::Xml::Memnode>::parse(Domain::Xml::Memnode& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Memnode>::generate(const Domain::Xml::Memnode& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Memnode>::produce(const Domain::Xml::Memnode& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCellid(), m.get<0>()))
@@ -4932,6 +6309,16 @@ int Traits<Domain::Xml::Memnode>::generate(const Domain::Xml::Memnode& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Memnode>::generate(const Domain::Xml::Memnode& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Memnode>::generate(const Domain::Xml::Memnode& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Numatune
 
@@ -4965,6 +6352,13 @@ bool Numatune::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Numatune::save(QXmlStreamWriter& dst_) const
+{
+	Element<Numatune, Name::Strict<351> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -4981,7 +6375,8 @@ int Traits<Domain::Xml::Numatune>::parse(Domain::Xml::Numatune& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Numatune>::generate(const Domain::Xml::Numatune& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Numatune>::produce(const Domain::Xml::Numatune& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMemory(), m.get<0>()))
@@ -4992,6 +6387,16 @@ int Traits<Domain::Xml::Numatune>::generate(const Domain::Xml::Numatune& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Numatune>::generate(const Domain::Xml::Numatune& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Numatune>::generate(const Domain::Xml::Numatune& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Resource
 
@@ -5025,6 +6430,13 @@ bool Resource::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Resource::save(QXmlStreamWriter& dst_) const
+{
+	Element<Resource, Name::Strict<387> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -5041,7 +6453,8 @@ int Traits<Domain::Xml::Resource>::parse(Domain::Xml::Resource& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Resource>::generate(const Domain::Xml::Resource& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Resource>::produce(const Domain::Xml::Resource& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPartition(), m.get<0>()))
@@ -5052,6 +6465,16 @@ int Traits<Domain::Xml::Resource>::generate(const Domain::Xml::Resource& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Resource>::generate(const Domain::Xml::Resource& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Resource>::generate(const Domain::Xml::Resource& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Apic
 
@@ -5085,6 +6508,13 @@ bool Apic::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Apic::save(QXmlStreamWriter& dst_) const
+{
+	Element<Apic, Name::Strict<991> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -5100,7 +6530,8 @@ int Traits<Domain::Xml::Apic>::parse(Domain::Xml::Apic& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Apic>::generate(const Domain::Xml::Apic& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Apic>::produce(const Domain::Xml::Apic& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getEoi(), m.get<0>()))
@@ -5109,6 +6540,16 @@ int Traits<Domain::Xml::Apic>::generate(const Domain::Xml::Apic& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Apic>::generate(const Domain::Xml::Apic& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Apic>::generate(const Domain::Xml::Apic& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hap
 
@@ -5142,6 +6583,13 @@ bool Hap::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Hap::save(QXmlStreamWriter& dst_) const
+{
+	Element<Hap, Name::Strict<994> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -5157,7 +6605,8 @@ int Traits<Domain::Xml::Hap>::parse(Domain::Xml::Hap& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Hap>::generate(const Domain::Xml::Hap& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hap>::produce(const Domain::Xml::Hap& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getState(), m.get<0>()))
@@ -5166,6 +6615,16 @@ int Traits<Domain::Xml::Hap>::generate(const Domain::Xml::Hap& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hap>::generate(const Domain::Xml::Hap& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hap>::generate(const Domain::Xml::Hap& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Spinlocks
 
@@ -5203,6 +6662,13 @@ bool Spinlocks::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Spinlocks::save(QXmlStreamWriter& dst_) const
+{
+	Element<Spinlocks, Name::Strict<1114> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -5219,7 +6685,8 @@ int Traits<Domain::Xml::Spinlocks>::parse(Domain::Xml::Spinlocks& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Spinlocks>::generate(const Domain::Xml::Spinlocks& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Spinlocks>::produce(const Domain::Xml::Spinlocks& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getState(), m.get<0>()))
@@ -5230,6 +6697,16 @@ int Traits<Domain::Xml::Spinlocks>::generate(const Domain::Xml::Spinlocks& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Spinlocks>::generate(const Domain::Xml::Spinlocks& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Spinlocks>::generate(const Domain::Xml::Spinlocks& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Stimer
 
@@ -5263,6 +6740,13 @@ bool Stimer::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Stimer::save(QXmlStreamWriter& dst_) const
+{
+	Element<Stimer, Name::Strict<1119> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -5279,7 +6763,8 @@ int Traits<Domain::Xml::Stimer>::parse(Domain::Xml::Stimer& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Stimer>::generate(const Domain::Xml::Stimer& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Stimer>::produce(const Domain::Xml::Stimer& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getState(), m.get<0>()))
@@ -5290,6 +6775,16 @@ int Traits<Domain::Xml::Stimer>::generate(const Domain::Xml::Stimer& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Stimer>::generate(const Domain::Xml::Stimer& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Stimer>::generate(const Domain::Xml::Stimer& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct VendorId
 
@@ -5327,6 +6822,13 @@ bool VendorId::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool VendorId::save(QXmlStreamWriter& dst_) const
+{
+	Element<VendorId, Name::Strict<1020> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -5343,7 +6845,8 @@ int Traits<Domain::Xml::VendorId>::parse(Domain::Xml::VendorId& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::VendorId>::generate(const Domain::Xml::VendorId& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::VendorId>::produce(const Domain::Xml::VendorId& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getState(), m.get<0>()))
@@ -5354,6 +6857,16 @@ int Traits<Domain::Xml::VendorId>::generate(const Domain::Xml::VendorId& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::VendorId>::generate(const Domain::Xml::VendorId& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::VendorId>::generate(const Domain::Xml::VendorId& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hyperv
 
@@ -5387,6 +6900,13 @@ bool Hyperv::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Hyperv::save(QXmlStreamWriter& dst_) const
+{
+	Element<Hyperv, Name::Strict<256> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -5415,7 +6935,8 @@ int Traits<Domain::Xml::Hyperv>::parse(Domain::Xml::Hyperv& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Hyperv>::generate(const Domain::Xml::Hyperv& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hyperv>::produce(const Domain::Xml::Hyperv& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getRelaxed(), m.get<0>()))
@@ -5450,6 +6971,16 @@ int Traits<Domain::Xml::Hyperv>::generate(const Domain::Xml::Hyperv& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hyperv>::generate(const Domain::Xml::Hyperv& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hyperv>::generate(const Domain::Xml::Hyperv& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Kvm
 
@@ -5483,6 +7014,13 @@ bool Kvm::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Kvm::save(QXmlStreamWriter& dst_) const
+{
+	Element<Kvm, Name::Strict<249> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -5498,7 +7036,8 @@ int Traits<Domain::Xml::Kvm>::parse(Domain::Xml::Kvm& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Kvm>::generate(const Domain::Xml::Kvm& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Kvm>::produce(const Domain::Xml::Kvm& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getHidden(), m.get<0>()))
@@ -5507,6 +7046,16 @@ int Traits<Domain::Xml::Kvm>::generate(const Domain::Xml::Kvm& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Kvm>::generate(const Domain::Xml::Kvm& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Kvm>::generate(const Domain::Xml::Kvm& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Pvspinlock
 
@@ -5540,6 +7089,13 @@ bool Pvspinlock::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Pvspinlock::save(QXmlStreamWriter& dst_) const
+{
+	Element<Pvspinlock, Name::Strict<997> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -5555,7 +7111,8 @@ int Traits<Domain::Xml::Pvspinlock>::parse(Domain::Xml::Pvspinlock& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Pvspinlock>::generate(const Domain::Xml::Pvspinlock& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Pvspinlock>::produce(const Domain::Xml::Pvspinlock& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getState(), m.get<0>()))
@@ -5564,6 +7121,16 @@ int Traits<Domain::Xml::Pvspinlock>::generate(const Domain::Xml::Pvspinlock& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Pvspinlock>::generate(const Domain::Xml::Pvspinlock& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Pvspinlock>::generate(const Domain::Xml::Pvspinlock& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capabilities
 
@@ -5601,6 +7168,13 @@ bool Capabilities::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Capabilities::save(QXmlStreamWriter& dst_) const
+{
+	Element<Capabilities, Name::Strict<926> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -5653,7 +7227,8 @@ int Traits<Domain::Xml::Capabilities>::parse(Domain::Xml::Capabilities& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::Capabilities>::generate(const Domain::Xml::Capabilities& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Capabilities>::produce(const Domain::Xml::Capabilities& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPolicy(), m.get<0>()))
@@ -5736,6 +7311,16 @@ int Traits<Domain::Xml::Capabilities>::generate(const Domain::Xml::Capabilities&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Capabilities>::generate(const Domain::Xml::Capabilities& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Capabilities>::generate(const Domain::Xml::Capabilities& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Pmu
 
@@ -5769,6 +7354,13 @@ bool Pmu::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Pmu::save(QXmlStreamWriter& dst_) const
+{
+	Element<Pmu, Name::Strict<999> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -5784,7 +7376,8 @@ int Traits<Domain::Xml::Pmu>::parse(Domain::Xml::Pmu& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Pmu>::generate(const Domain::Xml::Pmu& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Pmu>::produce(const Domain::Xml::Pmu& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getState(), m.get<0>()))
@@ -5793,6 +7386,16 @@ int Traits<Domain::Xml::Pmu>::generate(const Domain::Xml::Pmu& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Pmu>::generate(const Domain::Xml::Pmu& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Pmu>::generate(const Domain::Xml::Pmu& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Vmport
 
@@ -5826,6 +7429,13 @@ bool Vmport::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Vmport::save(QXmlStreamWriter& dst_) const
+{
+	Element<Vmport, Name::Strict<1000> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -5841,7 +7451,8 @@ int Traits<Domain::Xml::Vmport>::parse(Domain::Xml::Vmport& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Vmport>::generate(const Domain::Xml::Vmport& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Vmport>::produce(const Domain::Xml::Vmport& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getState(), m.get<0>()))
@@ -5850,6 +7461,16 @@ int Traits<Domain::Xml::Vmport>::generate(const Domain::Xml::Vmport& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Vmport>::generate(const Domain::Xml::Vmport& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Vmport>::generate(const Domain::Xml::Vmport& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Gic
 
@@ -5883,6 +7504,13 @@ bool Gic::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Gic::save(QXmlStreamWriter& dst_) const
+{
+	Element<Gic, Name::Strict<1001> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -5898,7 +7526,8 @@ int Traits<Domain::Xml::Gic>::parse(Domain::Xml::Gic& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Gic>::generate(const Domain::Xml::Gic& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Gic>::produce(const Domain::Xml::Gic& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getVersion(), m.get<0>()))
@@ -5907,6 +7536,16 @@ int Traits<Domain::Xml::Gic>::generate(const Domain::Xml::Gic& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Gic>::generate(const Domain::Xml::Gic& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Gic>::generate(const Domain::Xml::Gic& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Anonymous2357
 
@@ -5947,7 +7586,8 @@ int Traits<Domain::Xml::Anonymous2357>::parse(Domain::Xml::Anonymous2357& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Anonymous2357>::generate(const Domain::Xml::Anonymous2357& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Anonymous2357>::produce(const Domain::Xml::Anonymous2357& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getState(), m.get<0>()))
@@ -5958,6 +7598,16 @@ int Traits<Domain::Xml::Anonymous2357>::generate(const Domain::Xml::Anonymous235
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Anonymous2357>::generate(const Domain::Xml::Anonymous2357& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Anonymous2357>::generate(const Domain::Xml::Anonymous2357& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Smm
 
@@ -5991,6 +7641,13 @@ bool Smm::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Smm::save(QXmlStreamWriter& dst_) const
+{
+	Element<Smm, Name::Strict<1002> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6006,7 +7663,8 @@ int Traits<Domain::Xml::Smm>::parse(Domain::Xml::Smm& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Smm>::generate(const Domain::Xml::Smm& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Smm>::produce(const Domain::Xml::Smm& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAnonymous2357(), m.get<0>()))
@@ -6015,6 +7673,16 @@ int Traits<Domain::Xml::Smm>::generate(const Domain::Xml::Smm& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Smm>::generate(const Domain::Xml::Smm& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Smm>::generate(const Domain::Xml::Smm& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hpt
 
@@ -6048,6 +7716,13 @@ bool Hpt::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Hpt::save(QXmlStreamWriter& dst_) const
+{
+	Element<Hpt, Name::Strict<9404> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6064,7 +7739,8 @@ int Traits<Domain::Xml::Hpt>::parse(Domain::Xml::Hpt& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Hpt>::generate(const Domain::Xml::Hpt& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hpt>::produce(const Domain::Xml::Hpt& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getResizing(), m.get<0>()))
@@ -6075,6 +7751,16 @@ int Traits<Domain::Xml::Hpt>::generate(const Domain::Xml::Hpt& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hpt>::generate(const Domain::Xml::Hpt& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hpt>::generate(const Domain::Xml::Hpt& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Vmcoreinfo
 
@@ -6108,6 +7794,13 @@ bool Vmcoreinfo::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Vmcoreinfo::save(QXmlStreamWriter& dst_) const
+{
+	Element<Vmcoreinfo, Name::Strict<1004> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6123,7 +7816,8 @@ int Traits<Domain::Xml::Vmcoreinfo>::parse(Domain::Xml::Vmcoreinfo& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Vmcoreinfo>::generate(const Domain::Xml::Vmcoreinfo& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Vmcoreinfo>::produce(const Domain::Xml::Vmcoreinfo& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getState(), m.get<0>()))
@@ -6132,6 +7826,16 @@ int Traits<Domain::Xml::Vmcoreinfo>::generate(const Domain::Xml::Vmcoreinfo& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Vmcoreinfo>::generate(const Domain::Xml::Vmcoreinfo& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Vmcoreinfo>::generate(const Domain::Xml::Vmcoreinfo& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Tcg
 
@@ -6165,6 +7869,13 @@ bool Tcg::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Tcg::save(QXmlStreamWriter& dst_) const
+{
+	Element<Tcg, Name::Strict<9424> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6180,7 +7891,8 @@ int Traits<Domain::Xml::Tcg>::parse(Domain::Xml::Tcg& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Tcg>::generate(const Domain::Xml::Tcg& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Tcg>::produce(const Domain::Xml::Tcg& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getTbCache(), m.get<0>()))
@@ -6189,6 +7901,16 @@ int Traits<Domain::Xml::Tcg>::generate(const Domain::Xml::Tcg& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Tcg>::generate(const Domain::Xml::Tcg& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Tcg>::generate(const Domain::Xml::Tcg& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Features
 
@@ -6226,6 +7948,13 @@ bool Features::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Features::save(QXmlStreamWriter& dst_) const
+{
+	Element<Features, Name::Strict<155> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6265,7 +7994,8 @@ int Traits<Domain::Xml::Features>::parse(Domain::Xml::Features& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Features>::generate(const Domain::Xml::Features& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Features>::produce(const Domain::Xml::Features& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPae(), m.get<0>()))
@@ -6322,6 +8052,16 @@ int Traits<Domain::Xml::Features>::generate(const Domain::Xml::Features& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Features>::generate(const Domain::Xml::Features& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Features>::generate(const Domain::Xml::Features& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct VzDns
 
@@ -6355,6 +8095,13 @@ bool VzDns::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool VzDns::save(QXmlStreamWriter& dst_) const
+{
+	Element<VzDns, Name::Strict<5706> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6372,7 +8119,8 @@ int Traits<Domain::Xml::VzDns>::parse(Domain::Xml::VzDns& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::VzDns>::generate(const Domain::Xml::VzDns& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::VzDns>::produce(const Domain::Xml::VzDns& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getHostname(), m.get<0>()))
@@ -6385,6 +8133,16 @@ int Traits<Domain::Xml::VzDns>::generate(const Domain::Xml::VzDns& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::VzDns>::generate(const Domain::Xml::VzDns& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::VzDns>::generate(const Domain::Xml::VzDns& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Class
 
@@ -6422,6 +8180,13 @@ bool Class::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Class::save(QXmlStreamWriter& dst_) const
+{
+	Element<Class, Name::Strict<842> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6438,7 +8203,8 @@ int Traits<Domain::Xml::Class>::parse(Domain::Xml::Class& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Class>::generate(const Domain::Xml::Class& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Class>::produce(const Domain::Xml::Class& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -6449,6 +8215,16 @@ int Traits<Domain::Xml::Class>::generate(const Domain::Xml::Class& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Class>::generate(const Domain::Xml::Class& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Class>::generate(const Domain::Xml::Class& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct VzNetworkRates
 
@@ -6486,6 +8262,13 @@ bool VzNetworkRates::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool VzNetworkRates::save(QXmlStreamWriter& dst_) const
+{
+	Element<VzNetworkRates, Name::Strict<9001> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6502,7 +8285,8 @@ int Traits<Domain::Xml::VzNetworkRates>::parse(Domain::Xml::VzNetworkRates& dst_
 	return output;
 }
 
-int Traits<Domain::Xml::VzNetworkRates>::generate(const Domain::Xml::VzNetworkRates& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::VzNetworkRates>::produce(const Domain::Xml::VzNetworkRates& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getRateBound(), m.get<0>()))
@@ -6510,7 +8294,17 @@ int Traits<Domain::Xml::VzNetworkRates>::generate(const Domain::Xml::VzNetworkRa
 	if (0 > Details::Marshal::assign(src_.getClassList(), m.get<1>()))
 		return -1;
 
-	return m.produce(dst_);
+	return m.produce(dst_);
+}
+
+int Traits<Domain::Xml::VzNetworkRates>::generate(const Domain::Xml::VzNetworkRates& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::VzNetworkRates>::generate(const Domain::Xml::VzNetworkRates& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6546,6 +8340,13 @@ bool SuspendToMem::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool SuspendToMem::save(QXmlStreamWriter& dst_) const
+{
+	Element<SuspendToMem, Name::Strict<806> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6561,7 +8362,8 @@ int Traits<Domain::Xml::SuspendToMem>::parse(Domain::Xml::SuspendToMem& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::SuspendToMem>::generate(const Domain::Xml::SuspendToMem& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::SuspendToMem>::produce(const Domain::Xml::SuspendToMem& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getEnabled(), m.get<0>()))
@@ -6570,6 +8372,16 @@ int Traits<Domain::Xml::SuspendToMem>::generate(const Domain::Xml::SuspendToMem&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::SuspendToMem>::generate(const Domain::Xml::SuspendToMem& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::SuspendToMem>::generate(const Domain::Xml::SuspendToMem& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct SuspendToDisk
 
@@ -6603,6 +8415,13 @@ bool SuspendToDisk::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool SuspendToDisk::save(QXmlStreamWriter& dst_) const
+{
+	Element<SuspendToDisk, Name::Strict<808> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6618,7 +8437,8 @@ int Traits<Domain::Xml::SuspendToDisk>::parse(Domain::Xml::SuspendToDisk& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::SuspendToDisk>::generate(const Domain::Xml::SuspendToDisk& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::SuspendToDisk>::produce(const Domain::Xml::SuspendToDisk& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getEnabled(), m.get<0>()))
@@ -6627,6 +8447,16 @@ int Traits<Domain::Xml::SuspendToDisk>::generate(const Domain::Xml::SuspendToDis
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::SuspendToDisk>::generate(const Domain::Xml::SuspendToDisk& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::SuspendToDisk>::generate(const Domain::Xml::SuspendToDisk& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Pm
 
@@ -6660,6 +8490,13 @@ bool Pm::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Pm::save(QXmlStreamWriter& dst_) const
+{
+	Element<Pm, Name::Strict<226> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6676,7 +8513,8 @@ int Traits<Domain::Xml::Pm>::parse(Domain::Xml::Pm& dst_, QStack<QDomElement>& s
 	return output;
 }
 
-int Traits<Domain::Xml::Pm>::generate(const Domain::Xml::Pm& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Pm>::produce(const Domain::Xml::Pm& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSuspendToMem(), m.get<0>()))
@@ -6687,6 +8525,16 @@ int Traits<Domain::Xml::Pm>::generate(const Domain::Xml::Pm& src_, QDomElement&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Pm>::generate(const Domain::Xml::Pm& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Pm>::generate(const Domain::Xml::Pm& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Event
 
@@ -6724,6 +8572,13 @@ bool Event::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Event::save(QXmlStreamWriter& dst_) const
+{
+	Element<Event, Name::Strict<5054> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6740,7 +8595,8 @@ int Traits<Domain::Xml::Event>::parse(Domain::Xml::Event& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Event>::generate(const Domain::Xml::Event& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Event>::produce(const Domain::Xml::Event& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -6751,6 +8607,16 @@ int Traits<Domain::Xml::Event>::generate(const Domain::Xml::Event& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Event>::generate(const Domain::Xml::Event& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Event>::generate(const Domain::Xml::Event& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Uid
 
@@ -6788,6 +8654,13 @@ bool Uid::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Uid::save(QXmlStreamWriter& dst_) const
+{
+	Element<Uid, Name::Strict<321> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6805,7 +8678,8 @@ int Traits<Domain::Xml::Uid>::parse(Domain::Xml::Uid& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Uid>::generate(const Domain::Xml::Uid& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Uid>::produce(const Domain::Xml::Uid& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getStart(), m.get<0>()))
@@ -6818,6 +8692,16 @@ int Traits<Domain::Xml::Uid>::generate(const Domain::Xml::Uid& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Uid>::generate(const Domain::Xml::Uid& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Uid>::generate(const Domain::Xml::Uid& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Gid
 
@@ -6855,6 +8739,13 @@ bool Gid::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Gid::save(QXmlStreamWriter& dst_) const
+{
+	Element<Gid, Name::Strict<325> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6872,7 +8763,8 @@ int Traits<Domain::Xml::Gid>::parse(Domain::Xml::Gid& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Gid>::generate(const Domain::Xml::Gid& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Gid>::produce(const Domain::Xml::Gid& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getStart(), m.get<0>()))
@@ -6885,6 +8777,16 @@ int Traits<Domain::Xml::Gid>::generate(const Domain::Xml::Gid& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Gid>::generate(const Domain::Xml::Gid& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Gid>::generate(const Domain::Xml::Gid& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Idmap
 
@@ -6918,6 +8820,13 @@ bool Idmap::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Idmap::save(QXmlStreamWriter& dst_) const
+{
+	Element<Idmap, Name::Strict<227> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -6934,7 +8843,8 @@ int Traits<Domain::Xml::Idmap>::parse(Domain::Xml::Idmap& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Idmap>::generate(const Domain::Xml::Idmap& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Idmap>::produce(const Domain::Xml::Idmap& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getUidList(), m.get<0>()))
@@ -6945,6 +8855,16 @@ int Traits<Domain::Xml::Idmap>::generate(const Domain::Xml::Idmap& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Idmap>::generate(const Domain::Xml::Idmap& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Idmap>::generate(const Domain::Xml::Idmap& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Disk7002
 
@@ -6973,7 +8893,8 @@ int Traits<Domain::Xml::Disk7002>::parse(Domain::Xml::Disk7002& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Disk7002>::generate(const Domain::Xml::Disk7002& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Disk7002>::produce(const Domain::Xml::Disk7002& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDevice(), m.get<0>()))
@@ -6986,6 +8907,16 @@ int Traits<Domain::Xml::Disk7002>::generate(const Domain::Xml::Disk7002& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Disk7002>::generate(const Domain::Xml::Disk7002& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Disk7002>::generate(const Domain::Xml::Disk7002& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct DriverFormat
 
@@ -7022,7 +8953,8 @@ int Traits<Domain::Xml::DriverFormat>::parse(Domain::Xml::DriverFormat& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::DriverFormat>::generate(const Domain::Xml::DriverFormat& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::DriverFormat>::produce(const Domain::Xml::DriverFormat& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -7033,6 +8965,16 @@ int Traits<Domain::Xml::DriverFormat>::generate(const Domain::Xml::DriverFormat&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::DriverFormat>::generate(const Domain::Xml::DriverFormat& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::DriverFormat>::generate(const Domain::Xml::DriverFormat& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct VirtioOptions
 
@@ -7066,6 +9008,13 @@ bool VirtioOptions::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool VirtioOptions::save(QXmlStreamWriter& dst_) const
+{
+	Element<VirtioOptions, Name::Strict<546> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -7084,7 +9033,8 @@ int Traits<Domain::Xml::VirtioOptions>::parse(Domain::Xml::VirtioOptions& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::VirtioOptions>::generate(const Domain::Xml::VirtioOptions& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::VirtioOptions>::produce(const Domain::Xml::VirtioOptions& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIommu(), m.get<0>()))
@@ -7099,6 +9049,16 @@ int Traits<Domain::Xml::VirtioOptions>::generate(const Domain::Xml::VirtioOption
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::VirtioOptions>::generate(const Domain::Xml::VirtioOptions& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::VirtioOptions>::generate(const Domain::Xml::VirtioOptions& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct MetadataCache
 
@@ -7132,6 +9092,13 @@ bool MetadataCache::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool MetadataCache::save(QXmlStreamWriter& dst_) const
+{
+	Element<MetadataCache, Name::Strict<6546> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -7147,7 +9114,8 @@ int Traits<Domain::Xml::MetadataCache>::parse(Domain::Xml::MetadataCache& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::MetadataCache>::generate(const Domain::Xml::MetadataCache& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::MetadataCache>::produce(const Domain::Xml::MetadataCache& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMaxSize(), m.get<0>()))
@@ -7156,6 +9124,16 @@ int Traits<Domain::Xml::MetadataCache>::generate(const Domain::Xml::MetadataCach
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::MetadataCache>::generate(const Domain::Xml::MetadataCache& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::MetadataCache>::generate(const Domain::Xml::MetadataCache& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Driver
 
@@ -7189,6 +9167,13 @@ bool Driver::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Driver::save(QXmlStreamWriter& dst_) const
+{
+	Element<Driver, Name::Strict<546> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -7218,7 +9203,8 @@ int Traits<Domain::Xml::Driver>::parse(Domain::Xml::Driver& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Driver>::generate(const Domain::Xml::Driver& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Driver>::produce(const Domain::Xml::Driver& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDriverFormat(), m.get<0>()))
@@ -7255,6 +9241,16 @@ int Traits<Domain::Xml::Driver>::generate(const Domain::Xml::Driver& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Driver>::generate(const Domain::Xml::Driver& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Driver>::generate(const Domain::Xml::Driver& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct MetadataCache1
 
@@ -7288,6 +9284,13 @@ bool MetadataCache1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool MetadataCache1::save(QXmlStreamWriter& dst_) const
+{
+	Element<MetadataCache1, Name::Strict<6546> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -7303,7 +9306,8 @@ int Traits<Domain::Xml::MetadataCache1>::parse(Domain::Xml::MetadataCache1& dst_
 	return output;
 }
 
-int Traits<Domain::Xml::MetadataCache1>::generate(const Domain::Xml::MetadataCache1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::MetadataCache1>::produce(const Domain::Xml::MetadataCache1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMaxSize(), m.get<0>()))
@@ -7312,6 +9316,16 @@ int Traits<Domain::Xml::MetadataCache1>::generate(const Domain::Xml::MetadataCac
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::MetadataCache1>::generate(const Domain::Xml::MetadataCache1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::MetadataCache1>::generate(const Domain::Xml::MetadataCache1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Format
 
@@ -7345,6 +9359,13 @@ bool Format::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Format::save(QXmlStreamWriter& dst_) const
+{
+	Element<Format, Name::Strict<146> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -7361,7 +9382,8 @@ int Traits<Domain::Xml::Format>::parse(Domain::Xml::Format& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Format>::generate(const Domain::Xml::Format& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Format>::produce(const Domain::Xml::Format& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -7372,6 +9394,16 @@ int Traits<Domain::Xml::Format>::generate(const Domain::Xml::Format& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Format>::generate(const Domain::Xml::Format& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Format>::generate(const Domain::Xml::Format& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Anonymous2358
 
@@ -7408,7 +9440,8 @@ int Traits<Domain::Xml::Anonymous2358>::parse(Domain::Xml::Anonymous2358& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Anonymous2358>::generate(const Domain::Xml::Anonymous2358& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Anonymous2358>::produce(const Domain::Xml::Anonymous2358& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSource(), m.get<0>().get<1>()))
@@ -7419,6 +9452,16 @@ int Traits<Domain::Xml::Anonymous2358>::generate(const Domain::Xml::Anonymous235
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Anonymous2358>::generate(const Domain::Xml::Anonymous2358& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Anonymous2358>::generate(const Domain::Xml::Anonymous2358& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Mirror4765
 
@@ -7436,7 +9479,8 @@ int Traits<Domain::Xml::Mirror4765>::parse(Domain::Xml::Mirror4765& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Mirror4765>::generate(const Domain::Xml::Mirror4765& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Mirror4765>::produce(const Domain::Xml::Mirror4765& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFile(), m.get<0>()))
@@ -7451,6 +9495,16 @@ int Traits<Domain::Xml::Mirror4765>::generate(const Domain::Xml::Mirror4765& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Mirror4765>::generate(const Domain::Xml::Mirror4765& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Mirror4765>::generate(const Domain::Xml::Mirror4765& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Mirror4766
 
@@ -7479,7 +9533,8 @@ int Traits<Domain::Xml::Mirror4766>::parse(Domain::Xml::Mirror4766& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Mirror4766>::generate(const Domain::Xml::Mirror4766& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Mirror4766>::produce(const Domain::Xml::Mirror4766& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getJob(), m.get<0>()))
@@ -7492,6 +9547,16 @@ int Traits<Domain::Xml::Mirror4766>::generate(const Domain::Xml::Mirror4766& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Mirror4766>::generate(const Domain::Xml::Mirror4766& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Mirror4766>::generate(const Domain::Xml::Mirror4766& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Mirror
 
@@ -7525,6 +9590,13 @@ bool Mirror::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Mirror::save(QXmlStreamWriter& dst_) const
+{
+	Element<Mirror, Name::Strict<1088> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -7541,7 +9613,8 @@ int Traits<Domain::Xml::Mirror>::parse(Domain::Xml::Mirror& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Mirror>::generate(const Domain::Xml::Mirror& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Mirror>::produce(const Domain::Xml::Mirror& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMirror(), m.get<0>()))
@@ -7552,6 +9625,16 @@ int Traits<Domain::Xml::Mirror>::generate(const Domain::Xml::Mirror& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Mirror>::generate(const Domain::Xml::Mirror& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Mirror>::generate(const Domain::Xml::Mirror& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Secret
 
@@ -7589,6 +9672,13 @@ bool Secret::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Secret::save(QXmlStreamWriter& dst_) const
+{
+	Element<Secret, Name::Strict<149> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -7605,7 +9695,8 @@ int Traits<Domain::Xml::Secret>::parse(Domain::Xml::Secret& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Secret>::generate(const Domain::Xml::Secret& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Secret>::produce(const Domain::Xml::Secret& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -7616,6 +9707,16 @@ int Traits<Domain::Xml::Secret>::generate(const Domain::Xml::Secret& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Secret>::generate(const Domain::Xml::Secret& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Secret>::generate(const Domain::Xml::Secret& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Auth
 
@@ -7649,6 +9750,13 @@ bool Auth::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Auth::save(QXmlStreamWriter& dst_) const
+{
+	Element<Auth, Name::Strict<1097> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -7665,7 +9773,8 @@ int Traits<Domain::Xml::Auth>::parse(Domain::Xml::Auth& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Auth>::generate(const Domain::Xml::Auth& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Auth>::produce(const Domain::Xml::Auth& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getUsername(), m.get<0>()))
@@ -7676,6 +9785,16 @@ int Traits<Domain::Xml::Auth>::generate(const Domain::Xml::Auth& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Auth>::generate(const Domain::Xml::Auth& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Auth>::generate(const Domain::Xml::Auth& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Target
 
@@ -7709,6 +9828,13 @@ bool Target::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Target::save(QXmlStreamWriter& dst_) const
+{
+	Element<Target, Name::Strict<323> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -7727,7 +9853,8 @@ int Traits<Domain::Xml::Target>::parse(Domain::Xml::Target& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Target>::generate(const Domain::Xml::Target& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Target>::produce(const Domain::Xml::Target& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDev(), m.get<0>()))
@@ -7742,6 +9869,16 @@ int Traits<Domain::Xml::Target>::generate(const Domain::Xml::Target& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Target>::generate(const Domain::Xml::Target& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Target>::generate(const Domain::Xml::Target& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Boot
 
@@ -7779,6 +9916,13 @@ bool Boot::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Boot::save(QXmlStreamWriter& dst_) const
+{
+	Element<Boot, Name::Strict<407> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -7795,7 +9939,8 @@ int Traits<Domain::Xml::Boot>::parse(Domain::Xml::Boot& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Boot>::generate(const Domain::Xml::Boot& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Boot>::produce(const Domain::Xml::Boot& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getOrder(), m.get<0>()))
@@ -7806,6 +9951,16 @@ int Traits<Domain::Xml::Boot>::generate(const Domain::Xml::Boot& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Boot>::generate(const Domain::Xml::Boot& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Boot>::generate(const Domain::Xml::Boot& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Transient
 
@@ -7839,6 +9994,13 @@ bool Transient::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Transient::save(QXmlStreamWriter& dst_) const
+{
+	Element<Transient, Name::Strict<452> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -7854,7 +10016,8 @@ int Traits<Domain::Xml::Transient>::parse(Domain::Xml::Transient& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Transient>::generate(const Domain::Xml::Transient& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Transient>::produce(const Domain::Xml::Transient& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getShareBacking(), m.get<0>()))
@@ -7863,6 +10026,16 @@ int Traits<Domain::Xml::Transient>::generate(const Domain::Xml::Transient& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Transient>::generate(const Domain::Xml::Transient& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Transient>::generate(const Domain::Xml::Transient& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Variant4770
 
@@ -7878,7 +10051,8 @@ int Traits<Domain::Xml::Variant4770>::parse(Domain::Xml::Variant4770& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Variant4770>::generate(const Domain::Xml::Variant4770& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Variant4770>::produce(const Domain::Xml::Variant4770& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getReadBytesSec(), m.get<0>().get<0>()))
@@ -7889,6 +10063,16 @@ int Traits<Domain::Xml::Variant4770>::generate(const Domain::Xml::Variant4770& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Variant4770>::generate(const Domain::Xml::Variant4770& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Variant4770>::generate(const Domain::Xml::Variant4770& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Variant4773
 
@@ -7904,7 +10088,8 @@ int Traits<Domain::Xml::Variant4773>::parse(Domain::Xml::Variant4773& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Variant4773>::generate(const Domain::Xml::Variant4773& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Variant4773>::produce(const Domain::Xml::Variant4773& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getReadIopsSec(), m.get<0>().get<0>()))
@@ -7915,6 +10100,16 @@ int Traits<Domain::Xml::Variant4773>::generate(const Domain::Xml::Variant4773& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Variant4773>::generate(const Domain::Xml::Variant4773& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Variant4773>::generate(const Domain::Xml::Variant4773& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Iotune
 
@@ -7948,6 +10143,13 @@ bool Iotune::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Iotune::save(QXmlStreamWriter& dst_) const
+{
+	Element<Iotune, Name::Strict<1103> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -7966,7 +10168,8 @@ int Traits<Domain::Xml::Iotune>::parse(Domain::Xml::Iotune& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Iotune>::generate(const Domain::Xml::Iotune& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Iotune>::produce(const Domain::Xml::Iotune& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getChoice4771(), m.get<0>()))
@@ -7981,6 +10184,16 @@ int Traits<Domain::Xml::Iotune>::generate(const Domain::Xml::Iotune& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Iotune>::generate(const Domain::Xml::Iotune& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Iotune>::generate(const Domain::Xml::Iotune& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Pciaddress
 
@@ -8014,6 +10227,13 @@ bool Pciaddress::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Pciaddress::save(QXmlStreamWriter& dst_) const
+{
+	Element<Pciaddress, Name::Strict<111> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -8033,7 +10253,8 @@ int Traits<Domain::Xml::Pciaddress>::parse(Domain::Xml::Pciaddress& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Pciaddress>::generate(const Domain::Xml::Pciaddress& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Pciaddress>::produce(const Domain::Xml::Pciaddress& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDomain(), m.get<0>()))
@@ -8050,6 +10271,16 @@ int Traits<Domain::Xml::Pciaddress>::generate(const Domain::Xml::Pciaddress& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Pciaddress>::generate(const Domain::Xml::Pciaddress& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Pciaddress>::generate(const Domain::Xml::Pciaddress& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Driveaddress
 
@@ -8088,7 +10319,8 @@ int Traits<Domain::Xml::Driveaddress>::parse(Domain::Xml::Driveaddress& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::Driveaddress>::generate(const Domain::Xml::Driveaddress& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Driveaddress>::produce(const Domain::Xml::Driveaddress& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getController(), m.get<0>()))
@@ -8103,6 +10335,16 @@ int Traits<Domain::Xml::Driveaddress>::generate(const Domain::Xml::Driveaddress&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Driveaddress>::generate(const Domain::Xml::Driveaddress& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Driveaddress>::generate(const Domain::Xml::Driveaddress& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Virtioserialaddress
 
@@ -8140,7 +10382,8 @@ int Traits<Domain::Xml::Virtioserialaddress>::parse(Domain::Xml::Virtioserialadd
 	return output;
 }
 
-int Traits<Domain::Xml::Virtioserialaddress>::generate(const Domain::Xml::Virtioserialaddress& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Virtioserialaddress>::produce(const Domain::Xml::Virtioserialaddress& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getController(), m.get<0>()))
@@ -8153,6 +10396,16 @@ int Traits<Domain::Xml::Virtioserialaddress>::generate(const Domain::Xml::Virtio
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Virtioserialaddress>::generate(const Domain::Xml::Virtioserialaddress& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Virtioserialaddress>::generate(const Domain::Xml::Virtioserialaddress& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Ccidaddress
 
@@ -8189,7 +10442,8 @@ int Traits<Domain::Xml::Ccidaddress>::parse(Domain::Xml::Ccidaddress& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Ccidaddress>::generate(const Domain::Xml::Ccidaddress& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Ccidaddress>::produce(const Domain::Xml::Ccidaddress& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getController(), m.get<0>()))
@@ -8200,6 +10454,16 @@ int Traits<Domain::Xml::Ccidaddress>::generate(const Domain::Xml::Ccidaddress& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Ccidaddress>::generate(const Domain::Xml::Ccidaddress& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Ccidaddress>::generate(const Domain::Xml::Ccidaddress& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Usbportaddress
 
@@ -8236,7 +10500,8 @@ int Traits<Domain::Xml::Usbportaddress>::parse(Domain::Xml::Usbportaddress& dst_
 	return output;
 }
 
-int Traits<Domain::Xml::Usbportaddress>::generate(const Domain::Xml::Usbportaddress& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Usbportaddress>::produce(const Domain::Xml::Usbportaddress& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBus(), m.get<0>()))
@@ -8247,6 +10512,16 @@ int Traits<Domain::Xml::Usbportaddress>::generate(const Domain::Xml::Usbportaddr
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Usbportaddress>::generate(const Domain::Xml::Usbportaddress& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Usbportaddress>::generate(const Domain::Xml::Usbportaddress& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Anonymous9190
 
@@ -8284,7 +10559,8 @@ int Traits<Domain::Xml::Anonymous9190>::parse(Domain::Xml::Anonymous9190& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Anonymous9190>::generate(const Domain::Xml::Anonymous9190& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Anonymous9190>::produce(const Domain::Xml::Anonymous9190& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCssid(), m.get<0>()))
@@ -8297,6 +10573,16 @@ int Traits<Domain::Xml::Anonymous9190>::generate(const Domain::Xml::Anonymous919
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Anonymous9190>::generate(const Domain::Xml::Anonymous9190& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Anonymous9190>::generate(const Domain::Xml::Anonymous9190& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Isaaddress
 
@@ -8333,7 +10619,8 @@ int Traits<Domain::Xml::Isaaddress>::parse(Domain::Xml::Isaaddress& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Isaaddress>::generate(const Domain::Xml::Isaaddress& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Isaaddress>::produce(const Domain::Xml::Isaaddress& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIobase(), m.get<0>()))
@@ -8344,6 +10631,16 @@ int Traits<Domain::Xml::Isaaddress>::generate(const Domain::Xml::Isaaddress& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Isaaddress>::generate(const Domain::Xml::Isaaddress& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Isaaddress>::generate(const Domain::Xml::Isaaddress& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Dimmaddress
 
@@ -8380,7 +10677,8 @@ int Traits<Domain::Xml::Dimmaddress>::parse(Domain::Xml::Dimmaddress& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Dimmaddress>::generate(const Domain::Xml::Dimmaddress& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Dimmaddress>::produce(const Domain::Xml::Dimmaddress& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSlot(), m.get<0>()))
@@ -8391,6 +10689,16 @@ int Traits<Domain::Xml::Dimmaddress>::generate(const Domain::Xml::Dimmaddress& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Dimmaddress>::generate(const Domain::Xml::Dimmaddress& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Dimmaddress>::generate(const Domain::Xml::Dimmaddress& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Geometry
 
@@ -8428,6 +10736,13 @@ bool Geometry::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Geometry::save(QXmlStreamWriter& dst_) const
+{
+	Element<Geometry, Name::Strict<457> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -8446,7 +10761,8 @@ int Traits<Domain::Xml::Geometry>::parse(Domain::Xml::Geometry& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Geometry>::generate(const Domain::Xml::Geometry& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Geometry>::produce(const Domain::Xml::Geometry& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCyls(), m.get<0>()))
@@ -8461,6 +10777,16 @@ int Traits<Domain::Xml::Geometry>::generate(const Domain::Xml::Geometry& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Geometry>::generate(const Domain::Xml::Geometry& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Geometry>::generate(const Domain::Xml::Geometry& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Blockio
 
@@ -8494,6 +10820,13 @@ bool Blockio::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Blockio::save(QXmlStreamWriter& dst_) const
+{
+	Element<Blockio, Name::Strict<543> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -8510,7 +10843,8 @@ int Traits<Domain::Xml::Blockio>::parse(Domain::Xml::Blockio& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Blockio>::generate(const Domain::Xml::Blockio& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Blockio>::produce(const Domain::Xml::Blockio& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getLogicalBlockSize(), m.get<0>()))
@@ -8521,6 +10855,16 @@ int Traits<Domain::Xml::Blockio>::generate(const Domain::Xml::Blockio& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Blockio>::generate(const Domain::Xml::Blockio& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Blockio>::generate(const Domain::Xml::Blockio& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct BackingStore
 
@@ -8568,6 +10912,13 @@ bool BackingStore::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool BackingStore::save(QXmlStreamWriter& dst_) const
+{
+	Element<BackingStore, Name::Strict<487> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -8588,7 +10939,8 @@ int Traits<Domain::Xml::BackingStore>::parse(Domain::Xml::BackingStore& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::BackingStore>::generate(const Domain::Xml::BackingStore& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::BackingStore>::produce(const Domain::Xml::BackingStore& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIndex(), m.get<0>()))
@@ -8609,6 +10961,16 @@ int Traits<Domain::Xml::BackingStore>::generate(const Domain::Xml::BackingStore&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::BackingStore>::generate(const Domain::Xml::BackingStore& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::BackingStore>::generate(const Domain::Xml::BackingStore& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Disk
 
@@ -8646,6 +11008,13 @@ bool Disk::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Disk::save(QXmlStreamWriter& dst_) const
+{
+	Element<Disk, Name::Strict<472> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -8684,7 +11053,8 @@ int Traits<Domain::Xml::Disk>::parse(Domain::Xml::Disk& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Disk>::generate(const Domain::Xml::Disk& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Disk>::produce(const Domain::Xml::Disk& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDisk(), m.get<0>()))
@@ -8739,6 +11109,16 @@ int Traits<Domain::Xml::Disk>::generate(const Domain::Xml::Disk& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Disk>::generate(const Domain::Xml::Disk& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Disk>::generate(const Domain::Xml::Disk& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Acpi
 
@@ -8772,6 +11152,13 @@ bool Acpi::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Acpi::save(QXmlStreamWriter& dst_) const
+{
+	Element<Acpi, Name::Strict<993> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -8787,7 +11174,8 @@ int Traits<Domain::Xml::Acpi>::parse(Domain::Xml::Acpi& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Acpi>::generate(const Domain::Xml::Acpi& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Acpi>::produce(const Domain::Xml::Acpi& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIndex(), m.get<0>()))
@@ -8796,6 +11184,16 @@ int Traits<Domain::Xml::Acpi>::generate(const Domain::Xml::Acpi& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Acpi>::generate(const Domain::Xml::Acpi& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Acpi>::generate(const Domain::Xml::Acpi& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Variant5121
 
@@ -8812,7 +11210,8 @@ int Traits<Domain::Xml::Variant5121>::parse(Domain::Xml::Variant5121& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Variant5121>::generate(const Domain::Xml::Variant5121& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Variant5121>::produce(const Domain::Xml::Variant5121& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<1>()))
@@ -8825,6 +11224,16 @@ int Traits<Domain::Xml::Variant5121>::generate(const Domain::Xml::Variant5121& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Variant5121>::generate(const Domain::Xml::Variant5121& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Variant5121>::generate(const Domain::Xml::Variant5121& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Variant7013
 
@@ -8834,12 +11243,23 @@ int Traits<Domain::Xml::Variant7013>::parse(Domain::Xml::Variant7013& , QStack<Q
 	return m.consume(stack_);
 }
 
-int Traits<Domain::Xml::Variant7013>::generate(const Domain::Xml::Variant7013& , QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Variant7013>::produce(const Domain::Xml::Variant7013& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Variant7013>::generate(const Domain::Xml::Variant7013& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Variant7013>::generate(const Domain::Xml::Variant7013& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Target1
 
@@ -8873,6 +11293,13 @@ bool Target1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Target1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Target1, Name::Strict<323> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -8894,7 +11321,8 @@ int Traits<Domain::Xml::Target1>::parse(Domain::Xml::Target1& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Target1>::generate(const Domain::Xml::Target1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Target1>::produce(const Domain::Xml::Target1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getChassisNr(), m.get<0>()))
@@ -8915,6 +11343,16 @@ int Traits<Domain::Xml::Target1>::generate(const Domain::Xml::Target1& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Target1>::generate(const Domain::Xml::Target1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Target1>::generate(const Domain::Xml::Target1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Variant7014
 
@@ -8942,7 +11380,8 @@ int Traits<Domain::Xml::Variant7014>::parse(Domain::Xml::Variant7014& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Variant7014>::generate(const Domain::Xml::Variant7014& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Variant7014>::produce(const Domain::Xml::Variant7014& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -8953,6 +11392,16 @@ int Traits<Domain::Xml::Variant7014>::generate(const Domain::Xml::Variant7014& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Variant7014>::generate(const Domain::Xml::Variant7014& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Variant7014>::generate(const Domain::Xml::Variant7014& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Variant8014
 
@@ -8969,7 +11418,8 @@ int Traits<Domain::Xml::Variant8014>::parse(Domain::Xml::Variant8014& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Variant8014>::generate(const Domain::Xml::Variant8014& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Variant8014>::produce(const Domain::Xml::Variant8014& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<1>()))
@@ -8979,7 +11429,17 @@ int Traits<Domain::Xml::Variant8014>::generate(const Domain::Xml::Variant8014& s
 	if (0 > Details::Marshal::assign(src_.getChoice2355(), m.get<3>()))
 		return -1;
 
-	return m.produce(dst_);
+	return m.produce(dst_);
+}
+
+int Traits<Domain::Xml::Variant8014>::generate(const Domain::Xml::Variant8014& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Variant8014>::generate(const Domain::Xml::Variant8014& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8998,7 +11458,8 @@ int Traits<Domain::Xml::Variant9522>::parse(Domain::Xml::Variant9522& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Variant9522>::generate(const Domain::Xml::Variant9522& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Variant9522>::produce(const Domain::Xml::Variant9522& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<1>()))
@@ -9011,6 +11472,16 @@ int Traits<Domain::Xml::Variant9522>::generate(const Domain::Xml::Variant9522& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Variant9522>::generate(const Domain::Xml::Variant9522& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Variant9522>::generate(const Domain::Xml::Variant9522& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Variant8018
 
@@ -9026,7 +11497,8 @@ int Traits<Domain::Xml::Variant8018>::parse(Domain::Xml::Variant8018& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Variant8018>::generate(const Domain::Xml::Variant8018& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Variant8018>::produce(const Domain::Xml::Variant8018& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMaxGrantFrames(), m.get<1>()))
@@ -9037,6 +11509,16 @@ int Traits<Domain::Xml::Variant8018>::generate(const Domain::Xml::Variant8018& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Variant8018>::generate(const Domain::Xml::Variant8018& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Variant8018>::generate(const Domain::Xml::Variant8018& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Driver1
 
@@ -9070,6 +11552,13 @@ bool Driver1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Driver1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Driver1, Name::Strict<546> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -9090,7 +11579,8 @@ int Traits<Domain::Xml::Driver1>::parse(Domain::Xml::Driver1& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Driver1>::generate(const Domain::Xml::Driver1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Driver1>::produce(const Domain::Xml::Driver1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getQueues(), m.get<0>()))
@@ -9109,6 +11599,16 @@ int Traits<Domain::Xml::Driver1>::generate(const Domain::Xml::Driver1& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Driver1>::generate(const Domain::Xml::Driver1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Driver1>::generate(const Domain::Xml::Driver1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Controller
 
@@ -9142,6 +11642,13 @@ bool Controller::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Controller::save(QXmlStreamWriter& dst_) const
+{
+	Element<Controller, Name::Strict<572> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -9162,7 +11669,8 @@ int Traits<Domain::Xml::Controller>::parse(Domain::Xml::Controller& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Controller>::generate(const Domain::Xml::Controller& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Controller>::produce(const Domain::Xml::Controller& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIndex(), m.get<0>()))
@@ -9181,6 +11689,16 @@ int Traits<Domain::Xml::Controller>::generate(const Domain::Xml::Controller& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Controller>::generate(const Domain::Xml::Controller& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Controller>::generate(const Domain::Xml::Controller& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Target2
 
@@ -9214,6 +11732,13 @@ bool Target2::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Target2::save(QXmlStreamWriter& dst_) const
+{
+	Element<Target2, Name::Strict<323> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -9230,7 +11755,8 @@ int Traits<Domain::Xml::Target2>::parse(Domain::Xml::Target2& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Target2>::generate(const Domain::Xml::Target2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Target2>::produce(const Domain::Xml::Target2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPath(), m.get<0>()))
@@ -9241,6 +11767,16 @@ int Traits<Domain::Xml::Target2>::generate(const Domain::Xml::Target2& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Target2>::generate(const Domain::Xml::Target2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Target2>::generate(const Domain::Xml::Target2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Lease
 
@@ -9274,6 +11810,13 @@ bool Lease::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Lease::save(QXmlStreamWriter& dst_) const
+{
+	Element<Lease, Name::Strict<465> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -9291,7 +11834,8 @@ int Traits<Domain::Xml::Lease>::parse(Domain::Xml::Lease& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Lease>::generate(const Domain::Xml::Lease& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Lease>::produce(const Domain::Xml::Lease& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getLockspace(), m.get<0>()))
@@ -9304,6 +11848,16 @@ int Traits<Domain::Xml::Lease>::generate(const Domain::Xml::Lease& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Lease>::generate(const Domain::Xml::Lease& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Lease>::generate(const Domain::Xml::Lease& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Driver2
 
@@ -9337,6 +11891,13 @@ bool Driver2::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Driver2::save(QXmlStreamWriter& dst_) const
+{
+	Element<Driver2, Name::Strict<546> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -9353,7 +11914,8 @@ int Traits<Domain::Xml::Driver2>::parse(Domain::Xml::Driver2& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Driver2>::generate(const Domain::Xml::Driver2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Driver2>::produce(const Domain::Xml::Driver2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -9364,6 +11926,16 @@ int Traits<Domain::Xml::Driver2>::generate(const Domain::Xml::Driver2& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Driver2>::generate(const Domain::Xml::Driver2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Driver2>::generate(const Domain::Xml::Driver2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Filesystem7016
 
@@ -9379,7 +11951,8 @@ int Traits<Domain::Xml::Filesystem7016>::parse(Domain::Xml::Filesystem7016& dst_
 	return output;
 }
 
-int Traits<Domain::Xml::Filesystem7016>::generate(const Domain::Xml::Filesystem7016& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Filesystem7016>::produce(const Domain::Xml::Filesystem7016& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDriver(), m.get<1>()))
@@ -9390,6 +11963,16 @@ int Traits<Domain::Xml::Filesystem7016>::generate(const Domain::Xml::Filesystem7
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Filesystem7016>::generate(const Domain::Xml::Filesystem7016& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Filesystem7016>::generate(const Domain::Xml::Filesystem7016& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Filesystem7017
 
@@ -9405,7 +11988,8 @@ int Traits<Domain::Xml::Filesystem7017>::parse(Domain::Xml::Filesystem7017& dst_
 	return output;
 }
 
-int Traits<Domain::Xml::Filesystem7017>::generate(const Domain::Xml::Filesystem7017& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Filesystem7017>::produce(const Domain::Xml::Filesystem7017& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDriver(), m.get<1>()))
@@ -9416,6 +12000,16 @@ int Traits<Domain::Xml::Filesystem7017>::generate(const Domain::Xml::Filesystem7
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Filesystem7017>::generate(const Domain::Xml::Filesystem7017& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Filesystem7017>::generate(const Domain::Xml::Filesystem7017& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Filesystem7018
 
@@ -9431,7 +12025,8 @@ int Traits<Domain::Xml::Filesystem7018>::parse(Domain::Xml::Filesystem7018& dst_
 	return output;
 }
 
-int Traits<Domain::Xml::Filesystem7018>::generate(const Domain::Xml::Filesystem7018& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Filesystem7018>::produce(const Domain::Xml::Filesystem7018& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDriver(), m.get<1>()))
@@ -9442,6 +12037,16 @@ int Traits<Domain::Xml::Filesystem7018>::generate(const Domain::Xml::Filesystem7
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Filesystem7018>::generate(const Domain::Xml::Filesystem7018& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Filesystem7018>::generate(const Domain::Xml::Filesystem7018& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Filesystem7019
 
@@ -9457,7 +12062,8 @@ int Traits<Domain::Xml::Filesystem7019>::parse(Domain::Xml::Filesystem7019& dst_
 	return output;
 }
 
-int Traits<Domain::Xml::Filesystem7019>::generate(const Domain::Xml::Filesystem7019& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Filesystem7019>::produce(const Domain::Xml::Filesystem7019& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDriver(), m.get<1>()))
@@ -9468,6 +12074,16 @@ int Traits<Domain::Xml::Filesystem7019>::generate(const Domain::Xml::Filesystem7
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Filesystem7019>::generate(const Domain::Xml::Filesystem7019& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Filesystem7019>::generate(const Domain::Xml::Filesystem7019& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Filesystem7020
 
@@ -9483,7 +12099,8 @@ int Traits<Domain::Xml::Filesystem7020>::parse(Domain::Xml::Filesystem7020& dst_
 	return output;
 }
 
-int Traits<Domain::Xml::Filesystem7020>::generate(const Domain::Xml::Filesystem7020& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Filesystem7020>::produce(const Domain::Xml::Filesystem7020& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDriver(), m.get<1>()))
@@ -9494,6 +12111,16 @@ int Traits<Domain::Xml::Filesystem7020>::generate(const Domain::Xml::Filesystem7
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Filesystem7020>::generate(const Domain::Xml::Filesystem7020& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Filesystem7020>::generate(const Domain::Xml::Filesystem7020& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source5
 
@@ -9531,6 +12158,13 @@ bool Source5::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source5::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source5, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -9547,7 +12181,8 @@ int Traits<Domain::Xml::Source5>::parse(Domain::Xml::Source5& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Source5>::generate(const Domain::Xml::Source5& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source5>::produce(const Domain::Xml::Source5& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getUsage(), m.get<0>()))
@@ -9558,6 +12193,16 @@ int Traits<Domain::Xml::Source5>::generate(const Domain::Xml::Source5& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source5>::generate(const Domain::Xml::Source5& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source5>::generate(const Domain::Xml::Source5& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Filesystem7021
 
@@ -9573,7 +12218,8 @@ int Traits<Domain::Xml::Filesystem7021>::parse(Domain::Xml::Filesystem7021& dst_
 	return output;
 }
 
-int Traits<Domain::Xml::Filesystem7021>::generate(const Domain::Xml::Filesystem7021& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Filesystem7021>::produce(const Domain::Xml::Filesystem7021& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDriver(), m.get<1>()))
@@ -9584,6 +12230,16 @@ int Traits<Domain::Xml::Filesystem7021>::generate(const Domain::Xml::Filesystem7
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Filesystem7021>::generate(const Domain::Xml::Filesystem7021& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Filesystem7021>::generate(const Domain::Xml::Filesystem7021& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Filesystem
 
@@ -9621,6 +12277,13 @@ bool Filesystem::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Filesystem::save(QXmlStreamWriter& dst_) const
+{
+	Element<Filesystem, Name::Strict<630> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -9649,7 +12312,8 @@ int Traits<Domain::Xml::Filesystem>::parse(Domain::Xml::Filesystem& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Filesystem>::generate(const Domain::Xml::Filesystem& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Filesystem>::produce(const Domain::Xml::Filesystem& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFilesystem(), m.get<0>()))
@@ -9684,6 +12348,16 @@ int Traits<Domain::Xml::Filesystem>::generate(const Domain::Xml::Filesystem& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Filesystem>::generate(const Domain::Xml::Filesystem& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Filesystem>::generate(const Domain::Xml::Filesystem& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct InterfaceBridgeAttributes
 
@@ -9720,7 +12394,8 @@ int Traits<Domain::Xml::InterfaceBridgeAttributes>::parse(Domain::Xml::Interface
 	return output;
 }
 
-int Traits<Domain::Xml::InterfaceBridgeAttributes>::generate(const Domain::Xml::InterfaceBridgeAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::InterfaceBridgeAttributes>::produce(const Domain::Xml::InterfaceBridgeAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBridge(), m.get<0>()))
@@ -9731,6 +12406,16 @@ int Traits<Domain::Xml::InterfaceBridgeAttributes>::generate(const Domain::Xml::
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::InterfaceBridgeAttributes>::generate(const Domain::Xml::InterfaceBridgeAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::InterfaceBridgeAttributes>::generate(const Domain::Xml::InterfaceBridgeAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct InterfaceNetworkAttributes
 
@@ -9768,7 +12453,8 @@ int Traits<Domain::Xml::InterfaceNetworkAttributes>::parse(Domain::Xml::Interfac
 	return output;
 }
 
-int Traits<Domain::Xml::InterfaceNetworkAttributes>::generate(const Domain::Xml::InterfaceNetworkAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::InterfaceNetworkAttributes>::produce(const Domain::Xml::InterfaceNetworkAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getNetwork(), m.get<0>()))
@@ -9781,6 +12467,16 @@ int Traits<Domain::Xml::InterfaceNetworkAttributes>::generate(const Domain::Xml:
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::InterfaceNetworkAttributes>::generate(const Domain::Xml::InterfaceNetworkAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::InterfaceNetworkAttributes>::generate(const Domain::Xml::InterfaceNetworkAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source6
 
@@ -9814,6 +12510,13 @@ bool Source6::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source6::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source6, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -9830,7 +12533,8 @@ int Traits<Domain::Xml::Source6>::parse(Domain::Xml::Source6& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Source6>::generate(const Domain::Xml::Source6& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source6>::produce(const Domain::Xml::Source6& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getInterfaceBridgeAttributes(), m.get<0>()))
@@ -9841,6 +12545,16 @@ int Traits<Domain::Xml::Source6>::generate(const Domain::Xml::Source6& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source6>::generate(const Domain::Xml::Source6& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source6>::generate(const Domain::Xml::Source6& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Parameters
 
@@ -9874,6 +12588,13 @@ bool Parameters::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Parameters::save(QXmlStreamWriter& dst_) const
+{
+	Element<Parameters, Name::Strict<180> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -9892,7 +12613,8 @@ int Traits<Domain::Xml::Parameters>::parse(Domain::Xml::Parameters& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Parameters>::generate(const Domain::Xml::Parameters& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Parameters>::produce(const Domain::Xml::Parameters& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getManagerid(), m.get<0>()))
@@ -9907,6 +12629,16 @@ int Traits<Domain::Xml::Parameters>::generate(const Domain::Xml::Parameters& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Parameters>::generate(const Domain::Xml::Parameters& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Parameters>::generate(const Domain::Xml::Parameters& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Parameters1
 
@@ -9940,6 +12672,13 @@ bool Parameters1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Parameters1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Parameters1, Name::Strict<180> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -9955,7 +12694,8 @@ int Traits<Domain::Xml::Parameters1>::parse(Domain::Xml::Parameters1& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Parameters1>::generate(const Domain::Xml::Parameters1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Parameters1>::produce(const Domain::Xml::Parameters1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getProfileid(), m.get<0>()))
@@ -9964,6 +12704,16 @@ int Traits<Domain::Xml::Parameters1>::generate(const Domain::Xml::Parameters1& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Parameters1>::generate(const Domain::Xml::Parameters1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Parameters1>::generate(const Domain::Xml::Parameters1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Parameters2
 
@@ -9997,6 +12747,13 @@ bool Parameters2::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Parameters2::save(QXmlStreamWriter& dst_) const
+{
+	Element<Parameters2, Name::Strict<180> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10013,7 +12770,8 @@ int Traits<Domain::Xml::Parameters2>::parse(Domain::Xml::Parameters2& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Parameters2>::generate(const Domain::Xml::Parameters2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Parameters2>::produce(const Domain::Xml::Parameters2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getProfileid(), m.get<0>()))
@@ -10024,6 +12782,16 @@ int Traits<Domain::Xml::Parameters2>::generate(const Domain::Xml::Parameters2& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Parameters2>::generate(const Domain::Xml::Parameters2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Parameters2>::generate(const Domain::Xml::Parameters2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Parameters3
 
@@ -10057,6 +12825,13 @@ bool Parameters3::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Parameters3::save(QXmlStreamWriter& dst_) const
+{
+	Element<Parameters3, Name::Strict<180> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10077,7 +12852,8 @@ int Traits<Domain::Xml::Parameters3>::parse(Domain::Xml::Parameters3& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Parameters3>::generate(const Domain::Xml::Parameters3& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Parameters3>::produce(const Domain::Xml::Parameters3& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getManagerid(), m.get<0>()))
@@ -10096,6 +12872,16 @@ int Traits<Domain::Xml::Parameters3>::generate(const Domain::Xml::Parameters3& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Parameters3>::generate(const Domain::Xml::Parameters3& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Parameters3>::generate(const Domain::Xml::Parameters3& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Virtualport
 
@@ -10122,7 +12908,14 @@ bool Virtualport::save(QDomElement& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
-bool Virtualport::save(QDomDocument& dst_) const
+bool Virtualport::save(QDomDocument& dst_) const
+{
+	Element<Virtualport, Name::Strict<178> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
+bool Virtualport::save(QXmlStreamWriter& dst_) const
 {
 	Element<Virtualport, Name::Strict<178> > m;
 	m.setValue(*this);
@@ -10144,7 +12937,8 @@ int Traits<Domain::Xml::Virtualport>::parse(Domain::Xml::Virtualport& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Virtualport>::generate(const Domain::Xml::Virtualport& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Virtualport>::produce(const Domain::Xml::Virtualport& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getParameters(), m.get<0>()))
@@ -10153,6 +12947,16 @@ int Traits<Domain::Xml::Virtualport>::generate(const Domain::Xml::Virtualport& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Virtualport>::generate(const Domain::Xml::Virtualport& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Virtualport>::generate(const Domain::Xml::Virtualport& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Frames
 
@@ -10186,6 +12990,13 @@ bool Frames::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Frames::save(QXmlStreamWriter& dst_) const
+{
+	Element<Frames, Name::Strict<9430> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10201,7 +13012,8 @@ int Traits<Domain::Xml::Frames>::parse(Domain::Xml::Frames& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Frames>::generate(const Domain::Xml::Frames& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Frames>::produce(const Domain::Xml::Frames& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMax(), m.get<0>()))
@@ -10210,6 +13022,16 @@ int Traits<Domain::Xml::Frames>::generate(const Domain::Xml::Frames& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Frames>::generate(const Domain::Xml::Frames& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Frames>::generate(const Domain::Xml::Frames& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Rx
 
@@ -10243,6 +13065,13 @@ bool Rx::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Rx::save(QXmlStreamWriter& dst_) const
+{
+	Element<Rx, Name::Strict<9429> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10258,7 +13087,8 @@ int Traits<Domain::Xml::Rx>::parse(Domain::Xml::Rx& dst_, QStack<QDomElement>& s
 	return output;
 }
 
-int Traits<Domain::Xml::Rx>::generate(const Domain::Xml::Rx& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Rx>::produce(const Domain::Xml::Rx& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFrames(), m.get<0>()))
@@ -10267,6 +13097,16 @@ int Traits<Domain::Xml::Rx>::generate(const Domain::Xml::Rx& src_, QDomElement&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Rx>::generate(const Domain::Xml::Rx& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Rx>::generate(const Domain::Xml::Rx& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Coalesce
 
@@ -10300,6 +13140,13 @@ bool Coalesce::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Coalesce::save(QXmlStreamWriter& dst_) const
+{
+	Element<Coalesce, Name::Strict<9382> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10315,7 +13162,8 @@ int Traits<Domain::Xml::Coalesce>::parse(Domain::Xml::Coalesce& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Coalesce>::generate(const Domain::Xml::Coalesce& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Coalesce>::produce(const Domain::Xml::Coalesce& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getRx(), m.get<0>()))
@@ -10324,6 +13172,16 @@ int Traits<Domain::Xml::Coalesce>::generate(const Domain::Xml::Coalesce& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Coalesce>::generate(const Domain::Xml::Coalesce& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Coalesce>::generate(const Domain::Xml::Coalesce& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct VzDhcp
 
@@ -10357,6 +13215,13 @@ bool VzDhcp::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool VzDhcp::save(QXmlStreamWriter& dst_) const
+{
+	Element<VzDhcp, Name::Strict<5704> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10372,7 +13237,8 @@ int Traits<Domain::Xml::VzDhcp>::parse(Domain::Xml::VzDhcp& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::VzDhcp>::generate(const Domain::Xml::VzDhcp& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::VzDhcp>::produce(const Domain::Xml::VzDhcp& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFamily(), m.get<0>()))
@@ -10381,6 +13247,16 @@ int Traits<Domain::Xml::VzDhcp>::generate(const Domain::Xml::VzDhcp& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::VzDhcp>::generate(const Domain::Xml::VzDhcp& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::VzDhcp>::generate(const Domain::Xml::VzDhcp& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct VzDns1
 
@@ -10414,6 +13290,13 @@ bool VzDns1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool VzDns1::save(QXmlStreamWriter& dst_) const
+{
+	Element<VzDns1, Name::Strict<5706> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10430,7 +13313,8 @@ int Traits<Domain::Xml::VzDns1>::parse(Domain::Xml::VzDns1& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::VzDns1>::generate(const Domain::Xml::VzDns1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::VzDns1>::produce(const Domain::Xml::VzDns1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getServerList(), m.get<0>()))
@@ -10441,6 +13325,16 @@ int Traits<Domain::Xml::VzDns1>::generate(const Domain::Xml::VzDns1& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::VzDns1>::generate(const Domain::Xml::VzDns1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::VzDns1>::generate(const Domain::Xml::VzDns1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Target3
 
@@ -10474,6 +13368,13 @@ bool Target3::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Target3::save(QXmlStreamWriter& dst_) const
+{
+	Element<Target3, Name::Strict<323> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10490,7 +13391,8 @@ int Traits<Domain::Xml::Target3>::parse(Domain::Xml::Target3& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Target3>::generate(const Domain::Xml::Target3& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Target3>::produce(const Domain::Xml::Target3& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDev(), m.get<0>()))
@@ -10501,6 +13403,16 @@ int Traits<Domain::Xml::Target3>::generate(const Domain::Xml::Target3& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Target3>::generate(const Domain::Xml::Target3& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Target3>::generate(const Domain::Xml::Target3& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Guest
 
@@ -10534,6 +13446,13 @@ bool Guest::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Guest::save(QXmlStreamWriter& dst_) const
+{
+	Element<Guest, Name::Strict<408> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10550,7 +13469,8 @@ int Traits<Domain::Xml::Guest>::parse(Domain::Xml::Guest& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Guest>::generate(const Domain::Xml::Guest& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Guest>::produce(const Domain::Xml::Guest& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDev(), m.get<0>()))
@@ -10561,6 +13481,16 @@ int Traits<Domain::Xml::Guest>::generate(const Domain::Xml::Guest& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Guest>::generate(const Domain::Xml::Guest& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Guest>::generate(const Domain::Xml::Guest& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Ip
 
@@ -10594,6 +13524,13 @@ bool Ip::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Ip::save(QXmlStreamWriter& dst_) const
+{
+	Element<Ip, Name::Strict<689> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10611,7 +13548,8 @@ int Traits<Domain::Xml::Ip>::parse(Domain::Xml::Ip& dst_, QStack<QDomElement>& s
 	return output;
 }
 
-int Traits<Domain::Xml::Ip>::generate(const Domain::Xml::Ip& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Ip>::produce(const Domain::Xml::Ip& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAddress(), m.get<0>()))
@@ -10624,6 +13562,16 @@ int Traits<Domain::Xml::Ip>::generate(const Domain::Xml::Ip& src_, QDomElement&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Ip>::generate(const Domain::Xml::Ip& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Ip>::generate(const Domain::Xml::Ip& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Route
 
@@ -10657,6 +13605,13 @@ bool Route::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Route::save(QXmlStreamWriter& dst_) const
+{
+	Element<Route, Name::Strict<1230> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10676,7 +13631,8 @@ int Traits<Domain::Xml::Route>::parse(Domain::Xml::Route& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Route>::generate(const Domain::Xml::Route& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Route>::produce(const Domain::Xml::Route& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFamily(), m.get<0>()))
@@ -10693,6 +13649,16 @@ int Traits<Domain::Xml::Route>::generate(const Domain::Xml::Route& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Route>::generate(const Domain::Xml::Route& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Route>::generate(const Domain::Xml::Route& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Backend
 
@@ -10726,6 +13692,13 @@ bool Backend::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Backend::save(QXmlStreamWriter& dst_) const
+{
+	Element<Backend, Name::Strict<693> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10742,7 +13715,8 @@ int Traits<Domain::Xml::Backend>::parse(Domain::Xml::Backend& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Backend>::generate(const Domain::Xml::Backend& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Backend>::produce(const Domain::Xml::Backend& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getTap(), m.get<0>()))
@@ -10753,6 +13727,16 @@ int Traits<Domain::Xml::Backend>::generate(const Domain::Xml::Backend& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Backend>::generate(const Domain::Xml::Backend& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Backend>::generate(const Domain::Xml::Backend& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Driver7037
 
@@ -10773,7 +13757,8 @@ int Traits<Domain::Xml::Driver7037>::parse(Domain::Xml::Driver7037& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Driver7037>::generate(const Domain::Xml::Driver7037& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Driver7037>::produce(const Domain::Xml::Driver7037& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -10794,6 +13779,16 @@ int Traits<Domain::Xml::Driver7037>::generate(const Domain::Xml::Driver7037& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Driver7037>::generate(const Domain::Xml::Driver7037& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Driver7037>::generate(const Domain::Xml::Driver7037& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Host
 
@@ -10827,6 +13822,13 @@ bool Host::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Host::save(QXmlStreamWriter& dst_) const
+{
+	Element<Host, Name::Strict<513> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10848,7 +13850,8 @@ int Traits<Domain::Xml::Host>::parse(Domain::Xml::Host& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Host>::generate(const Domain::Xml::Host& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Host>::produce(const Domain::Xml::Host& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCsum(), m.get<0>()))
@@ -10869,6 +13872,16 @@ int Traits<Domain::Xml::Host>::generate(const Domain::Xml::Host& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Host>::generate(const Domain::Xml::Host& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Host>::generate(const Domain::Xml::Host& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Guest1
 
@@ -10902,6 +13915,13 @@ bool Guest1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Guest1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Guest1, Name::Strict<408> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10921,7 +13941,8 @@ int Traits<Domain::Xml::Guest1>::parse(Domain::Xml::Guest1& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Guest1>::generate(const Domain::Xml::Guest1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Guest1>::produce(const Domain::Xml::Guest1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCsum(), m.get<0>()))
@@ -10938,6 +13959,16 @@ int Traits<Domain::Xml::Guest1>::generate(const Domain::Xml::Guest1& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Guest1>::generate(const Domain::Xml::Guest1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Guest1>::generate(const Domain::Xml::Guest1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Driver3
 
@@ -10971,6 +14002,13 @@ bool Driver3::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Driver3::save(QXmlStreamWriter& dst_) const
+{
+	Element<Driver3, Name::Strict<546> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -10988,7 +14026,8 @@ int Traits<Domain::Xml::Driver3>::parse(Domain::Xml::Driver3& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Driver3>::generate(const Domain::Xml::Driver3& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Driver3>::produce(const Domain::Xml::Driver3& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDriver(), m.get<0>()))
@@ -11001,6 +14040,16 @@ int Traits<Domain::Xml::Driver3>::generate(const Domain::Xml::Driver3& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Driver3>::generate(const Domain::Xml::Driver3& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Driver3>::generate(const Domain::Xml::Driver3& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Parameter
 
@@ -11034,6 +14083,13 @@ bool Parameter::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Parameter::save(QXmlStreamWriter& dst_) const
+{
+	Element<Parameter, Name::Strict<1084> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -11050,7 +14106,8 @@ int Traits<Domain::Xml::Parameter>::parse(Domain::Xml::Parameter& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Parameter>::generate(const Domain::Xml::Parameter& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Parameter>::produce(const Domain::Xml::Parameter& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -11061,6 +14118,16 @@ int Traits<Domain::Xml::Parameter>::generate(const Domain::Xml::Parameter& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Parameter>::generate(const Domain::Xml::Parameter& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Parameter>::generate(const Domain::Xml::Parameter& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct FilterrefNodeAttributes
 
@@ -11094,6 +14161,13 @@ bool FilterrefNodeAttributes::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool FilterrefNodeAttributes::save(QXmlStreamWriter& dst_) const
+{
+	Element<FilterrefNodeAttributes, Name::Strict<706> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -11110,7 +14184,8 @@ int Traits<Domain::Xml::FilterrefNodeAttributes>::parse(Domain::Xml::FilterrefNo
 	return output;
 }
 
-int Traits<Domain::Xml::FilterrefNodeAttributes>::generate(const Domain::Xml::FilterrefNodeAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::FilterrefNodeAttributes>::produce(const Domain::Xml::FilterrefNodeAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFilter(), m.get<0>()))
@@ -11121,6 +14196,16 @@ int Traits<Domain::Xml::FilterrefNodeAttributes>::generate(const Domain::Xml::Fi
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::FilterrefNodeAttributes>::generate(const Domain::Xml::FilterrefNodeAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::FilterrefNodeAttributes>::generate(const Domain::Xml::FilterrefNodeAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Tune
 
@@ -11154,6 +14239,13 @@ bool Tune::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Tune::save(QXmlStreamWriter& dst_) const
+{
+	Element<Tune, Name::Strict<708> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -11169,7 +14261,8 @@ int Traits<Domain::Xml::Tune>::parse(Domain::Xml::Tune& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Tune>::generate(const Domain::Xml::Tune& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Tune>::produce(const Domain::Xml::Tune& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSndbuf(), m.get<0>()))
@@ -11178,6 +14271,16 @@ int Traits<Domain::Xml::Tune>::generate(const Domain::Xml::Tune& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Tune>::generate(const Domain::Xml::Tune& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Tune>::generate(const Domain::Xml::Tune& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Rom
 
@@ -11211,6 +14314,13 @@ bool Rom::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Rom::save(QXmlStreamWriter& dst_) const
+{
+	Element<Rom, Name::Strict<275> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -11228,7 +14338,8 @@ int Traits<Domain::Xml::Rom>::parse(Domain::Xml::Rom& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Rom>::generate(const Domain::Xml::Rom& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Rom>::produce(const Domain::Xml::Rom& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getEnabled(), m.get<0>()))
@@ -11238,7 +14349,17 @@ int Traits<Domain::Xml::Rom>::generate(const Domain::Xml::Rom& src_, QDomElement
 	if (0 > Details::Marshal::assign(src_.getFile(), m.get<2>()))
 		return -1;
 
-	return m.produce(dst_);
+	return m.produce(dst_);
+}
+
+int Traits<Domain::Xml::Rom>::generate(const Domain::Xml::Rom& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Rom>::generate(const Domain::Xml::Rom& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -11274,6 +14395,13 @@ bool BandwidthAttributes::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool BandwidthAttributes::save(QXmlStreamWriter& dst_) const
+{
+	Element<BandwidthAttributes, Name::Strict<196> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -11292,7 +14420,8 @@ int Traits<Domain::Xml::BandwidthAttributes>::parse(Domain::Xml::BandwidthAttrib
 	return output;
 }
 
-int Traits<Domain::Xml::BandwidthAttributes>::generate(const Domain::Xml::BandwidthAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::BandwidthAttributes>::produce(const Domain::Xml::BandwidthAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAverage(), m.get<0>()))
@@ -11307,6 +14436,16 @@ int Traits<Domain::Xml::BandwidthAttributes>::generate(const Domain::Xml::Bandwi
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::BandwidthAttributes>::generate(const Domain::Xml::BandwidthAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::BandwidthAttributes>::generate(const Domain::Xml::BandwidthAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Bandwidth1
 
@@ -11340,6 +14479,13 @@ bool Bandwidth1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Bandwidth1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Bandwidth1, Name::Strict<193> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -11357,7 +14503,8 @@ int Traits<Domain::Xml::Bandwidth1>::parse(Domain::Xml::Bandwidth1& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Bandwidth1>::generate(const Domain::Xml::Bandwidth1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Bandwidth1>::produce(const Domain::Xml::Bandwidth1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getClassID(), m.get<0>()))
@@ -11370,6 +14517,16 @@ int Traits<Domain::Xml::Bandwidth1>::generate(const Domain::Xml::Bandwidth1& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Bandwidth1>::generate(const Domain::Xml::Bandwidth1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Bandwidth1>::generate(const Domain::Xml::Bandwidth1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Tag
 
@@ -11407,6 +14564,13 @@ bool Tag::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Tag::save(QXmlStreamWriter& dst_) const
+{
+	Element<Tag, Name::Strict<207> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -11423,7 +14587,8 @@ int Traits<Domain::Xml::Tag>::parse(Domain::Xml::Tag& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Tag>::generate(const Domain::Xml::Tag& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Tag>::produce(const Domain::Xml::Tag& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -11434,6 +14599,16 @@ int Traits<Domain::Xml::Tag>::generate(const Domain::Xml::Tag& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Tag>::generate(const Domain::Xml::Tag& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Tag>::generate(const Domain::Xml::Tag& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Port
 
@@ -11467,6 +14642,13 @@ bool Port::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Port::save(QXmlStreamWriter& dst_) const
+{
+	Element<Port, Name::Strict<212> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -11482,7 +14664,8 @@ int Traits<Domain::Xml::Port>::parse(Domain::Xml::Port& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Port>::generate(const Domain::Xml::Port& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Port>::produce(const Domain::Xml::Port& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIsolated(), m.get<0>()))
@@ -11491,6 +14674,16 @@ int Traits<Domain::Xml::Port>::generate(const Domain::Xml::Port& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Port>::generate(const Domain::Xml::Port& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Port>::generate(const Domain::Xml::Port& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Teaming9388
 
@@ -11500,12 +14693,23 @@ int Traits<Domain::Xml::Teaming9388>::parse(Domain::Xml::Teaming9388& , QStack<Q
 	return m.consume(stack_);
 }
 
-int Traits<Domain::Xml::Teaming9388>::generate(const Domain::Xml::Teaming9388& , QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Teaming9388>::produce(const Domain::Xml::Teaming9388& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Teaming9388>::generate(const Domain::Xml::Teaming9388& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Teaming9388>::generate(const Domain::Xml::Teaming9388& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface7022
 
@@ -11548,7 +14752,8 @@ int Traits<Domain::Xml::Interface7022>::parse(Domain::Xml::Interface7022& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Interface7022>::generate(const Domain::Xml::Interface7022& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Interface7022>::produce(const Domain::Xml::Interface7022& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSource(), m.get<1>().get<0>()))
@@ -11613,6 +14818,16 @@ int Traits<Domain::Xml::Interface7022>::generate(const Domain::Xml::Interface702
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Interface7022>::generate(const Domain::Xml::Interface7022& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Interface7022>::generate(const Domain::Xml::Interface7022& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface7023
 
@@ -11654,7 +14869,8 @@ int Traits<Domain::Xml::Interface7023>::parse(Domain::Xml::Interface7023& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Interface7023>::generate(const Domain::Xml::Interface7023& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Interface7023>::produce(const Domain::Xml::Interface7023& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSource(), m.get<1>().get<0>()))
@@ -11717,6 +14933,16 @@ int Traits<Domain::Xml::Interface7023>::generate(const Domain::Xml::Interface702
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Interface7023>::generate(const Domain::Xml::Interface7023& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Interface7023>::generate(const Domain::Xml::Interface7023& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source7
 
@@ -11754,6 +14980,13 @@ bool Source7::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source7::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source7, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -11771,7 +15004,8 @@ int Traits<Domain::Xml::Source7>::parse(Domain::Xml::Source7& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Source7>::generate(const Domain::Xml::Source7& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source7>::produce(const Domain::Xml::Source7& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -11784,6 +15018,16 @@ int Traits<Domain::Xml::Source7>::generate(const Domain::Xml::Source7& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source7>::generate(const Domain::Xml::Source7& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source7>::generate(const Domain::Xml::Source7& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface7024
 
@@ -11825,7 +15069,8 @@ int Traits<Domain::Xml::Interface7024>::parse(Domain::Xml::Interface7024& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Interface7024>::generate(const Domain::Xml::Interface7024& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Interface7024>::produce(const Domain::Xml::Interface7024& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSource(), m.get<1>().get<0>()))
@@ -11888,6 +15133,16 @@ int Traits<Domain::Xml::Interface7024>::generate(const Domain::Xml::Interface702
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Interface7024>::generate(const Domain::Xml::Interface7024& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Interface7024>::generate(const Domain::Xml::Interface7024& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source8
 
@@ -11921,6 +15176,13 @@ bool Source8::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source8::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source8, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -11937,7 +15199,8 @@ int Traits<Domain::Xml::Source8>::parse(Domain::Xml::Source8& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Source8>::generate(const Domain::Xml::Source8& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source8>::produce(const Domain::Xml::Source8& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getInterfaceNetworkAttributes(), m.get<0>()))
@@ -11948,6 +15211,16 @@ int Traits<Domain::Xml::Source8>::generate(const Domain::Xml::Source8& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source8>::generate(const Domain::Xml::Source8& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source8>::generate(const Domain::Xml::Source8& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface7025
 
@@ -11990,7 +15263,8 @@ int Traits<Domain::Xml::Interface7025>::parse(Domain::Xml::Interface7025& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Interface7025>::generate(const Domain::Xml::Interface7025& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Interface7025>::produce(const Domain::Xml::Interface7025& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSource(), m.get<1>().get<0>()))
@@ -12055,6 +15329,16 @@ int Traits<Domain::Xml::Interface7025>::generate(const Domain::Xml::Interface702
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Interface7025>::generate(const Domain::Xml::Interface7025& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Interface7025>::generate(const Domain::Xml::Interface7025& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source9
 
@@ -12088,6 +15372,13 @@ bool Source9::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source9::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source9, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -12105,7 +15396,8 @@ int Traits<Domain::Xml::Source9>::parse(Domain::Xml::Source9& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Source9>::generate(const Domain::Xml::Source9& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source9>::produce(const Domain::Xml::Source9& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDev(), m.get<0>()))
@@ -12118,6 +15410,16 @@ int Traits<Domain::Xml::Source9>::generate(const Domain::Xml::Source9& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source9>::generate(const Domain::Xml::Source9& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source9>::generate(const Domain::Xml::Source9& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface7026
 
@@ -12160,7 +15462,8 @@ int Traits<Domain::Xml::Interface7026>::parse(Domain::Xml::Interface7026& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Interface7026>::generate(const Domain::Xml::Interface7026& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Interface7026>::produce(const Domain::Xml::Interface7026& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSource(), m.get<1>().get<0>()))
@@ -12225,6 +15528,16 @@ int Traits<Domain::Xml::Interface7026>::generate(const Domain::Xml::Interface702
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Interface7026>::generate(const Domain::Xml::Interface7026& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Interface7026>::generate(const Domain::Xml::Interface7026& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct InterfaceOptions
 
@@ -12286,7 +15599,8 @@ int Traits<Domain::Xml::InterfaceOptions>::parse(Domain::Xml::InterfaceOptions&
 	return output;
 }
 
-int Traits<Domain::Xml::InterfaceOptions>::generate(const Domain::Xml::InterfaceOptions& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::InterfaceOptions>::produce(const Domain::Xml::InterfaceOptions& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getLink(), m.get<0>()))
@@ -12347,6 +15661,16 @@ int Traits<Domain::Xml::InterfaceOptions>::generate(const Domain::Xml::Interface
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::InterfaceOptions>::generate(const Domain::Xml::InterfaceOptions& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::InterfaceOptions>::generate(const Domain::Xml::InterfaceOptions& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface7028
 
@@ -12388,7 +15712,8 @@ int Traits<Domain::Xml::Interface7028>::parse(Domain::Xml::Interface7028& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Interface7028>::generate(const Domain::Xml::Interface7028& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Interface7028>::produce(const Domain::Xml::Interface7028& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSource(), m.get<1>().get<0>()))
@@ -12451,6 +15776,16 @@ int Traits<Domain::Xml::Interface7028>::generate(const Domain::Xml::Interface702
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Interface7028>::generate(const Domain::Xml::Interface7028& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Interface7028>::generate(const Domain::Xml::Interface7028& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source10
 
@@ -12488,6 +15823,13 @@ bool Source10::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source10::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source10, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -12504,7 +15846,8 @@ int Traits<Domain::Xml::Source10>::parse(Domain::Xml::Source10& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Source10>::generate(const Domain::Xml::Source10& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source10>::produce(const Domain::Xml::Source10& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAddress(), m.get<0>()))
@@ -12515,6 +15858,16 @@ int Traits<Domain::Xml::Source10>::generate(const Domain::Xml::Source10& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source10>::generate(const Domain::Xml::Source10& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source10>::generate(const Domain::Xml::Source10& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface7029
 
@@ -12543,7 +15896,8 @@ int Traits<Domain::Xml::Interface7029>::parse(Domain::Xml::Interface7029& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Interface7029>::generate(const Domain::Xml::Interface7029& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Interface7029>::produce(const Domain::Xml::Interface7029& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -12556,6 +15910,16 @@ int Traits<Domain::Xml::Interface7029>::generate(const Domain::Xml::Interface702
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Interface7029>::generate(const Domain::Xml::Interface7029& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Interface7029>::generate(const Domain::Xml::Interface7029& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source11
 
@@ -12593,6 +15957,13 @@ bool Source11::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source11::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source11, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -12609,7 +15980,8 @@ int Traits<Domain::Xml::Source11>::parse(Domain::Xml::Source11& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Source11>::generate(const Domain::Xml::Source11& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source11>::produce(const Domain::Xml::Source11& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAddress(), m.get<0>()))
@@ -12620,6 +15992,16 @@ int Traits<Domain::Xml::Source11>::generate(const Domain::Xml::Source11& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source11>::generate(const Domain::Xml::Source11& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source11>::generate(const Domain::Xml::Source11& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface7030
 
@@ -12635,7 +16017,8 @@ int Traits<Domain::Xml::Interface7030>::parse(Domain::Xml::Interface7030& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Interface7030>::generate(const Domain::Xml::Interface7030& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Interface7030>::produce(const Domain::Xml::Interface7030& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSource(), m.get<1>().get<0>()))
@@ -12646,6 +16029,16 @@ int Traits<Domain::Xml::Interface7030>::generate(const Domain::Xml::Interface703
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Interface7030>::generate(const Domain::Xml::Interface7030& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Interface7030>::generate(const Domain::Xml::Interface7030& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Usbproduct
 
@@ -12682,7 +16075,8 @@ int Traits<Domain::Xml::Usbproduct>::parse(Domain::Xml::Usbproduct& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Usbproduct>::generate(const Domain::Xml::Usbproduct& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Usbproduct>::produce(const Domain::Xml::Usbproduct& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getVendor(), m.get<0>()))
@@ -12693,6 +16087,16 @@ int Traits<Domain::Xml::Usbproduct>::generate(const Domain::Xml::Usbproduct& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Usbproduct>::generate(const Domain::Xml::Usbproduct& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Usbproduct>::generate(const Domain::Xml::Usbproduct& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Address
 
@@ -12726,6 +16130,13 @@ bool Address::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Address::save(QXmlStreamWriter& dst_) const
+{
+	Element<Address, Name::Strict<111> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -12742,7 +16153,8 @@ int Traits<Domain::Xml::Address>::parse(Domain::Xml::Address& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Address>::generate(const Domain::Xml::Address& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Address>::produce(const Domain::Xml::Address& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBus(), m.get<0>()))
@@ -12753,6 +16165,16 @@ int Traits<Domain::Xml::Address>::generate(const Domain::Xml::Address& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Address>::generate(const Domain::Xml::Address& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Address>::generate(const Domain::Xml::Address& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source7031
 
@@ -12768,7 +16190,8 @@ int Traits<Domain::Xml::Source7031>::parse(Domain::Xml::Source7031& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Source7031>::generate(const Domain::Xml::Source7031& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source7031>::produce(const Domain::Xml::Source7031& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getUsbproduct(), m.get<0>()))
@@ -12779,6 +16202,16 @@ int Traits<Domain::Xml::Source7031>::generate(const Domain::Xml::Source7031& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source7031>::generate(const Domain::Xml::Source7031& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source7031>::generate(const Domain::Xml::Source7031& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Address7033
 
@@ -12794,7 +16227,8 @@ int Traits<Domain::Xml::Address7033>::parse(Domain::Xml::Address7033& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Address7033>::generate(const Domain::Xml::Address7033& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Address7033>::produce(const Domain::Xml::Address7033& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBus(), m.get<1>()))
@@ -12805,6 +16239,16 @@ int Traits<Domain::Xml::Address7033>::generate(const Domain::Xml::Address7033& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Address7033>::generate(const Domain::Xml::Address7033& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Address7033>::generate(const Domain::Xml::Address7033& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source12
 
@@ -12838,6 +16282,13 @@ bool Source12::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source12::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source12, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -12854,7 +16305,8 @@ int Traits<Domain::Xml::Source12>::parse(Domain::Xml::Source12& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Source12>::generate(const Domain::Xml::Source12& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source12>::produce(const Domain::Xml::Source12& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMissing(), m.get<0>()))
@@ -12862,7 +16314,17 @@ int Traits<Domain::Xml::Source12>::generate(const Domain::Xml::Source12& src_, Q
 	if (0 > Details::Marshal::assign(src_.getSource(), m.get<1>()))
 		return -1;
 
-	return m.produce(dst_);
+	return m.produce(dst_);
+}
+
+int Traits<Domain::Xml::Source12>::generate(const Domain::Xml::Source12& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source12>::generate(const Domain::Xml::Source12& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -12908,7 +16370,8 @@ int Traits<Domain::Xml::Interface7035>::parse(Domain::Xml::Interface7035& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Interface7035>::generate(const Domain::Xml::Interface7035& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Interface7035>::produce(const Domain::Xml::Interface7035& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getManaged(), m.get<1>()))
@@ -12975,6 +16438,16 @@ int Traits<Domain::Xml::Interface7035>::generate(const Domain::Xml::Interface703
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Interface7035>::generate(const Domain::Xml::Interface7035& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Interface7035>::generate(const Domain::Xml::Interface7035& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface
 
@@ -13008,6 +16481,13 @@ bool Interface::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Interface::save(QXmlStreamWriter& dst_) const
+{
+	Element<Interface, Name::Strict<657> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -13024,7 +16504,8 @@ int Traits<Domain::Xml::Interface>::parse(Domain::Xml::Interface& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Interface>::generate(const Domain::Xml::Interface& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Interface>::produce(const Domain::Xml::Interface& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getInterface(), m.get<0>()))
@@ -13035,6 +16516,16 @@ int Traits<Domain::Xml::Interface>::generate(const Domain::Xml::Interface& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Interface>::generate(const Domain::Xml::Interface& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Interface>::generate(const Domain::Xml::Interface& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Anonymous9430
 
@@ -13073,7 +16564,8 @@ int Traits<Domain::Xml::Anonymous9430>::parse(Domain::Xml::Anonymous9430& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Anonymous9430>::generate(const Domain::Xml::Anonymous9430& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Anonymous9430>::produce(const Domain::Xml::Anonymous9430& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -13088,6 +16580,16 @@ int Traits<Domain::Xml::Anonymous9430>::generate(const Domain::Xml::Anonymous943
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Anonymous9430>::generate(const Domain::Xml::Anonymous9430& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Anonymous9430>::generate(const Domain::Xml::Anonymous9430& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Input
 
@@ -13125,6 +16627,13 @@ bool Input::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Input::save(QXmlStreamWriter& dst_) const
+{
+	Element<Input, Name::Strict<907> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -13142,7 +16651,8 @@ int Traits<Domain::Xml::Input>::parse(Domain::Xml::Input& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Input>::generate(const Domain::Xml::Input& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Input>::produce(const Domain::Xml::Input& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -13155,6 +16665,16 @@ int Traits<Domain::Xml::Input>::generate(const Domain::Xml::Input& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Input>::generate(const Domain::Xml::Input& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Input>::generate(const Domain::Xml::Input& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Sound
 
@@ -13192,6 +16712,13 @@ bool Sound::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Sound::save(QXmlStreamWriter& dst_) const
+{
+	Element<Sound, Name::Strict<872> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -13212,7 +16739,8 @@ int Traits<Domain::Xml::Sound>::parse(Domain::Xml::Sound& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Sound>::generate(const Domain::Xml::Sound& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Sound>::produce(const Domain::Xml::Sound& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -13231,6 +16759,16 @@ int Traits<Domain::Xml::Sound>::generate(const Domain::Xml::Sound& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Sound>::generate(const Domain::Xml::Sound& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Sound>::generate(const Domain::Xml::Sound& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source13
 
@@ -13264,6 +16802,13 @@ bool Source13::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source13::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source13, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -13280,7 +16825,8 @@ int Traits<Domain::Xml::Source13>::parse(Domain::Xml::Source13& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Source13>::generate(const Domain::Xml::Source13& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source13>::produce(const Domain::Xml::Source13& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getStartupPolicy(), m.get<0>()))
@@ -13291,6 +16837,16 @@ int Traits<Domain::Xml::Source13>::generate(const Domain::Xml::Source13& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source13>::generate(const Domain::Xml::Source13& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source13>::generate(const Domain::Xml::Source13& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hostdevsubsyspci
 
@@ -13307,7 +16863,8 @@ int Traits<Domain::Xml::Hostdevsubsyspci>::parse(Domain::Xml::Hostdevsubsyspci&
 	return output;
 }
 
-int Traits<Domain::Xml::Hostdevsubsyspci>::generate(const Domain::Xml::Hostdevsubsyspci& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hostdevsubsyspci>::produce(const Domain::Xml::Hostdevsubsyspci& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDriver(), m.get<1>().get<0>()))
@@ -13320,6 +16877,16 @@ int Traits<Domain::Xml::Hostdevsubsyspci>::generate(const Domain::Xml::Hostdevsu
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hostdevsubsyspci>::generate(const Domain::Xml::Hostdevsubsyspci& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hostdevsubsyspci>::generate(const Domain::Xml::Hostdevsubsyspci& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source7072
 
@@ -13335,7 +16902,8 @@ int Traits<Domain::Xml::Source7072>::parse(Domain::Xml::Source7072& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Source7072>::generate(const Domain::Xml::Source7072& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source7072>::produce(const Domain::Xml::Source7072& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getUsbproduct(), m.get<0>()))
@@ -13346,6 +16914,16 @@ int Traits<Domain::Xml::Source7072>::generate(const Domain::Xml::Source7072& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source7072>::generate(const Domain::Xml::Source7072& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source7072>::generate(const Domain::Xml::Source7072& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source14
 
@@ -13379,6 +16957,13 @@ bool Source14::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source14::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source14, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -13395,7 +16980,8 @@ int Traits<Domain::Xml::Source14>::parse(Domain::Xml::Source14& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Source14>::generate(const Domain::Xml::Source14& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source14>::produce(const Domain::Xml::Source14& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getStartupPolicy(), m.get<0>()))
@@ -13406,6 +16992,16 @@ int Traits<Domain::Xml::Source14>::generate(const Domain::Xml::Source14& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source14>::generate(const Domain::Xml::Source14& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source14>::generate(const Domain::Xml::Source14& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hostdevsubsysusb
 
@@ -13421,7 +17017,8 @@ int Traits<Domain::Xml::Hostdevsubsysusb>::parse(Domain::Xml::Hostdevsubsysusb&
 	return output;
 }
 
-int Traits<Domain::Xml::Hostdevsubsysusb>::generate(const Domain::Xml::Hostdevsubsysusb& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hostdevsubsysusb>::produce(const Domain::Xml::Hostdevsubsysusb& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getReplug(), m.get<1>()))
@@ -13432,6 +17029,16 @@ int Traits<Domain::Xml::Hostdevsubsysusb>::generate(const Domain::Xml::Hostdevsu
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hostdevsubsysusb>::generate(const Domain::Xml::Hostdevsubsysusb& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hostdevsubsysusb>::generate(const Domain::Xml::Hostdevsubsysusb& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Parentaddr
 
@@ -13465,6 +17072,13 @@ bool Parentaddr::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Parentaddr::save(QXmlStreamWriter& dst_) const
+{
+	Element<Parentaddr, Name::Strict<109> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -13481,7 +17095,8 @@ int Traits<Domain::Xml::Parentaddr>::parse(Domain::Xml::Parentaddr& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Parentaddr>::generate(const Domain::Xml::Parentaddr& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Parentaddr>::produce(const Domain::Xml::Parentaddr& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getUniqueId(), m.get<0>()))
@@ -13492,6 +17107,16 @@ int Traits<Domain::Xml::Parentaddr>::generate(const Domain::Xml::Parentaddr& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Parentaddr>::generate(const Domain::Xml::Parentaddr& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Parentaddr>::generate(const Domain::Xml::Parentaddr& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Adapter118
 
@@ -13512,7 +17137,8 @@ int Traits<Domain::Xml::Adapter118>::parse(Domain::Xml::Adapter118& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Adapter118>::generate(const Domain::Xml::Adapter118& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Adapter118>::produce(const Domain::Xml::Adapter118& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getParent(), m.get<1>()))
@@ -13533,6 +17159,16 @@ int Traits<Domain::Xml::Adapter118>::generate(const Domain::Xml::Adapter118& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Adapter118>::generate(const Domain::Xml::Adapter118& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Adapter118>::generate(const Domain::Xml::Adapter118& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Scsiaddress
 
@@ -13566,6 +17202,13 @@ bool Scsiaddress::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Scsiaddress::save(QXmlStreamWriter& dst_) const
+{
+	Element<Scsiaddress, Name::Strict<111> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -13583,7 +17226,8 @@ int Traits<Domain::Xml::Scsiaddress>::parse(Domain::Xml::Scsiaddress& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Scsiaddress>::generate(const Domain::Xml::Scsiaddress& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Scsiaddress>::produce(const Domain::Xml::Scsiaddress& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBus(), m.get<0>()))
@@ -13596,6 +17240,16 @@ int Traits<Domain::Xml::Scsiaddress>::generate(const Domain::Xml::Scsiaddress& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Scsiaddress>::generate(const Domain::Xml::Scsiaddress& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Scsiaddress>::generate(const Domain::Xml::Scsiaddress& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source7074
 
@@ -13612,7 +17266,8 @@ int Traits<Domain::Xml::Source7074>::parse(Domain::Xml::Source7074& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Source7074>::generate(const Domain::Xml::Source7074& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source7074>::produce(const Domain::Xml::Source7074& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getProtocol(), m.get<0>()))
@@ -13625,6 +17280,16 @@ int Traits<Domain::Xml::Source7074>::generate(const Domain::Xml::Source7074& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source7074>::generate(const Domain::Xml::Source7074& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source7074>::generate(const Domain::Xml::Source7074& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Host1
 
@@ -13658,6 +17323,13 @@ bool Host1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Host1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Host1, Name::Strict<513> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -13674,7 +17346,8 @@ int Traits<Domain::Xml::Host1>::parse(Domain::Xml::Host1& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Host1>::generate(const Domain::Xml::Host1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Host1>::produce(const Domain::Xml::Host1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -13685,6 +17358,16 @@ int Traits<Domain::Xml::Host1>::generate(const Domain::Xml::Host1& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Host1>::generate(const Domain::Xml::Host1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Host1>::generate(const Domain::Xml::Host1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source7075
 
@@ -13715,7 +17398,8 @@ int Traits<Domain::Xml::Source7075>::parse(Domain::Xml::Source7075& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Source7075>::generate(const Domain::Xml::Source7075& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source7075>::produce(const Domain::Xml::Source7075& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getProtocol(), m.get<0>()))
@@ -13732,6 +17416,16 @@ int Traits<Domain::Xml::Source7075>::generate(const Domain::Xml::Source7075& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source7075>::generate(const Domain::Xml::Source7075& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source7075>::generate(const Domain::Xml::Source7075& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hostdevsubsysscsi
 
@@ -13748,7 +17442,8 @@ int Traits<Domain::Xml::Hostdevsubsysscsi>::parse(Domain::Xml::Hostdevsubsysscsi
 	return output;
 }
 
-int Traits<Domain::Xml::Hostdevsubsysscsi>::generate(const Domain::Xml::Hostdevsubsysscsi& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hostdevsubsysscsi>::produce(const Domain::Xml::Hostdevsubsysscsi& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSgio(), m.get<1>()))
@@ -13761,6 +17456,16 @@ int Traits<Domain::Xml::Hostdevsubsysscsi>::generate(const Domain::Xml::Hostdevs
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hostdevsubsysscsi>::generate(const Domain::Xml::Hostdevsubsysscsi& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hostdevsubsysscsi>::generate(const Domain::Xml::Hostdevsubsysscsi& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hostdevsubsys
 
@@ -13797,7 +17502,8 @@ int Traits<Domain::Xml::Hostdevsubsys>::parse(Domain::Xml::Hostdevsubsys& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Hostdevsubsys>::generate(const Domain::Xml::Hostdevsubsys& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hostdevsubsys>::produce(const Domain::Xml::Hostdevsubsys& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getManaged(), m.get<1>()))
@@ -13808,6 +17514,16 @@ int Traits<Domain::Xml::Hostdevsubsys>::generate(const Domain::Xml::Hostdevsubsy
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hostdevsubsys>::generate(const Domain::Xml::Hostdevsubsys& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hostdevsubsys>::generate(const Domain::Xml::Hostdevsubsys& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Ip1
 
@@ -13841,6 +17557,13 @@ bool Ip1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Ip1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Ip1, Name::Strict<689> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -13859,7 +17582,8 @@ int Traits<Domain::Xml::Ip1>::parse(Domain::Xml::Ip1& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Ip1>::generate(const Domain::Xml::Ip1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Ip1>::produce(const Domain::Xml::Ip1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAddress(), m.get<0>()))
@@ -13874,6 +17598,16 @@ int Traits<Domain::Xml::Ip1>::generate(const Domain::Xml::Ip1& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Ip1>::generate(const Domain::Xml::Ip1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Ip1>::generate(const Domain::Xml::Ip1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct InterfaceIpInfo
 
@@ -13910,7 +17644,8 @@ int Traits<Domain::Xml::InterfaceIpInfo>::parse(Domain::Xml::InterfaceIpInfo& ds
 	return output;
 }
 
-int Traits<Domain::Xml::InterfaceIpInfo>::generate(const Domain::Xml::InterfaceIpInfo& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::InterfaceIpInfo>::produce(const Domain::Xml::InterfaceIpInfo& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIpList(), m.get<0>()))
@@ -13921,6 +17656,16 @@ int Traits<Domain::Xml::InterfaceIpInfo>::generate(const Domain::Xml::InterfaceI
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::InterfaceIpInfo>::generate(const Domain::Xml::InterfaceIpInfo& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::InterfaceIpInfo>::generate(const Domain::Xml::InterfaceIpInfo& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hostdevcapsnet
 
@@ -13957,7 +17702,8 @@ int Traits<Domain::Xml::Hostdevcapsnet>::parse(Domain::Xml::Hostdevcapsnet& dst_
 	return output;
 }
 
-int Traits<Domain::Xml::Hostdevcapsnet>::generate(const Domain::Xml::Hostdevcapsnet& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hostdevcapsnet>::produce(const Domain::Xml::Hostdevcapsnet& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSource(), m.get<1>()))
@@ -13968,6 +17714,16 @@ int Traits<Domain::Xml::Hostdevcapsnet>::generate(const Domain::Xml::Hostdevcaps
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hostdevcapsnet>::generate(const Domain::Xml::Hostdevcapsnet& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hostdevcapsnet>::generate(const Domain::Xml::Hostdevcapsnet& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hostdev
 
@@ -14005,6 +17761,13 @@ bool Hostdev::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Hostdev::save(QXmlStreamWriter& dst_) const
+{
+	Element<Hostdev, Name::Strict<676> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -14027,7 +17790,8 @@ int Traits<Domain::Xml::Hostdev>::parse(Domain::Xml::Hostdev& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Hostdev>::generate(const Domain::Xml::Hostdev& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hostdev>::produce(const Domain::Xml::Hostdev& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getChoice7065(), m.get<0>()))
@@ -14050,6 +17814,16 @@ int Traits<Domain::Xml::Hostdev>::generate(const Domain::Xml::Hostdev& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hostdev>::generate(const Domain::Xml::Hostdev& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hostdev>::generate(const Domain::Xml::Hostdev& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Graphics7038
 
@@ -14067,7 +17841,8 @@ int Traits<Domain::Xml::Graphics7038>::parse(Domain::Xml::Graphics7038& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::Graphics7038>::generate(const Domain::Xml::Graphics7038& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Graphics7038>::produce(const Domain::Xml::Graphics7038& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDisplay(), m.get<1>()))
@@ -14082,6 +17857,16 @@ int Traits<Domain::Xml::Graphics7038>::generate(const Domain::Xml::Graphics7038&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Graphics7038>::generate(const Domain::Xml::Graphics7038& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Graphics7038>::generate(const Domain::Xml::Graphics7038& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Variant5124
 
@@ -14101,7 +17886,8 @@ int Traits<Domain::Xml::Variant5124>::parse(Domain::Xml::Variant5124& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Variant5124>::generate(const Domain::Xml::Variant5124& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Variant5124>::produce(const Domain::Xml::Variant5124& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPort(), m.get<0>()))
@@ -14117,7 +17903,17 @@ int Traits<Domain::Xml::Variant5124>::generate(const Domain::Xml::Variant5124& s
 	if (0 > Details::Marshal::assign(src_.getPowerControl(), m.get<5>()))
 		return -1;
 
-	return m.produce(dst_);
+	return m.produce(dst_);
+}
+
+int Traits<Domain::Xml::Variant5124>::generate(const Domain::Xml::Variant5124& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Variant5124>::generate(const Domain::Xml::Variant5124& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -14135,7 +17931,8 @@ int Traits<Domain::Xml::Listen7044>::parse(Domain::Xml::Listen7044& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Listen7044>::generate(const Domain::Xml::Listen7044& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Listen7044>::produce(const Domain::Xml::Listen7044& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getNetwork(), m.get<1>()))
@@ -14146,6 +17943,16 @@ int Traits<Domain::Xml::Listen7044>::generate(const Domain::Xml::Listen7044& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Listen7044>::generate(const Domain::Xml::Listen7044& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Listen7044>::generate(const Domain::Xml::Listen7044& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Listen9392
 
@@ -14155,12 +17962,23 @@ int Traits<Domain::Xml::Listen9392>::parse(Domain::Xml::Listen9392& , QStack<QDo
 	return m.consume(stack_);
 }
 
-int Traits<Domain::Xml::Listen9392>::generate(const Domain::Xml::Listen9392& , QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Listen9392>::produce(const Domain::Xml::Listen9392& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Listen9392>::generate(const Domain::Xml::Listen9392& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Listen9392>::generate(const Domain::Xml::Listen9392& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Graphics7039
 
@@ -14180,7 +17998,8 @@ int Traits<Domain::Xml::Graphics7039>::parse(Domain::Xml::Graphics7039& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::Graphics7039>::generate(const Domain::Xml::Graphics7039& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Graphics7039>::produce(const Domain::Xml::Graphics7039& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getChoice5126(), m.get<1>()))
@@ -14199,6 +18018,16 @@ int Traits<Domain::Xml::Graphics7039>::generate(const Domain::Xml::Graphics7039&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Graphics7039>::generate(const Domain::Xml::Graphics7039& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Graphics7039>::generate(const Domain::Xml::Graphics7039& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Channel
 
@@ -14236,6 +18065,13 @@ bool Channel::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Channel::save(QXmlStreamWriter& dst_) const
+{
+	Element<Channel, Name::Strict<744> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -14252,7 +18088,8 @@ int Traits<Domain::Xml::Channel>::parse(Domain::Xml::Channel& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Channel>::generate(const Domain::Xml::Channel& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Channel>::produce(const Domain::Xml::Channel& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -14263,6 +18100,16 @@ int Traits<Domain::Xml::Channel>::generate(const Domain::Xml::Channel& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Channel>::generate(const Domain::Xml::Channel& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Channel>::generate(const Domain::Xml::Channel& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Gl
 
@@ -14300,6 +18147,13 @@ bool Gl::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Gl::save(QXmlStreamWriter& dst_) const
+{
+	Element<Gl, Name::Strict<9188> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -14316,7 +18170,8 @@ int Traits<Domain::Xml::Gl>::parse(Domain::Xml::Gl& dst_, QStack<QDomElement>& s
 	return output;
 }
 
-int Traits<Domain::Xml::Gl>::generate(const Domain::Xml::Gl& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Gl>::produce(const Domain::Xml::Gl& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getEnable(), m.get<0>()))
@@ -14327,6 +18182,16 @@ int Traits<Domain::Xml::Gl>::generate(const Domain::Xml::Gl& src_, QDomElement&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Gl>::generate(const Domain::Xml::Gl& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Gl>::generate(const Domain::Xml::Gl& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Graphics7040
 
@@ -14360,7 +18225,8 @@ int Traits<Domain::Xml::Graphics7040>::parse(Domain::Xml::Graphics7040& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::Graphics7040>::generate(const Domain::Xml::Graphics7040& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Graphics7040>::produce(const Domain::Xml::Graphics7040& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPort(), m.get<1>()))
@@ -14407,6 +18273,16 @@ int Traits<Domain::Xml::Graphics7040>::generate(const Domain::Xml::Graphics7040&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Graphics7040>::generate(const Domain::Xml::Graphics7040& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Graphics7040>::generate(const Domain::Xml::Graphics7040& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Graphics7041
 
@@ -14426,7 +18302,8 @@ int Traits<Domain::Xml::Graphics7041>::parse(Domain::Xml::Graphics7041& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::Graphics7041>::generate(const Domain::Xml::Graphics7041& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Graphics7041>::produce(const Domain::Xml::Graphics7041& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPort(), m.get<1>()))
@@ -14445,6 +18322,16 @@ int Traits<Domain::Xml::Graphics7041>::generate(const Domain::Xml::Graphics7041&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Graphics7041>::generate(const Domain::Xml::Graphics7041& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Graphics7041>::generate(const Domain::Xml::Graphics7041& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Graphics7042
 
@@ -14460,7 +18347,8 @@ int Traits<Domain::Xml::Graphics7042>::parse(Domain::Xml::Graphics7042& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::Graphics7042>::generate(const Domain::Xml::Graphics7042& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Graphics7042>::produce(const Domain::Xml::Graphics7042& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDisplay(), m.get<1>()))
@@ -14471,6 +18359,16 @@ int Traits<Domain::Xml::Graphics7042>::generate(const Domain::Xml::Graphics7042&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Graphics7042>::generate(const Domain::Xml::Graphics7042& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Graphics7042>::generate(const Domain::Xml::Graphics7042& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Gl1
 
@@ -14504,6 +18402,13 @@ bool Gl1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Gl1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Gl1, Name::Strict<9188> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -14519,7 +18424,8 @@ int Traits<Domain::Xml::Gl1>::parse(Domain::Xml::Gl1& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Gl1>::generate(const Domain::Xml::Gl1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Gl1>::produce(const Domain::Xml::Gl1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getRendernode(), m.get<0>()))
@@ -14528,6 +18434,16 @@ int Traits<Domain::Xml::Gl1>::generate(const Domain::Xml::Gl1& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Gl1>::generate(const Domain::Xml::Gl1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Gl1>::generate(const Domain::Xml::Gl1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Driver4
 
@@ -14561,6 +18477,13 @@ bool Driver4::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Driver4::save(QXmlStreamWriter& dst_) const
+{
+	Element<Driver4, Name::Strict<546> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -14578,7 +18501,8 @@ int Traits<Domain::Xml::Driver4>::parse(Domain::Xml::Driver4& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Driver4>::generate(const Domain::Xml::Driver4& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Driver4>::produce(const Domain::Xml::Driver4& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getVirtioOptions(), m.get<0>()))
@@ -14591,6 +18515,16 @@ int Traits<Domain::Xml::Driver4>::generate(const Domain::Xml::Driver4& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Driver4>::generate(const Domain::Xml::Driver4& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Driver4>::generate(const Domain::Xml::Driver4& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Model7046
 
@@ -14607,7 +18541,8 @@ int Traits<Domain::Xml::Model7046>::parse(Domain::Xml::Model7046& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Model7046>::generate(const Domain::Xml::Model7046& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Model7046>::produce(const Domain::Xml::Model7046& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getRam(), m.get<1>()))
@@ -14620,6 +18555,16 @@ int Traits<Domain::Xml::Model7046>::generate(const Domain::Xml::Model7046& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Model7046>::generate(const Domain::Xml::Model7046& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Model7046>::generate(const Domain::Xml::Model7046& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Acceleration
 
@@ -14653,6 +18598,13 @@ bool Acceleration::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Acceleration::save(QXmlStreamWriter& dst_) const
+{
+	Element<Acceleration, Name::Strict<788> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -14670,7 +18622,8 @@ int Traits<Domain::Xml::Acceleration>::parse(Domain::Xml::Acceleration& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::Acceleration>::generate(const Domain::Xml::Acceleration& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Acceleration>::produce(const Domain::Xml::Acceleration& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAccel3d(), m.get<0>()))
@@ -14683,6 +18636,16 @@ int Traits<Domain::Xml::Acceleration>::generate(const Domain::Xml::Acceleration&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Acceleration>::generate(const Domain::Xml::Acceleration& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Acceleration>::generate(const Domain::Xml::Acceleration& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Resolution
 
@@ -14720,6 +18683,13 @@ bool Resolution::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Resolution::save(QXmlStreamWriter& dst_) const
+{
+	Element<Resolution, Name::Strict<8679> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -14736,7 +18706,8 @@ int Traits<Domain::Xml::Resolution>::parse(Domain::Xml::Resolution& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Resolution>::generate(const Domain::Xml::Resolution& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Resolution>::produce(const Domain::Xml::Resolution& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getX(), m.get<0>()))
@@ -14747,6 +18718,16 @@ int Traits<Domain::Xml::Resolution>::generate(const Domain::Xml::Resolution& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Resolution>::generate(const Domain::Xml::Resolution& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Resolution>::generate(const Domain::Xml::Resolution& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Model1
 
@@ -14780,6 +18761,13 @@ bool Model1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Model1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Model1, Name::Strict<231> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -14800,7 +18788,8 @@ int Traits<Domain::Xml::Model1>::parse(Domain::Xml::Model1& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Model1>::generate(const Domain::Xml::Model1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Model1>::produce(const Domain::Xml::Model1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -14819,6 +18808,16 @@ int Traits<Domain::Xml::Model1>::generate(const Domain::Xml::Model1& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Model1>::generate(const Domain::Xml::Model1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Model1>::generate(const Domain::Xml::Model1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Video
 
@@ -14852,6 +18851,13 @@ bool Video::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Video::save(QXmlStreamWriter& dst_) const
+{
+	Element<Video, Name::Strict<779> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -14871,7 +18877,8 @@ int Traits<Domain::Xml::Video>::parse(Domain::Xml::Video& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Video>::generate(const Domain::Xml::Video& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Video>::produce(const Domain::Xml::Video& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDriver(), m.get<0>()))
@@ -14888,6 +18895,16 @@ int Traits<Domain::Xml::Video>::generate(const Domain::Xml::Video& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Video>::generate(const Domain::Xml::Video& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Video>::generate(const Domain::Xml::Video& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source15
 
@@ -14921,6 +18938,13 @@ bool Source15::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source15::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source15, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -14945,7 +18969,8 @@ int Traits<Domain::Xml::Source15>::parse(Domain::Xml::Source15& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Source15>::generate(const Domain::Xml::Source15& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source15>::produce(const Domain::Xml::Source15& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMode(), m.get<0>()))
@@ -14972,6 +18997,16 @@ int Traits<Domain::Xml::Source15>::generate(const Domain::Xml::Source15& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source15>::generate(const Domain::Xml::Source15& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source15>::generate(const Domain::Xml::Source15& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Protocol
 
@@ -15005,6 +19040,13 @@ bool Protocol::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Protocol::save(QXmlStreamWriter& dst_) const
+{
+	Element<Protocol, Name::Strict<203> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -15020,7 +19062,8 @@ int Traits<Domain::Xml::Protocol>::parse(Domain::Xml::Protocol& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Protocol>::generate(const Domain::Xml::Protocol& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Protocol>::produce(const Domain::Xml::Protocol& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -15029,6 +19072,16 @@ int Traits<Domain::Xml::Protocol>::generate(const Domain::Xml::Protocol& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Protocol>::generate(const Domain::Xml::Protocol& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Protocol>::generate(const Domain::Xml::Protocol& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Log
 
@@ -15062,6 +19115,13 @@ bool Log::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Log::save(QXmlStreamWriter& dst_) const
+{
+	Element<Log, Name::Strict<864> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -15078,7 +19138,8 @@ int Traits<Domain::Xml::Log>::parse(Domain::Xml::Log& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Log>::generate(const Domain::Xml::Log& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Log>::produce(const Domain::Xml::Log& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFile(), m.get<0>()))
@@ -15089,6 +19150,16 @@ int Traits<Domain::Xml::Log>::generate(const Domain::Xml::Log& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Log>::generate(const Domain::Xml::Log& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Log>::generate(const Domain::Xml::Log& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct QemucdevSrcDef
 
@@ -15126,7 +19197,8 @@ int Traits<Domain::Xml::QemucdevSrcDef>::parse(Domain::Xml::QemucdevSrcDef& dst_
 	return output;
 }
 
-int Traits<Domain::Xml::QemucdevSrcDef>::generate(const Domain::Xml::QemucdevSrcDef& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::QemucdevSrcDef>::produce(const Domain::Xml::QemucdevSrcDef& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSourceList(), m.get<0>()))
@@ -15139,6 +19211,16 @@ int Traits<Domain::Xml::QemucdevSrcDef>::generate(const Domain::Xml::QemucdevSrc
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::QemucdevSrcDef>::generate(const Domain::Xml::QemucdevSrcDef& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::QemucdevSrcDef>::generate(const Domain::Xml::QemucdevSrcDef& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Target4
 
@@ -15172,6 +19254,13 @@ bool Target4::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Target4::save(QXmlStreamWriter& dst_) const
+{
+	Element<Target4, Name::Strict<323> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -15189,7 +19278,8 @@ int Traits<Domain::Xml::Target4>::parse(Domain::Xml::Target4& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Target4>::generate(const Domain::Xml::Target4& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Target4>::produce(const Domain::Xml::Target4& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getChoice8004(), m.get<0>()))
@@ -15202,6 +19292,16 @@ int Traits<Domain::Xml::Target4>::generate(const Domain::Xml::Target4& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Target4>::generate(const Domain::Xml::Target4& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Target4>::generate(const Domain::Xml::Target4& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Qemucdev
 
@@ -15239,6 +19339,13 @@ bool Qemucdev::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Qemucdev::save(QXmlStreamWriter& dst_) const
+{
+	Element<Qemucdev, Name::Strict<453> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -15259,7 +19366,8 @@ int Traits<Domain::Xml::Qemucdev>::parse(Domain::Xml::Qemucdev& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Qemucdev>::generate(const Domain::Xml::Qemucdev& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Qemucdev>::produce(const Domain::Xml::Qemucdev& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -15278,6 +19386,16 @@ int Traits<Domain::Xml::Qemucdev>::generate(const Domain::Xml::Qemucdev& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Qemucdev>::generate(const Domain::Xml::Qemucdev& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Qemucdev>::generate(const Domain::Xml::Qemucdev& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Target5
 
@@ -15311,6 +19429,13 @@ bool Target5::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Target5::save(QXmlStreamWriter& dst_) const
+{
+	Element<Target5, Name::Strict<323> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -15327,7 +19452,8 @@ int Traits<Domain::Xml::Target5>::parse(Domain::Xml::Target5& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Target5>::generate(const Domain::Xml::Target5& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Target5>::produce(const Domain::Xml::Target5& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAddress(), m.get<1>()))
@@ -15335,7 +19461,17 @@ int Traits<Domain::Xml::Target5>::generate(const Domain::Xml::Target5& src_, QDo
 	if (0 > Details::Marshal::assign(src_.getPort(), m.get<2>()))
 		return -1;
 
-	return m.produce(dst_);
+	return m.produce(dst_);
+}
+
+int Traits<Domain::Xml::Target5>::generate(const Domain::Xml::Target5& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Target5>::generate(const Domain::Xml::Target5& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -15371,6 +19507,13 @@ bool Target6::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Target6::save(QXmlStreamWriter& dst_) const
+{
+	Element<Target6, Name::Strict<323> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -15387,7 +19530,8 @@ int Traits<Domain::Xml::Target6>::parse(Domain::Xml::Target6& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Target6>::generate(const Domain::Xml::Target6& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Target6>::produce(const Domain::Xml::Target6& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<1>()))
@@ -15398,6 +19542,16 @@ int Traits<Domain::Xml::Target6>::generate(const Domain::Xml::Target6& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Target6>::generate(const Domain::Xml::Target6& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Target6>::generate(const Domain::Xml::Target6& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Channel1
 
@@ -15435,6 +19589,13 @@ bool Channel1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Channel1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Channel1, Name::Strict<744> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -15455,7 +19616,8 @@ int Traits<Domain::Xml::Channel1>::parse(Domain::Xml::Channel1& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Channel1>::generate(const Domain::Xml::Channel1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Channel1>::produce(const Domain::Xml::Channel1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -15474,6 +19636,16 @@ int Traits<Domain::Xml::Channel1>::generate(const Domain::Xml::Channel1& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Channel1>::generate(const Domain::Xml::Channel1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Channel1>::generate(const Domain::Xml::Channel1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Smartcard7059
 
@@ -15483,12 +19655,23 @@ int Traits<Domain::Xml::Smartcard7059>::parse(Domain::Xml::Smartcard7059& , QSta
 	return m.consume(stack_);
 }
 
-int Traits<Domain::Xml::Smartcard7059>::generate(const Domain::Xml::Smartcard7059& , QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Smartcard7059>::produce(const Domain::Xml::Smartcard7059& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Smartcard7059>::generate(const Domain::Xml::Smartcard7059& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Smartcard7059>::generate(const Domain::Xml::Smartcard7059& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Smartcard7060
 
@@ -15506,7 +19689,8 @@ int Traits<Domain::Xml::Smartcard7060>::parse(Domain::Xml::Smartcard7060& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Smartcard7060>::generate(const Domain::Xml::Smartcard7060& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Smartcard7060>::produce(const Domain::Xml::Smartcard7060& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCertificate(), m.get<1>()))
@@ -15521,6 +19705,16 @@ int Traits<Domain::Xml::Smartcard7060>::generate(const Domain::Xml::Smartcard706
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Smartcard7060>::generate(const Domain::Xml::Smartcard7060& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Smartcard7060>::generate(const Domain::Xml::Smartcard7060& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Smartcard7061
 
@@ -15549,7 +19743,8 @@ int Traits<Domain::Xml::Smartcard7061>::parse(Domain::Xml::Smartcard7061& dst_,
 	return output;
 }
 
-int Traits<Domain::Xml::Smartcard7061>::generate(const Domain::Xml::Smartcard7061& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Smartcard7061>::produce(const Domain::Xml::Smartcard7061& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<1>()))
@@ -15562,6 +19757,16 @@ int Traits<Domain::Xml::Smartcard7061>::generate(const Domain::Xml::Smartcard706
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Smartcard7061>::generate(const Domain::Xml::Smartcard7061& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Smartcard7061>::generate(const Domain::Xml::Smartcard7061& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Smartcard
 
@@ -15595,6 +19800,13 @@ bool Smartcard::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Smartcard::save(QXmlStreamWriter& dst_) const
+{
+	Element<Smartcard, Name::Strict<750> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -15613,7 +19825,8 @@ int Traits<Domain::Xml::Smartcard>::parse(Domain::Xml::Smartcard& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Smartcard>::generate(const Domain::Xml::Smartcard& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Smartcard>::produce(const Domain::Xml::Smartcard& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSmartcard(), m.get<0>()))
@@ -15628,6 +19841,16 @@ int Traits<Domain::Xml::Smartcard>::generate(const Domain::Xml::Smartcard& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Smartcard>::generate(const Domain::Xml::Smartcard& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Smartcard>::generate(const Domain::Xml::Smartcard& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hub
 
@@ -15661,6 +19884,13 @@ bool Hub::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Hub::save(QXmlStreamWriter& dst_) const
+{
+	Element<Hub, Name::Strict<911> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -15678,7 +19908,8 @@ int Traits<Domain::Xml::Hub>::parse(Domain::Xml::Hub& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Hub>::generate(const Domain::Xml::Hub& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Hub>::produce(const Domain::Xml::Hub& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAlias(), m.get<1>().get<0>()))
@@ -15691,6 +19922,16 @@ int Traits<Domain::Xml::Hub>::generate(const Domain::Xml::Hub& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Hub>::generate(const Domain::Xml::Hub& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Hub>::generate(const Domain::Xml::Hub& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Redirdev
 
@@ -15728,6 +19969,13 @@ bool Redirdev::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Redirdev::save(QXmlStreamWriter& dst_) const
+{
+	Element<Redirdev, Name::Strict<912> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -15748,7 +19996,8 @@ int Traits<Domain::Xml::Redirdev>::parse(Domain::Xml::Redirdev& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Redirdev>::generate(const Domain::Xml::Redirdev& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Redirdev>::produce(const Domain::Xml::Redirdev& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<1>()))
@@ -15767,6 +20016,16 @@ int Traits<Domain::Xml::Redirdev>::generate(const Domain::Xml::Redirdev& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Redirdev>::generate(const Domain::Xml::Redirdev& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Redirdev>::generate(const Domain::Xml::Redirdev& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Usbdev
 
@@ -15804,6 +20063,13 @@ bool Usbdev::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Usbdev::save(QXmlStreamWriter& dst_) const
+{
+	Element<Usbdev, Name::Strict<840> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -15823,7 +20089,8 @@ int Traits<Domain::Xml::Usbdev>::parse(Domain::Xml::Usbdev& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Usbdev>::generate(const Domain::Xml::Usbdev& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Usbdev>::produce(const Domain::Xml::Usbdev& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAllow(), m.get<0>()))
@@ -15840,6 +20107,16 @@ int Traits<Domain::Xml::Usbdev>::generate(const Domain::Xml::Usbdev& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Usbdev>::generate(const Domain::Xml::Usbdev& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Usbdev>::generate(const Domain::Xml::Usbdev& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Backend4752
 
@@ -15849,12 +20126,23 @@ int Traits<Domain::Xml::Backend4752>::parse(Domain::Xml::Backend4752& , QStack<Q
 	return m.consume(stack_);
 }
 
-int Traits<Domain::Xml::Backend4752>::generate(const Domain::Xml::Backend4752& , QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Backend4752>::produce(const Domain::Xml::Backend4752& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Backend4752>::generate(const Domain::Xml::Backend4752& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Backend4752>::generate(const Domain::Xml::Backend4752& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Backend4753
 
@@ -15882,7 +20170,8 @@ int Traits<Domain::Xml::Backend4753>::parse(Domain::Xml::Backend4753& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Backend4753>::generate(const Domain::Xml::Backend4753& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Backend4753>::produce(const Domain::Xml::Backend4753& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<1>()))
@@ -15893,6 +20182,16 @@ int Traits<Domain::Xml::Backend4753>::generate(const Domain::Xml::Backend4753& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Backend4753>::generate(const Domain::Xml::Backend4753& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Backend4753>::generate(const Domain::Xml::Backend4753& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Backend4754
 
@@ -15902,12 +20201,23 @@ int Traits<Domain::Xml::Backend4754>::parse(Domain::Xml::Backend4754& , QStack<Q
 	return m.consume(stack_);
 }
 
-int Traits<Domain::Xml::Backend4754>::generate(const Domain::Xml::Backend4754& , QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Backend4754>::produce(const Domain::Xml::Backend4754& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Backend4754>::generate(const Domain::Xml::Backend4754& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Backend4754>::generate(const Domain::Xml::Backend4754& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Rate
 
@@ -15945,6 +20255,13 @@ bool Rate::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Rate::save(QXmlStreamWriter& dst_) const
+{
+	Element<Rate, Name::Strict<1081> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -15961,7 +20278,8 @@ int Traits<Domain::Xml::Rate>::parse(Domain::Xml::Rate& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Domain::Xml::Rate>::generate(const Domain::Xml::Rate& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Rate>::produce(const Domain::Xml::Rate& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBytes(), m.get<0>()))
@@ -15972,6 +20290,16 @@ int Traits<Domain::Xml::Rate>::generate(const Domain::Xml::Rate& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Rate>::generate(const Domain::Xml::Rate& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Rate>::generate(const Domain::Xml::Rate& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Rng
 
@@ -16009,6 +20337,13 @@ bool Rng::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Rng::save(QXmlStreamWriter& dst_) const
+{
+	Element<Rng, Name::Strict<981> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16030,7 +20365,8 @@ int Traits<Domain::Xml::Rng>::parse(Domain::Xml::Rng& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Rng>::generate(const Domain::Xml::Rng& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Rng>::produce(const Domain::Xml::Rng& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -16051,6 +20387,16 @@ int Traits<Domain::Xml::Rng>::generate(const Domain::Xml::Rng& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Rng>::generate(const Domain::Xml::Rng& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Rng>::generate(const Domain::Xml::Rng& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Device1
 
@@ -16084,6 +20430,13 @@ bool Device1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Device1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Device1, Name::Strict<354> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16099,7 +20452,8 @@ int Traits<Domain::Xml::Device1>::parse(Domain::Xml::Device1& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Device1>::generate(const Domain::Xml::Device1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Device1>::produce(const Domain::Xml::Device1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPath(), m.get<0>()))
@@ -16108,6 +20462,16 @@ int Traits<Domain::Xml::Device1>::generate(const Domain::Xml::Device1& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Device1>::generate(const Domain::Xml::Device1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Device1>::generate(const Domain::Xml::Device1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Backend7062
 
@@ -16117,12 +20481,23 @@ int Traits<Domain::Xml::Backend7062>::parse(Domain::Xml::Backend7062& , QStack<Q
 	return m.consume(stack_);
 }
 
-int Traits<Domain::Xml::Backend7062>::generate(const Domain::Xml::Backend7062& , QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Backend7062>::produce(const Domain::Xml::Backend7062& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Backend7062>::generate(const Domain::Xml::Backend7062& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Backend7062>::generate(const Domain::Xml::Backend7062& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Backend1
 
@@ -16156,6 +20531,13 @@ bool Backend1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Backend1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Backend1, Name::Strict<693> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16172,7 +20554,8 @@ int Traits<Domain::Xml::Backend1>::parse(Domain::Xml::Backend1& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Backend1>::generate(const Domain::Xml::Backend1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Backend1>::produce(const Domain::Xml::Backend1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBackend(), m.get<0>()))
@@ -16183,6 +20566,16 @@ int Traits<Domain::Xml::Backend1>::generate(const Domain::Xml::Backend1& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Backend1>::generate(const Domain::Xml::Backend1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Backend1>::generate(const Domain::Xml::Backend1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Tpm
 
@@ -16216,6 +20609,13 @@ bool Tpm::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Tpm::save(QXmlStreamWriter& dst_) const
+{
+	Element<Tpm, Name::Strict<902> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16235,7 +20635,8 @@ int Traits<Domain::Xml::Tpm>::parse(Domain::Xml::Tpm& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Tpm>::generate(const Domain::Xml::Tpm& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Tpm>::produce(const Domain::Xml::Tpm& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -16252,6 +20653,16 @@ int Traits<Domain::Xml::Tpm>::generate(const Domain::Xml::Tpm& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Tpm>::generate(const Domain::Xml::Tpm& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Tpm>::generate(const Domain::Xml::Tpm& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source16
 
@@ -16285,6 +20696,13 @@ bool Source16::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source16::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source16, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16301,7 +20719,8 @@ int Traits<Domain::Xml::Source16>::parse(Domain::Xml::Source16& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Source16>::generate(const Domain::Xml::Source16& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Source16>::produce(const Domain::Xml::Source16& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPagesize(), m.get<0>().get<0>()))
@@ -16312,6 +20731,16 @@ int Traits<Domain::Xml::Source16>::generate(const Domain::Xml::Source16& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Source16>::generate(const Domain::Xml::Source16& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Source16>::generate(const Domain::Xml::Source16& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Target7
 
@@ -16349,6 +20778,13 @@ bool Target7::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Target7::save(QXmlStreamWriter& dst_) const
+{
+	Element<Target7, Name::Strict<323> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16370,7 +20806,8 @@ int Traits<Domain::Xml::Target7>::parse(Domain::Xml::Target7& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Target7>::generate(const Domain::Xml::Target7& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Target7>::produce(const Domain::Xml::Target7& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSize(), m.get<0>()))
@@ -16391,6 +20828,16 @@ int Traits<Domain::Xml::Target7>::generate(const Domain::Xml::Target7& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Target7>::generate(const Domain::Xml::Target7& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Target7>::generate(const Domain::Xml::Target7& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Memory2
 
@@ -16428,6 +20875,13 @@ bool Memory2::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Memory2::save(QXmlStreamWriter& dst_) const
+{
+	Element<Memory2, Name::Strict<326> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16451,7 +20905,8 @@ int Traits<Domain::Xml::Memory2>::parse(Domain::Xml::Memory2& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Memory2>::generate(const Domain::Xml::Memory2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Memory2>::produce(const Domain::Xml::Memory2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -16476,6 +20931,16 @@ int Traits<Domain::Xml::Memory2>::generate(const Domain::Xml::Memory2& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Memory2>::generate(const Domain::Xml::Memory2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Memory2>::generate(const Domain::Xml::Memory2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Watchdog
 
@@ -16506,7 +20971,14 @@ bool Watchdog::save(QDomElement& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
-bool Watchdog::save(QDomDocument& dst_) const
+bool Watchdog::save(QDomDocument& dst_) const
+{
+	Element<Watchdog, Name::Strict<880> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
+bool Watchdog::save(QXmlStreamWriter& dst_) const
 {
 	Element<Watchdog, Name::Strict<880> > m;
 	m.setValue(*this);
@@ -16532,7 +21004,8 @@ int Traits<Domain::Xml::Watchdog>::parse(Domain::Xml::Watchdog& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Watchdog>::generate(const Domain::Xml::Watchdog& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Watchdog>::produce(const Domain::Xml::Watchdog& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -16549,6 +21022,16 @@ int Traits<Domain::Xml::Watchdog>::generate(const Domain::Xml::Watchdog& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Watchdog>::generate(const Domain::Xml::Watchdog& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Watchdog>::generate(const Domain::Xml::Watchdog& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Memballoon
 
@@ -16586,6 +21069,13 @@ bool Memballoon::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Memballoon::save(QXmlStreamWriter& dst_) const
+{
+	Element<Memballoon, Name::Strict<886> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16608,7 +21098,8 @@ int Traits<Domain::Xml::Memballoon>::parse(Domain::Xml::Memballoon& dst_, QStack
 	return output;
 }
 
-int Traits<Domain::Xml::Memballoon>::generate(const Domain::Xml::Memballoon& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Memballoon>::produce(const Domain::Xml::Memballoon& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -16631,6 +21122,16 @@ int Traits<Domain::Xml::Memballoon>::generate(const Domain::Xml::Memballoon& src
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Memballoon>::generate(const Domain::Xml::Memballoon& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Memballoon>::generate(const Domain::Xml::Memballoon& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Nvram1
 
@@ -16664,6 +21165,13 @@ bool Nvram1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Nvram1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Nvram1, Name::Strict<277> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16679,7 +21187,8 @@ int Traits<Domain::Xml::Nvram1>::parse(Domain::Xml::Nvram1& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Nvram1>::generate(const Domain::Xml::Nvram1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Nvram1>::produce(const Domain::Xml::Nvram1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAddress(), m.get<0>()))
@@ -16688,6 +21197,16 @@ int Traits<Domain::Xml::Nvram1>::generate(const Domain::Xml::Nvram1& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Nvram1>::generate(const Domain::Xml::Nvram1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Nvram1>::generate(const Domain::Xml::Nvram1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Panic
 
@@ -16721,6 +21240,13 @@ bool Panic::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Panic::save(QXmlStreamWriter& dst_) const
+{
+	Element<Panic, Name::Strict<987> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16737,7 +21263,8 @@ int Traits<Domain::Xml::Panic>::parse(Domain::Xml::Panic& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Panic>::generate(const Domain::Xml::Panic& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Panic>::produce(const Domain::Xml::Panic& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -16748,6 +21275,16 @@ int Traits<Domain::Xml::Panic>::generate(const Domain::Xml::Panic& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Panic>::generate(const Domain::Xml::Panic& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Panic>::generate(const Domain::Xml::Panic& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Address1
 
@@ -16781,6 +21318,13 @@ bool Address1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Address1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Address1, Name::Strict<111> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16799,7 +21343,8 @@ int Traits<Domain::Xml::Address1>::parse(Domain::Xml::Address1& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Domain::Xml::Address1>::generate(const Domain::Xml::Address1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Address1>::produce(const Domain::Xml::Address1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getHost(), m.get<1>()))
@@ -16814,6 +21359,16 @@ int Traits<Domain::Xml::Address1>::generate(const Domain::Xml::Address1& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Address1>::generate(const Domain::Xml::Address1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Address1>::generate(const Domain::Xml::Address1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Disk1
 
@@ -16847,6 +21402,13 @@ bool Disk1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Disk1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Disk1, Name::Strict<472> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16866,7 +21428,8 @@ int Traits<Domain::Xml::Disk1>::parse(Domain::Xml::Disk1& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Disk1>::generate(const Domain::Xml::Disk1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Disk1>::produce(const Domain::Xml::Disk1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -16883,6 +21446,16 @@ int Traits<Domain::Xml::Disk1>::generate(const Domain::Xml::Disk1& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Disk1>::generate(const Domain::Xml::Disk1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Disk1>::generate(const Domain::Xml::Disk1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Domainblockexport_
 
@@ -16916,6 +21489,13 @@ bool Domainblockexport_::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Domainblockexport_::save(QXmlStreamWriter& dst_) const
+{
+	Element<Domainblockexport_, Name::Strict<988> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16932,7 +21512,8 @@ int Traits<Domain::Xml::Domainblockexport_>::parse(Domain::Xml::Domainblockexpor
 	return output;
 }
 
-int Traits<Domain::Xml::Domainblockexport_>::generate(const Domain::Xml::Domainblockexport_& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Domainblockexport_>::produce(const Domain::Xml::Domainblockexport_& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAddress(), m.get<1>().get<0>()))
@@ -16943,6 +21524,16 @@ int Traits<Domain::Xml::Domainblockexport_>::generate(const Domain::Xml::Domainb
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Domainblockexport_>::generate(const Domain::Xml::Domainblockexport_& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Domainblockexport_>::generate(const Domain::Xml::Domainblockexport_& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Driver5
 
@@ -16976,6 +21567,13 @@ bool Driver5::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Driver5::save(QXmlStreamWriter& dst_) const
+{
+	Element<Driver5, Name::Strict<546> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -16995,7 +21593,8 @@ int Traits<Domain::Xml::Driver5>::parse(Domain::Xml::Driver5& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Driver5>::generate(const Domain::Xml::Driver5& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Driver5>::produce(const Domain::Xml::Driver5& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIntremap(), m.get<0>()))
@@ -17012,6 +21611,16 @@ int Traits<Domain::Xml::Driver5>::generate(const Domain::Xml::Driver5& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Driver5>::generate(const Domain::Xml::Driver5& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Driver5>::generate(const Domain::Xml::Driver5& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Cid
 
@@ -17045,6 +21654,13 @@ bool Cid::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Cid::save(QXmlStreamWriter& dst_) const
+{
+	Element<Cid, Name::Strict<5043> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -17061,7 +21677,8 @@ int Traits<Domain::Xml::Cid>::parse(Domain::Xml::Cid& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Cid>::generate(const Domain::Xml::Cid& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Cid>::produce(const Domain::Xml::Cid& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAuto(), m.get<0>()))
@@ -17072,6 +21689,16 @@ int Traits<Domain::Xml::Cid>::generate(const Domain::Xml::Cid& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Cid>::generate(const Domain::Xml::Cid& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Cid>::generate(const Domain::Xml::Cid& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Vsock
 
@@ -17105,6 +21732,13 @@ bool Vsock::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Vsock::save(QXmlStreamWriter& dst_) const
+{
+	Element<Vsock, Name::Strict<5042> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -17124,7 +21758,8 @@ int Traits<Domain::Xml::Vsock>::parse(Domain::Xml::Vsock& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Domain::Xml::Vsock>::generate(const Domain::Xml::Vsock& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Vsock>::produce(const Domain::Xml::Vsock& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCid(), m.get<1>().get<0>()))
@@ -17141,6 +21776,16 @@ int Traits<Domain::Xml::Vsock>::generate(const Domain::Xml::Vsock& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Vsock>::generate(const Domain::Xml::Vsock& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Vsock>::generate(const Domain::Xml::Vsock& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Devices
 
@@ -17174,6 +21819,13 @@ bool Devices::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Devices::save(QXmlStreamWriter& dst_) const
+{
+	Element<Devices, Name::Strict<228> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -17197,7 +21849,8 @@ int Traits<Domain::Xml::Devices>::parse(Domain::Xml::Devices& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Domain::Xml::Devices>::generate(const Domain::Xml::Devices& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Devices>::produce(const Domain::Xml::Devices& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getEmulator(), m.get<0>()))
@@ -17222,6 +21875,16 @@ int Traits<Domain::Xml::Devices>::generate(const Domain::Xml::Devices& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Devices>::generate(const Domain::Xml::Devices& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Devices>::generate(const Domain::Xml::Devices& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Seclabel6970
 
@@ -17238,7 +21901,8 @@ int Traits<Domain::Xml::Seclabel6970>::parse(Domain::Xml::Seclabel6970& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::Seclabel6970>::generate(const Domain::Xml::Seclabel6970& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Seclabel6970>::produce(const Domain::Xml::Seclabel6970& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getLabel(), m.get<2>().get<0>()))
@@ -17251,6 +21915,16 @@ int Traits<Domain::Xml::Seclabel6970>::generate(const Domain::Xml::Seclabel6970&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Seclabel6970>::generate(const Domain::Xml::Seclabel6970& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Seclabel6970>::generate(const Domain::Xml::Seclabel6970& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Seclabel6971
 
@@ -17267,7 +21941,8 @@ int Traits<Domain::Xml::Seclabel6971>::parse(Domain::Xml::Seclabel6971& dst_, QS
 	return output;
 }
 
-int Traits<Domain::Xml::Seclabel6971>::generate(const Domain::Xml::Seclabel6971& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Seclabel6971>::produce(const Domain::Xml::Seclabel6971& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getRelabel(), m.get<1>()))
@@ -17280,6 +21955,16 @@ int Traits<Domain::Xml::Seclabel6971>::generate(const Domain::Xml::Seclabel6971&
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Seclabel6971>::generate(const Domain::Xml::Seclabel6971& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Seclabel6971>::generate(const Domain::Xml::Seclabel6971& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Seclabel6972
 
@@ -17289,12 +21974,23 @@ int Traits<Domain::Xml::Seclabel6972>::parse(Domain::Xml::Seclabel6972& , QStack
 	return m.consume(stack_);
 }
 
-int Traits<Domain::Xml::Seclabel6972>::generate(const Domain::Xml::Seclabel6972& , QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Seclabel6972>::produce(const Domain::Xml::Seclabel6972& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Seclabel6972>::generate(const Domain::Xml::Seclabel6972& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Seclabel6972>::generate(const Domain::Xml::Seclabel6972& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Seclabel1
 
@@ -17328,6 +22024,13 @@ bool Seclabel1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Seclabel1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Seclabel1, Name::Strict<229> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -17344,7 +22047,8 @@ int Traits<Domain::Xml::Seclabel1>::parse(Domain::Xml::Seclabel1& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Domain::Xml::Seclabel1>::generate(const Domain::Xml::Seclabel1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Seclabel1>::produce(const Domain::Xml::Seclabel1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -17355,6 +22059,16 @@ int Traits<Domain::Xml::Seclabel1>::generate(const Domain::Xml::Seclabel1& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Seclabel1>::generate(const Domain::Xml::Seclabel1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Seclabel1>::generate(const Domain::Xml::Seclabel1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Env
 
@@ -17388,6 +22102,13 @@ bool Env::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Env::save(QXmlStreamWriter& dst_) const
+{
+	Element<Env, Name::Strict<1161> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -17404,7 +22125,8 @@ int Traits<Domain::Xml::Env>::parse(Domain::Xml::Env& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Domain::Xml::Env>::generate(const Domain::Xml::Env& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Env>::produce(const Domain::Xml::Env& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -17415,6 +22137,16 @@ int Traits<Domain::Xml::Env>::generate(const Domain::Xml::Env& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Env>::generate(const Domain::Xml::Env& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Env>::generate(const Domain::Xml::Env& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Commandline
 
@@ -17448,6 +22180,13 @@ bool Commandline::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Commandline::save(QXmlStreamWriter& dst_) const
+{
+	Element<Commandline, Name::Scoped<1159, 1162> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -17464,7 +22203,8 @@ int Traits<Domain::Xml::Commandline>::parse(Domain::Xml::Commandline& dst_, QSta
 	return output;
 }
 
-int Traits<Domain::Xml::Commandline>::generate(const Domain::Xml::Commandline& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Commandline>::produce(const Domain::Xml::Commandline& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getArgList(), m.get<0>()))
@@ -17475,6 +22215,16 @@ int Traits<Domain::Xml::Commandline>::generate(const Domain::Xml::Commandline& s
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Commandline>::generate(const Domain::Xml::Commandline& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Commandline>::generate(const Domain::Xml::Commandline& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Cipher
 
@@ -17512,6 +22262,13 @@ bool Cipher::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Cipher::save(QXmlStreamWriter& dst_) const
+{
+	Element<Cipher, Name::Strict<5049> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -17528,7 +22285,8 @@ int Traits<Domain::Xml::Cipher>::parse(Domain::Xml::Cipher& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Cipher>::generate(const Domain::Xml::Cipher& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Cipher>::produce(const Domain::Xml::Cipher& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -17539,6 +22297,16 @@ int Traits<Domain::Xml::Cipher>::generate(const Domain::Xml::Cipher& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Cipher>::generate(const Domain::Xml::Cipher& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Cipher>::generate(const Domain::Xml::Cipher& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct LaunchSecurity
 
@@ -17572,6 +22340,13 @@ bool LaunchSecurity::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool LaunchSecurity::save(QXmlStreamWriter& dst_) const
+{
+	Element<LaunchSecurity, Name::Strict<5047> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -17592,7 +22367,8 @@ int Traits<Domain::Xml::LaunchSecurity>::parse(Domain::Xml::LaunchSecurity& dst_
 	return output;
 }
 
-int Traits<Domain::Xml::LaunchSecurity>::generate(const Domain::Xml::LaunchSecurity& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::LaunchSecurity>::produce(const Domain::Xml::LaunchSecurity& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCbitpos(), m.get<1>().get<0>()))
@@ -17611,6 +22387,16 @@ int Traits<Domain::Xml::LaunchSecurity>::generate(const Domain::Xml::LaunchSecur
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::LaunchSecurity>::generate(const Domain::Xml::LaunchSecurity& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::LaunchSecurity>::generate(const Domain::Xml::LaunchSecurity& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Domain
 
@@ -17648,6 +22434,13 @@ bool Domain::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Domain::save(QXmlStreamWriter& dst_) const
+{
+	Element<Domain, Name::Strict<1> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Domain
@@ -17699,7 +22492,8 @@ int Traits<Domain::Xml::Domain>::parse(Domain::Xml::Domain& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Domain::Xml::Domain>::generate(const Domain::Xml::Domain& src_, QDomElement& dst_)
+template<class D>
+int Traits<Domain::Xml::Domain>::produce(const Domain::Xml::Domain& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -17780,4 +22574,14 @@ int Traits<Domain::Xml::Domain>::generate(const Domain::Xml::Domain& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Domain::Xml::Domain>::generate(const Domain::Xml::Domain& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Domain::Xml::Domain>::generate(const Domain::Xml::Domain& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 } // namespace Libvirt
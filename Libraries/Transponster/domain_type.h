@@ -140,6 +140,7 @@ struct Model
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EFallback > m_fallback;
@@ -196,6 +197,7 @@ struct Topology
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PPositiveInteger::value_type m_sockets;
@@ -237,6 +239,7 @@ struct Feature
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EPolicy m_policy;
@@ -276,6 +279,7 @@ struct Sibling
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_id;
@@ -315,6 +319,7 @@ struct Size
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_value;
@@ -354,6 +359,7 @@ struct Line
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_value;
@@ -417,6 +423,7 @@ struct Cache
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_level;
@@ -507,6 +514,7 @@ struct Cell
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PUnsignedInt::value_type > m_id;
@@ -576,6 +584,7 @@ struct Latency
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_initiator;
@@ -650,6 +659,7 @@ struct Bandwidth
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_initiator;
@@ -691,6 +701,7 @@ struct Interconnects
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QList<Latency > m_latencyList;
@@ -728,6 +739,7 @@ struct Numa
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QList<Cell > m_cellList;
@@ -767,6 +779,7 @@ struct Cache1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<ELevel > m_level;
@@ -868,6 +881,7 @@ struct Cpu
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EMode > m_mode;
@@ -915,6 +929,7 @@ struct Entry
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	ESysinfoBiosName m_name;
@@ -954,6 +969,7 @@ struct Entry1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	ESysinfoSystemName m_name;
@@ -993,6 +1009,7 @@ struct Entry2
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	ESysinfoBaseBoardName m_name;
@@ -1032,6 +1049,7 @@ struct Entry3
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	ESysinfoChassisName m_name;
@@ -1093,6 +1111,7 @@ struct Sysinfo
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<QList<Entry > > m_bios;
@@ -1179,6 +1198,7 @@ struct Type
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EArch > m_arch;
@@ -1280,6 +1300,7 @@ struct Os
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	Type m_type;
@@ -1351,6 +1372,7 @@ struct Os1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	Type m_type;
@@ -1628,6 +1650,7 @@ struct Loader
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EReadonly > m_readonly;
@@ -1708,6 +1731,7 @@ struct Seclabel
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<QString > m_model;
@@ -1753,6 +1777,7 @@ struct Source
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PAbsFilePath::value_type > m_dev;
@@ -1850,6 +1875,7 @@ struct Keycipher
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QString m_name;
@@ -1888,6 +1914,7 @@ struct Keyivgen
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QString m_name;
@@ -1971,6 +1998,7 @@ struct Encryption
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EFormat m_format;
@@ -2017,6 +2045,7 @@ struct Source1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PAbsFilePath::value_type m_dir;
@@ -2121,6 +2150,7 @@ struct Source2
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EProtocol m_protocol;
@@ -2191,6 +2221,7 @@ struct Source3
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PGenericName::value_type m_pool;
@@ -2240,6 +2271,7 @@ struct Source4
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PAbsFilePath::value_type > m_file;
@@ -2299,6 +2331,7 @@ struct Nvram
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PAbsFilePath::value_type > m_template;
@@ -2339,6 +2372,7 @@ struct Bootmenu
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_enable;
@@ -2376,6 +2410,7 @@ struct Bios
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_useserial;
@@ -2469,6 +2504,7 @@ struct Os2
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<VChoice5114 > m_type;
@@ -2513,6 +2549,7 @@ struct Initenv
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PName::value_type m_name;
@@ -2590,6 +2627,7 @@ struct Os3
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EArch5 > m_type;
@@ -2736,6 +2774,7 @@ struct Catchup
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PUnsignedInt::value_type > m_threshold;
@@ -2924,6 +2963,7 @@ struct Timer
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VTimer m_timer;
@@ -2961,6 +3001,7 @@ struct Clock
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VClock m_clock;
@@ -3000,6 +3041,7 @@ struct ScaledInteger
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PUnit::value_type > m_unit;
@@ -3037,6 +3079,7 @@ struct Memory
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	ScaledInteger m_scaledInteger;
@@ -3076,6 +3119,7 @@ struct MaxMemory
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	ScaledInteger m_scaledInteger;
@@ -3123,6 +3167,7 @@ struct Page
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedLong::value_type m_size;
@@ -3203,6 +3248,7 @@ struct MemoryBacking
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<QList<Page > > m_hugepages;
@@ -3263,6 +3309,7 @@ struct Vcpu
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EPlacement > m_placement;
@@ -3320,6 +3367,7 @@ struct Vcpu1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_id;
@@ -3391,6 +3439,7 @@ struct Device
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PAbsFilePath::value_type m_path;
@@ -3432,6 +3481,7 @@ struct Blkiotune
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PWeight::value_type > m_weight;
@@ -3498,6 +3548,7 @@ struct Memtune
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<ScaledInteger > m_hardLimit;
@@ -3539,6 +3590,7 @@ struct Vcpupin
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PVcpuid::value_type m_vcpu;
@@ -3578,6 +3630,7 @@ struct Iothreadpin
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_iothread;
@@ -3664,6 +3717,7 @@ struct Vcpusched
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PCpuset::value_type > m_vcpus;
@@ -3701,6 +3755,7 @@ struct Iothreadsched
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PCpuset::value_type > m_iothreads;
@@ -3764,6 +3819,7 @@ struct Cache2
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_id;
@@ -3806,6 +3862,7 @@ struct Monitor
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_level;
@@ -3864,6 +3921,7 @@ struct Cachetune
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PCpuset::value_type m_vcpus;
@@ -3904,6 +3962,7 @@ struct Node
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_id;
@@ -3954,6 +4013,7 @@ struct Memorytune
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PCpuset::value_type m_vcpus;
@@ -4111,6 +4171,7 @@ struct Cputune
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PCpushares::value_type > m_shares;
@@ -4190,6 +4251,7 @@ struct Memory1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EMode7 > m_mode;
@@ -4237,6 +4299,7 @@ struct Memnode
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_cellid;
@@ -4275,6 +4338,7 @@ struct Numatune
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<Memory1 > m_memory;
@@ -4312,6 +4376,7 @@ struct Resource
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PAbsFilePath::value_type > m_partition;
@@ -4341,6 +4406,7 @@ struct Apic
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_eoi;
@@ -4369,6 +4435,7 @@ struct Hap
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_state;
@@ -4407,6 +4474,7 @@ struct Spinlocks
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirOnOff m_state;
@@ -4444,6 +4512,7 @@ struct Stimer
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_state;
@@ -4483,6 +4552,7 @@ struct VendorId
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirOnOff m_state;
@@ -4616,6 +4686,7 @@ struct Hyperv
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_relaxed;
@@ -4657,6 +4728,7 @@ struct Kvm
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_hidden;
@@ -4685,6 +4757,7 @@ struct Pvspinlock
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_state;
@@ -5011,6 +5084,7 @@ struct Capabilities
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EPolicy2 m_policy;
@@ -5076,6 +5150,7 @@ struct Pmu
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_state;
@@ -5104,6 +5179,7 @@ struct Vmport
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_state;
@@ -5132,6 +5208,7 @@ struct Gic
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PPositiveInteger::value_type > m_version;
@@ -5198,6 +5275,7 @@ struct Smm
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<Anonymous2357 > m_anonymous2357;
@@ -5234,6 +5312,7 @@ struct Hpt
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EResizing > m_resizing;
@@ -5263,6 +5342,7 @@ struct Vmcoreinfo
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_state;
@@ -5291,6 +5371,7 @@ struct Tcg
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<ScaledInteger > m_tbCache;
@@ -5513,6 +5594,7 @@ struct Features
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	bool m_pae;
@@ -5581,6 +5663,7 @@ struct VzDns
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PDnsName::value_type > m_hostname;
@@ -5621,6 +5704,7 @@ struct Class
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_id;
@@ -5660,6 +5744,7 @@ struct VzNetworkRates
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	bool m_rateBound;
@@ -5689,6 +5774,7 @@ struct SuspendToMem
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_enabled;
@@ -5717,6 +5803,7 @@ struct SuspendToDisk
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_enabled;
@@ -5753,6 +5840,7 @@ struct Pm
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<SuspendToMem > m_suspendToMem;
@@ -5792,6 +5880,7 @@ struct Event
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EName3 m_name;
@@ -5839,6 +5928,7 @@ struct Uid
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_start;
@@ -5887,6 +5977,7 @@ struct Gid
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_start;
@@ -5925,6 +6016,7 @@ struct Idmap
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QList<Uid > m_uidList;
@@ -6072,6 +6164,7 @@ struct VirtioOptions
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_iommu;
@@ -6103,6 +6196,7 @@ struct MetadataCache
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<ScaledInteger > m_maxSize;
@@ -6243,6 +6337,7 @@ struct Driver
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<DriverFormat > m_driverFormat;
@@ -6285,6 +6380,7 @@ struct MetadataCache1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<ScaledInteger > m_maxSize;
@@ -6321,6 +6417,7 @@ struct Format
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VStorageFormat m_type;
@@ -6504,6 +6601,7 @@ struct Mirror
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VMirror m_mirror;
@@ -6556,6 +6654,7 @@ struct Secret
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EType8 m_type;
@@ -6593,6 +6692,7 @@ struct Auth
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PGenericName::value_type m_username;
@@ -6646,6 +6746,7 @@ struct Target
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PDiskTarget::value_type m_dev;
@@ -6687,6 +6788,7 @@ struct Boot
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PPositiveInteger::value_type m_order;
@@ -6716,6 +6818,7 @@ struct Transient
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_shareBacking;
@@ -6862,6 +6965,7 @@ struct Iotune
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VChoice4771 m_choice4771;
@@ -6925,6 +7029,7 @@ struct Pciaddress
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PPciDomain::value_type > m_domain;
@@ -7284,6 +7389,7 @@ struct Geometry
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PCyls::value_type m_cyls;
@@ -7323,6 +7429,7 @@ struct Blockio
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PLogicalBlockSize::value_type > m_logicalBlockSize;
@@ -7370,6 +7477,7 @@ struct BackingStore
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PPositiveInteger::value_type > m_index;
@@ -7604,6 +7712,7 @@ struct Disk
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VDisk m_disk;
@@ -7655,6 +7764,7 @@ struct Acpi
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PUnsignedInt::value_type > m_index;
@@ -7788,6 +7898,7 @@ struct Target1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<VUint8 > m_chassisNr;
@@ -8044,6 +8155,7 @@ struct Driver1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PUnsignedInt::value_type > m_queues;
@@ -8117,6 +8229,7 @@ struct Controller
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PUnsignedInt::value_type > m_index;
@@ -8158,6 +8271,7 @@ struct Target2
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QString m_path;
@@ -8203,6 +8317,7 @@ struct Lease
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QString m_lockspace;
@@ -8241,6 +8356,7 @@ struct Driver2
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EType10 > m_type;
@@ -8450,6 +8566,7 @@ struct Source5
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedLong::value_type m_usage;
@@ -8632,6 +8749,7 @@ struct Filesystem
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VFilesystem m_filesystem;
@@ -8762,6 +8880,7 @@ struct Source6
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	InterfaceBridgeAttributes m_interfaceBridgeAttributes;
@@ -8815,6 +8934,7 @@ struct Parameters
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<VUint8 > m_managerid;
@@ -8846,6 +8966,7 @@ struct Parameters1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PVirtualPortProfileID::value_type > m_profileid;
@@ -8882,6 +9003,7 @@ struct Parameters2
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PVirtualPortProfileID::value_type > m_profileid;
@@ -8951,6 +9073,7 @@ struct Parameters3
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<VUint8 > m_managerid;
@@ -8984,6 +9107,7 @@ struct Virtualport
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<Parameters3 > m_parameters;
@@ -9025,6 +9149,7 @@ struct Frames
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PUnsignedInt::value_type > m_max;
@@ -9053,6 +9178,7 @@ struct Rx
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<Frames > m_frames;
@@ -9081,6 +9207,7 @@ struct Coalesce
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<Rx > m_rx;
@@ -9109,6 +9236,7 @@ struct VzDhcp
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PAddrFamily::value_type > m_family;
@@ -9145,6 +9273,7 @@ struct VzDns1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QList<VIpAddr > m_serverList;
@@ -9182,6 +9311,7 @@ struct Target3
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PDeviceName::value_type m_dev;
@@ -9219,6 +9349,7 @@ struct Guest
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PDeviceName::value_type > m_dev;
@@ -9264,6 +9395,7 @@ struct Ip
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VIpAddr m_address;
@@ -9339,6 +9471,7 @@ struct Route
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PAddrFamily::value_type > m_family;
@@ -9379,6 +9512,7 @@ struct Backend
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PAbsFilePath::value_type > m_tap;
@@ -9548,6 +9682,7 @@ struct Host
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_csum;
@@ -9614,6 +9749,7 @@ struct Guest1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_csum;
@@ -9662,6 +9798,7 @@ struct Driver3
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VDriver m_driver;
@@ -9700,6 +9837,7 @@ struct Parameter
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PFilterParamName::value_type m_name;
@@ -9737,6 +9875,7 @@ struct FilterrefNodeAttributes
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PFilter::value_type m_filter;
@@ -9766,6 +9905,7 @@ struct Tune
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PUnsignedInt::value_type > m_sndbuf;
@@ -9810,6 +9950,7 @@ struct Rom
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_enabled;
@@ -9864,6 +10005,7 @@ struct BandwidthAttributes
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PSpeed::value_type > m_average;
@@ -9911,6 +10053,7 @@ struct Bandwidth1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PPositiveInteger::value_type > m_classID;
@@ -9951,6 +10094,7 @@ struct Tag
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PId::value_type m_id;
@@ -9980,6 +10124,7 @@ struct Port
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_isolated;
@@ -10598,6 +10743,7 @@ struct Source7
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EType11 m_type;
@@ -10904,6 +11050,7 @@ struct Source8
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	InterfaceNetworkAttributes m_interfaceNetworkAttributes;
@@ -11226,6 +11373,7 @@ struct Source9
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PDeviceName::value_type m_dev;
@@ -12072,6 +12220,7 @@ struct Source10
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PIpv4Addr::value_type m_address;
@@ -12156,6 +12305,7 @@ struct Source11
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PIpv4Addr::value_type > m_address;
@@ -12263,6 +12413,7 @@ struct Address
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUsbAddr::value_type m_bus;
@@ -12394,6 +12545,7 @@ struct Source12
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_missing;
@@ -12730,6 +12882,7 @@ struct Interface
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VInterface m_interface;
@@ -12831,6 +12984,7 @@ struct Input
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EType13 m_type;
@@ -12903,6 +13057,7 @@ struct Sound
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EModel8 m_model;
@@ -12944,6 +13099,7 @@ struct Source13
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EStartupPolicy > m_startupPolicy;
@@ -13071,6 +13227,7 @@ struct Source14
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EStartupPolicy > m_startupPolicy;
@@ -13142,6 +13299,7 @@ struct Parentaddr
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PPositiveInteger::value_type > m_uniqueId;
@@ -13292,6 +13450,7 @@ struct Scsiaddress
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PDriveBus::value_type m_bus;
@@ -13373,6 +13532,7 @@ struct Host1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QString m_name;
@@ -13594,6 +13754,7 @@ struct Ip1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VIpAddr m_address;
@@ -13781,6 +13942,7 @@ struct Hostdev
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VChoice7065 m_choice7065;
@@ -14092,6 +14254,7 @@ struct Channel
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EName8 m_name;
@@ -14131,6 +14294,7 @@ struct Gl
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_enable;
@@ -14460,6 +14624,7 @@ struct Gl1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PAbsFilePath::value_type > m_rendernode;
@@ -14517,6 +14682,7 @@ struct Driver4
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<VirtioOptions > m_virtioOptions;
@@ -14619,6 +14785,7 @@ struct Acceleration
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_accel3d;
@@ -14659,6 +14826,7 @@ struct Resolution
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_x;
@@ -14728,6 +14896,7 @@ struct Model1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VModel m_model;
@@ -14793,6 +14962,7 @@ struct Video
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<Driver4 > m_driver;
@@ -14897,6 +15067,7 @@ struct Source15
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<QString > m_mode;
@@ -14934,6 +15105,7 @@ struct Protocol
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EType16 > m_type;
@@ -14970,6 +15142,7 @@ struct Log
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PAbsFilePath::value_type m_file;
@@ -15073,6 +15246,7 @@ struct Target4
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VChoice8004 m_choice8004;
@@ -15145,6 +15319,7 @@ struct Qemucdev
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EQemucdevSrcTypeChoice m_type;
@@ -15199,6 +15374,7 @@ struct Target5
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QString m_address;
@@ -15236,6 +15412,7 @@ struct Target6
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<QString > m_name;
@@ -15320,6 +15497,7 @@ struct Channel1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EQemucdevSrcTypeChoice m_type;
@@ -15501,6 +15679,7 @@ struct Smartcard
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VSmartcard m_smartcard;
@@ -15548,6 +15727,7 @@ struct Hub
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PAliasName::value_type > m_alias;
@@ -15620,6 +15800,7 @@ struct Redirdev
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EQemucdevSrcTypeChoice m_type;
@@ -15687,6 +15868,7 @@ struct Usbdev
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EVirYesNo m_allow;
@@ -15806,6 +15988,7 @@ struct Rate
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PPositiveInteger::value_type m_bytes;
@@ -15885,6 +16068,7 @@ struct Rng
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EModel9 m_model;
@@ -15919,6 +16103,7 @@ struct Device1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PFilePath::value_type > m_path;
@@ -15982,6 +16167,7 @@ struct Backend1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VBackend1 m_backend;
@@ -16043,6 +16229,7 @@ struct Tpm
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EModel10 > m_model;
@@ -16083,6 +16270,7 @@ struct Source16
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<ScaledInteger > m_pagesize;
@@ -16162,6 +16350,7 @@ struct Target7
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	ScaledInteger m_size;
@@ -16262,6 +16451,7 @@ struct Memory2
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EModel11 m_model;
@@ -16345,6 +16535,7 @@ struct Watchdog
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EModel12 m_model;
@@ -16435,6 +16626,7 @@ struct Memballoon
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EModel13 m_model;
@@ -16470,6 +16662,7 @@ struct Nvram1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<VAddress > m_address;
@@ -16506,6 +16699,7 @@ struct Panic
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EModel14 > m_model;
@@ -16559,6 +16753,7 @@ struct Address1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PAddrIPorName::value_type m_host;
@@ -16635,6 +16830,7 @@ struct Disk1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VName1 m_name;
@@ -16675,6 +16871,7 @@ struct Domainblockexport_
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	Address1 m_address;
@@ -16736,6 +16933,7 @@ struct Driver5
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_intremap;
@@ -16776,6 +16974,7 @@ struct Cid
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_auto;
@@ -16837,6 +17036,7 @@ struct Vsock
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<Cid > m_cid;
@@ -16933,6 +17133,7 @@ struct Devices
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PAbsFilePath::value_type > m_emulator;
@@ -17090,6 +17291,7 @@ struct Seclabel1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<QString > m_model;
@@ -17127,6 +17329,7 @@ struct Env
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PFilterParamName::value_type m_name;
@@ -17164,6 +17367,7 @@ struct Commandline
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QList<QString > m_argList;
@@ -17203,6 +17407,7 @@ struct Cipher
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EName11 m_name;
@@ -17272,6 +17477,7 @@ struct LaunchSecurity
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PCbitpos::value_type > m_cbitpos;
@@ -17595,6 +17801,7 @@ struct Domain
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EType m_type;
@@ -17649,6 +17856,10 @@ struct Traits<Domain::Xml::Ids>
 
 	static int parse(Domain::Xml::Ids& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Ids& , QDomElement& );
+	static int generate(const Domain::Xml::Ids& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Ids& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17661,6 +17872,10 @@ struct Traits<Domain::Xml::Model>
 
 	static int parse(Domain::Xml::Model& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Model& , QDomElement& );
+	static int generate(const Domain::Xml::Model& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Model& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17673,6 +17888,10 @@ struct Traits<Domain::Xml::Topology>
 
 	static int parse(Domain::Xml::Topology& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Topology& , QDomElement& );
+	static int generate(const Domain::Xml::Topology& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Topology& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17685,6 +17904,10 @@ struct Traits<Domain::Xml::Feature>
 
 	static int parse(Domain::Xml::Feature& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Feature& , QDomElement& );
+	static int generate(const Domain::Xml::Feature& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Feature& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17697,6 +17920,10 @@ struct Traits<Domain::Xml::Sibling>
 
 	static int parse(Domain::Xml::Sibling& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Sibling& , QDomElement& );
+	static int generate(const Domain::Xml::Sibling& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Sibling& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17709,6 +17936,10 @@ struct Traits<Domain::Xml::Size>
 
 	static int parse(Domain::Xml::Size& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Size& , QDomElement& );
+	static int generate(const Domain::Xml::Size& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Size& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17721,6 +17952,10 @@ struct Traits<Domain::Xml::Line>
 
 	static int parse(Domain::Xml::Line& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Line& , QDomElement& );
+	static int generate(const Domain::Xml::Line& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Line& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17733,6 +17968,10 @@ struct Traits<Domain::Xml::Cache>
 
 	static int parse(Domain::Xml::Cache& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Cache& , QDomElement& );
+	static int generate(const Domain::Xml::Cache& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Cache& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17745,6 +17984,10 @@ struct Traits<Domain::Xml::Cell>
 
 	static int parse(Domain::Xml::Cell& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Cell& , QDomElement& );
+	static int generate(const Domain::Xml::Cell& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Cell& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17757,6 +18000,10 @@ struct Traits<Domain::Xml::Latency>
 
 	static int parse(Domain::Xml::Latency& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Latency& , QDomElement& );
+	static int generate(const Domain::Xml::Latency& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Latency& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17769,6 +18016,10 @@ struct Traits<Domain::Xml::Bandwidth>
 
 	static int parse(Domain::Xml::Bandwidth& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Bandwidth& , QDomElement& );
+	static int generate(const Domain::Xml::Bandwidth& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Bandwidth& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17781,6 +18032,10 @@ struct Traits<Domain::Xml::Interconnects>
 
 	static int parse(Domain::Xml::Interconnects& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Interconnects& , QDomElement& );
+	static int generate(const Domain::Xml::Interconnects& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Interconnects& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17793,6 +18048,10 @@ struct Traits<Domain::Xml::Numa>
 
 	static int parse(Domain::Xml::Numa& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Numa& , QDomElement& );
+	static int generate(const Domain::Xml::Numa& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Numa& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17805,6 +18064,10 @@ struct Traits<Domain::Xml::Cache1>
 
 	static int parse(Domain::Xml::Cache1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Cache1& , QDomElement& );
+	static int generate(const Domain::Xml::Cache1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Cache1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17817,6 +18080,10 @@ struct Traits<Domain::Xml::Cpu>
 
 	static int parse(Domain::Xml::Cpu& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Cpu& , QDomElement& );
+	static int generate(const Domain::Xml::Cpu& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Cpu& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17829,6 +18096,10 @@ struct Traits<Domain::Xml::Entry>
 
 	static int parse(Domain::Xml::Entry& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Entry& , QDomElement& );
+	static int generate(const Domain::Xml::Entry& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Entry& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17841,6 +18112,10 @@ struct Traits<Domain::Xml::Entry1>
 
 	static int parse(Domain::Xml::Entry1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Entry1& , QDomElement& );
+	static int generate(const Domain::Xml::Entry1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Entry1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17853,6 +18128,10 @@ struct Traits<Domain::Xml::Entry2>
 
 	static int parse(Domain::Xml::Entry2& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Entry2& , QDomElement& );
+	static int generate(const Domain::Xml::Entry2& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Entry2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17865,6 +18144,10 @@ struct Traits<Domain::Xml::Entry3>
 
 	static int parse(Domain::Xml::Entry3& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Entry3& , QDomElement& );
+	static int generate(const Domain::Xml::Entry3& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Entry3& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17877,6 +18160,10 @@ struct Traits<Domain::Xml::Sysinfo>
 
 	static int parse(Domain::Xml::Sysinfo& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Sysinfo& , QDomElement& );
+	static int generate(const Domain::Xml::Sysinfo& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Sysinfo& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17889,6 +18176,10 @@ struct Traits<Domain::Xml::Bootloader>
 
 	static int parse(Domain::Xml::Bootloader& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Bootloader& , QDomElement& );
+	static int generate(const Domain::Xml::Bootloader& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Bootloader& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17901,6 +18192,10 @@ struct Traits<Domain::Xml::Type>
 
 	static int parse(Domain::Xml::Type& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Type& , QDomElement& );
+	static int generate(const Domain::Xml::Type& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Type& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17913,6 +18208,10 @@ struct Traits<Domain::Xml::Osbootkernel>
 
 	static int parse(Domain::Xml::Osbootkernel& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Osbootkernel& , QDomElement& );
+	static int generate(const Domain::Xml::Osbootkernel& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Osbootkernel& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17925,6 +18224,10 @@ struct Traits<Domain::Xml::Os>
 
 	static int parse(Domain::Xml::Os& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Os& , QDomElement& );
+	static int generate(const Domain::Xml::Os& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Os& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17937,6 +18240,10 @@ struct Traits<Domain::Xml::Osxen6979>
 
 	static int parse(Domain::Xml::Osxen6979& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Osxen6979& , QDomElement& );
+	static int generate(const Domain::Xml::Osxen6979& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Osxen6979& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17949,6 +18256,10 @@ struct Traits<Domain::Xml::Os1>
 
 	static int parse(Domain::Xml::Os1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Os1& , QDomElement& );
+	static int generate(const Domain::Xml::Os1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Os1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17961,6 +18272,10 @@ struct Traits<Domain::Xml::Osxen6980>
 
 	static int parse(Domain::Xml::Osxen6980& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Osxen6980& , QDomElement& );
+	static int generate(const Domain::Xml::Osxen6980& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Osxen6980& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17973,6 +18288,10 @@ struct Traits<Domain::Xml::Hvmx86>
 
 	static int parse(Domain::Xml::Hvmx86& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hvmx86& , QDomElement& );
+	static int generate(const Domain::Xml::Hvmx86& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hvmx86& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17985,6 +18304,10 @@ struct Traits<Domain::Xml::Hvmmips>
 
 	static int parse(Domain::Xml::Hvmmips& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hvmmips& , QDomElement& );
+	static int generate(const Domain::Xml::Hvmmips& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hvmmips& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17997,6 +18320,10 @@ struct Traits<Domain::Xml::Hvmsparc>
 
 	static int parse(Domain::Xml::Hvmsparc& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hvmsparc& , QDomElement& );
+	static int generate(const Domain::Xml::Hvmsparc& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hvmsparc& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18009,6 +18336,10 @@ struct Traits<Domain::Xml::Hvms390>
 
 	static int parse(Domain::Xml::Hvms390& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hvms390& , QDomElement& );
+	static int generate(const Domain::Xml::Hvms390& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hvms390& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18021,6 +18352,10 @@ struct Traits<Domain::Xml::Hvmarm>
 
 	static int parse(Domain::Xml::Hvmarm& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hvmarm& , QDomElement& );
+	static int generate(const Domain::Xml::Hvmarm& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hvmarm& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18033,6 +18368,10 @@ struct Traits<Domain::Xml::Hvmaarch64>
 
 	static int parse(Domain::Xml::Hvmaarch64& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hvmaarch64& , QDomElement& );
+	static int generate(const Domain::Xml::Hvmaarch64& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hvmaarch64& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18045,6 +18384,10 @@ struct Traits<Domain::Xml::Loader>
 
 	static int parse(Domain::Xml::Loader& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Loader& , QDomElement& );
+	static int generate(const Domain::Xml::Loader& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Loader& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18057,6 +18400,10 @@ struct Traits<Domain::Xml::Seclabel6973>
 
 	static int parse(Domain::Xml::Seclabel6973& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Seclabel6973& , QDomElement& );
+	static int generate(const Domain::Xml::Seclabel6973& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Seclabel6973& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18069,6 +18416,10 @@ struct Traits<Domain::Xml::Seclabel6974>
 
 	static int parse(Domain::Xml::Seclabel6974& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Seclabel6974& , QDomElement& );
+	static int generate(const Domain::Xml::Seclabel6974& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Seclabel6974& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18081,6 +18432,10 @@ struct Traits<Domain::Xml::Seclabel>
 
 	static int parse(Domain::Xml::Seclabel& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Seclabel& , QDomElement& );
+	static int generate(const Domain::Xml::Seclabel& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Seclabel& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18093,6 +18448,10 @@ struct Traits<Domain::Xml::Source>
 
 	static int parse(Domain::Xml::Source& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source& , QDomElement& );
+	static int generate(const Domain::Xml::Source& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18105,6 +18464,10 @@ struct Traits<Domain::Xml::Anonymous7117>
 
 	static int parse(Domain::Xml::Anonymous7117& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Anonymous7117& , QDomElement& );
+	static int generate(const Domain::Xml::Anonymous7117& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Anonymous7117& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18117,6 +18480,10 @@ struct Traits<Domain::Xml::Keycipher>
 
 	static int parse(Domain::Xml::Keycipher& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Keycipher& , QDomElement& );
+	static int generate(const Domain::Xml::Keycipher& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Keycipher& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18129,6 +18496,10 @@ struct Traits<Domain::Xml::Keyivgen>
 
 	static int parse(Domain::Xml::Keyivgen& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Keyivgen& , QDomElement& );
+	static int generate(const Domain::Xml::Keyivgen& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Keyivgen& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18141,6 +18512,10 @@ struct Traits<Domain::Xml::Anonymous7118>
 
 	static int parse(Domain::Xml::Anonymous7118& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Anonymous7118& , QDomElement& );
+	static int generate(const Domain::Xml::Anonymous7118& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Anonymous7118& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18153,6 +18528,10 @@ struct Traits<Domain::Xml::Encryption>
 
 	static int parse(Domain::Xml::Encryption& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Encryption& , QDomElement& );
+	static int generate(const Domain::Xml::Encryption& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Encryption& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18165,6 +18544,10 @@ struct Traits<Domain::Xml::Source1>
 
 	static int parse(Domain::Xml::Source1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source1& , QDomElement& );
+	static int generate(const Domain::Xml::Source1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18177,6 +18560,10 @@ struct Traits<Domain::Xml::Host7010>
 
 	static int parse(Domain::Xml::Host7010& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Host7010& , QDomElement& );
+	static int generate(const Domain::Xml::Host7010& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Host7010& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18189,6 +18576,10 @@ struct Traits<Domain::Xml::Source2>
 
 	static int parse(Domain::Xml::Source2& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source2& , QDomElement& );
+	static int generate(const Domain::Xml::Source2& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18201,6 +18592,10 @@ struct Traits<Domain::Xml::Source3>
 
 	static int parse(Domain::Xml::Source3& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source3& , QDomElement& );
+	static int generate(const Domain::Xml::Source3& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source3& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18213,6 +18608,10 @@ struct Traits<Domain::Xml::Source4>
 
 	static int parse(Domain::Xml::Source4& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source4& , QDomElement& );
+	static int generate(const Domain::Xml::Source4& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source4& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18225,6 +18624,10 @@ struct Traits<Domain::Xml::Nvram>
 
 	static int parse(Domain::Xml::Nvram& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Nvram& , QDomElement& );
+	static int generate(const Domain::Xml::Nvram& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Nvram& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18237,6 +18640,10 @@ struct Traits<Domain::Xml::Bootmenu>
 
 	static int parse(Domain::Xml::Bootmenu& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Bootmenu& , QDomElement& );
+	static int generate(const Domain::Xml::Bootmenu& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Bootmenu& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18249,6 +18656,10 @@ struct Traits<Domain::Xml::Bios>
 
 	static int parse(Domain::Xml::Bios& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Bios& , QDomElement& );
+	static int generate(const Domain::Xml::Bios& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Bios& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18261,6 +18672,10 @@ struct Traits<Domain::Xml::Os2>
 
 	static int parse(Domain::Xml::Os2& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Os2& , QDomElement& );
+	static int generate(const Domain::Xml::Os2& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Os2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18273,6 +18688,10 @@ struct Traits<Domain::Xml::Initenv>
 
 	static int parse(Domain::Xml::Initenv& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Initenv& , QDomElement& );
+	static int generate(const Domain::Xml::Initenv& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Initenv& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18285,6 +18704,10 @@ struct Traits<Domain::Xml::Os3>
 
 	static int parse(Domain::Xml::Os3& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Os3& , QDomElement& );
+	static int generate(const Domain::Xml::Os3& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Os3& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18297,6 +18720,10 @@ struct Traits<Domain::Xml::Clock6991>
 
 	static int parse(Domain::Xml::Clock6991& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Clock6991& , QDomElement& );
+	static int generate(const Domain::Xml::Clock6991& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Clock6991& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18309,6 +18736,10 @@ struct Traits<Domain::Xml::Clock6993>
 
 	static int parse(Domain::Xml::Clock6993& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Clock6993& , QDomElement& );
+	static int generate(const Domain::Xml::Clock6993& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Clock6993& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18321,6 +18752,10 @@ struct Traits<Domain::Xml::Catchup>
 
 	static int parse(Domain::Xml::Catchup& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Catchup& , QDomElement& );
+	static int generate(const Domain::Xml::Catchup& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Catchup& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18333,6 +18768,10 @@ struct Traits<Domain::Xml::Timer6994>
 
 	static int parse(Domain::Xml::Timer6994& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Timer6994& , QDomElement& );
+	static int generate(const Domain::Xml::Timer6994& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Timer6994& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18345,6 +18784,10 @@ struct Traits<Domain::Xml::Timer6995>
 
 	static int parse(Domain::Xml::Timer6995& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Timer6995& , QDomElement& );
+	static int generate(const Domain::Xml::Timer6995& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Timer6995& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18357,6 +18800,10 @@ struct Traits<Domain::Xml::Timer6996>
 
 	static int parse(Domain::Xml::Timer6996& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Timer6996& , QDomElement& );
+	static int generate(const Domain::Xml::Timer6996& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Timer6996& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18369,6 +18816,10 @@ struct Traits<Domain::Xml::Timer>
 
 	static int parse(Domain::Xml::Timer& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Timer& , QDomElement& );
+	static int generate(const Domain::Xml::Timer& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Timer& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18381,6 +18832,10 @@ struct Traits<Domain::Xml::Clock>
 
 	static int parse(Domain::Xml::Clock& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Clock& , QDomElement& );
+	static int generate(const Domain::Xml::Clock& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Clock& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18393,6 +18848,10 @@ struct Traits<Domain::Xml::ScaledInteger>
 
 	static int parse(Domain::Xml::ScaledInteger& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::ScaledInteger& , QDomElement& );
+	static int generate(const Domain::Xml::ScaledInteger& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::ScaledInteger& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18405,6 +18864,10 @@ struct Traits<Domain::Xml::Memory>
 
 	static int parse(Domain::Xml::Memory& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Memory& , QDomElement& );
+	static int generate(const Domain::Xml::Memory& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Memory& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18417,6 +18880,10 @@ struct Traits<Domain::Xml::MaxMemory>
 
 	static int parse(Domain::Xml::MaxMemory& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::MaxMemory& , QDomElement& );
+	static int generate(const Domain::Xml::MaxMemory& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::MaxMemory& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18429,6 +18896,10 @@ struct Traits<Domain::Xml::Page>
 
 	static int parse(Domain::Xml::Page& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Page& , QDomElement& );
+	static int generate(const Domain::Xml::Page& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Page& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18441,6 +18912,10 @@ struct Traits<Domain::Xml::MemoryBacking>
 
 	static int parse(Domain::Xml::MemoryBacking& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::MemoryBacking& , QDomElement& );
+	static int generate(const Domain::Xml::MemoryBacking& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::MemoryBacking& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18453,6 +18928,10 @@ struct Traits<Domain::Xml::Vcpu>
 
 	static int parse(Domain::Xml::Vcpu& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Vcpu& , QDomElement& );
+	static int generate(const Domain::Xml::Vcpu& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Vcpu& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18465,6 +18944,10 @@ struct Traits<Domain::Xml::Vcpu1>
 
 	static int parse(Domain::Xml::Vcpu1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Vcpu1& , QDomElement& );
+	static int generate(const Domain::Xml::Vcpu1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Vcpu1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18477,6 +18960,10 @@ struct Traits<Domain::Xml::Device>
 
 	static int parse(Domain::Xml::Device& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Device& , QDomElement& );
+	static int generate(const Domain::Xml::Device& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Device& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18489,6 +18976,10 @@ struct Traits<Domain::Xml::Blkiotune>
 
 	static int parse(Domain::Xml::Blkiotune& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Blkiotune& , QDomElement& );
+	static int generate(const Domain::Xml::Blkiotune& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Blkiotune& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18501,6 +18992,10 @@ struct Traits<Domain::Xml::Memtune>
 
 	static int parse(Domain::Xml::Memtune& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Memtune& , QDomElement& );
+	static int generate(const Domain::Xml::Memtune& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Memtune& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18513,6 +19008,10 @@ struct Traits<Domain::Xml::Vcpupin>
 
 	static int parse(Domain::Xml::Vcpupin& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Vcpupin& , QDomElement& );
+	static int generate(const Domain::Xml::Vcpupin& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Vcpupin& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18525,6 +19024,10 @@ struct Traits<Domain::Xml::Iothreadpin>
 
 	static int parse(Domain::Xml::Iothreadpin& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Iothreadpin& , QDomElement& );
+	static int generate(const Domain::Xml::Iothreadpin& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Iothreadpin& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18537,6 +19040,10 @@ struct Traits<Domain::Xml::Schedparam9370>
 
 	static int parse(Domain::Xml::Schedparam9370& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Schedparam9370& , QDomElement& );
+	static int generate(const Domain::Xml::Schedparam9370& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Schedparam9370& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18549,6 +19056,10 @@ struct Traits<Domain::Xml::Vcpusched>
 
 	static int parse(Domain::Xml::Vcpusched& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Vcpusched& , QDomElement& );
+	static int generate(const Domain::Xml::Vcpusched& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Vcpusched& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18561,6 +19072,10 @@ struct Traits<Domain::Xml::Iothreadsched>
 
 	static int parse(Domain::Xml::Iothreadsched& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Iothreadsched& , QDomElement& );
+	static int generate(const Domain::Xml::Iothreadsched& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Iothreadsched& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18573,6 +19088,10 @@ struct Traits<Domain::Xml::Cache2>
 
 	static int parse(Domain::Xml::Cache2& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Cache2& , QDomElement& );
+	static int generate(const Domain::Xml::Cache2& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Cache2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18585,6 +19104,10 @@ struct Traits<Domain::Xml::Monitor>
 
 	static int parse(Domain::Xml::Monitor& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Monitor& , QDomElement& );
+	static int generate(const Domain::Xml::Monitor& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Monitor& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18597,6 +19120,10 @@ struct Traits<Domain::Xml::Cachetune>
 
 	static int parse(Domain::Xml::Cachetune& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Cachetune& , QDomElement& );
+	static int generate(const Domain::Xml::Cachetune& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Cachetune& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18609,6 +19136,10 @@ struct Traits<Domain::Xml::Node>
 
 	static int parse(Domain::Xml::Node& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Node& , QDomElement& );
+	static int generate(const Domain::Xml::Node& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Node& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18621,6 +19152,10 @@ struct Traits<Domain::Xml::Memorytune>
 
 	static int parse(Domain::Xml::Memorytune& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Memorytune& , QDomElement& );
+	static int generate(const Domain::Xml::Memorytune& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Memorytune& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18633,6 +19168,10 @@ struct Traits<Domain::Xml::Cputune>
 
 	static int parse(Domain::Xml::Cputune& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Cputune& , QDomElement& );
+	static int generate(const Domain::Xml::Cputune& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Cputune& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18645,6 +19184,10 @@ struct Traits<Domain::Xml::Memory2356>
 
 	static int parse(Domain::Xml::Memory2356& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Memory2356& , QDomElement& );
+	static int generate(const Domain::Xml::Memory2356& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Memory2356& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18657,6 +19200,10 @@ struct Traits<Domain::Xml::Memory1>
 
 	static int parse(Domain::Xml::Memory1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Memory1& , QDomElement& );
+	static int generate(const Domain::Xml::Memory1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Memory1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18669,6 +19216,10 @@ struct Traits<Domain::Xml::Memnode>
 
 	static int parse(Domain::Xml::Memnode& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Memnode& , QDomElement& );
+	static int generate(const Domain::Xml::Memnode& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Memnode& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18681,6 +19232,10 @@ struct Traits<Domain::Xml::Numatune>
 
 	static int parse(Domain::Xml::Numatune& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Numatune& , QDomElement& );
+	static int generate(const Domain::Xml::Numatune& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Numatune& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18693,6 +19248,10 @@ struct Traits<Domain::Xml::Resource>
 
 	static int parse(Domain::Xml::Resource& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Resource& , QDomElement& );
+	static int generate(const Domain::Xml::Resource& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Resource& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18705,6 +19264,10 @@ struct Traits<Domain::Xml::Apic>
 
 	static int parse(Domain::Xml::Apic& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Apic& , QDomElement& );
+	static int generate(const Domain::Xml::Apic& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Apic& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18717,6 +19280,10 @@ struct Traits<Domain::Xml::Hap>
 
 	static int parse(Domain::Xml::Hap& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hap& , QDomElement& );
+	static int generate(const Domain::Xml::Hap& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hap& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18729,6 +19296,10 @@ struct Traits<Domain::Xml::Spinlocks>
 
 	static int parse(Domain::Xml::Spinlocks& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Spinlocks& , QDomElement& );
+	static int generate(const Domain::Xml::Spinlocks& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Spinlocks& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18741,6 +19312,10 @@ struct Traits<Domain::Xml::Stimer>
 
 	static int parse(Domain::Xml::Stimer& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Stimer& , QDomElement& );
+	static int generate(const Domain::Xml::Stimer& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Stimer& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18753,6 +19328,10 @@ struct Traits<Domain::Xml::VendorId>
 
 	static int parse(Domain::Xml::VendorId& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::VendorId& , QDomElement& );
+	static int generate(const Domain::Xml::VendorId& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::VendorId& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18765,6 +19344,10 @@ struct Traits<Domain::Xml::Hyperv>
 
 	static int parse(Domain::Xml::Hyperv& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hyperv& , QDomElement& );
+	static int generate(const Domain::Xml::Hyperv& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hyperv& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18777,6 +19360,10 @@ struct Traits<Domain::Xml::Kvm>
 
 	static int parse(Domain::Xml::Kvm& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Kvm& , QDomElement& );
+	static int generate(const Domain::Xml::Kvm& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Kvm& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18789,6 +19376,10 @@ struct Traits<Domain::Xml::Pvspinlock>
 
 	static int parse(Domain::Xml::Pvspinlock& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Pvspinlock& , QDomElement& );
+	static int generate(const Domain::Xml::Pvspinlock& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Pvspinlock& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18801,6 +19392,10 @@ struct Traits<Domain::Xml::Capabilities>
 
 	static int parse(Domain::Xml::Capabilities& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Capabilities& , QDomElement& );
+	static int generate(const Domain::Xml::Capabilities& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Capabilities& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18813,6 +19408,10 @@ struct Traits<Domain::Xml::Pmu>
 
 	static int parse(Domain::Xml::Pmu& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Pmu& , QDomElement& );
+	static int generate(const Domain::Xml::Pmu& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Pmu& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18825,6 +19424,10 @@ struct Traits<Domain::Xml::Vmport>
 
 	static int parse(Domain::Xml::Vmport& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Vmport& , QDomElement& );
+	static int generate(const Domain::Xml::Vmport& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Vmport& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18837,6 +19440,10 @@ struct Traits<Domain::Xml::Gic>
 
 	static int parse(Domain::Xml::Gic& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Gic& , QDomElement& );
+	static int generate(const Domain::Xml::Gic& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Gic& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18849,6 +19456,10 @@ struct Traits<Domain::Xml::Anonymous2357>
 
 	static int parse(Domain::Xml::Anonymous2357& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Anonymous2357& , QDomElement& );
+	static int generate(const Domain::Xml::Anonymous2357& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Anonymous2357& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18861,6 +19472,10 @@ struct Traits<Domain::Xml::Smm>
 
 	static int parse(Domain::Xml::Smm& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Smm& , QDomElement& );
+	static int generate(const Domain::Xml::Smm& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Smm& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18873,6 +19488,10 @@ struct Traits<Domain::Xml::Hpt>
 
 	static int parse(Domain::Xml::Hpt& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hpt& , QDomElement& );
+	static int generate(const Domain::Xml::Hpt& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hpt& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18885,6 +19504,10 @@ struct Traits<Domain::Xml::Vmcoreinfo>
 
 	static int parse(Domain::Xml::Vmcoreinfo& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Vmcoreinfo& , QDomElement& );
+	static int generate(const Domain::Xml::Vmcoreinfo& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Vmcoreinfo& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18897,6 +19520,10 @@ struct Traits<Domain::Xml::Tcg>
 
 	static int parse(Domain::Xml::Tcg& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Tcg& , QDomElement& );
+	static int generate(const Domain::Xml::Tcg& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Tcg& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18909,6 +19536,10 @@ struct Traits<Domain::Xml::Features>
 
 	static int parse(Domain::Xml::Features& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Features& , QDomElement& );
+	static int generate(const Domain::Xml::Features& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Features& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18921,6 +19552,10 @@ struct Traits<Domain::Xml::VzDns>
 
 	static int parse(Domain::Xml::VzDns& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::VzDns& , QDomElement& );
+	static int generate(const Domain::Xml::VzDns& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::VzDns& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18933,6 +19568,10 @@ struct Traits<Domain::Xml::Class>
 
 	static int parse(Domain::Xml::Class& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Class& , QDomElement& );
+	static int generate(const Domain::Xml::Class& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Class& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18945,6 +19584,10 @@ struct Traits<Domain::Xml::VzNetworkRates>
 
 	static int parse(Domain::Xml::VzNetworkRates& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::VzNetworkRates& , QDomElement& );
+	static int generate(const Domain::Xml::VzNetworkRates& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::VzNetworkRates& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18957,6 +19600,10 @@ struct Traits<Domain::Xml::SuspendToMem>
 
 	static int parse(Domain::Xml::SuspendToMem& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::SuspendToMem& , QDomElement& );
+	static int generate(const Domain::Xml::SuspendToMem& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::SuspendToMem& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18969,6 +19616,10 @@ struct Traits<Domain::Xml::SuspendToDisk>
 
 	static int parse(Domain::Xml::SuspendToDisk& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::SuspendToDisk& , QDomElement& );
+	static int generate(const Domain::Xml::SuspendToDisk& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::SuspendToDisk& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18981,6 +19632,10 @@ struct Traits<Domain::Xml::Pm>
 
 	static int parse(Domain::Xml::Pm& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Pm& , QDomElement& );
+	static int generate(const Domain::Xml::Pm& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Pm& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -18993,6 +19648,10 @@ struct Traits<Domain::Xml::Event>
 
 	static int parse(Domain::Xml::Event& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Event& , QDomElement& );
+	static int generate(const Domain::Xml::Event& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Event& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19005,6 +19664,10 @@ struct Traits<Domain::Xml::Uid>
 
 	static int parse(Domain::Xml::Uid& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Uid& , QDomElement& );
+	static int generate(const Domain::Xml::Uid& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Uid& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19017,6 +19680,10 @@ struct Traits<Domain::Xml::Gid>
 
 	static int parse(Domain::Xml::Gid& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Gid& , QDomElement& );
+	static int generate(const Domain::Xml::Gid& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Gid& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19029,6 +19696,10 @@ struct Traits<Domain::Xml::Idmap>
 
 	static int parse(Domain::Xml::Idmap& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Idmap& , QDomElement& );
+	static int generate(const Domain::Xml::Idmap& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Idmap& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19041,6 +19712,10 @@ struct Traits<Domain::Xml::Disk7002>
 
 	static int parse(Domain::Xml::Disk7002& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Disk7002& , QDomElement& );
+	static int generate(const Domain::Xml::Disk7002& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Disk7002& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19053,6 +19728,10 @@ struct Traits<Domain::Xml::DriverFormat>
 
 	static int parse(Domain::Xml::DriverFormat& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::DriverFormat& , QDomElement& );
+	static int generate(const Domain::Xml::DriverFormat& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::DriverFormat& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19065,6 +19744,10 @@ struct Traits<Domain::Xml::VirtioOptions>
 
 	static int parse(Domain::Xml::VirtioOptions& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::VirtioOptions& , QDomElement& );
+	static int generate(const Domain::Xml::VirtioOptions& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::VirtioOptions& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19077,6 +19760,10 @@ struct Traits<Domain::Xml::MetadataCache>
 
 	static int parse(Domain::Xml::MetadataCache& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::MetadataCache& , QDomElement& );
+	static int generate(const Domain::Xml::MetadataCache& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::MetadataCache& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19089,6 +19776,10 @@ struct Traits<Domain::Xml::Driver>
 
 	static int parse(Domain::Xml::Driver& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Driver& , QDomElement& );
+	static int generate(const Domain::Xml::Driver& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Driver& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19101,6 +19792,10 @@ struct Traits<Domain::Xml::MetadataCache1>
 
 	static int parse(Domain::Xml::MetadataCache1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::MetadataCache1& , QDomElement& );
+	static int generate(const Domain::Xml::MetadataCache1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::MetadataCache1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19113,6 +19808,10 @@ struct Traits<Domain::Xml::Format>
 
 	static int parse(Domain::Xml::Format& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Format& , QDomElement& );
+	static int generate(const Domain::Xml::Format& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Format& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19125,6 +19824,10 @@ struct Traits<Domain::Xml::Anonymous2358>
 
 	static int parse(Domain::Xml::Anonymous2358& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Anonymous2358& , QDomElement& );
+	static int generate(const Domain::Xml::Anonymous2358& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Anonymous2358& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19137,6 +19840,10 @@ struct Traits<Domain::Xml::Mirror4765>
 
 	static int parse(Domain::Xml::Mirror4765& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Mirror4765& , QDomElement& );
+	static int generate(const Domain::Xml::Mirror4765& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Mirror4765& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19149,6 +19856,10 @@ struct Traits<Domain::Xml::Mirror4766>
 
 	static int parse(Domain::Xml::Mirror4766& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Mirror4766& , QDomElement& );
+	static int generate(const Domain::Xml::Mirror4766& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Mirror4766& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19161,6 +19872,10 @@ struct Traits<Domain::Xml::Mirror>
 
 	static int parse(Domain::Xml::Mirror& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Mirror& , QDomElement& );
+	static int generate(const Domain::Xml::Mirror& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Mirror& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19173,6 +19888,10 @@ struct Traits<Domain::Xml::Secret>
 
 	static int parse(Domain::Xml::Secret& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Secret& , QDomElement& );
+	static int generate(const Domain::Xml::Secret& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Secret& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19185,6 +19904,10 @@ struct Traits<Domain::Xml::Auth>
 
 	static int parse(Domain::Xml::Auth& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Auth& , QDomElement& );
+	static int generate(const Domain::Xml::Auth& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Auth& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19197,6 +19920,10 @@ struct Traits<Domain::Xml::Target>
 
 	static int parse(Domain::Xml::Target& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Target& , QDomElement& );
+	static int generate(const Domain::Xml::Target& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Target& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19209,6 +19936,10 @@ struct Traits<Domain::Xml::Boot>
 
 	static int parse(Domain::Xml::Boot& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Boot& , QDomElement& );
+	static int generate(const Domain::Xml::Boot& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Boot& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19221,6 +19952,10 @@ struct Traits<Domain::Xml::Transient>
 
 	static int parse(Domain::Xml::Transient& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Transient& , QDomElement& );
+	static int generate(const Domain::Xml::Transient& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Transient& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19233,6 +19968,10 @@ struct Traits<Domain::Xml::Variant4770>
 
 	static int parse(Domain::Xml::Variant4770& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Variant4770& , QDomElement& );
+	static int generate(const Domain::Xml::Variant4770& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Variant4770& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19245,6 +19984,10 @@ struct Traits<Domain::Xml::Variant4773>
 
 	static int parse(Domain::Xml::Variant4773& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Variant4773& , QDomElement& );
+	static int generate(const Domain::Xml::Variant4773& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Variant4773& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19257,6 +20000,10 @@ struct Traits<Domain::Xml::Iotune>
 
 	static int parse(Domain::Xml::Iotune& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Iotune& , QDomElement& );
+	static int generate(const Domain::Xml::Iotune& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Iotune& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19269,6 +20016,10 @@ struct Traits<Domain::Xml::Pciaddress>
 
 	static int parse(Domain::Xml::Pciaddress& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Pciaddress& , QDomElement& );
+	static int generate(const Domain::Xml::Pciaddress& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Pciaddress& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19281,6 +20032,10 @@ struct Traits<Domain::Xml::Driveaddress>
 
 	static int parse(Domain::Xml::Driveaddress& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Driveaddress& , QDomElement& );
+	static int generate(const Domain::Xml::Driveaddress& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Driveaddress& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19293,6 +20048,10 @@ struct Traits<Domain::Xml::Virtioserialaddress>
 
 	static int parse(Domain::Xml::Virtioserialaddress& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Virtioserialaddress& , QDomElement& );
+	static int generate(const Domain::Xml::Virtioserialaddress& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Virtioserialaddress& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19305,6 +20064,10 @@ struct Traits<Domain::Xml::Ccidaddress>
 
 	static int parse(Domain::Xml::Ccidaddress& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Ccidaddress& , QDomElement& );
+	static int generate(const Domain::Xml::Ccidaddress& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Ccidaddress& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19317,6 +20080,10 @@ struct Traits<Domain::Xml::Usbportaddress>
 
 	static int parse(Domain::Xml::Usbportaddress& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Usbportaddress& , QDomElement& );
+	static int generate(const Domain::Xml::Usbportaddress& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Usbportaddress& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19329,6 +20096,10 @@ struct Traits<Domain::Xml::Anonymous9190>
 
 	static int parse(Domain::Xml::Anonymous9190& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Anonymous9190& , QDomElement& );
+	static int generate(const Domain::Xml::Anonymous9190& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Anonymous9190& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19341,6 +20112,10 @@ struct Traits<Domain::Xml::Isaaddress>
 
 	static int parse(Domain::Xml::Isaaddress& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Isaaddress& , QDomElement& );
+	static int generate(const Domain::Xml::Isaaddress& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Isaaddress& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19353,6 +20128,10 @@ struct Traits<Domain::Xml::Dimmaddress>
 
 	static int parse(Domain::Xml::Dimmaddress& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Dimmaddress& , QDomElement& );
+	static int generate(const Domain::Xml::Dimmaddress& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Dimmaddress& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19365,6 +20144,10 @@ struct Traits<Domain::Xml::Geometry>
 
 	static int parse(Domain::Xml::Geometry& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Geometry& , QDomElement& );
+	static int generate(const Domain::Xml::Geometry& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Geometry& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19377,6 +20160,10 @@ struct Traits<Domain::Xml::Blockio>
 
 	static int parse(Domain::Xml::Blockio& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Blockio& , QDomElement& );
+	static int generate(const Domain::Xml::Blockio& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Blockio& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19389,6 +20176,10 @@ struct Traits<Domain::Xml::BackingStore>
 
 	static int parse(Domain::Xml::BackingStore& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::BackingStore& , QDomElement& );
+	static int generate(const Domain::Xml::BackingStore& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::BackingStore& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19401,6 +20192,10 @@ struct Traits<Domain::Xml::Disk>
 
 	static int parse(Domain::Xml::Disk& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Disk& , QDomElement& );
+	static int generate(const Domain::Xml::Disk& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Disk& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19413,6 +20208,10 @@ struct Traits<Domain::Xml::Acpi>
 
 	static int parse(Domain::Xml::Acpi& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Acpi& , QDomElement& );
+	static int generate(const Domain::Xml::Acpi& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Acpi& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19425,6 +20224,10 @@ struct Traits<Domain::Xml::Variant5121>
 
 	static int parse(Domain::Xml::Variant5121& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Variant5121& , QDomElement& );
+	static int generate(const Domain::Xml::Variant5121& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Variant5121& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19437,6 +20240,10 @@ struct Traits<Domain::Xml::Variant7013>
 
 	static int parse(Domain::Xml::Variant7013& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Variant7013& , QDomElement& );
+	static int generate(const Domain::Xml::Variant7013& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Variant7013& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19449,6 +20256,10 @@ struct Traits<Domain::Xml::Target1>
 
 	static int parse(Domain::Xml::Target1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Target1& , QDomElement& );
+	static int generate(const Domain::Xml::Target1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Target1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19461,6 +20272,10 @@ struct Traits<Domain::Xml::Variant7014>
 
 	static int parse(Domain::Xml::Variant7014& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Variant7014& , QDomElement& );
+	static int generate(const Domain::Xml::Variant7014& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Variant7014& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19473,6 +20288,10 @@ struct Traits<Domain::Xml::Variant8014>
 
 	static int parse(Domain::Xml::Variant8014& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Variant8014& , QDomElement& );
+	static int generate(const Domain::Xml::Variant8014& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Variant8014& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19485,6 +20304,10 @@ struct Traits<Domain::Xml::Variant9522>
 
 	static int parse(Domain::Xml::Variant9522& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Variant9522& , QDomElement& );
+	static int generate(const Domain::Xml::Variant9522& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Variant9522& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19497,6 +20320,10 @@ struct Traits<Domain::Xml::Variant8018>
 
 	static int parse(Domain::Xml::Variant8018& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Variant8018& , QDomElement& );
+	static int generate(const Domain::Xml::Variant8018& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Variant8018& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19509,6 +20336,10 @@ struct Traits<Domain::Xml::Driver1>
 
 	static int parse(Domain::Xml::Driver1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Driver1& , QDomElement& );
+	static int generate(const Domain::Xml::Driver1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Driver1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19521,6 +20352,10 @@ struct Traits<Domain::Xml::Controller>
 
 	static int parse(Domain::Xml::Controller& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Controller& , QDomElement& );
+	static int generate(const Domain::Xml::Controller& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Controller& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19533,6 +20368,10 @@ struct Traits<Domain::Xml::Target2>
 
 	static int parse(Domain::Xml::Target2& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Target2& , QDomElement& );
+	static int generate(const Domain::Xml::Target2& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Target2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19545,6 +20384,10 @@ struct Traits<Domain::Xml::Lease>
 
 	static int parse(Domain::Xml::Lease& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Lease& , QDomElement& );
+	static int generate(const Domain::Xml::Lease& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Lease& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19557,6 +20400,10 @@ struct Traits<Domain::Xml::Driver2>
 
 	static int parse(Domain::Xml::Driver2& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Driver2& , QDomElement& );
+	static int generate(const Domain::Xml::Driver2& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Driver2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19569,6 +20416,10 @@ struct Traits<Domain::Xml::Filesystem7016>
 
 	static int parse(Domain::Xml::Filesystem7016& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Filesystem7016& , QDomElement& );
+	static int generate(const Domain::Xml::Filesystem7016& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Filesystem7016& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19581,6 +20432,10 @@ struct Traits<Domain::Xml::Filesystem7017>
 
 	static int parse(Domain::Xml::Filesystem7017& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Filesystem7017& , QDomElement& );
+	static int generate(const Domain::Xml::Filesystem7017& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Filesystem7017& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19593,6 +20448,10 @@ struct Traits<Domain::Xml::Filesystem7018>
 
 	static int parse(Domain::Xml::Filesystem7018& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Filesystem7018& , QDomElement& );
+	static int generate(const Domain::Xml::Filesystem7018& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Filesystem7018& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19605,6 +20464,10 @@ struct Traits<Domain::Xml::Filesystem7019>
 
 	static int parse(Domain::Xml::Filesystem7019& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Filesystem7019& , QDomElement& );
+	static int generate(const Domain::Xml::Filesystem7019& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Filesystem7019& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19617,6 +20480,10 @@ struct Traits<Domain::Xml::Filesystem7020>
 
 	static int parse(Domain::Xml::Filesystem7020& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Filesystem7020& , QDomElement& );
+	static int generate(const Domain::Xml::Filesystem7020& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Filesystem7020& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19629,6 +20496,10 @@ struct Traits<Domain::Xml::Source5>
 
 	static int parse(Domain::Xml::Source5& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source5& , QDomElement& );
+	static int generate(const Domain::Xml::Source5& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source5& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19641,6 +20512,10 @@ struct Traits<Domain::Xml::Filesystem7021>
 
 	static int parse(Domain::Xml::Filesystem7021& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Filesystem7021& , QDomElement& );
+	static int generate(const Domain::Xml::Filesystem7021& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Filesystem7021& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19653,6 +20528,10 @@ struct Traits<Domain::Xml::Filesystem>
 
 	static int parse(Domain::Xml::Filesystem& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Filesystem& , QDomElement& );
+	static int generate(const Domain::Xml::Filesystem& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Filesystem& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19665,6 +20544,10 @@ struct Traits<Domain::Xml::InterfaceBridgeAttributes>
 
 	static int parse(Domain::Xml::InterfaceBridgeAttributes& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::InterfaceBridgeAttributes& , QDomElement& );
+	static int generate(const Domain::Xml::InterfaceBridgeAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::InterfaceBridgeAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19677,6 +20560,10 @@ struct Traits<Domain::Xml::InterfaceNetworkAttributes>
 
 	static int parse(Domain::Xml::InterfaceNetworkAttributes& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::InterfaceNetworkAttributes& , QDomElement& );
+	static int generate(const Domain::Xml::InterfaceNetworkAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::InterfaceNetworkAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19689,6 +20576,10 @@ struct Traits<Domain::Xml::Source6>
 
 	static int parse(Domain::Xml::Source6& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source6& , QDomElement& );
+	static int generate(const Domain::Xml::Source6& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source6& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19701,6 +20592,10 @@ struct Traits<Domain::Xml::Parameters>
 
 	static int parse(Domain::Xml::Parameters& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Parameters& , QDomElement& );
+	static int generate(const Domain::Xml::Parameters& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Parameters& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19713,6 +20608,10 @@ struct Traits<Domain::Xml::Parameters1>
 
 	static int parse(Domain::Xml::Parameters1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Parameters1& , QDomElement& );
+	static int generate(const Domain::Xml::Parameters1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Parameters1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19725,6 +20624,10 @@ struct Traits<Domain::Xml::Parameters2>
 
 	static int parse(Domain::Xml::Parameters2& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Parameters2& , QDomElement& );
+	static int generate(const Domain::Xml::Parameters2& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Parameters2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19737,6 +20640,10 @@ struct Traits<Domain::Xml::Parameters3>
 
 	static int parse(Domain::Xml::Parameters3& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Parameters3& , QDomElement& );
+	static int generate(const Domain::Xml::Parameters3& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Parameters3& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19749,6 +20656,10 @@ struct Traits<Domain::Xml::Virtualport>
 
 	static int parse(Domain::Xml::Virtualport& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Virtualport& , QDomElement& );
+	static int generate(const Domain::Xml::Virtualport& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Virtualport& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19761,6 +20672,10 @@ struct Traits<Domain::Xml::Frames>
 
 	static int parse(Domain::Xml::Frames& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Frames& , QDomElement& );
+	static int generate(const Domain::Xml::Frames& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Frames& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19773,6 +20688,10 @@ struct Traits<Domain::Xml::Rx>
 
 	static int parse(Domain::Xml::Rx& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Rx& , QDomElement& );
+	static int generate(const Domain::Xml::Rx& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Rx& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19785,6 +20704,10 @@ struct Traits<Domain::Xml::Coalesce>
 
 	static int parse(Domain::Xml::Coalesce& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Coalesce& , QDomElement& );
+	static int generate(const Domain::Xml::Coalesce& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Coalesce& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19797,6 +20720,10 @@ struct Traits<Domain::Xml::VzDhcp>
 
 	static int parse(Domain::Xml::VzDhcp& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::VzDhcp& , QDomElement& );
+	static int generate(const Domain::Xml::VzDhcp& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::VzDhcp& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19809,6 +20736,10 @@ struct Traits<Domain::Xml::VzDns1>
 
 	static int parse(Domain::Xml::VzDns1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::VzDns1& , QDomElement& );
+	static int generate(const Domain::Xml::VzDns1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::VzDns1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19821,6 +20752,10 @@ struct Traits<Domain::Xml::Target3>
 
 	static int parse(Domain::Xml::Target3& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Target3& , QDomElement& );
+	static int generate(const Domain::Xml::Target3& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Target3& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19833,6 +20768,10 @@ struct Traits<Domain::Xml::Guest>
 
 	static int parse(Domain::Xml::Guest& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Guest& , QDomElement& );
+	static int generate(const Domain::Xml::Guest& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Guest& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19845,6 +20784,10 @@ struct Traits<Domain::Xml::Ip>
 
 	static int parse(Domain::Xml::Ip& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Ip& , QDomElement& );
+	static int generate(const Domain::Xml::Ip& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Ip& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19857,6 +20800,10 @@ struct Traits<Domain::Xml::Route>
 
 	static int parse(Domain::Xml::Route& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Route& , QDomElement& );
+	static int generate(const Domain::Xml::Route& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Route& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19869,6 +20816,10 @@ struct Traits<Domain::Xml::Backend>
 
 	static int parse(Domain::Xml::Backend& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Backend& , QDomElement& );
+	static int generate(const Domain::Xml::Backend& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Backend& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19881,6 +20832,10 @@ struct Traits<Domain::Xml::Driver7037>
 
 	static int parse(Domain::Xml::Driver7037& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Driver7037& , QDomElement& );
+	static int generate(const Domain::Xml::Driver7037& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Driver7037& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19893,6 +20848,10 @@ struct Traits<Domain::Xml::Host>
 
 	static int parse(Domain::Xml::Host& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Host& , QDomElement& );
+	static int generate(const Domain::Xml::Host& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Host& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19905,6 +20864,10 @@ struct Traits<Domain::Xml::Guest1>
 
 	static int parse(Domain::Xml::Guest1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Guest1& , QDomElement& );
+	static int generate(const Domain::Xml::Guest1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Guest1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19917,6 +20880,10 @@ struct Traits<Domain::Xml::Driver3>
 
 	static int parse(Domain::Xml::Driver3& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Driver3& , QDomElement& );
+	static int generate(const Domain::Xml::Driver3& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Driver3& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19929,6 +20896,10 @@ struct Traits<Domain::Xml::Parameter>
 
 	static int parse(Domain::Xml::Parameter& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Parameter& , QDomElement& );
+	static int generate(const Domain::Xml::Parameter& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Parameter& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19941,6 +20912,10 @@ struct Traits<Domain::Xml::FilterrefNodeAttributes>
 
 	static int parse(Domain::Xml::FilterrefNodeAttributes& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::FilterrefNodeAttributes& , QDomElement& );
+	static int generate(const Domain::Xml::FilterrefNodeAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::FilterrefNodeAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19953,6 +20928,10 @@ struct Traits<Domain::Xml::Tune>
 
 	static int parse(Domain::Xml::Tune& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Tune& , QDomElement& );
+	static int generate(const Domain::Xml::Tune& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Tune& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19965,6 +20944,10 @@ struct Traits<Domain::Xml::Rom>
 
 	static int parse(Domain::Xml::Rom& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Rom& , QDomElement& );
+	static int generate(const Domain::Xml::Rom& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Rom& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19977,6 +20960,10 @@ struct Traits<Domain::Xml::BandwidthAttributes>
 
 	static int parse(Domain::Xml::BandwidthAttributes& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::BandwidthAttributes& , QDomElement& );
+	static int generate(const Domain::Xml::BandwidthAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::BandwidthAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19989,6 +20976,10 @@ struct Traits<Domain::Xml::Bandwidth1>
 
 	static int parse(Domain::Xml::Bandwidth1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Bandwidth1& , QDomElement& );
+	static int generate(const Domain::Xml::Bandwidth1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Bandwidth1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20001,6 +20992,10 @@ struct Traits<Domain::Xml::Tag>
 
 	static int parse(Domain::Xml::Tag& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Tag& , QDomElement& );
+	static int generate(const Domain::Xml::Tag& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Tag& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20013,6 +21008,10 @@ struct Traits<Domain::Xml::Port>
 
 	static int parse(Domain::Xml::Port& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Port& , QDomElement& );
+	static int generate(const Domain::Xml::Port& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Port& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20025,6 +21024,10 @@ struct Traits<Domain::Xml::Teaming9388>
 
 	static int parse(Domain::Xml::Teaming9388& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Teaming9388& , QDomElement& );
+	static int generate(const Domain::Xml::Teaming9388& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Teaming9388& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20037,6 +21040,10 @@ struct Traits<Domain::Xml::Interface7022>
 
 	static int parse(Domain::Xml::Interface7022& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Interface7022& , QDomElement& );
+	static int generate(const Domain::Xml::Interface7022& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Interface7022& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20049,6 +21056,10 @@ struct Traits<Domain::Xml::Interface7023>
 
 	static int parse(Domain::Xml::Interface7023& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Interface7023& , QDomElement& );
+	static int generate(const Domain::Xml::Interface7023& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Interface7023& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20061,6 +21072,10 @@ struct Traits<Domain::Xml::Source7>
 
 	static int parse(Domain::Xml::Source7& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source7& , QDomElement& );
+	static int generate(const Domain::Xml::Source7& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source7& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20073,6 +21088,10 @@ struct Traits<Domain::Xml::Interface7024>
 
 	static int parse(Domain::Xml::Interface7024& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Interface7024& , QDomElement& );
+	static int generate(const Domain::Xml::Interface7024& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Interface7024& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20085,6 +21104,10 @@ struct Traits<Domain::Xml::Source8>
 
 	static int parse(Domain::Xml::Source8& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source8& , QDomElement& );
+	static int generate(const Domain::Xml::Source8& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source8& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20097,6 +21120,10 @@ struct Traits<Domain::Xml::Interface7025>
 
 	static int parse(Domain::Xml::Interface7025& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Interface7025& , QDomElement& );
+	static int generate(const Domain::Xml::Interface7025& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Interface7025& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20109,6 +21136,10 @@ struct Traits<Domain::Xml::Source9>
 
 	static int parse(Domain::Xml::Source9& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source9& , QDomElement& );
+	static int generate(const Domain::Xml::Source9& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source9& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20121,6 +21152,10 @@ struct Traits<Domain::Xml::Interface7026>
 
 	static int parse(Domain::Xml::Interface7026& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Interface7026& , QDomElement& );
+	static int generate(const Domain::Xml::Interface7026& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Interface7026& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20133,6 +21168,10 @@ struct Traits<Domain::Xml::InterfaceOptions>
 
 	static int parse(Domain::Xml::InterfaceOptions& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::InterfaceOptions& , QDomElement& );
+	static int generate(const Domain::Xml::InterfaceOptions& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::InterfaceOptions& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20145,6 +21184,10 @@ struct Traits<Domain::Xml::Interface7028>
 
 	static int parse(Domain::Xml::Interface7028& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Interface7028& , QDomElement& );
+	static int generate(const Domain::Xml::Interface7028& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Interface7028& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20157,6 +21200,10 @@ struct Traits<Domain::Xml::Source10>
 
 	static int parse(Domain::Xml::Source10& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source10& , QDomElement& );
+	static int generate(const Domain::Xml::Source10& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source10& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20169,6 +21216,10 @@ struct Traits<Domain::Xml::Interface7029>
 
 	static int parse(Domain::Xml::Interface7029& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Interface7029& , QDomElement& );
+	static int generate(const Domain::Xml::Interface7029& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Interface7029& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20181,6 +21232,10 @@ struct Traits<Domain::Xml::Source11>
 
 	static int parse(Domain::Xml::Source11& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source11& , QDomElement& );
+	static int generate(const Domain::Xml::Source11& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source11& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20193,6 +21248,10 @@ struct Traits<Domain::Xml::Interface7030>
 
 	static int parse(Domain::Xml::Interface7030& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Interface7030& , QDomElement& );
+	static int generate(const Domain::Xml::Interface7030& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Interface7030& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20205,6 +21264,10 @@ struct Traits<Domain::Xml::Usbproduct>
 
 	static int parse(Domain::Xml::Usbproduct& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Usbproduct& , QDomElement& );
+	static int generate(const Domain::Xml::Usbproduct& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Usbproduct& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20217,6 +21280,10 @@ struct Traits<Domain::Xml::Address>
 
 	static int parse(Domain::Xml::Address& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Address& , QDomElement& );
+	static int generate(const Domain::Xml::Address& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Address& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20229,6 +21296,10 @@ struct Traits<Domain::Xml::Source7031>
 
 	static int parse(Domain::Xml::Source7031& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source7031& , QDomElement& );
+	static int generate(const Domain::Xml::Source7031& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source7031& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20241,6 +21312,10 @@ struct Traits<Domain::Xml::Address7033>
 
 	static int parse(Domain::Xml::Address7033& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Address7033& , QDomElement& );
+	static int generate(const Domain::Xml::Address7033& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Address7033& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20253,6 +21328,10 @@ struct Traits<Domain::Xml::Source12>
 
 	static int parse(Domain::Xml::Source12& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source12& , QDomElement& );
+	static int generate(const Domain::Xml::Source12& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source12& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20265,6 +21344,10 @@ struct Traits<Domain::Xml::Interface7035>
 
 	static int parse(Domain::Xml::Interface7035& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Interface7035& , QDomElement& );
+	static int generate(const Domain::Xml::Interface7035& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Interface7035& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20277,6 +21360,10 @@ struct Traits<Domain::Xml::Interface>
 
 	static int parse(Domain::Xml::Interface& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Interface& , QDomElement& );
+	static int generate(const Domain::Xml::Interface& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Interface& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20289,6 +21376,10 @@ struct Traits<Domain::Xml::Anonymous9430>
 
 	static int parse(Domain::Xml::Anonymous9430& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Anonymous9430& , QDomElement& );
+	static int generate(const Domain::Xml::Anonymous9430& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Anonymous9430& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20301,6 +21392,10 @@ struct Traits<Domain::Xml::Input>
 
 	static int parse(Domain::Xml::Input& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Input& , QDomElement& );
+	static int generate(const Domain::Xml::Input& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Input& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20313,6 +21408,10 @@ struct Traits<Domain::Xml::Sound>
 
 	static int parse(Domain::Xml::Sound& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Sound& , QDomElement& );
+	static int generate(const Domain::Xml::Sound& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Sound& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20325,6 +21424,10 @@ struct Traits<Domain::Xml::Source13>
 
 	static int parse(Domain::Xml::Source13& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source13& , QDomElement& );
+	static int generate(const Domain::Xml::Source13& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source13& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20337,6 +21440,10 @@ struct Traits<Domain::Xml::Hostdevsubsyspci>
 
 	static int parse(Domain::Xml::Hostdevsubsyspci& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hostdevsubsyspci& , QDomElement& );
+	static int generate(const Domain::Xml::Hostdevsubsyspci& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hostdevsubsyspci& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20349,6 +21456,10 @@ struct Traits<Domain::Xml::Source7072>
 
 	static int parse(Domain::Xml::Source7072& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source7072& , QDomElement& );
+	static int generate(const Domain::Xml::Source7072& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source7072& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20361,6 +21472,10 @@ struct Traits<Domain::Xml::Source14>
 
 	static int parse(Domain::Xml::Source14& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source14& , QDomElement& );
+	static int generate(const Domain::Xml::Source14& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source14& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20373,6 +21488,10 @@ struct Traits<Domain::Xml::Hostdevsubsysusb>
 
 	static int parse(Domain::Xml::Hostdevsubsysusb& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hostdevsubsysusb& , QDomElement& );
+	static int generate(const Domain::Xml::Hostdevsubsysusb& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hostdevsubsysusb& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20385,6 +21504,10 @@ struct Traits<Domain::Xml::Parentaddr>
 
 	static int parse(Domain::Xml::Parentaddr& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Parentaddr& , QDomElement& );
+	static int generate(const Domain::Xml::Parentaddr& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Parentaddr& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20397,6 +21520,10 @@ struct Traits<Domain::Xml::Adapter118>
 
 	static int parse(Domain::Xml::Adapter118& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Adapter118& , QDomElement& );
+	static int generate(const Domain::Xml::Adapter118& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Adapter118& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20409,6 +21536,10 @@ struct Traits<Domain::Xml::Scsiaddress>
 
 	static int parse(Domain::Xml::Scsiaddress& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Scsiaddress& , QDomElement& );
+	static int generate(const Domain::Xml::Scsiaddress& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Scsiaddress& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20421,6 +21552,10 @@ struct Traits<Domain::Xml::Source7074>
 
 	static int parse(Domain::Xml::Source7074& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source7074& , QDomElement& );
+	static int generate(const Domain::Xml::Source7074& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source7074& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20433,6 +21568,10 @@ struct Traits<Domain::Xml::Host1>
 
 	static int parse(Domain::Xml::Host1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Host1& , QDomElement& );
+	static int generate(const Domain::Xml::Host1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Host1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20445,6 +21584,10 @@ struct Traits<Domain::Xml::Source7075>
 
 	static int parse(Domain::Xml::Source7075& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source7075& , QDomElement& );
+	static int generate(const Domain::Xml::Source7075& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source7075& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20457,6 +21600,10 @@ struct Traits<Domain::Xml::Hostdevsubsysscsi>
 
 	static int parse(Domain::Xml::Hostdevsubsysscsi& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hostdevsubsysscsi& , QDomElement& );
+	static int generate(const Domain::Xml::Hostdevsubsysscsi& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hostdevsubsysscsi& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20469,6 +21616,10 @@ struct Traits<Domain::Xml::Hostdevsubsys>
 
 	static int parse(Domain::Xml::Hostdevsubsys& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hostdevsubsys& , QDomElement& );
+	static int generate(const Domain::Xml::Hostdevsubsys& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hostdevsubsys& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20481,6 +21632,10 @@ struct Traits<Domain::Xml::Ip1>
 
 	static int parse(Domain::Xml::Ip1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Ip1& , QDomElement& );
+	static int generate(const Domain::Xml::Ip1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Ip1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20493,6 +21648,10 @@ struct Traits<Domain::Xml::InterfaceIpInfo>
 
 	static int parse(Domain::Xml::InterfaceIpInfo& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::InterfaceIpInfo& , QDomElement& );
+	static int generate(const Domain::Xml::InterfaceIpInfo& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::InterfaceIpInfo& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20505,6 +21664,10 @@ struct Traits<Domain::Xml::Hostdevcapsnet>
 
 	static int parse(Domain::Xml::Hostdevcapsnet& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hostdevcapsnet& , QDomElement& );
+	static int generate(const Domain::Xml::Hostdevcapsnet& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hostdevcapsnet& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20517,6 +21680,10 @@ struct Traits<Domain::Xml::Hostdev>
 
 	static int parse(Domain::Xml::Hostdev& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hostdev& , QDomElement& );
+	static int generate(const Domain::Xml::Hostdev& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hostdev& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20529,6 +21696,10 @@ struct Traits<Domain::Xml::Graphics7038>
 
 	static int parse(Domain::Xml::Graphics7038& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Graphics7038& , QDomElement& );
+	static int generate(const Domain::Xml::Graphics7038& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Graphics7038& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20541,6 +21712,10 @@ struct Traits<Domain::Xml::Variant5124>
 
 	static int parse(Domain::Xml::Variant5124& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Variant5124& , QDomElement& );
+	static int generate(const Domain::Xml::Variant5124& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Variant5124& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20553,6 +21728,10 @@ struct Traits<Domain::Xml::Listen7044>
 
 	static int parse(Domain::Xml::Listen7044& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Listen7044& , QDomElement& );
+	static int generate(const Domain::Xml::Listen7044& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Listen7044& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20565,6 +21744,10 @@ struct Traits<Domain::Xml::Listen9392>
 
 	static int parse(Domain::Xml::Listen9392& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Listen9392& , QDomElement& );
+	static int generate(const Domain::Xml::Listen9392& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Listen9392& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20577,6 +21760,10 @@ struct Traits<Domain::Xml::Graphics7039>
 
 	static int parse(Domain::Xml::Graphics7039& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Graphics7039& , QDomElement& );
+	static int generate(const Domain::Xml::Graphics7039& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Graphics7039& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20589,6 +21776,10 @@ struct Traits<Domain::Xml::Channel>
 
 	static int parse(Domain::Xml::Channel& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Channel& , QDomElement& );
+	static int generate(const Domain::Xml::Channel& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Channel& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20601,6 +21792,10 @@ struct Traits<Domain::Xml::Gl>
 
 	static int parse(Domain::Xml::Gl& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Gl& , QDomElement& );
+	static int generate(const Domain::Xml::Gl& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Gl& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20613,6 +21808,10 @@ struct Traits<Domain::Xml::Graphics7040>
 
 	static int parse(Domain::Xml::Graphics7040& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Graphics7040& , QDomElement& );
+	static int generate(const Domain::Xml::Graphics7040& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Graphics7040& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20625,6 +21824,10 @@ struct Traits<Domain::Xml::Graphics7041>
 
 	static int parse(Domain::Xml::Graphics7041& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Graphics7041& , QDomElement& );
+	static int generate(const Domain::Xml::Graphics7041& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Graphics7041& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20637,6 +21840,10 @@ struct Traits<Domain::Xml::Graphics7042>
 
 	static int parse(Domain::Xml::Graphics7042& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Graphics7042& , QDomElement& );
+	static int generate(const Domain::Xml::Graphics7042& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Graphics7042& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20649,6 +21856,10 @@ struct Traits<Domain::Xml::Gl1>
 
 	static int parse(Domain::Xml::Gl1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Gl1& , QDomElement& );
+	static int generate(const Domain::Xml::Gl1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Gl1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20661,6 +21872,10 @@ struct Traits<Domain::Xml::Driver4>
 
 	static int parse(Domain::Xml::Driver4& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Driver4& , QDomElement& );
+	static int generate(const Domain::Xml::Driver4& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Driver4& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20673,6 +21888,10 @@ struct Traits<Domain::Xml::Model7046>
 
 	static int parse(Domain::Xml::Model7046& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Model7046& , QDomElement& );
+	static int generate(const Domain::Xml::Model7046& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Model7046& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20685,6 +21904,10 @@ struct Traits<Domain::Xml::Acceleration>
 
 	static int parse(Domain::Xml::Acceleration& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Acceleration& , QDomElement& );
+	static int generate(const Domain::Xml::Acceleration& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Acceleration& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20697,6 +21920,10 @@ struct Traits<Domain::Xml::Resolution>
 
 	static int parse(Domain::Xml::Resolution& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Resolution& , QDomElement& );
+	static int generate(const Domain::Xml::Resolution& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Resolution& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20709,6 +21936,10 @@ struct Traits<Domain::Xml::Model1>
 
 	static int parse(Domain::Xml::Model1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Model1& , QDomElement& );
+	static int generate(const Domain::Xml::Model1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Model1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20721,6 +21952,10 @@ struct Traits<Domain::Xml::Video>
 
 	static int parse(Domain::Xml::Video& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Video& , QDomElement& );
+	static int generate(const Domain::Xml::Video& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Video& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20733,6 +21968,10 @@ struct Traits<Domain::Xml::Source15>
 
 	static int parse(Domain::Xml::Source15& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source15& , QDomElement& );
+	static int generate(const Domain::Xml::Source15& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source15& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20745,6 +21984,10 @@ struct Traits<Domain::Xml::Protocol>
 
 	static int parse(Domain::Xml::Protocol& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Protocol& , QDomElement& );
+	static int generate(const Domain::Xml::Protocol& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Protocol& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20757,6 +22000,10 @@ struct Traits<Domain::Xml::Log>
 
 	static int parse(Domain::Xml::Log& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Log& , QDomElement& );
+	static int generate(const Domain::Xml::Log& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Log& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20769,6 +22016,10 @@ struct Traits<Domain::Xml::QemucdevSrcDef>
 
 	static int parse(Domain::Xml::QemucdevSrcDef& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::QemucdevSrcDef& , QDomElement& );
+	static int generate(const Domain::Xml::QemucdevSrcDef& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::QemucdevSrcDef& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20781,6 +22032,10 @@ struct Traits<Domain::Xml::Target4>
 
 	static int parse(Domain::Xml::Target4& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Target4& , QDomElement& );
+	static int generate(const Domain::Xml::Target4& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Target4& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20793,6 +22048,10 @@ struct Traits<Domain::Xml::Qemucdev>
 
 	static int parse(Domain::Xml::Qemucdev& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Qemucdev& , QDomElement& );
+	static int generate(const Domain::Xml::Qemucdev& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Qemucdev& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20805,6 +22064,10 @@ struct Traits<Domain::Xml::Target5>
 
 	static int parse(Domain::Xml::Target5& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Target5& , QDomElement& );
+	static int generate(const Domain::Xml::Target5& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Target5& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20817,6 +22080,10 @@ struct Traits<Domain::Xml::Target6>
 
 	static int parse(Domain::Xml::Target6& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Target6& , QDomElement& );
+	static int generate(const Domain::Xml::Target6& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Target6& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20829,6 +22096,10 @@ struct Traits<Domain::Xml::Channel1>
 
 	static int parse(Domain::Xml::Channel1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Channel1& , QDomElement& );
+	static int generate(const Domain::Xml::Channel1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Channel1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20841,6 +22112,10 @@ struct Traits<Domain::Xml::Smartcard7059>
 
 	static int parse(Domain::Xml::Smartcard7059& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Smartcard7059& , QDomElement& );
+	static int generate(const Domain::Xml::Smartcard7059& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Smartcard7059& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20853,6 +22128,10 @@ struct Traits<Domain::Xml::Smartcard7060>
 
 	static int parse(Domain::Xml::Smartcard7060& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Smartcard7060& , QDomElement& );
+	static int generate(const Domain::Xml::Smartcard7060& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Smartcard7060& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20865,6 +22144,10 @@ struct Traits<Domain::Xml::Smartcard7061>
 
 	static int parse(Domain::Xml::Smartcard7061& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Smartcard7061& , QDomElement& );
+	static int generate(const Domain::Xml::Smartcard7061& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Smartcard7061& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20877,6 +22160,10 @@ struct Traits<Domain::Xml::Smartcard>
 
 	static int parse(Domain::Xml::Smartcard& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Smartcard& , QDomElement& );
+	static int generate(const Domain::Xml::Smartcard& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Smartcard& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20889,6 +22176,10 @@ struct Traits<Domain::Xml::Hub>
 
 	static int parse(Domain::Xml::Hub& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Hub& , QDomElement& );
+	static int generate(const Domain::Xml::Hub& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Hub& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20901,6 +22192,10 @@ struct Traits<Domain::Xml::Redirdev>
 
 	static int parse(Domain::Xml::Redirdev& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Redirdev& , QDomElement& );
+	static int generate(const Domain::Xml::Redirdev& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Redirdev& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20913,6 +22208,10 @@ struct Traits<Domain::Xml::Usbdev>
 
 	static int parse(Domain::Xml::Usbdev& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Usbdev& , QDomElement& );
+	static int generate(const Domain::Xml::Usbdev& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Usbdev& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20925,6 +22224,10 @@ struct Traits<Domain::Xml::Backend4752>
 
 	static int parse(Domain::Xml::Backend4752& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Backend4752& , QDomElement& );
+	static int generate(const Domain::Xml::Backend4752& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Backend4752& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20937,6 +22240,10 @@ struct Traits<Domain::Xml::Backend4753>
 
 	static int parse(Domain::Xml::Backend4753& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Backend4753& , QDomElement& );
+	static int generate(const Domain::Xml::Backend4753& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Backend4753& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20949,6 +22256,10 @@ struct Traits<Domain::Xml::Backend4754>
 
 	static int parse(Domain::Xml::Backend4754& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Backend4754& , QDomElement& );
+	static int generate(const Domain::Xml::Backend4754& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Backend4754& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20961,6 +22272,10 @@ struct Traits<Domain::Xml::Rate>
 
 	static int parse(Domain::Xml::Rate& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Rate& , QDomElement& );
+	static int generate(const Domain::Xml::Rate& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Rate& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20973,6 +22288,10 @@ struct Traits<Domain::Xml::Rng>
 
 	static int parse(Domain::Xml::Rng& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Rng& , QDomElement& );
+	static int generate(const Domain::Xml::Rng& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Rng& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20985,6 +22304,10 @@ struct Traits<Domain::Xml::Device1>
 
 	static int parse(Domain::Xml::Device1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Device1& , QDomElement& );
+	static int generate(const Domain::Xml::Device1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Device1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20997,6 +22320,10 @@ struct Traits<Domain::Xml::Backend7062>
 
 	static int parse(Domain::Xml::Backend7062& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Backend7062& , QDomElement& );
+	static int generate(const Domain::Xml::Backend7062& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Backend7062& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21009,6 +22336,10 @@ struct Traits<Domain::Xml::Backend1>
 
 	static int parse(Domain::Xml::Backend1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Backend1& , QDomElement& );
+	static int generate(const Domain::Xml::Backend1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Backend1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21021,6 +22352,10 @@ struct Traits<Domain::Xml::Tpm>
 
 	static int parse(Domain::Xml::Tpm& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Tpm& , QDomElement& );
+	static int generate(const Domain::Xml::Tpm& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Tpm& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21033,6 +22368,10 @@ struct Traits<Domain::Xml::Source16>
 
 	static int parse(Domain::Xml::Source16& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Source16& , QDomElement& );
+	static int generate(const Domain::Xml::Source16& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Source16& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21045,6 +22384,10 @@ struct Traits<Domain::Xml::Target7>
 
 	static int parse(Domain::Xml::Target7& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Target7& , QDomElement& );
+	static int generate(const Domain::Xml::Target7& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Target7& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21057,6 +22400,10 @@ struct Traits<Domain::Xml::Memory2>
 
 	static int parse(Domain::Xml::Memory2& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Memory2& , QDomElement& );
+	static int generate(const Domain::Xml::Memory2& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Memory2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21069,6 +22416,10 @@ struct Traits<Domain::Xml::Watchdog>
 
 	static int parse(Domain::Xml::Watchdog& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Watchdog& , QDomElement& );
+	static int generate(const Domain::Xml::Watchdog& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Watchdog& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21081,6 +22432,10 @@ struct Traits<Domain::Xml::Memballoon>
 
 	static int parse(Domain::Xml::Memballoon& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Memballoon& , QDomElement& );
+	static int generate(const Domain::Xml::Memballoon& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Memballoon& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21093,6 +22448,10 @@ struct Traits<Domain::Xml::Nvram1>
 
 	static int parse(Domain::Xml::Nvram1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Nvram1& , QDomElement& );
+	static int generate(const Domain::Xml::Nvram1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Nvram1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21105,6 +22464,10 @@ struct Traits<Domain::Xml::Panic>
 
 	static int parse(Domain::Xml::Panic& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Panic& , QDomElement& );
+	static int generate(const Domain::Xml::Panic& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Panic& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21117,6 +22480,10 @@ struct Traits<Domain::Xml::Address1>
 
 	static int parse(Domain::Xml::Address1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Address1& , QDomElement& );
+	static int generate(const Domain::Xml::Address1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Address1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21129,6 +22496,10 @@ struct Traits<Domain::Xml::Disk1>
 
 	static int parse(Domain::Xml::Disk1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Disk1& , QDomElement& );
+	static int generate(const Domain::Xml::Disk1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Disk1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21141,6 +22512,10 @@ struct Traits<Domain::Xml::Domainblockexport_>
 
 	static int parse(Domain::Xml::Domainblockexport_& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Domainblockexport_& , QDomElement& );
+	static int generate(const Domain::Xml::Domainblockexport_& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Domainblockexport_& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21153,6 +22528,10 @@ struct Traits<Domain::Xml::Driver5>
 
 	static int parse(Domain::Xml::Driver5& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Driver5& , QDomElement& );
+	static int generate(const Domain::Xml::Driver5& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Driver5& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21165,6 +22544,10 @@ struct Traits<Domain::Xml::Cid>
 
 	static int parse(Domain::Xml::Cid& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Cid& , QDomElement& );
+	static int generate(const Domain::Xml::Cid& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Cid& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21177,6 +22560,10 @@ struct Traits<Domain::Xml::Vsock>
 
 	static int parse(Domain::Xml::Vsock& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Vsock& , QDomElement& );
+	static int generate(const Domain::Xml::Vsock& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Vsock& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21189,6 +22576,10 @@ struct Traits<Domain::Xml::Devices>
 
 	static int parse(Domain::Xml::Devices& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Devices& , QDomElement& );
+	static int generate(const Domain::Xml::Devices& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Devices& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21201,6 +22592,10 @@ struct Traits<Domain::Xml::Seclabel6970>
 
 	static int parse(Domain::Xml::Seclabel6970& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Seclabel6970& , QDomElement& );
+	static int generate(const Domain::Xml::Seclabel6970& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Seclabel6970& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21213,6 +22608,10 @@ struct Traits<Domain::Xml::Seclabel6971>
 
 	static int parse(Domain::Xml::Seclabel6971& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Seclabel6971& , QDomElement& );
+	static int generate(const Domain::Xml::Seclabel6971& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Seclabel6971& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21225,6 +22624,10 @@ struct Traits<Domain::Xml::Seclabel6972>
 
 	static int parse(Domain::Xml::Seclabel6972& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Seclabel6972& , QDomElement& );
+	static int generate(const Domain::Xml::Seclabel6972& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Seclabel6972& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21237,6 +22640,10 @@ struct Traits<Domain::Xml::Seclabel1>
 
 	static int parse(Domain::Xml::Seclabel1& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Seclabel1& , QDomElement& );
+	static int generate(const Domain::Xml::Seclabel1& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Seclabel1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21249,6 +22656,10 @@ struct Traits<Domain::Xml::Env>
 
 	static int parse(Domain::Xml::Env& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Env& , QDomElement& );
+	static int generate(const Domain::Xml::Env& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Env& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21261,6 +22672,10 @@ struct Traits<Domain::Xml::Commandline>
 
 	static int parse(Domain::Xml::Commandline& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Commandline& , QDomElement& );
+	static int generate(const Domain::Xml::Commandline& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Commandline& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21273,6 +22688,10 @@ struct Traits<Domain::Xml::Cipher>
 
 	static int parse(Domain::Xml::Cipher& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Cipher& , QDomElement& );
+	static int generate(const Domain::Xml::Cipher& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Cipher& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21285,6 +22704,10 @@ struct Traits<Domain::Xml::LaunchSecurity>
 
 	static int parse(Domain::Xml::LaunchSecurity& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::LaunchSecurity& , QDomElement& );
+	static int generate(const Domain::Xml::LaunchSecurity& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::LaunchSecurity& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -21297,6 +22720,10 @@ struct Traits<Domain::Xml::Domain>
 
 	static int parse(Domain::Xml::Domain& , QStack<QDomElement>& );
 	static int generate(const Domain::Xml::Domain& , QDomElement& );
+	static int generate(const Domain::Xml::Domain& , Stream& );
+
+	template<class D>
+	static int produce(const Domain::Xml::Domain& , D& );
 };
 
 } // namespace Libvirt
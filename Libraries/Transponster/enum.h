@@ -25,20 +25,20 @@
 #ifndef __ENUM_H__
 #define __ENUM_H__
 #include <QString>
-#include <boost/bimap/bimap.hpp>
 
 namespace Libvirt
 {
 ///////////////////////////////////////////////////////////////////////////////
 // struct Enum
+// The generated switches over the enumerators and over the texts. There is
+// nothing to build on the start of a process, find() returns -1 on an
+// unknown text.
 
 template<class T>
 struct Enum
 {
-	typedef QString name_type;
-	typedef boost::bimaps::bimap<T, name_type> data_type;
-
-	static data_type getData();
+	static QString getText(T value_);
+	static int find(const QStringRef& text_);
 };
 
 } // namespace Libvirt
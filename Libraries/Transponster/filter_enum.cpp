@@ -23,82 +23,418 @@
  */
 
 #include "filter_enum.h"
-#include <boost/assign/list_of.hpp>
 
-namespace ba = boost::assign;
 namespace Libvirt
 {
 template<>
-Enum<Filter::Xml::EChain>::data_type Enum<Filter::Xml::EChain>::getData()
+QString Enum<Filter::Xml::EChain>::getText(Filter::Xml::EChain value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Filter::Xml::EChainRoot, "root"));
+	switch (value_)
+	{
+	case Filter::Xml::EChainRoot:
+		return QStringLiteral("root");
+	}
+	return QString();
 }
 
 template<>
-Enum<Filter::Xml::EActionType>::data_type Enum<Filter::Xml::EActionType>::getData()
+int Enum<Filter::Xml::EChain>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Filter::Xml::EActionTypeDrop, "drop"))
-			(data_type::value_type(Filter::Xml::EActionTypeAccept, "accept"))
-			(data_type::value_type(Filter::Xml::EActionTypeReject, "reject"))
-			(data_type::value_type(Filter::Xml::EActionTypeContinue, "continue"))
-			(data_type::value_type(Filter::Xml::EActionTypeReturn, "return"));
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("root"))
+				return Filter::Xml::EChainRoot;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Filter::Xml::EDirectionType>::data_type Enum<Filter::Xml::EDirectionType>::getData()
+QString Enum<Filter::Xml::EActionType>::getText(Filter::Xml::EActionType value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Filter::Xml::EDirectionTypeIn, "in"))
-			(data_type::value_type(Filter::Xml::EDirectionTypeOut, "out"))
-			(data_type::value_type(Filter::Xml::EDirectionTypeInout, "inout"));
+	switch (value_)
+	{
+	case Filter::Xml::EActionTypeDrop:
+		return QStringLiteral("drop");
+	case Filter::Xml::EActionTypeAccept:
+		return QStringLiteral("accept");
+	case Filter::Xml::EActionTypeReject:
+		return QStringLiteral("reject");
+	case Filter::Xml::EActionTypeContinue:
+		return QStringLiteral("continue");
+	case Filter::Xml::EActionTypeReturn:
+		return QStringLiteral("return");
+	}
+	return QString();
 }
 
 template<>
-Enum<Filter::Xml::EVirYesNo>::data_type Enum<Filter::Xml::EVirYesNo>::getData()
+int Enum<Filter::Xml::EActionType>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Filter::Xml::EVirYesNoYes, "yes"))
-			(data_type::value_type(Filter::Xml::EVirYesNoNo, "no"));
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("drop"))
+				return Filter::Xml::EActionTypeDrop;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("accept"))
+				return Filter::Xml::EActionTypeAccept;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("reject"))
+				return Filter::Xml::EActionTypeReject;
+			if (text_ == QLatin1String("return"))
+				return Filter::Xml::EActionTypeReturn;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("continue"))
+				return Filter::Xml::EActionTypeContinue;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Filter::Xml::EChoice5647>::data_type Enum<Filter::Xml::EChoice5647>::getData()
+QString Enum<Filter::Xml::EDirectionType>::getText(Filter::Xml::EDirectionType value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Filter::Xml::EChoice5647Arp, "arp"))
-			(data_type::value_type(Filter::Xml::EChoice5647Rarp, "rarp"))
-			(data_type::value_type(Filter::Xml::EChoice5647Ipv4, "ipv4"))
-			(data_type::value_type(Filter::Xml::EChoice5647Ipv6, "ipv6"))
-			(data_type::value_type(Filter::Xml::EChoice5647Vlan, "vlan"));
+	switch (value_)
+	{
+	case Filter::Xml::EDirectionTypeIn:
+		return QStringLiteral("in");
+	case Filter::Xml::EDirectionTypeOut:
+		return QStringLiteral("out");
+	case Filter::Xml::EDirectionTypeInout:
+		return QStringLiteral("inout");
+	}
+	return QString();
 }
 
 template<>
-Enum<Filter::Xml::EBoolean>::data_type Enum<Filter::Xml::EBoolean>::getData()
+int Enum<Filter::Xml::EDirectionType>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Filter::Xml::EBooleanYes, "yes"))
-			(data_type::value_type(Filter::Xml::EBooleanNo, "no"))
-			(data_type::value_type(Filter::Xml::EBooleanTrue, "true"))
-			(data_type::value_type(Filter::Xml::EBooleanFalse, "false"))
-			(data_type::value_type(Filter::Xml::EBoolean1, "1"))
-			(data_type::value_type(Filter::Xml::EBoolean0, "0"));
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("in"))
+				return Filter::Xml::EDirectionTypeIn;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("out"))
+				return Filter::Xml::EDirectionTypeOut;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("inout"))
+				return Filter::Xml::EDirectionTypeInout;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Filter::Xml::EChoice5674>::data_type Enum<Filter::Xml::EChoice5674>::getData()
+QString Enum<Filter::Xml::EVirYesNo>::getText(Filter::Xml::EVirYesNo value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Filter::Xml::EChoice5674Tcp, "tcp"))
-			(data_type::value_type(Filter::Xml::EChoice5674Udp, "udp"))
-			(data_type::value_type(Filter::Xml::EChoice5674Udplite, "udplite"))
-			(data_type::value_type(Filter::Xml::EChoice5674Esp, "esp"))
-			(data_type::value_type(Filter::Xml::EChoice5674Ah, "ah"))
-			(data_type::value_type(Filter::Xml::EChoice5674Icmp, "icmp"))
-			(data_type::value_type(Filter::Xml::EChoice5674Igmp, "igmp"))
-			(data_type::value_type(Filter::Xml::EChoice5674Sctp, "sctp"))
-			(data_type::value_type(Filter::Xml::EChoice5674Icmpv6, "icmpv6"));
+	switch (value_)
+	{
+	case Filter::Xml::EVirYesNoYes:
+		return QStringLiteral("yes");
+	case Filter::Xml::EVirYesNoNo:
+		return QStringLiteral("no");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Filter::Xml::EVirYesNo>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("no"))
+				return Filter::Xml::EVirYesNoNo;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'y':
+			if (text_ == QLatin1String("yes"))
+				return Filter::Xml::EVirYesNoYes;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Filter::Xml::EChoice5647>::getText(Filter::Xml::EChoice5647 value_)
+{
+	switch (value_)
+	{
+	case Filter::Xml::EChoice5647Arp:
+		return QStringLiteral("arp");
+	case Filter::Xml::EChoice5647Rarp:
+		return QStringLiteral("rarp");
+	case Filter::Xml::EChoice5647Ipv4:
+		return QStringLiteral("ipv4");
+	case Filter::Xml::EChoice5647Ipv6:
+		return QStringLiteral("ipv6");
+	case Filter::Xml::EChoice5647Vlan:
+		return QStringLiteral("vlan");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Filter::Xml::EChoice5647>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("arp"))
+				return Filter::Xml::EChoice5647Arp;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("ipv4"))
+				return Filter::Xml::EChoice5647Ipv4;
+			if (text_ == QLatin1String("ipv6"))
+				return Filter::Xml::EChoice5647Ipv6;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("rarp"))
+				return Filter::Xml::EChoice5647Rarp;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("vlan"))
+				return Filter::Xml::EChoice5647Vlan;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Filter::Xml::EBoolean>::getText(Filter::Xml::EBoolean value_)
+{
+	switch (value_)
+	{
+	case Filter::Xml::EBooleanYes:
+		return QStringLiteral("yes");
+	case Filter::Xml::EBooleanNo:
+		return QStringLiteral("no");
+	case Filter::Xml::EBooleanTrue:
+		return QStringLiteral("true");
+	case Filter::Xml::EBooleanFalse:
+		return QStringLiteral("false");
+	case Filter::Xml::EBoolean1:
+		return QStringLiteral("1");
+	case Filter::Xml::EBoolean0:
+		return QStringLiteral("0");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Filter::Xml::EBoolean>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 1:
+		switch (text_.at(0).unicode())
+		{
+		case '0':
+			if (text_ == QLatin1String("0"))
+				return Filter::Xml::EBoolean0;
+			break;
+		case '1':
+			if (text_ == QLatin1String("1"))
+				return Filter::Xml::EBoolean1;
+			break;
+		}
+		break;
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("no"))
+				return Filter::Xml::EBooleanNo;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'y':
+			if (text_ == QLatin1String("yes"))
+				return Filter::Xml::EBooleanYes;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 't':
+			if (text_ == QLatin1String("true"))
+				return Filter::Xml::EBooleanTrue;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("false"))
+				return Filter::Xml::EBooleanFalse;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Filter::Xml::EChoice5674>::getText(Filter::Xml::EChoice5674 value_)
+{
+	switch (value_)
+	{
+	case Filter::Xml::EChoice5674Tcp:
+		return QStringLiteral("tcp");
+	case Filter::Xml::EChoice5674Udp:
+		return QStringLiteral("udp");
+	case Filter::Xml::EChoice5674Udplite:
+		return QStringLiteral("udplite");
+	case Filter::Xml::EChoice5674Esp:
+		return QStringLiteral("esp");
+	case Filter::Xml::EChoice5674Ah:
+		return QStringLiteral("ah");
+	case Filter::Xml::EChoice5674Icmp:
+		return QStringLiteral("icmp");
+	case Filter::Xml::EChoice5674Igmp:
+		return QStringLiteral("igmp");
+	case Filter::Xml::EChoice5674Sctp:
+		return QStringLiteral("sctp");
+	case Filter::Xml::EChoice5674Icmpv6:
+		return QStringLiteral("icmpv6");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Filter::Xml::EChoice5674>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("ah"))
+				return Filter::Xml::EChoice5674Ah;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'e':
+			if (text_ == QLatin1String("esp"))
+				return Filter::Xml::EChoice5674Esp;
+			break;
+		case 't':
+			if (text_ == QLatin1String("tcp"))
+				return Filter::Xml::EChoice5674Tcp;
+			break;
+		case 'u':
+			if (text_ == QLatin1String("udp"))
+				return Filter::Xml::EChoice5674Udp;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("icmp"))
+				return Filter::Xml::EChoice5674Icmp;
+			if (text_ == QLatin1String("igmp"))
+				return Filter::Xml::EChoice5674Igmp;
+			break;
+		case 's':
+			if (text_ == QLatin1String("sctp"))
+				return Filter::Xml::EChoice5674Sctp;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("icmpv6"))
+				return Filter::Xml::EChoice5674Icmpv6;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("udplite"))
+				return Filter::Xml::EChoice5674Udplite;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 } // namespace Libvirt
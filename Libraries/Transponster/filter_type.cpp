@@ -63,7 +63,8 @@ int Traits<Filter::Xml::FilterNodeAttributes>::parse(Filter::Xml::FilterNodeAttr
 	return output;
 }
 
-int Traits<Filter::Xml::FilterNodeAttributes>::generate(const Filter::Xml::FilterNodeAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::FilterNodeAttributes>::produce(const Filter::Xml::FilterNodeAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -76,6 +77,16 @@ int Traits<Filter::Xml::FilterNodeAttributes>::generate(const Filter::Xml::Filte
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::FilterNodeAttributes>::generate(const Filter::Xml::FilterNodeAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::FilterNodeAttributes>::generate(const Filter::Xml::FilterNodeAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Parameter
 
@@ -109,6 +120,13 @@ bool Parameter::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Parameter::save(QXmlStreamWriter& dst_) const
+{
+	Element<Parameter, Name::Strict<1084> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -125,7 +143,8 @@ int Traits<Filter::Xml::Parameter>::parse(Filter::Xml::Parameter& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Filter::Xml::Parameter>::generate(const Filter::Xml::Parameter& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Parameter>::produce(const Filter::Xml::Parameter& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -136,6 +155,16 @@ int Traits<Filter::Xml::Parameter>::generate(const Filter::Xml::Parameter& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Parameter>::generate(const Filter::Xml::Parameter& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Parameter>::generate(const Filter::Xml::Parameter& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct FilterrefNodeAttributes
 
@@ -169,6 +198,13 @@ bool FilterrefNodeAttributes::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool FilterrefNodeAttributes::save(QXmlStreamWriter& dst_) const
+{
+	Element<FilterrefNodeAttributes, Name::Strict<706> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -185,7 +221,8 @@ int Traits<Filter::Xml::FilterrefNodeAttributes>::parse(Filter::Xml::FilterrefNo
 	return output;
 }
 
-int Traits<Filter::Xml::FilterrefNodeAttributes>::generate(const Filter::Xml::FilterrefNodeAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::FilterrefNodeAttributes>::produce(const Filter::Xml::FilterrefNodeAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFilter(), m.get<0>()))
@@ -196,6 +233,16 @@ int Traits<Filter::Xml::FilterrefNodeAttributes>::generate(const Filter::Xml::Fi
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::FilterrefNodeAttributes>::generate(const Filter::Xml::FilterrefNodeAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::FilterrefNodeAttributes>::generate(const Filter::Xml::FilterrefNodeAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct RuleNodeAttributes
 
@@ -238,7 +285,8 @@ int Traits<Filter::Xml::RuleNodeAttributes>::parse(Filter::Xml::RuleNodeAttribut
 	return output;
 }
 
-int Traits<Filter::Xml::RuleNodeAttributes>::generate(const Filter::Xml::RuleNodeAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::RuleNodeAttributes>::produce(const Filter::Xml::RuleNodeAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAction(), m.get<0>()))
@@ -253,6 +301,16 @@ int Traits<Filter::Xml::RuleNodeAttributes>::generate(const Filter::Xml::RuleNod
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::RuleNodeAttributes>::generate(const Filter::Xml::RuleNodeAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::RuleNodeAttributes>::generate(const Filter::Xml::RuleNodeAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct CommonL2Attributes
 
@@ -291,7 +349,8 @@ int Traits<Filter::Xml::CommonL2Attributes>::parse(Filter::Xml::CommonL2Attribut
 	return output;
 }
 
-int Traits<Filter::Xml::CommonL2Attributes>::generate(const Filter::Xml::CommonL2Attributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::CommonL2Attributes>::produce(const Filter::Xml::CommonL2Attributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSrcmacaddr(), m.get<0>()))
@@ -306,6 +365,16 @@ int Traits<Filter::Xml::CommonL2Attributes>::generate(const Filter::Xml::CommonL
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::CommonL2Attributes>::generate(const Filter::Xml::CommonL2Attributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::CommonL2Attributes>::generate(const Filter::Xml::CommonL2Attributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Mac
 
@@ -339,6 +408,13 @@ bool Mac::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Mac::save(QXmlStreamWriter& dst_) const
+{
+	Element<Mac, Name::Strict<673> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -357,7 +433,8 @@ int Traits<Filter::Xml::Mac>::parse(Filter::Xml::Mac& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Filter::Xml::Mac>::generate(const Filter::Xml::Mac& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Mac>::produce(const Filter::Xml::Mac& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -372,6 +449,16 @@ int Traits<Filter::Xml::Mac>::generate(const Filter::Xml::Mac& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Mac>::generate(const Filter::Xml::Mac& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Mac>::generate(const Filter::Xml::Mac& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct VlanAttributes
 
@@ -408,7 +495,8 @@ int Traits<Filter::Xml::VlanAttributes>::parse(Filter::Xml::VlanAttributes& dst_
 	return output;
 }
 
-int Traits<Filter::Xml::VlanAttributes>::generate(const Filter::Xml::VlanAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::VlanAttributes>::produce(const Filter::Xml::VlanAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getVlanid(), m.get<0>()))
@@ -419,6 +507,16 @@ int Traits<Filter::Xml::VlanAttributes>::generate(const Filter::Xml::VlanAttribu
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::VlanAttributes>::generate(const Filter::Xml::VlanAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::VlanAttributes>::generate(const Filter::Xml::VlanAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Vlan
 
@@ -452,6 +550,13 @@ bool Vlan::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Vlan::save(QXmlStreamWriter& dst_) const
+{
+	Element<Vlan, Name::Strict<205> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -470,7 +575,8 @@ int Traits<Filter::Xml::Vlan>::parse(Filter::Xml::Vlan& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Filter::Xml::Vlan>::generate(const Filter::Xml::Vlan& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Vlan>::produce(const Filter::Xml::Vlan& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -485,6 +591,16 @@ int Traits<Filter::Xml::Vlan>::generate(const Filter::Xml::Vlan& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Vlan>::generate(const Filter::Xml::Vlan& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Vlan>::generate(const Filter::Xml::Vlan& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct SrcmacandmaskAttributes
 
@@ -521,7 +637,8 @@ int Traits<Filter::Xml::SrcmacandmaskAttributes>::parse(Filter::Xml::Srcmacandma
 	return output;
 }
 
-int Traits<Filter::Xml::SrcmacandmaskAttributes>::generate(const Filter::Xml::SrcmacandmaskAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::SrcmacandmaskAttributes>::produce(const Filter::Xml::SrcmacandmaskAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSrcmacaddr(), m.get<0>()))
@@ -532,6 +649,16 @@ int Traits<Filter::Xml::SrcmacandmaskAttributes>::generate(const Filter::Xml::Sr
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::SrcmacandmaskAttributes>::generate(const Filter::Xml::SrcmacandmaskAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::SrcmacandmaskAttributes>::generate(const Filter::Xml::SrcmacandmaskAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct StpAttributes
 
@@ -588,7 +715,8 @@ int Traits<Filter::Xml::StpAttributes>::parse(Filter::Xml::StpAttributes& dst_,
 	return output;
 }
 
-int Traits<Filter::Xml::StpAttributes>::generate(const Filter::Xml::StpAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::StpAttributes>::produce(const Filter::Xml::StpAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -639,6 +767,16 @@ int Traits<Filter::Xml::StpAttributes>::generate(const Filter::Xml::StpAttribute
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::StpAttributes>::generate(const Filter::Xml::StpAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::StpAttributes>::generate(const Filter::Xml::StpAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Stp
 
@@ -672,6 +810,13 @@ bool Stp::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Stp::save(QXmlStreamWriter& dst_) const
+{
+	Element<Stp, Name::Strict<1227> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -690,7 +835,8 @@ int Traits<Filter::Xml::Stp>::parse(Filter::Xml::Stp& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Filter::Xml::Stp>::generate(const Filter::Xml::Stp& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Stp>::produce(const Filter::Xml::Stp& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -705,6 +851,16 @@ int Traits<Filter::Xml::Stp>::generate(const Filter::Xml::Stp& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Stp>::generate(const Filter::Xml::Stp& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Stp>::generate(const Filter::Xml::Stp& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct ArpAttributes
 
@@ -747,7 +903,8 @@ int Traits<Filter::Xml::ArpAttributes>::parse(Filter::Xml::ArpAttributes& dst_,
 	return output;
 }
 
-int Traits<Filter::Xml::ArpAttributes>::generate(const Filter::Xml::ArpAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::ArpAttributes>::produce(const Filter::Xml::ArpAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getArpsrcmacaddr(), m.get<0>()))
@@ -770,6 +927,16 @@ int Traits<Filter::Xml::ArpAttributes>::generate(const Filter::Xml::ArpAttribute
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::ArpAttributes>::generate(const Filter::Xml::ArpAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::ArpAttributes>::generate(const Filter::Xml::ArpAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Arp
 
@@ -803,6 +970,13 @@ bool Arp::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Arp::save(QXmlStreamWriter& dst_) const
+{
+	Element<Arp, Name::Strict<5261> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -821,7 +995,8 @@ int Traits<Filter::Xml::Arp>::parse(Filter::Xml::Arp& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Filter::Xml::Arp>::generate(const Filter::Xml::Arp& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Arp>::produce(const Filter::Xml::Arp& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -836,6 +1011,16 @@ int Traits<Filter::Xml::Arp>::generate(const Filter::Xml::Arp& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Arp>::generate(const Filter::Xml::Arp& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Arp>::generate(const Filter::Xml::Arp& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Rarp
 
@@ -869,6 +1054,13 @@ bool Rarp::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Rarp::save(QXmlStreamWriter& dst_) const
+{
+	Element<Rarp, Name::Strict<5263> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -887,7 +1079,8 @@ int Traits<Filter::Xml::Rarp>::parse(Filter::Xml::Rarp& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Filter::Xml::Rarp>::generate(const Filter::Xml::Rarp& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Rarp>::produce(const Filter::Xml::Rarp& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -902,6 +1095,16 @@ int Traits<Filter::Xml::Rarp>::generate(const Filter::Xml::Rarp& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Rarp>::generate(const Filter::Xml::Rarp& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Rarp>::generate(const Filter::Xml::Rarp& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct CommonIpAttributesP1
 
@@ -941,7 +1144,8 @@ int Traits<Filter::Xml::CommonIpAttributesP1>::parse(Filter::Xml::CommonIpAttrib
 	return output;
 }
 
-int Traits<Filter::Xml::CommonIpAttributesP1>::generate(const Filter::Xml::CommonIpAttributesP1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::CommonIpAttributesP1>::produce(const Filter::Xml::CommonIpAttributesP1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSrcipaddr(), m.get<0>()))
@@ -958,6 +1162,16 @@ int Traits<Filter::Xml::CommonIpAttributesP1>::generate(const Filter::Xml::Commo
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::CommonIpAttributesP1>::generate(const Filter::Xml::CommonIpAttributesP1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::CommonIpAttributesP1>::generate(const Filter::Xml::CommonIpAttributesP1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct CommonPortAttributes
 
@@ -996,7 +1210,8 @@ int Traits<Filter::Xml::CommonPortAttributes>::parse(Filter::Xml::CommonPortAttr
 	return output;
 }
 
-int Traits<Filter::Xml::CommonPortAttributes>::generate(const Filter::Xml::CommonPortAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::CommonPortAttributes>::produce(const Filter::Xml::CommonPortAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSrcportstart(), m.get<0>()))
@@ -1011,6 +1226,16 @@ int Traits<Filter::Xml::CommonPortAttributes>::generate(const Filter::Xml::Commo
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::CommonPortAttributes>::generate(const Filter::Xml::CommonPortAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::CommonPortAttributes>::generate(const Filter::Xml::CommonPortAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Ip
 
@@ -1044,6 +1269,13 @@ bool Ip::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Ip::save(QXmlStreamWriter& dst_) const
+{
+	Element<Ip, Name::Strict<689> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -1065,7 +1297,8 @@ int Traits<Filter::Xml::Ip>::parse(Filter::Xml::Ip& dst_, QStack<QDomElement>& s
 	return output;
 }
 
-int Traits<Filter::Xml::Ip>::generate(const Filter::Xml::Ip& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Ip>::produce(const Filter::Xml::Ip& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -1086,6 +1319,16 @@ int Traits<Filter::Xml::Ip>::generate(const Filter::Xml::Ip& src_, QDomElement&
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Ip>::generate(const Filter::Xml::Ip& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Ip>::generate(const Filter::Xml::Ip& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct CommonIpv6AttributesP1
 
@@ -1125,7 +1368,8 @@ int Traits<Filter::Xml::CommonIpv6AttributesP1>::parse(Filter::Xml::CommonIpv6At
 	return output;
 }
 
-int Traits<Filter::Xml::CommonIpv6AttributesP1>::generate(const Filter::Xml::CommonIpv6AttributesP1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::CommonIpv6AttributesP1>::produce(const Filter::Xml::CommonIpv6AttributesP1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSrcipaddr(), m.get<0>()))
@@ -1142,6 +1386,16 @@ int Traits<Filter::Xml::CommonIpv6AttributesP1>::generate(const Filter::Xml::Com
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::CommonIpv6AttributesP1>::generate(const Filter::Xml::CommonIpv6AttributesP1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::CommonIpv6AttributesP1>::generate(const Filter::Xml::CommonIpv6AttributesP1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Ipv6
 
@@ -1175,6 +1429,13 @@ bool Ipv6::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Ipv6::save(QXmlStreamWriter& dst_) const
+{
+	Element<Ipv6, Name::Strict<1226> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -1195,7 +1456,8 @@ int Traits<Filter::Xml::Ipv6>::parse(Filter::Xml::Ipv6& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Filter::Xml::Ipv6>::generate(const Filter::Xml::Ipv6& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Ipv6>::produce(const Filter::Xml::Ipv6& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -1214,6 +1476,16 @@ int Traits<Filter::Xml::Ipv6>::generate(const Filter::Xml::Ipv6& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Ipv6>::generate(const Filter::Xml::Ipv6& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Ipv6>::generate(const Filter::Xml::Ipv6& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Anonymous5679
 
@@ -1250,7 +1522,8 @@ int Traits<Filter::Xml::Anonymous5679>::parse(Filter::Xml::Anonymous5679& dst_,
 	return output;
 }
 
-int Traits<Filter::Xml::Anonymous5679>::generate(const Filter::Xml::Anonymous5679& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Anonymous5679>::produce(const Filter::Xml::Anonymous5679& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIpset(), m.get<0>()))
@@ -1261,6 +1534,16 @@ int Traits<Filter::Xml::Anonymous5679>::generate(const Filter::Xml::Anonymous567
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Anonymous5679>::generate(const Filter::Xml::Anonymous5679& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Anonymous5679>::generate(const Filter::Xml::Anonymous5679& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct CommonIpAttributesP2
 
@@ -1303,7 +1586,8 @@ int Traits<Filter::Xml::CommonIpAttributesP2>::parse(Filter::Xml::CommonIpAttrib
 	return output;
 }
 
-int Traits<Filter::Xml::CommonIpAttributesP2>::generate(const Filter::Xml::CommonIpAttributesP2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::CommonIpAttributesP2>::produce(const Filter::Xml::CommonIpAttributesP2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSrcipfrom(), m.get<0>()))
@@ -1326,6 +1610,16 @@ int Traits<Filter::Xml::CommonIpAttributesP2>::generate(const Filter::Xml::Commo
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::CommonIpAttributesP2>::generate(const Filter::Xml::CommonIpAttributesP2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::CommonIpAttributesP2>::generate(const Filter::Xml::CommonIpAttributesP2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Tcp
 
@@ -1359,6 +1653,13 @@ bool Tcp::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Tcp::save(QXmlStreamWriter& dst_) const
+{
+	Element<Tcp, Name::Strict<515> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -1380,7 +1681,8 @@ int Traits<Filter::Xml::Tcp>::parse(Filter::Xml::Tcp& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Filter::Xml::Tcp>::generate(const Filter::Xml::Tcp& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Tcp>::produce(const Filter::Xml::Tcp& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -1401,6 +1703,16 @@ int Traits<Filter::Xml::Tcp>::generate(const Filter::Xml::Tcp& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Tcp>::generate(const Filter::Xml::Tcp& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Tcp>::generate(const Filter::Xml::Tcp& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Udp
 
@@ -1434,6 +1746,13 @@ bool Udp::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Udp::save(QXmlStreamWriter& dst_) const
+{
+	Element<Udp, Name::Strict<831> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -1454,7 +1773,8 @@ int Traits<Filter::Xml::Udp>::parse(Filter::Xml::Udp& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Filter::Xml::Udp>::generate(const Filter::Xml::Udp& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Udp>::produce(const Filter::Xml::Udp& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -1473,6 +1793,16 @@ int Traits<Filter::Xml::Udp>::generate(const Filter::Xml::Udp& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Udp>::generate(const Filter::Xml::Udp& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Udp>::generate(const Filter::Xml::Udp& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Sctp
 
@@ -1506,6 +1836,13 @@ bool Sctp::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Sctp::save(QXmlStreamWriter& dst_) const
+{
+	Element<Sctp, Name::Strict<5272> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -1526,7 +1863,8 @@ int Traits<Filter::Xml::Sctp>::parse(Filter::Xml::Sctp& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Filter::Xml::Sctp>::generate(const Filter::Xml::Sctp& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Sctp>::produce(const Filter::Xml::Sctp& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -1545,6 +1883,16 @@ int Traits<Filter::Xml::Sctp>::generate(const Filter::Xml::Sctp& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Sctp>::generate(const Filter::Xml::Sctp& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Sctp>::generate(const Filter::Xml::Sctp& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct IcmpAttributes
 
@@ -1581,7 +1929,8 @@ int Traits<Filter::Xml::IcmpAttributes>::parse(Filter::Xml::IcmpAttributes& dst_
 	return output;
 }
 
-int Traits<Filter::Xml::IcmpAttributes>::generate(const Filter::Xml::IcmpAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::IcmpAttributes>::produce(const Filter::Xml::IcmpAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -1592,6 +1941,16 @@ int Traits<Filter::Xml::IcmpAttributes>::generate(const Filter::Xml::IcmpAttribu
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::IcmpAttributes>::generate(const Filter::Xml::IcmpAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::IcmpAttributes>::generate(const Filter::Xml::IcmpAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Icmp
 
@@ -1625,6 +1984,13 @@ bool Icmp::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Icmp::save(QXmlStreamWriter& dst_) const
+{
+	Element<Icmp, Name::Strict<5273> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -1645,7 +2011,8 @@ int Traits<Filter::Xml::Icmp>::parse(Filter::Xml::Icmp& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Filter::Xml::Icmp>::generate(const Filter::Xml::Icmp& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Icmp>::produce(const Filter::Xml::Icmp& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -1664,6 +2031,16 @@ int Traits<Filter::Xml::Icmp>::generate(const Filter::Xml::Icmp& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Icmp>::generate(const Filter::Xml::Icmp& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Icmp>::generate(const Filter::Xml::Icmp& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Igmp
 
@@ -1697,6 +2074,13 @@ bool Igmp::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Igmp::save(QXmlStreamWriter& dst_) const
+{
+	Element<Igmp, Name::Strict<5275> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -1716,7 +2100,8 @@ int Traits<Filter::Xml::Igmp>::parse(Filter::Xml::Igmp& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Filter::Xml::Igmp>::generate(const Filter::Xml::Igmp& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Igmp>::produce(const Filter::Xml::Igmp& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -1733,6 +2118,16 @@ int Traits<Filter::Xml::Igmp>::generate(const Filter::Xml::Igmp& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Igmp>::generate(const Filter::Xml::Igmp& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Igmp>::generate(const Filter::Xml::Igmp& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct All
 
@@ -1766,6 +2161,13 @@ bool All::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool All::save(QXmlStreamWriter& dst_) const
+{
+	Element<All, Name::Strict<765> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -1785,7 +2187,8 @@ int Traits<Filter::Xml::All>::parse(Filter::Xml::All& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Filter::Xml::All>::generate(const Filter::Xml::All& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::All>::produce(const Filter::Xml::All& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -1802,6 +2205,16 @@ int Traits<Filter::Xml::All>::generate(const Filter::Xml::All& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::All>::generate(const Filter::Xml::All& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::All>::generate(const Filter::Xml::All& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Esp
 
@@ -1835,6 +2248,13 @@ bool Esp::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Esp::save(QXmlStreamWriter& dst_) const
+{
+	Element<Esp, Name::Strict<5276> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -1854,7 +2274,8 @@ int Traits<Filter::Xml::Esp>::parse(Filter::Xml::Esp& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Filter::Xml::Esp>::generate(const Filter::Xml::Esp& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Esp>::produce(const Filter::Xml::Esp& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -1871,6 +2292,16 @@ int Traits<Filter::Xml::Esp>::generate(const Filter::Xml::Esp& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Esp>::generate(const Filter::Xml::Esp& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Esp>::generate(const Filter::Xml::Esp& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Ah
 
@@ -1904,6 +2335,13 @@ bool Ah::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Ah::save(QXmlStreamWriter& dst_) const
+{
+	Element<Ah, Name::Strict<5277> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -1923,7 +2361,8 @@ int Traits<Filter::Xml::Ah>::parse(Filter::Xml::Ah& dst_, QStack<QDomElement>& s
 	return output;
 }
 
-int Traits<Filter::Xml::Ah>::generate(const Filter::Xml::Ah& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Ah>::produce(const Filter::Xml::Ah& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -1940,6 +2379,16 @@ int Traits<Filter::Xml::Ah>::generate(const Filter::Xml::Ah& src_, QDomElement&
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Ah>::generate(const Filter::Xml::Ah& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Ah>::generate(const Filter::Xml::Ah& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Udplite
 
@@ -1973,6 +2422,13 @@ bool Udplite::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Udplite::save(QXmlStreamWriter& dst_) const
+{
+	Element<Udplite, Name::Strict<5278> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -1992,7 +2448,8 @@ int Traits<Filter::Xml::Udplite>::parse(Filter::Xml::Udplite& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Filter::Xml::Udplite>::generate(const Filter::Xml::Udplite& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Udplite>::produce(const Filter::Xml::Udplite& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -2009,6 +2466,16 @@ int Traits<Filter::Xml::Udplite>::generate(const Filter::Xml::Udplite& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Udplite>::generate(const Filter::Xml::Udplite& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Udplite>::generate(const Filter::Xml::Udplite& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct CommonIpv6AttributesP2
 
@@ -2048,7 +2515,8 @@ int Traits<Filter::Xml::CommonIpv6AttributesP2>::parse(Filter::Xml::CommonIpv6At
 	return output;
 }
 
-int Traits<Filter::Xml::CommonIpv6AttributesP2>::generate(const Filter::Xml::CommonIpv6AttributesP2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::CommonIpv6AttributesP2>::produce(const Filter::Xml::CommonIpv6AttributesP2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSrcipfrom(), m.get<0>()))
@@ -2065,6 +2533,16 @@ int Traits<Filter::Xml::CommonIpv6AttributesP2>::generate(const Filter::Xml::Com
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::CommonIpv6AttributesP2>::generate(const Filter::Xml::CommonIpv6AttributesP2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::CommonIpv6AttributesP2>::generate(const Filter::Xml::CommonIpv6AttributesP2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct TcpIpv6
 
@@ -2098,6 +2576,13 @@ bool TcpIpv6::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool TcpIpv6::save(QXmlStreamWriter& dst_) const
+{
+	Element<TcpIpv6, Name::Strict<5279> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -2119,7 +2604,8 @@ int Traits<Filter::Xml::TcpIpv6>::parse(Filter::Xml::TcpIpv6& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Filter::Xml::TcpIpv6>::generate(const Filter::Xml::TcpIpv6& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::TcpIpv6>::produce(const Filter::Xml::TcpIpv6& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -2140,6 +2626,16 @@ int Traits<Filter::Xml::TcpIpv6>::generate(const Filter::Xml::TcpIpv6& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::TcpIpv6>::generate(const Filter::Xml::TcpIpv6& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::TcpIpv6>::generate(const Filter::Xml::TcpIpv6& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct UdpIpv6
 
@@ -2173,6 +2669,13 @@ bool UdpIpv6::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool UdpIpv6::save(QXmlStreamWriter& dst_) const
+{
+	Element<UdpIpv6, Name::Strict<5281> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -2193,7 +2696,8 @@ int Traits<Filter::Xml::UdpIpv6>::parse(Filter::Xml::UdpIpv6& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Filter::Xml::UdpIpv6>::generate(const Filter::Xml::UdpIpv6& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::UdpIpv6>::produce(const Filter::Xml::UdpIpv6& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -2212,6 +2716,16 @@ int Traits<Filter::Xml::UdpIpv6>::generate(const Filter::Xml::UdpIpv6& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::UdpIpv6>::generate(const Filter::Xml::UdpIpv6& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::UdpIpv6>::generate(const Filter::Xml::UdpIpv6& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct SctpIpv6
 
@@ -2245,6 +2759,13 @@ bool SctpIpv6::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool SctpIpv6::save(QXmlStreamWriter& dst_) const
+{
+	Element<SctpIpv6, Name::Strict<5282> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -2265,7 +2786,8 @@ int Traits<Filter::Xml::SctpIpv6>::parse(Filter::Xml::SctpIpv6& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Filter::Xml::SctpIpv6>::generate(const Filter::Xml::SctpIpv6& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::SctpIpv6>::produce(const Filter::Xml::SctpIpv6& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -2284,6 +2806,16 @@ int Traits<Filter::Xml::SctpIpv6>::generate(const Filter::Xml::SctpIpv6& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::SctpIpv6>::generate(const Filter::Xml::SctpIpv6& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::SctpIpv6>::generate(const Filter::Xml::SctpIpv6& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Icmpv6
 
@@ -2317,6 +2849,13 @@ bool Icmpv6::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Icmpv6::save(QXmlStreamWriter& dst_) const
+{
+	Element<Icmpv6, Name::Strict<5283> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -2337,7 +2876,8 @@ int Traits<Filter::Xml::Icmpv6>::parse(Filter::Xml::Icmpv6& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Filter::Xml::Icmpv6>::generate(const Filter::Xml::Icmpv6& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Icmpv6>::produce(const Filter::Xml::Icmpv6& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -2356,6 +2896,16 @@ int Traits<Filter::Xml::Icmpv6>::generate(const Filter::Xml::Icmpv6& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Icmpv6>::generate(const Filter::Xml::Icmpv6& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Icmpv6>::generate(const Filter::Xml::Icmpv6& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct AllIpv6
 
@@ -2389,6 +2939,13 @@ bool AllIpv6::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool AllIpv6::save(QXmlStreamWriter& dst_) const
+{
+	Element<AllIpv6, Name::Strict<5284> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -2408,7 +2965,8 @@ int Traits<Filter::Xml::AllIpv6>::parse(Filter::Xml::AllIpv6& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Filter::Xml::AllIpv6>::generate(const Filter::Xml::AllIpv6& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::AllIpv6>::produce(const Filter::Xml::AllIpv6& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -2425,6 +2983,16 @@ int Traits<Filter::Xml::AllIpv6>::generate(const Filter::Xml::AllIpv6& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::AllIpv6>::generate(const Filter::Xml::AllIpv6& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::AllIpv6>::generate(const Filter::Xml::AllIpv6& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct EspIpv6
 
@@ -2458,6 +3026,13 @@ bool EspIpv6::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool EspIpv6::save(QXmlStreamWriter& dst_) const
+{
+	Element<EspIpv6, Name::Strict<5285> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -2477,7 +3052,8 @@ int Traits<Filter::Xml::EspIpv6>::parse(Filter::Xml::EspIpv6& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Filter::Xml::EspIpv6>::generate(const Filter::Xml::EspIpv6& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::EspIpv6>::produce(const Filter::Xml::EspIpv6& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -2494,6 +3070,16 @@ int Traits<Filter::Xml::EspIpv6>::generate(const Filter::Xml::EspIpv6& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::EspIpv6>::generate(const Filter::Xml::EspIpv6& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::EspIpv6>::generate(const Filter::Xml::EspIpv6& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct AhIpv6
 
@@ -2527,6 +3113,13 @@ bool AhIpv6::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool AhIpv6::save(QXmlStreamWriter& dst_) const
+{
+	Element<AhIpv6, Name::Strict<5286> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -2546,7 +3139,8 @@ int Traits<Filter::Xml::AhIpv6>::parse(Filter::Xml::AhIpv6& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Filter::Xml::AhIpv6>::generate(const Filter::Xml::AhIpv6& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::AhIpv6>::produce(const Filter::Xml::AhIpv6& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -2563,6 +3157,16 @@ int Traits<Filter::Xml::AhIpv6>::generate(const Filter::Xml::AhIpv6& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::AhIpv6>::generate(const Filter::Xml::AhIpv6& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::AhIpv6>::generate(const Filter::Xml::AhIpv6& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct UdpliteIpv6
 
@@ -2596,6 +3200,13 @@ bool UdpliteIpv6::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool UdpliteIpv6::save(QXmlStreamWriter& dst_) const
+{
+	Element<UdpliteIpv6, Name::Strict<5287> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -2615,7 +3226,8 @@ int Traits<Filter::Xml::UdpliteIpv6>::parse(Filter::Xml::UdpliteIpv6& dst_, QSta
 	return output;
 }
 
-int Traits<Filter::Xml::UdpliteIpv6>::generate(const Filter::Xml::UdpliteIpv6& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::UdpliteIpv6>::produce(const Filter::Xml::UdpliteIpv6& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMatch(), m.get<0>()))
@@ -2632,6 +3244,16 @@ int Traits<Filter::Xml::UdpliteIpv6>::generate(const Filter::Xml::UdpliteIpv6& s
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::UdpliteIpv6>::generate(const Filter::Xml::UdpliteIpv6& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::UdpliteIpv6>::generate(const Filter::Xml::UdpliteIpv6& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Rule
 
@@ -2665,6 +3287,13 @@ bool Rule::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Rule::save(QXmlStreamWriter& dst_) const
+{
+	Element<Rule, Name::Strict<5252> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -2704,7 +3333,8 @@ int Traits<Filter::Xml::Rule>::parse(Filter::Xml::Rule& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Filter::Xml::Rule>::generate(const Filter::Xml::Rule& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Rule>::produce(const Filter::Xml::Rule& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getRuleNodeAttributes(), m.get<0>()))
@@ -2761,6 +3391,16 @@ int Traits<Filter::Xml::Rule>::generate(const Filter::Xml::Rule& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Rule>::generate(const Filter::Xml::Rule& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Rule>::generate(const Filter::Xml::Rule& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Filter
 
@@ -2794,6 +3434,13 @@ bool Filter::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Filter::save(QXmlStreamWriter& dst_) const
+{
+	Element<Filter, Name::Strict<764> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Filter
@@ -2811,7 +3458,8 @@ int Traits<Filter::Xml::Filter>::parse(Filter::Xml::Filter& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Filter::Xml::Filter>::generate(const Filter::Xml::Filter& src_, QDomElement& dst_)
+template<class D>
+int Traits<Filter::Xml::Filter>::produce(const Filter::Xml::Filter& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFilterNodeAttributes(), m.get<0>()))
@@ -2824,4 +3472,14 @@ int Traits<Filter::Xml::Filter>::generate(const Filter::Xml::Filter& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Filter::Xml::Filter>::generate(const Filter::Xml::Filter& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Filter::Xml::Filter>::generate(const Filter::Xml::Filter& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 } // namespace Libvirt
@@ -106,6 +106,7 @@ struct Parameter
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PFilterParamName::value_type m_name;
@@ -143,6 +144,7 @@ struct FilterrefNodeAttributes
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PFilter::value_type m_filter;
@@ -306,6 +308,7 @@ struct Mac
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -397,6 +400,7 @@ struct Vlan
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -704,6 +708,7 @@ struct Stp
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -849,6 +854,7 @@ struct Arp
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -904,6 +910,7 @@ struct Rarp
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -1100,6 +1107,7 @@ struct Ip
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -1237,6 +1245,7 @@ struct Ipv6
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -1444,6 +1453,7 @@ struct Tcp
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -1518,6 +1528,7 @@ struct Udp
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -1591,6 +1602,7 @@ struct Sctp
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -1700,6 +1712,7 @@ struct Icmp
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -1765,6 +1778,7 @@ struct Igmp
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -1829,6 +1843,7 @@ struct All
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -1893,6 +1908,7 @@ struct Esp
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -1957,6 +1973,7 @@ struct Ah
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -2021,6 +2038,7 @@ struct Udplite
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -2164,6 +2182,7 @@ struct TcpIpv6
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -2238,6 +2257,7 @@ struct UdpIpv6
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -2311,6 +2331,7 @@ struct SctpIpv6
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -2384,6 +2405,7 @@ struct Icmpv6
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -2449,6 +2471,7 @@ struct AllIpv6
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -2513,6 +2536,7 @@ struct EspIpv6
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -2577,6 +2601,7 @@ struct AhIpv6
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -2641,6 +2666,7 @@ struct UdpliteIpv6
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_match;
@@ -2865,6 +2891,7 @@ struct Rule
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	RuleNodeAttributes m_ruleNodeAttributes;
@@ -2946,6 +2973,7 @@ struct Filter
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	FilterNodeAttributes m_filterNodeAttributes;
@@ -2966,6 +2994,10 @@ struct Traits<Filter::Xml::FilterNodeAttributes>
 
 	static int parse(Filter::Xml::FilterNodeAttributes& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::FilterNodeAttributes& , QDomElement& );
+	static int generate(const Filter::Xml::FilterNodeAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::FilterNodeAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2978,6 +3010,10 @@ struct Traits<Filter::Xml::Parameter>
 
 	static int parse(Filter::Xml::Parameter& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Parameter& , QDomElement& );
+	static int generate(const Filter::Xml::Parameter& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Parameter& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2990,6 +3026,10 @@ struct Traits<Filter::Xml::FilterrefNodeAttributes>
 
 	static int parse(Filter::Xml::FilterrefNodeAttributes& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::FilterrefNodeAttributes& , QDomElement& );
+	static int generate(const Filter::Xml::FilterrefNodeAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::FilterrefNodeAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3002,6 +3042,10 @@ struct Traits<Filter::Xml::RuleNodeAttributes>
 
 	static int parse(Filter::Xml::RuleNodeAttributes& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::RuleNodeAttributes& , QDomElement& );
+	static int generate(const Filter::Xml::RuleNodeAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::RuleNodeAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3014,6 +3058,10 @@ struct Traits<Filter::Xml::CommonL2Attributes>
 
 	static int parse(Filter::Xml::CommonL2Attributes& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::CommonL2Attributes& , QDomElement& );
+	static int generate(const Filter::Xml::CommonL2Attributes& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::CommonL2Attributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3026,6 +3074,10 @@ struct Traits<Filter::Xml::Mac>
 
 	static int parse(Filter::Xml::Mac& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Mac& , QDomElement& );
+	static int generate(const Filter::Xml::Mac& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Mac& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3038,6 +3090,10 @@ struct Traits<Filter::Xml::VlanAttributes>
 
 	static int parse(Filter::Xml::VlanAttributes& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::VlanAttributes& , QDomElement& );
+	static int generate(const Filter::Xml::VlanAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::VlanAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3050,6 +3106,10 @@ struct Traits<Filter::Xml::Vlan>
 
 	static int parse(Filter::Xml::Vlan& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Vlan& , QDomElement& );
+	static int generate(const Filter::Xml::Vlan& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Vlan& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3062,6 +3122,10 @@ struct Traits<Filter::Xml::SrcmacandmaskAttributes>
 
 	static int parse(Filter::Xml::SrcmacandmaskAttributes& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::SrcmacandmaskAttributes& , QDomElement& );
+	static int generate(const Filter::Xml::SrcmacandmaskAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::SrcmacandmaskAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3074,6 +3138,10 @@ struct Traits<Filter::Xml::StpAttributes>
 
 	static int parse(Filter::Xml::StpAttributes& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::StpAttributes& , QDomElement& );
+	static int generate(const Filter::Xml::StpAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::StpAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3086,6 +3154,10 @@ struct Traits<Filter::Xml::Stp>
 
 	static int parse(Filter::Xml::Stp& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Stp& , QDomElement& );
+	static int generate(const Filter::Xml::Stp& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Stp& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3098,6 +3170,10 @@ struct Traits<Filter::Xml::ArpAttributes>
 
 	static int parse(Filter::Xml::ArpAttributes& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::ArpAttributes& , QDomElement& );
+	static int generate(const Filter::Xml::ArpAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::ArpAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3110,6 +3186,10 @@ struct Traits<Filter::Xml::Arp>
 
 	static int parse(Filter::Xml::Arp& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Arp& , QDomElement& );
+	static int generate(const Filter::Xml::Arp& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Arp& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3122,6 +3202,10 @@ struct Traits<Filter::Xml::Rarp>
 
 	static int parse(Filter::Xml::Rarp& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Rarp& , QDomElement& );
+	static int generate(const Filter::Xml::Rarp& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Rarp& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3134,6 +3218,10 @@ struct Traits<Filter::Xml::CommonIpAttributesP1>
 
 	static int parse(Filter::Xml::CommonIpAttributesP1& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::CommonIpAttributesP1& , QDomElement& );
+	static int generate(const Filter::Xml::CommonIpAttributesP1& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::CommonIpAttributesP1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3146,6 +3234,10 @@ struct Traits<Filter::Xml::CommonPortAttributes>
 
 	static int parse(Filter::Xml::CommonPortAttributes& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::CommonPortAttributes& , QDomElement& );
+	static int generate(const Filter::Xml::CommonPortAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::CommonPortAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3158,6 +3250,10 @@ struct Traits<Filter::Xml::Ip>
 
 	static int parse(Filter::Xml::Ip& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Ip& , QDomElement& );
+	static int generate(const Filter::Xml::Ip& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Ip& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3170,6 +3266,10 @@ struct Traits<Filter::Xml::CommonIpv6AttributesP1>
 
 	static int parse(Filter::Xml::CommonIpv6AttributesP1& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::CommonIpv6AttributesP1& , QDomElement& );
+	static int generate(const Filter::Xml::CommonIpv6AttributesP1& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::CommonIpv6AttributesP1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3182,6 +3282,10 @@ struct Traits<Filter::Xml::Ipv6>
 
 	static int parse(Filter::Xml::Ipv6& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Ipv6& , QDomElement& );
+	static int generate(const Filter::Xml::Ipv6& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Ipv6& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3194,6 +3298,10 @@ struct Traits<Filter::Xml::Anonymous5679>
 
 	static int parse(Filter::Xml::Anonymous5679& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Anonymous5679& , QDomElement& );
+	static int generate(const Filter::Xml::Anonymous5679& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Anonymous5679& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3206,6 +3314,10 @@ struct Traits<Filter::Xml::CommonIpAttributesP2>
 
 	static int parse(Filter::Xml::CommonIpAttributesP2& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::CommonIpAttributesP2& , QDomElement& );
+	static int generate(const Filter::Xml::CommonIpAttributesP2& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::CommonIpAttributesP2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3218,6 +3330,10 @@ struct Traits<Filter::Xml::Tcp>
 
 	static int parse(Filter::Xml::Tcp& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Tcp& , QDomElement& );
+	static int generate(const Filter::Xml::Tcp& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Tcp& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3230,6 +3346,10 @@ struct Traits<Filter::Xml::Udp>
 
 	static int parse(Filter::Xml::Udp& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Udp& , QDomElement& );
+	static int generate(const Filter::Xml::Udp& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Udp& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3242,6 +3362,10 @@ struct Traits<Filter::Xml::Sctp>
 
 	static int parse(Filter::Xml::Sctp& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Sctp& , QDomElement& );
+	static int generate(const Filter::Xml::Sctp& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Sctp& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3254,6 +3378,10 @@ struct Traits<Filter::Xml::IcmpAttributes>
 
 	static int parse(Filter::Xml::IcmpAttributes& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::IcmpAttributes& , QDomElement& );
+	static int generate(const Filter::Xml::IcmpAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::IcmpAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3266,6 +3394,10 @@ struct Traits<Filter::Xml::Icmp>
 
 	static int parse(Filter::Xml::Icmp& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Icmp& , QDomElement& );
+	static int generate(const Filter::Xml::Icmp& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Icmp& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3278,6 +3410,10 @@ struct Traits<Filter::Xml::Igmp>
 
 	static int parse(Filter::Xml::Igmp& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Igmp& , QDomElement& );
+	static int generate(const Filter::Xml::Igmp& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Igmp& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3290,6 +3426,10 @@ struct Traits<Filter::Xml::All>
 
 	static int parse(Filter::Xml::All& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::All& , QDomElement& );
+	static int generate(const Filter::Xml::All& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::All& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3302,6 +3442,10 @@ struct Traits<Filter::Xml::Esp>
 
 	static int parse(Filter::Xml::Esp& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Esp& , QDomElement& );
+	static int generate(const Filter::Xml::Esp& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Esp& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3314,6 +3458,10 @@ struct Traits<Filter::Xml::Ah>
 
 	static int parse(Filter::Xml::Ah& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Ah& , QDomElement& );
+	static int generate(const Filter::Xml::Ah& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Ah& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3326,6 +3474,10 @@ struct Traits<Filter::Xml::Udplite>
 
 	static int parse(Filter::Xml::Udplite& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Udplite& , QDomElement& );
+	static int generate(const Filter::Xml::Udplite& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Udplite& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3338,6 +3490,10 @@ struct Traits<Filter::Xml::CommonIpv6AttributesP2>
 
 	static int parse(Filter::Xml::CommonIpv6AttributesP2& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::CommonIpv6AttributesP2& , QDomElement& );
+	static int generate(const Filter::Xml::CommonIpv6AttributesP2& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::CommonIpv6AttributesP2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3350,6 +3506,10 @@ struct Traits<Filter::Xml::TcpIpv6>
 
 	static int parse(Filter::Xml::TcpIpv6& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::TcpIpv6& , QDomElement& );
+	static int generate(const Filter::Xml::TcpIpv6& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::TcpIpv6& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3362,6 +3522,10 @@ struct Traits<Filter::Xml::UdpIpv6>
 
 	static int parse(Filter::Xml::UdpIpv6& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::UdpIpv6& , QDomElement& );
+	static int generate(const Filter::Xml::UdpIpv6& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::UdpIpv6& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3374,6 +3538,10 @@ struct Traits<Filter::Xml::SctpIpv6>
 
 	static int parse(Filter::Xml::SctpIpv6& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::SctpIpv6& , QDomElement& );
+	static int generate(const Filter::Xml::SctpIpv6& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::SctpIpv6& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3386,6 +3554,10 @@ struct Traits<Filter::Xml::Icmpv6>
 
 	static int parse(Filter::Xml::Icmpv6& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Icmpv6& , QDomElement& );
+	static int generate(const Filter::Xml::Icmpv6& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Icmpv6& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3398,6 +3570,10 @@ struct Traits<Filter::Xml::AllIpv6>
 
 	static int parse(Filter::Xml::AllIpv6& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::AllIpv6& , QDomElement& );
+	static int generate(const Filter::Xml::AllIpv6& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::AllIpv6& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3410,6 +3586,10 @@ struct Traits<Filter::Xml::EspIpv6>
 
 	static int parse(Filter::Xml::EspIpv6& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::EspIpv6& , QDomElement& );
+	static int generate(const Filter::Xml::EspIpv6& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::EspIpv6& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3422,6 +3602,10 @@ struct Traits<Filter::Xml::AhIpv6>
 
 	static int parse(Filter::Xml::AhIpv6& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::AhIpv6& , QDomElement& );
+	static int generate(const Filter::Xml::AhIpv6& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::AhIpv6& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3434,6 +3618,10 @@ struct Traits<Filter::Xml::UdpliteIpv6>
 
 	static int parse(Filter::Xml::UdpliteIpv6& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::UdpliteIpv6& , QDomElement& );
+	static int generate(const Filter::Xml::UdpliteIpv6& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::UdpliteIpv6& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3446,6 +3634,10 @@ struct Traits<Filter::Xml::Rule>
 
 	static int parse(Filter::Xml::Rule& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Rule& , QDomElement& );
+	static int generate(const Filter::Xml::Rule& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Rule& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3458,6 +3650,10 @@ struct Traits<Filter::Xml::Filter>
 
 	static int parse(Filter::Xml::Filter& , QStack<QDomElement>& );
 	static int generate(const Filter::Xml::Filter& , QDomElement& );
+	static int generate(const Filter::Xml::Filter& , Stream& );
+
+	template<class D>
+	static int produce(const Filter::Xml::Filter& , D& );
 };
 
 } // namespace Libvirt
@@ -23,78 +23,396 @@
  */
 
 #include "iface_enum.h"
-#include <boost/assign/list_of.hpp>
 
-namespace ba = boost::assign;
 namespace Libvirt
 {
 template<>
-Enum<Iface::Xml::EMode>::data_type Enum<Iface::Xml::EMode>::getData()
+QString Enum<Iface::Xml::EMode>::getText(Iface::Xml::EMode value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Iface::Xml::EModeOnboot, "onboot"))
-			(data_type::value_type(Iface::Xml::EModeNone, "none"))
-			(data_type::value_type(Iface::Xml::EModeHotplug, "hotplug"));
+	switch (value_)
+	{
+	case Iface::Xml::EModeOnboot:
+		return QStringLiteral("onboot");
+	case Iface::Xml::EModeNone:
+		return QStringLiteral("none");
+	case Iface::Xml::EModeHotplug:
+		return QStringLiteral("hotplug");
+	}
+	return QString();
 }
 
 template<>
-Enum<Iface::Xml::EState>::data_type Enum<Iface::Xml::EState>::getData()
+int Enum<Iface::Xml::EMode>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Iface::Xml::EStateUnknown, "unknown"))
-			(data_type::value_type(Iface::Xml::EStateNotpresent, "notpresent"))
-			(data_type::value_type(Iface::Xml::EStateDown, "down"))
-			(data_type::value_type(Iface::Xml::EStateLowerlayerdown, "lowerlayerdown"))
-			(data_type::value_type(Iface::Xml::EStateTesting, "testing"))
-			(data_type::value_type(Iface::Xml::EStateDormant, "dormant"))
-			(data_type::value_type(Iface::Xml::EStateUp, "up"));
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("none"))
+				return Iface::Xml::EModeNone;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("onboot"))
+				return Iface::Xml::EModeOnboot;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("hotplug"))
+				return Iface::Xml::EModeHotplug;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Iface::Xml::EVirYesNo>::data_type Enum<Iface::Xml::EVirYesNo>::getData()
+QString Enum<Iface::Xml::EState>::getText(Iface::Xml::EState value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Iface::Xml::EVirYesNoYes, "yes"))
-			(data_type::value_type(Iface::Xml::EVirYesNoNo, "no"));
+	switch (value_)
+	{
+	case Iface::Xml::EStateUnknown:
+		return QStringLiteral("unknown");
+	case Iface::Xml::EStateNotpresent:
+		return QStringLiteral("notpresent");
+	case Iface::Xml::EStateDown:
+		return QStringLiteral("down");
+	case Iface::Xml::EStateLowerlayerdown:
+		return QStringLiteral("lowerlayerdown");
+	case Iface::Xml::EStateTesting:
+		return QStringLiteral("testing");
+	case Iface::Xml::EStateDormant:
+		return QStringLiteral("dormant");
+	case Iface::Xml::EStateUp:
+		return QStringLiteral("up");
+	}
+	return QString();
 }
 
 template<>
-Enum<Iface::Xml::EVirOnOff>::data_type Enum<Iface::Xml::EVirOnOff>::getData()
+int Enum<Iface::Xml::EState>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Iface::Xml::EVirOnOffOn, "on"))
-			(data_type::value_type(Iface::Xml::EVirOnOffOff, "off"));
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("up"))
+				return Iface::Xml::EStateUp;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("down"))
+				return Iface::Xml::EStateDown;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("dormant"))
+				return Iface::Xml::EStateDormant;
+			break;
+		case 't':
+			if (text_ == QLatin1String("testing"))
+				return Iface::Xml::EStateTesting;
+			break;
+		case 'u':
+			if (text_ == QLatin1String("unknown"))
+				return Iface::Xml::EStateUnknown;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("notpresent"))
+				return Iface::Xml::EStateNotpresent;
+			break;
+		}
+		break;
+	case 14:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("lowerlayerdown"))
+				return Iface::Xml::EStateLowerlayerdown;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Iface::Xml::EMode1>::data_type Enum<Iface::Xml::EMode1>::getData()
+QString Enum<Iface::Xml::EVirYesNo>::getText(Iface::Xml::EVirYesNo value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Iface::Xml::EMode1BalanceRr, "balance-rr"))
-			(data_type::value_type(Iface::Xml::EMode1ActiveBackup, "active-backup"))
-			(data_type::value_type(Iface::Xml::EMode1BalanceXor, "balance-xor"))
-			(data_type::value_type(Iface::Xml::EMode1Broadcast, "broadcast"))
-			(data_type::value_type(Iface::Xml::EMode18023ad, "802.3ad"))
-			(data_type::value_type(Iface::Xml::EMode1BalanceTlb, "balance-tlb"))
-			(data_type::value_type(Iface::Xml::EMode1BalanceAlb, "balance-alb"));
+	switch (value_)
+	{
+	case Iface::Xml::EVirYesNoYes:
+		return QStringLiteral("yes");
+	case Iface::Xml::EVirYesNoNo:
+		return QStringLiteral("no");
+	}
+	return QString();
 }
 
 template<>
-Enum<Iface::Xml::ECarrier>::data_type Enum<Iface::Xml::ECarrier>::getData()
+int Enum<Iface::Xml::EVirYesNo>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Iface::Xml::ECarrierIoctl, "ioctl"))
-			(data_type::value_type(Iface::Xml::ECarrierNetif, "netif"));
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("no"))
+				return Iface::Xml::EVirYesNoNo;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'y':
+			if (text_ == QLatin1String("yes"))
+				return Iface::Xml::EVirYesNoYes;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Iface::Xml::EValidate>::data_type Enum<Iface::Xml::EValidate>::getData()
+QString Enum<Iface::Xml::EVirOnOff>::getText(Iface::Xml::EVirOnOff value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Iface::Xml::EValidateNone, "none"))
-			(data_type::value_type(Iface::Xml::EValidateActive, "active"))
-			(data_type::value_type(Iface::Xml::EValidateBackup, "backup"))
-			(data_type::value_type(Iface::Xml::EValidateAll, "all"));
+	switch (value_)
+	{
+	case Iface::Xml::EVirOnOffOn:
+		return QStringLiteral("on");
+	case Iface::Xml::EVirOnOffOff:
+		return QStringLiteral("off");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Iface::Xml::EVirOnOff>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("on"))
+				return Iface::Xml::EVirOnOffOn;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("off"))
+				return Iface::Xml::EVirOnOffOff;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Iface::Xml::EMode1>::getText(Iface::Xml::EMode1 value_)
+{
+	switch (value_)
+	{
+	case Iface::Xml::EMode1BalanceRr:
+		return QStringLiteral("balance-rr");
+	case Iface::Xml::EMode1ActiveBackup:
+		return QStringLiteral("active-backup");
+	case Iface::Xml::EMode1BalanceXor:
+		return QStringLiteral("balance-xor");
+	case Iface::Xml::EMode1Broadcast:
+		return QStringLiteral("broadcast");
+	case Iface::Xml::EMode18023ad:
+		return QStringLiteral("802.3ad");
+	case Iface::Xml::EMode1BalanceTlb:
+		return QStringLiteral("balance-tlb");
+	case Iface::Xml::EMode1BalanceAlb:
+		return QStringLiteral("balance-alb");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Iface::Xml::EMode1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case '8':
+			if (text_ == QLatin1String("802.3ad"))
+				return Iface::Xml::EMode18023ad;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("broadcast"))
+				return Iface::Xml::EMode1Broadcast;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("balance-rr"))
+				return Iface::Xml::EMode1BalanceRr;
+			break;
+		}
+		break;
+	case 11:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("balance-xor"))
+				return Iface::Xml::EMode1BalanceXor;
+			if (text_ == QLatin1String("balance-tlb"))
+				return Iface::Xml::EMode1BalanceTlb;
+			if (text_ == QLatin1String("balance-alb"))
+				return Iface::Xml::EMode1BalanceAlb;
+			break;
+		}
+		break;
+	case 13:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("active-backup"))
+				return Iface::Xml::EMode1ActiveBackup;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Iface::Xml::ECarrier>::getText(Iface::Xml::ECarrier value_)
+{
+	switch (value_)
+	{
+	case Iface::Xml::ECarrierIoctl:
+		return QStringLiteral("ioctl");
+	case Iface::Xml::ECarrierNetif:
+		return QStringLiteral("netif");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Iface::Xml::ECarrier>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("ioctl"))
+				return Iface::Xml::ECarrierIoctl;
+			break;
+		case 'n':
+			if (text_ == QLatin1String("netif"))
+				return Iface::Xml::ECarrierNetif;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Iface::Xml::EValidate>::getText(Iface::Xml::EValidate value_)
+{
+	switch (value_)
+	{
+	case Iface::Xml::EValidateNone:
+		return QStringLiteral("none");
+	case Iface::Xml::EValidateActive:
+		return QStringLiteral("active");
+	case Iface::Xml::EValidateBackup:
+		return QStringLiteral("backup");
+	case Iface::Xml::EValidateAll:
+		return QStringLiteral("all");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Iface::Xml::EValidate>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("all"))
+				return Iface::Xml::EValidateAll;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("none"))
+				return Iface::Xml::EValidateNone;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'a':
+			if (text_ == QLatin1String("active"))
+				return Iface::Xml::EValidateActive;
+			break;
+		case 'b':
+			if (text_ == QLatin1String("backup"))
+				return Iface::Xml::EValidateBackup;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 } // namespace Libvirt
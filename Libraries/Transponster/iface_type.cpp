@@ -59,6 +59,13 @@ bool Link::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Link::save(QXmlStreamWriter& dst_) const
+{
+	Element<Link, Name::Strict<124> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -75,7 +82,8 @@ int Traits<Iface::Xml::Link>::parse(Iface::Xml::Link& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Iface::Xml::Link>::generate(const Iface::Xml::Link& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Link>::produce(const Iface::Xml::Link& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSpeed(), m.get<0>()))
@@ -86,6 +94,16 @@ int Traits<Iface::Xml::Link>::generate(const Iface::Xml::Link& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Link>::generate(const Iface::Xml::Link& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Link>::generate(const Iface::Xml::Link& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Dhcp
 
@@ -119,6 +137,13 @@ bool Dhcp::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Dhcp::save(QXmlStreamWriter& dst_) const
+{
+	Element<Dhcp, Name::Strict<1249> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -134,7 +159,8 @@ int Traits<Iface::Xml::Dhcp>::parse(Iface::Xml::Dhcp& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Iface::Xml::Dhcp>::generate(const Iface::Xml::Dhcp& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Dhcp>::produce(const Iface::Xml::Dhcp& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPeerdns(), m.get<0>()))
@@ -143,6 +169,16 @@ int Traits<Iface::Xml::Dhcp>::generate(const Iface::Xml::Dhcp& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Dhcp>::generate(const Iface::Xml::Dhcp& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Dhcp>::generate(const Iface::Xml::Dhcp& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Ip
 
@@ -176,6 +212,13 @@ bool Ip::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Ip::save(QXmlStreamWriter& dst_) const
+{
+	Element<Ip, Name::Strict<689> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -192,7 +235,8 @@ int Traits<Iface::Xml::Ip>::parse(Iface::Xml::Ip& dst_, QStack<QDomElement>& sta
 	return output;
 }
 
-int Traits<Iface::Xml::Ip>::generate(const Iface::Xml::Ip& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Ip>::produce(const Iface::Xml::Ip& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAddress(), m.get<0>()))
@@ -203,6 +247,16 @@ int Traits<Iface::Xml::Ip>::generate(const Iface::Xml::Ip& src_, QDomElement& ds
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Ip>::generate(const Iface::Xml::Ip& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Ip>::generate(const Iface::Xml::Ip& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Protocol
 
@@ -236,6 +290,13 @@ bool Protocol::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Protocol::save(QXmlStreamWriter& dst_) const
+{
+	Element<Protocol, Name::Strict<203> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -253,7 +314,8 @@ int Traits<Iface::Xml::Protocol>::parse(Iface::Xml::Protocol& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Iface::Xml::Protocol>::generate(const Iface::Xml::Protocol& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Protocol>::produce(const Iface::Xml::Protocol& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDhcp(), m.get<1>().get<0>()))
@@ -266,6 +328,16 @@ int Traits<Iface::Xml::Protocol>::generate(const Iface::Xml::Protocol& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Protocol>::generate(const Iface::Xml::Protocol& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Protocol>::generate(const Iface::Xml::Protocol& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Ip1
 
@@ -299,6 +371,13 @@ bool Ip1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Ip1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Ip1, Name::Strict<689> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -315,7 +394,8 @@ int Traits<Iface::Xml::Ip1>::parse(Iface::Xml::Ip1& dst_, QStack<QDomElement>& s
 	return output;
 }
 
-int Traits<Iface::Xml::Ip1>::generate(const Iface::Xml::Ip1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Ip1>::produce(const Iface::Xml::Ip1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAddress(), m.get<0>()))
@@ -326,6 +406,16 @@ int Traits<Iface::Xml::Ip1>::generate(const Iface::Xml::Ip1& src_, QDomElement&
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Ip1>::generate(const Iface::Xml::Ip1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Ip1>::generate(const Iface::Xml::Ip1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Protocol1
 
@@ -363,6 +453,13 @@ bool Protocol1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Protocol1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Protocol1, Name::Strict<203> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -381,7 +478,8 @@ int Traits<Iface::Xml::Protocol1>::parse(Iface::Xml::Protocol1& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Iface::Xml::Protocol1>::generate(const Iface::Xml::Protocol1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Protocol1>::produce(const Iface::Xml::Protocol1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAutoconf(), m.get<1>().get<0>()))
@@ -396,6 +494,16 @@ int Traits<Iface::Xml::Protocol1>::generate(const Iface::Xml::Protocol1& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Protocol1>::generate(const Iface::Xml::Protocol1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Protocol1>::generate(const Iface::Xml::Protocol1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct InterfaceAddressing7159
 
@@ -411,7 +519,8 @@ int Traits<Iface::Xml::InterfaceAddressing7159>::parse(Iface::Xml::InterfaceAddr
 	return output;
 }
 
-int Traits<Iface::Xml::InterfaceAddressing7159>::generate(const Iface::Xml::InterfaceAddressing7159& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::InterfaceAddressing7159>::produce(const Iface::Xml::InterfaceAddressing7159& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getProtocol(), m.get<0>()))
@@ -422,6 +531,16 @@ int Traits<Iface::Xml::InterfaceAddressing7159>::generate(const Iface::Xml::Inte
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::InterfaceAddressing7159>::generate(const Iface::Xml::InterfaceAddressing7159& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::InterfaceAddressing7159>::generate(const Iface::Xml::InterfaceAddressing7159& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct InterfaceAddressing7160
 
@@ -437,7 +556,8 @@ int Traits<Iface::Xml::InterfaceAddressing7160>::parse(Iface::Xml::InterfaceAddr
 	return output;
 }
 
-int Traits<Iface::Xml::InterfaceAddressing7160>::generate(const Iface::Xml::InterfaceAddressing7160& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::InterfaceAddressing7160>::produce(const Iface::Xml::InterfaceAddressing7160& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getProtocol(), m.get<0>()))
@@ -448,6 +568,16 @@ int Traits<Iface::Xml::InterfaceAddressing7160>::generate(const Iface::Xml::Inte
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::InterfaceAddressing7160>::generate(const Iface::Xml::InterfaceAddressing7160& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::InterfaceAddressing7160>::generate(const Iface::Xml::InterfaceAddressing7160& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface
 
@@ -481,6 +611,13 @@ bool Interface::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Interface::save(QXmlStreamWriter& dst_) const
+{
+	Element<Interface, Name::Strict<657> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -501,7 +638,8 @@ int Traits<Iface::Xml::Interface>::parse(Iface::Xml::Interface& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Iface::Xml::Interface>::generate(const Iface::Xml::Interface& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Interface>::produce(const Iface::Xml::Interface& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getStart(), m.get<0>()))
@@ -520,6 +658,16 @@ int Traits<Iface::Xml::Interface>::generate(const Iface::Xml::Interface& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Interface>::generate(const Iface::Xml::Interface& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Interface>::generate(const Iface::Xml::Interface& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct BasicEthernetContent
 
@@ -553,6 +701,13 @@ bool BasicEthernetContent::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool BasicEthernetContent::save(QXmlStreamWriter& dst_) const
+{
+	Element<BasicEthernetContent, Name::Strict<657> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -570,7 +725,8 @@ int Traits<Iface::Xml::BasicEthernetContent>::parse(Iface::Xml::BasicEthernetCon
 	return output;
 }
 
-int Traits<Iface::Xml::BasicEthernetContent>::generate(const Iface::Xml::BasicEthernetContent& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::BasicEthernetContent>::produce(const Iface::Xml::BasicEthernetContent& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<1>()))
@@ -583,6 +739,16 @@ int Traits<Iface::Xml::BasicEthernetContent>::generate(const Iface::Xml::BasicEt
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::BasicEthernetContent>::generate(const Iface::Xml::BasicEthernetContent& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::BasicEthernetContent>::generate(const Iface::Xml::BasicEthernetContent& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct VlanInterfaceCommon
 
@@ -619,7 +785,8 @@ int Traits<Iface::Xml::VlanInterfaceCommon>::parse(Iface::Xml::VlanInterfaceComm
 	return output;
 }
 
-int Traits<Iface::Xml::VlanInterfaceCommon>::generate(const Iface::Xml::VlanInterfaceCommon& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::VlanInterfaceCommon>::produce(const Iface::Xml::VlanInterfaceCommon& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<1>()))
@@ -630,6 +797,16 @@ int Traits<Iface::Xml::VlanInterfaceCommon>::generate(const Iface::Xml::VlanInte
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::VlanInterfaceCommon>::generate(const Iface::Xml::VlanInterfaceCommon& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::VlanInterfaceCommon>::generate(const Iface::Xml::VlanInterfaceCommon& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Vlan
 
@@ -667,6 +844,13 @@ bool Vlan::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Vlan::save(QXmlStreamWriter& dst_) const
+{
+	Element<Vlan, Name::Strict<205> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -683,7 +867,8 @@ int Traits<Iface::Xml::Vlan>::parse(Iface::Xml::Vlan& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Iface::Xml::Vlan>::generate(const Iface::Xml::Vlan& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Vlan>::produce(const Iface::Xml::Vlan& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getTag(), m.get<0>()))
@@ -694,6 +879,16 @@ int Traits<Iface::Xml::Vlan>::generate(const Iface::Xml::Vlan& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Vlan>::generate(const Iface::Xml::Vlan& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Vlan>::generate(const Iface::Xml::Vlan& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface1
 
@@ -727,6 +922,13 @@ bool Interface1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Interface1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Interface1, Name::Strict<657> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -743,7 +945,8 @@ int Traits<Iface::Xml::Interface1>::parse(Iface::Xml::Interface1& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Iface::Xml::Interface1>::generate(const Iface::Xml::Interface1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Interface1>::produce(const Iface::Xml::Interface1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getVlanInterfaceCommon(), m.get<0>()))
@@ -754,6 +957,16 @@ int Traits<Iface::Xml::Interface1>::generate(const Iface::Xml::Interface1& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Interface1>::generate(const Iface::Xml::Interface1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Interface1>::generate(const Iface::Xml::Interface1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct BondInterfaceCommon
 
@@ -790,7 +1003,8 @@ int Traits<Iface::Xml::BondInterfaceCommon>::parse(Iface::Xml::BondInterfaceComm
 	return output;
 }
 
-int Traits<Iface::Xml::BondInterfaceCommon>::generate(const Iface::Xml::BondInterfaceCommon& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::BondInterfaceCommon>::produce(const Iface::Xml::BondInterfaceCommon& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<1>()))
@@ -801,6 +1015,16 @@ int Traits<Iface::Xml::BondInterfaceCommon>::generate(const Iface::Xml::BondInte
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::BondInterfaceCommon>::generate(const Iface::Xml::BondInterfaceCommon& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::BondInterfaceCommon>::generate(const Iface::Xml::BondInterfaceCommon& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Miimon
 
@@ -838,6 +1062,13 @@ bool Miimon::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Miimon::save(QXmlStreamWriter& dst_) const
+{
+	Element<Miimon, Name::Strict<1331> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -856,7 +1087,8 @@ int Traits<Iface::Xml::Miimon>::parse(Iface::Xml::Miimon& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Iface::Xml::Miimon>::generate(const Iface::Xml::Miimon& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Miimon>::produce(const Iface::Xml::Miimon& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFreq(), m.get<0>()))
@@ -871,6 +1103,16 @@ int Traits<Iface::Xml::Miimon>::generate(const Iface::Xml::Miimon& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Miimon>::generate(const Iface::Xml::Miimon& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Miimon>::generate(const Iface::Xml::Miimon& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Arpmon
 
@@ -908,6 +1150,13 @@ bool Arpmon::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Arpmon::save(QXmlStreamWriter& dst_) const
+{
+	Element<Arpmon, Name::Strict<1339> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -925,7 +1174,8 @@ int Traits<Iface::Xml::Arpmon>::parse(Iface::Xml::Arpmon& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Iface::Xml::Arpmon>::generate(const Iface::Xml::Arpmon& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Arpmon>::produce(const Iface::Xml::Arpmon& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getInterval(), m.get<0>()))
@@ -938,6 +1188,16 @@ int Traits<Iface::Xml::Arpmon>::generate(const Iface::Xml::Arpmon& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Arpmon>::generate(const Iface::Xml::Arpmon& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Arpmon>::generate(const Iface::Xml::Arpmon& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Bond
 
@@ -971,6 +1231,13 @@ bool Bond::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Bond::save(QXmlStreamWriter& dst_) const
+{
+	Element<Bond, Name::Strict<1322> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -988,7 +1255,8 @@ int Traits<Iface::Xml::Bond>::parse(Iface::Xml::Bond& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Iface::Xml::Bond>::generate(const Iface::Xml::Bond& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Bond>::produce(const Iface::Xml::Bond& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMode(), m.get<0>()))
@@ -1001,6 +1269,16 @@ int Traits<Iface::Xml::Bond>::generate(const Iface::Xml::Bond& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Bond>::generate(const Iface::Xml::Bond& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Bond>::generate(const Iface::Xml::Bond& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface2
 
@@ -1034,6 +1312,13 @@ bool Interface2::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Interface2::save(QXmlStreamWriter& dst_) const
+{
+	Element<Interface2, Name::Strict<657> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -1050,7 +1335,8 @@ int Traits<Iface::Xml::Interface2>::parse(Iface::Xml::Interface2& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Iface::Xml::Interface2>::generate(const Iface::Xml::Interface2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Interface2>::produce(const Iface::Xml::Interface2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBondInterfaceCommon(), m.get<0>()))
@@ -1061,6 +1347,16 @@ int Traits<Iface::Xml::Interface2>::generate(const Iface::Xml::Interface2& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Interface2>::generate(const Iface::Xml::Interface2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Interface2>::generate(const Iface::Xml::Interface2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Bridge
 
@@ -1094,6 +1390,13 @@ bool Bridge::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Bridge::save(QXmlStreamWriter& dst_) const
+{
+	Element<Bridge, Name::Strict<656> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -1111,7 +1414,8 @@ int Traits<Iface::Xml::Bridge>::parse(Iface::Xml::Bridge& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Iface::Xml::Bridge>::generate(const Iface::Xml::Bridge& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Bridge>::produce(const Iface::Xml::Bridge& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getStp(), m.get<0>()))
@@ -1124,6 +1428,16 @@ int Traits<Iface::Xml::Bridge>::generate(const Iface::Xml::Bridge& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Bridge>::generate(const Iface::Xml::Bridge& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Bridge>::generate(const Iface::Xml::Bridge& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface3
 
@@ -1157,6 +1471,13 @@ bool Interface3::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Interface3::save(QXmlStreamWriter& dst_) const
+{
+	Element<Interface3, Name::Strict<657> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -1176,7 +1497,8 @@ int Traits<Iface::Xml::Interface3>::parse(Iface::Xml::Interface3& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Iface::Xml::Interface3>::generate(const Iface::Xml::Interface3& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Interface3>::produce(const Iface::Xml::Interface3& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<1>()))
@@ -1193,6 +1515,16 @@ int Traits<Iface::Xml::Interface3>::generate(const Iface::Xml::Interface3& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Interface3>::generate(const Iface::Xml::Interface3& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Interface3>::generate(const Iface::Xml::Interface3& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface4
 
@@ -1226,6 +1558,13 @@ bool Interface4::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Interface4::save(QXmlStreamWriter& dst_) const
+{
+	Element<Interface4, Name::Strict<657> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Iface
@@ -1245,7 +1584,8 @@ int Traits<Iface::Xml::Interface4>::parse(Iface::Xml::Interface4& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Iface::Xml::Interface4>::generate(const Iface::Xml::Interface4& src_, QDomElement& dst_)
+template<class D>
+int Traits<Iface::Xml::Interface4>::produce(const Iface::Xml::Interface4& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getVlanInterfaceCommon(), m.get<0>()))
@@ -1262,4 +1602,14 @@ int Traits<Iface::Xml::Interface4>::generate(const Iface::Xml::Interface4& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Iface::Xml::Interface4>::generate(const Iface::Xml::Interface4& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Iface::Xml::Interface4>::generate(const Iface::Xml::Interface4& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 } // namespace Libvirt
@@ -61,6 +61,7 @@ struct Link
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PUnsignedInt::value_type > m_speed;
@@ -90,6 +91,7 @@ struct Dhcp
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_peerdns;
@@ -126,6 +128,7 @@ struct Ip
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PIpv4Addr::value_type m_address;
@@ -171,6 +174,7 @@ struct Protocol
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<Dhcp > m_dhcp;
@@ -209,6 +213,7 @@ struct Ip1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PIpv6Addr::value_type m_address;
@@ -264,6 +269,7 @@ struct Protocol1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	bool m_autoconf;
@@ -416,6 +422,7 @@ struct Interface
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EMode > m_start;
@@ -465,6 +472,7 @@ struct BasicEthernetContent
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PDeviceName::value_type m_name;
@@ -541,6 +549,7 @@ struct Vlan
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PVlanId::value_type m_tag;
@@ -578,6 +587,7 @@ struct Interface1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VlanInterfaceCommon m_vlanInterfaceCommon;
@@ -669,6 +679,7 @@ struct Miimon
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_freq;
@@ -718,6 +729,7 @@ struct Arpmon
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_interval;
@@ -777,6 +789,7 @@ struct Bond
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EMode1 > m_mode;
@@ -815,6 +828,7 @@ struct Interface2
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	BondInterfaceCommon m_bondInterfaceCommon;
@@ -873,6 +887,7 @@ struct Bridge
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirOnOff > m_stp;
@@ -935,6 +950,7 @@ struct Interface3
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PDeviceName::value_type m_name;
@@ -999,6 +1015,7 @@ struct Interface4
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VlanInterfaceCommon m_vlanInterfaceCommon;
@@ -1021,6 +1038,10 @@ struct Traits<Iface::Xml::Link>
 
 	static int parse(Iface::Xml::Link& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Link& , QDomElement& );
+	static int generate(const Iface::Xml::Link& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Link& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1033,6 +1054,10 @@ struct Traits<Iface::Xml::Dhcp>
 
 	static int parse(Iface::Xml::Dhcp& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Dhcp& , QDomElement& );
+	static int generate(const Iface::Xml::Dhcp& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Dhcp& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1045,6 +1070,10 @@ struct Traits<Iface::Xml::Ip>
 
 	static int parse(Iface::Xml::Ip& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Ip& , QDomElement& );
+	static int generate(const Iface::Xml::Ip& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Ip& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1057,6 +1086,10 @@ struct Traits<Iface::Xml::Protocol>
 
 	static int parse(Iface::Xml::Protocol& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Protocol& , QDomElement& );
+	static int generate(const Iface::Xml::Protocol& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Protocol& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1069,6 +1102,10 @@ struct Traits<Iface::Xml::Ip1>
 
 	static int parse(Iface::Xml::Ip1& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Ip1& , QDomElement& );
+	static int generate(const Iface::Xml::Ip1& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Ip1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1081,6 +1118,10 @@ struct Traits<Iface::Xml::Protocol1>
 
 	static int parse(Iface::Xml::Protocol1& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Protocol1& , QDomElement& );
+	static int generate(const Iface::Xml::Protocol1& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Protocol1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1093,6 +1134,10 @@ struct Traits<Iface::Xml::InterfaceAddressing7159>
 
 	static int parse(Iface::Xml::InterfaceAddressing7159& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::InterfaceAddressing7159& , QDomElement& );
+	static int generate(const Iface::Xml::InterfaceAddressing7159& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::InterfaceAddressing7159& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1105,6 +1150,10 @@ struct Traits<Iface::Xml::InterfaceAddressing7160>
 
 	static int parse(Iface::Xml::InterfaceAddressing7160& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::InterfaceAddressing7160& , QDomElement& );
+	static int generate(const Iface::Xml::InterfaceAddressing7160& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::InterfaceAddressing7160& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1117,6 +1166,10 @@ struct Traits<Iface::Xml::Interface>
 
 	static int parse(Iface::Xml::Interface& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Interface& , QDomElement& );
+	static int generate(const Iface::Xml::Interface& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Interface& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1129,6 +1182,10 @@ struct Traits<Iface::Xml::BasicEthernetContent>
 
 	static int parse(Iface::Xml::BasicEthernetContent& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::BasicEthernetContent& , QDomElement& );
+	static int generate(const Iface::Xml::BasicEthernetContent& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::BasicEthernetContent& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1141,6 +1198,10 @@ struct Traits<Iface::Xml::VlanInterfaceCommon>
 
 	static int parse(Iface::Xml::VlanInterfaceCommon& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::VlanInterfaceCommon& , QDomElement& );
+	static int generate(const Iface::Xml::VlanInterfaceCommon& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::VlanInterfaceCommon& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1153,6 +1214,10 @@ struct Traits<Iface::Xml::Vlan>
 
 	static int parse(Iface::Xml::Vlan& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Vlan& , QDomElement& );
+	static int generate(const Iface::Xml::Vlan& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Vlan& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1165,6 +1230,10 @@ struct Traits<Iface::Xml::Interface1>
 
 	static int parse(Iface::Xml::Interface1& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Interface1& , QDomElement& );
+	static int generate(const Iface::Xml::Interface1& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Interface1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1177,6 +1246,10 @@ struct Traits<Iface::Xml::BondInterfaceCommon>
 
 	static int parse(Iface::Xml::BondInterfaceCommon& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::BondInterfaceCommon& , QDomElement& );
+	static int generate(const Iface::Xml::BondInterfaceCommon& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::BondInterfaceCommon& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1189,6 +1262,10 @@ struct Traits<Iface::Xml::Miimon>
 
 	static int parse(Iface::Xml::Miimon& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Miimon& , QDomElement& );
+	static int generate(const Iface::Xml::Miimon& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Miimon& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1201,6 +1278,10 @@ struct Traits<Iface::Xml::Arpmon>
 
 	static int parse(Iface::Xml::Arpmon& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Arpmon& , QDomElement& );
+	static int generate(const Iface::Xml::Arpmon& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Arpmon& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1213,6 +1294,10 @@ struct Traits<Iface::Xml::Bond>
 
 	static int parse(Iface::Xml::Bond& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Bond& , QDomElement& );
+	static int generate(const Iface::Xml::Bond& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Bond& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1225,6 +1310,10 @@ struct Traits<Iface::Xml::Interface2>
 
 	static int parse(Iface::Xml::Interface2& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Interface2& , QDomElement& );
+	static int generate(const Iface::Xml::Interface2& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Interface2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1237,6 +1326,10 @@ struct Traits<Iface::Xml::Bridge>
 
 	static int parse(Iface::Xml::Bridge& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Bridge& , QDomElement& );
+	static int generate(const Iface::Xml::Bridge& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Bridge& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1249,6 +1342,10 @@ struct Traits<Iface::Xml::Interface3>
 
 	static int parse(Iface::Xml::Interface3& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Interface3& , QDomElement& );
+	static int generate(const Iface::Xml::Interface3& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Interface3& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1261,6 +1358,10 @@ struct Traits<Iface::Xml::Interface4>
 
 	static int parse(Iface::Xml::Interface4& , QStack<QDomElement>& );
 	static int generate(const Iface::Xml::Interface4& , QDomElement& );
+	static int generate(const Iface::Xml::Interface4& , Stream& );
+
+	template<class D>
+	static int produce(const Iface::Xml::Interface4& , D& );
 };
 
 } // namespace Libvirt
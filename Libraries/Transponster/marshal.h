@@ -86,9 +86,9 @@ struct Marshal<mpl::int_<I> >
 	{
 		return getText(I);
 	}
-	static int setString(QString value_, Access<mpl::int_<I> >& access_)
+	static int setString(const QString& value_, Access<mpl::int_<I> >& access_)
 	{
-		if (getString(access_) == value_.simplified())
+		if (getString(access_) == QStringRef(&value_).trimmed())
 			return 1;
 
 		return -1;
@@ -111,34 +111,21 @@ struct Marshal<T, typename boost::enable_if<boost::is_same<QString, typename Val
 template<class T>
 struct Marshal<T, typename boost::enable_if<boost::is_enum<T> >::type>
 {
-private:
-	typedef typename Enum<T>::data_type data_type;
-	typedef typename Enum<T>::name_type name_type;
-
-	static data_type s_data;
-
-public:
 	static QString getString(const Access<T>& access_)
 	{
-		return s_data.left.at(access_.getValue());
+		return Enum<T>::getText(access_.getValue());
 	}
-	static int setString(name_type value_, Access<T>& access_)
+	static int setString(const QString& value_, Access<T>& access_)
 	{
-		typename data_type::right_map::const_iterator p =
-				s_data.right.find(value_.simplified());
-		if (s_data.right.end() == p)
+		int x = Enum<T>::find(QStringRef(&value_).trimmed());
+		if (0 > x)
 			return -1;
 
-		access_.setValue(p->second);
+		access_.setValue(static_cast<T>(x));
 		return 1;
 	}
 };
 
-template<class T>
-typename Marshal<T, typename boost::enable_if<boost::is_enum<T> >::type>::data_type
-Marshal<T, typename boost::enable_if<boost::is_enum<T> >::type>::s_data =
-	Enum<T>::getData();
-
 } // namespace Libvirt
 
 #endif // __MARSHAL_H__
@@ -23,72 +23,349 @@
  */
 
 #include "network_enum.h"
-#include <boost/assign/list_of.hpp>
 
-namespace ba = boost::assign;
 namespace Libvirt
 {
 template<>
-Enum<Network::Xml::EVirYesNo>::data_type Enum<Network::Xml::EVirYesNo>::getData()
+QString Enum<Network::Xml::EVirYesNo>::getText(Network::Xml::EVirYesNo value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Network::Xml::EVirYesNoYes, "yes"))
-			(data_type::value_type(Network::Xml::EVirYesNoNo, "no"));
+	switch (value_)
+	{
+	case Network::Xml::EVirYesNoYes:
+		return QStringLiteral("yes");
+	case Network::Xml::EVirYesNoNo:
+		return QStringLiteral("no");
+	}
+	return QString();
 }
 
 template<>
-Enum<Network::Xml::EVirOnOff>::data_type Enum<Network::Xml::EVirOnOff>::getData()
+int Enum<Network::Xml::EVirYesNo>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Network::Xml::EVirOnOffOn, "on"))
-			(data_type::value_type(Network::Xml::EVirOnOffOff, "off"));
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("no"))
+				return Network::Xml::EVirYesNoNo;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'y':
+			if (text_ == QLatin1String("yes"))
+				return Network::Xml::EVirYesNoYes;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Network::Xml::EMacTableManager>::data_type Enum<Network::Xml::EMacTableManager>::getData()
+QString Enum<Network::Xml::EVirOnOff>::getText(Network::Xml::EVirOnOff value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Network::Xml::EMacTableManagerKernel, "kernel"))
-			(data_type::value_type(Network::Xml::EMacTableManagerLibvirt, "libvirt"));
+	switch (value_)
+	{
+	case Network::Xml::EVirOnOffOn:
+		return QStringLiteral("on");
+	case Network::Xml::EVirOnOffOff:
+		return QStringLiteral("off");
+	}
+	return QString();
 }
 
 template<>
-Enum<Network::Xml::EMode>::data_type Enum<Network::Xml::EMode>::getData()
+int Enum<Network::Xml::EVirOnOff>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Network::Xml::EModeNat, "nat"))
-			(data_type::value_type(Network::Xml::EModeRoute, "route"))
-			(data_type::value_type(Network::Xml::EModeOpen, "open"))
-			(data_type::value_type(Network::Xml::EModeBridge, "bridge"))
-			(data_type::value_type(Network::Xml::EModePassthrough, "passthrough"))
-			(data_type::value_type(Network::Xml::EModePrivate, "private"))
-			(data_type::value_type(Network::Xml::EModeVepa, "vepa"))
-			(data_type::value_type(Network::Xml::EModeHostdev, "hostdev"));
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("on"))
+				return Network::Xml::EVirOnOffOn;
+			break;
+		}
+		break;
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("off"))
+				return Network::Xml::EVirOnOffOff;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Network::Xml::EName>::data_type Enum<Network::Xml::EName>::getData()
+QString Enum<Network::Xml::EMacTableManager>::getText(Network::Xml::EMacTableManager value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Network::Xml::ENameKvm, "kvm"))
-			(data_type::value_type(Network::Xml::ENameVfio, "vfio"));
+	switch (value_)
+	{
+	case Network::Xml::EMacTableManagerKernel:
+		return QStringLiteral("kernel");
+	case Network::Xml::EMacTableManagerLibvirt:
+		return QStringLiteral("libvirt");
+	}
+	return QString();
 }
 
 template<>
-Enum<Network::Xml::ENativeMode>::data_type Enum<Network::Xml::ENativeMode>::getData()
+int Enum<Network::Xml::EMacTableManager>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Network::Xml::ENativeModeTagged, "tagged"))
-			(data_type::value_type(Network::Xml::ENativeModeUntagged, "untagged"));
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'k':
+			if (text_ == QLatin1String("kernel"))
+				return Network::Xml::EMacTableManagerKernel;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("libvirt"))
+				return Network::Xml::EMacTableManagerLibvirt;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Network::Xml::ELeaseUnit>::data_type Enum<Network::Xml::ELeaseUnit>::getData()
+QString Enum<Network::Xml::EMode>::getText(Network::Xml::EMode value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Network::Xml::ELeaseUnitSeconds, "seconds"))
-			(data_type::value_type(Network::Xml::ELeaseUnitMinutes, "minutes"))
-			(data_type::value_type(Network::Xml::ELeaseUnitHours, "hours"));
+	switch (value_)
+	{
+	case Network::Xml::EModeNat:
+		return QStringLiteral("nat");
+	case Network::Xml::EModeRoute:
+		return QStringLiteral("route");
+	case Network::Xml::EModeOpen:
+		return QStringLiteral("open");
+	case Network::Xml::EModeBridge:
+		return QStringLiteral("bridge");
+	case Network::Xml::EModePassthrough:
+		return QStringLiteral("passthrough");
+	case Network::Xml::EModePrivate:
+		return QStringLiteral("private");
+	case Network::Xml::EModeVepa:
+		return QStringLiteral("vepa");
+	case Network::Xml::EModeHostdev:
+		return QStringLiteral("hostdev");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Network::Xml::EMode>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("nat"))
+				return Network::Xml::EModeNat;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("open"))
+				return Network::Xml::EModeOpen;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("vepa"))
+				return Network::Xml::EModeVepa;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("route"))
+				return Network::Xml::EModeRoute;
+			break;
+		}
+		break;
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("bridge"))
+				return Network::Xml::EModeBridge;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("hostdev"))
+				return Network::Xml::EModeHostdev;
+			break;
+		case 'p':
+			if (text_ == QLatin1String("private"))
+				return Network::Xml::EModePrivate;
+			break;
+		}
+		break;
+	case 11:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("passthrough"))
+				return Network::Xml::EModePassthrough;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Network::Xml::EName>::getText(Network::Xml::EName value_)
+{
+	switch (value_)
+	{
+	case Network::Xml::ENameKvm:
+		return QStringLiteral("kvm");
+	case Network::Xml::ENameVfio:
+		return QStringLiteral("vfio");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Network::Xml::EName>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'k':
+			if (text_ == QLatin1String("kvm"))
+				return Network::Xml::ENameKvm;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("vfio"))
+				return Network::Xml::ENameVfio;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Network::Xml::ENativeMode>::getText(Network::Xml::ENativeMode value_)
+{
+	switch (value_)
+	{
+	case Network::Xml::ENativeModeTagged:
+		return QStringLiteral("tagged");
+	case Network::Xml::ENativeModeUntagged:
+		return QStringLiteral("untagged");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Network::Xml::ENativeMode>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 't':
+			if (text_ == QLatin1String("tagged"))
+				return Network::Xml::ENativeModeTagged;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("untagged"))
+				return Network::Xml::ENativeModeUntagged;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Network::Xml::ELeaseUnit>::getText(Network::Xml::ELeaseUnit value_)
+{
+	switch (value_)
+	{
+	case Network::Xml::ELeaseUnitSeconds:
+		return QStringLiteral("seconds");
+	case Network::Xml::ELeaseUnitMinutes:
+		return QStringLiteral("minutes");
+	case Network::Xml::ELeaseUnitHours:
+		return QStringLiteral("hours");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Network::Xml::ELeaseUnit>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("hours"))
+				return Network::Xml::ELeaseUnitHours;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("minutes"))
+				return Network::Xml::ELeaseUnitMinutes;
+			break;
+		case 's':
+			if (text_ == QLatin1String("seconds"))
+				return Network::Xml::ELeaseUnitSeconds;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 } // namespace Libvirt
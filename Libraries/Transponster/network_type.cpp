@@ -59,6 +59,13 @@ bool Bridge::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Bridge::save(QXmlStreamWriter& dst_) const
+{
+	Element<Bridge, Name::Strict<656> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -78,7 +85,8 @@ int Traits<Network::Xml::Bridge>::parse(Network::Xml::Bridge& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Network::Xml::Bridge>::generate(const Network::Xml::Bridge& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Bridge>::produce(const Network::Xml::Bridge& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -95,6 +103,16 @@ int Traits<Network::Xml::Bridge>::generate(const Network::Xml::Bridge& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Bridge>::generate(const Network::Xml::Bridge& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Bridge>::generate(const Network::Xml::Bridge& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Interface
 
@@ -128,6 +146,13 @@ bool Interface::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Interface::save(QXmlStreamWriter& dst_) const
+{
+	Element<Interface, Name::Strict<657> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -144,7 +169,8 @@ int Traits<Network::Xml::Interface>::parse(Network::Xml::Interface& dst_, QStack
 	return output;
 }
 
-int Traits<Network::Xml::Interface>::generate(const Network::Xml::Interface& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Interface>::produce(const Network::Xml::Interface& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDev(), m.get<0>()))
@@ -155,6 +181,16 @@ int Traits<Network::Xml::Interface>::generate(const Network::Xml::Interface& src
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Interface>::generate(const Network::Xml::Interface& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Interface>::generate(const Network::Xml::Interface& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Pciaddress
 
@@ -194,7 +230,8 @@ int Traits<Network::Xml::Pciaddress>::parse(Network::Xml::Pciaddress& dst_, QSta
 	return output;
 }
 
-int Traits<Network::Xml::Pciaddress>::generate(const Network::Xml::Pciaddress& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Pciaddress>::produce(const Network::Xml::Pciaddress& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDomain(), m.get<0>()))
@@ -211,6 +248,16 @@ int Traits<Network::Xml::Pciaddress>::generate(const Network::Xml::Pciaddress& s
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Pciaddress>::generate(const Network::Xml::Pciaddress& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Pciaddress>::generate(const Network::Xml::Pciaddress& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Address
 
@@ -244,6 +291,13 @@ bool Address::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Address::save(QXmlStreamWriter& dst_) const
+{
+	Element<Address, Name::Strict<111> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -260,7 +314,8 @@ int Traits<Network::Xml::Address>::parse(Network::Xml::Address& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Network::Xml::Address>::generate(const Network::Xml::Address& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Address>::produce(const Network::Xml::Address& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getPciaddress(), m.get<1>()))
@@ -271,6 +326,16 @@ int Traits<Network::Xml::Address>::generate(const Network::Xml::Address& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Address>::generate(const Network::Xml::Address& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Address>::generate(const Network::Xml::Address& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Address1
 
@@ -304,6 +369,13 @@ bool Address1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Address1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Address1, Name::Strict<111> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -320,7 +392,8 @@ int Traits<Network::Xml::Address1>::parse(Network::Xml::Address1& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Network::Xml::Address1>::generate(const Network::Xml::Address1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Address1>::produce(const Network::Xml::Address1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getStart(), m.get<0>()))
@@ -331,6 +404,16 @@ int Traits<Network::Xml::Address1>::generate(const Network::Xml::Address1& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Address1>::generate(const Network::Xml::Address1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Address1>::generate(const Network::Xml::Address1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Port
 
@@ -368,6 +451,13 @@ bool Port::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Port::save(QXmlStreamWriter& dst_) const
+{
+	Element<Port, Name::Strict<212> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -384,7 +474,8 @@ int Traits<Network::Xml::Port>::parse(Network::Xml::Port& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Network::Xml::Port>::generate(const Network::Xml::Port& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Port>::produce(const Network::Xml::Port& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getStart(), m.get<0>()))
@@ -395,6 +486,16 @@ int Traits<Network::Xml::Port>::generate(const Network::Xml::Port& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Port>::generate(const Network::Xml::Port& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Port>::generate(const Network::Xml::Port& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Nat
 
@@ -428,6 +529,13 @@ bool Nat::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Nat::save(QXmlStreamWriter& dst_) const
+{
+	Element<Nat, Name::Strict<1229> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -445,7 +553,8 @@ int Traits<Network::Xml::Nat>::parse(Network::Xml::Nat& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Network::Xml::Nat>::generate(const Network::Xml::Nat& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Nat>::produce(const Network::Xml::Nat& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIpv6(), m.get<0>()))
@@ -458,6 +567,16 @@ int Traits<Network::Xml::Nat>::generate(const Network::Xml::Nat& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Nat>::generate(const Network::Xml::Nat& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Nat>::generate(const Network::Xml::Nat& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Forward
 
@@ -491,6 +610,13 @@ bool Forward::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Forward::save(QXmlStreamWriter& dst_) const
+{
+	Element<Forward, Name::Strict<1228> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -512,7 +638,8 @@ int Traits<Network::Xml::Forward>::parse(Network::Xml::Forward& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Network::Xml::Forward>::generate(const Network::Xml::Forward& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Forward>::produce(const Network::Xml::Forward& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDev(), m.get<0>()))
@@ -533,6 +660,16 @@ int Traits<Network::Xml::Forward>::generate(const Network::Xml::Forward& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Forward>::generate(const Network::Xml::Forward& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Forward>::generate(const Network::Xml::Forward& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Parameters
 
@@ -566,6 +703,13 @@ bool Parameters::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Parameters::save(QXmlStreamWriter& dst_) const
+{
+	Element<Parameters, Name::Strict<180> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -584,7 +728,8 @@ int Traits<Network::Xml::Parameters>::parse(Network::Xml::Parameters& dst_, QSta
 	return output;
 }
 
-int Traits<Network::Xml::Parameters>::generate(const Network::Xml::Parameters& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Parameters>::produce(const Network::Xml::Parameters& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getManagerid(), m.get<0>()))
@@ -599,6 +744,16 @@ int Traits<Network::Xml::Parameters>::generate(const Network::Xml::Parameters& s
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Parameters>::generate(const Network::Xml::Parameters& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Parameters>::generate(const Network::Xml::Parameters& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Parameters1
 
@@ -632,6 +787,13 @@ bool Parameters1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Parameters1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Parameters1, Name::Strict<180> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -647,7 +809,8 @@ int Traits<Network::Xml::Parameters1>::parse(Network::Xml::Parameters1& dst_, QS
 	return output;
 }
 
-int Traits<Network::Xml::Parameters1>::generate(const Network::Xml::Parameters1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Parameters1>::produce(const Network::Xml::Parameters1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getProfileid(), m.get<0>()))
@@ -656,6 +819,16 @@ int Traits<Network::Xml::Parameters1>::generate(const Network::Xml::Parameters1&
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Parameters1>::generate(const Network::Xml::Parameters1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Parameters1>::generate(const Network::Xml::Parameters1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Parameters2
 
@@ -689,6 +862,13 @@ bool Parameters2::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Parameters2::save(QXmlStreamWriter& dst_) const
+{
+	Element<Parameters2, Name::Strict<180> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -705,7 +885,8 @@ int Traits<Network::Xml::Parameters2>::parse(Network::Xml::Parameters2& dst_, QS
 	return output;
 }
 
-int Traits<Network::Xml::Parameters2>::generate(const Network::Xml::Parameters2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Parameters2>::produce(const Network::Xml::Parameters2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getProfileid(), m.get<0>()))
@@ -716,6 +897,16 @@ int Traits<Network::Xml::Parameters2>::generate(const Network::Xml::Parameters2&
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Parameters2>::generate(const Network::Xml::Parameters2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Parameters2>::generate(const Network::Xml::Parameters2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Parameters3
 
@@ -749,6 +940,13 @@ bool Parameters3::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Parameters3::save(QXmlStreamWriter& dst_) const
+{
+	Element<Parameters3, Name::Strict<180> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -769,7 +967,8 @@ int Traits<Network::Xml::Parameters3>::parse(Network::Xml::Parameters3& dst_, QS
 	return output;
 }
 
-int Traits<Network::Xml::Parameters3>::generate(const Network::Xml::Parameters3& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Parameters3>::produce(const Network::Xml::Parameters3& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getManagerid(), m.get<0>()))
@@ -788,6 +987,16 @@ int Traits<Network::Xml::Parameters3>::generate(const Network::Xml::Parameters3&
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Parameters3>::generate(const Network::Xml::Parameters3& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Parameters3>::generate(const Network::Xml::Parameters3& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Virtualport
 
@@ -821,6 +1030,13 @@ bool Virtualport::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Virtualport::save(QXmlStreamWriter& dst_) const
+{
+	Element<Virtualport, Name::Strict<178> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -836,7 +1052,8 @@ int Traits<Network::Xml::Virtualport>::parse(Network::Xml::Virtualport& dst_, QS
 	return output;
 }
 
-int Traits<Network::Xml::Virtualport>::generate(const Network::Xml::Virtualport& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Virtualport>::produce(const Network::Xml::Virtualport& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getParameters(), m.get<0>()))
@@ -845,6 +1062,16 @@ int Traits<Network::Xml::Virtualport>::generate(const Network::Xml::Virtualport&
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Virtualport>::generate(const Network::Xml::Virtualport& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Virtualport>::generate(const Network::Xml::Virtualport& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct BandwidthAttributes
 
@@ -878,6 +1105,13 @@ bool BandwidthAttributes::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool BandwidthAttributes::save(QXmlStreamWriter& dst_) const
+{
+	Element<BandwidthAttributes, Name::Strict<196> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -896,7 +1130,8 @@ int Traits<Network::Xml::BandwidthAttributes>::parse(Network::Xml::BandwidthAttr
 	return output;
 }
 
-int Traits<Network::Xml::BandwidthAttributes>::generate(const Network::Xml::BandwidthAttributes& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::BandwidthAttributes>::produce(const Network::Xml::BandwidthAttributes& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAverage(), m.get<0>()))
@@ -911,6 +1146,16 @@ int Traits<Network::Xml::BandwidthAttributes>::generate(const Network::Xml::Band
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::BandwidthAttributes>::generate(const Network::Xml::BandwidthAttributes& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::BandwidthAttributes>::generate(const Network::Xml::BandwidthAttributes& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Bandwidth
 
@@ -944,6 +1189,13 @@ bool Bandwidth::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Bandwidth::save(QXmlStreamWriter& dst_) const
+{
+	Element<Bandwidth, Name::Strict<193> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -961,7 +1213,8 @@ int Traits<Network::Xml::Bandwidth>::parse(Network::Xml::Bandwidth& dst_, QStack
 	return output;
 }
 
-int Traits<Network::Xml::Bandwidth>::generate(const Network::Xml::Bandwidth& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Bandwidth>::produce(const Network::Xml::Bandwidth& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getClassID(), m.get<0>()))
@@ -974,6 +1227,16 @@ int Traits<Network::Xml::Bandwidth>::generate(const Network::Xml::Bandwidth& src
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Bandwidth>::generate(const Network::Xml::Bandwidth& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Bandwidth>::generate(const Network::Xml::Bandwidth& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Tag
 
@@ -1011,6 +1274,13 @@ bool Tag::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Tag::save(QXmlStreamWriter& dst_) const
+{
+	Element<Tag, Name::Strict<207> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1027,7 +1297,8 @@ int Traits<Network::Xml::Tag>::parse(Network::Xml::Tag& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Network::Xml::Tag>::generate(const Network::Xml::Tag& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Tag>::produce(const Network::Xml::Tag& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -1038,6 +1309,16 @@ int Traits<Network::Xml::Tag>::generate(const Network::Xml::Tag& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Tag>::generate(const Network::Xml::Tag& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Tag>::generate(const Network::Xml::Tag& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Portgroup
 
@@ -1071,6 +1352,13 @@ bool Portgroup::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Portgroup::save(QXmlStreamWriter& dst_) const
+{
+	Element<Portgroup, Name::Strict<654> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1091,7 +1379,8 @@ int Traits<Network::Xml::Portgroup>::parse(Network::Xml::Portgroup& dst_, QStack
 	return output;
 }
 
-int Traits<Network::Xml::Portgroup>::generate(const Network::Xml::Portgroup& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Portgroup>::produce(const Network::Xml::Portgroup& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -1110,6 +1399,16 @@ int Traits<Network::Xml::Portgroup>::generate(const Network::Xml::Portgroup& src
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Portgroup>::generate(const Network::Xml::Portgroup& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Portgroup>::generate(const Network::Xml::Portgroup& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Domain
 
@@ -1143,6 +1442,13 @@ bool Domain::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Domain::save(QXmlStreamWriter& dst_) const
+{
+	Element<Domain, Name::Strict<1> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1159,7 +1465,8 @@ int Traits<Network::Xml::Domain>::parse(Network::Xml::Domain& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Network::Xml::Domain>::generate(const Network::Xml::Domain& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Domain>::produce(const Network::Xml::Domain& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -1170,6 +1477,16 @@ int Traits<Network::Xml::Domain>::generate(const Network::Xml::Domain& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Domain>::generate(const Network::Xml::Domain& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Domain>::generate(const Network::Xml::Domain& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Forwarder
 
@@ -1203,6 +1520,13 @@ bool Forwarder::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Forwarder::save(QXmlStreamWriter& dst_) const
+{
+	Element<Forwarder, Name::Strict<1239> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1219,7 +1543,8 @@ int Traits<Network::Xml::Forwarder>::parse(Network::Xml::Forwarder& dst_, QStack
 	return output;
 }
 
-int Traits<Network::Xml::Forwarder>::generate(const Network::Xml::Forwarder& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Forwarder>::produce(const Network::Xml::Forwarder& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAddr(), m.get<0>()))
@@ -1230,6 +1555,16 @@ int Traits<Network::Xml::Forwarder>::generate(const Network::Xml::Forwarder& src
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Forwarder>::generate(const Network::Xml::Forwarder& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Forwarder>::generate(const Network::Xml::Forwarder& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Txt
 
@@ -1263,6 +1598,13 @@ bool Txt::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Txt::save(QXmlStreamWriter& dst_) const
+{
+	Element<Txt, Name::Strict<1241> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1279,7 +1621,8 @@ int Traits<Network::Xml::Txt>::parse(Network::Xml::Txt& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Network::Xml::Txt>::generate(const Network::Xml::Txt& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Txt>::produce(const Network::Xml::Txt& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -1290,6 +1633,16 @@ int Traits<Network::Xml::Txt>::generate(const Network::Xml::Txt& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Txt>::generate(const Network::Xml::Txt& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Txt>::generate(const Network::Xml::Txt& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Srv
 
@@ -1323,6 +1676,13 @@ bool Srv::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Srv::save(QXmlStreamWriter& dst_) const
+{
+	Element<Srv, Name::Strict<1242> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1344,7 +1704,8 @@ int Traits<Network::Xml::Srv>::parse(Network::Xml::Srv& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Network::Xml::Srv>::generate(const Network::Xml::Srv& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Srv>::produce(const Network::Xml::Srv& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getService(), m.get<0>()))
@@ -1365,6 +1726,16 @@ int Traits<Network::Xml::Srv>::generate(const Network::Xml::Srv& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Srv>::generate(const Network::Xml::Srv& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Srv>::generate(const Network::Xml::Srv& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Host
 
@@ -1398,6 +1769,13 @@ bool Host::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Host::save(QXmlStreamWriter& dst_) const
+{
+	Element<Host, Name::Strict<513> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1414,7 +1792,8 @@ int Traits<Network::Xml::Host>::parse(Network::Xml::Host& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Network::Xml::Host>::generate(const Network::Xml::Host& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Host>::produce(const Network::Xml::Host& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIp(), m.get<0>()))
@@ -1425,6 +1804,16 @@ int Traits<Network::Xml::Host>::generate(const Network::Xml::Host& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Host>::generate(const Network::Xml::Host& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Host>::generate(const Network::Xml::Host& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Dns
 
@@ -1458,6 +1847,13 @@ bool Dns::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Dns::save(QXmlStreamWriter& dst_) const
+{
+	Element<Dns, Name::Strict<1237> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1478,7 +1874,8 @@ int Traits<Network::Xml::Dns>::parse(Network::Xml::Dns& dst_, QStack<QDomElement
 	return output;
 }
 
-int Traits<Network::Xml::Dns>::generate(const Network::Xml::Dns& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Dns>::produce(const Network::Xml::Dns& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getEnable(), m.get<0>()))
@@ -1497,6 +1894,16 @@ int Traits<Network::Xml::Dns>::generate(const Network::Xml::Dns& src_, QDomEleme
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Dns>::generate(const Network::Xml::Dns& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Dns>::generate(const Network::Xml::Dns& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Port1
 
@@ -1530,6 +1937,13 @@ bool Port1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Port1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Port1, Name::Strict<212> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1545,7 +1959,8 @@ int Traits<Network::Xml::Port1>::parse(Network::Xml::Port1& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Network::Xml::Port1>::generate(const Network::Xml::Port1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Port1>::produce(const Network::Xml::Port1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIsolated(), m.get<0>()))
@@ -1554,6 +1969,16 @@ int Traits<Network::Xml::Port1>::generate(const Network::Xml::Port1& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Port1>::generate(const Network::Xml::Port1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Port1>::generate(const Network::Xml::Port1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Lease
 
@@ -1591,6 +2016,13 @@ bool Lease::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Lease::save(QXmlStreamWriter& dst_) const
+{
+	Element<Lease, Name::Strict<465> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1607,7 +2039,8 @@ int Traits<Network::Xml::Lease>::parse(Network::Xml::Lease& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Network::Xml::Lease>::generate(const Network::Xml::Lease& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Lease>::produce(const Network::Xml::Lease& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getExpiry(), m.get<0>()))
@@ -1618,6 +2051,16 @@ int Traits<Network::Xml::Lease>::generate(const Network::Xml::Lease& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Lease>::generate(const Network::Xml::Lease& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Lease>::generate(const Network::Xml::Lease& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Range
 
@@ -1651,6 +2094,13 @@ bool Range::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Range::save(QXmlStreamWriter& dst_) const
+{
+	Element<Range, Name::Strict<1250> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1668,7 +2118,8 @@ int Traits<Network::Xml::Range>::parse(Network::Xml::Range& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Network::Xml::Range>::generate(const Network::Xml::Range& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Range>::produce(const Network::Xml::Range& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getStart(), m.get<0>()))
@@ -1681,6 +2132,16 @@ int Traits<Network::Xml::Range>::generate(const Network::Xml::Range& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Range>::generate(const Network::Xml::Range& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Range>::generate(const Network::Xml::Range& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Host2405
 
@@ -1696,7 +2157,8 @@ int Traits<Network::Xml::Host2405>::parse(Network::Xml::Host2405& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Network::Xml::Host2405>::generate(const Network::Xml::Host2405& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Host2405>::produce(const Network::Xml::Host2405& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getChoice7134(), m.get<0>()))
@@ -1707,6 +2169,16 @@ int Traits<Network::Xml::Host2405>::generate(const Network::Xml::Host2405& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Host2405>::generate(const Network::Xml::Host2405& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Host2405>::generate(const Network::Xml::Host2405& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Lease1
 
@@ -1744,6 +2216,13 @@ bool Lease1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Lease1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Lease1, Name::Strict<465> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1760,7 +2239,8 @@ int Traits<Network::Xml::Lease1>::parse(Network::Xml::Lease1& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Network::Xml::Lease1>::generate(const Network::Xml::Lease1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Lease1>::produce(const Network::Xml::Lease1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getExpiry(), m.get<0>()))
@@ -1771,6 +2251,16 @@ int Traits<Network::Xml::Lease1>::generate(const Network::Xml::Lease1& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Lease1>::generate(const Network::Xml::Lease1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Lease1>::generate(const Network::Xml::Lease1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Host1
 
@@ -1804,6 +2294,13 @@ bool Host1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Host1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Host1, Name::Strict<513> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1821,7 +2318,8 @@ int Traits<Network::Xml::Host1>::parse(Network::Xml::Host1& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Network::Xml::Host1>::generate(const Network::Xml::Host1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Host1>::produce(const Network::Xml::Host1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getHost(), m.get<0>()))
@@ -1834,6 +2332,16 @@ int Traits<Network::Xml::Host1>::generate(const Network::Xml::Host1& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Host1>::generate(const Network::Xml::Host1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Host1>::generate(const Network::Xml::Host1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Bootp
 
@@ -1867,6 +2375,13 @@ bool Bootp::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Bootp::save(QXmlStreamWriter& dst_) const
+{
+	Element<Bootp, Name::Strict<1256> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1883,7 +2398,8 @@ int Traits<Network::Xml::Bootp>::parse(Network::Xml::Bootp& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Network::Xml::Bootp>::generate(const Network::Xml::Bootp& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Bootp>::produce(const Network::Xml::Bootp& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFile(), m.get<0>()))
@@ -1894,6 +2410,16 @@ int Traits<Network::Xml::Bootp>::generate(const Network::Xml::Bootp& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Bootp>::generate(const Network::Xml::Bootp& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Bootp>::generate(const Network::Xml::Bootp& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Dhcp
 
@@ -1927,6 +2453,13 @@ bool Dhcp::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Dhcp::save(QXmlStreamWriter& dst_) const
+{
+	Element<Dhcp, Name::Strict<1249> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -1944,7 +2477,8 @@ int Traits<Network::Xml::Dhcp>::parse(Network::Xml::Dhcp& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Network::Xml::Dhcp>::generate(const Network::Xml::Dhcp& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Dhcp>::produce(const Network::Xml::Dhcp& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getRangeList(), m.get<0>()))
@@ -1957,6 +2491,16 @@ int Traits<Network::Xml::Dhcp>::generate(const Network::Xml::Dhcp& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Dhcp>::generate(const Network::Xml::Dhcp& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Dhcp>::generate(const Network::Xml::Dhcp& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Ip
 
@@ -1990,6 +2534,13 @@ bool Ip::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Ip::save(QXmlStreamWriter& dst_) const
+{
+	Element<Ip, Name::Strict<689> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -2010,7 +2561,8 @@ int Traits<Network::Xml::Ip>::parse(Network::Xml::Ip& dst_, QStack<QDomElement>&
 	return output;
 }
 
-int Traits<Network::Xml::Ip>::generate(const Network::Xml::Ip& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Ip>::produce(const Network::Xml::Ip& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAddress(), m.get<0>()))
@@ -2029,6 +2581,16 @@ int Traits<Network::Xml::Ip>::generate(const Network::Xml::Ip& src_, QDomElement
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Ip>::generate(const Network::Xml::Ip& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Ip>::generate(const Network::Xml::Ip& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Route
 
@@ -2062,6 +2624,13 @@ bool Route::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Route::save(QXmlStreamWriter& dst_) const
+{
+	Element<Route, Name::Strict<1230> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -2081,7 +2650,8 @@ int Traits<Network::Xml::Route>::parse(Network::Xml::Route& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Network::Xml::Route>::generate(const Network::Xml::Route& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Route>::produce(const Network::Xml::Route& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFamily(), m.get<0>()))
@@ -2098,6 +2668,16 @@ int Traits<Network::Xml::Route>::generate(const Network::Xml::Route& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Route>::generate(const Network::Xml::Route& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Route>::generate(const Network::Xml::Route& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Network
 
@@ -2131,6 +2711,13 @@ bool Network::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Network::save(QXmlStreamWriter& dst_) const
+{
+	Element<Network, Name::Strict<445> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Network
@@ -2165,7 +2752,8 @@ int Traits<Network::Xml::Network>::parse(Network::Xml::Network& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Network::Xml::Network>::generate(const Network::Xml::Network& src_, QDomElement& dst_)
+template<class D>
+int Traits<Network::Xml::Network>::produce(const Network::Xml::Network& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getConnections(), m.get<0>()))
@@ -2212,4 +2800,14 @@ int Traits<Network::Xml::Network>::generate(const Network::Xml::Network& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Network::Xml::Network>::generate(const Network::Xml::Network& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Network::Xml::Network>::generate(const Network::Xml::Network& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 } // namespace Libvirt
@@ -85,6 +85,7 @@ struct Bridge
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PDeviceName::value_type > m_name;
@@ -125,6 +126,7 @@ struct Interface
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PDeviceName::value_type m_dev;
@@ -225,6 +227,7 @@ struct Address
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	Pciaddress m_pciaddress;
@@ -275,6 +278,7 @@ struct Address1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PIpv4Addr::value_type m_start;
@@ -314,6 +318,7 @@ struct Port
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PPort::value_type m_start;
@@ -359,6 +364,7 @@ struct Nat
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_ipv6;
@@ -437,6 +443,7 @@ struct Forward
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PDeviceName::value_type > m_dev;
@@ -495,6 +502,7 @@ struct Parameters
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<VUint8 > m_managerid;
@@ -526,6 +534,7 @@ struct Parameters1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PVirtualPortProfileID::value_type > m_profileid;
@@ -562,6 +571,7 @@ struct Parameters2
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PVirtualPortProfileID::value_type > m_profileid;
@@ -631,6 +641,7 @@ struct Parameters3
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<VUint8 > m_managerid;
@@ -664,6 +675,7 @@ struct Virtualport
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<Parameters3 > m_parameters;
@@ -729,6 +741,7 @@ struct BandwidthAttributes
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PSpeed::value_type > m_average;
@@ -776,6 +789,7 @@ struct Bandwidth
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PPositiveInteger::value_type > m_classID;
@@ -816,6 +830,7 @@ struct Tag
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PId::value_type m_id;
@@ -885,6 +900,7 @@ struct Portgroup
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PDeviceName::value_type m_name;
@@ -926,6 +942,7 @@ struct Domain
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PDnsName::value_type m_name;
@@ -963,6 +980,7 @@ struct Forwarder
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<VIpAddr > m_addr;
@@ -1000,6 +1018,7 @@ struct Txt
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PDnsName::value_type m_name;
@@ -1077,6 +1096,7 @@ struct Srv
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QString m_service;
@@ -1119,6 +1139,7 @@ struct Host
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VIpAddr m_ip;
@@ -1188,6 +1209,7 @@ struct Dns
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_enable;
@@ -1221,6 +1243,7 @@ struct Port1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EVirYesNo > m_isolated;
@@ -1272,6 +1295,7 @@ struct Lease
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedLong::value_type m_expiry;
@@ -1317,6 +1341,7 @@ struct Range
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VIpAddr m_start;
@@ -1417,6 +1442,7 @@ struct Lease1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedLong::value_type m_expiry;
@@ -1462,6 +1488,7 @@ struct Host1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VHost m_host;
@@ -1500,6 +1527,7 @@ struct Bootp
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PFilePath::value_type m_file;
@@ -1545,6 +1573,7 @@ struct Dhcp
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QList<Range > m_rangeList;
@@ -1615,6 +1644,7 @@ struct Ip
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<VIpAddr > m_address;
@@ -1693,6 +1723,7 @@ struct Route
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PAddrFamily::value_type > m_family;
@@ -1877,6 +1908,7 @@ struct Network
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PConnections::value_type > m_connections;
@@ -1914,6 +1946,10 @@ struct Traits<Network::Xml::Bridge>
 
 	static int parse(Network::Xml::Bridge& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Bridge& , QDomElement& );
+	static int generate(const Network::Xml::Bridge& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Bridge& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1926,6 +1962,10 @@ struct Traits<Network::Xml::Interface>
 
 	static int parse(Network::Xml::Interface& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Interface& , QDomElement& );
+	static int generate(const Network::Xml::Interface& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Interface& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1938,6 +1978,10 @@ struct Traits<Network::Xml::Pciaddress>
 
 	static int parse(Network::Xml::Pciaddress& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Pciaddress& , QDomElement& );
+	static int generate(const Network::Xml::Pciaddress& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Pciaddress& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1950,6 +1994,10 @@ struct Traits<Network::Xml::Address>
 
 	static int parse(Network::Xml::Address& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Address& , QDomElement& );
+	static int generate(const Network::Xml::Address& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Address& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1962,6 +2010,10 @@ struct Traits<Network::Xml::Address1>
 
 	static int parse(Network::Xml::Address1& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Address1& , QDomElement& );
+	static int generate(const Network::Xml::Address1& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Address1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1974,6 +2026,10 @@ struct Traits<Network::Xml::Port>
 
 	static int parse(Network::Xml::Port& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Port& , QDomElement& );
+	static int generate(const Network::Xml::Port& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Port& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1986,6 +2042,10 @@ struct Traits<Network::Xml::Nat>
 
 	static int parse(Network::Xml::Nat& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Nat& , QDomElement& );
+	static int generate(const Network::Xml::Nat& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Nat& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1998,6 +2058,10 @@ struct Traits<Network::Xml::Forward>
 
 	static int parse(Network::Xml::Forward& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Forward& , QDomElement& );
+	static int generate(const Network::Xml::Forward& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Forward& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2010,6 +2074,10 @@ struct Traits<Network::Xml::Parameters>
 
 	static int parse(Network::Xml::Parameters& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Parameters& , QDomElement& );
+	static int generate(const Network::Xml::Parameters& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Parameters& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2022,6 +2090,10 @@ struct Traits<Network::Xml::Parameters1>
 
 	static int parse(Network::Xml::Parameters1& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Parameters1& , QDomElement& );
+	static int generate(const Network::Xml::Parameters1& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Parameters1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2034,6 +2106,10 @@ struct Traits<Network::Xml::Parameters2>
 
 	static int parse(Network::Xml::Parameters2& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Parameters2& , QDomElement& );
+	static int generate(const Network::Xml::Parameters2& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Parameters2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2046,6 +2122,10 @@ struct Traits<Network::Xml::Parameters3>
 
 	static int parse(Network::Xml::Parameters3& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Parameters3& , QDomElement& );
+	static int generate(const Network::Xml::Parameters3& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Parameters3& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2058,6 +2138,10 @@ struct Traits<Network::Xml::Virtualport>
 
 	static int parse(Network::Xml::Virtualport& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Virtualport& , QDomElement& );
+	static int generate(const Network::Xml::Virtualport& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Virtualport& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2070,6 +2154,10 @@ struct Traits<Network::Xml::BandwidthAttributes>
 
 	static int parse(Network::Xml::BandwidthAttributes& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::BandwidthAttributes& , QDomElement& );
+	static int generate(const Network::Xml::BandwidthAttributes& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::BandwidthAttributes& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2082,6 +2170,10 @@ struct Traits<Network::Xml::Bandwidth>
 
 	static int parse(Network::Xml::Bandwidth& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Bandwidth& , QDomElement& );
+	static int generate(const Network::Xml::Bandwidth& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Bandwidth& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2094,6 +2186,10 @@ struct Traits<Network::Xml::Tag>
 
 	static int parse(Network::Xml::Tag& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Tag& , QDomElement& );
+	static int generate(const Network::Xml::Tag& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Tag& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2106,6 +2202,10 @@ struct Traits<Network::Xml::Portgroup>
 
 	static int parse(Network::Xml::Portgroup& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Portgroup& , QDomElement& );
+	static int generate(const Network::Xml::Portgroup& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Portgroup& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2118,6 +2218,10 @@ struct Traits<Network::Xml::Domain>
 
 	static int parse(Network::Xml::Domain& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Domain& , QDomElement& );
+	static int generate(const Network::Xml::Domain& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Domain& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2130,6 +2234,10 @@ struct Traits<Network::Xml::Forwarder>
 
 	static int parse(Network::Xml::Forwarder& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Forwarder& , QDomElement& );
+	static int generate(const Network::Xml::Forwarder& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Forwarder& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2142,6 +2250,10 @@ struct Traits<Network::Xml::Txt>
 
 	static int parse(Network::Xml::Txt& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Txt& , QDomElement& );
+	static int generate(const Network::Xml::Txt& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Txt& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2154,6 +2266,10 @@ struct Traits<Network::Xml::Srv>
 
 	static int parse(Network::Xml::Srv& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Srv& , QDomElement& );
+	static int generate(const Network::Xml::Srv& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Srv& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2166,6 +2282,10 @@ struct Traits<Network::Xml::Host>
 
 	static int parse(Network::Xml::Host& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Host& , QDomElement& );
+	static int generate(const Network::Xml::Host& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Host& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2178,6 +2298,10 @@ struct Traits<Network::Xml::Dns>
 
 	static int parse(Network::Xml::Dns& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Dns& , QDomElement& );
+	static int generate(const Network::Xml::Dns& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Dns& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2190,6 +2314,10 @@ struct Traits<Network::Xml::Port1>
 
 	static int parse(Network::Xml::Port1& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Port1& , QDomElement& );
+	static int generate(const Network::Xml::Port1& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Port1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2202,6 +2330,10 @@ struct Traits<Network::Xml::Lease>
 
 	static int parse(Network::Xml::Lease& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Lease& , QDomElement& );
+	static int generate(const Network::Xml::Lease& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Lease& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2214,6 +2346,10 @@ struct Traits<Network::Xml::Range>
 
 	static int parse(Network::Xml::Range& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Range& , QDomElement& );
+	static int generate(const Network::Xml::Range& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Range& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2226,6 +2362,10 @@ struct Traits<Network::Xml::Host2405>
 
 	static int parse(Network::Xml::Host2405& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Host2405& , QDomElement& );
+	static int generate(const Network::Xml::Host2405& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Host2405& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2238,6 +2378,10 @@ struct Traits<Network::Xml::Lease1>
 
 	static int parse(Network::Xml::Lease1& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Lease1& , QDomElement& );
+	static int generate(const Network::Xml::Lease1& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Lease1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2250,6 +2394,10 @@ struct Traits<Network::Xml::Host1>
 
 	static int parse(Network::Xml::Host1& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Host1& , QDomElement& );
+	static int generate(const Network::Xml::Host1& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Host1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2262,6 +2410,10 @@ struct Traits<Network::Xml::Bootp>
 
 	static int parse(Network::Xml::Bootp& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Bootp& , QDomElement& );
+	static int generate(const Network::Xml::Bootp& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Bootp& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2274,6 +2426,10 @@ struct Traits<Network::Xml::Dhcp>
 
 	static int parse(Network::Xml::Dhcp& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Dhcp& , QDomElement& );
+	static int generate(const Network::Xml::Dhcp& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Dhcp& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2286,6 +2442,10 @@ struct Traits<Network::Xml::Ip>
 
 	static int parse(Network::Xml::Ip& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Ip& , QDomElement& );
+	static int generate(const Network::Xml::Ip& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Ip& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2298,6 +2458,10 @@ struct Traits<Network::Xml::Route>
 
 	static int parse(Network::Xml::Route& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Route& , QDomElement& );
+	static int generate(const Network::Xml::Route& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Route& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2310,6 +2474,10 @@ struct Traits<Network::Xml::Network>
 
 	static int parse(Network::Xml::Network& , QStack<QDomElement>& );
 	static int generate(const Network::Xml::Network& , QDomElement& );
+	static int generate(const Network::Xml::Network& , Stream& );
+
+	template<class D>
+	static int produce(const Network::Xml::Network& , D& );
 };
 
 } // namespace Libvirt
@@ -23,64 +23,292 @@
  */
 
 #include "nodedev_enum.h"
-#include <boost/assign/list_of.hpp>
 
-namespace ba = boost::assign;
 namespace Libvirt
 {
 template<>
-Enum<Nodedev::Xml::EType>::data_type Enum<Nodedev::Xml::EType>::getData()
+QString Enum<Nodedev::Xml::EType>::getText(Nodedev::Xml::EType value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Nodedev::Xml::ETypePciBridge, "pci-bridge"))
-			(data_type::value_type(Nodedev::Xml::ETypeCardbusBridge, "cardbus-bridge"));
+	switch (value_)
+	{
+	case Nodedev::Xml::ETypePciBridge:
+		return QStringLiteral("pci-bridge");
+	case Nodedev::Xml::ETypeCardbusBridge:
+		return QStringLiteral("cardbus-bridge");
+	}
+	return QString();
 }
 
 template<>
-Enum<Nodedev::Xml::EDeviceAPI>::data_type Enum<Nodedev::Xml::EDeviceAPI>::getData()
+int Enum<Nodedev::Xml::EType>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Nodedev::Xml::EDeviceAPIVfioPci, "vfio-pci"))
-			(data_type::value_type(Nodedev::Xml::EDeviceAPIVfioCcw, "vfio-ccw"))
-			(data_type::value_type(Nodedev::Xml::EDeviceAPIVfioAp, "vfio-ap"));
+	switch (text_.size())
+	{
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("pci-bridge"))
+				return Nodedev::Xml::ETypePciBridge;
+			break;
+		}
+		break;
+	case 14:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("cardbus-bridge"))
+				return Nodedev::Xml::ETypeCardbusBridge;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Nodedev::Xml::EValidity>::data_type Enum<Nodedev::Xml::EValidity>::getData()
+QString Enum<Nodedev::Xml::EDeviceAPI>::getText(Nodedev::Xml::EDeviceAPI value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Nodedev::Xml::EValidityCap, "cap"))
-			(data_type::value_type(Nodedev::Xml::EValiditySta, "sta"));
+	switch (value_)
+	{
+	case Nodedev::Xml::EDeviceAPIVfioPci:
+		return QStringLiteral("vfio-pci");
+	case Nodedev::Xml::EDeviceAPIVfioCcw:
+		return QStringLiteral("vfio-ccw");
+	case Nodedev::Xml::EDeviceAPIVfioAp:
+		return QStringLiteral("vfio-ap");
+	}
+	return QString();
 }
 
 template<>
-Enum<Nodedev::Xml::EState>::data_type Enum<Nodedev::Xml::EState>::getData()
+int Enum<Nodedev::Xml::EDeviceAPI>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Nodedev::Xml::EStateUnknown, "unknown"))
-			(data_type::value_type(Nodedev::Xml::EStateNotpresent, "notpresent"))
-			(data_type::value_type(Nodedev::Xml::EStateDown, "down"))
-			(data_type::value_type(Nodedev::Xml::EStateLowerlayerdown, "lowerlayerdown"))
-			(data_type::value_type(Nodedev::Xml::EStateTesting, "testing"))
-			(data_type::value_type(Nodedev::Xml::EStateDormant, "dormant"))
-			(data_type::value_type(Nodedev::Xml::EStateUp, "up"));
+	switch (text_.size())
+	{
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("vfio-ap"))
+				return Nodedev::Xml::EDeviceAPIVfioAp;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'v':
+			if (text_ == QLatin1String("vfio-pci"))
+				return Nodedev::Xml::EDeviceAPIVfioPci;
+			if (text_ == QLatin1String("vfio-ccw"))
+				return Nodedev::Xml::EDeviceAPIVfioCcw;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Nodedev::Xml::EMediaAvailable>::data_type Enum<Nodedev::Xml::EMediaAvailable>::getData()
+QString Enum<Nodedev::Xml::EValidity>::getText(Nodedev::Xml::EValidity value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Nodedev::Xml::EMediaAvailable1, "1"))
-			(data_type::value_type(Nodedev::Xml::EMediaAvailable0, "0"));
+	switch (value_)
+	{
+	case Nodedev::Xml::EValidityCap:
+		return QStringLiteral("cap");
+	case Nodedev::Xml::EValiditySta:
+		return QStringLiteral("sta");
+	}
+	return QString();
 }
 
 template<>
-Enum<Nodedev::Xml::EType1>::data_type Enum<Nodedev::Xml::EType1>::getData()
+int Enum<Nodedev::Xml::EValidity>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Nodedev::Xml::EType1Primary, "primary"))
-			(data_type::value_type(Nodedev::Xml::EType1Control, "control"))
-			(data_type::value_type(Nodedev::Xml::EType1Render, "render"));
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("cap"))
+				return Nodedev::Xml::EValidityCap;
+			break;
+		case 's':
+			if (text_ == QLatin1String("sta"))
+				return Nodedev::Xml::EValiditySta;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Nodedev::Xml::EState>::getText(Nodedev::Xml::EState value_)
+{
+	switch (value_)
+	{
+	case Nodedev::Xml::EStateUnknown:
+		return QStringLiteral("unknown");
+	case Nodedev::Xml::EStateNotpresent:
+		return QStringLiteral("notpresent");
+	case Nodedev::Xml::EStateDown:
+		return QStringLiteral("down");
+	case Nodedev::Xml::EStateLowerlayerdown:
+		return QStringLiteral("lowerlayerdown");
+	case Nodedev::Xml::EStateTesting:
+		return QStringLiteral("testing");
+	case Nodedev::Xml::EStateDormant:
+		return QStringLiteral("dormant");
+	case Nodedev::Xml::EStateUp:
+		return QStringLiteral("up");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Nodedev::Xml::EState>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'u':
+			if (text_ == QLatin1String("up"))
+				return Nodedev::Xml::EStateUp;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("down"))
+				return Nodedev::Xml::EStateDown;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("dormant"))
+				return Nodedev::Xml::EStateDormant;
+			break;
+		case 't':
+			if (text_ == QLatin1String("testing"))
+				return Nodedev::Xml::EStateTesting;
+			break;
+		case 'u':
+			if (text_ == QLatin1String("unknown"))
+				return Nodedev::Xml::EStateUnknown;
+			break;
+		}
+		break;
+	case 10:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("notpresent"))
+				return Nodedev::Xml::EStateNotpresent;
+			break;
+		}
+		break;
+	case 14:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("lowerlayerdown"))
+				return Nodedev::Xml::EStateLowerlayerdown;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Nodedev::Xml::EMediaAvailable>::getText(Nodedev::Xml::EMediaAvailable value_)
+{
+	switch (value_)
+	{
+	case Nodedev::Xml::EMediaAvailable1:
+		return QStringLiteral("1");
+	case Nodedev::Xml::EMediaAvailable0:
+		return QStringLiteral("0");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Nodedev::Xml::EMediaAvailable>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 1:
+		switch (text_.at(0).unicode())
+		{
+		case '0':
+			if (text_ == QLatin1String("0"))
+				return Nodedev::Xml::EMediaAvailable0;
+			break;
+		case '1':
+			if (text_ == QLatin1String("1"))
+				return Nodedev::Xml::EMediaAvailable1;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Nodedev::Xml::EType1>::getText(Nodedev::Xml::EType1 value_)
+{
+	switch (value_)
+	{
+	case Nodedev::Xml::EType1Primary:
+		return QStringLiteral("primary");
+	case Nodedev::Xml::EType1Control:
+		return QStringLiteral("control");
+	case Nodedev::Xml::EType1Render:
+		return QStringLiteral("render");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Nodedev::Xml::EType1>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("render"))
+				return Nodedev::Xml::EType1Render;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("control"))
+				return Nodedev::Xml::EType1Control;
+			break;
+		case 'p':
+			if (text_ == QLatin1String("primary"))
+				return Nodedev::Xml::EType1Primary;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 } // namespace Libvirt
@@ -41,7 +41,8 @@ int Traits<Nodedev::Xml::Parent9130>::parse(Nodedev::Xml::Parent9130& dst_, QSta
 	return output;
 }
 
-int Traits<Nodedev::Xml::Parent9130>::generate(const Nodedev::Xml::Parent9130& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Parent9130>::produce(const Nodedev::Xml::Parent9130& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getWwnn(), m.get<0>()))
@@ -52,6 +53,16 @@ int Traits<Nodedev::Xml::Parent9130>::generate(const Nodedev::Xml::Parent9130& s
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Parent9130>::generate(const Nodedev::Xml::Parent9130& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Parent9130>::generate(const Nodedev::Xml::Parent9130& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Hardware
 
@@ -85,6 +96,13 @@ bool Hardware::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Hardware::save(QXmlStreamWriter& dst_) const
+{
+	Element<Hardware, Name::Strict<3496> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -103,7 +121,8 @@ int Traits<Nodedev::Xml::Hardware>::parse(Nodedev::Xml::Hardware& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Nodedev::Xml::Hardware>::generate(const Nodedev::Xml::Hardware& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Hardware>::produce(const Nodedev::Xml::Hardware& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getVendor(), m.get<0>()))
@@ -118,6 +137,16 @@ int Traits<Nodedev::Xml::Hardware>::generate(const Nodedev::Xml::Hardware& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Hardware>::generate(const Nodedev::Xml::Hardware& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Hardware>::generate(const Nodedev::Xml::Hardware& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Firmware
 
@@ -151,6 +180,13 @@ bool Firmware::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Firmware::save(QXmlStreamWriter& dst_) const
+{
+	Element<Firmware, Name::Strict<3497> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -168,7 +204,8 @@ int Traits<Nodedev::Xml::Firmware>::parse(Nodedev::Xml::Firmware& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Nodedev::Xml::Firmware>::generate(const Nodedev::Xml::Firmware& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Firmware>::produce(const Nodedev::Xml::Firmware& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getVendor(), m.get<0>()))
@@ -181,6 +218,16 @@ int Traits<Nodedev::Xml::Firmware>::generate(const Nodedev::Xml::Firmware& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Firmware>::generate(const Nodedev::Xml::Firmware& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Firmware>::generate(const Nodedev::Xml::Firmware& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capsystem
 
@@ -197,7 +244,8 @@ int Traits<Nodedev::Xml::Capsystem>::parse(Nodedev::Xml::Capsystem& dst_, QStack
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capsystem>::generate(const Nodedev::Xml::Capsystem& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capsystem>::produce(const Nodedev::Xml::Capsystem& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getProduct(), m.get<1>()))
@@ -210,6 +258,16 @@ int Traits<Nodedev::Xml::Capsystem>::generate(const Nodedev::Xml::Capsystem& src
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capsystem>::generate(const Nodedev::Xml::Capsystem& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capsystem>::generate(const Nodedev::Xml::Capsystem& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Product
 
@@ -243,6 +301,13 @@ bool Product::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Product::save(QXmlStreamWriter& dst_) const
+{
+	Element<Product, Name::Strict<460> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -259,7 +324,8 @@ int Traits<Nodedev::Xml::Product>::parse(Nodedev::Xml::Product& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Nodedev::Xml::Product>::generate(const Nodedev::Xml::Product& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Product>::produce(const Nodedev::Xml::Product& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -270,6 +336,16 @@ int Traits<Nodedev::Xml::Product>::generate(const Nodedev::Xml::Product& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Product>::generate(const Nodedev::Xml::Product& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Product>::generate(const Nodedev::Xml::Product& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Vendor
 
@@ -303,6 +379,13 @@ bool Vendor::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Vendor::save(QXmlStreamWriter& dst_) const
+{
+	Element<Vendor, Name::Strict<459> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -319,7 +402,8 @@ int Traits<Nodedev::Xml::Vendor>::parse(Nodedev::Xml::Vendor& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Nodedev::Xml::Vendor>::generate(const Nodedev::Xml::Vendor& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Vendor>::produce(const Nodedev::Xml::Vendor& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -330,6 +414,16 @@ int Traits<Nodedev::Xml::Vendor>::generate(const Nodedev::Xml::Vendor& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Vendor>::generate(const Nodedev::Xml::Vendor& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Vendor>::generate(const Nodedev::Xml::Vendor& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Address
 
@@ -363,6 +457,13 @@ bool Address::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Address::save(QXmlStreamWriter& dst_) const
+{
+	Element<Address, Name::Strict<111> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -381,7 +482,8 @@ int Traits<Nodedev::Xml::Address>::parse(Nodedev::Xml::Address& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Nodedev::Xml::Address>::generate(const Nodedev::Xml::Address& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Address>::produce(const Nodedev::Xml::Address& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDomain(), m.get<0>()))
@@ -396,6 +498,16 @@ int Traits<Nodedev::Xml::Address>::generate(const Nodedev::Xml::Address& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Address>::generate(const Nodedev::Xml::Address& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Address>::generate(const Nodedev::Xml::Address& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capability
 
@@ -429,6 +541,13 @@ bool Capability::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Capability::save(QXmlStreamWriter& dst_) const
+{
+	Element<Capability, Name::Strict<3467> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -445,7 +564,8 @@ int Traits<Nodedev::Xml::Capability>::parse(Nodedev::Xml::Capability& dst_, QSta
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capability>::generate(const Nodedev::Xml::Capability& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capability>::produce(const Nodedev::Xml::Capability& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMaxCount(), m.get<1>()))
@@ -456,6 +576,16 @@ int Traits<Nodedev::Xml::Capability>::generate(const Nodedev::Xml::Capability& s
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capability>::generate(const Nodedev::Xml::Capability& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capability>::generate(const Nodedev::Xml::Capability& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Type
 
@@ -493,6 +623,13 @@ bool Type::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Type::save(QXmlStreamWriter& dst_) const
+{
+	Element<Type, Name::Strict<105> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -511,7 +648,8 @@ int Traits<Nodedev::Xml::Type>::parse(Nodedev::Xml::Type& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Nodedev::Xml::Type>::generate(const Nodedev::Xml::Type& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Type>::produce(const Nodedev::Xml::Type& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -526,6 +664,16 @@ int Traits<Nodedev::Xml::Type>::generate(const Nodedev::Xml::Type& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Type>::generate(const Nodedev::Xml::Type& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Type>::generate(const Nodedev::Xml::Type& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct VendorField
 
@@ -559,6 +707,13 @@ bool VendorField::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool VendorField::save(QXmlStreamWriter& dst_) const
+{
+	Element<VendorField, Name::Strict<9512> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -575,7 +730,8 @@ int Traits<Nodedev::Xml::VendorField>::parse(Nodedev::Xml::VendorField& dst_, QS
 	return output;
 }
 
-int Traits<Nodedev::Xml::VendorField>::generate(const Nodedev::Xml::VendorField& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::VendorField>::produce(const Nodedev::Xml::VendorField& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIndex(), m.get<0>()))
@@ -586,6 +742,16 @@ int Traits<Nodedev::Xml::VendorField>::generate(const Nodedev::Xml::VendorField&
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::VendorField>::generate(const Nodedev::Xml::VendorField& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::VendorField>::generate(const Nodedev::Xml::VendorField& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Fields
 
@@ -619,6 +785,13 @@ bool Fields::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Fields::save(QXmlStreamWriter& dst_) const
+{
+	Element<Fields, Name::Strict<9507> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -638,7 +811,8 @@ int Traits<Nodedev::Xml::Fields>::parse(Nodedev::Xml::Fields& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Nodedev::Xml::Fields>::generate(const Nodedev::Xml::Fields& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Fields>::produce(const Nodedev::Xml::Fields& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getChangeLevel(), m.get<1>()))
@@ -655,6 +829,16 @@ int Traits<Nodedev::Xml::Fields>::generate(const Nodedev::Xml::Fields& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Fields>::generate(const Nodedev::Xml::Fields& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Fields>::generate(const Nodedev::Xml::Fields& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct VendorField1
 
@@ -688,6 +872,13 @@ bool VendorField1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool VendorField1::save(QXmlStreamWriter& dst_) const
+{
+	Element<VendorField1, Name::Strict<9512> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -704,7 +895,8 @@ int Traits<Nodedev::Xml::VendorField1>::parse(Nodedev::Xml::VendorField1& dst_,
 	return output;
 }
 
-int Traits<Nodedev::Xml::VendorField1>::generate(const Nodedev::Xml::VendorField1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::VendorField1>::produce(const Nodedev::Xml::VendorField1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIndex(), m.get<0>()))
@@ -715,6 +907,16 @@ int Traits<Nodedev::Xml::VendorField1>::generate(const Nodedev::Xml::VendorField
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::VendorField1>::generate(const Nodedev::Xml::VendorField1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::VendorField1>::generate(const Nodedev::Xml::VendorField1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct SystemField
 
@@ -748,6 +950,13 @@ bool SystemField::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool SystemField::save(QXmlStreamWriter& dst_) const
+{
+	Element<SystemField, Name::Strict<9516> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -764,7 +973,8 @@ int Traits<Nodedev::Xml::SystemField>::parse(Nodedev::Xml::SystemField& dst_, QS
 	return output;
 }
 
-int Traits<Nodedev::Xml::SystemField>::generate(const Nodedev::Xml::SystemField& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::SystemField>::produce(const Nodedev::Xml::SystemField& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIndex(), m.get<0>()))
@@ -775,6 +985,16 @@ int Traits<Nodedev::Xml::SystemField>::generate(const Nodedev::Xml::SystemField&
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::SystemField>::generate(const Nodedev::Xml::SystemField& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::SystemField>::generate(const Nodedev::Xml::SystemField& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Fields1
 
@@ -808,6 +1028,13 @@ bool Fields1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Fields1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Fields1, Name::Strict<9507> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -825,7 +1052,8 @@ int Traits<Nodedev::Xml::Fields1>::parse(Nodedev::Xml::Fields1& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Nodedev::Xml::Fields1>::generate(const Nodedev::Xml::Fields1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Fields1>::produce(const Nodedev::Xml::Fields1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getAssetTag(), m.get<1>()))
@@ -838,6 +1066,16 @@ int Traits<Nodedev::Xml::Fields1>::generate(const Nodedev::Xml::Fields1& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Fields1>::generate(const Nodedev::Xml::Fields1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Fields1>::generate(const Nodedev::Xml::Fields1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capability1
 
@@ -871,6 +1109,13 @@ bool Capability1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Capability1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Capability1, Name::Strict<3467> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -888,7 +1133,8 @@ int Traits<Nodedev::Xml::Capability1>::parse(Nodedev::Xml::Capability1& dst_, QS
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capability1>::generate(const Nodedev::Xml::Capability1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capability1>::produce(const Nodedev::Xml::Capability1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<1>()))
@@ -901,6 +1147,16 @@ int Traits<Nodedev::Xml::Capability1>::generate(const Nodedev::Xml::Capability1&
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capability1>::generate(const Nodedev::Xml::Capability1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capability1>::generate(const Nodedev::Xml::Capability1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct IommuGroup
 
@@ -938,6 +1194,13 @@ bool IommuGroup::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool IommuGroup::save(QXmlStreamWriter& dst_) const
+{
+	Element<IommuGroup, Name::Strict<3509> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -954,7 +1217,8 @@ int Traits<Nodedev::Xml::IommuGroup>::parse(Nodedev::Xml::IommuGroup& dst_, QSta
 	return output;
 }
 
-int Traits<Nodedev::Xml::IommuGroup>::generate(const Nodedev::Xml::IommuGroup& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::IommuGroup>::produce(const Nodedev::Xml::IommuGroup& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getNumber(), m.get<0>()))
@@ -965,6 +1229,16 @@ int Traits<Nodedev::Xml::IommuGroup>::generate(const Nodedev::Xml::IommuGroup& s
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::IommuGroup>::generate(const Nodedev::Xml::IommuGroup& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::IommuGroup>::generate(const Nodedev::Xml::IommuGroup& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Numa
 
@@ -998,6 +1272,13 @@ bool Numa::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Numa::save(QXmlStreamWriter& dst_) const
+{
+	Element<Numa, Name::Strict<1031> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -1013,7 +1294,8 @@ int Traits<Nodedev::Xml::Numa>::parse(Nodedev::Xml::Numa& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Nodedev::Xml::Numa>::generate(const Nodedev::Xml::Numa& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Numa>::produce(const Nodedev::Xml::Numa& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getNode(), m.get<0>()))
@@ -1022,6 +1304,16 @@ int Traits<Nodedev::Xml::Numa>::generate(const Nodedev::Xml::Numa& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Numa>::generate(const Nodedev::Xml::Numa& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Numa>::generate(const Nodedev::Xml::Numa& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Link
 
@@ -1059,6 +1351,13 @@ bool Link::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Link::save(QXmlStreamWriter& dst_) const
+{
+	Element<Link, Name::Strict<124> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -1077,7 +1376,8 @@ int Traits<Nodedev::Xml::Link>::parse(Nodedev::Xml::Link& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Nodedev::Xml::Link>::generate(const Nodedev::Xml::Link& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Link>::produce(const Nodedev::Xml::Link& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getValidity(), m.get<0>()))
@@ -1092,6 +1392,16 @@ int Traits<Nodedev::Xml::Link>::generate(const Nodedev::Xml::Link& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Link>::generate(const Nodedev::Xml::Link& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Link>::generate(const Nodedev::Xml::Link& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Cappcidev
 
@@ -1132,7 +1442,8 @@ int Traits<Nodedev::Xml::Cappcidev>::parse(Nodedev::Xml::Cappcidev& dst_, QStack
 	return output;
 }
 
-int Traits<Nodedev::Xml::Cappcidev>::generate(const Nodedev::Xml::Cappcidev& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Cappcidev>::produce(const Nodedev::Xml::Cappcidev& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getClass(), m.get<1>()))
@@ -1169,6 +1480,16 @@ int Traits<Nodedev::Xml::Cappcidev>::generate(const Nodedev::Xml::Cappcidev& src
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Cappcidev>::generate(const Nodedev::Xml::Cappcidev& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Cappcidev>::generate(const Nodedev::Xml::Cappcidev& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Product1
 
@@ -1202,6 +1523,13 @@ bool Product1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Product1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Product1, Name::Strict<460> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -1218,7 +1546,8 @@ int Traits<Nodedev::Xml::Product1>::parse(Nodedev::Xml::Product1& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Nodedev::Xml::Product1>::generate(const Nodedev::Xml::Product1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Product1>::produce(const Nodedev::Xml::Product1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -1229,6 +1558,16 @@ int Traits<Nodedev::Xml::Product1>::generate(const Nodedev::Xml::Product1& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Product1>::generate(const Nodedev::Xml::Product1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Product1>::generate(const Nodedev::Xml::Product1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Vendor1
 
@@ -1262,6 +1601,13 @@ bool Vendor1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Vendor1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Vendor1, Name::Strict<459> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -1278,7 +1624,8 @@ int Traits<Nodedev::Xml::Vendor1>::parse(Nodedev::Xml::Vendor1& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Nodedev::Xml::Vendor1>::generate(const Nodedev::Xml::Vendor1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Vendor1>::produce(const Nodedev::Xml::Vendor1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getId(), m.get<0>()))
@@ -1289,6 +1636,16 @@ int Traits<Nodedev::Xml::Vendor1>::generate(const Nodedev::Xml::Vendor1& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Vendor1>::generate(const Nodedev::Xml::Vendor1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Vendor1>::generate(const Nodedev::Xml::Vendor1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capusbdev
 
@@ -1318,7 +1675,8 @@ int Traits<Nodedev::Xml::Capusbdev>::parse(Nodedev::Xml::Capusbdev& dst_, QStack
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capusbdev>::generate(const Nodedev::Xml::Capusbdev& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capusbdev>::produce(const Nodedev::Xml::Capusbdev& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBus(), m.get<1>()))
@@ -1333,6 +1691,16 @@ int Traits<Nodedev::Xml::Capusbdev>::generate(const Nodedev::Xml::Capusbdev& src
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capusbdev>::generate(const Nodedev::Xml::Capusbdev& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capusbdev>::generate(const Nodedev::Xml::Capusbdev& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capusbinterface
 
@@ -1363,7 +1731,8 @@ int Traits<Nodedev::Xml::Capusbinterface>::parse(Nodedev::Xml::Capusbinterface&
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capusbinterface>::generate(const Nodedev::Xml::Capusbinterface& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capusbinterface>::produce(const Nodedev::Xml::Capusbinterface& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getNumber(), m.get<1>()))
@@ -1380,6 +1749,16 @@ int Traits<Nodedev::Xml::Capusbinterface>::generate(const Nodedev::Xml::Capusbin
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capusbinterface>::generate(const Nodedev::Xml::Capusbinterface& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capusbinterface>::generate(const Nodedev::Xml::Capusbinterface& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Link1
 
@@ -1413,6 +1792,13 @@ bool Link1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Link1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Link1, Name::Strict<124> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -1429,7 +1815,8 @@ int Traits<Nodedev::Xml::Link1>::parse(Nodedev::Xml::Link1& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Nodedev::Xml::Link1>::generate(const Nodedev::Xml::Link1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Link1>::produce(const Nodedev::Xml::Link1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSpeed(), m.get<0>()))
@@ -1440,6 +1827,16 @@ int Traits<Nodedev::Xml::Link1>::generate(const Nodedev::Xml::Link1& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Link1>::generate(const Nodedev::Xml::Link1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Link1>::generate(const Nodedev::Xml::Link1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capability9164
 
@@ -1449,12 +1846,23 @@ int Traits<Nodedev::Xml::Capability9164>::parse(Nodedev::Xml::Capability9164& ,
 	return m.consume(stack_);
 }
 
-int Traits<Nodedev::Xml::Capability9164>::generate(const Nodedev::Xml::Capability9164& , QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capability9164>::produce(const Nodedev::Xml::Capability9164& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capability9164>::generate(const Nodedev::Xml::Capability9164& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capability9164>::generate(const Nodedev::Xml::Capability9164& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capability9165
 
@@ -1464,12 +1872,23 @@ int Traits<Nodedev::Xml::Capability9165>::parse(Nodedev::Xml::Capability9165& ,
 	return m.consume(stack_);
 }
 
-int Traits<Nodedev::Xml::Capability9165>::generate(const Nodedev::Xml::Capability9165& , QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capability9165>::produce(const Nodedev::Xml::Capability9165& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capability9165>::generate(const Nodedev::Xml::Capability9165& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capability9165>::generate(const Nodedev::Xml::Capability9165& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capnet
 
@@ -1488,7 +1907,8 @@ int Traits<Nodedev::Xml::Capnet>::parse(Nodedev::Xml::Capnet& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capnet>::generate(const Nodedev::Xml::Capnet& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capnet>::produce(const Nodedev::Xml::Capnet& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getInterface(), m.get<1>()))
@@ -1505,6 +1925,16 @@ int Traits<Nodedev::Xml::Capnet>::generate(const Nodedev::Xml::Capnet& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capnet>::generate(const Nodedev::Xml::Capnet& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capnet>::generate(const Nodedev::Xml::Capnet& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capsfchost
 
@@ -1521,7 +1951,8 @@ int Traits<Nodedev::Xml::Capsfchost>::parse(Nodedev::Xml::Capsfchost& dst_, QSta
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capsfchost>::generate(const Nodedev::Xml::Capsfchost& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capsfchost>::produce(const Nodedev::Xml::Capsfchost& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getWwnn(), m.get<1>()))
@@ -1534,6 +1965,16 @@ int Traits<Nodedev::Xml::Capsfchost>::generate(const Nodedev::Xml::Capsfchost& s
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capsfchost>::generate(const Nodedev::Xml::Capsfchost& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capsfchost>::generate(const Nodedev::Xml::Capsfchost& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capsvports
 
@@ -1561,7 +2002,8 @@ int Traits<Nodedev::Xml::Capsvports>::parse(Nodedev::Xml::Capsvports& dst_, QSta
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capsvports>::generate(const Nodedev::Xml::Capsvports& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capsvports>::produce(const Nodedev::Xml::Capsvports& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMaxVports(), m.get<1>()))
@@ -1572,6 +2014,16 @@ int Traits<Nodedev::Xml::Capsvports>::generate(const Nodedev::Xml::Capsvports& s
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capsvports>::generate(const Nodedev::Xml::Capsvports& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capsvports>::generate(const Nodedev::Xml::Capsvports& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capscsihost
 
@@ -1600,7 +2052,8 @@ int Traits<Nodedev::Xml::Capscsihost>::parse(Nodedev::Xml::Capscsihost& dst_, QS
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capscsihost>::generate(const Nodedev::Xml::Capscsihost& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capscsihost>::produce(const Nodedev::Xml::Capscsihost& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getHost(), m.get<1>()))
@@ -1613,6 +2066,16 @@ int Traits<Nodedev::Xml::Capscsihost>::generate(const Nodedev::Xml::Capscsihost&
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capscsihost>::generate(const Nodedev::Xml::Capscsihost& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capscsihost>::generate(const Nodedev::Xml::Capscsihost& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capsfcrport
 
@@ -1646,6 +2109,13 @@ bool Capsfcrport::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Capsfcrport::save(QXmlStreamWriter& dst_) const
+{
+	Element<Capsfcrport, Name::Strict<3467> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -1662,7 +2132,8 @@ int Traits<Nodedev::Xml::Capsfcrport>::parse(Nodedev::Xml::Capsfcrport& dst_, QS
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capsfcrport>::generate(const Nodedev::Xml::Capsfcrport& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capsfcrport>::produce(const Nodedev::Xml::Capsfcrport& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getRport(), m.get<1>()))
@@ -1673,6 +2144,16 @@ int Traits<Nodedev::Xml::Capsfcrport>::generate(const Nodedev::Xml::Capsfcrport&
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capsfcrport>::generate(const Nodedev::Xml::Capsfcrport& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capsfcrport>::generate(const Nodedev::Xml::Capsfcrport& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capscsitarget
 
@@ -1688,7 +2169,8 @@ int Traits<Nodedev::Xml::Capscsitarget>::parse(Nodedev::Xml::Capscsitarget& dst_
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capscsitarget>::generate(const Nodedev::Xml::Capscsitarget& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capscsitarget>::produce(const Nodedev::Xml::Capscsitarget& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getTarget(), m.get<1>()))
@@ -1699,6 +2181,16 @@ int Traits<Nodedev::Xml::Capscsitarget>::generate(const Nodedev::Xml::Capscsitar
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capscsitarget>::generate(const Nodedev::Xml::Capscsitarget& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capscsitarget>::generate(const Nodedev::Xml::Capscsitarget& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capscsi
 
@@ -1729,7 +2221,8 @@ int Traits<Nodedev::Xml::Capscsi>::parse(Nodedev::Xml::Capscsi& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capscsi>::generate(const Nodedev::Xml::Capscsi& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capscsi>::produce(const Nodedev::Xml::Capscsi& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getHost(), m.get<1>()))
@@ -1746,6 +2239,16 @@ int Traits<Nodedev::Xml::Capscsi>::generate(const Nodedev::Xml::Capscsi& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capscsi>::generate(const Nodedev::Xml::Capscsi& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capscsi>::generate(const Nodedev::Xml::Capscsi& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Anonymous5139
 
@@ -1786,7 +2289,8 @@ int Traits<Nodedev::Xml::Anonymous5139>::parse(Nodedev::Xml::Anonymous5139& dst_
 	return output;
 }
 
-int Traits<Nodedev::Xml::Anonymous5139>::generate(const Nodedev::Xml::Anonymous5139& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Anonymous5139>::produce(const Nodedev::Xml::Anonymous5139& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getLogicalBlockSize(), m.get<0>()))
@@ -1797,6 +2301,16 @@ int Traits<Nodedev::Xml::Anonymous5139>::generate(const Nodedev::Xml::Anonymous5
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Anonymous5139>::generate(const Nodedev::Xml::Anonymous5139& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Anonymous5139>::generate(const Nodedev::Xml::Anonymous5139& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capability2
 
@@ -1834,6 +2348,13 @@ bool Capability2::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Capability2::save(QXmlStreamWriter& dst_) const
+{
+	Element<Capability2, Name::Strict<3467> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -1852,7 +2373,8 @@ int Traits<Nodedev::Xml::Capability2>::parse(Nodedev::Xml::Capability2& dst_, QS
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capability2>::generate(const Nodedev::Xml::Capability2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capability2>::produce(const Nodedev::Xml::Capability2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMediaAvailable(), m.get<1>()))
@@ -1867,6 +2389,16 @@ int Traits<Nodedev::Xml::Capability2>::generate(const Nodedev::Xml::Capability2&
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capability2>::generate(const Nodedev::Xml::Capability2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capability2>::generate(const Nodedev::Xml::Capability2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capstoragefixed
 
@@ -1894,7 +2426,8 @@ int Traits<Nodedev::Xml::Capstoragefixed>::parse(Nodedev::Xml::Capstoragefixed&
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capstoragefixed>::generate(const Nodedev::Xml::Capstoragefixed& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capstoragefixed>::produce(const Nodedev::Xml::Capstoragefixed& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSize(), m.get<0>()))
@@ -1905,6 +2438,16 @@ int Traits<Nodedev::Xml::Capstoragefixed>::generate(const Nodedev::Xml::Capstora
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capstoragefixed>::generate(const Nodedev::Xml::Capstoragefixed& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capstoragefixed>::generate(const Nodedev::Xml::Capstoragefixed& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capstorage
 
@@ -1925,7 +2468,8 @@ int Traits<Nodedev::Xml::Capstorage>::parse(Nodedev::Xml::Capstorage& dst_, QSta
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capstorage>::generate(const Nodedev::Xml::Capstorage& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capstorage>::produce(const Nodedev::Xml::Capstorage& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getBlock(), m.get<1>()))
@@ -1946,6 +2490,16 @@ int Traits<Nodedev::Xml::Capstorage>::generate(const Nodedev::Xml::Capstorage& s
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capstorage>::generate(const Nodedev::Xml::Capstorage& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capstorage>::generate(const Nodedev::Xml::Capstorage& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Attr
 
@@ -1979,6 +2533,13 @@ bool Attr::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Attr::save(QXmlStreamWriter& dst_) const
+{
+	Element<Attr, Name::Strict<6884> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -1995,7 +2556,8 @@ int Traits<Nodedev::Xml::Attr>::parse(Nodedev::Xml::Attr& dst_, QStack<QDomEleme
 	return output;
 }
 
-int Traits<Nodedev::Xml::Attr>::generate(const Nodedev::Xml::Attr& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Attr>::produce(const Nodedev::Xml::Attr& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -2006,6 +2568,16 @@ int Traits<Nodedev::Xml::Attr>::generate(const Nodedev::Xml::Attr& src_, QDomEle
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Attr>::generate(const Nodedev::Xml::Attr& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Attr>::generate(const Nodedev::Xml::Attr& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capmdev
 
@@ -2023,7 +2595,8 @@ int Traits<Nodedev::Xml::Capmdev>::parse(Nodedev::Xml::Capmdev& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capmdev>::generate(const Nodedev::Xml::Capmdev& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capmdev>::produce(const Nodedev::Xml::Capmdev& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<1>()))
@@ -2038,6 +2611,16 @@ int Traits<Nodedev::Xml::Capmdev>::generate(const Nodedev::Xml::Capmdev& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capmdev>::generate(const Nodedev::Xml::Capmdev& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capmdev>::generate(const Nodedev::Xml::Capmdev& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capccwdev
 
@@ -2054,7 +2637,8 @@ int Traits<Nodedev::Xml::Capccwdev>::parse(Nodedev::Xml::Capccwdev& dst_, QStack
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capccwdev>::generate(const Nodedev::Xml::Capccwdev& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capccwdev>::produce(const Nodedev::Xml::Capccwdev& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCssid(), m.get<1>()))
@@ -2067,6 +2651,16 @@ int Traits<Nodedev::Xml::Capccwdev>::generate(const Nodedev::Xml::Capccwdev& src
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capccwdev>::generate(const Nodedev::Xml::Capccwdev& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capccwdev>::generate(const Nodedev::Xml::Capccwdev& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capcssdev
 
@@ -2084,7 +2678,8 @@ int Traits<Nodedev::Xml::Capcssdev>::parse(Nodedev::Xml::Capcssdev& dst_, QStack
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capcssdev>::generate(const Nodedev::Xml::Capcssdev& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capcssdev>::produce(const Nodedev::Xml::Capcssdev& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCssid(), m.get<1>()))
@@ -2099,6 +2694,16 @@ int Traits<Nodedev::Xml::Capcssdev>::generate(const Nodedev::Xml::Capcssdev& src
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capcssdev>::generate(const Nodedev::Xml::Capcssdev& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capcssdev>::generate(const Nodedev::Xml::Capcssdev& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Capapqueue
 
@@ -2114,7 +2719,8 @@ int Traits<Nodedev::Xml::Capapqueue>::parse(Nodedev::Xml::Capapqueue& dst_, QSta
 	return output;
 }
 
-int Traits<Nodedev::Xml::Capapqueue>::generate(const Nodedev::Xml::Capapqueue& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Capapqueue>::produce(const Nodedev::Xml::Capapqueue& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getApAdapter(), m.get<1>()))
@@ -2125,6 +2731,16 @@ int Traits<Nodedev::Xml::Capapqueue>::generate(const Nodedev::Xml::Capapqueue& s
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Capapqueue>::generate(const Nodedev::Xml::Capapqueue& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Capapqueue>::generate(const Nodedev::Xml::Capapqueue& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Device
 
@@ -2158,6 +2774,13 @@ bool Device::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Device::save(QXmlStreamWriter& dst_) const
+{
+	Element<Device, Name::Strict<354> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Nodedev
@@ -2179,7 +2802,8 @@ int Traits<Nodedev::Xml::Device>::parse(Nodedev::Xml::Device& dst_, QStack<QDomE
 	return output;
 }
 
-int Traits<Nodedev::Xml::Device>::generate(const Nodedev::Xml::Device& src_, QDomElement& dst_)
+template<class D>
+int Traits<Nodedev::Xml::Device>::produce(const Nodedev::Xml::Device& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -2200,4 +2824,14 @@ int Traits<Nodedev::Xml::Device>::generate(const Nodedev::Xml::Device& src_, QDo
 	return m.produce(dst_);
 }
 
+int Traits<Nodedev::Xml::Device>::generate(const Nodedev::Xml::Device& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Nodedev::Xml::Device>::generate(const Nodedev::Xml::Device& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 } // namespace Libvirt
@@ -124,6 +124,7 @@ struct Hardware
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<QString > m_vendor;
@@ -171,6 +172,7 @@ struct Firmware
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<QString > m_vendor;
@@ -252,6 +254,7 @@ struct Product
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PHexuint::value_type m_id;
@@ -289,6 +292,7 @@ struct Vendor
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PHexuint::value_type m_id;
@@ -342,6 +346,7 @@ struct Address
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PHexuint::value_type m_domain;
@@ -381,6 +386,7 @@ struct Capability
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PUnsignedInt::value_type > m_maxCount;
@@ -436,6 +442,7 @@ struct Type
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PId::value_type m_id;
@@ -475,6 +482,7 @@ struct VendorField
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PVendorVPDFieldIndex::value_type m_index;
@@ -536,6 +544,7 @@ struct Fields
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PVpdFieldValueFormat::value_type > m_changeLevel;
@@ -576,6 +585,7 @@ struct VendorField1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PVendorVPDFieldIndex::value_type m_index;
@@ -613,6 +623,7 @@ struct SystemField
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PSystemVPDFieldIndex::value_type m_index;
@@ -658,6 +669,7 @@ struct Fields1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PVpdFieldValueFormat::value_type > m_assetTag;
@@ -704,6 +716,7 @@ struct Capability1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PVpdFieldValueFormat::value_type m_name;
@@ -744,6 +757,7 @@ struct IommuGroup
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PUnsignedInt::value_type m_number;
@@ -773,6 +787,7 @@ struct Numa
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PNode::value_type > m_node;
@@ -827,6 +842,7 @@ struct Link
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EValidity m_validity;
@@ -1019,6 +1035,7 @@ struct Product1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PHexuint::value_type m_id;
@@ -1056,6 +1073,7 @@ struct Vendor1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PHexuint::value_type m_id;
@@ -1210,6 +1228,7 @@ struct Link1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PUnsignedInt::value_type > m_speed;
@@ -1486,6 +1505,7 @@ struct Capsfcrport
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QString m_rport;
@@ -1676,6 +1696,7 @@ struct Capability2
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EMediaAvailable m_mediaAvailable;
@@ -1843,6 +1864,7 @@ struct Attr
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QString m_name;
@@ -2114,6 +2136,7 @@ struct Device
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QString m_name;
@@ -2138,6 +2161,10 @@ struct Traits<Nodedev::Xml::Parent9130>
 
 	static int parse(Nodedev::Xml::Parent9130& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Parent9130& , QDomElement& );
+	static int generate(const Nodedev::Xml::Parent9130& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Parent9130& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2150,6 +2177,10 @@ struct Traits<Nodedev::Xml::Hardware>
 
 	static int parse(Nodedev::Xml::Hardware& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Hardware& , QDomElement& );
+	static int generate(const Nodedev::Xml::Hardware& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Hardware& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2162,6 +2193,10 @@ struct Traits<Nodedev::Xml::Firmware>
 
 	static int parse(Nodedev::Xml::Firmware& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Firmware& , QDomElement& );
+	static int generate(const Nodedev::Xml::Firmware& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Firmware& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2174,6 +2209,10 @@ struct Traits<Nodedev::Xml::Capsystem>
 
 	static int parse(Nodedev::Xml::Capsystem& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capsystem& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capsystem& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capsystem& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2186,6 +2225,10 @@ struct Traits<Nodedev::Xml::Product>
 
 	static int parse(Nodedev::Xml::Product& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Product& , QDomElement& );
+	static int generate(const Nodedev::Xml::Product& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Product& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2198,6 +2241,10 @@ struct Traits<Nodedev::Xml::Vendor>
 
 	static int parse(Nodedev::Xml::Vendor& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Vendor& , QDomElement& );
+	static int generate(const Nodedev::Xml::Vendor& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Vendor& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2210,6 +2257,10 @@ struct Traits<Nodedev::Xml::Address>
 
 	static int parse(Nodedev::Xml::Address& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Address& , QDomElement& );
+	static int generate(const Nodedev::Xml::Address& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Address& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2222,6 +2273,10 @@ struct Traits<Nodedev::Xml::Capability>
 
 	static int parse(Nodedev::Xml::Capability& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capability& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capability& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capability& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2234,6 +2289,10 @@ struct Traits<Nodedev::Xml::Type>
 
 	static int parse(Nodedev::Xml::Type& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Type& , QDomElement& );
+	static int generate(const Nodedev::Xml::Type& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Type& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2246,6 +2305,10 @@ struct Traits<Nodedev::Xml::VendorField>
 
 	static int parse(Nodedev::Xml::VendorField& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::VendorField& , QDomElement& );
+	static int generate(const Nodedev::Xml::VendorField& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::VendorField& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2258,6 +2321,10 @@ struct Traits<Nodedev::Xml::Fields>
 
 	static int parse(Nodedev::Xml::Fields& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Fields& , QDomElement& );
+	static int generate(const Nodedev::Xml::Fields& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Fields& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2270,6 +2337,10 @@ struct Traits<Nodedev::Xml::VendorField1>
 
 	static int parse(Nodedev::Xml::VendorField1& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::VendorField1& , QDomElement& );
+	static int generate(const Nodedev::Xml::VendorField1& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::VendorField1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2282,6 +2353,10 @@ struct Traits<Nodedev::Xml::SystemField>
 
 	static int parse(Nodedev::Xml::SystemField& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::SystemField& , QDomElement& );
+	static int generate(const Nodedev::Xml::SystemField& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::SystemField& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2294,6 +2369,10 @@ struct Traits<Nodedev::Xml::Fields1>
 
 	static int parse(Nodedev::Xml::Fields1& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Fields1& , QDomElement& );
+	static int generate(const Nodedev::Xml::Fields1& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Fields1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2306,6 +2385,10 @@ struct Traits<Nodedev::Xml::Capability1>
 
 	static int parse(Nodedev::Xml::Capability1& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capability1& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capability1& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capability1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2318,6 +2401,10 @@ struct Traits<Nodedev::Xml::IommuGroup>
 
 	static int parse(Nodedev::Xml::IommuGroup& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::IommuGroup& , QDomElement& );
+	static int generate(const Nodedev::Xml::IommuGroup& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::IommuGroup& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2330,6 +2417,10 @@ struct Traits<Nodedev::Xml::Numa>
 
 	static int parse(Nodedev::Xml::Numa& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Numa& , QDomElement& );
+	static int generate(const Nodedev::Xml::Numa& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Numa& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2342,6 +2433,10 @@ struct Traits<Nodedev::Xml::Link>
 
 	static int parse(Nodedev::Xml::Link& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Link& , QDomElement& );
+	static int generate(const Nodedev::Xml::Link& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Link& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2354,6 +2449,10 @@ struct Traits<Nodedev::Xml::Cappcidev>
 
 	static int parse(Nodedev::Xml::Cappcidev& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Cappcidev& , QDomElement& );
+	static int generate(const Nodedev::Xml::Cappcidev& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Cappcidev& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2366,6 +2465,10 @@ struct Traits<Nodedev::Xml::Product1>
 
 	static int parse(Nodedev::Xml::Product1& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Product1& , QDomElement& );
+	static int generate(const Nodedev::Xml::Product1& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Product1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2378,6 +2481,10 @@ struct Traits<Nodedev::Xml::Vendor1>
 
 	static int parse(Nodedev::Xml::Vendor1& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Vendor1& , QDomElement& );
+	static int generate(const Nodedev::Xml::Vendor1& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Vendor1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2390,6 +2497,10 @@ struct Traits<Nodedev::Xml::Capusbdev>
 
 	static int parse(Nodedev::Xml::Capusbdev& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capusbdev& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capusbdev& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capusbdev& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2402,6 +2513,10 @@ struct Traits<Nodedev::Xml::Capusbinterface>
 
 	static int parse(Nodedev::Xml::Capusbinterface& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capusbinterface& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capusbinterface& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capusbinterface& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2414,6 +2529,10 @@ struct Traits<Nodedev::Xml::Link1>
 
 	static int parse(Nodedev::Xml::Link1& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Link1& , QDomElement& );
+	static int generate(const Nodedev::Xml::Link1& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Link1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2426,6 +2545,10 @@ struct Traits<Nodedev::Xml::Capability9164>
 
 	static int parse(Nodedev::Xml::Capability9164& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capability9164& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capability9164& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capability9164& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2438,6 +2561,10 @@ struct Traits<Nodedev::Xml::Capability9165>
 
 	static int parse(Nodedev::Xml::Capability9165& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capability9165& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capability9165& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capability9165& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2450,6 +2577,10 @@ struct Traits<Nodedev::Xml::Capnet>
 
 	static int parse(Nodedev::Xml::Capnet& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capnet& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capnet& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capnet& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2462,6 +2593,10 @@ struct Traits<Nodedev::Xml::Capsfchost>
 
 	static int parse(Nodedev::Xml::Capsfchost& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capsfchost& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capsfchost& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capsfchost& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2474,6 +2609,10 @@ struct Traits<Nodedev::Xml::Capsvports>
 
 	static int parse(Nodedev::Xml::Capsvports& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capsvports& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capsvports& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capsvports& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2486,6 +2625,10 @@ struct Traits<Nodedev::Xml::Capscsihost>
 
 	static int parse(Nodedev::Xml::Capscsihost& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capscsihost& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capscsihost& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capscsihost& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2498,6 +2641,10 @@ struct Traits<Nodedev::Xml::Capsfcrport>
 
 	static int parse(Nodedev::Xml::Capsfcrport& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capsfcrport& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capsfcrport& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capsfcrport& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2510,6 +2657,10 @@ struct Traits<Nodedev::Xml::Capscsitarget>
 
 	static int parse(Nodedev::Xml::Capscsitarget& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capscsitarget& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capscsitarget& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capscsitarget& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2522,6 +2673,10 @@ struct Traits<Nodedev::Xml::Capscsi>
 
 	static int parse(Nodedev::Xml::Capscsi& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capscsi& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capscsi& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capscsi& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2534,6 +2689,10 @@ struct Traits<Nodedev::Xml::Anonymous5139>
 
 	static int parse(Nodedev::Xml::Anonymous5139& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Anonymous5139& , QDomElement& );
+	static int generate(const Nodedev::Xml::Anonymous5139& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Anonymous5139& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2546,6 +2705,10 @@ struct Traits<Nodedev::Xml::Capability2>
 
 	static int parse(Nodedev::Xml::Capability2& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capability2& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capability2& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capability2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2558,6 +2721,10 @@ struct Traits<Nodedev::Xml::Capstoragefixed>
 
 	static int parse(Nodedev::Xml::Capstoragefixed& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capstoragefixed& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capstoragefixed& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capstoragefixed& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2570,6 +2737,10 @@ struct Traits<Nodedev::Xml::Capstorage>
 
 	static int parse(Nodedev::Xml::Capstorage& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capstorage& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capstorage& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capstorage& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2582,6 +2753,10 @@ struct Traits<Nodedev::Xml::Attr>
 
 	static int parse(Nodedev::Xml::Attr& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Attr& , QDomElement& );
+	static int generate(const Nodedev::Xml::Attr& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Attr& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2594,6 +2769,10 @@ struct Traits<Nodedev::Xml::Capmdev>
 
 	static int parse(Nodedev::Xml::Capmdev& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capmdev& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capmdev& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capmdev& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2606,6 +2785,10 @@ struct Traits<Nodedev::Xml::Capccwdev>
 
 	static int parse(Nodedev::Xml::Capccwdev& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capccwdev& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capccwdev& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capccwdev& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2618,6 +2801,10 @@ struct Traits<Nodedev::Xml::Capcssdev>
 
 	static int parse(Nodedev::Xml::Capcssdev& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capcssdev& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capcssdev& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capcssdev& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2630,6 +2817,10 @@ struct Traits<Nodedev::Xml::Capapqueue>
 
 	static int parse(Nodedev::Xml::Capapqueue& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Capapqueue& , QDomElement& );
+	static int generate(const Nodedev::Xml::Capapqueue& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Capapqueue& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2642,6 +2833,10 @@ struct Traits<Nodedev::Xml::Device>
 
 	static int parse(Nodedev::Xml::Device& , QStack<QDomElement>& );
 	static int generate(const Nodedev::Xml::Device& , QDomElement& );
+	static int generate(const Nodedev::Xml::Device& , Stream& );
+
+	template<class D>
+	static int produce(const Nodedev::Xml::Device& , D& );
 };
 
 } // namespace Libvirt
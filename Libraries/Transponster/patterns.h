@@ -25,6 +25,7 @@
 #ifndef __PATTERNS_H__
 #define __PATTERNS_H__
 #include <QHash>
+#include <QSet>
 #include <QPair>
 #include "base.h"
 #include <QStack>
@@ -51,8 +52,22 @@ namespace Libvirt
 ///////////////////////////////////////////////////////////////////////////////
 // struct Pattern
 
+// NB. a pattern moves the top of the stack only. the nested elements are
+// pushed and popped back before it returns, the lower levels are never
+// changed. thus a backtracking attempt is rolled back by the top alone.
+
 struct Pattern
 {
+protected:
+	// peeks at the element the top of the stack is nested into, the stack
+	// is left intact so that a shared one is not detached
+	static QDomElement getParent(const QStack<QDomElement>& stack_)
+	{
+		if (2 > stack_.size())
+			return QDomElement();
+
+		return stack_.at(stack_.size() - 2);
+	}
 };
 
 template<class T>
@@ -62,7 +77,8 @@ struct Traits<T, typename boost::enable_if<boost::is_base_of<Pattern, T> >::type
 	{
 		return dst_.consume(dom_);
 	}
-	static int generate(const T& src_, QDomElement& dom_)
+	template<class D>
+	static int generate(const T& src_, D& dom_)
 	{
 		return src_.produce(dom_);
 	}
@@ -76,15 +92,15 @@ struct Empty: Pattern
 	int consume(QStack<QDomElement>& stack_)
 	{
 		int output = -1;
-		QDomElement t = stack_.pop();
-		if (!stack_.top().isNull())
+		QDomElement p = getParent(stack_);
+		if (!p.isNull())
 		{
-			output *= !stack_.top().text().trimmed().isEmpty();
+			output *= !p.text().trimmed().isEmpty();
 		}
-		stack_.push(t);
 		return output;
 	}
-	int produce(QDomElement& ) const
+	template<class D>
+	int produce(D& ) const
 	{
 		return 0;
 	}
@@ -250,6 +266,22 @@ struct Traits<QDomElement>
 	}
 };
 
+template<>
+struct Traits<Stream>
+{
+	template<class T>
+	struct apply
+	{
+		typedef const Body<T> type;
+	};
+
+	template<class P>
+	static int do_(Stream& dom_, const P& pattern_)
+	{
+		return pattern_.produce(dom_);
+	}
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Unit
 
@@ -312,10 +344,11 @@ struct Body: private Composite<T>::type
 		typedef Cons<typename mpl::at_c<T, I>::type, I> bin_type;
 		return static_cast<bin_type const& >(*this).value;
 	}
-	int produce(QDomElement& dst_) const
+	template<class D>
+	int produce(D& dst_) const
 	{
-		Visitor::Context<QDomElement> c(dst_);
-		mpl::for_each<typename Fold<T>::type>(Visitor::Unit<T, QDomElement>(*this, c));
+		Visitor::Context<D> c(dst_);
+		mpl::for_each<typename Fold<T>::type>(Visitor::Unit<T, D>(*this, c));
 		return c.getResult();
 	}
 };
@@ -365,24 +398,26 @@ struct Round
 	}
 	result_type operator()(context_type::dom_type& point_)
 	{
-		context_type::dom_type w;
+		// every player starts from the same top, the winner's one is
+		// kept
+		QDomElement t = point_.top();
+		QDomElement w = t;
 		result_type output = qMakePair(~0U, -1);
 		BOOST_FOREACH(playerMap_type::const_reference c, m_players)
 		{
-			context_type::dom_type x = point_;
-			context_type s(x);
+			point_.top() = t;
+			context_type s(point_);
 			if (NULL == c.second(s) || s.getDom() == NULL)
 				continue;
 
 			int p = s.getResult();
 			if (p > output.second)
 			{
-				w = *s.getDom();
+				w = point_.top();
 				output = qMakePair(c.first, p);
 			}
 		}
-		if (!w.isEmpty())
-			point_ = w;
+		point_.top() = w;
 
 		return output;
 	}
@@ -526,22 +561,24 @@ struct Body: Access<typename boost::make_variant_over<
 struct Consumer
 {
 	explicit Consumer(QStack<QDomElement>& stack_):
-		m_result(-1), m_point(stack_), m_stack(&stack_)
+		m_result(-1), m_point(stack_.top()), m_best(m_point), m_stack(&stack_)
 	{
 	}
 	
 	template<class T>
 	bool do_(Fragment<T>& pattern_)
 	{
-		QStack<QDomElement> s = m_point;
-		int x = pattern_.consume(s);
-		if (x > m_result)
+		// every attempt starts from the same top, the best one is kept
+		m_stack->top() = m_point;
+		int x = pattern_.consume(*m_stack);
+		bool output = x > m_result;
+		if (output)
 		{
 			m_result = x;
-			*m_stack = s;
-			return true;
+			m_best = m_stack->top();
 		}
-		return false;
+		m_stack->top() = m_best;
+		return output;
 	}
 	int getResult() const
 	{
@@ -550,7 +587,8 @@ struct Consumer
 
 private:
 	int m_result;
-	QStack<QDomElement> m_point;
+	QDomElement m_point;
+	QDomElement m_best;
 	QStack<QDomElement> *m_stack;
 };
 
@@ -581,10 +619,10 @@ private:
 ///////////////////////////////////////////////////////////////////////////////
 // struct Producer
 
-template<class T>
+template<class T, class D>
 struct Producer: boost::static_visitor<int>
 {
-	Producer(QDomElement& dom_): m_dom(&dom_)
+	Producer(D& dom_): m_dom(&dom_)
 	{
 	}
 
@@ -597,7 +635,7 @@ struct Producer: boost::static_visitor<int>
 	}
 
 private:
-	QDomElement* m_dom;
+	D* m_dom;
 };
 
 } // namespace Choice
@@ -641,7 +679,8 @@ struct Body
 
 		return output;
 	}
-	int produce(QDomElement& dst_) const
+	template<class D>
+	int produce(D& dst_) const
 	{
 		return Fragment<T>().produce(dst_);
 	}
@@ -670,7 +709,8 @@ public:
 
 		return output;
 	}
-	int produce(QDomElement& dst_) const
+	template<class D>
+	int produce(D& dst_) const
 	{
 		if (!this->getValue())
 			return 0;
@@ -706,7 +746,8 @@ struct Body<Element<Empty, T> >: Access<bool>
 
 		return output;
 	}
-	int produce(QDomElement& dst_) const
+	template<class D>
+	int produce(D& dst_) const
 	{
 		if (!this->getValue())
 			return 0;
@@ -772,14 +813,12 @@ struct Attribute: Access<T>, Pattern
 {
 	int consume(QStack<QDomElement>& stack_)
 	{
-		QDomElement t = stack_.pop();
-		if (stack_.top().isNull())
-		{
-			stack_.push(t);
+		QDomElement p = getParent(stack_);
+		if (p.isNull())
 			return -1;
-		}
+
 		QDomAttr a;
-		QDomNamedNodeMap m = stack_.top().attributes();
+		QDomNamedNodeMap m = p.attributes();
 		for (uint i = m.length(); i-- > 0;)
 		{
 			QDomAttr b = m.item(i).toAttr();
@@ -789,7 +828,6 @@ struct Attribute: Access<T>, Pattern
 				break;
 			}
 		}
-		stack_.push(t);
 		if (a.isNull())
 			return -1;
 
@@ -806,6 +844,13 @@ struct Attribute: Access<T>, Pattern
 		dst_.setAttributeNode(a);
 		return 0;
 	}
+	int produce(Stream& dst_) const
+	{
+		if (Stream::ATTRIBUTES == dst_.getPass())
+			Name::Traits<N>::produceAttribute(Marshal<T>::getString(*this), dst_);
+
+		return 0;
+	}
 };
 
 template<class T, class N>
@@ -840,6 +885,73 @@ struct Pod: Access<QDomElement>, Pattern
 
 		return !x;
 	}
+	int produce(Stream& dst_) const
+	{
+		QDomElement t = getValue();
+		bool x = t.isNull();
+		if (!x && Stream::CONTENT == dst_.getPass())
+			dump(t, dst_.getWriter());
+
+		return !x;
+	}
+
+private:
+	// writes the subtree with the namespace declarations that QDom
+	// would make for it
+	static void dump(const QDomNode& src_, QXmlStreamWriter& dst_)
+	{
+		switch (src_.nodeType())
+		{
+		case QDomNode::ElementNode:
+		{
+			QDomElement e = src_.toElement();
+			dst_.writeStartElement(e.nodeName());
+			QSet<QString> p;
+			if (!e.namespaceURI().isNull())
+			{
+				p << e.prefix();
+				if (e.prefix().isEmpty())
+					dst_.writeDefaultNamespace(e.namespaceURI());
+				else
+					dst_.writeNamespace(e.namespaceURI(), e.prefix());
+			}
+			QDomNamedNodeMap m = e.attributes();
+			for (int i = 0; i < m.count(); ++i)
+			{
+				QDomAttr a = m.item(i).toAttr();
+				if (!a.namespaceURI().isNull() && !a.prefix().isEmpty() &&
+					a.prefix() != "xml" && !p.contains(a.prefix()))
+				{
+					p << a.prefix();
+					dst_.writeNamespace(a.namespaceURI(), a.prefix());
+				}
+				dst_.writeAttribute(a.nodeName(), a.value());
+			}
+			for (QDomNode n = e.firstChild(); !n.isNull(); n = n.nextSibling())
+				dump(n, dst_);
+
+			dst_.writeEndElement();
+			break;
+		}
+		case QDomNode::CDATASectionNode:
+			dst_.writeCDATA(src_.nodeValue());
+			break;
+		case QDomNode::TextNode:
+			dst_.writeCharacters(src_.nodeValue());
+			break;
+		case QDomNode::CommentNode:
+			dst_.writeComment(src_.nodeValue());
+			break;
+		case QDomNode::ProcessingInstructionNode:
+		{
+			QDomProcessingInstruction i = src_.toProcessingInstruction();
+			dst_.writeProcessingInstruction(i.target(), i.data());
+			break;
+		}
+		default:
+			break;
+		}
+	}
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -851,11 +963,10 @@ struct Text: Access<T>, Pattern
 	int consume(QStack<QDomElement>& stack_)
 	{
 		int output = -1;
-		QDomElement t = stack_.pop();
-		if (!stack_.top().isNull())
-			output = Marshal<T>::setString(stack_.top().text(), *this);
+		QDomElement p = getParent(stack_);
+		if (!p.isNull())
+			output = Marshal<T>::setString(p.text(), *this);
 
-		stack_.push(t);
 		return output;
 	}
 	int produce(QDomElement& dst_) const
@@ -870,6 +981,13 @@ struct Text: Access<T>, Pattern
 
 		return 1;
 	}
+	int produce(Stream& dst_) const
+	{
+		if (Stream::CONTENT == dst_.getPass())
+			dst_.getWriter().writeCharacters(Marshal<T>::getString(*this));
+
+		return 1;
+	}
 };
 
 template<class T>
@@ -888,7 +1006,8 @@ struct Fragment: Pattern
 		T x = T();
 		return Traits<T>::parse(x, stack_);
 	}
-	int produce(QDomElement& dst_) const
+	template<class D>
+	int produce(D& dst_) const
 	{
 		T x = T();
 		return Traits<T>::generate(x, dst_);
@@ -908,7 +1027,8 @@ struct Fragment<T, typename boost::enable_if<has_value_type<Access<T> > >::type>
 
 		return output;
 	}
-	int produce(QDomElement& dst_) const
+	template<class D>
+	int produce(D& dst_) const
 	{
 		T x = T();
 		Details::Value::Envelope::expand(*this, x);
@@ -931,19 +1051,18 @@ struct Element: Fragment<T>
 		if (!Name::Traits<N>::consume(e))
 			return -1;
 
-		QStack<QDomElement> s(stack_);
-		s.push(e.firstChildElement());
-		int x = Fragment<T>::consume(s);
+		// the children are consumed right on the stack, they leave
+		// the element intact
+		stack_.push(e.firstChildElement());
+		int x = Fragment<T>::consume(stack_);
+		QDomElement t = stack_.pop();
 		if (0 > x)
 			return x;
 
-		QDomElement t = s.pop();
 		if (!t.isNull())
 			return -1;
 
-		stack_.swap(s);
-		(void)stack_.pop();
-		stack_.push(e.nextSiblingElement());
+		stack_.top() = e.nextSiblingElement();
 		return 1;
 	}
 	int produce(QDomElement& dst_) const
@@ -955,6 +1074,31 @@ struct Element: Fragment<T>
 	{
 		return hang(Name::Traits<N>::produceElement(dst_), dst_);
 	}
+	int produce(Stream& dst_) const
+	{
+		// a nested element is written in the content pass of its parent
+		if (Stream::ATTRIBUTES == dst_.getPass())
+			return 1;
+
+		Name::Traits<N>::produceElement(dst_);
+		dst_.setPass(Stream::ATTRIBUTES);
+		int x = Fragment<T>::produce(dst_);
+		dst_.setPass(Stream::CONTENT);
+		if (0 > x)
+			return x;
+
+		x = Fragment<T>::produce(dst_);
+		if (0 > x)
+			return x;
+
+		dst_.getWriter().writeEndElement();
+		return 1;
+	}
+	int produce(QXmlStreamWriter& dst_) const
+	{
+		Stream s(dst_);
+		return produce(s);
+	}
 
 private:
 	int hang(QDomElement dom_, QDomNode& dst_) const
@@ -1006,7 +1150,8 @@ struct ZeroOrMore: Access<Details::Value::Identity<QList<typename Value<T>::type
 		this->setValue(v);
 		return output;
 	}
-	int produce(QDomElement& dst_) const
+	template<class D>
+	int produce(D& dst_) const
 	{
 		int output = 0;
 		foreach (typename list_type::const_reference v, this->getValue())
@@ -1037,7 +1182,8 @@ struct OneOrMore: ZeroOrMore<T>
 
 		return output;
 	}
-	int produce(QDomElement& dst_) const
+	template<class D>
+	int produce(D& dst_) const
 	{
 		if (this->getValue().isEmpty())
 			return -1;
@@ -1099,12 +1245,13 @@ struct Choice: Details::Choice::Body<T>, Pattern
 		mpl::for_each<T>(Details::Choice::Visitor<T>(*this, x));
 		return x.getResult();
 	}
-	int produce(QDomElement& dst_) const
+	template<class D>
+	int produce(D& dst_) const
 	{
 		if (this->getValue().empty())
 			return -1;
 
-		return boost::apply_visitor(Details::Choice::Producer<T>(dst_),
+		return boost::apply_visitor(Details::Choice::Producer<T, D>(dst_),
 				this->getValue());
 	}
 };
@@ -23,91 +23,460 @@
  */
 
 #include "snapshot_enum.h"
-#include <boost/assign/list_of.hpp>
 
-namespace ba = boost::assign;
 namespace Libvirt
 {
 template<>
-Enum<Snapshot::Xml::EState>::data_type Enum<Snapshot::Xml::EState>::getData()
+QString Enum<Snapshot::Xml::EState>::getText(Snapshot::Xml::EState value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Snapshot::Xml::EStateRunning, "running"))
-			(data_type::value_type(Snapshot::Xml::EStateBlocked, "blocked"))
-			(data_type::value_type(Snapshot::Xml::EStatePaused, "paused"))
-			(data_type::value_type(Snapshot::Xml::EStateShutdown, "shutdown"))
-			(data_type::value_type(Snapshot::Xml::EStateShutoff, "shutoff"))
-			(data_type::value_type(Snapshot::Xml::EStateCrashed, "crashed"))
-			(data_type::value_type(Snapshot::Xml::EStateDiskSnapshot, "disk-snapshot"));
+	switch (value_)
+	{
+	case Snapshot::Xml::EStateRunning:
+		return QStringLiteral("running");
+	case Snapshot::Xml::EStateBlocked:
+		return QStringLiteral("blocked");
+	case Snapshot::Xml::EStatePaused:
+		return QStringLiteral("paused");
+	case Snapshot::Xml::EStateShutdown:
+		return QStringLiteral("shutdown");
+	case Snapshot::Xml::EStateShutoff:
+		return QStringLiteral("shutoff");
+	case Snapshot::Xml::EStateCrashed:
+		return QStringLiteral("crashed");
+	case Snapshot::Xml::EStateDiskSnapshot:
+		return QStringLiteral("disk-snapshot");
+	}
+	return QString();
 }
 
 template<>
-Enum<Snapshot::Xml::ESnapshot>::data_type Enum<Snapshot::Xml::ESnapshot>::getData()
+int Enum<Snapshot::Xml::EState>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Snapshot::Xml::ESnapshotNo, "no"))
-			(data_type::value_type(Snapshot::Xml::ESnapshotInternal, "internal"));
+	switch (text_.size())
+	{
+	case 6:
+		switch (text_.at(0).unicode())
+		{
+		case 'p':
+			if (text_ == QLatin1String("paused"))
+				return Snapshot::Xml::EStatePaused;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'b':
+			if (text_ == QLatin1String("blocked"))
+				return Snapshot::Xml::EStateBlocked;
+			break;
+		case 'c':
+			if (text_ == QLatin1String("crashed"))
+				return Snapshot::Xml::EStateCrashed;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("running"))
+				return Snapshot::Xml::EStateRunning;
+			break;
+		case 's':
+			if (text_ == QLatin1String("shutoff"))
+				return Snapshot::Xml::EStateShutoff;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("shutdown"))
+				return Snapshot::Xml::EStateShutdown;
+			break;
+		}
+		break;
+	case 13:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("disk-snapshot"))
+				return Snapshot::Xml::EStateDiskSnapshot;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Snapshot::Xml::EStartupPolicy>::data_type Enum<Snapshot::Xml::EStartupPolicy>::getData()
+QString Enum<Snapshot::Xml::ESnapshot>::getText(Snapshot::Xml::ESnapshot value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Snapshot::Xml::EStartupPolicyMandatory, "mandatory"))
-			(data_type::value_type(Snapshot::Xml::EStartupPolicyRequisite, "requisite"))
-			(data_type::value_type(Snapshot::Xml::EStartupPolicyOptional, "optional"));
+	switch (value_)
+	{
+	case Snapshot::Xml::ESnapshotNo:
+		return QStringLiteral("no");
+	case Snapshot::Xml::ESnapshotInternal:
+		return QStringLiteral("internal");
+	}
+	return QString();
 }
 
 template<>
-Enum<Snapshot::Xml::EFormat>::data_type Enum<Snapshot::Xml::EFormat>::getData()
+int Enum<Snapshot::Xml::ESnapshot>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Snapshot::Xml::EFormatDefault, "default"))
-			(data_type::value_type(Snapshot::Xml::EFormatQcow, "qcow"))
-			(data_type::value_type(Snapshot::Xml::EFormatLuks, "luks"));
+	switch (text_.size())
+	{
+	case 2:
+		switch (text_.at(0).unicode())
+		{
+		case 'n':
+			if (text_ == QLatin1String("no"))
+				return Snapshot::Xml::ESnapshotNo;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'i':
+			if (text_ == QLatin1String("internal"))
+				return Snapshot::Xml::ESnapshotInternal;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Snapshot::Xml::EStorageFormatBacking>::data_type Enum<Snapshot::Xml::EStorageFormatBacking>::getData()
+QString Enum<Snapshot::Xml::EStartupPolicy>::getText(Snapshot::Xml::EStartupPolicy value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Snapshot::Xml::EStorageFormatBackingCow, "cow"))
-			(data_type::value_type(Snapshot::Xml::EStorageFormatBackingQcow, "qcow"))
-			(data_type::value_type(Snapshot::Xml::EStorageFormatBackingQcow2, "qcow2"))
-			(data_type::value_type(Snapshot::Xml::EStorageFormatBackingQed, "qed"))
-			(data_type::value_type(Snapshot::Xml::EStorageFormatBackingVmdk, "vmdk"));
+	switch (value_)
+	{
+	case Snapshot::Xml::EStartupPolicyMandatory:
+		return QStringLiteral("mandatory");
+	case Snapshot::Xml::EStartupPolicyRequisite:
+		return QStringLiteral("requisite");
+	case Snapshot::Xml::EStartupPolicyOptional:
+		return QStringLiteral("optional");
+	}
+	return QString();
 }
 
 template<>
-Enum<Snapshot::Xml::EProtocol>::data_type Enum<Snapshot::Xml::EProtocol>::getData()
+int Enum<Snapshot::Xml::EStartupPolicy>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Snapshot::Xml::EProtocolNbd, "nbd"))
-			(data_type::value_type(Snapshot::Xml::EProtocolRbd, "rbd"))
-			(data_type::value_type(Snapshot::Xml::EProtocolSheepdog, "sheepdog"))
-			(data_type::value_type(Snapshot::Xml::EProtocolGluster, "gluster"))
-			(data_type::value_type(Snapshot::Xml::EProtocolIscsi, "iscsi"))
-			(data_type::value_type(Snapshot::Xml::EProtocolHttp, "http"))
-			(data_type::value_type(Snapshot::Xml::EProtocolHttps, "https"))
-			(data_type::value_type(Snapshot::Xml::EProtocolFtp, "ftp"))
-			(data_type::value_type(Snapshot::Xml::EProtocolFtps, "ftps"))
-			(data_type::value_type(Snapshot::Xml::EProtocolTftp, "tftp"));
+	switch (text_.size())
+	{
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 'o':
+			if (text_ == QLatin1String("optional"))
+				return Snapshot::Xml::EStartupPolicyOptional;
+			break;
+		}
+		break;
+	case 9:
+		switch (text_.at(0).unicode())
+		{
+		case 'm':
+			if (text_ == QLatin1String("mandatory"))
+				return Snapshot::Xml::EStartupPolicyMandatory;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("requisite"))
+				return Snapshot::Xml::EStartupPolicyRequisite;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 template<>
-Enum<Snapshot::Xml::ETransport>::data_type Enum<Snapshot::Xml::ETransport>::getData()
+QString Enum<Snapshot::Xml::EFormat>::getText(Snapshot::Xml::EFormat value_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Snapshot::Xml::ETransportTcp, "tcp"))
-			(data_type::value_type(Snapshot::Xml::ETransportRdma, "rdma"));
+	switch (value_)
+	{
+	case Snapshot::Xml::EFormatDefault:
+		return QStringLiteral("default");
+	case Snapshot::Xml::EFormatQcow:
+		return QStringLiteral("qcow");
+	case Snapshot::Xml::EFormatLuks:
+		return QStringLiteral("luks");
+	}
+	return QString();
 }
 
 template<>
-Enum<Snapshot::Xml::EActive>::data_type Enum<Snapshot::Xml::EActive>::getData()
+int Enum<Snapshot::Xml::EFormat>::find(const QStringRef& text_)
 {
-	return ba::list_of<data_type::relation>
-			(data_type::value_type(Snapshot::Xml::EActive0, "0"))
-			(data_type::value_type(Snapshot::Xml::EActive1, "1"));
+	switch (text_.size())
+	{
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'l':
+			if (text_ == QLatin1String("luks"))
+				return Snapshot::Xml::EFormatLuks;
+			break;
+		case 'q':
+			if (text_ == QLatin1String("qcow"))
+				return Snapshot::Xml::EFormatQcow;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'd':
+			if (text_ == QLatin1String("default"))
+				return Snapshot::Xml::EFormatDefault;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Snapshot::Xml::EStorageFormatBacking>::getText(Snapshot::Xml::EStorageFormatBacking value_)
+{
+	switch (value_)
+	{
+	case Snapshot::Xml::EStorageFormatBackingCow:
+		return QStringLiteral("cow");
+	case Snapshot::Xml::EStorageFormatBackingQcow:
+		return QStringLiteral("qcow");
+	case Snapshot::Xml::EStorageFormatBackingQcow2:
+		return QStringLiteral("qcow2");
+	case Snapshot::Xml::EStorageFormatBackingQed:
+		return QStringLiteral("qed");
+	case Snapshot::Xml::EStorageFormatBackingVmdk:
+		return QStringLiteral("vmdk");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Snapshot::Xml::EStorageFormatBacking>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'c':
+			if (text_ == QLatin1String("cow"))
+				return Snapshot::Xml::EStorageFormatBackingCow;
+			break;
+		case 'q':
+			if (text_ == QLatin1String("qed"))
+				return Snapshot::Xml::EStorageFormatBackingQed;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'q':
+			if (text_ == QLatin1String("qcow"))
+				return Snapshot::Xml::EStorageFormatBackingQcow;
+			break;
+		case 'v':
+			if (text_ == QLatin1String("vmdk"))
+				return Snapshot::Xml::EStorageFormatBackingVmdk;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'q':
+			if (text_ == QLatin1String("qcow2"))
+				return Snapshot::Xml::EStorageFormatBackingQcow2;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Snapshot::Xml::EProtocol>::getText(Snapshot::Xml::EProtocol value_)
+{
+	switch (value_)
+	{
+	case Snapshot::Xml::EProtocolNbd:
+		return QStringLiteral("nbd");
+	case Snapshot::Xml::EProtocolRbd:
+		return QStringLiteral("rbd");
+	case Snapshot::Xml::EProtocolSheepdog:
+		return QStringLiteral("sheepdog");
+	case Snapshot::Xml::EProtocolGluster:
+		return QStringLiteral("gluster");
+	case Snapshot::Xml::EProtocolIscsi:
+		return QStringLiteral("iscsi");
+	case Snapshot::Xml::EProtocolHttp:
+		return QStringLiteral("http");
+	case Snapshot::Xml::EProtocolHttps:
+		return QStringLiteral("https");
+	case Snapshot::Xml::EProtocolFtp:
+		return QStringLiteral("ftp");
+	case Snapshot::Xml::EProtocolFtps:
+		return QStringLiteral("ftps");
+	case Snapshot::Xml::EProtocolTftp:
+		return QStringLiteral("tftp");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Snapshot::Xml::EProtocol>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("ftp"))
+				return Snapshot::Xml::EProtocolFtp;
+			break;
+		case 'n':
+			if (text_ == QLatin1String("nbd"))
+				return Snapshot::Xml::EProtocolNbd;
+			break;
+		case 'r':
+			if (text_ == QLatin1String("rbd"))
+				return Snapshot::Xml::EProtocolRbd;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'f':
+			if (text_ == QLatin1String("ftps"))
+				return Snapshot::Xml::EProtocolFtps;
+			break;
+		case 'h':
+			if (text_ == QLatin1String("http"))
+				return Snapshot::Xml::EProtocolHttp;
+			break;
+		case 't':
+			if (text_ == QLatin1String("tftp"))
+				return Snapshot::Xml::EProtocolTftp;
+			break;
+		}
+		break;
+	case 5:
+		switch (text_.at(0).unicode())
+		{
+		case 'h':
+			if (text_ == QLatin1String("https"))
+				return Snapshot::Xml::EProtocolHttps;
+			break;
+		case 'i':
+			if (text_ == QLatin1String("iscsi"))
+				return Snapshot::Xml::EProtocolIscsi;
+			break;
+		}
+		break;
+	case 7:
+		switch (text_.at(0).unicode())
+		{
+		case 'g':
+			if (text_ == QLatin1String("gluster"))
+				return Snapshot::Xml::EProtocolGluster;
+			break;
+		}
+		break;
+	case 8:
+		switch (text_.at(0).unicode())
+		{
+		case 's':
+			if (text_ == QLatin1String("sheepdog"))
+				return Snapshot::Xml::EProtocolSheepdog;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Snapshot::Xml::ETransport>::getText(Snapshot::Xml::ETransport value_)
+{
+	switch (value_)
+	{
+	case Snapshot::Xml::ETransportTcp:
+		return QStringLiteral("tcp");
+	case Snapshot::Xml::ETransportRdma:
+		return QStringLiteral("rdma");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Snapshot::Xml::ETransport>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 3:
+		switch (text_.at(0).unicode())
+		{
+		case 't':
+			if (text_ == QLatin1String("tcp"))
+				return Snapshot::Xml::ETransportTcp;
+			break;
+		}
+		break;
+	case 4:
+		switch (text_.at(0).unicode())
+		{
+		case 'r':
+			if (text_ == QLatin1String("rdma"))
+				return Snapshot::Xml::ETransportRdma;
+			break;
+		}
+		break;
+	}
+	return -1;
+}
+
+template<>
+QString Enum<Snapshot::Xml::EActive>::getText(Snapshot::Xml::EActive value_)
+{
+	switch (value_)
+	{
+	case Snapshot::Xml::EActive0:
+		return QStringLiteral("0");
+	case Snapshot::Xml::EActive1:
+		return QStringLiteral("1");
+	}
+	return QString();
+}
+
+template<>
+int Enum<Snapshot::Xml::EActive>::find(const QStringRef& text_)
+{
+	switch (text_.size())
+	{
+	case 1:
+		switch (text_.at(0).unicode())
+		{
+		case '0':
+			if (text_ == QLatin1String("0"))
+				return Snapshot::Xml::EActive0;
+			break;
+		case '1':
+			if (text_ == QLatin1String("1"))
+				return Snapshot::Xml::EActive1;
+			break;
+		}
+		break;
+	}
+	return -1;
 }
 
 } // namespace Libvirt
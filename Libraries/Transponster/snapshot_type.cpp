@@ -35,12 +35,23 @@ int Traits<Snapshot::Xml::Disk4374>::parse(Snapshot::Xml::Disk4374& , QStack<QDo
 	return m.consume(stack_);
 }
 
-int Traits<Snapshot::Xml::Disk4374>::generate(const Snapshot::Xml::Disk4374& , QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Disk4374>::produce(const Snapshot::Xml::Disk4374& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Disk4374>::generate(const Snapshot::Xml::Disk4374& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Disk4374>::generate(const Snapshot::Xml::Disk4374& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Disk4375
 
@@ -50,12 +61,23 @@ int Traits<Snapshot::Xml::Disk4375>::parse(Snapshot::Xml::Disk4375& , QStack<QDo
 	return m.consume(stack_);
 }
 
-int Traits<Snapshot::Xml::Disk4375>::generate(const Snapshot::Xml::Disk4375& , QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Disk4375>::produce(const Snapshot::Xml::Disk4375& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Disk4375>::generate(const Snapshot::Xml::Disk4375& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Disk4375>::generate(const Snapshot::Xml::Disk4375& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Seclabel4345
 
@@ -65,12 +87,23 @@ int Traits<Snapshot::Xml::Seclabel4345>::parse(Snapshot::Xml::Seclabel4345& , QS
 	return m.consume(stack_);
 }
 
-int Traits<Snapshot::Xml::Seclabel4345>::generate(const Snapshot::Xml::Seclabel4345& , QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Seclabel4345>::produce(const Snapshot::Xml::Seclabel4345& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Seclabel4345>::generate(const Snapshot::Xml::Seclabel4345& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Seclabel4345>::generate(const Snapshot::Xml::Seclabel4345& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Seclabel4346
 
@@ -80,12 +113,23 @@ int Traits<Snapshot::Xml::Seclabel4346>::parse(Snapshot::Xml::Seclabel4346& , QS
 	return m.consume(stack_);
 }
 
-int Traits<Snapshot::Xml::Seclabel4346>::generate(const Snapshot::Xml::Seclabel4346& , QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Seclabel4346>::produce(const Snapshot::Xml::Seclabel4346& , D& dst_)
 {
 	marshal_type m;
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Seclabel4346>::generate(const Snapshot::Xml::Seclabel4346& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Seclabel4346>::generate(const Snapshot::Xml::Seclabel4346& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Seclabel
 
@@ -119,6 +163,13 @@ bool Seclabel::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Seclabel::save(QXmlStreamWriter& dst_) const
+{
+	Element<Seclabel, Name::Strict<229> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Snapshot
@@ -135,7 +186,8 @@ int Traits<Snapshot::Xml::Seclabel>::parse(Snapshot::Xml::Seclabel& dst_, QStack
 	return output;
 }
 
-int Traits<Snapshot::Xml::Seclabel>::generate(const Snapshot::Xml::Seclabel& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Seclabel>::produce(const Snapshot::Xml::Seclabel& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getModel(), m.get<0>()))
@@ -146,6 +198,16 @@ int Traits<Snapshot::Xml::Seclabel>::generate(const Snapshot::Xml::Seclabel& src
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Seclabel>::generate(const Snapshot::Xml::Seclabel& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Seclabel>::generate(const Snapshot::Xml::Seclabel& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct DiskSourceSlice
 
@@ -186,7 +248,8 @@ int Traits<Snapshot::Xml::DiskSourceSlice>::parse(Snapshot::Xml::DiskSourceSlice
 	return output;
 }
 
-int Traits<Snapshot::Xml::DiskSourceSlice>::generate(const Snapshot::Xml::DiskSourceSlice& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::DiskSourceSlice>::produce(const Snapshot::Xml::DiskSourceSlice& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getOffset(), m.get<0>()))
@@ -197,6 +260,16 @@ int Traits<Snapshot::Xml::DiskSourceSlice>::generate(const Snapshot::Xml::DiskSo
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::DiskSourceSlice>::generate(const Snapshot::Xml::DiskSourceSlice& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::DiskSourceSlice>::generate(const Snapshot::Xml::DiskSourceSlice& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct DiskSourceCommon
 
@@ -233,7 +306,8 @@ int Traits<Snapshot::Xml::DiskSourceCommon>::parse(Snapshot::Xml::DiskSourceComm
 	return output;
 }
 
-int Traits<Snapshot::Xml::DiskSourceCommon>::generate(const Snapshot::Xml::DiskSourceCommon& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::DiskSourceCommon>::produce(const Snapshot::Xml::DiskSourceCommon& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getIndex(), m.get<0>()))
@@ -244,6 +318,16 @@ int Traits<Snapshot::Xml::DiskSourceCommon>::generate(const Snapshot::Xml::DiskS
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::DiskSourceCommon>::generate(const Snapshot::Xml::DiskSourceCommon& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::DiskSourceCommon>::generate(const Snapshot::Xml::DiskSourceCommon& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Anonymous2410
 
@@ -280,7 +364,8 @@ int Traits<Snapshot::Xml::Anonymous2410>::parse(Snapshot::Xml::Anonymous2410& ds
 	return output;
 }
 
-int Traits<Snapshot::Xml::Anonymous2410>::generate(const Snapshot::Xml::Anonymous2410& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Anonymous2410>::produce(const Snapshot::Xml::Anonymous2410& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMode(), m.get<0>()))
@@ -291,6 +376,16 @@ int Traits<Snapshot::Xml::Anonymous2410>::generate(const Snapshot::Xml::Anonymou
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Anonymous2410>::generate(const Snapshot::Xml::Anonymous2410& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Anonymous2410>::generate(const Snapshot::Xml::Anonymous2410& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Keycipher
 
@@ -328,6 +423,13 @@ bool Keycipher::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Keycipher::save(QXmlStreamWriter& dst_) const
+{
+	Element<Keycipher, Name::Strict<5049> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Snapshot
@@ -345,7 +447,8 @@ int Traits<Snapshot::Xml::Keycipher>::parse(Snapshot::Xml::Keycipher& dst_, QSta
 	return output;
 }
 
-int Traits<Snapshot::Xml::Keycipher>::generate(const Snapshot::Xml::Keycipher& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Keycipher>::produce(const Snapshot::Xml::Keycipher& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -358,6 +461,16 @@ int Traits<Snapshot::Xml::Keycipher>::generate(const Snapshot::Xml::Keycipher& s
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Keycipher>::generate(const Snapshot::Xml::Keycipher& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Keycipher>::generate(const Snapshot::Xml::Keycipher& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Keyivgen
 
@@ -391,6 +504,13 @@ bool Keyivgen::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Keyivgen::save(QXmlStreamWriter& dst_) const
+{
+	Element<Keyivgen, Name::Strict<5751> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Snapshot
@@ -407,7 +527,8 @@ int Traits<Snapshot::Xml::Keyivgen>::parse(Snapshot::Xml::Keyivgen& dst_, QStack
 	return output;
 }
 
-int Traits<Snapshot::Xml::Keyivgen>::generate(const Snapshot::Xml::Keyivgen& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Keyivgen>::produce(const Snapshot::Xml::Keyivgen& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -418,6 +539,16 @@ int Traits<Snapshot::Xml::Keyivgen>::generate(const Snapshot::Xml::Keyivgen& src
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Keyivgen>::generate(const Snapshot::Xml::Keyivgen& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Keyivgen>::generate(const Snapshot::Xml::Keyivgen& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Anonymous4935
 
@@ -454,7 +585,8 @@ int Traits<Snapshot::Xml::Anonymous4935>::parse(Snapshot::Xml::Anonymous4935& ds
 	return output;
 }
 
-int Traits<Snapshot::Xml::Anonymous4935>::generate(const Snapshot::Xml::Anonymous4935& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Anonymous4935>::produce(const Snapshot::Xml::Anonymous4935& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getCipher(), m.get<0>()))
@@ -465,6 +597,16 @@ int Traits<Snapshot::Xml::Anonymous4935>::generate(const Snapshot::Xml::Anonymou
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Anonymous4935>::generate(const Snapshot::Xml::Anonymous4935& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Anonymous4935>::generate(const Snapshot::Xml::Anonymous4935& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Encryption
 
@@ -502,6 +644,13 @@ bool Encryption::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Encryption::save(QXmlStreamWriter& dst_) const
+{
+	Element<Encryption, Name::Strict<145> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Snapshot
@@ -519,7 +668,8 @@ int Traits<Snapshot::Xml::Encryption>::parse(Snapshot::Xml::Encryption& dst_, QS
 	return output;
 }
 
-int Traits<Snapshot::Xml::Encryption>::generate(const Snapshot::Xml::Encryption& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Encryption>::produce(const Snapshot::Xml::Encryption& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFormat(), m.get<0>()))
@@ -532,6 +682,16 @@ int Traits<Snapshot::Xml::Encryption>::generate(const Snapshot::Xml::Encryption&
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Encryption>::generate(const Snapshot::Xml::Encryption& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Encryption>::generate(const Snapshot::Xml::Encryption& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source
 
@@ -565,6 +725,13 @@ bool Source::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Snapshot
@@ -584,7 +751,8 @@ int Traits<Snapshot::Xml::Source>::parse(Snapshot::Xml::Source& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Snapshot::Xml::Source>::generate(const Snapshot::Xml::Source& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Source>::produce(const Snapshot::Xml::Source& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getFile(), m.get<0>()))
@@ -601,6 +769,16 @@ int Traits<Snapshot::Xml::Source>::generate(const Snapshot::Xml::Source& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Source>::generate(const Snapshot::Xml::Source& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Source>::generate(const Snapshot::Xml::Source& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct ScaledInteger
 
@@ -638,6 +816,13 @@ bool ScaledInteger::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool ScaledInteger::save(QXmlStreamWriter& dst_) const
+{
+	Element<ScaledInteger, Name::Strict<6547> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Snapshot
@@ -654,7 +839,8 @@ int Traits<Snapshot::Xml::ScaledInteger>::parse(Snapshot::Xml::ScaledInteger& ds
 	return output;
 }
 
-int Traits<Snapshot::Xml::ScaledInteger>::generate(const Snapshot::Xml::ScaledInteger& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::ScaledInteger>::produce(const Snapshot::Xml::ScaledInteger& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getUnit(), m.get<0>()))
@@ -665,6 +851,16 @@ int Traits<Snapshot::Xml::ScaledInteger>::generate(const Snapshot::Xml::ScaledIn
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::ScaledInteger>::generate(const Snapshot::Xml::ScaledInteger& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::ScaledInteger>::generate(const Snapshot::Xml::ScaledInteger& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct MetadataCache
 
@@ -698,6 +894,13 @@ bool MetadataCache::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool MetadataCache::save(QXmlStreamWriter& dst_) const
+{
+	Element<MetadataCache, Name::Strict<6546> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Snapshot
@@ -713,7 +916,8 @@ int Traits<Snapshot::Xml::MetadataCache>::parse(Snapshot::Xml::MetadataCache& ds
 	return output;
 }
 
-int Traits<Snapshot::Xml::MetadataCache>::generate(const Snapshot::Xml::MetadataCache& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::MetadataCache>::produce(const Snapshot::Xml::MetadataCache& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getMaxSize(), m.get<0>()))
@@ -722,6 +926,16 @@ int Traits<Snapshot::Xml::MetadataCache>::generate(const Snapshot::Xml::Metadata
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::MetadataCache>::generate(const Snapshot::Xml::MetadataCache& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::MetadataCache>::generate(const Snapshot::Xml::MetadataCache& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Driver
 
@@ -755,6 +969,13 @@ bool Driver::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Driver::save(QXmlStreamWriter& dst_) const
+{
+	Element<Driver, Name::Strict<546> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Snapshot
@@ -771,7 +992,8 @@ int Traits<Snapshot::Xml::Driver>::parse(Snapshot::Xml::Driver& dst_, QStack<QDo
 	return output;
 }
 
-int Traits<Snapshot::Xml::Driver>::generate(const Snapshot::Xml::Driver& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Driver>::produce(const Snapshot::Xml::Driver& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getType(), m.get<0>()))
@@ -782,6 +1004,16 @@ int Traits<Snapshot::Xml::Driver>::generate(const Snapshot::Xml::Driver& src_, Q
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Driver>::generate(const Snapshot::Xml::Driver& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Driver>::generate(const Snapshot::Xml::Driver& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Variant8729
 
@@ -797,7 +1029,8 @@ int Traits<Snapshot::Xml::Variant8729>::parse(Snapshot::Xml::Variant8729& dst_,
 	return output;
 }
 
-int Traits<Snapshot::Xml::Variant8729>::generate(const Snapshot::Xml::Variant8729& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Variant8729>::produce(const Snapshot::Xml::Variant8729& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSource(), m.get<1>().get<0>()))
@@ -808,6 +1041,16 @@ int Traits<Snapshot::Xml::Variant8729>::generate(const Snapshot::Xml::Variant872
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Variant8729>::generate(const Snapshot::Xml::Variant8729& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Variant8729>::generate(const Snapshot::Xml::Variant8729& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source1
 
@@ -841,6 +1084,13 @@ bool Source1::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source1::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source1, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Snapshot
@@ -859,7 +1109,8 @@ int Traits<Snapshot::Xml::Source1>::parse(Snapshot::Xml::Source1& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Snapshot::Xml::Source1>::generate(const Snapshot::Xml::Source1& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Source1>::produce(const Snapshot::Xml::Source1& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getDev(), m.get<0>()))
@@ -874,6 +1125,16 @@ int Traits<Snapshot::Xml::Source1>::generate(const Snapshot::Xml::Source1& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Source1>::generate(const Snapshot::Xml::Source1& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Source1>::generate(const Snapshot::Xml::Source1& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Variant8730
 
@@ -889,7 +1150,8 @@ int Traits<Snapshot::Xml::Variant8730>::parse(Snapshot::Xml::Variant8730& dst_,
 	return output;
 }
 
-int Traits<Snapshot::Xml::Variant8730>::generate(const Snapshot::Xml::Variant8730& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Variant8730>::produce(const Snapshot::Xml::Variant8730& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getSource(), m.get<1>().get<0>()))
@@ -900,6 +1162,16 @@ int Traits<Snapshot::Xml::Variant8730>::generate(const Snapshot::Xml::Variant873
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Variant8730>::generate(const Snapshot::Xml::Variant8730& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Variant8730>::generate(const Snapshot::Xml::Variant8730& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Host7324
 
@@ -916,7 +1188,8 @@ int Traits<Snapshot::Xml::Host7324>::parse(Snapshot::Xml::Host7324& dst_, QStack
 	return output;
 }
 
-int Traits<Snapshot::Xml::Host7324>::generate(const Snapshot::Xml::Host7324& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Host7324>::produce(const Snapshot::Xml::Host7324& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getTransport(), m.get<0>()))
@@ -929,6 +1202,16 @@ int Traits<Snapshot::Xml::Host7324>::generate(const Snapshot::Xml::Host7324& src
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Host7324>::generate(const Snapshot::Xml::Host7324& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Host7324>::generate(const Snapshot::Xml::Host7324& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Source2
 
@@ -966,6 +1249,13 @@ bool Source2::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Source2::save(QXmlStreamWriter& dst_) const
+{
+	Element<Source2, Name::Strict<501> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Snapshot
@@ -983,7 +1273,8 @@ int Traits<Snapshot::Xml::Source2>::parse(Snapshot::Xml::Source2& dst_, QStack<Q
 	return output;
 }
 
-int Traits<Snapshot::Xml::Source2>::generate(const Snapshot::Xml::Source2& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Source2>::produce(const Snapshot::Xml::Source2& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getProtocol(), m.get<0>()))
@@ -996,6 +1287,16 @@ int Traits<Snapshot::Xml::Source2>::generate(const Snapshot::Xml::Source2& src_,
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Source2>::generate(const Snapshot::Xml::Source2& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Source2>::generate(const Snapshot::Xml::Source2& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Disk
 
@@ -1029,6 +1330,13 @@ bool Disk::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Disk::save(QXmlStreamWriter& dst_) const
+{
+	Element<Disk, Name::Strict<472> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Snapshot
@@ -1045,7 +1353,8 @@ int Traits<Snapshot::Xml::Disk>::parse(Snapshot::Xml::Disk& dst_, QStack<QDomEle
 	return output;
 }
 
-int Traits<Snapshot::Xml::Disk>::generate(const Snapshot::Xml::Disk& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Disk>::produce(const Snapshot::Xml::Disk& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -1056,6 +1365,16 @@ int Traits<Snapshot::Xml::Disk>::generate(const Snapshot::Xml::Disk& src_, QDomE
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Disk>::generate(const Snapshot::Xml::Disk& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Disk>::generate(const Snapshot::Xml::Disk& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // struct Domainsnapshot
 
@@ -1089,6 +1408,13 @@ bool Domainsnapshot::save(QDomDocument& dst_) const
 	return 0 <= m.produce(dst_);
 }
 
+bool Domainsnapshot::save(QXmlStreamWriter& dst_) const
+{
+	Element<Domainsnapshot, Name::Strict<1359> > m;
+	m.setValue(*this);
+	return 0 <= m.produce(dst_);
+}
+
 
 } // namespace Xml
 } // namespace Snapshot
@@ -1115,7 +1441,8 @@ int Traits<Snapshot::Xml::Domainsnapshot>::parse(Snapshot::Xml::Domainsnapshot&
 	return output;
 }
 
-int Traits<Snapshot::Xml::Domainsnapshot>::generate(const Snapshot::Xml::Domainsnapshot& src_, QDomElement& dst_)
+template<class D>
+int Traits<Snapshot::Xml::Domainsnapshot>::produce(const Snapshot::Xml::Domainsnapshot& src_, D& dst_)
 {
 	marshal_type m;
 	if (0 > Details::Marshal::assign(src_.getName(), m.get<0>()))
@@ -1146,4 +1473,14 @@ int Traits<Snapshot::Xml::Domainsnapshot>::generate(const Snapshot::Xml::Domains
 	return m.produce(dst_);
 }
 
+int Traits<Snapshot::Xml::Domainsnapshot>::generate(const Snapshot::Xml::Domainsnapshot& src_, QDomElement& dst_)
+{
+	return produce(src_, dst_);
+}
+
+int Traits<Snapshot::Xml::Domainsnapshot>::generate(const Snapshot::Xml::Domainsnapshot& src_, Stream& dst_)
+{
+	return produce(src_, dst_);
+}
+
 } // namespace Libvirt
@@ -144,6 +144,7 @@ struct Seclabel
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<QString > m_model;
@@ -314,6 +315,7 @@ struct Keycipher
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QString m_name;
@@ -352,6 +354,7 @@ struct Keyivgen
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	QString m_name;
@@ -435,6 +438,7 @@ struct Encryption
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EFormat m_format;
@@ -497,6 +501,7 @@ struct Source
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PAbsFilePath::value_type > m_file;
@@ -539,6 +544,7 @@ struct ScaledInteger
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<PUnit::value_type > m_unit;
@@ -568,6 +574,7 @@ struct MetadataCache
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<ScaledInteger > m_maxSize;
@@ -604,6 +611,7 @@ struct Driver
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<EStorageFormatBacking > m_type;
@@ -691,6 +699,7 @@ struct Source1
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	PAbsFilePath::value_type m_dev;
@@ -830,6 +839,7 @@ struct Source2
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	EProtocol m_protocol;
@@ -894,6 +904,7 @@ struct Disk
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	VName m_name;
@@ -1024,6 +1035,7 @@ struct Domainsnapshot
 	bool load(const QDomElement& );
 	bool save(QDomElement& ) const;
 	bool save(QDomDocument& ) const;
+	bool save(QXmlStreamWriter& ) const;
 
 private:
 	boost::optional<QString > m_name;
@@ -1053,6 +1065,10 @@ struct Traits<Snapshot::Xml::Disk4374>
 
 	static int parse(Snapshot::Xml::Disk4374& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Disk4374& , QDomElement& );
+	static int generate(const Snapshot::Xml::Disk4374& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Disk4374& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1065,6 +1081,10 @@ struct Traits<Snapshot::Xml::Disk4375>
 
 	static int parse(Snapshot::Xml::Disk4375& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Disk4375& , QDomElement& );
+	static int generate(const Snapshot::Xml::Disk4375& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Disk4375& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1077,6 +1097,10 @@ struct Traits<Snapshot::Xml::Seclabel4345>
 
 	static int parse(Snapshot::Xml::Seclabel4345& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Seclabel4345& , QDomElement& );
+	static int generate(const Snapshot::Xml::Seclabel4345& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Seclabel4345& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1089,6 +1113,10 @@ struct Traits<Snapshot::Xml::Seclabel4346>
 
 	static int parse(Snapshot::Xml::Seclabel4346& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Seclabel4346& , QDomElement& );
+	static int generate(const Snapshot::Xml::Seclabel4346& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Seclabel4346& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1101,6 +1129,10 @@ struct Traits<Snapshot::Xml::Seclabel>
 
 	static int parse(Snapshot::Xml::Seclabel& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Seclabel& , QDomElement& );
+	static int generate(const Snapshot::Xml::Seclabel& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Seclabel& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1113,6 +1145,10 @@ struct Traits<Snapshot::Xml::DiskSourceSlice>
 
 	static int parse(Snapshot::Xml::DiskSourceSlice& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::DiskSourceSlice& , QDomElement& );
+	static int generate(const Snapshot::Xml::DiskSourceSlice& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::DiskSourceSlice& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1125,6 +1161,10 @@ struct Traits<Snapshot::Xml::DiskSourceCommon>
 
 	static int parse(Snapshot::Xml::DiskSourceCommon& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::DiskSourceCommon& , QDomElement& );
+	static int generate(const Snapshot::Xml::DiskSourceCommon& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::DiskSourceCommon& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1137,6 +1177,10 @@ struct Traits<Snapshot::Xml::Anonymous2410>
 
 	static int parse(Snapshot::Xml::Anonymous2410& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Anonymous2410& , QDomElement& );
+	static int generate(const Snapshot::Xml::Anonymous2410& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Anonymous2410& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1149,6 +1193,10 @@ struct Traits<Snapshot::Xml::Keycipher>
 
 	static int parse(Snapshot::Xml::Keycipher& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Keycipher& , QDomElement& );
+	static int generate(const Snapshot::Xml::Keycipher& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Keycipher& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1161,6 +1209,10 @@ struct Traits<Snapshot::Xml::Keyivgen>
 
 	static int parse(Snapshot::Xml::Keyivgen& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Keyivgen& , QDomElement& );
+	static int generate(const Snapshot::Xml::Keyivgen& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Keyivgen& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1173,6 +1225,10 @@ struct Traits<Snapshot::Xml::Anonymous4935>
 
 	static int parse(Snapshot::Xml::Anonymous4935& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Anonymous4935& , QDomElement& );
+	static int generate(const Snapshot::Xml::Anonymous4935& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Anonymous4935& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1185,6 +1241,10 @@ struct Traits<Snapshot::Xml::Encryption>
 
 	static int parse(Snapshot::Xml::Encryption& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Encryption& , QDomElement& );
+	static int generate(const Snapshot::Xml::Encryption& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Encryption& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1197,6 +1257,10 @@ struct Traits<Snapshot::Xml::Source>
 
 	static int parse(Snapshot::Xml::Source& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Source& , QDomElement& );
+	static int generate(const Snapshot::Xml::Source& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Source& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1209,6 +1273,10 @@ struct Traits<Snapshot::Xml::ScaledInteger>
 
 	static int parse(Snapshot::Xml::ScaledInteger& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::ScaledInteger& , QDomElement& );
+	static int generate(const Snapshot::Xml::ScaledInteger& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::ScaledInteger& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1221,6 +1289,10 @@ struct Traits<Snapshot::Xml::MetadataCache>
 
 	static int parse(Snapshot::Xml::MetadataCache& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::MetadataCache& , QDomElement& );
+	static int generate(const Snapshot::Xml::MetadataCache& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::MetadataCache& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1233,6 +1305,10 @@ struct Traits<Snapshot::Xml::Driver>
 
 	static int parse(Snapshot::Xml::Driver& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Driver& , QDomElement& );
+	static int generate(const Snapshot::Xml::Driver& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Driver& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1245,6 +1321,10 @@ struct Traits<Snapshot::Xml::Variant8729>
 
 	static int parse(Snapshot::Xml::Variant8729& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Variant8729& , QDomElement& );
+	static int generate(const Snapshot::Xml::Variant8729& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Variant8729& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1257,6 +1337,10 @@ struct Traits<Snapshot::Xml::Source1>
 
 	static int parse(Snapshot::Xml::Source1& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Source1& , QDomElement& );
+	static int generate(const Snapshot::Xml::Source1& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Source1& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1269,6 +1353,10 @@ struct Traits<Snapshot::Xml::Variant8730>
 
 	static int parse(Snapshot::Xml::Variant8730& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Variant8730& , QDomElement& );
+	static int generate(const Snapshot::Xml::Variant8730& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Variant8730& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1281,6 +1369,10 @@ struct Traits<Snapshot::Xml::Host7324>
 
 	static int parse(Snapshot::Xml::Host7324& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Host7324& , QDomElement& );
+	static int generate(const Snapshot::Xml::Host7324& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Host7324& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1293,6 +1385,10 @@ struct Traits<Snapshot::Xml::Source2>
 
 	static int parse(Snapshot::Xml::Source2& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Source2& , QDomElement& );
+	static int generate(const Snapshot::Xml::Source2& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Source2& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1305,6 +1401,10 @@ struct Traits<Snapshot::Xml::Disk>
 
 	static int parse(Snapshot::Xml::Disk& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Disk& , QDomElement& );
+	static int generate(const Snapshot::Xml::Disk& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Disk& , D& );
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1317,6 +1417,10 @@ struct Traits<Snapshot::Xml::Domainsnapshot>
 
 	static int parse(Snapshot::Xml::Domainsnapshot& , QStack<QDomElement>& );
 	static int generate(const Snapshot::Xml::Domainsnapshot& , QDomElement& );
+	static int generate(const Snapshot::Xml::Domainsnapshot& , Stream& );
+
+	template<class D>
+	static int produce(const Snapshot::Xml::Domainsnapshot& , D& );
 };
 
 } // namespace Libvirt
@@ -38,6 +38,8 @@
 #include <sys/socket.h>
 #include <poll.h>
 #include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/if_link.h>
 #include <string.h>
 #include <dirent.h>
 #include <numeric>
@@ -62,6 +64,7 @@
 #include <prlcommon/HostUtils/HostUtils.h>
 #include <prlcommon/PrlCommonUtilsBase/StringUtils.h>
 #include <prlcommon/PrlCommonUtilsBase/StringUtils.h>
+#include <prlcommon/Std/PrlTime.h>
 
 
 #include <vzctl/vzctl_param.h>
@@ -82,6 +85,8 @@
 #define BIN_VZCTL	"/usr/sbin/vzctl"
 #define FINDMNT		"/usr/bin/findmnt"
 
+#define CT_CGROUP2_ROOT	"/sys/fs/cgroup/machine.slice"
+
 QMutex CVzHelper::s_mtxEnvUuidMap;
 QHash< QString, QString > CVzHelper::s_envUuidMap;
 
@@ -283,6 +288,105 @@ Ct::Statistics::Network::Classfull* Builder::getResult()
 } // namespace Network
 } // namespace
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Sweep
+
+bool Ct::Statistics::Sweep::dump(links_type& dst_)
+{
+	int s = ::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+	if (s < 0)
+	{
+		WRITE_TRACE(DBG_FATAL, "Unable to open a netlink socket: %m");
+		return false;
+	}
+
+	struct
+	{
+		struct nlmsghdr header;
+		struct ifinfomsg body;
+	} q;
+	memset(&q, 0, sizeof(q));
+	q.header.nlmsg_len = NLMSG_LENGTH(sizeof(q.body));
+	q.header.nlmsg_type = RTM_GETLINK;
+	q.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+	q.header.nlmsg_seq = 1;
+	q.body.ifi_family = AF_UNSPEC;
+	if (::send(s, &q, q.header.nlmsg_len, 0) < 0)
+	{
+		WRITE_TRACE(DBG_FATAL, "Unable to request the links dump: %m");
+		::close(s);
+		return false;
+	}
+
+	links_type output;
+	QByteArray b(32768, Qt::Uninitialized);
+	for (bool done = false; !done;)
+	{
+		ssize_t n = ::recv(s, b.data(), b.size(), 0);
+		if (n < 0 && EINTR == errno)
+			continue;
+		if (n <= 0)
+			break;
+
+		int x = n;
+		for (struct nlmsghdr* h = (struct nlmsghdr* )b.data();
+			NLMSG_OK(h, x); h = NLMSG_NEXT(h, x))
+		{
+			if (NLMSG_DONE == h->nlmsg_type || NLMSG_ERROR == h->nlmsg_type)
+			{
+				done = true;
+				break;
+			}
+			if (RTM_NEWLINK != h->nlmsg_type)
+				continue;
+
+			bool veth = false;
+			const char* name = NULL;
+			const struct rtnl_link_stats64* t = NULL;
+			int y = IFLA_PAYLOAD(h);
+			for (struct rtattr* a = IFLA_RTA(NLMSG_DATA(h)); RTA_OK(a, y);
+				a = RTA_NEXT(a, y))
+			{
+				if (IFLA_IFNAME == a->rta_type)
+					name = (const char* )RTA_DATA(a);
+				else if (IFLA_STATS64 == a->rta_type &&
+					RTA_PAYLOAD(a) >= sizeof(*t))
+					t = (const struct rtnl_link_stats64* )RTA_DATA(a);
+				else if (IFLA_LINKINFO == a->rta_type)
+				{
+					int z = RTA_PAYLOAD(a);
+					for (struct rtattr* i = (struct rtattr* )RTA_DATA(a);
+						RTA_OK(i, z); i = RTA_NEXT(i, z))
+					{
+						if (IFLA_INFO_KIND == i->rta_type)
+							veth = 0 == strncmp((const char* )RTA_DATA(i),
+								"veth", RTA_PAYLOAD(i));
+					}
+				}
+			}
+			// only the host end of a veth pair mirrors the container
+			// traffic, the rest is left to vzctl
+			if (!veth || NULL == name || NULL == t)
+				continue;
+
+			// the host end transmits what a container receives
+			Network::General g;
+			g.name = QString::fromUtf8(name);
+			g.bytes_in = t->tx_bytes;
+			g.pkts_in = t->tx_packets;
+			g.bytes_out = t->rx_bytes;
+			g.pkts_out = t->rx_packets;
+			output.insert(g.name, g);
+		}
+	}
+	::close(s);
+	if (output.isEmpty())
+		return false;
+
+	dst_.swap(output);
+	return true;
+}
+
 int CVzHelper::get_net_stat_by_dev(const QString &ctid, CVmGenericNetworkAdapter *dev, Ct::Statistics::Network::General& stat)
 {
 	struct vzctl_netstat s;
@@ -295,11 +399,13 @@ int CVzHelper::get_net_stat_by_dev(const QString &ctid, CVmGenericNetworkAdapter
 	stat.bytes_out = s.outgoing;
 	stat.pkts_out = s.outgoing_pkt;
 	stat.index = dev->getIndex();
+	stat.name = dev->getHostInterfaceName();
 
 	return PRL_ERR_SUCCESS;
 }
 
 int CVzHelper::get_net_stat(const SmartPtr<CVmConfiguration>& config,
+		const Ct::Statistics::Sweep::links_type& links,
 		QList<Ct::Statistics::Network::General>& stat)
 {
 	QString uuid = config->getVmIdentification()->getVmUuid();
@@ -315,7 +421,15 @@ int CVzHelper::get_net_stat(const SmartPtr<CVmConfiguration>& config,
 	foreach(CVmGenericNetworkAdapter* pNet, config->getVmHardwareList()->m_lstNetworkAdapters)
 	{
 		Ct::Statistics::Network::General dev_stat;
-		if (!get_net_stat_by_dev(ctid, pNet, dev_stat))
+		Ct::Statistics::Sweep::links_type::const_iterator p =
+			links.constFind(pNet->getHostInterfaceName());
+		if (links.constEnd() != p)
+		{
+			dev_stat = p.value();
+			dev_stat.index = pNet->getIndex();
+			stat_.append(dev_stat);
+		}
+		else if (!get_net_stat_by_dev(ctid, pNet, dev_stat))
 			stat_.append(dev_stat);
 	}
 	stat_.swap(stat);
@@ -3860,6 +3974,177 @@ Ct::Statistics::Aggregate *CVzHelper::get_env_stat(const QString& uuid)
 	return a.take();
 }
 
+namespace
+{
+namespace Cgroup
+{
+// reads a small cgroup file in one go
+bool read(const QString& path_, QByteArray& dst_)
+{
+	int fd = ::open(QSTR2UTF8(path_), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return false;
+
+	char b[4096];
+	QByteArray output;
+	for (;;)
+	{
+		ssize_t n = ::read(fd, b, sizeof(b));
+		if (n < 0 && EINTR == errno)
+			continue;
+		if (n <= 0)
+			break;
+
+		output.append(b, n);
+	}
+	::close(fd);
+	dst_.swap(output);
+	return !dst_.isEmpty();
+}
+
+// picks the values of the keys out of a flat keyed file like cpu.stat,
+// marks the keys found and returns their number
+template<int N>
+int parse(const QByteArray& src_, const char* const (&keys_)[N], quint64 (&dst_)[N],
+	bool (&found_)[N])
+{
+	int output = 0;
+	const char* p = src_.constData();
+	const char* e = p + src_.size();
+	while (output < N && p < e)
+	{
+		const char* l = static_cast<const char* >(memchr(p, '\n', e - p));
+		if (NULL == l)
+			l = e;
+
+		for (int k = 0; k < N; ++k)
+		{
+			std::size_t n = strlen(keys_[k]);
+			if (found_[k] || std::size_t(l - p) <= n || ' ' != p[n] ||
+				0 != strncmp(p, keys_[k], n))
+				continue;
+
+			dst_[k] = strtoull(p + n + 1, NULL, 10);
+			found_[k] = true;
+			++output;
+			break;
+		}
+		p = l + 1;
+	}
+	return output;
+}
+
+template<int N>
+int parse(const QByteArray& src_, const char* const (&keys_)[N], quint64 (&dst_)[N])
+{
+	bool f[N] = {};
+	return parse(src_, keys_, dst_, f);
+}
+
+} // namespace Cgroup
+} // namespace
+
+bool Ct::Statistics::Sweep::collect(const QString& uuid_, Entry& entry_,
+	quint64 now_, Aggregate& dst_)
+{
+	enum {CPU_USAGE, CPU_USER, CPU_SYSTEM};
+	static const char* const s_cpu[] = {"usage_usec", "user_usec", "system_usec"};
+	quint64 c[3] = {};
+	QByteArray b;
+	if (!Cgroup::read(entry_.path + "cpu.stat", b) || 3 != Cgroup::parse(b, s_cpu, c))
+		return false;
+
+	// cgroup v2 knows nothing about the container start, ask vzctl once
+	// per a run of the container
+	if (0 == entry_.start || c[CPU_USAGE] < entry_.usage)
+	{
+		quint64 u = get_env_cpustat(uuid_).uptime;
+		entry_.start = now_ > u ? now_ - u : 0;
+	}
+	entry_.usage = c[CPU_USAGE];
+	dst_.cpu.uptime = now_ - entry_.start;
+	dst_.cpu.user = c[CPU_USER];
+	dst_.cpu.system = c[CPU_SYSTEM];
+
+	enum {MEMORY_FILE, MEMORY_SWAP_IN, MEMORY_SWAP_OUT};
+	static const char* const s_memory[] = {"file", "pswpin", "pswpout"};
+	quint64 m[3] = {};
+	quint64 current = 0;
+	if (Cgroup::read(entry_.path + "memory.current", b))
+	{
+		current = b.trimmed().toULongLong();
+		SmartPtr<Memory> x(new Memory());
+		if (Cgroup::read(entry_.path + "memory.max", b) && b.trimmed() != "max")
+			x->total = b.trimmed().toULongLong();
+		else
+			x->total = quint64(sysconf(_SC_PHYS_PAGES)) * sysconf(_SC_PAGESIZE);
+		x->free = x->total > current ? x->total - current : 0;
+		bool f[3] = {};
+		if (!Cgroup::read(entry_.path + "memory.stat", b) ||
+			3 != Cgroup::parse(b, s_memory, m, f))
+		{
+			// older kernels lack the swap keys, take the missing ones
+			// from vzctl as before
+			QScopedPointer<Memory> v(get_env_meminfo(uuid_));
+			if (!v.isNull())
+			{
+				if (!f[MEMORY_FILE])
+					m[MEMORY_FILE] = v->cached;
+				if (!f[MEMORY_SWAP_IN])
+					m[MEMORY_SWAP_IN] = v->swap_in;
+				if (!f[MEMORY_SWAP_OUT])
+					m[MEMORY_SWAP_OUT] = v->swap_out;
+			}
+		}
+		x->cached = m[MEMORY_FILE];
+		x->swap_in = m[MEMORY_SWAP_IN];
+		x->swap_out = m[MEMORY_SWAP_OUT];
+		dst_.memory = x;
+	}
+
+	// traffic classes are accounted by vzctl only
+	QScopedPointer<Network::Classfull> n(CVzHelper::get_net_classfull_stat(entry_.ctid));
+	if (!n.isNull())
+		dst_.net = *n;
+
+	return true;
+}
+
+Ct::Statistics::Sweep::result_type Ct::Statistics::Sweep::operator()(const QStringList& uuids_)
+{
+	if (!dump(m_links))
+		m_links.clear();
+
+	result_type output;
+	QHash<QString, Entry> c;
+	quint64 t = PrlGetTimeMonotonic();
+	foreach (const QString& u, uuids_)
+	{
+		Entry e = m_cache.value(u);
+		if (e.ctid.isEmpty())
+		{
+			e.ctid = CVzHelper::get_ctid_by_uuid(u);
+			if (e.ctid.isEmpty())
+				continue;
+
+			e.path = QString(CT_CGROUP2_ROOT "/%1/").arg(e.ctid);
+		}
+
+		SmartPtr<Aggregate> a(new Aggregate());
+		if (!collect(u, e, t, *a))
+		{
+			// stopped or cgroup v1
+			e.start = 0;
+			a = SmartPtr<Aggregate>(CVzHelper::get_env_stat(u));
+		}
+		c.insert(u, e);
+		output.insert(u, a);
+	}
+	m_cache.swap(c);
+
+	return output;
+}
+
 SmartPtr<CVmConfiguration> &CVzHelper::fix_env_config(SmartPtr<CVmConfiguration> &orig,
                 SmartPtr<CVmConfiguration> &copy)
 {
@@ -188,6 +188,8 @@ struct General
 	{
 	}
 
+	// host interface name
+	QString name;
 	quint64 bytes_in;
 	quint64 bytes_out;
 	quint64 pkts_in;
@@ -209,6 +211,51 @@ struct Aggregate
 	QList< ::Statistics::Filesystem> filesystem;
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// struct Sweep
+// Collects the counters of many running containers at once. Cpu and memory
+// come from the cgroup v2 files of a container, the host veth peers counters
+// from a single netlink link dump. A container without a v2 cgroup is
+// collected with vzctl. Not thread safe, a sweep is run by one thread.
+
+struct Sweep
+{
+	// uuid -> aggregate, an invalid one for a stopped container
+	typedef QHash<QString, SmartPtr<Aggregate> > result_type;
+	// host veth peer name -> counters
+	typedef QHash<QString, Network::General> links_type;
+
+	result_type operator()(const QStringList& uuids_);
+
+	const links_type& getLinks() const
+	{
+		return m_links;
+	}
+
+	static bool dump(links_type& dst_);
+
+private:
+	struct Entry
+	{
+		Entry(): start(0), usage(0)
+		{
+		}
+
+		QString ctid;
+		QString path;
+		// the container start and cpu usage in microseconds
+		quint64 start;
+		quint64 usage;
+	};
+
+	static bool collect(const QString& uuid_, Entry& entry_,
+		quint64 now_, Aggregate& dst_);
+
+	// ctid resolution is cached until a container leaves the sweep
+	QHash<QString, Entry> m_cache;
+	links_type m_links;
+};
+
 } // namespace Statistics
 
 namespace Config
@@ -280,7 +327,10 @@ public:
 			unsigned long ram, unsigned long *mask, int size);
 	static Ct::Statistics::Network::Classfull *get_net_classfull_stat(const QString &id_);
 	static int get_net_stat_by_dev(const QString &ctid, CVmGenericNetworkAdapter *dev, Ct::Statistics::Network::General& stat);
-	static int get_net_stat(const SmartPtr<CVmConfiguration>& config, QList<Ct::Statistics::Network::General>& stat);
+	// the adapters missing in the links are read with vzctl
+	static int get_net_stat(const SmartPtr<CVmConfiguration>& config,
+		const Ct::Statistics::Sweep::links_type& links,
+		QList<Ct::Statistics::Network::General>& stat);
 	static int update_network_classes_config(const CNetworkClassesConfig &conf);
 	static int get_network_classes_config(CNetworkClassesConfig &conf);
 	static int update_network_shaping_config(const CNetworkShapingConfig &conf);
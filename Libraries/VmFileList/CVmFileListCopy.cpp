@@ -33,6 +33,7 @@
 
 // #define FORCE_LOGGING_LEVEL DBG_DEBUG
 
+#include <algorithm>
 #include "CVmFileListCopy.h"
 #include <prlcommon/PrlCommonUtilsBase/SysError.h>
 #include <prlcommon/Interfaces/VirtuozzoNamespace.h>
@@ -42,7 +43,15 @@
 #include <prlcommon/Std/AtomicOps.h>
 #include <prlcommon/PrlCommonUtilsBase/PrlStringifyConsts.h>
 
-#define MIGRATION_PROTO_VER 0x1
+#ifdef _LIN_
+#include <errno.h>
+#include <unistd.h>
+#include <sys/types.h>
+#endif
+
+#define MIGRATION_PROTO_VER 0x2
+/* first version which accepts file chunks at offsets */
+#define MIGRATION_PROTO_VER_SPARSE 0x2
 
 #define UNDEF_PLATFORM	0
 #define MAC_PLATFORM	1
@@ -86,6 +95,7 @@ static int getPlatform()
 
 #define REQ_FCHUNK_FLAGS	0
 #define REQ_FCHUNK_DATA		1
+#define REQ_FCHUNK_OFFSET	2
 
 #define REP_CODE	0
 #define REP_EVENT	1
@@ -95,6 +105,7 @@ static int getPlatform()
 enum FCHUNK_FLAGS {
 	REQ_FCHUNK_FL_DATA = 0x0, /* data block contains valid data */
 	REQ_FCHUNK_FL_LAST = 0x1, /* last file chunk (end of file)*/
+	REQ_FCHUNK_FL_OFFSET = 0x2, /* data block goes at the offset, skipped range is a hole */
 };
 
 namespace
@@ -117,7 +128,10 @@ void Throttle::set(long msec_)
 	if (!m_time)
 		return;
 
-	m_time = boost::chrono::steady_clock::now() + boost::chrono::milliseconds(msec_);
+	// several packages may be queued before the first wait,
+	// so account the new one after those already accounted
+	m_time = std::max(m_time.get(), boost::chrono::steady_clock::now()) +
+		boost::chrono::milliseconds(msec_);
 }
 
 void Throttle::wait()
@@ -197,6 +211,134 @@ bool WaiterTillHandlerUsingObject::waitUnlockAndFinalize( UINT32 timeout_msec )
 	return true;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// class CVmFileListCopyFile
+
+qint64 CVmFileListCopyFile::seekData()
+{
+#ifdef _LIN_
+	int fd = m_cFile.handle();
+	off_t pos = m_cFile.pos(), d, h;
+
+	if (fd == -1)
+		return -1;
+
+	if ((d = ::lseek(fd, pos, SEEK_DATA)) == -1) {
+		if (errno != ENXIO)
+			return (m_nHole = -1);
+		/* nothing but a hole up to the end of file */
+		d = m_cFile.size();
+		h = d;
+	} else if ((h = ::lseek(fd, d, SEEK_HOLE)) == -1) {
+		h = -1;
+	}
+	::lseek(fd, d, SEEK_SET);
+	if (!m_cFile.seek(d))
+		return (m_nHole = -1);
+	m_nHole = h;
+	return d;
+#else
+	return -1;
+#endif
+}
+
+namespace VmFileList
+{
+///////////////////////////////////////////////////////////////////////////////
+// class ReadAhead
+
+ReadAhead::ReadAhead(CVmFileListCopyObject& object_, const objectList_type& files_,
+	int depth_, bool sparse_):
+	m_object(&object_), m_files(&files_), m_depth(qMax(depth_, 1)), m_sparse(sparse_),
+	m_stop(false), m_done(false)
+{
+}
+
+ReadAhead::~ReadAhead()
+{
+	stop();
+	wait();
+}
+
+void ReadAhead::run()
+{
+	bool x = true;
+	for (int i = 0; x && i < m_files->size(); ++i)
+	{
+		QString path = m_files->at(i).first.absoluteFilePath();
+		m_object->setName(path);
+		if (!m_object->open(QIODevice::ReadOnly)) {
+			WRITE_TRACE(DBG_FATAL, "Can't open file \"%s\"", QSTR2UTF8(path));
+			Chunk c;
+			c.file = i;
+			c.error = PRL_ERR_FAILURE;
+			push(c);
+			break;
+		}
+		while (x) {
+			Chunk c;
+			c.file = i;
+			if (m_sparse)
+				c.offset = m_object->seekData();
+			if ((c.size = m_object->getBuffer()) == -1) {
+				WRITE_TRACE(DBG_FATAL, "file \"%s\" read error", QSTR2UTF8(path));
+				c.size = 0;
+				c.error = PRL_ERR_FILE_READ_ERROR;
+				push(c);
+				x = false;
+				break;
+			}
+			c.last = m_object->atEnd();
+			c.data = m_object->detachBuffer(c.size);
+			m_object->freeBuffer();
+			x = push(c);
+			if (c.last)
+				break;
+		}
+		m_object->close();
+	}
+	QMutexLocker l(&m_mutex);
+	m_done = true;
+	m_notEmpty.wakeAll();
+}
+
+bool ReadAhead::push(const Chunk& chunk_)
+{
+	QMutexLocker l(&m_mutex);
+	while (!m_stop && m_queue.size() >= m_depth)
+		m_notFull.wait(&m_mutex);
+	if (m_stop)
+		return false;
+
+	m_queue.enqueue(chunk_);
+	m_notEmpty.wakeOne();
+	return true;
+}
+
+bool ReadAhead::pop(Chunk& dst_)
+{
+	QMutexLocker l(&m_mutex);
+	while (!m_stop && !m_done && m_queue.isEmpty())
+		m_notEmpty.wait(&m_mutex);
+	if (m_stop || m_queue.isEmpty())
+		return false;
+
+	dst_ = m_queue.dequeue();
+	m_notFull.wakeOne();
+	return true;
+}
+
+void ReadAhead::stop()
+{
+	QMutexLocker l(&m_mutex);
+	m_stop = true;
+	m_queue.clear();
+	m_notFull.wakeAll();
+	m_notEmpty.wakeAll();
+}
+
+} // namespace VmFileList
+
 //////////////////////////////////////////////////////////////////////////
 
 CVmFileListCopySender::CVmFileListCopySender()
@@ -412,8 +554,12 @@ m_bIsOperationWasCanceled(false)
 	m_nRemotePlatform = UNDEF_PLATFORM;
 	m_nCurrentSize = 0;
 	m_nProgress = 0;
+	m_nThroughput = 0;
+	m_nSampleTick = PrlGetTickCount64();
+	m_nSampleSize = 0;
 
 	m_pSendProgressNotification = NULL;
+	m_pSendProgressThroughputNotification = NULL;
 	m_pSendCancelNotification = NULL;
 	m_pSendFinishNotification = NULL;
 	m_pRequest = SmartPtr<IOPackage>();
@@ -437,6 +583,13 @@ void CVmFileListCopyBase::SetProgressNotifySender(
 	m_pSendProgressNotification = pSendProgressNotification;
 }
 
+void CVmFileListCopyBase::SetProgressNotifySender(
+	void (*pSendProgressNotification)
+		(const SmartPtr<IOPackage> &, const QString &, const QString &, int, quint64))
+{
+	m_pSendProgressThroughputNotification = pSendProgressNotification;
+}
+
 void CVmFileListCopyBase::SetCancelNotifySender(
 	void (*pSendCancelNotification)
 		(const SmartPtr<IOPackage> &, const QString &, const QString &))
@@ -455,7 +608,7 @@ void CVmFileListCopyBase::NotifyClientsWithProgress()
 {
 	int nCurrentPercent;
 
-	if (m_pSendProgressNotification == NULL)
+	if (m_pSendProgressNotification == NULL && m_pSendProgressThroughputNotification == NULL)
 		return;
 
   	if (m_nTotalSize == 0)
@@ -465,10 +618,23 @@ void CVmFileListCopyBase::NotifyClientsWithProgress()
 	if (m_nProgress == nCurrentPercent)
 		return;
 
+	PRL_UINT64 nTick = PrlGetTickCount64();
+	if (nTick > m_nSampleTick && m_nCurrentSize >= m_nSampleSize) {
+		m_nThroughput = (m_nCurrentSize - m_nSampleSize) *
+			PrlGetTicksPerSecond() / (nTick - m_nSampleTick);
+	}
+	m_nSampleTick = nTick;
+	m_nSampleSize = m_nCurrentSize;
+
 	/* Notify clients that migration progress changed */
 	m_nProgress = nCurrentPercent;
-	WRITE_TRACE(DBG_DEBUG, "Notifying clients with files copying progress %u", m_nProgress);
-	m_pSendProgressNotification(m_pRequest, m_sVmDirectoryUuid, m_sParam, m_nProgress);
+	WRITE_TRACE(DBG_DEBUG, "Notifying clients with files copying progress %u, %llu bytes/s",
+		m_nProgress, m_nThroughput);
+	if (m_pSendProgressThroughputNotification != NULL)
+		m_pSendProgressThroughputNotification(m_pRequest, m_sVmDirectoryUuid, m_sParam,
+			m_nProgress, m_nThroughput);
+	else
+		m_pSendProgressNotification(m_pRequest, m_sVmDirectoryUuid, m_sParam, m_nProgress);
 }
 
 void CVmFileListCopyBase::NotifyFileCopyWasCanceled()
@@ -497,7 +663,8 @@ CVmFileListCopySource::CVmFileListCopySource(
 	CVmEvent *pEvent,
 	quint32 nTimeout)
 :
-CVmFileListCopyBase(hSender, sVmUuid, sWorkPath, pEvent, nTimeout)
+CVmFileListCopyBase(hSender, sVmUuid, sWorkPath, pEvent, nTimeout),
+m_nWindow(1)
 {
 	m_sWorkPath = sWorkPath;
 	m_nTotalSize = nTotalSize;
@@ -522,10 +689,23 @@ PRL_RESULT CVmFileListCopySource::SendReqAndWaitReply(
 		const SmartPtr<IOPackage> &package,
 		SmartPtr<IOPackage> &reply)
 {
+	PRL_RESULT ret;
 	IOSendJob::Handle job;
-	IOSendJob::Response resp;
-	IOSendJob::Result res;
 
+	if (PRL_FAILED(ret = PostPackage(package, job)))
+		return ret;
+
+	if (m_hSender->waitForSend(job, m_nTimeout) != IOSendJob::Success) {
+		WRITE_TRACE(DBG_FATAL, "Package sending failure");
+		return (PRL_ERR_OPERATION_FAILED);
+	}
+	return WaitReply(job, reply);
+}
+
+PRL_RESULT CVmFileListCopySource::PostPackage(
+		const SmartPtr<IOPackage> &package,
+		IOSendJob::Handle &job)
+{
 	if (m_bIsOperationWasCanceled)
 		return PRL_ERR_OPERATION_WAS_CANCELED;
 
@@ -533,10 +713,14 @@ PRL_RESULT CVmFileListCopySource::SendReqAndWaitReply(
 		return processTargetError(m_hSender->m_sErrorString);
 
 	job = m_hSender->sendPackage(package);
-	if (m_hSender->waitForSend(job, m_nTimeout) != IOSendJob::Success) {
-		WRITE_TRACE(DBG_FATAL, "Package sending failure");
-		return (PRL_ERR_OPERATION_FAILED);
-	}
+	return PRL_ERR_SUCCESS;
+}
+
+PRL_RESULT CVmFileListCopySource::WaitReply(IOSendJob::Handle job, SmartPtr<IOPackage> &reply)
+{
+	IOSendJob::Response resp;
+	IOSendJob::Result res;
+
 	res = m_hSender->waitForResponse(job, m_nTimeout);
 	if (res == IOSendJob::Timeout) {
 		WRITE_TRACE(DBG_FATAL, "Timeout %d expired", m_nTimeout/1000);
@@ -577,7 +761,12 @@ PRL_RESULT CVmFileListCopySource::Copy(
 			return PRL_ERR_OPERATION_WAS_CANCELED;
 	}
 
-	for (i = 0; i < fileList.size(); ++i)
+	if (m_nWindow > 1)
+	{
+		if (PRL_FAILED(ret = SendFileListPipelined(fileList)))
+			return ret;
+	}
+	else for (i = 0; i < fileList.size(); ++i)
 	{
 		if (PRL_FAILED(ret = SendFileRequest(fileList.at(i))))
 			return ret;
@@ -622,13 +811,13 @@ PRL_RESULT CVmFileListCopySource::SendFirstRequest()
 		return ret;
 
 	if (reply->header.type == FileCopyFirstReply) {
-		if (sscanf(p->buffers[REP_FIRST_VER].getImpl(), "%d", &m_nRemoteVersion) != 1) {
-			WRITE_TRACE(DBG_FATAL, "Bad remote version: [%s]", p->buffers[REP_FIRST_VER].getImpl());
+		if (sscanf(reply->buffers[REP_FIRST_VER].getImpl(), "%d", &m_nRemoteVersion) != 1) {
+			WRITE_TRACE(DBG_FATAL, "Bad remote version: [%s]", reply->buffers[REP_FIRST_VER].getImpl());
 			return PRL_ERR_INVALID_PARAM;
 		}
 
-		if (sscanf(p->buffers[REP_FIRST_PLATF].getImpl(), "%d", &m_nRemotePlatform) != 1) {
-			WRITE_TRACE(DBG_FATAL, "Bad remote platform: [%s]", p->buffers[REP_FIRST_PLATF].getImpl());
+		if (sscanf(reply->buffers[REP_FIRST_PLATF].getImpl(), "%d", &m_nRemotePlatform) != 1) {
+			WRITE_TRACE(DBG_FATAL, "Bad remote platform: [%s]", reply->buffers[REP_FIRST_PLATF].getImpl());
 			return PRL_ERR_INVALID_PARAM;
 		}
 
@@ -636,7 +825,7 @@ PRL_RESULT CVmFileListCopySource::SendFirstRequest()
 			m_nRemoteVersion, m_nRemotePlatform);
 
 	} else if (reply->header.type == FileCopyError) {
-		QString sError = UTF8_2QSTR(p->buffers[ERR_EVENT].getImpl());
+		QString sError = UTF8_2QSTR(reply->buffers[ERR_EVENT].getImpl());
 		return processTargetError(sError);
 	} else {
 		return (PRL_ERR_OPERATION_FAILED);
@@ -675,6 +864,20 @@ PRL_RESULT CVmFileListCopySource::SendDirRequest(const QPair<QFileInfo, QString>
 PRL_RESULT CVmFileListCopySource::SendFileRequest(const QPair<QFileInfo, QString> &fPair)
 {
 	PRL_RESULT ret;
+
+	ret = SendReqWithAck(CreateFileRequest(fPair));
+	if (PRL_FAILED(ret))
+		return (ret);
+
+	ret = SendFileBody(fPair.first.absoluteFilePath());
+	if (PRL_FAILED(ret))
+		return (ret);
+
+	return PRL_ERR_SUCCESS;
+}
+
+SmartPtr<IOPackage> CVmFileListCopySource::CreateFileRequest(const QPair<QFileInfo, QString> &fPair)
+{
 	SmartPtr<IOPackage> p = IOPackage::createInstance(FileCopyFileCmd, 5);
 	QByteArray data;
 	char buf[BUFSIZ];
@@ -699,25 +902,114 @@ PRL_RESULT CVmFileListCopySource::SendFileRequest(const QPair<QFileInfo, QString
 			fi.size(),
 			rpath.toUtf8().constData());
 
-	ret = SendReqWithAck(p);
-	if (PRL_FAILED(ret))
-		return (ret);
+	return p;
+}
 
-	ret = SendFileBody(fi.absoluteFilePath());
-	if (PRL_FAILED(ret))
-		return (ret);
+SmartPtr<IOPackage> CVmFileListCopySource::CreateFileChunk(
+		const SmartPtr<char> &data, qint64 size, bool last, qint64 offset)
+{
+	SmartPtr<IOPackage> p = IOPackage::createInstance(FileCopyFileChunkCmd, offset < 0 ? 2 : 3);
+	quint64 flags = REQ_FCHUNK_FL_DATA;
+	char buf[BUFSIZ];
 
+	if (last)
+		flags |= REQ_FCHUNK_FL_LAST;
+	if (offset >= 0)
+		flags |= REQ_FCHUNK_FL_OFFSET;
+	snprintf(buf, sizeof(buf), "%llu", flags);
+	p->fillBuffer(REQ_FCHUNK_FLAGS, IOPackage::RawEncoding, buf, strlen(buf)+1);
+	p->setBuffer(REQ_FCHUNK_DATA, IOPackage::RawEncoding, data, size);
+	if (offset >= 0) {
+		snprintf(buf, sizeof(buf), "%lld", offset);
+		p->fillBuffer(REQ_FCHUNK_OFFSET, IOPackage::RawEncoding, buf, strlen(buf)+1);
+	}
+	return p;
+}
+
+bool CVmFileListCopySource::IsSparse() const
+{
+	return m_nRemoteVersion >= MIGRATION_PROTO_VER_SPARSE;
+}
+
+/* Same packages as with SendFileRequest() for each file, but file headers
+   are not waited for ack before the body and up to m_nWindow chunks and
+   headers may be in flight. Files are read on the ReadAhead thread.
+   The target handles packages in order and reports failures with
+   FileCopyError which is caught either as an ack or by m_hSender. */
+PRL_RESULT CVmFileListCopySource::SendFileListPipelined(const objectList_type &fileList)
+{
+	PRL_RESULT ret = PRL_ERR_SUCCESS;
+	QQueue<IOSendJob::Handle> sends, acks;
+	IOSendJob::Handle job;
+	VmFileList::Chunk c;
+	int nFile = -1;
+	qint64 nPos = 0;
+
+	VmFileList::ReadAhead r(*m_pCopyObject, fileList, m_nWindow, IsSparse());
+	r.start();
+	while (r.pop(c)) {
+		if (c.file != nFile) {
+			nFile = c.file;
+			nPos = 0;
+			if (PRL_FAILED(ret = PostPackage(CreateFileRequest(fileList.at(nFile)), job)))
+				break;
+			acks.enqueue(job);
+		}
+		if (PRL_FAILED(ret = c.error))
+			break;
+		if (PRL_FAILED(ret = PostPackage(CreateFileChunk(c.data, c.size, c.last, c.offset), job)))
+			break;
+		sends.enqueue(job);
+		/* holes are accounted as copied */
+		if (c.offset > nPos)
+			m_nCurrentSize += c.offset - nPos;
+		nPos = qMax(nPos, c.offset) + c.size;
+		m_nCurrentSize += c.size;
+		NotifyClientsWithProgress();
+
+		if (PRL_FAILED(ret = Drain(sends, acks, m_nWindow - 1)))
+			break;
+	}
+	r.stop();
+	r.wait();
+
+	if (PRL_SUCCEEDED(ret))
+		ret = Drain(sends, acks, 0);
+	return ret;
+}
+
+PRL_RESULT CVmFileListCopySource::Drain(
+		QQueue<IOSendJob::Handle> &sends,
+		QQueue<IOSendJob::Handle> &acks,
+		int nKeep)
+{
+	PRL_RESULT ret;
+
+	while (sends.size() > nKeep) {
+		if (m_hSender->waitForSend(sends.dequeue(), m_nTimeout) != IOSendJob::Success) {
+			WRITE_TRACE(DBG_FATAL, "Package sending failure");
+			return PRL_ERR_OPERATION_FAILED;
+		}
+	}
+	while (acks.size() > nKeep) {
+		SmartPtr<IOPackage> ack;
+		if (PRL_FAILED(ret = WaitReply(acks.dequeue(), ack)))
+			return ret;
+		if (PRL_FAILED(ret = CheckAck(ack)))
+			return ret;
+	}
+	if (m_bIsOperationWasCanceled)
+		return PRL_ERR_OPERATION_WAS_CANCELED;
 	return PRL_ERR_SUCCESS;
 }
 
 PRL_RESULT CVmFileListCopySource::SendFileBody(const QString & path)
 {
 	PRL_RESULT ret = PRL_ERR_SUCCESS;
-	SmartPtr<IOPackage> p = IOPackage::createInstance(FileCopyFileChunkCmd, 2);
-	quint64 flags = REQ_FCHUNK_FL_DATA;
-	qint64 size;
+	SmartPtr<IOPackage> p;
+	qint64 size, offset = -1, pos = 0;
+	bool sparse = IsSparse();
 	int done = 0;
-	char buf[BUFSIZ];
 	IOSendJob::Handle job;
 
 	m_pCopyObject->setName(path);
@@ -738,18 +1030,16 @@ PRL_RESULT CVmFileListCopySource::SendFileBody(const QString & path)
 			ret = processTargetError(m_hSender->m_sErrorString);
 			break;
 		}
+		if (sparse)
+			offset = m_pCopyObject->seekData();
 		if ((size = m_pCopyObject->getBuffer()) == -1) {
 			WRITE_TRACE(DBG_FATAL, "file \"%s\" read error", QSTR2UTF8(path));
 			ret = PRL_ERR_FILE_READ_ERROR;
 			break;
 		}
-		if (m_pCopyObject->atEnd()) {
-			flags |= REQ_FCHUNK_FL_LAST;
+		if (m_pCopyObject->atEnd())
 			done = 1;
-		}
-		snprintf(buf, sizeof(buf), "%llu", flags);
-		p->fillBuffer(REQ_FCHUNK_FLAGS, IOPackage::RawEncoding, buf, strlen(buf)+1);
-		p->setBuffer(REQ_FCHUNK_DATA, IOPackage::RawEncoding, m_pCopyObject->m_pBuffer, size);
+		p = CreateFileChunk(m_pCopyObject->m_pBuffer, size, done, offset);
 
 		job = m_hSender->sendPackage(p);
 		if (m_hSender->waitForSend(job, m_nTimeout) != IOSendJob::Success) {
@@ -758,6 +1048,10 @@ PRL_RESULT CVmFileListCopySource::SendFileBody(const QString & path)
 			break;
 		}
 		m_pCopyObject->freeBuffer();
+		/* holes are accounted as copied */
+		if (offset > pos)
+			m_nCurrentSize += offset - pos;
+		pos = qMax(pos, offset) + size;
 		m_nCurrentSize += size;
 		NotifyClientsWithProgress();
 	}
@@ -798,6 +1092,13 @@ PRL_RESULT CVmFileListCopySource::SendReqWithAck(SmartPtr<IOPackage> p)
 	if ((nRetCode = SendReqAndWaitReply(p, ack)) != PRL_ERR_SUCCESS)
 		return nRetCode;
 
+	return CheckAck(ack);
+}
+
+PRL_RESULT CVmFileListCopySource::CheckAck(const SmartPtr<IOPackage> &ack)
+{
+	PRL_RESULT nRetCode = PRL_ERR_SUCCESS;
+
 	if (ack->header.type == FileCopyError) {
 		QString sError = UTF8_2QSTR(ack->buffers[ERR_EVENT].getImpl());
 		nRetCode = processTargetError(sError);
@@ -1199,6 +1500,35 @@ PRL_RESULT CVmFileListCopyTarget::RecvFileChunk(const SmartPtr<IOPackage> &p)
 	}
 	p->getBuffer(REQ_FCHUNK_DATA, enc, buff, size);
 
+	if (flags & REQ_FCHUNK_FL_OFFSET) {
+		qint64 offset;
+		if (sscanf(p->buffers[REQ_FCHUNK_OFFSET].getImpl(), "%lld", &offset) != 1) {
+			WRITE_TRACE(DBG_FATAL, "Bad offset: [%s]", p->buffers[REQ_FCHUNK_OFFSET].getImpl());
+
+			EVENT_ERR_FILECOPY_PROTOCOL(
+				"FileCopyFileChunk",
+				QString("%1").arg(REQ_FCHUNK_OFFSET),
+				p->buffers[REQ_FCHUNK_OFFSET].getImpl());
+			SendError(p);
+
+			NotifyFileCopyWasCanceled();
+			return PRL_ERR_FILECOPY_PROTOCOL;
+		}
+		/* the file is new or truncated, so the skipped range stays a hole */
+		if (offset > file->pos())
+			m_nCurrentSize += offset - file->pos();
+		if (!file->seek(offset)) {
+			file->close();
+			WRITE_TRACE(DBG_FATAL, "Seek error");
+
+			m_Event.setEventCode(PRL_ERR_FILECOPY_CANT_WRITE);
+			SendError( p);
+
+			NotifyFileCopyWasCanceled();
+			return PRL_ERR_FILECOPY_CANT_WRITE;
+		}
+	}
+
 	if (file->write(buff.getImpl(), size) == -1) {
 		file->close();
 		WRITE_TRACE(DBG_FATAL, "Write error");
@@ -1211,8 +1541,14 @@ PRL_RESULT CVmFileListCopyTarget::RecvFileChunk(const SmartPtr<IOPackage> &p)
 	}
 	m_nCurrentSize += size;
 
-	if (flags & REQ_FCHUNK_FL_LAST)
+	if (flags & REQ_FCHUNK_FL_LAST) {
+		/* trailing hole */
+		if ((flags & REQ_FCHUNK_FL_OFFSET) && file->size() < qint64(fileSize)) {
+			m_nCurrentSize += fileSize - file->size();
+			file->resize(fileSize);
+		}
 		file->close();
+	}
 
 	NotifyClientsWithProgress();
 
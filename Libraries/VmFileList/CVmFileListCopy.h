@@ -36,6 +36,8 @@
 
 #include <QPair>
 #include <QList>
+#include <QQueue>
+#include <QThread>
 #include <QWaitCondition>
 #include <boost/chrono/system_clocks.hpp>
 #include <boost/optional.hpp>
@@ -182,6 +184,10 @@ public:
 	void SetProgressNotifySender(
 		void (*pSendProgressNotification)
 			(const SmartPtr<IOPackage> &, const QString &, const QString &, int));
+	/* same as above, but the notifier also gets throughput in bytes per second */
+	void SetProgressNotifySender(
+		void (*pSendProgressNotification)
+			(const SmartPtr<IOPackage> &, const QString &, const QString &, int, quint64));
 	void SetCancelNotifySender(
 		void (*pSendCancelNotification)
 			(const SmartPtr<IOPackage> &, const QString &, const QString &));
@@ -196,16 +202,24 @@ public:
 	void setCurrentSize(quint64 nCurrentSize) { m_nCurrentSize += nCurrentSize; }
 	int getProgress() { return  m_nProgress; }
 	void setProgress(int nProgress) { m_nProgress = nProgress; }
+	/* bytes per second between two last progress notifications */
+	quint64 getThroughput() { return m_nThroughput; }
 protected:
 	QString m_sParam;
 	quint64 m_nTotalSize;
 	quint64 m_nCurrentSize;
 	int m_nProgress;
+	quint64 m_nThroughput;
+	/* tick and size of the last throughput sample */
+	PRL_UINT64 m_nSampleTick;
+	quint64 m_nSampleSize;
 	QString m_sWorkPath;
 	int m_nRemoteVersion;
 	int m_nRemotePlatform;
 	void (*m_pSendProgressNotification)
 		(const SmartPtr<IOPackage> &, const QString &, const QString &, int);
+	void (*m_pSendProgressThroughputNotification)
+		(const SmartPtr<IOPackage> &, const QString &, const QString &, int, quint64);
 	void (*m_pSendCancelNotification)
 		(const SmartPtr<IOPackage> &, const QString &, const QString &);
 	void (*m_pSendFinishNotification)
@@ -236,6 +250,18 @@ public:
 	virtual void setName(const QString &sName) { Q_UNUSED(sName); }
 	virtual qint64 getBuffer() { return 0; }
 	virtual void freeBuffer() { return; }
+	/* sparse objects: move to the next data extent and return its offset
+	   (the object size if only a hole is left), -1 if holes are not known */
+	virtual qint64 seekData() { return -1; }
+	/* hand out the data read by getBuffer() for a deferred send,
+	   so that next getBuffer() does not overwrite it */
+	virtual SmartPtr<char> detachBuffer(qint64 nSize)
+	{
+		SmartPtr<char> b(new char[qMax(nSize, qint64(1))], SmartPtrPolicy::ArrayStorage);
+		if (nSize > 0)
+			memcpy(b.getImpl(), m_pBuffer.getImpl(), nSize);
+		return b;
+	}
 };
 
 /*
@@ -246,19 +272,99 @@ class CVmFileListCopyFile : public CVmFileListCopyObject
 private:
 	QFile m_cFile;
 	quint64 m_nBufSize;
+	/* end of the current data extent, -1 if unknown */
+	qint64 m_nHole;
 public:
 	CVmFileListCopyFile()
 	{
 		m_nBufSize = 1024*1024;
+		m_nHole = -1;
 		m_pBuffer = SmartPtr<char>(new char[m_nBufSize], SmartPtrPolicy::ArrayStorage);
 	}
-	virtual bool open(QFile::OpenMode mode) { return m_cFile.open(mode); }
+	/* chunks are big enough, and seekData() moves the descriptor itself */
+	virtual bool open(QFile::OpenMode mode)
+	{
+		m_nHole = -1;
+		return m_cFile.open(mode | QIODevice::Unbuffered);
+	}
 	virtual void close() { m_cFile.close(); }
 	virtual bool atEnd() { return m_cFile.atEnd(); }
 	virtual void setName(const QString &sName) { m_cFile.setFileName(sName); }
-	virtual qint64 getBuffer() { return m_cFile.read(m_pBuffer.getImpl(), m_nBufSize); }
+	virtual qint64 getBuffer()
+	{
+		qint64 n = m_nBufSize;
+		if (m_nHole > m_cFile.pos())
+			n = qMin(n, m_nHole - m_cFile.pos());
+		return m_cFile.read(m_pBuffer.getImpl(), n);
+	}
+	virtual qint64 seekData();
+	virtual SmartPtr<char> detachBuffer(qint64 nSize)
+	{
+		Q_UNUSED(nSize);
+		SmartPtr<char> b = m_pBuffer;
+		m_pBuffer = SmartPtr<char>(new char[m_nBufSize], SmartPtrPolicy::ArrayStorage);
+		return b;
+	}
+};
+
+namespace VmFileList
+{
+///////////////////////////////////////////////////////////////////////////////
+// struct Chunk
+
+struct Chunk
+{
+	Chunk(): file(-1), offset(-1), size(0), last(false), error(PRL_ERR_SUCCESS)
+	{
+	}
+
+	int file;
+	/* -1 for the chunk following the previous one */
+	qint64 offset;
+	SmartPtr<char> data;
+	qint64 size;
+	bool last;
+	PRL_RESULT error;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// class ReadAhead
+// reads the file list sequentially on its own thread and queues up to depth
+// chunks for the sender
+
+class ReadAhead: public QThread
+{
+public:
+	typedef QList<QPair<QFileInfo, QString> > objectList_type;
+
+	ReadAhead(CVmFileListCopyObject& object_, const objectList_type& files_,
+		int depth_, bool sparse_);
+	~ReadAhead();
+
+	bool pop(Chunk& dst_);
+	void stop();
+
+protected:
+	void run();
+
+private:
+	bool push(const Chunk& chunk_);
+
+	CVmFileListCopyObject* m_object;
+	const objectList_type* m_files;
+	int m_depth;
+	bool m_sparse;
+	bool m_stop;
+	bool m_done;
+	QMutex m_mutex;
+	QWaitCondition m_notEmpty;
+	QWaitCondition m_notFull;
+	QQueue<Chunk> m_queue;
 };
 
+} // namespace VmFileList
+
+
 /**
  * VM migration files copying procedure source side
  */
@@ -285,16 +391,30 @@ public:
 	PRL_RESULT SendFileRequest(objectList_type::const_reference fPair);
 	PRL_RESULT SendFinishRequest();
 	PRL_RESULT SetCopyObject(const SmartPtr<CVmFileListCopyObject> &pCopyObject);
+	/* number of file chunks and file headers allowed to be in flight.
+	   1 (default) sends chunk by chunk and waits for each file header ack */
+	void SetWindow(quint32 nWindow) { m_nWindow = qMax(nWindow, 1U); }
 
 	void cancelOperation();
 
 private:
 	PRL_RESULT SendReqWithAck(SmartPtr<IOPackage> pPkg);
+	PRL_RESULT PostPackage(const SmartPtr<IOPackage> &package, IOSendJob::Handle &job);
+	PRL_RESULT WaitReply(IOSendJob::Handle job, SmartPtr<IOPackage> &reply);
+	PRL_RESULT CheckAck(const SmartPtr<IOPackage> &ack);
 	PRL_RESULT SendFileBody(const QString & path);
+	PRL_RESULT SendFileListPipelined(const objectList_type &fileList);
+	PRL_RESULT Drain(QQueue<IOSendJob::Handle> &sends, QQueue<IOSendJob::Handle> &acks, int nKeep);
 	PRL_RESULT processTargetError(QString sErrorString);
+	SmartPtr<IOPackage> CreateFileRequest(objectList_type::const_reference fPair);
+	SmartPtr<IOPackage> CreateFileChunk(const SmartPtr<char> &data, qint64 size, bool last,
+		qint64 offset);
+	/* target accepts chunks at offsets, holes are not sent */
+	bool IsSparse() const;
 
 private:
 	SmartPtr<CVmFileListCopyObject> m_pCopyObject;
+	quint32 m_nWindow;
 };
 
 /**
@@ -0,0 +1,220 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright (c) 2006-2017, Parallels International GmbH
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+/// 
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+/// 
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+/// @file
+///		CDspLibvirtLoopTest.cpp
+///
+/// @brief
+///		Tests fixture class for testing the native libvirt event loop.
+///
+/// @brief
+///		None.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+#include <unistd.h>
+#include "CDspLibvirtLoopTest.h"
+#include "Dispatcher/Dispatcher/CDspLibvirtLoop.h"
+
+using Libvirt::Callback::Native::Histogram;
+using Libvirt::Callback::Native::Loop;
+
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+// struct Probe
+
+struct Probe
+{
+	static void handle(int , int socket_, int events_, void* opaque_)
+	{
+		char x;
+		if (VIR_EVENT_HANDLE_READABLE & events_)
+		{
+			ssize_t r = ::read(socket_, &x, sizeof(x));
+			Q_UNUSED(r);
+		}
+		((Probe* )opaque_)->calls.ref();
+	}
+	static void expire(int , void* opaque_)
+	{
+		((Probe* )opaque_)->calls.ref();
+	}
+	static void free(void* opaque_)
+	{
+		((Probe* )opaque_)->freed.ref();
+	}
+
+	QAtomicInt calls;
+	QAtomicInt freed;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct Pipe
+
+struct Pipe
+{
+	Pipe()
+	{
+		if (0 != ::pipe(m_fd))
+			m_fd[0] = m_fd[1] = -1;
+	}
+	~Pipe()
+	{
+		::close(m_fd[0]);
+		::close(m_fd[1]);
+	}
+
+	int getIn() const
+	{
+		return m_fd[0];
+	}
+	bool poke()
+	{
+		return 1 == ::write(m_fd[1], "x", 1);
+	}
+
+private:
+	int m_fd[2];
+};
+
+} // namespace
+
+void CDspLibvirtLoopTest::testHistogram()
+{
+	QCOMPARE(Histogram::locate(0), 0);
+	QCOMPARE(Histogram::locate(127), 0);
+	QCOMPARE(Histogram::locate(128), 1);
+	QCOMPARE(Histogram::locate(255), 1);
+	QCOMPARE(Histogram::locate(256), 2);
+	QCOMPARE(Histogram::locate(Q_UINT64_C(1) << 40), int(Histogram::SIZE) - 1);
+
+	Histogram h;
+	QCOMPARE(h.toString(), QString("no events"));
+	h.account(10);
+	h.account(200);
+	h.account(300);
+	QCOMPARE(h.getCount(), quint64(3));
+	QCOMPARE(h.getBucket(0), quint64(1));
+	QCOMPARE(h.getBucket(1), quint64(1));
+	QCOMPARE(h.getBucket(2), quint64(1));
+	QCOMPARE(h.toString(), QString("3 events, mean 170us, max 300us:"
+		" <128us 1 <256us 1 <512us 1"));
+	h.reset();
+	QCOMPARE(h.getCount(), quint64(0));
+}
+
+void CDspLibvirtLoopTest::testSocket()
+{
+	Pipe p;
+	Probe b;
+	Loop x;
+	QVERIFY(x.open());
+	QVERIFY(x.add(2, p.getIn(), VIR_EVENT_HANDLE_READABLE, &Probe::handle, &b, NULL));
+	QTest::qWait(50);
+	QCOMPARE(b.calls.load(), 0);
+
+	QVERIFY(p.poke());
+	QTRY_COMPARE(b.calls.load(), 1);
+	QVERIFY(p.poke());
+	QTRY_COMPARE(b.calls.load(), 2);
+	x.close();
+}
+
+void CDspLibvirtLoopTest::testSocketEvents()
+{
+	Pipe p;
+	Probe b;
+	Loop x;
+	QVERIFY(x.open());
+	QVERIFY(x.add(2, p.getIn(), 0, &Probe::handle, &b, NULL));
+	QVERIFY(p.poke());
+	QTest::qWait(50);
+	QCOMPARE(b.calls.load(), 0);
+
+	x.setEvents(2, VIR_EVENT_HANDLE_READABLE);
+	QTRY_COMPARE(b.calls.load(), 1);
+	x.setEvents(2, 0);
+	QVERIFY(p.poke());
+	QTest::qWait(50);
+	QCOMPARE(b.calls.load(), 1);
+	x.close();
+}
+
+void CDspLibvirtLoopTest::testTimeout()
+{
+	Probe b;
+	Loop x;
+	QVERIFY(x.open());
+	QVERIFY(x.add(2, -1, &Probe::expire, &b, NULL));
+	QTest::qWait(50);
+	QCOMPARE(b.calls.load(), 0);
+
+	x.setInterval(2, 10);
+	QTRY_VERIFY(3 <= b.calls.load());
+	x.setInterval(2, -1);
+	QTest::qWait(20);
+	int n = b.calls.load();
+	QTest::qWait(50);
+	QCOMPARE(b.calls.load(), n);
+
+	x.setInterval(2, 0);
+	QTRY_VERIFY(n < b.calls.load());
+	x.close();
+}
+
+void CDspLibvirtLoopTest::testRemove()
+{
+	Pipe p;
+	Probe b;
+	Loop x;
+	QVERIFY(x.open());
+	QVERIFY(x.add(2, 1000, &Probe::expire, &b, &Probe::free));
+	QVERIFY(x.add(3, p.getIn(), VIR_EVENT_HANDLE_READABLE, &Probe::handle, &b, &Probe::free));
+	QCOMPARE(x.remove(2), 0);
+	QCOMPARE(x.remove(2), -1);
+	QTRY_COMPARE(b.freed.load(), 1);
+	QCOMPARE(x.remove(3), 0);
+	QTRY_COMPARE(b.freed.load(), 2);
+
+	QVERIFY(p.poke());
+	QTest::qWait(50);
+	QCOMPARE(b.calls.load(), 0);
+	x.close();
+}
+
+void CDspLibvirtLoopTest::testClose()
+{
+	Pipe p;
+	Probe b;
+	Loop x;
+	QVERIFY(!x.add(2, 10, &Probe::expire, &b, &Probe::free));
+	QVERIFY(x.open());
+	QVERIFY(x.add(2, 1000, &Probe::expire, &b, &Probe::free));
+	QVERIFY(x.add(3, p.getIn(), VIR_EVENT_HANDLE_READABLE, &Probe::handle, &b, &Probe::free));
+	x.close();
+	QCOMPARE(b.freed.load(), 2);
+	QVERIFY(!x.add(4, 10, &Probe::expire, &b, &Probe::free));
+	QCOMPARE(x.remove(3), -1);
+}
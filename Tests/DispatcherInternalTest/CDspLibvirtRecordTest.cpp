@@ -0,0 +1,237 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright (c) 2006-2017, Parallels International GmbH
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+/// 
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+/// 
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+/// @file
+///		CDspLibvirtRecordTest.cpp
+///
+/// @brief
+///		Tests fixture class for testing libvirt domain stats records decoding.
+///
+/// @brief
+///		None.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include "CDspLibvirtRecordTest.h"
+#include "Dispatcher/Dispatcher/CDspLibvirtRecord.h"
+
+using Libvirt::Instrument::Agent::Vm::Performance::Record;
+
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+// struct Params
+
+struct Params
+{
+	void addULLong(const QString& name_, quint64 value_)
+	{
+		virTypedParameter& p = add(name_, VIR_TYPED_PARAM_ULLONG);
+		p.value.ul = value_;
+	}
+	void addUInt(const QString& name_, unsigned value_)
+	{
+		virTypedParameter& p = add(name_, VIR_TYPED_PARAM_UINT);
+		p.value.ui = value_;
+	}
+	void addString(const QString& name_, const QString& value_)
+	{
+		m_strings << value_.toUtf8();
+		virTypedParameter& p = add(name_, VIR_TYPED_PARAM_STRING);
+		p.value.s = m_strings.last().data();
+	}
+	const virTypedParameter* data() const
+	{
+		return m_params.constData();
+	}
+	int size() const
+	{
+		return m_params.size();
+	}
+
+private:
+	virTypedParameter& add(const QString& name_, int type_)
+	{
+		virTypedParameter p;
+		::memset(&p, 0, sizeof(p));
+		::strncpy(p.field, qPrintable(name_), VIR_TYPED_PARAM_FIELD_LENGTH - 1);
+		p.type = type_;
+		m_params.append(p);
+		return m_params.last();
+	}
+
+	QVector<virTypedParameter> m_params;
+	QList<QByteArray> m_strings;
+};
+
+// a record of a domain with many devices as libvirt reports it
+void fill(Params& dst_, unsigned devices_)
+{
+	dst_.addString("state.state", "running");
+	dst_.addULLong("cpu.time", 1000000);
+	dst_.addULLong("cpu.user", 600000);
+	dst_.addULLong("cpu.system", 400000);
+	dst_.addULLong("balloon.current", 1048576);
+	dst_.addULLong("balloon.maximum", 2097152);
+	dst_.addUInt("vcpu.current", devices_);
+	dst_.addUInt("vcpu.maximum", devices_);
+	for (unsigned i = 0; i < devices_; ++i)
+	{
+		dst_.addUInt(QString("vcpu.%1.state").arg(i), 1);
+		dst_.addULLong(QString("vcpu.%1.time").arg(i), 100 + i);
+	}
+	dst_.addUInt("net.count", devices_);
+	for (unsigned i = 0; i < devices_; ++i)
+	{
+		dst_.addString(QString("net.%1.name").arg(i), QString("vme%1").arg(i));
+		dst_.addULLong(QString("net.%1.rx.bytes").arg(i), 1000 + i);
+		dst_.addULLong(QString("net.%1.rx.pkts").arg(i), 10 + i);
+		dst_.addULLong(QString("net.%1.rx.errs").arg(i), 0);
+		dst_.addULLong(QString("net.%1.rx.drop").arg(i), 0);
+		dst_.addULLong(QString("net.%1.tx.bytes").arg(i), 2000 + i);
+		dst_.addULLong(QString("net.%1.tx.pkts").arg(i), 20 + i);
+		dst_.addULLong(QString("net.%1.tx.errs").arg(i), 0);
+		dst_.addULLong(QString("net.%1.tx.drop").arg(i), 0);
+	}
+	dst_.addUInt("block.count", devices_);
+	for (unsigned i = 0; i < devices_; ++i)
+	{
+		dst_.addString(QString("block.%1.name").arg(i), QString("sd%1").arg(i));
+		dst_.addString(QString("block.%1.path").arg(i), QString("/vz/disk%1.hdd").arg(i));
+		dst_.addULLong(QString("block.%1.rd.reqs").arg(i), 30 + i);
+		dst_.addULLong(QString("block.%1.rd.bytes").arg(i), 3000 + i);
+		dst_.addULLong(QString("block.%1.rd.times").arg(i), 0);
+		dst_.addULLong(QString("block.%1.wr.reqs").arg(i), 40 + i);
+		dst_.addULLong(QString("block.%1.wr.bytes").arg(i), 4000 + i);
+		dst_.addULLong(QString("block.%1.wr.times").arg(i), 0);
+		dst_.addULLong(QString("block.%1.capacity").arg(i), 5000 + i);
+		dst_.addULLong(QString("block.%1.allocation").arg(i), 6000 + i);
+		dst_.addULLong(QString("block.%1.physical").arg(i), 7000 + i);
+	}
+}
+
+} // namespace
+
+void CDspLibvirtRecordTest::testCpu()
+{
+	Params p;
+	fill(p, 4);
+	Record r;
+	r.decode(p.data(), p.size());
+
+	quint64 v = 0;
+	QVERIFY(r.cpu.get(Record::CPU_TIME, v));
+	QCOMPARE(v, quint64(1000000));
+	QVERIFY(r.vcpuCurrent);
+	QCOMPARE(r.vcpuCurrent.get(), 4u);
+	QCOMPARE(r.vcpu.size(), 4);
+	QVERIFY(r.vcpu[3].get(Record::VCPU_TIME, v));
+	QCOMPARE(v, quint64(103));
+}
+
+void CDspLibvirtRecordTest::testDevices()
+{
+	Params p;
+	fill(p, 3);
+	Record r;
+	r.decode(p.data(), p.size());
+
+	QCOMPARE(r.block.size(), 3);
+	QCOMPARE(r.block[1].name, QString("/vz/disk1.hdd"));
+	quint64 v = 0;
+	QVERIFY(r.block[1].values.get(Record::BLOCK_RD_REQS, v));
+	QCOMPARE(v, quint64(31));
+	QVERIFY(r.block[2].values.get(Record::BLOCK_PHYSICAL, v));
+	QCOMPARE(v, quint64(7002));
+
+	QCOMPARE(r.net.size(), 3);
+	QCOMPARE(r.net[2].name, QString("vme2"));
+	QVERIFY(r.net[2].values.get(Record::NET_TX_PKTS, v));
+	QCOMPARE(v, quint64(22));
+	QVERIFY(r.net[0].values.get(Record::NET_RX_BYTES, v));
+	QCOMPARE(v, quint64(1000));
+}
+
+void CDspLibvirtRecordTest::testBalloon()
+{
+	Params p;
+	fill(p, 1);
+	Record r;
+	r.decode(p.data(), p.size());
+
+	quint64 v = 0;
+	QVERIFY(r.balloon.get(Record::BALLOON_CURRENT, v));
+	QCOMPARE(v, quint64(1048576));
+	QVERIFY(r.balloon.get(Record::BALLOON_MAXIMUM, v));
+	QCOMPARE(v, quint64(2097152));
+	QVERIFY(!r.balloon.get(Record::BALLOON_UNUSED, v));
+	QVERIFY(!r.balloon.get(Record::BALLOON_RSS, v));
+}
+
+void CDspLibvirtRecordTest::testWrongTypes()
+{
+	Params p;
+	p.addUInt("cpu.time", 10);
+	p.addULLong("vcpu.current", 2);
+	p.addULLong("block.0.path", 1);
+	p.addString("block.0.rd.reqs", "1");
+	Record r;
+	r.decode(p.data(), p.size());
+
+	quint64 v = 0;
+	QVERIFY(!r.cpu.get(Record::CPU_TIME, v));
+	QVERIFY(!r.vcpuCurrent);
+	QCOMPARE(r.block.size(), 1);
+	QVERIFY(r.block[0].name.isEmpty());
+	QVERIFY(!r.block[0].values.get(Record::BLOCK_RD_REQS, v));
+}
+
+void CDspLibvirtRecordTest::testIndexOutOfRecord()
+{
+	Params p;
+	p.addULLong("block.4000000000.rd.reqs", 1);
+	p.addULLong("net.7.rx.bytes", 1);
+	p.addULLong("vcpu.x.time", 1);
+	Record r;
+	r.decode(p.data(), p.size());
+
+	QVERIFY(r.block.isEmpty());
+	QVERIFY(r.net.isEmpty());
+	QVERIFY(r.vcpu.isEmpty());
+}
+
+void CDspLibvirtRecordTest::benchmarkDecode()
+{
+	Params p;
+	fill(p, 64);
+	quint64 v = 0;
+	QBENCHMARK
+	{
+		Record r;
+		r.decode(p.data(), p.size());
+		r.block[63].values.get(Record::BLOCK_WR_BYTES, v);
+	}
+	QCOMPARE(v, quint64(4063));
+}
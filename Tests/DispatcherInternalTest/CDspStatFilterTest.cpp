@@ -0,0 +1,103 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright (c) 2006-2017, Parallels International GmbH
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+/// 
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+/// 
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+/// @file
+///		CDspStatFilterTest.cpp
+///
+/// @brief
+///		Tests fixture class for testing performance counters subscription filters.
+///
+/// @brief
+///		None.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+#include "CDspStatFilterTest.h"
+#include "Dispatcher/Dispatcher/Stat/CDspStatFilter.h"
+
+void CDspStatFilterTest::testAny()
+{
+	Stat::Filter a(""), b("*");
+
+	QVERIFY(a.match("guest.ram.usage"));
+	QVERIFY(b.match("net.nic0.pkts_in"));
+	QVERIFY(a.admits("devices.ide"));
+}
+
+void CDspStatFilterTest::testWildcards()
+{
+	Stat::Filter f("net.nic#.*");
+
+	QVERIFY(f.match("net.nic0.pkts_in"));
+	QVERIFY(f.match("net.nic12.bytes_out"));
+	QVERIFY(!f.match("net.nic.pkts_in"));
+	QVERIFY(!f.match("net.nicX.pkts_in"));
+	QVERIFY(!f.match("guest.cpu.usage"));
+	// the verdict is remembered
+	QVERIFY(f.match("net.nic0.pkts_in"));
+}
+
+void CDspStatFilterTest::testHeadBeforeOptional()
+{
+	Stat::Filter f("net.nic1?");
+
+	QVERIFY(f.match("net.nic"));
+	QVERIFY(f.match("net.nic1"));
+	QVERIFY(!f.match("net.nic2"));
+	QVERIFY(f.admits("net.nic"));
+}
+
+void CDspStatFilterTest::testHeadBeforeRepeat()
+{
+	Stat::Filter f("net.nic0{0,1}.pkts_in");
+
+	QVERIFY(f.match("net.nic.pkts_in"));
+	QVERIFY(f.match("net.nic0.pkts_in"));
+	QVERIFY(!f.match("net.nic1.pkts_in"));
+}
+
+void CDspStatFilterTest::testAdmitsFamily()
+{
+	Stat::Filter f("devices.ide#.*");
+
+	QVERIFY(f.admits("devices.ide"));
+	QVERIFY(f.admits("devices"));
+	QVERIFY(!f.admits("devices.scsi"));
+	QVERIFY(!f.admits("net.nic"));
+}
+
+void CDspStatFilterTest::testCompileOnce()
+{
+	CVmIdent v = MakeVmIdent("{vm}", "{dir}");
+
+	QVERIFY(Stat::Filter::find(v, "guest.*").isNull());
+	QSharedPointer<Stat::Filter> a = Stat::Filter::compile(v, "guest.*");
+	QVERIFY(Stat::Filter::compile(v, "guest.*") == a);
+	QVERIFY(Stat::Filter::find(v, "guest.*") == a);
+	QVERIFY(Stat::Filter::compile(v, "net.*") != a);
+
+	Stat::Filter::drop(v, "guest.*");
+	Stat::Filter::drop(v, "net.*");
+	QVERIFY(Stat::Filter::find(v, "guest.*").isNull());
+}
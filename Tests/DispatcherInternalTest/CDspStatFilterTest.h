@@ -0,0 +1,53 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright (c) 2006-2017, Parallels International GmbH
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+/// 
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+/// 
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+/// @file
+///		CDspStatFilterTest.h
+///
+/// @brief
+///		Tests fixture class for testing performance counters subscription filters.
+///
+/// @brief
+///		None.
+///
+/////////////////////////////////////////////////////////////////////////////
+#ifndef CDspStatFilterTest_H
+#define CDspStatFilterTest_H
+
+#include <QtTest/QtTest>
+
+class CDspStatFilterTest : public QObject
+{
+Q_OBJECT
+
+private slots:
+	void testAny();
+	void testWildcards();
+	void testHeadBeforeOptional();
+	void testHeadBeforeRepeat();
+	void testAdmitsFamily();
+	void testCompileOnce();
+};
+
+#endif
@@ -0,0 +1,232 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright (c) 2006-2017, Parallels International GmbH
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+/// 
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+/// 
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+/// @file
+///		CDspStatStorageTest.cpp
+///
+/// @brief
+///		Tests fixture class for testing per VM performance counters storage.
+///
+/// @brief
+///		None.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+#include <QThread>
+#include "CDspStatStorageTest.h"
+#include "Dispatcher/Dispatcher/Stat/CDspStatStorage.h"
+
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////
+// struct Writer
+
+struct Writer: QThread
+{
+	Writer(Stat::Storage& storage_, Stat::counterId_type id_, quint64 base_):
+		m_base(base_), m_id(id_), m_storage(&storage_)
+	{
+	}
+
+protected:
+	void run()
+	{
+		// value and time always go in pairs to detect torn reads
+		for (quint64 i = 1; i <= 100000; ++i)
+			m_storage->write(m_id, m_base + i, m_base + i);
+	}
+
+private:
+	quint64 m_base;
+	Stat::counterId_type m_id;
+	Stat::Storage* m_storage;
+};
+
+} // namespace
+
+void CDspStatStorageTest::testInternSameNameOnce()
+{
+	Stat::Storage s("vm");
+	boost::optional<Stat::counterId_type> a = s.addAbsolute("cpu_time");
+	boost::optional<Stat::counterId_type> b = s.addIncremental("mem.guest_used");
+	QVERIFY(a);
+	QVERIFY(b);
+	QVERIFY(a.get() != b.get());
+	QCOMPARE(s.addAbsolute("cpu_time").get(), a.get());
+	QCOMPARE(s.addIncremental("cpu_time").get(), a.get());
+	QCOMPARE(s.find("mem.guest_used").get(), b.get());
+}
+
+void CDspStatStorageTest::testReadWriteByName()
+{
+	Stat::Storage s("vm");
+	s.addAbsolute("cpu_time");
+	QVERIFY(s.read("cpu_time") == Stat::timedValue_type());
+	s.write("cpu_time", 42, 1000);
+	QVERIFY(s.read("cpu_time") == Stat::timedValue_type(42, 1000));
+	s.write("cpu_time", 43, 2000);
+	QVERIFY(s.read("cpu_time") == Stat::timedValue_type(43, 2000));
+}
+
+void CDspStatStorageTest::testReadWriteById()
+{
+	Stat::Storage s("vm");
+	Stat::counterId_type x = s.addAbsolute("mem.guest_total").get();
+	s.write(x, 1024, 10);
+	QVERIFY(s.read(x) == Stat::timedValue_type(1024, 10));
+	QVERIFY(s.read("mem.guest_total") == Stat::timedValue_type(1024, 10));
+}
+
+void CDspStatStorageTest::testUnknownCounter()
+{
+	Stat::Storage s("vm");
+	QVERIFY(!s.find("net.nic0.bytes_in"));
+	s.write("net.nic0.bytes_in", 1, 1);
+	QVERIFY(!s.find("net.nic0.bytes_in"));
+	QVERIFY(s.read("net.nic0.bytes_in") == Stat::timedValue_type());
+	s.write(Stat::counterId_type(7), 1, 1);
+	QVERIFY(s.read(Stat::counterId_type(7)) == Stat::timedValue_type());
+}
+
+void CDspStatStorageTest::testManyCounters()
+{
+	Stat::Storage s("vm");
+	for (quint64 i = 0; i < 1000; ++i)
+	{
+		Stat::counterId_type x = s.addAbsolute(Stat::Name::VCpu::getName(i)).get();
+		s.write(x, i, i + 1);
+	}
+	for (quint64 i = 0; i < 1000; ++i)
+	{
+		QVERIFY(s.read(Stat::Name::VCpu::getName(i)) ==
+			Stat::timedValue_type(i, i + 1));
+	}
+}
+
+void CDspStatStorageTest::testConcurrentWrites()
+{
+	Stat::Storage s("vm");
+	Stat::counterId_type x = s.addAbsolute("cpu_time").get();
+	Writer a(s, x, 0), b(s, x, 1000000);
+	a.start();
+	b.start();
+	bool torn = false;
+	while (a.isRunning() || b.isRunning())
+	{
+		Stat::timedValue_type v = s.read(x);
+		torn = torn || v.first != v.second;
+	}
+	a.wait();
+	b.wait();
+	QVERIFY(!torn);
+	Stat::timedValue_type v = s.read(x);
+	QVERIFY(v.first == 100000 || v.first == 1100000);
+}
+
+void CDspStatStorageTest::testVCpuNames()
+{
+	QCOMPARE(Stat::Name::VCpu::getName(0), QString("guest.vcpu0.time"));
+	QCOMPARE(Stat::Name::VCpu::getName(255), QString("guest.vcpu255.time"));
+	QCOMPARE(Stat::Name::VCpu::getName(256), QString("guest.vcpu256.time"));
+}
+
+void CDspStatStorageTest::testColumnById()
+{
+	Stat::Storage s("vm");
+	Stat::Column c;
+	Stat::counterId_type x = s.addAbsolute("cpu_time").get();
+
+	QCOMPARE(c.find(s, 0, "cpu_time").get(), x);
+	QCOMPARE(c.find(s, 1, "mem.guest_used").get(), s.find("mem.guest_used").get());
+	QCOMPARE(c.find(s, 0, "cpu_time").get(), x);
+	QCOMPARE(s.getCounters().size(), 2);
+}
+
+void CDspStatStorageTest::testColumnRenamed()
+{
+	Stat::Storage s("vm");
+	Stat::Column c;
+
+	Stat::counterId_type x = c.find(s, 0, "guest.vcpu0.time").get();
+	// a missing leaf shifts the names of the list
+	Stat::counterId_type y = c.find(s, 0, "guest.vcpu1.time").get();
+	QVERIFY(x != y);
+	QCOMPARE(s.find("guest.vcpu1.time").get(), y);
+	QCOMPARE(c.find(s, 0, "guest.vcpu0.time").get(), x);
+}
+
+void CDspStatStorageTest::testHistoryIsOff()
+{
+	Stat::Storage s("vm");
+	Stat::counterId_type x = s.addAbsolute("cpu_time").get();
+	s.write(x, 1, 1);
+	QVERIFY(s.readHistory(x, Stat::History::TIER_RAW, 0).isEmpty());
+}
+
+void CDspStatStorageTest::testHistoryRaw()
+{
+	Stat::Storage s("vm");
+	Stat::counterId_type x = s.addAbsolute("cpu_time").get();
+	s.watch();
+	// 10 secs apart, more than the raw depth
+	for (quint64 i = 0; i < 200; ++i)
+		s.write(x, i, i * 10000000);
+
+	QList<Stat::Rollup> h = s.readHistory(x, Stat::History::TIER_RAW, 0);
+	QVERIFY(!h.isEmpty());
+	QVERIFY(h.size() < 200);
+	QCOMPARE(h.last().getAverage(), quint64(199));
+	QCOMPARE(h.last().count, quint32(1));
+	for (int i = 1; i < h.size(); ++i)
+		QVERIFY(h.at(i - 1).time < h.at(i).time);
+
+	h = s.readHistory(x, Stat::History::TIER_RAW, 190 * 10000000ULL);
+	QCOMPARE(h.size(), 10);
+	QCOMPARE(h.first().getAverage(), quint64(190));
+}
+
+void CDspStatStorageTest::testHistoryRollups()
+{
+	Stat::Storage s("vm");
+	Stat::counterId_type x = s.addAbsolute("mem.guest_used").get();
+	s.watch();
+	// 6 samples per minute for 2 hours
+	for (quint64 i = 0; i < 720; ++i)
+		s.write(x, i % 6, i * 10000000);
+
+	QList<Stat::Rollup> m = s.readHistory(x, Stat::History::TIER_MINUTE, 0);
+	QCOMPARE(m.size(), 120);
+	foreach (const Stat::Rollup& r, m)
+	{
+		QCOMPARE(r.count, quint32(6));
+		QCOMPARE(r.min, quint64(0));
+		QCOMPARE(r.max, quint64(5));
+		QCOMPARE(r.getAverage(), quint64(2));
+	}
+	QList<Stat::Rollup> h = s.readHistory(x, Stat::History::TIER_HOUR, 0);
+	QCOMPARE(h.size(), 2);
+	QCOMPARE(h.first().count, quint32(360));
+	QCOMPARE(h.first().time, quint64(0));
+	QCOMPARE(h.last().time, quint64(3600) * 1000000);
+}
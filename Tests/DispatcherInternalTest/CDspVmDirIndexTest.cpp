@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright (c) 2006-2017, Parallels International GmbH
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+/// 
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+/// 
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+/// @file
+///		CDspVmDirIndexTest.cpp
+///
+/// @brief
+///		Tests fixture class for testing the VM directory catalogue index.
+///
+/// @brief
+///		None.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+#include "CDspVmDirIndexTest.h"
+#include "Dispatcher/Dispatcher/CDspSync.h"
+#include "Dispatcher/Dispatcher/CDspVmDirIndex.h"
+
+using Vm::Directory::Index;
+
+namespace
+{
+const char DIR[] = "{5f8e1b1c-0000-4000-8000-000000000001}";
+
+CVmDirectoryItem* make(const QString& uuid_, const QString& name_)
+{
+	CVmDirectoryItem* output = new CVmDirectoryItem();
+	output->setVmUuid(uuid_);
+	output->setVmName(name_);
+	output->setVmHome(QString("/vz/vmprivate/%1/config.pvs").arg(name_));
+	return output;
+}
+
+void fill(CVmDirectories& dst_)
+{
+	CVmDirectory* d = new CVmDirectory(DIR, "/vz/vmprivate", "test");
+	d->addVmDirectoryItem(make("vm1", "one"));
+	d->addVmDirectoryItem(make("vm2", "two"));
+	dst_.addVmDirectory(d);
+}
+
+} // namespace
+
+void CDspVmDirIndexTest::testFind()
+{
+	CVmDirectories c;
+	fill(c);
+	Index x;
+	CVmDirectoryItem* i = x.findByUuid(c, DIR, "vm2");
+	QVERIFY(NULL != i);
+	QCOMPARE(i->getVmName(), QString("two"));
+	QCOMPARE(x.findByName(c, DIR, "two"), i);
+	QCOMPARE(x.findByHome(c, DIR, "/vz/vmprivate/two/config.pvs"), i);
+	QVERIFY(NULL == x.findByUuid(c, DIR, "vm3"));
+	QVERIFY(NULL == x.findByName(c, DIR, "three"));
+}
+
+void CDspVmDirIndexTest::testUnknownDirectory()
+{
+	CVmDirectories c;
+	fill(c);
+	Index x;
+	QVERIFY(NULL == x.findDirectory(c, "unknown"));
+	QVERIFY(NULL == x.findByUuid(c, "unknown", "vm1"));
+}
+
+void CDspVmDirIndexTest::testAddedViaLockedPointer()
+{
+	QMutex m(QMutex::Recursive);
+	CVmDirectories c;
+	fill(c);
+	Index x;
+	QVERIFY(NULL == x.findByUuid(c, DIR, "vm3"));
+	{
+		CDspLockedPointer<CVmDirectories> p(&m, &c);
+		p->getVmDirectoryByUuid(DIR)->addVmDirectoryItem(make("vm3", "three"));
+	}
+	CVmDirectoryItem* i = x.findByUuid(c, DIR, "vm3");
+	QVERIFY(NULL != i);
+	QCOMPARE(i->getVmName(), QString("three"));
+	QCOMPARE(x.findByName(c, DIR, "three"), i);
+	QCOMPARE(x.findByHome(c, DIR, "/vz/vmprivate/three/config.pvs"), i);
+}
+
+void CDspVmDirIndexTest::testRenamedViaLockedPointer()
+{
+	QMutex m(QMutex::Recursive);
+	CVmDirectories c;
+	fill(c);
+	Index x;
+	CVmDirectoryItem* i = x.findByName(c, DIR, "one");
+	QVERIFY(NULL != i);
+	{
+		CDspLockedPointer<CVmDirectories> p(&m, &c);
+		i->setVmName("first");
+	}
+	QVERIFY(NULL == x.findByName(c, DIR, "one"));
+	QCOMPARE(x.findByName(c, DIR, "first"), i);
+	QCOMPARE(x.findByUuid(c, DIR, "vm1"), i);
+}
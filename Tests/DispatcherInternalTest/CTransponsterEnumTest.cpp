@@ -0,0 +1,106 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright (c) 2006-2017, Parallels International GmbH
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+/// 
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+/// 
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+/// @file
+///		CTransponsterEnumTest.cpp
+///
+/// @brief
+///		Tests fixture class for testing the generated enum tables of
+///		the transponster.
+///
+/// @brief
+///		None.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+
+#include "CTransponsterEnumTest.h"
+#include "Libraries/Transponster/marshal.h"
+#include "Libraries/Transponster/domain_enum.h"
+
+using Libvirt::Enum;
+using namespace Libvirt::Domain::Xml;
+
+namespace
+{
+template<class T>
+int find(const QString& text_)
+{
+	return Enum<T>::find(QStringRef(&text_));
+}
+
+} // namespace
+
+void CTransponsterEnumTest::testEveryText()
+{
+	for (int i = ETypeQemu; i <= ETypeBhyve; ++i)
+	{
+		QString t = Enum<EType>::getText(static_cast<EType>(i));
+		QVERIFY(!t.isEmpty());
+		QCOMPARE(find<EType>(t), i);
+	}
+	QCOMPARE(Enum<EMode>::getText(EModeHostPassthrough),
+		QString("host-passthrough"));
+	QCOMPARE(find<EMode>("host-model"), int(EModeHostModel));
+	QCOMPARE(find<EMode>("maximum"), int(EModeMaximum));
+}
+
+void CTransponsterEnumTest::testTrimmed()
+{
+	QString x(" \tkvm\n");
+	QCOMPARE(Enum<EType>::find(QStringRef(&x).trimmed()), int(ETypeKvm));
+}
+
+void CTransponsterEnumTest::testUnknown()
+{
+	QCOMPARE(find<EType>(QString()), -1);
+	QCOMPARE(find<EType>("Kvm"), -1);
+	QCOMPARE(find<EType>("kv"), -1);
+	QCOMPARE(find<EType>("kvmm"), -1);
+	QCOMPARE(find<EType>("k vm"), -1);
+	QCOMPARE(find<EMode>("host-modem"), -1);
+}
+
+void CTransponsterEnumTest::testMarshal()
+{
+	Libvirt::Access<EVirOnOff> a;
+	QCOMPARE(Libvirt::Marshal<EVirOnOff>::setString(" off ", a), 1);
+	QCOMPARE(a.getValue(), EVirOnOffOff);
+	QCOMPARE(Libvirt::Marshal<EVirOnOff>::getString(a), QString("off"));
+	QCOMPARE(Libvirt::Marshal<EVirOnOff>::setString("of", a), -1);
+	QCOMPARE(a.getValue(), EVirOnOffOff);
+}
+
+void CTransponsterEnumTest::benchmarkFind()
+{
+	QStringList x;
+	for (int i = ETypeQemu; i <= ETypeBhyve; ++i)
+		x << Enum<EType>::getText(static_cast<EType>(i));
+
+	QBENCHMARK
+	{
+		foreach (const QString& t, x)
+			find<EType>(t);
+	}
+}
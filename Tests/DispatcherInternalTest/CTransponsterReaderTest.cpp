@@ -0,0 +1,186 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright (c) 2006-2017, Parallels International GmbH
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+/// 
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+/// 
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+/// @file
+///		CTransponsterReaderTest.cpp
+///
+/// @brief
+///		Tests fixture class for testing the stream based XML reader of
+///		the transponster.
+///
+/// @brief
+///		None.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+#include "CTransponsterReaderTest.h"
+#include <QDomDocument>
+#include "Libraries/Transponster/Direct.h"
+
+using Transponster::Direct::Reader;
+
+namespace
+{
+// a domain of a VM with the given number of disks and adapters
+QByteArray makeDomain(int devices_)
+{
+	QString d;
+	for (int i = 0; i < devices_; ++i)
+	{
+		d += QString(
+			"    <disk type='file' device='disk'>\n"
+			"      <driver name='qemu' type='qcow2' cache='none'/>\n"
+			"      <source file='/vz/vmprivate/vm/harddisk%1.hdd/harddisk.hdd'/>\n"
+			"      <target dev='sd%2' bus='scsi'/>\n"
+			"      <serial>%3</serial>\n"
+			"      <address type='drive' controller='0' bus='0' target='0' unit='%1'/>\n"
+			"    </disk>\n"
+			"    <interface type='bridge'>\n"
+			"      <mac address='00:1c:42:00:%4:%5'/>\n"
+			"      <source bridge='br0'/>\n"
+			"      <target dev='vme%3'/>\n"
+			"      <model type='virtio'/>\n"
+			"    </interface>\n")
+			.arg(i).arg(QChar('a' + i % 26)).arg(1000 + i)
+			.arg(i / 256, 2, 16, QChar('0')).arg(i % 256, 2, 16, QChar('0'));
+	}
+	return QString(
+		"<domain type='kvm'>\n"
+		"  <name>bench</name>\n"
+		"  <uuid>8f2f6a51-8b8d-4c3d-9c38-3a2d1e6b2f10</uuid>\n"
+		"  <description><![CDATA[a <bench> VM]]></description>\n"
+		"  <memory unit='KiB'>2097152</memory>\n"
+		"  <currentMemory unit='KiB'>2097152</currentMemory>\n"
+		"  <vcpu placement='static'>2</vcpu>\n"
+		"  <os>\n"
+		"    <type arch='x86_64' machine='pc'>hvm</type>\n"
+		"    <boot dev='hd'/>\n"
+		"  </os>\n"
+		"  <features>\n"
+		"    <acpi/>\n"
+		"    <apic/>\n"
+		"  </features>\n"
+		"  <clock offset='utc'/>\n"
+		"  <on_poweroff>destroy</on_poweroff>\n"
+		"  <on_reboot>restart</on_reboot>\n"
+		"  <on_crash>destroy</on_crash>\n"
+		"  <devices>\n"
+		"    <!-- generated -->\n"
+		"%1"
+		"  </devices>\n"
+		"</domain>\n").arg(d).toUtf8();
+}
+
+} // namespace
+
+void CTransponsterReaderTest::testSameDom_data()
+{
+	QTest::addColumn<QByteArray>("xml");
+
+	QTest::newRow("plain") << QByteArray("<a x='1'><b>text</b><c/></a>");
+	QTest::newRow("whitespace") << QByteArray("<a>\n  <b> spaced text </b>\n  <c>  </c>\n</a>");
+	QTest::newRow("namespaces") << QByteArray(
+		"<domain xmlns:vz='http://www.virtuozzo.com/vz'>"
+		"<metadata><vz:info vz:id='7' type='x'>y</vz:info></metadata>"
+		"</domain>");
+	QTest::newRow("default namespace") << QByteArray(
+		"<a xmlns='urn:a'><b xmlns='urn:b' c='d'/></a>");
+	QTest::newRow("cdata and entities") << QByteArray(
+		"<a><b><![CDATA[<x>]]>&amp;&lt;&#65;</b></a>");
+	QTest::newRow("comments and pi") << QByteArray(
+		"<!-- head --><a><!-- in --><?pi data?><b/></a>");
+	QTest::newRow("domain") << makeDomain(4);
+}
+
+void CTransponsterReaderTest::testSameDom()
+{
+	QFETCH(QByteArray, xml);
+
+	QDomDocument x;
+	QVERIFY(x.setContent(xml, true));
+	QDomDocument y;
+	QVERIFY(Reader::load(xml, y));
+	QCOMPARE(y.toString(), x.toString());
+}
+
+void CTransponsterReaderTest::testMalformed()
+{
+	QDomDocument x;
+	QVERIFY(!Reader::load(QByteArray(), x));
+	QVERIFY(!Reader::load("<a><b></a>", x));
+	QVERIFY(!Reader::load("<a></a><b/>", x));
+	QVERIFY(!Reader::load("<a x='1' x='2'/>", x));
+}
+
+void CTransponsterReaderTest::testSameDomain()
+{
+	QByteArray z = makeDomain(8);
+	QDomDocument x;
+	QVERIFY(x.setContent(z, true));
+	QDomDocument y;
+	QVERIFY(Reader::load(z, y));
+
+	Libvirt::Domain::Xml::Domain a, b;
+	bool u = a.load(x.documentElement());
+	QCOMPARE(b.load(y.documentElement()), u);
+	if (!u)
+		return;
+
+	QDomDocument v, w;
+	QVERIFY(a.save(v));
+	QVERIFY(b.save(w));
+	QCOMPARE(w.toString(), v.toString());
+}
+
+void CTransponsterReaderTest::benchmarkSetContent()
+{
+	QByteArray z = makeDomain(64);
+	QBENCHMARK
+	{
+		QDomDocument x;
+		x.setContent(z, true);
+	}
+}
+
+void CTransponsterReaderTest::benchmarkReader()
+{
+	QByteArray z = makeDomain(64);
+	QBENCHMARK
+	{
+		QDomDocument x;
+		Reader::load(z, x);
+	}
+}
+
+void CTransponsterReaderTest::benchmarkDomainLoad()
+{
+	QByteArray z = makeDomain(64);
+	QBENCHMARK
+	{
+		QDomDocument x;
+		Reader::load(z, x);
+		Libvirt::Domain::Xml::Domain d;
+		d.load(x.documentElement());
+	}
+}
@@ -0,0 +1,304 @@
+/////////////////////////////////////////////////////////////////////////////
+///
+/// Copyright (c) 2006-2017, Parallels International GmbH
+/// Copyright (c) 2017-2019 Virtuozzo International GmbH, All rights reserved.
+///
+/// This file is part of Virtuozzo Core. Virtuozzo Core is free
+/// software; you can redistribute it and/or modify it under the terms
+/// of the GNU General Public License as published by the Free Software
+/// Foundation; either version 2 of the License, or (at your option) any
+/// later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with this program; if not, write to the Free Software
+/// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+/// 02110-1301, USA.
+///
+/// Our contact details: Virtuozzo International GmbH, Vordergasse 59, 8200
+/// Schaffhausen, Switzerland.
+///
+/// @file
+///		CTransponsterWriterTest.cpp
+///
+/// @brief
+///		Tests fixture class for testing the stream based XML writer of
+///		the transponster.
+///
+/// @brief
+///		None.
+///
+/////////////////////////////////////////////////////////////////////////////
+
+
+#include "CTransponsterWriterTest.h"
+#include <QDomDocument>
+#include "Libraries/Transponster/Direct.h"
+#include "Libraries/Transponster/filter_type.h"
+#include "Libraries/Transponster/blockexport_type.h"
+#include "Libraries/Transponster/blocksnapshot_type.h"
+
+using Transponster::Direct::Reader;
+using Transponster::Direct::Writer;
+
+namespace
+{
+const char s_domain[] =
+	"<domain type='kvm' xmlns:vz='http://www.virtuozzo.com/vz'"
+	" xmlns:qemu='http://libvirt.org/schemas/domain/qemu/1.0'>\n"
+	"  <name>round &amp; trip</name>\n"
+	"  <uuid>8f2f6a51-8b8d-4c3d-9c38-3a2d1e6b2f10</uuid>\n"
+	"  <description>a \"quoted\" &lt;VM&gt;</description>\n"
+	"  <metadata>\n"
+	"    <vz:info vz:id='7' type='x'>y</vz:info>\n"
+	"  </metadata>\n"
+	"  <memory unit='KiB'>2097152</memory>\n"
+	"  <vcpu placement='static'>2</vcpu>\n"
+	"  <os>\n"
+	"    <type arch='x86_64' machine='pc'>hvm</type>\n"
+	"    <boot dev='hd'/>\n"
+	"  </os>\n"
+	"  <features>\n"
+	"    <acpi/>\n"
+	"    <apic/>\n"
+	"  </features>\n"
+	"  <clock offset='utc'/>\n"
+	"  <on_poweroff>destroy</on_poweroff>\n"
+	"  <devices>\n"
+	"    <controller type='usb' index='0' model='ich9-uhci1' ports='8'>\n"
+	"      <master startport='0'/>\n"
+	"    </controller>\n"
+	"    <disk type='file' device='disk'>\n"
+	"      <driver name='qemu' type='qcow2' cache='none'/>\n"
+	"      <source file='/vz/vmprivate/vm/harddisk.hdd'/>\n"
+	"      <target dev='sda' bus='scsi'/>\n"
+	"      <serial>1000</serial>\n"
+	"    </disk>\n"
+	"    <interface type='bridge'>\n"
+	"      <mac address='00:1c:42:00:00:01'/>\n"
+	"      <source bridge='br0'/>\n"
+	"      <model type='virtio'/>\n"
+	"    </interface>\n"
+	"  </devices>\n"
+	"  <qemu:commandline>\n"
+	"    <qemu:arg value='-S'/>\n"
+	"  </qemu:commandline>\n"
+	"</domain>\n";
+
+const char s_network[] =
+	"<network>\n"
+	"  <name>Host-Only</name>\n"
+	"  <uuid>3e3fce45-4f53-4fa7-bb32-11f34168b82b</uuid>\n"
+	"  <bridge name='virbr1' stp='off'/>\n"
+	"  <ip address='10.37.130.2' netmask='255.255.255.0'>\n"
+	"    <dhcp>\n"
+	"      <range start='10.37.130.1' end='10.37.130.254'/>\n"
+	"    </dhcp>\n"
+	"  </ip>\n"
+	"</network>\n";
+
+const char s_snapshot[] =
+	"<domainsnapshot>\n"
+	"  <name>{5f1c3a2b-1d4e-4f6a-9b8c-7d6e5f4a3b2c}</name>\n"
+	"  <description>before \"update\" &amp; reboot</description>\n"
+	"  <memory snapshot='internal'/>\n"
+	"</domainsnapshot>\n";
+
+const char s_blocksnapshot[] =
+	"<domainblocksnapshot>\n"
+	"  <name>backup</name>\n"
+	"  <disk name='sda'>\n"
+	"    <fleece file='/vz/tmp/sda.qcow2'/>\n"
+	"  </disk>\n"
+	"</domainblocksnapshot>\n";
+
+const char s_blockexport[] =
+	"<domainblockexport type='nbd'>\n"
+	"  <address type='ip' host='127.0.0.1' port='10809'/>\n"
+	"  <disk name='sda' snapshot='backup' exportname='sda'/>\n"
+	"</domainblockexport>\n";
+
+const char s_filter[] =
+	"<filter name='vz-filter-C437720DFB3C'>\n"
+	"  <rule direction='in' action='return' priority='0'>\n"
+	"    <all state='ESTABLISHED,RELATED'/>\n"
+	"  </rule>\n"
+	"  <rule direction='in' action='drop' priority='2'>\n"
+	"    <tcp dstipaddr='192.168.0.100' srcipaddr='192.168.0.101'/>\n"
+	"  </rule>\n"
+	"</filter>\n";
+
+const char s_nodedev[] =
+	"<device>\n"
+	"  <name>net_eth0_00_1c_42_aa_bb_cc</name>\n"
+	"  <path>/sys/devices/pci0000:00/0000:00:05.0/net/eth0</path>\n"
+	"  <capability type='net'>\n"
+	"    <interface>eth0</interface>\n"
+	"    <address>00:1c:42:aa:bb:cc</address>\n"
+	"    <link speed='1000' state='up'/>\n"
+	"  </capability>\n"
+	"</device>\n";
+
+const char s_capability[] =
+	"<domainCapabilities>\n"
+	"  <path>/usr/libexec/qemu-kvm</path>\n"
+	"  <domain>kvm</domain>\n"
+	"  <machine>pc</machine>\n"
+	"  <arch>x86_64</arch>\n"
+	"  <vcpu max='240'/>\n"
+	"</domainCapabilities>\n";
+
+template<class T>
+QString write(const T& object_)
+{
+	Writer w;
+	if (!object_.save(w.getStream()) || w.getStream().hasError())
+		return QString();
+
+	return w.getResult();
+}
+
+template<class T>
+QDomDocument reload(const QByteArray& xml_)
+{
+	QDomDocument x, output;
+	T a;
+	if (Reader::load(xml_, x) && a.load(x.documentElement()))
+		Reader::load(write(a).toUtf8(), output);
+
+	return output;
+}
+
+// loads the text into the generated type, writes it out and loads it back.
+// the attribute order differs from QDom, thus both copies are saved through
+// QDom to be compared. the second write has to repeat the first one.
+template<class T>
+void roundTrip(const QByteArray& xml_)
+{
+	QDomDocument x;
+	QVERIFY(Reader::load(xml_, x));
+	T a;
+	QVERIFY(a.load(x.documentElement()));
+
+	QString s = write(a);
+	QVERIFY(!s.isEmpty());
+
+	QDomDocument y;
+	QVERIFY(Reader::load(s.toUtf8(), y));
+	T b;
+	QVERIFY(b.load(y.documentElement()));
+
+	QDomDocument u, v;
+	QVERIFY(a.save(u));
+	QVERIFY(b.save(v));
+	QCOMPARE(v.toString(), u.toString());
+	QCOMPARE(write(b), s);
+}
+
+} // namespace
+
+void CTransponsterWriterTest::testRoundTrip_data()
+{
+	QTest::addColumn<QString>("schema");
+	QTest::addColumn<QByteArray>("xml");
+
+	QTest::newRow("domain") << QString("domain") << QByteArray(s_domain);
+	QTest::newRow("network") << QString("network") << QByteArray(s_network);
+	QTest::newRow("snapshot") << QString("snapshot") << QByteArray(s_snapshot);
+	QTest::newRow("blocksnapshot") << QString("blocksnapshot")
+		<< QByteArray(s_blocksnapshot);
+	QTest::newRow("blockexport") << QString("blockexport")
+		<< QByteArray(s_blockexport);
+	QTest::newRow("filter") << QString("filter") << QByteArray(s_filter);
+	QTest::newRow("nodedev") << QString("nodedev") << QByteArray(s_nodedev);
+	QTest::newRow("capability") << QString("capability")
+		<< QByteArray(s_capability);
+}
+
+void CTransponsterWriterTest::testRoundTrip()
+{
+	QFETCH(QString, schema);
+	QFETCH(QByteArray, xml);
+
+	if (schema == "domain")
+		roundTrip<Libvirt::Domain::Xml::Domain>(xml);
+	else if (schema == "network")
+		roundTrip<Libvirt::Network::Xml::Network>(xml);
+	else if (schema == "snapshot")
+		roundTrip<Libvirt::Snapshot::Xml::Domainsnapshot>(xml);
+	else if (schema == "blocksnapshot")
+		roundTrip<Libvirt::Blocksnapshot::Xml::Domainblocksnapshot>(xml);
+	else if (schema == "blockexport")
+		roundTrip<Libvirt::Blockexport::Xml::Domainblockexport_>(xml);
+	else if (schema == "filter")
+		roundTrip<Libvirt::Filter::Xml::Filter>(xml);
+	else if (schema == "nodedev")
+		roundTrip<Libvirt::Nodedev::Xml::Device>(xml);
+	else if (schema == "capability")
+		roundTrip<Libvirt::Capability::Xml::DomainCapabilities>(xml);
+	else
+		QFAIL("unknown schema");
+}
+
+void CTransponsterWriterTest::testAttributesFirst()
+{
+	// the schema lists the ports attribute after the master element
+	QDomDocument x = reload<Libvirt::Domain::Xml::Domain>(s_domain);
+	QDomElement c = x.documentElement().firstChildElement("devices")
+		.firstChildElement("controller");
+	QVERIFY(!c.isNull());
+	QCOMPARE(c.attribute("type"), QString("usb"));
+	QCOMPARE(c.attribute("ports"), QString("8"));
+	QCOMPARE(c.firstChildElement("master").attribute("startport"), QString("0"));
+}
+
+void CTransponsterWriterTest::testPod()
+{
+	QDomDocument x = reload<Libvirt::Domain::Xml::Domain>(s_domain);
+	QDomElement e = x.documentElement().firstChildElement("metadata")
+		.firstChildElement();
+	QCOMPARE(e.namespaceURI(), QString("http://www.virtuozzo.com/vz"));
+	QCOMPARE(e.localName(), QString("info"));
+	QCOMPARE(e.attributeNS("http://www.virtuozzo.com/vz", "id"), QString("7"));
+	QCOMPARE(e.attribute("type"), QString("x"));
+	QCOMPARE(e.text(), QString("y"));
+}
+
+void CTransponsterWriterTest::testScoped()
+{
+	QDomDocument x = reload<Libvirt::Domain::Xml::Domain>(s_domain);
+	QDomNodeList n = x.documentElement().elementsByTagNameNS(
+		"http://libvirt.org/schemas/domain/qemu/1.0", "commandline");
+	QCOMPARE(n.count(), 1);
+	QCOMPARE(n.at(0).firstChildElement().attribute("value"), QString("-S"));
+}
+
+void CTransponsterWriterTest::benchmarkDom()
+{
+	QDomDocument x;
+	Libvirt::Domain::Xml::Domain d;
+	QVERIFY(Reader::load(s_domain, x));
+	QVERIFY(d.load(x.documentElement()));
+	QBENCHMARK
+	{
+		QDomDocument y;
+		d.save(y);
+		y.toString();
+	}
+}
+
+void CTransponsterWriterTest::benchmarkWriter()
+{
+	QDomDocument x;
+	Libvirt::Domain::Xml::Domain d;
+	QVERIFY(Reader::load(s_domain, x));
+	QVERIFY(d.load(x.documentElement()));
+	QBENCHMARK
+	{
+		write(d);
+	}
+}
@@ -14,27 +14,53 @@ QMAKE_EXTRA_TARGETS += first copydata
 HEADERS += \
 	$$SRC_LEVEL/Dispatcher/Dispatcher/Stat/CDspStatisticsGuard.h\
 	$$SRC_LEVEL/Dispatcher/Dispatcher/Stat/CDspSystemInfo.h\
+	$$SRC_LEVEL/Dispatcher/Dispatcher/Stat/CDspStatStorage.h\
+	$$SRC_LEVEL/Dispatcher/Dispatcher/Stat/CDspStatFilter.h\
+	$$SRC_LEVEL/Dispatcher/Dispatcher/CDspLibvirtRecord.h\
+	$$SRC_LEVEL/Dispatcher/Dispatcher/CDspLibvirtLoop.h\
+	$$SRC_LEVEL/Dispatcher/Dispatcher/CDspVmDirIndex.h\
 	$$SRC_LEVEL/Tests/DispatcherTestsUtils.h\
 	$$SRC_LEVEL/Tests/AclTestsUtils.h\
 	CDspStatisticsGuardTest.h\
+	CDspStatStorageTest.h\
+	CDspStatFilterTest.h\
+	CDspLibvirtRecordTest.h\
+	CDspLibvirtLoopTest.h\
+	CDspVmDirIndexTest.h\
 	PrlCommonUtilsTest.h \
 	CGuestOsesHelperTest.h \
 	CProblemReportUtilsTest.h \
 	CXmlModelHelperTest.h \
 	CFeaturesMatrixTest.h \
 	CTransponsterNwfilterTest.h \
+	CTransponsterReaderTest.h \
+	CTransponsterEnumTest.h \
+	CTransponsterWriterTest.h \
 	CQDomElementHelperTest.h
 
 SOURCES += \
 	Main.cpp\
 	$$SRC_LEVEL/Dispatcher/Dispatcher/Stat/CDspStatisticsGuard.cpp\
+	$$SRC_LEVEL/Dispatcher/Dispatcher/Stat/CDspStatStorage.cpp\
+	$$SRC_LEVEL/Dispatcher/Dispatcher/Stat/CDspStatFilter.cpp\
+	$$SRC_LEVEL/Dispatcher/Dispatcher/CDspLibvirtRecord.cpp\
+	$$SRC_LEVEL/Dispatcher/Dispatcher/CDspLibvirtLoop.cpp\
+	$$SRC_LEVEL/Dispatcher/Dispatcher/CDspVmDirIndex.cpp\
 	CDspStatisticsGuardTest.cpp\
+	CDspStatStorageTest.cpp\
+	CDspStatFilterTest.cpp\
+	CDspLibvirtRecordTest.cpp\
+	CDspLibvirtLoopTest.cpp\
+	CDspVmDirIndexTest.cpp\
 	PrlCommonUtilsTest.cpp \
 	CGuestOsesHelperTest.cpp \
 	CProblemReportUtilsTest.cpp \
 	CXmlModelHelperTest.cpp \
 	CFeaturesMatrixTest.cpp \
 	CTransponsterNwfilterTest.cpp \
+	CTransponsterReaderTest.cpp \
+	CTransponsterEnumTest.cpp \
+	CTransponsterWriterTest.cpp \
 	CQDomElementHelperTest.cpp
 
 
@@ -41,9 +41,17 @@
 #include "Tests/DispatcherTestsUtils.h"
 
 #include "CDspStatisticsGuardTest.h"
+#include "CDspStatStorageTest.h"
+#include "CDspStatFilterTest.h"
+#include "CDspLibvirtRecordTest.h"
+#include "CDspLibvirtLoopTest.h"
+#include "CDspVmDirIndexTest.h"
 #include "PrlCommonUtilsTest.h"
 #include "CGuestOsesHelperTest.h"
 #include "CTransponsterNwfilterTest.h"
+#include "CTransponsterReaderTest.h"
+#include "CTransponsterEnumTest.h"
+#include "CTransponsterWriterTest.h"
 #ifdef _WIN_
 #include "CWifiHelperTest.h"
 #endif
@@ -58,6 +66,11 @@ int main(int argc, char *argv[])
 
 	int nRet = 0;
 	EXECUTE_TESTS_SUITE( CDspStatisticsGuardTest )
+	EXECUTE_TESTS_SUITE( CDspStatStorageTest )
+	EXECUTE_TESTS_SUITE( CDspStatFilterTest )
+	EXECUTE_TESTS_SUITE( CDspLibvirtRecordTest )
+	EXECUTE_TESTS_SUITE( CDspLibvirtLoopTest )
+	EXECUTE_TESTS_SUITE( CDspVmDirIndexTest )
 	EXECUTE_TESTS_SUITE( PrlCommonUtilsTest )
 	EXECUTE_TESTS_SUITE( CGuestOsesHelperTest )
 #ifdef _WIN_
@@ -67,6 +80,9 @@ int main(int argc, char *argv[])
 	EXECUTE_TESTS_SUITE( CXmlModelHelperTest )
 	EXECUTE_TESTS_SUITE( CFeaturesMatrixTest )
 	EXECUTE_TESTS_SUITE( CTransponsterNwfilterTest )
+	EXECUTE_TESTS_SUITE( CTransponsterReaderTest )
+	EXECUTE_TESTS_SUITE( CTransponsterEnumTest )
+	EXECUTE_TESTS_SUITE( CTransponsterWriterTest )
 
 	return nRet;
 }